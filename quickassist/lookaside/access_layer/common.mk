@@ -99,6 +99,11 @@ ifeq ($(DISABLE_STATS), 1)
 EXTRA_CFLAGS += -DDISABLE_STATS
 endif
 
+# Host cycle profile of the PKE request path, see icp_sal_CyGetPkeProfile
+ifeq ($(ICP_PKE_PROFILE), 1)
+EXTRA_CFLAGS += -DICP_PKE_PROFILE
+endif
+
 # Disable NUMA allocation thorough OSAL
 EXTRA_CFLAGS += -DDISABLE_NUMA_ALLOCATION
 
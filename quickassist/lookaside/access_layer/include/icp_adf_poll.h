@@ -91,4 +91,22 @@ CpaStatus icp_adf_pollInstance(icp_comms_trans_handle *trans_hnd,
                                Cpa32U num_transHandles,
                                Cpa32U response_quota);
 
+/*
+ * icp_adf_waitInstance
+ *
+ * Description:
+ * Arm the interrupts of the hybrid response rings in the table and block
+ * until one of them fires or timeout_ms expires. Returns at once if a
+ * response is already waiting on any of the rings.
+ *
+ * Returns:
+ *   CPA_STATUS_SUCCESS     responses may be waiting
+ *   CPA_STATUS_RETRY       the timeout expired
+ *   CPA_STATUS_UNSUPPORTED the rings have no interrupt to wait on
+ *   CPA_STATUS_FAIL        on error
+ */
+CpaStatus icp_adf_waitInstance(icp_comms_trans_handle *trans_hnd,
+                               Cpa32U num_transHandles,
+                               Cpa32U timeout_ms);
+
 #endif /* ICP_ADF_POLL_H */
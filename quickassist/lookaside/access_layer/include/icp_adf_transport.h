@@ -92,6 +92,7 @@ typedef enum icp_resp_deliv_method_e
     ICP_RESP_TYPE_NONE = 0,
     ICP_RESP_TYPE_IRQ,
     ICP_RESP_TYPE_POLL,
+    ICP_RESP_TYPE_HYBRID, /* polled, interrupt armed only before blocking */
     ICP_RESP_TYPE_DELIMIT
 } icp_resp_deliv_method;
 
@@ -248,6 +249,59 @@ CpaStatus icp_adf_transPutMsg(icp_comms_trans_handle trans_handle,
                               Cpa32U *inBufs,
                               Cpa32U bufLen);
 
+/*
+ * icp_adf_transPutMsgs
+ *
+ * Description:
+ * Put a burst of messages onto the transport handle. As many messages
+ * as there is room for on the ring are sent, in order, and the number
+ * sent is returned in numSent. The ring tail is updated once per call.
+ *
+ * Returns:
+ *   CPA_STATUS_SUCCESS   on success, numSent may be less than numMsgs
+ *   CPA_STATUS_RETRY     if the ring is full and no message was sent
+ *   CPA_STATUS_FAIL      on failure
+ */
+CpaStatus icp_adf_transPutMsgs(icp_comms_trans_handle trans_handle,
+                               Cpa32U **inBufs,
+                               Cpa32U bufLen,
+                               Cpa32U numMsgs,
+                               Cpa32U *numSent);
+
+/*
+ * icp_adf_transSetExclusiveOwner
+ *
+ * Description:
+ * Declare that the transport handle is only ever used from one thread.
+ * The ring lock and the atomic updates on the submit and poll paths
+ * are then skipped. Must not be called while requests are in flight.
+ * Note: Not all transports support method.
+ *
+ * Returns:
+ *   CPA_STATUS_SUCCESS     on success
+ *   CPA_STATUS_RETRY       if requests are in flight on the ring
+ *   CPA_STATUS_UNSUPPORTED if not supported by the transport
+ */
+CpaStatus icp_adf_transSetExclusiveOwner(icp_comms_trans_handle trans_handle,
+                                         CpaBoolean exclusive);
+
+/*
+ * icp_adf_transGetInflight
+ *
+ * Description:
+ * Returns the number of requests currently in flight on the transport
+ * handle and the number it accepts before icp_adf_transPutMsg returns
+ * CPA_STATUS_RETRY. The count is a snapshot, other threads may be adding
+ * or completing requests.
+ *
+ * Returns:
+ *   CPA_STATUS_SUCCESS   on success
+ *   CPA_STATUS_FAIL      on failure
+ */
+CpaStatus icp_adf_transGetInflight(icp_comms_trans_handle trans_handle,
+                                   Cpa32U *pNumInflight,
+                                   Cpa32U *pMaxInflight);
+
 /*
  * icp_adf_transPutMsgSync
  *
@@ -74,6 +74,9 @@
 #ifndef ICP_SAL_H
 #define ICP_SAL_H
 
+#include "cpa_cy_sym.h"
+#include "cpa_dc.h"
+
 #ifdef ICP_DC_ERROR_SIMULATION
 /*
  * icp_sal_dc_simulate_error
@@ -127,4 +130,572 @@ CpaStatus icp_sal_dc_simulate_error(Cpa8U numErrors, Cpa8S dcError);
  */
 Cpa64U icp_sal_get_dc_error(Cpa8S dcError);
 
+/*
+ * Counters of the per instance hash precompute cache
+ */
+typedef struct icp_sal_hash_precomp_cache_stats_s
+{
+    Cpa64U numHits;
+    /* Session setups served from the cache */
+    Cpa64U numMisses;
+    /* Session setups that had to run the precompute */
+    Cpa64U numEvictions;
+    /* Valid entries replaced to make room for a new key */
+    Cpa32U numEntries;
+    /* Capacity of the cache in entries */
+} icp_sal_hash_precomp_cache_stats_t;
+
+/*
+ * icp_sal_CyGetHashPrecompCacheStats
+ *
+ * @description:
+ *  This function returns the counters of the hash precompute cache of a
+ *  crypto instance. The cache holds the HMAC state1/state2 and the AES
+ *  XCBC/CMAC/GCM keys derived at session setup, keyed by algorithm and
+ *  key, so sessions set up again with a known key skip the precompute.
+ *  It is enabled by setting Cy<n>HashPrecompCacheSize to the number of
+ *  entries in the configuration file.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[out] pStats                Cache counters
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_UNSUPPORTED    The instance has no precompute cache
+ */
+CpaStatus icp_sal_CyGetHashPrecompCacheStats(
+    CpaInstanceHandle instanceHandle,
+    icp_sal_hash_precomp_cache_stats_t *pStats);
+
+/*
+ * Counters of the per instance host execution of symmetric requests
+ */
+typedef struct icp_sal_sym_host_fallback_stats_s
+{
+    Cpa64U numOffloaded;
+    /* Requests put on the ring */
+    Cpa64U numHostExecuted;
+    /* Requests executed on the host because the ring was busy */
+    Cpa64U numHostIneligible;
+    /* Requests that found the ring busy but could not run on the host */
+} icp_sal_sym_host_fallback_stats_t;
+
+/*
+ * icp_sal_CyGetSymHostFallbackStats
+ *
+ * @description:
+ *  This function returns the counters of the host execution of symmetric
+ *  requests of a crypto instance. It is enabled by setting
+ *  Cy<n>SymHostFallback in the configuration file to 1, in which case
+ *  small AES-GCM and AES-CBC with HMAC requests in single flat buffers
+ *  are executed on the host when the sym ring is full or holds at least
+ *  Cy<n>SymHostFallbackThreshold requests, or to 2, in which case they
+ *  are always executed on the host. Cy<n>SymHostFallbackMaxSize is the
+ *  largest request in bytes, 2048 by default. Host executed requests
+ *  complete through the session callback before the perform returns and
+ *  may complete ahead of requests of the same session already on the
+ *  ring. Only user space instances support it.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[out] pStats                Host execution counters
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_UNSUPPORTED    Host execution is disabled
+ */
+CpaStatus icp_sal_CyGetSymHostFallbackStats(
+    CpaInstanceHandle instanceHandle,
+    icp_sal_sym_host_fallback_stats_t *pStats);
+
+/*
+ * icp_sal_CySymCloneSession
+ *
+ * @description:
+ *  This function sets up a symmetric session as a copy of an already
+ *  initialised template session, replacing only the keys. The content
+ *  descriptor and request templates built for the template session are
+ *  copied and only the key material and the key dependent precomputes
+ *  are regenerated, which is much cheaper than cpaCySymInitSession when
+ *  many sessions share one transform (e.g. IPsec SAs).
+ *  The same rules as for cpaCySymUpdateSession apply to the keys: an
+ *  auth key can only be given for sessions in CPA_CY_SYM_HASH_MODE_AUTH,
+ *  and for AES-GCM/CCM the cipher key also derives the auth key so
+ *  pAuthKey must be NULL. A NULL key keeps the key of the template.
+ *  The new session uses the same callback function as the template and
+ *  is removed with cpaCySymRemoveSession.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance the template session
+ *                                   was initialised on
+ * @param[in] pTemplateSessionCtx    Initialised session to copy
+ * @param[in] sessionCtxSizeInBytes  Size returned by
+ *                                   cpaCySymSessionCtxGetDynamicSize for the
+ *                                   template setup data. Both session
+ *                                   contexts must be at least this big
+ * @param[in] pCipherKey             New cipher key or NULL
+ * @param[in] pAuthKey               New authentication key or NULL
+ * @param[out] pSessionCtx           Memory for the new session context
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          The template is being updated or its
+ *                                   precompute has not completed yet
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in, or
+ *                                   sessionCtxSizeInBytes does not match the
+ *                                   size the template was set up for
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_UNSUPPORTED    Key update not supported for the session
+ */
+CpaStatus icp_sal_CySymCloneSession(
+    const CpaInstanceHandle instanceHandle,
+    const CpaCySymSessionCtx pTemplateSessionCtx,
+    Cpa32U sessionCtxSizeInBytes,
+    Cpa8U *pCipherKey,
+    Cpa8U *pAuthKey,
+    CpaCySymSessionCtx pSessionCtx);
+
+/*
+ * icp_sal_CySymInitSessions
+ *
+ * @description:
+ *  This function initialises numSessions symmetric sessions which share
+ *  the setup data in pSessionSetupData and differ only in their keys.
+ *  The first session is initialised in full and the others are cloned
+ *  from it as with icp_sal_CySymCloneSession. Entry i of ppCipherKeys
+ *  and ppAuthKeys gives the keys of session i; either array may be NULL
+ *  to use the keys in pSessionSetupData for all sessions.
+ *  If any session fails to initialise, the sessions already set up by the
+ *  call are removed again and the error is returned.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      Each entry of pSessionCtxs points to memory of the size returned by
+ *      cpaCySymSessionCtxGetSize for pSessionSetupData
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[in] pSymCb                 Callback function, NULL for synchronous
+ * @param[in] pSessionSetupData      Setup data common to all the sessions
+ * @param[in] numSessions            Number of sessions to initialise
+ * @param[in] ppCipherKeys           Per session cipher keys or NULL
+ * @param[in] ppAuthKeys             Per session authentication keys or NULL
+ * @param[out] pSessionCtxs          Session contexts to initialise
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          Resubmit the request
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_UNSUPPORTED    Key update not supported for the session
+ */
+CpaStatus icp_sal_CySymInitSessions(
+    const CpaInstanceHandle instanceHandle,
+    const CpaCySymCbFunc pSymCb,
+    const CpaCySymSessionSetupData *pSessionSetupData,
+    Cpa32U numSessions,
+    Cpa8U **ppCipherKeys,
+    Cpa8U **ppAuthKeys,
+    CpaCySymSessionCtx *pSessionCtxs);
+
+/*
+ * Counters of the per instance PKE operand marshalling
+ */
+typedef struct icp_sal_pke_resize_stats_s
+{
+    Cpa64U numInPlace;
+    /* Operands passed to the accelerator in the caller's buffer */
+    Cpa64U numArena;
+    /* Operands padded in the operand arena of the request chain */
+    Cpa64U numAllocated;
+    /* Operands padded in a buffer allocated from the resize pool */
+    Cpa64U numRejected;
+    /* Short operands rejected because pre-padded operands are required */
+    Cpa64U numBytesCopied;
+    /* Bytes copied between caller buffers and padded operands */
+} icp_sal_pke_resize_stats_t;
+
+/*
+ * icp_sal_CyGetPkeResizeStats
+ *
+ * @description:
+ *  This function returns the counters of the PKE operand marshalling of a
+ *  crypto instance. Every RSA, DH, DSA, ECC, prime and large number
+ *  operand shorter than the operand size of the accelerator function is
+ *  zero padded into a copy, and output operands are copied back when the
+ *  request completes. The copies are carved from an arena that the request
+ *  takes from a pool of the instance, and only fall back to an allocation
+ *  from the resize pool when the arena is full or none is free.
+ *  Setting Cy<n>AsymPrePaddedOperands to 1 in the configuration file
+ *  requires the caller to pass operands already at the operand size, so
+ *  they are always used in place; shorter operands are then rejected
+ *  with CPA_STATUS_INVALID_PARAM. The counters are only updated when
+ *  statistics are enabled.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[out] pStats                Marshalling counters
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ */
+CpaStatus icp_sal_CyGetPkeResizeStats(CpaInstanceHandle instanceHandle,
+                                      icp_sal_pke_resize_stats_t *pStats);
+
+/*
+ * Number of buckets in each PKE profile histogram. Bucket 0 counts samples
+ * of 0 and 1 cycles, bucket b > 0 counts samples of 2^b to 2^(b+1) - 1
+ * cycles, and the last bucket also counts every longer sample.
+ */
+#define ICP_SAL_PKE_PROFILE_NUM_BUCKETS 24
+
+/*
+ * Stages of the host PKE request path measured by the PKE profile
+ */
+typedef enum icp_sal_pke_profile_stage_e
+{
+    ICP_SAL_PKE_PROFILE_PARAM_CHECK = 0,
+    /* Parameter checks of RSA encrypt and decrypt and ECDSA sign and
+     * verify, without the curve checks */
+    ICP_SAL_PKE_PROFILE_CURVE_CHECK,
+    /* ECDSA operand size and named curve checks */
+    ICP_SAL_PKE_PROFILE_RESIZE,
+    /* Operand padding and copies in LacPke_ResizeParams */
+    ICP_SAL_PKE_PROFILE_CREATE_REQUEST,
+    /* Rest of LacPke_CreateRequest: request allocation, argument lists
+     * and address translation */
+    ICP_SAL_PKE_PROFILE_RING_PUT,
+    /* Successful puts of a request, or of a burst, on the ring */
+    ICP_SAL_PKE_PROFILE_CALLBACK,
+    /* Response handling up to the algorithm callback, including the
+     * copy of the results and the release of the request */
+    ICP_SAL_PKE_PROFILE_SUBMIT,
+    /* Whole asynchronous RSA encrypt and decrypt and ECDSA sign and
+     * verify calls, including the stages above */
+    ICP_SAL_PKE_PROFILE_NUM_STAGES
+} icp_sal_pke_profile_stage_t;
+
+/*
+ * Host cycles spent in one stage of the PKE request path
+ */
+typedef struct icp_sal_pke_profile_stage_stats_s
+{
+    Cpa64U numSamples;
+    /* Number of times the stage was measured */
+    Cpa64U numCycles;
+    /* Sum of the cycles of all the samples */
+    Cpa64U histogram[ICP_SAL_PKE_PROFILE_NUM_BUCKETS];
+    /* Number of samples in each power of two range of cycles */
+} icp_sal_pke_profile_stage_stats_t;
+
+/*
+ * Host cycles spent in each stage of the PKE request path of an instance
+ */
+typedef struct icp_sal_pke_profile_s
+{
+    icp_sal_pke_profile_stage_stats_t stages[ICP_SAL_PKE_PROFILE_NUM_STAGES];
+    /* Indexed by icp_sal_pke_profile_stage_t */
+} icp_sal_pke_profile_t;
+
+/*
+ * icp_sal_CyGetPkeProfile
+ *
+ * @description:
+ *  This function returns the host cycles spent by a crypto instance in
+ *  each stage of the PKE request path since the instance was started or
+ *  its profile was last reset. The profile is only collected when the
+ *  access layer is built with ICP_PKE_PROFILE=1. Each stage is timed with
+ *  the time stamp counter and counted in the statistics shard of the
+ *  calling thread, or in kernel space in the counters of the current
+ *  CPU, so threads submitting on the same instance do not share counters.
+ *  The shards are summed here. On platforms without a time stamp counter
+ *  in user space the samples are in microseconds.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[out] pProfile              Cycles spent in each stage
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_UNSUPPORTED    Profiling is not built in
+ */
+CpaStatus icp_sal_CyGetPkeProfile(CpaInstanceHandle instanceHandle,
+                                  icp_sal_pke_profile_t *pProfile);
+
+/*
+ * icp_sal_CyResetPkeProfile
+ *
+ * @description:
+ *  This function sets every counter of the PKE profile of a crypto
+ *  instance to zero. Stages measured while the reset is in progress may
+ *  be partly counted.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_UNSUPPORTED    Profiling is not built in
+ */
+CpaStatus icp_sal_CyResetPkeProfile(CpaInstanceHandle instanceHandle);
+
+/*
+ * icp_sal_dc_batch_op_data_t
+ *
+ * @description:
+ *  One request of a traditional API compression batch. The fields have
+ *  the same meaning as the parameters of cpaDcCompressData2 and
+ *  cpaDcDecompressData2.
+ */
+typedef struct icp_sal_dc_batch_op_data_s
+{
+    CpaDcSessionHandle pSessionHandle;
+    /**< Stateless session the request is processed on */
+    CpaBufferList *pSrcBuff;
+    /**< Source buffer list */
+    CpaBufferList *pDestBuff;
+    /**< Destination buffer list */
+    CpaDcOpData *pOpData;
+    /**< Flush flag and compress and verify settings */
+    CpaDcRqResults *pResults;
+    /**< Results of the request */
+    void *callbackTag;
+    /**< Passed to the session callback for this request */
+} icp_sal_dc_batch_op_data_t;
+
+/*
+ * icp_sal_DcCompressDataBatch
+ *
+ * @description:
+ *  This function submits numRequests compression requests, which may be
+ *  on different sessions of the instance, with one ring tail update per
+ *  burst instead of one per request. All the entries are checked before
+ *  any request is built; if one is invalid nothing is submitted. Each
+ *  request completes through the callback of its session with its own
+ *  callbackTag, exactly as if it was sent with cpaDcCompressData2.
+ *  Only stateless sessions with an asynchronous callback can be used.
+ *  If the ring fills up, or every request descriptor of the instance is
+ *  waiting for its response to be polled, the requests already on the
+ *  ring are kept and CPA_STATUS_RETRY is returned; the entries from
+ *  *pNumSubmitted onwards were not submitted and can be passed again in a
+ *  later call, after polling the instance.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] dcInstance             Compression instance handle
+ * @param[in] numRequests            Number of entries in pBatchOpData
+ * @param[in] pBatchOpData           Requests to submit
+ * @param[out] pNumSubmitted         Number of requests put on the ring
+ * @retval CPA_STATUS_SUCCESS        All the requests were submitted
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          The ring is full, resubmit the rest
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_UNSUPPORTED    Stateful or synchronous session, or
+ *                                   unsupported compress and verify mode
+ */
+CpaStatus icp_sal_DcCompressDataBatch(CpaInstanceHandle dcInstance,
+                                      Cpa32U numRequests,
+                                      icp_sal_dc_batch_op_data_t *pBatchOpData,
+                                      Cpa32U *pNumSubmitted);
+
+/*
+ * icp_sal_DcDecompressDataBatch
+ *
+ * @description:
+ *  This function is the decompression counterpart of
+ *  icp_sal_DcCompressDataBatch. The compress and verify settings of the
+ *  pOpData entries are ignored, as for cpaDcDecompressData2.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] dcInstance             Compression instance handle
+ * @param[in] numRequests            Number of entries in pBatchOpData
+ * @param[in] pBatchOpData           Requests to submit
+ * @param[out] pNumSubmitted         Number of requests put on the ring
+ * @retval CPA_STATUS_SUCCESS        All the requests were submitted
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          The ring is full, resubmit the rest
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_UNSUPPORTED    Stateful or synchronous session
+ */
+CpaStatus icp_sal_DcDecompressDataBatch(
+    CpaInstanceHandle dcInstance,
+    Cpa32U numRequests,
+    icp_sal_dc_batch_op_data_t *pBatchOpData,
+    Cpa32U *pNumSubmitted);
+
+/*
+ * icp_sal_BufferListRegister
+ *
+ * @description:
+ *  This function registers a buffer list that is submitted repeatedly
+ *  with the same buffers. The firmware descriptor is built in the
+ *  metadata of the list and the physical addresses of the metadata and
+ *  of every buffer are cached there, so later requests with the list on
+ *  cpaCySymPerformOp or the cpaDc data path APIs only refresh the buffer
+ *  lengths instead of translating every address again.
+ *  The dataLenInBytes of the buffers may change between requests. The
+ *  list keeps a record of pBuffers, numBuffers and the pData of every
+ *  buffer, and a request with any of them changed rebuilds the descriptor
+ *  and records the new buffers. A list with more buffers than when it was
+ *  registered is rebuilt on every request. The record is freed by
+ *  icp_sal_BufferListDeregister, which must be called before the list or
+ *  its metadata is freed.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      The buffers and the metadata stay pinned while the list is registered
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No - the list must not be in use by a request
+ *
+ * @param[in] instanceHandle         Crypto or compression instance handle
+ * @param[in] pBufferList            Buffer list to register, with metadata
+ *                                   of the size returned by
+ *                                   cpaCyBufferListGetMetaSize or
+ *                                   cpaDcBufferListGetMetaSize
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Address translation failed
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in, or the
+ *                                   list is already registered
+ * @retval CPA_STATUS_RESOURCE       Could not allocate the record
+ */
+CpaStatus icp_sal_BufferListRegister(const CpaInstanceHandle instanceHandle,
+                                     CpaBufferList *pBufferList);
+
+/*
+ * icp_sal_BufferListInvalidate
+ *
+ * @description:
+ *  This function marks the cached descriptor of a registered buffer list
+ *  as stale. The next request with the list rebuilds the descriptor and
+ *  caches it again; the list stays registered. It is only needed when the
+ *  memory behind a buffer changes while its pData stays the same, e.g. a
+ *  buffer freed and allocated again at the same address.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No - the list must not be in use by a request
+ *
+ * @param[in] pBufferList            Registered buffer list
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  The list is not registered
+ */
+CpaStatus icp_sal_BufferListInvalidate(CpaBufferList *pBufferList);
+
+/*
+ * icp_sal_BufferListDeregister
+ *
+ * @description:
+ *  This function removes the registration of a buffer list. Later
+ *  requests with the list build its descriptor on every request again.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No - the list must not be in use by a request
+ *
+ * @param[in] pBufferList            Registered buffer list
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  The list is not registered
+ */
+CpaStatus icp_sal_BufferListDeregister(CpaBufferList *pBufferList);
+
 #endif
@@ -0,0 +1,212 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file icp_sal_asym_batch.h
+ *
+ * @ingroup SalCommon
+ *
+ * Batched submission of RSA decrypt and ECDSA sign requests.
+ *
+ ***************************************************************************/
+
+#ifndef ICP_SAL_ASYM_BATCH_H
+#define ICP_SAL_ASYM_BATCH_H
+
+#include "cpa_cy_rsa.h"
+#include "cpa_cy_ecdsa.h"
+
+/*
+ * icp_sal_rsa_decrypt_batch_op_data_t
+ *
+ * @description:
+ *  One request of an RSA decrypt batch. The fields have the same meaning
+ *  as the parameters of cpaCyRsaDecrypt.
+ */
+typedef struct icp_sal_rsa_decrypt_batch_op_data_s
+{
+    CpaCyRsaDecryptOpData *pDecryptOpData;
+    /**< Private key and ciphertext */
+    CpaFlatBuffer *pOutputData;
+    /**< Decrypted message */
+    void *pCallbackTag;
+    /**< Passed to the callback for this request */
+} icp_sal_rsa_decrypt_batch_op_data_t;
+
+/*
+ * icp_sal_ecdsa_sign_rs_batch_op_data_t
+ *
+ * @description:
+ *  One request of an ECDSA sign batch. The fields have the same meaning
+ *  as the parameters of cpaCyEcdsaSignRS.
+ */
+typedef struct icp_sal_ecdsa_sign_rs_batch_op_data_s
+{
+    CpaCyEcdsaSignRSOpData *pOpData;
+    /**< Curve, private key, digest and random value */
+    CpaFlatBuffer *pR;
+    /**< r component of the signature */
+    CpaFlatBuffer *pS;
+    /**< s component of the signature */
+    void *pCallbackTag;
+    /**< Passed to the callback for this request */
+} icp_sal_ecdsa_sign_rs_batch_op_data_t;
+
+/*
+ * icp_sal_CyRsaDecryptBatch
+ *
+ * @description:
+ *  This function submits numRequests RSA decrypt requests with one ring
+ *  tail update per burst instead of one per request. With ICP_PARAM_CHECK
+ *  all the entries are checked before any request is built; if one is
+ *  invalid nothing is submitted. Each request completes through
+ *  pRsaDecryptCb with its own pCallbackTag, exactly as if it was sent
+ *  with cpaCyRsaDecrypt. The requests may use different keys and key
+ *  sizes.
+ *  If the ring fills up, the requests already on the ring are kept and
+ *  CPA_STATUS_RETRY is returned; the entries from *pNumSubmitted onwards
+ *  were not submitted and can be passed again in a later call.
+ *  The requests are built and sent in bursts of up to 16. A burst is
+ *  only sent once all of it is built, but earlier bursts are already on
+ *  the ring when a later one fails. When the library is built without
+ *  ICP_PARAM_CHECK the entries are not checked up front, so an invalid
+ *  entry, like a resource error, can return an error status with
+ *  *pNumSubmitted greater than zero. The first *pNumSubmitted requests
+ *  complete through the callback in every case; the others do not.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[in] pRsaDecryptCb          Callback function, must not be NULL
+ * @param[in] numRequests            Number of entries in pBatchOpData
+ * @param[in] pBatchOpData           Requests to submit
+ * @param[out] pNumSubmitted         Number of requests put on the ring,
+ *                                   also set when an error is returned
+ * @retval CPA_STATUS_SUCCESS        All the requests were submitted
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          The ring is full, resubmit the rest
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_CyRsaDecryptBatch(
+    const CpaInstanceHandle instanceHandle,
+    const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
+    Cpa32U numRequests,
+    icp_sal_rsa_decrypt_batch_op_data_t *pBatchOpData,
+    Cpa32U *pNumSubmitted);
+
+/*
+ * icp_sal_CyEcdsaSignRSBatch
+ *
+ * @description:
+ *  This function is the ECDSA sign counterpart of
+ *  icp_sal_CyRsaDecryptBatch. Each request completes through pCb with its
+ *  own pCallbackTag, exactly as if it was sent with cpaCyEcdsaSignRS.
+ *  The requests may be on different curves. The entries are always
+ *  checked before any request is built, but as for an RSA batch a
+ *  resource error in a later burst returns an error status with the
+ *  earlier bursts already submitted, as given by *pNumSubmitted.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[in] pCb                    Callback function, must not be NULL
+ * @param[in] numRequests            Number of entries in pBatchOpData
+ * @param[in] pBatchOpData           Requests to submit
+ * @param[out] pNumSubmitted         Number of requests put on the ring,
+ *                                   also set when an error is returned
+ * @retval CPA_STATUS_SUCCESS        All the requests were submitted
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          The ring is full, resubmit the rest
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_CyEcdsaSignRSBatch(
+    const CpaInstanceHandle instanceHandle,
+    const CpaCyEcdsaSignRSCbFunc pCb,
+    Cpa32U numRequests,
+    icp_sal_ecdsa_sign_rs_batch_op_data_t *pBatchOpData,
+    Cpa32U *pNumSubmitted);
+
+#endif
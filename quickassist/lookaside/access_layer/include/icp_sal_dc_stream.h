@@ -0,0 +1,312 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file icp_sal_dc_stream.h
+ *
+ * @ingroup SalCommon
+ *
+ * Streaming deflate compression over stateless requests.
+ *
+ ***************************************************************************/
+
+#ifndef ICP_SAL_DC_STREAM_H
+#define ICP_SAL_DC_STREAM_H
+
+#include "cpa_dc.h"
+
+/*
+ * Handle of a compression stream
+ */
+typedef void *icp_sal_dc_stream_handle_t;
+
+/*
+ * icp_sal_dc_stream_setup_data_t
+ *
+ * @description:
+ *  Sizing of a compression stream. The input is cut into chunks of
+ *  chunkSizeInBytes, each compressed by its own stateless request. The
+ *  stream keeps as many chunks in flight as its internal input and output
+ *  buffers fit in memoryBudgetInBytes, up to 64.
+ */
+typedef struct icp_sal_dc_stream_setup_data_s
+{
+    Cpa32U chunkSizeInBytes;
+    /**< Input bytes per request, 0 for the default of 64KB */
+    Cpa32U memoryBudgetInBytes;
+    /**< Upper bound for the stream buffers, 0 for 8 chunks in flight */
+} icp_sal_dc_stream_setup_data_t;
+
+/*
+ * icp_sal_DcStreamCreate
+ *
+ * @description:
+ *  This function initialises a deflate session on pSessionHandle and a
+ *  compression stream on top of it. The stream compresses the data pushed
+ *  into it as a sequence of stateless requests, the non final ones sent
+ *  with CPA_DC_FLUSH_FULL and the last one with CPA_DC_FLUSH_FINAL, so the
+ *  outputs concatenate into a single deflate stream. Several requests are
+ *  kept in flight and their outputs are returned in order by
+ *  icp_sal_DcStreamPull. Each chunk is compressed without the history of
+ *  the previous ones, which costs some compression ratio compared to a
+ *  stateful session.
+ *  The running CRC32 or Adler32 of the stream is kept across the chunks,
+ *  so with the results of icp_sal_DcStreamGetResults, cpaDcGenerateHeader
+ *  and cpaDcGenerateFooter on pSessionHandle frame a valid gzip or zlib
+ *  stream.
+ *  pSessionData must describe a stateless deflate session that can
+ *  compress. The session callback is used by the stream; responses are
+ *  processed by polling the instance as for any other request.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] dcInstance             Compression instance handle
+ * @param[in] pSessionHandle         Memory for the session, of the size
+ *                                   returned by cpaDcGetSessionSize
+ * @param[in] pSessionData           Session setup data
+ * @param[in] pStreamSetupData       Stream sizing
+ * @param[out] phStream              Handle of the new stream
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_UNSUPPORTED    Function is not supported
+ */
+CpaStatus icp_sal_DcStreamCreate(
+    CpaInstanceHandle dcInstance,
+    CpaDcSessionHandle pSessionHandle,
+    CpaDcSessionSetupData *pSessionData,
+    const icp_sal_dc_stream_setup_data_t *pStreamSetupData,
+    icp_sal_dc_stream_handle_t *phStream);
+
+/*
+ * icp_sal_DcStreamPush
+ *
+ * @description:
+ *  This function copies input data into the stream and submits every chunk
+ *  that is complete. A full chunk is only submitted once more data or the
+ *  end of the stream follows it, so that the last chunk can be flagged as
+ *  final. When all the chunk buffers are in use, fewer than length bytes
+ *  are consumed and the caller must pull output before pushing the rest.
+ *  Setting lastData marks the end of the stream once all of the data of
+ *  this call is consumed; no data can be pushed after that until
+ *  icp_sal_DcStreamReset is called.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No - push and pull on one stream must be serialised
+ *
+ * @param[in] hStream                Stream handle
+ * @param[in] pData                  Input data
+ * @param[in] length                 Number of bytes at pData
+ * @param[in] lastData               CPA_TRUE if this ends the stream
+ * @param[out] pConsumed             Number of bytes taken from pData
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           A request of the stream failed
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_DcStreamPush(icp_sal_dc_stream_handle_t hStream,
+                               const Cpa8U *pData,
+                               Cpa32U length,
+                               CpaBoolean lastData,
+                               Cpa32U *pConsumed);
+
+/*
+ * icp_sal_DcStreamPull
+ *
+ * @description:
+ *  This function copies the compressed data of the completed chunks into
+ *  pOut, in stream order, and releases the chunk buffers it empties. It
+ *  does not wait: if the oldest chunk is still in flight nothing is
+ *  returned and the instance must be polled. pEndOfStream is set once
+ *  the last byte of the stream has been returned.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No - push and pull on one stream must be serialised
+ *
+ * @param[in] hStream                Stream handle
+ * @param[out] pOut                  Buffer for the compressed data
+ * @param[in] outLength              Size of pOut in bytes
+ * @param[out] pProduced             Number of bytes written to pOut
+ * @param[out] pEndOfStream          CPA_TRUE when the stream is complete
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           A request of the stream failed
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_DcStreamPull(icp_sal_dc_stream_handle_t hStream,
+                               Cpa8U *pOut,
+                               Cpa32U outLength,
+                               Cpa32U *pProduced,
+                               CpaBoolean *pEndOfStream);
+
+/*
+ * icp_sal_DcStreamGetResults
+ *
+ * @description:
+ *  This function returns the results of a complete stream: the checksum
+ *  of all of the input, the number of bytes consumed and the number of
+ *  compressed bytes produced, header and footer excluded. The results
+ *  can be passed to cpaDcGenerateFooter.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] hStream                Stream handle
+ * @param[out] pResults              Results of the stream
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_RETRY          The stream is not complete yet
+ * @retval CPA_STATUS_FAIL           A request of the stream failed
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ */
+CpaStatus icp_sal_DcStreamGetResults(icp_sal_dc_stream_handle_t hStream,
+                                     CpaDcRqResults *pResults);
+
+/*
+ * icp_sal_DcStreamReset
+ *
+ * @description:
+ *  This function prepares a stream for new data once the previous stream
+ *  is complete or has failed, keeping its session and buffers.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] hStream                Stream handle
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_RETRY          Requests of the stream are in flight
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ */
+CpaStatus icp_sal_DcStreamReset(icp_sal_dc_stream_handle_t hStream);
+
+/*
+ * icp_sal_DcStreamRemove
+ *
+ * @description:
+ *  This function frees a stream and removes its session. Output not
+ *  pulled yet is discarded.
+ *
+ * @context
+ *      This function is called from the user process context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] hStream                Stream handle
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_RETRY          Requests of the stream are in flight
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ */
+CpaStatus icp_sal_DcStreamRemove(icp_sal_dc_stream_handle_t hStream);
+
+#endif
@@ -0,0 +1,219 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file icp_sal_drbg_impl.h
+ *
+ * @defgroup SalDrbgImpl
+ *
+ * @ingroup SalDrbgImpl
+ *
+ * @description
+ *    Implementation specific functions of the DRBG service. The CTR_DRBG
+ *    behind cpaCyDrbgInitSession() takes its entropy input and nonce from
+ *    the functions registered here. When none are registered the operating
+ *    system random number generator is used.
+ *
+ ***************************************************************************/
+
+#ifndef ICP_SAL_DRBG_IMPL_H
+#define ICP_SAL_DRBG_IMPL_H
+
+#include "cpa.h"
+#include "cpa_cy_drbg.h"
+
+/*************************************************************************
+ * @ingroup SalDrbgImpl
+ * @description
+ *    Parameters of a request for entropy input or for a nonce.
+ *************************************************************************/
+typedef struct icp_sal_drbg_get_entropy_op_data_s
+{
+    CpaCyDrbgSessionHandle sessionHandle;
+    /**< DRBG session the input is requested for */
+    Cpa32U minEntropy;
+    /**< Minimum entropy, in bits, the returned input must contain */
+    Cpa32U minLength;
+    /**< Minimum length, in bytes, of the returned input */
+    Cpa32U maxLength;
+    /**< Maximum length, in bytes, of the returned input. The buffer passed
+     * to the function is at least this long */
+} icp_sal_drbg_get_entropy_op_data_t;
+
+/*************************************************************************
+ * @ingroup SalDrbgImpl
+ * @description
+ *    Completion callback of an asynchronous Get Entropy Input function.
+ *
+ * @param[in] pCallbackTag     Tag passed to the Get Entropy Input function
+ * @param[in] opStatus         Status of the operation
+ * @param[in] pOpData          Op data passed to the Get Entropy Input
+ *                             function
+ * @param[in] lenReturned      Number of bytes written to pOut
+ * @param[in] pOut             Buffer passed to the Get Entropy Input
+ *                             function
+ *************************************************************************/
+typedef void (*IcpSalDrbgGetEntropyInputCbFunc)(void *pCallbackTag,
+                                                CpaStatus opStatus,
+                                                void *pOpData,
+                                                Cpa32U lenReturned,
+                                                CpaFlatBuffer *pOut);
+
+/*************************************************************************
+ * @ingroup SalDrbgImpl
+ * @description
+ *    Get Entropy Input function. When pCb is NULL the function completes
+ *    synchronously and returns the number of bytes written in
+ *    pLengthReturned, otherwise it calls pCb on completion.
+ *
+ *    The DRBG service always calls it synchronously.
+ *************************************************************************/
+typedef CpaStatus (*IcpSalDrbgGetEntropyInputFunc)(
+    IcpSalDrbgGetEntropyInputCbFunc pCb,
+    void *pCallbackTag,
+    icp_sal_drbg_get_entropy_op_data_t *pOpData,
+    CpaFlatBuffer *pBuffer,
+    Cpa32U *pLengthReturned);
+
+/*************************************************************************
+ * @ingroup SalDrbgImpl
+ * @description
+ *    Get Nonce function. Completes synchronously and returns the number
+ *    of bytes written in pLengthReturned.
+ *************************************************************************/
+typedef CpaStatus (*IcpSalDrbgGetNonceFunc)(
+    icp_sal_drbg_get_entropy_op_data_t *pOpData,
+    CpaFlatBuffer *pBuffer,
+    Cpa32U *pLengthReturned);
+
+/*************************************************************************
+ * @ingroup SalDrbgImpl
+ * @description
+ *    Returns CPA_TRUE if the derivation function must be used, which is
+ *    the case unless the entropy source delivers full entropy.
+ *************************************************************************/
+typedef CpaBoolean (*IcpSalDrbgIsDFReqFunc)(void);
+
+/*************************************************************************
+ * @ingroup SalDrbgImpl
+ * @description
+ *    Registers the Get Entropy Input function used by sessions
+ *    initialized or reseeded from now on.
+ *
+ * @context
+ *      This function is called from both the user and kernel context
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] func    Function to register, or NULL for the default
+ *
+ * @retval The previously registered function
+ *************************************************************************/
+IcpSalDrbgGetEntropyInputFunc icp_sal_drbgGetEntropyInputFuncRegister(
+    IcpSalDrbgGetEntropyInputFunc func);
+
+/*************************************************************************
+ * @ingroup SalDrbgImpl
+ * @description
+ *    Registers the Get Nonce function used by sessions initialized from
+ *    now on.
+ *
+ * @context
+ *      This function is called from both the user and kernel context
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] func    Function to register, or NULL for the default
+ *
+ * @retval The previously registered function
+ *************************************************************************/
+IcpSalDrbgGetNonceFunc icp_sal_drbgGetNonceFuncRegister(
+    IcpSalDrbgGetNonceFunc func);
+
+/*************************************************************************
+ * @ingroup SalDrbgImpl
+ * @description
+ *    Registers the function deciding whether sessions initialized from now
+ *    on use the derivation function.
+ *
+ * @context
+ *      This function is called from both the user and kernel context
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] func    Function to register, or NULL for the default, which
+ *                    always uses the derivation function
+ *
+ * @retval The previously registered function
+ *************************************************************************/
+IcpSalDrbgIsDFReqFunc icp_sal_drbgIsDFReqFuncRegister(
+    IcpSalDrbgIsDFReqFunc func);
+
+#endif /* ICP_SAL_DRBG_IMPL_H */
@@ -0,0 +1,339 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file icp_sal_ec_curve.h
+ *
+ * @ingroup SalCommon
+ *
+ * Elliptic curve operations on named NIST prime curves.
+ *
+ ***************************************************************************/
+
+#ifndef ICP_SAL_EC_CURVE_H
+#define ICP_SAL_EC_CURVE_H
+
+#include "cpa_cy_ec.h"
+#include "cpa_cy_ecdsa.h"
+
+/*
+ * Named curves
+ */
+typedef enum icp_sal_ec_curve_e
+{
+    ICP_SAL_EC_CURVE_P256 = 0,
+    /**< NIST P-256 */
+    ICP_SAL_EC_CURVE_P384,
+    /**< NIST P-384 */
+    ICP_SAL_EC_CURVE_P521
+    /**< NIST P-521 */
+} icp_sal_ec_curve_t;
+
+/*
+ * Number of named curves
+ */
+#define ICP_SAL_EC_CURVE_NUM (ICP_SAL_EC_CURVE_P521 + 1)
+
+/*
+ * Handle of a named curve
+ */
+typedef void *icp_sal_ec_curve_handle_t;
+
+/*
+ * icp_sal_ec_point_multiply_curve_op_data_t
+ *
+ * @description:
+ *  Operation data of a point multiplication on a named curve, computing
+ *  k.(x,y). When x.pData and y.pData are both NULL the base point of the
+ *  curve is multiplied. All numbers are big endian.
+ */
+typedef struct icp_sal_ec_point_multiply_curve_op_data_s
+{
+    icp_sal_ec_curve_handle_t hCurve;
+    /**< Curve the point is on */
+    CpaFlatBuffer k;
+    /**< Scalar multiplier */
+    CpaFlatBuffer x;
+    /**< x coordinate of the point, or NULL pData for the base point */
+    CpaFlatBuffer y;
+    /**< y coordinate of the point, or NULL pData for the base point */
+} icp_sal_ec_point_multiply_curve_op_data_t;
+
+/*
+ * icp_sal_ecdsa_sign_rs_curve_op_data_t
+ *
+ * @description:
+ *  Operation data of an ECDSA signature on a named curve. All numbers are
+ *  big endian.
+ */
+typedef struct icp_sal_ecdsa_sign_rs_curve_op_data_s
+{
+    icp_sal_ec_curve_handle_t hCurve;
+    /**< Curve of the key */
+    CpaFlatBuffer m;
+    /**< Digest of the message to be signed */
+    CpaFlatBuffer d;
+    /**< Private key */
+    CpaFlatBuffer k;
+    /**< Random value, 0 < k < n */
+} icp_sal_ecdsa_sign_rs_curve_op_data_t;
+
+/*
+ * icp_sal_ecdsa_verify_curve_op_data_t
+ *
+ * @description:
+ *  Operation data of an ECDSA signature verification on a named curve. All
+ *  numbers are big endian.
+ */
+typedef struct icp_sal_ecdsa_verify_curve_op_data_s
+{
+    icp_sal_ec_curve_handle_t hCurve;
+    /**< Curve of the key */
+    CpaFlatBuffer m;
+    /**< Digest of the message */
+    CpaFlatBuffer r;
+    /**< r component of the signature */
+    CpaFlatBuffer s;
+    /**< s component of the signature */
+    CpaFlatBuffer xp;
+    /**< x coordinate of the public key */
+    CpaFlatBuffer yp;
+    /**< y coordinate of the public key */
+} icp_sal_ecdsa_verify_curve_op_data_t;
+
+/*
+ * icp_sal_CyEcCurveHandleGet
+ *
+ * @description:
+ *  This function returns the handle of a named curve on an instance. The
+ *  parameters of the curve are set up when the instance starts: they are
+ *  held padded to the operand size of the PKE service in DMA-able memory,
+ *  together with the service to use, so requests on the handle only carry
+ *  the per operation numbers and the curve parameters are neither checked
+ *  nor copied. The handle stays valid until the instance shuts down and can
+ *  only be used on the instance it was returned for.
+ *
+ * @context
+ *      This function may be called from any context
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      Yes
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[in] curve                  Named curve
+ * @param[out] phCurve               Handle of the curve
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_CyEcCurveHandleGet(const CpaInstanceHandle instanceHandle,
+                                     icp_sal_ec_curve_t curve,
+                                     icp_sal_ec_curve_handle_t *phCurve);
+
+/*
+ * icp_sal_CyEcPointMultiplyCurve
+ *
+ * @description:
+ *  This function performs an EC point multiplication on a named curve, as
+ *  cpaCyEcPointMultiply does for the curve parameters of the handle. The
+ *  callback is given pOpData. The outputs must be at least as long as the
+ *  modulus of the curve. If pCb is NULL the function is synchronous.
+ *
+ * @context
+ *      When called as an asynchronous function it cannot sleep. It can be
+ *      executed in a context that does not permit sleeping.
+ *      When called as a synchronous function it may sleep. It MUST NOT be
+ *      executed in a context that DOES NOT permit sleeping.
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[in] pCb                    Callback function, NULL for synchronous
+ *                                   operation
+ * @param[in] pCallbackTag           Opaque user data for the callback
+ * @param[in] pOpData                Operation data
+ * @param[out] pMultiplyStatus       CPA_FALSE if the result is the point at
+ *                                   infinity
+ * @param[out] pXk                   x coordinate of the result
+ * @param[out] pYk                   y coordinate of the result
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          Resubmit the request
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_CyEcPointMultiplyCurve(
+    const CpaInstanceHandle instanceHandle,
+    const CpaCyEcPointMultiplyCbFunc pCb,
+    void *pCallbackTag,
+    const icp_sal_ec_point_multiply_curve_op_data_t *pOpData,
+    CpaBoolean *pMultiplyStatus,
+    CpaFlatBuffer *pXk,
+    CpaFlatBuffer *pYk);
+
+/*
+ * icp_sal_CyEcdsaSignRSCurve
+ *
+ * @description:
+ *  This function generates an ECDSA signature on a named curve, as
+ *  cpaCyEcdsaSignRS does for the curve parameters of the handle. The
+ *  callback is given pOpData. The outputs must be at least as long as the
+ *  order of the curve. If pCb is NULL the function is synchronous.
+ *
+ * @context
+ *      When called as an asynchronous function it cannot sleep. It can be
+ *      executed in a context that does not permit sleeping.
+ *      When called as a synchronous function it may sleep. It MUST NOT be
+ *      executed in a context that DOES NOT permit sleeping.
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[in] pCb                    Callback function, NULL for synchronous
+ *                                   operation
+ * @param[in] pCallbackTag           Opaque user data for the callback
+ * @param[in] pOpData                Operation data
+ * @param[out] pSignStatus           CPA_FALSE if r or s is zero and the
+ *                                   signature must be generated again with
+ *                                   another k
+ * @param[out] pR                    r component of the signature
+ * @param[out] pS                    s component of the signature
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          Resubmit the request
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_CyEcdsaSignRSCurve(
+    const CpaInstanceHandle instanceHandle,
+    const CpaCyEcdsaSignRSCbFunc pCb,
+    void *pCallbackTag,
+    const icp_sal_ecdsa_sign_rs_curve_op_data_t *pOpData,
+    CpaBoolean *pSignStatus,
+    CpaFlatBuffer *pR,
+    CpaFlatBuffer *pS);
+
+/*
+ * icp_sal_CyEcdsaVerifyCurve
+ *
+ * @description:
+ *  This function verifies an ECDSA signature on a named curve, as
+ *  cpaCyEcdsaVerify does for the curve parameters of the handle. The
+ *  callback is given pOpData. If pCb is NULL the function is synchronous.
+ *
+ * @context
+ *      When called as an asynchronous function it cannot sleep. It can be
+ *      executed in a context that does not permit sleeping.
+ *      When called as a synchronous function it may sleep. It MUST NOT be
+ *      executed in a context that DOES NOT permit sleeping.
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[in] pCb                    Callback function, NULL for synchronous
+ *                                   operation
+ * @param[in] pCallbackTag           Opaque user data for the callback
+ * @param[in] pOpData                Operation data
+ * @param[out] pVerifyStatus         CPA_TRUE if the signature is valid
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          Resubmit the request
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_CyEcdsaVerifyCurve(
+    const CpaInstanceHandle instanceHandle,
+    const CpaCyEcdsaVerifyCbFunc pCb,
+    void *pCallbackTag,
+    const icp_sal_ecdsa_verify_curve_op_data_t *pOpData,
+    CpaBoolean *pVerifyStatus);
+
+#endif
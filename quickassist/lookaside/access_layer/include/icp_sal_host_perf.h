@@ -0,0 +1,300 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file icp_sal_host_perf.h
+ *
+ * @ingroup SalUser
+ *
+ * Test only entry points used by the host benchmarks of the performance
+ * sample code. They run the pool, statistics, session and buffer list
+ * code of the access layer without a device, and keep the internal
+ * structure layouts out of the sample code. They are not part of the API
+ * and may change with any release.
+ *
+ ***************************************************************************/
+
+#ifndef ICP_SAL_HOST_PERF_H
+#define ICP_SAL_HOST_PERF_H
+
+#include "cpa.h"
+
+/*
+ * icp_sal_host_perf_pool_t
+ *
+ * @description:
+ *  Memory pools of an instance the pool benchmark can create
+ */
+typedef enum icp_sal_host_perf_pool_e
+{
+    ICP_SAL_HOST_PERF_POOL_SYM_COOKIE = 0,
+    /**< Sym cookie pool of a crypto instance */
+    ICP_SAL_HOST_PERF_POOL_ASYM_REQUEST,
+    /**< PKE request pool of a crypto instance */
+    ICP_SAL_HOST_PERF_POOL_DC_COOKIE
+    /**< Cookie pool of a compression instance */
+} icp_sal_host_perf_pool_t;
+
+/*
+ * icp_sal_host_perf_session_lines_t
+ *
+ * @description:
+ *  Cache lines of a session descriptor touched by the submit and the
+ *  completion of a full packet request
+ */
+typedef struct icp_sal_host_perf_session_lines_s
+{
+    Cpa32U numSubmit;
+    /**< Lines touched on submit */
+    Cpa32U numSubmitWritten;
+    /**< Lines written on submit */
+    Cpa32U numComplete;
+    /**< Lines touched on completion */
+    Cpa32U numCompleteWritten;
+    /**< Lines written on completion */
+    Cpa32U numShared;
+    /**< Lines written by one side and touched by the other */
+} icp_sal_host_perf_session_lines_t;
+
+/*
+ * icp_sal_HostPerfPoolCreate
+ *
+ * @description:
+ *  Creates a pool with the entry size, alignment and number of entries
+ *  the service gives the pool of the given type for numConcurrentReq
+ *  requests.
+ *
+ * @param[in]  type              type of the pool
+ * @param[in]  numConcurrentReq  concurrent requests of the instance, as in
+ *                               the config file
+ * @param[out] ppPool            the pool
+ * @param[out] pNumEntries       number of entries of the pool
+ *
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       The pool could not be allocated
+ */
+CpaStatus icp_sal_HostPerfPoolCreate(icp_sal_host_perf_pool_t type,
+                                     Cpa32U numConcurrentReq,
+                                     void **ppPool,
+                                     Cpa32U *pNumEntries);
+
+/*
+ * icp_sal_HostPerfPoolAlloc
+ *
+ * @description:
+ *  Takes an entry from a pool created by icp_sal_HostPerfPoolCreate.
+ *  Returns NULL when every entry is in use.
+ */
+void *icp_sal_HostPerfPoolAlloc(void *pPool);
+
+/*
+ * icp_sal_HostPerfPoolFree
+ *
+ * @description:
+ *  Returns an entry to its pool.
+ */
+void icp_sal_HostPerfPoolFree(void *pEntry);
+
+/*
+ * icp_sal_HostPerfPoolAvailable
+ *
+ * @description:
+ *  Returns the number of free entries of a pool, including the entries
+ *  cached by threads.
+ */
+Cpa32U icp_sal_HostPerfPoolAvailable(void *pPool);
+
+/*
+ * icp_sal_HostPerfPoolDestroy
+ *
+ * @description:
+ *  Frees a pool created by icp_sal_HostPerfPoolCreate.
+ */
+void icp_sal_HostPerfPoolDestroy(void *pPool);
+
+/*
+ * icp_sal_HostPerfStatsCreate
+ *
+ * @description:
+ *  Creates a set of numStats sharded counters, as used for the statistics
+ *  of the services.
+ *
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       The counters could not be allocated
+ */
+CpaStatus icp_sal_HostPerfStatsCreate(Cpa32U numStats, void **ppStats);
+
+/*
+ * icp_sal_HostPerfStatsInc
+ *
+ * @description:
+ *  Increments a counter in the shard of the calling thread.
+ */
+void icp_sal_HostPerfStatsInc(void *pStats, Cpa32U index);
+
+/*
+ * icp_sal_HostPerfStatsGet
+ *
+ * @description:
+ *  Returns the sum of a counter over all shards.
+ */
+Cpa64U icp_sal_HostPerfStatsGet(void *pStats, Cpa32U index);
+
+/*
+ * icp_sal_HostPerfStatsReset
+ *
+ * @description:
+ *  Sets every counter to 0.
+ */
+void icp_sal_HostPerfStatsReset(void *pStats);
+
+/*
+ * icp_sal_HostPerfStatsDestroy
+ *
+ * @description:
+ *  Frees counters created by icp_sal_HostPerfStatsCreate.
+ */
+void icp_sal_HostPerfStatsDestroy(void *pStats);
+
+/*
+ * icp_sal_HostPerfSessionCreate
+ *
+ * @description:
+ *  Creates a sym session descriptor of an algorithm chaining session for
+ *  icp_sal_HostPerfSessionSubmit and icp_sal_HostPerfSessionComplete.
+ *
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       The descriptor could not be allocated
+ */
+CpaStatus icp_sal_HostPerfSessionCreate(void **ppSession);
+
+/*
+ * icp_sal_HostPerfSessionSubmit
+ *
+ * @description:
+ *  Makes the accesses to the session descriptor of the submit of a full
+ *  packet request: takes the session as a reader, builds a message from
+ *  the cached templates and counts the request as pending.
+ */
+void icp_sal_HostPerfSessionSubmit(void *pSession);
+
+/*
+ * icp_sal_HostPerfSessionComplete
+ *
+ * @description:
+ *  Makes the accesses to the session descriptor of the completion of a
+ *  full packet request and counts the request as done.
+ */
+void icp_sal_HostPerfSessionComplete(void *pSession);
+
+/*
+ * icp_sal_HostPerfSessionLinesGet
+ *
+ * @description:
+ *  Returns the cache lines of the session descriptor touched by
+ *  icp_sal_HostPerfSessionSubmit and icp_sal_HostPerfSessionComplete.
+ */
+void icp_sal_HostPerfSessionLinesGet(
+    icp_sal_host_perf_session_lines_t *pLines);
+
+/*
+ * icp_sal_HostPerfSessionDestroy
+ *
+ * @description:
+ *  Frees a descriptor created by icp_sal_HostPerfSessionCreate.
+ */
+void icp_sal_HostPerfSessionDestroy(void *pSession);
+
+/*
+ * icp_sal_HostPerfInstanceGet
+ *
+ * @description:
+ *  Returns a sym instance handle that is never started and translates
+ *  addresses with USDM, for icp_sal_BufferListRegister and
+ *  icp_sal_HostPerfBufferListDescWrite.
+ */
+CpaInstanceHandle icp_sal_HostPerfInstanceGet(void);
+
+/*
+ * icp_sal_HostPerfBufferListDescWrite
+ *
+ * @description:
+ *  Writes the firmware descriptor of a buffer list as a request of the
+ *  instance does, from the cached one if the list is registered.
+ *
+ * @param[in]  instanceHandle  handle from icp_sal_HostPerfInstanceGet
+ * @param[in]  pBufferList     buffer list with its private metadata
+ * @param[out] pPhysAddr       physical address of the descriptor
+ *
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Address translation failed
+ */
+CpaStatus icp_sal_HostPerfBufferListDescWrite(
+    const CpaInstanceHandle instanceHandle,
+    CpaBufferList *pBufferList,
+    Cpa64U *pPhysAddr);
+#endif
@@ -81,6 +81,26 @@
 #ifndef ICP_SAL_POLL_H
 #define ICP_SAL_POLL_H
 
+/*************************************************************************
+ * @ingroup SalPoll
+ * @description
+ *    Counters of the adaptive wait of a hybrid instance, see
+ *    icp_sal_CyWaitInstance.
+ *************************************************************************/
+typedef struct icp_sal_wait_stats_s
+{
+    Cpa64U numPolls;
+    /**< Number of times the response rings were polled */
+    Cpa64U numSpins;
+    /**< Empty polls followed by a busy wait */
+    Cpa64U numYields;
+    /**< Empty polls followed by a yield of the CPU */
+    Cpa64U numSleeps;
+    /**< Number of times the poller armed the interrupt and blocked */
+    Cpa64U numWakeups;
+    /**< Sleeps ended by an interrupt rather than by the timeout */
+} icp_sal_wait_stats_t;
+
 /*************************************************************************
  * @ingroup SalPoll
  * @description
@@ -114,6 +134,39 @@
 CpaStatus icp_sal_CyPollInstance(CpaInstanceHandle instanceHandle,
                                  Cpa32U response_quota);
 
+/*************************************************************************
+ * @ingroup SalPoll
+ * @description
+ *    Declare that a Cy logical instance is only ever used from a single
+ *    thread, for both submitting requests and polling responses. The
+ *    rings of the instance then skip their locks and atomic updates.
+ *    The same setting can be made with the Cy<n>ExclusiveOwner key
+ *    in the configuration file.
+ *
+ * @context
+ *      This function is called from the user context only
+ *
+ * @assumptions
+ *      No requests are in flight on the instance
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] instanceHandle     Instance handle.
+ * @param[in] exclusive          CPA_TRUE to enable exclusive owner mode,
+ *                               CPA_FALSE to go back to locked rings.
+ *
+ * @retval CPA_STATUS_SUCCESS     Mode successfully changed
+ * @retval CPA_STATUS_RETRY       Requests are in flight on the instance
+ * @retval CPA_STATUS_UNSUPPORTED Not supported in kernel space
+ * @retval CPA_STATUS_FAIL        Indicates a failure
+ *************************************************************************/
+CpaStatus icp_sal_CySetExclusiveOwner(CpaInstanceHandle instanceHandle,
+                                      CpaBoolean exclusive);
+
 /*************************************************************************
  * @ingroup SalPoll
  * @description
@@ -197,6 +250,39 @@ CpaStatus icp_sal_CyPollDpInstance(CpaInstanceHandle instanceHandle,
 CpaStatus icp_sal_DcPollInstance(CpaInstanceHandle instanceHandle,
                                  Cpa32U response_quota);
 
+/*************************************************************************
+ * @ingroup SalPoll
+ * @description
+ *    Declare that a Dc logical instance is only ever used from a single
+ *    thread, for both submitting requests and polling responses. The
+ *    rings of the instance then skip their locks and atomic updates.
+ *    The same setting can be made with the Dc<n>ExclusiveOwner key
+ *    in the configuration file.
+ *
+ * @context
+ *      This function is called from the user context only
+ *
+ * @assumptions
+ *      No requests are in flight on the instance
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] instanceHandle     Instance handle.
+ * @param[in] exclusive          CPA_TRUE to enable exclusive owner mode,
+ *                               CPA_FALSE to go back to locked rings.
+ *
+ * @retval CPA_STATUS_SUCCESS     Mode successfully changed
+ * @retval CPA_STATUS_RETRY       Requests are in flight on the instance
+ * @retval CPA_STATUS_UNSUPPORTED Not supported in kernel space
+ * @retval CPA_STATUS_FAIL        Indicates a failure
+ *************************************************************************/
+CpaStatus icp_sal_DcSetExclusiveOwner(CpaInstanceHandle instanceHandle,
+                                      CpaBoolean exclusive);
+
 /*************************************************************************
   * @ingroup SalPoll
   * @description
@@ -469,4 +555,144 @@ CpaStatus icp_sal_DcPutFileDescriptor(CpaInstanceHandle instanceHandle, int fd);
  *****************************************************************************/
 CpaStatus icp_sal_CyPutFileDescriptor(CpaInstanceHandle instanceHandle, int fd);
 
+/*************************************************************************
+ * @ingroup SalPoll
+ * @description
+ *    Adaptively wait for and process the responses of a Cy instance
+ *    configured with Cy<n>IsPolled = 3 (hybrid mode).
+ *
+ *    The response rings are polled for as long as responses keep
+ *    arriving. After an empty poll the caller busy waits for an
+ *    exponentially growing number of iterations and then yields the CPU.
+ *    Once the number of consecutive empty polls reaches the idle
+ *    threshold (the Cy<n>HybridIdleThreshold configuration key), the ring interrupt
+ *    is armed and the caller blocks until it fires or the timeout
+ *    expires. Interrupts stay disarmed while the instance is being
+ *    polled, so a busy instance costs no more than a polled one.
+ *
+ * @context
+ *      This function is called from the user context only
+ *
+ * @assumptions
+ *      A single thread waits on a given instance
+ * @sideEffects
+ *      Updates the wait counters of the instance
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] instanceHandle     Instance handle.
+ * @param[in] response_quota     The maximum number of messages that
+ *                               will be read in one polling. Setting
+ *                               the response quota to zero means that
+ *                               all messages on the ring will be read.
+ * @param[in] timeout_ms         Longest time to block on the interrupt.
+ *
+ * @retval CPA_STATUS_SUCCESS     Responses were processed
+ * @retval CPA_STATUS_RETRY       The timeout expired without responses
+ * @retval CPA_STATUS_UNSUPPORTED Instance not in hybrid mode
+ * @retval CPA_STATUS_FAIL        Indicates a failure
+ *************************************************************************/
+CpaStatus icp_sal_CyWaitInstance(CpaInstanceHandle instanceHandle,
+                                 Cpa32U response_quota,
+                                 Cpa32U timeout_ms);
+
+/*************************************************************************
+ * @ingroup SalPoll
+ * @description
+ *    Read the adaptive wait counters of a hybrid Cy instance.
+ *
+ * @context
+ *      This function is called from the user context only
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      Yes
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle     Instance handle.
+ * @param[out] pWaitStats        Counters of the instance.
+ *
+ * @retval CPA_STATUS_SUCCESS     Counters returned
+ * @retval CPA_STATUS_UNSUPPORTED Instance not in hybrid mode
+ * @retval CPA_STATUS_FAIL        Indicates a failure
+ *************************************************************************/
+CpaStatus icp_sal_CyGetWaitStats(CpaInstanceHandle instanceHandle,
+                                 icp_sal_wait_stats_t *pWaitStats);
+
+/*************************************************************************
+ * @ingroup SalPoll
+ * @description
+ *    Adaptively wait for and process the responses of a Dc instance
+ *    configured with Dc<n>IsPolled = 3 (hybrid mode).
+ *
+ *    The response rings are polled for as long as responses keep
+ *    arriving. After an empty poll the caller busy waits for an
+ *    exponentially growing number of iterations and then yields the CPU.
+ *    Once the number of consecutive empty polls reaches the idle
+ *    threshold (the Dc<n>HybridIdleThreshold configuration key), the ring interrupt
+ *    is armed and the caller blocks until it fires or the timeout
+ *    expires. Interrupts stay disarmed while the instance is being
+ *    polled, so a busy instance costs no more than a polled one.
+ *
+ * @context
+ *      This function is called from the user context only
+ *
+ * @assumptions
+ *      A single thread waits on a given instance
+ * @sideEffects
+ *      Updates the wait counters of the instance
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      No
+ *
+ * @param[in] instanceHandle     Instance handle.
+ * @param[in] response_quota     The maximum number of messages that
+ *                               will be read in one polling. Setting
+ *                               the response quota to zero means that
+ *                               all messages on the ring will be read.
+ * @param[in] timeout_ms         Longest time to block on the interrupt.
+ *
+ * @retval CPA_STATUS_SUCCESS     Responses were processed
+ * @retval CPA_STATUS_RETRY       The timeout expired without responses
+ * @retval CPA_STATUS_UNSUPPORTED Instance not in hybrid mode
+ * @retval CPA_STATUS_FAIL        Indicates a failure
+ *************************************************************************/
+CpaStatus icp_sal_DcWaitInstance(CpaInstanceHandle instanceHandle,
+                                 Cpa32U response_quota,
+                                 Cpa32U timeout_ms);
+
+/*************************************************************************
+ * @ingroup SalPoll
+ * @description
+ *    Read the adaptive wait counters of a hybrid Dc instance.
+ *
+ * @context
+ *      This function is called from the user context only
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      Yes
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle     Instance handle.
+ * @param[out] pWaitStats        Counters of the instance.
+ *
+ * @retval CPA_STATUS_SUCCESS     Counters returned
+ * @retval CPA_STATUS_UNSUPPORTED Instance not in hybrid mode
+ * @retval CPA_STATUS_FAIL        Indicates a failure
+ *************************************************************************/
+CpaStatus icp_sal_DcGetWaitStats(CpaInstanceHandle instanceHandle,
+                                 icp_sal_wait_stats_t *pWaitStats);
+
 #endif
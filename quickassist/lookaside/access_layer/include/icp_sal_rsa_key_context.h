@@ -0,0 +1,216 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file icp_sal_rsa_key_context.h
+ *
+ * @ingroup SalCommon
+ *
+ * RSA decryption with private keys set up once for many operations.
+ *
+ ***************************************************************************/
+
+#ifndef ICP_SAL_RSA_KEY_CONTEXT_H
+#define ICP_SAL_RSA_KEY_CONTEXT_H
+
+#include "cpa_cy_rsa.h"
+
+/*
+ * Handle of an RSA private key context
+ */
+typedef void *icp_sal_rsa_key_context_handle_t;
+
+/*
+ * icp_sal_rsa_decrypt_key_context_op_data_t
+ *
+ * @description:
+ *  Operation data of an RSA decryption with a private key context. The
+ *  input is big endian.
+ */
+typedef struct icp_sal_rsa_decrypt_key_context_op_data_s
+{
+    icp_sal_rsa_key_context_handle_t hKeyContext;
+    /**< Private key of the recipient */
+    CpaFlatBuffer inputData;
+    /**< Ciphertext, no longer than the modulus */
+} icp_sal_rsa_decrypt_key_context_op_data_t;
+
+/*
+ * icp_sal_CyRsaPrivateKeyContextCreate
+ *
+ * @description:
+ *  This function sets up a private key for repeated decryptions on an
+ *  instance. The key is checked as cpaCyRsaDecrypt checks it and its CRT
+ *  components are copied, padded to the operand size of the PKE service,
+ *  into DMA-able memory on the node of the instance. Decryptions with the
+ *  context then only check and copy the ciphertext. Only private keys of
+ *  type CPA_CY_RSA_PRIVATE_KEY_REP_TYPE_2 are supported. The key passed in
+ *  is not referenced once the function returns.
+ *
+ * @context
+ *      This function may sleep. It MUST NOT be executed in a context that
+ *      DOES NOT permit sleeping.
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      Yes
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle
+ * @param[in] pPrivateKey            Private key
+ * @param[out] phKeyContext          Handle of the key context
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_CyRsaPrivateKeyContextCreate(
+    const CpaInstanceHandle instanceHandle,
+    const CpaCyRsaPrivateKey *pPrivateKey,
+    icp_sal_rsa_key_context_handle_t *phKeyContext);
+
+/*
+ * icp_sal_CyRsaPrivateKeyContextDestroy
+ *
+ * @description:
+ *  This function clears the key material of a key context and frees it.
+ *  While decryptions with the context are in flight it returns
+ *  CPA_STATUS_RETRY and the context is kept; it may be called again once
+ *  their callbacks have been invoked, including from one of them. No
+ *  decryption with the context may be submitted concurrently with this
+ *  call. The handle must not be used once it has been destroyed.
+ *
+ * @context
+ *      This function may sleep. It MUST NOT be executed in a context that
+ *      DOES NOT permit sleeping.
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      Yes
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle the context was
+ *                                   created on
+ * @param[in] hKeyContext            Handle of the key context
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_RETRY          Decryptions with the context are in
+ *                                   flight, call again later
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ */
+CpaStatus icp_sal_CyRsaPrivateKeyContextDestroy(
+    const CpaInstanceHandle instanceHandle,
+    icp_sal_rsa_key_context_handle_t hKeyContext);
+
+/*
+ * icp_sal_CyRsaDecryptKeyContext
+ *
+ * @description:
+ *  This function performs an RSA decryption with a private key context, as
+ *  cpaCyRsaDecrypt does for the key of the context. The callback is given
+ *  pDecryptData. The output must be at least as long as the modulus. If
+ *  pRsaDecryptCb is NULL the function is synchronous.
+ *
+ * @context
+ *      When called as an asynchronous function it cannot sleep. It can be
+ *      executed in a context that does not permit sleeping.
+ *      When called as a synchronous function it may sleep. It MUST NOT be
+ *      executed in a context that DOES NOT permit sleeping.
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @param[in] instanceHandle         Crypto instance handle the context was
+ *                                   created on
+ * @param[in] pRsaDecryptCb          Callback function, NULL for synchronous
+ *                                   operation
+ * @param[in] pCallbackTag           Opaque user data for the callback
+ * @param[in] pDecryptData           Operation data
+ * @param[out] pOutputData           Plaintext
+ * @retval CPA_STATUS_SUCCESS        No error
+ * @retval CPA_STATUS_FAIL           Function failed
+ * @retval CPA_STATUS_RETRY          Resubmit the request
+ * @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in
+ * @retval CPA_STATUS_RESOURCE       Error related to system resources
+ * @retval CPA_STATUS_RESTARTING     API implementation is restarting
+ */
+CpaStatus icp_sal_CyRsaDecryptKeyContext(
+    const CpaInstanceHandle instanceHandle,
+    const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
+    void *pCallbackTag,
+    const icp_sal_rsa_decrypt_key_context_op_data_t *pDecryptData,
+    CpaFlatBuffer *pOutputData);
+
+#endif
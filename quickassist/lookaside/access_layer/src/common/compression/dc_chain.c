@@ -107,6 +107,7 @@
 #include "lac_sym_hash.h"
 #include "lac_sym_alg_chain.h"
 #include "lac_sym_auth_enc.h"
+#include "lac_sym_queue.h"
 
 static const dc_chain_cmd_tbl_t dc_chain_cmd_table[] = {
     /* link0: additional=1(cipher)|dir=2(decrypt)|type=1(crypto)
@@ -440,8 +441,8 @@ CpaStatus dcChainSession_PopulateSymSetupData(
 
     /* Populate session data */
     pSessionDesc->pRequestQueueHead = NULL;
-    pSessionDesc->pRequestQueueTail = NULL;
-    pSessionDesc->nonBlockingOpsInProgress = CPA_TRUE;
+    pSessionDesc->pRequestQueueNew = NULL;
+    osalAtomicSet(0, &pSessionDesc->requestQueueCount);
     pSessionDesc->pInstance = instanceHandle;
     pSessionDesc->digestIsAppended = pSessionSetupData->digestIsAppended;
     pSessionDesc->digestVerify = pSessionSetupData->verifyDigest;
@@ -662,7 +663,8 @@ CpaStatus dcChainSession_BuildSymTemplate(
                 &(pSessionDesc->hashStatePrefixBuffer[0]));
 
             /* Block messages until precompute is completed */
-            pSessionDesc->nonBlockingOpsInProgress = CPA_FALSE;
+            osalAtomicAdd(LAC_SYM_QUEUE_HOLD,
+                          &pSessionDesc->requestQueueCount);
             status = LacHash_PrecomputeDataCreate(
                 instanceHandle,
                 (CpaCySymSessionSetupData *)pSessionSetupData,
@@ -109,6 +109,7 @@
 #include "dc_err_sim.h"
 #endif
 #include "dc_error_counter.h"
+#include "icp_sal.h"
 #ifndef KERNEL_SPACE
 #include <stdlib.h>
 #endif
@@ -1060,6 +1061,77 @@ STATIC CpaStatus dcSendRequest(dc_compression_cookie_t *pCookie,
     return status;
 }
 
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Send a burst of stateless compression requests to QAT
+ *
+ * @description
+ *      Send already built stateless requests for compression or
+ *      decompression to QAT with a single ring tail update. The requests
+ *      are sent in order and the number accepted by the ring is returned.
+ *
+ * @param[in]   pCookies              Array of compression cookies
+ * @param[in]   numRequests           Number of cookies in the array
+ * @param[in]   dcInstance            Compression instance handle
+ * @param[out]  pNumSent              Number of requests put on the ring
+ *
+ * @retval CPA_STATUS_SUCCESS         Function executed successfully
+ * @retval CPA_STATUS_RETRY           Ring full, no request was sent
+ * @retval CPA_STATUS_FAIL            Function failed
+ *
+ *****************************************************************************/
+CpaStatus dcSendRequests(dc_compression_cookie_t **pCookies,
+                         Cpa32U numRequests,
+                         CpaInstanceHandle dcInstance,
+                         Cpa32U *pNumSent)
+{
+    sal_compression_service_t *pService =
+        (sal_compression_service_t *)dcInstance;
+    void *pMsgs[DC_SEND_BURST_SIZE];
+    Cpa32U numSent = 0;
+    Cpa32U numPut = 0;
+    Cpa32U numMsgs = 0;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    *pNumSent = 0;
+    while ((numSent < numRequests) && (CPA_STATUS_SUCCESS == status))
+    {
+        numMsgs = numRequests - numSent;
+        if (numMsgs > DC_SEND_BURST_SIZE)
+        {
+            numMsgs = DC_SEND_BURST_SIZE;
+        }
+        for (i = 0; i < numMsgs; i++)
+        {
+            pMsgs[i] = (void *)&(pCookies[numSent + i]->request);
+        }
+
+        /* Send to QAT */
+        numPut = 0;
+        status = SalQatMsg_transPutMsgs(pService->trans_handle_compression_tx,
+                                        pMsgs,
+                                        LAC_QAT_DC_REQ_SZ_LW,
+                                        numMsgs,
+                                        &numPut,
+                                        LAC_LOG_MSG_DC);
+        numSent += numPut;
+        if (numPut < numMsgs)
+        {
+            /* The ring is full, leave the rest to the caller */
+            break;
+        }
+    }
+
+    *pNumSent = numSent;
+    if ((CPA_STATUS_RETRY == status) && (numSent > 0))
+    {
+        status = CPA_STATUS_SUCCESS;
+    }
+    return status;
+}
+
 /**
  *****************************************************************************
  * @ingroup Dc_DataCompression
@@ -1889,6 +1961,455 @@ CpaStatus cpaDcDecompressData2(CpaInstanceHandle dcInstance,
                                callbackTag);
 }
 
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Get the compress and verify mode of a batch entry
+ *
+ * @description
+ *      Derive the compress and verify mode from the operation data the same
+ *      way cpaDcCompressData2 does. Decompression requests never use it.
+ *
+ * @param[in]   pOpData             Operation data of the entry
+ * @param[in]   compDecomp          Direction of the operation
+ *
+ *****************************************************************************/
+STATIC dc_cnv_mode_t dcBatchCnvModeGet(const CpaDcOpData *pOpData,
+                                       dc_request_dir_t compDecomp)
+{
+    if ((DC_DECOMPRESSION_REQUEST == compDecomp) ||
+        (CPA_TRUE != pOpData->compressAndVerify))
+    {
+        return DC_NO_CNV;
+    }
+    if (CPA_TRUE == pOpData->compressAndVerifyAndRecover)
+    {
+        return DC_CNVNR;
+    }
+    return DC_CNV;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Check one entry of a traditional API batch
+ *
+ * @description
+ *      Apply to a batch entry the checks cpaDcCompressData2 or
+ *      cpaDcDecompressData2 apply to a single request, and reject the
+ *      sessions the batch path does not handle.
+ *
+ * @param[in]   pService            Pointer to the compression service
+ * @param[in]   pEntry              Batch entry to check
+ * @param[in]   compDecomp          Direction of the operation
+ *
+ * @retval CPA_STATUS_SUCCESS       The entry can be submitted
+ * @retval CPA_STATUS_INVALID_PARAM Invalid parameter passed in
+ * @retval CPA_STATUS_UNSUPPORTED   Unsupported session or feature
+ *
+ *****************************************************************************/
+STATIC CpaStatus dcBatchCheckEntry(sal_compression_service_t *pService,
+                                   const icp_sal_dc_batch_op_data_t *pEntry,
+                                   dc_request_dir_t compDecomp)
+{
+    dc_session_desc_t *pSessionDesc = NULL;
+    const CpaDcOpData *pOpData = pEntry->pOpData;
+    Cpa64U srcBuffSize = 0;
+    dc_cnv_mode_t cnvMode = DC_NO_CNV;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_NULL_PARAM(pEntry->pSessionHandle);
+    LAC_CHECK_NULL_PARAM(pOpData);
+
+    if ((DC_COMPRESSION_REQUEST == compDecomp) &&
+        ((((CPA_TRUE != pOpData->compressAndVerify) &&
+           (CPA_FALSE != pOpData->compressAndVerify)) ||
+          ((CPA_FALSE != pOpData->compressAndVerifyAndRecover) &&
+           (CPA_TRUE != pOpData->compressAndVerifyAndRecover))) ||
+         ((CPA_FALSE == pOpData->compressAndVerify) &&
+          (CPA_TRUE == pOpData->compressAndVerifyAndRecover))))
+    {
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    if (LacBuffDesc_BufferListVerifyNull(
+            pEntry->pSrcBuff, &srcBuffSize, LAC_NO_ALIGNMENT_SHIFT) !=
+        CPA_STATUS_SUCCESS)
+    {
+        LAC_INVALID_PARAM_LOG("Invalid source buffer list parameter");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    pSessionDesc = DC_SESSION_DESC_FROM_CTX_GET(pEntry->pSessionHandle);
+
+    if (CPA_DC_STATEFUL == pSessionDesc->sessState)
+    {
+        LAC_INVALID_PARAM_LOG("Invalid session state, stateful sessions "
+                              "not supported in a batch");
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+    if (LacSync_GenWakeupSyncCaller == pSessionDesc->pCompressionCb)
+    {
+        LAC_INVALID_PARAM_LOG("Synchronous sessions not supported in a batch");
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    if (DC_COMPRESSION_REQUEST == compDecomp)
+    {
+        if (CPA_STATUS_SUCCESS != dcParamCheck(pService,
+                                               pEntry->pSessionHandle,
+                                               pService,
+                                               pEntry->pSrcBuff,
+                                               pEntry->pDestBuff,
+                                               pEntry->pResults,
+                                               pSessionDesc,
+                                               pOpData->flushFlag,
+                                               srcBuffSize))
+        {
+            return CPA_STATUS_INVALID_PARAM;
+        }
+    }
+    else
+    {
+        if (dcCheckSourceData(pEntry->pSessionHandle,
+                              pEntry->pSrcBuff,
+                              pEntry->pDestBuff,
+                              pEntry->pResults,
+                              pOpData->flushFlag,
+                              srcBuffSize,
+                              NULL) != CPA_STATUS_SUCCESS)
+        {
+            return CPA_STATUS_INVALID_PARAM;
+        }
+        if (dcCheckDestinationData(pService,
+                                   pEntry->pSessionHandle,
+                                   pEntry->pDestBuff,
+                                   DC_DECOMPRESSION_REQUEST) !=
+            CPA_STATUS_SUCCESS)
+        {
+            return CPA_STATUS_INVALID_PARAM;
+        }
+        if (CPA_DC_DIR_COMPRESS == pSessionDesc->sessDirection)
+        {
+            LAC_INVALID_PARAM_LOG("Invalid sessDirection value");
+            return CPA_STATUS_INVALID_PARAM;
+        }
+    }
+#endif
+#ifdef ICP_DC_DYN_NOT_SUPPORTED
+    if (CPA_DC_HT_FULL_DYNAMIC == pSessionDesc->huffType)
+    {
+        LAC_INVALID_PARAM_LOG("Invalid huffType value, dynamic sessions "
+                              "not supported");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    cnvMode = dcBatchCnvModeGet(pOpData, compDecomp);
+#ifdef CNV_STRICT_MODE
+    if ((DC_COMPRESSION_REQUEST == compDecomp) && (DC_NO_CNV == cnvMode))
+    {
+        LAC_INVALID_PARAM_LOG(
+            "Data compression without verification not allowed");
+        return CPA_STATUS_UNSUPPORTED;
+    }
+#endif /*CNV_STRICT_MODE*/
+
+    if ((DC_NO_CNV != cnvMode) &&
+        !(pService->generic_service_info.dcExtendedFeatures &
+          DC_CNV_EXTENDED_CAPABILITY))
+    {
+        LAC_INVALID_PARAM_LOG("CompressAndVerify feature not supported");
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+    if ((DC_CNVNR == cnvMode) &&
+        !(pService->generic_service_info.dcExtendedFeatures &
+          DC_CNVNR_EXTENDED_CAPABILITY))
+    {
+        LAC_INVALID_PARAM_LOG(
+            "CompressAndVerifyAndRecovery feature not supported");
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+    return checkLzsSupport(pService,
+                           pSessionDesc->compType,
+                           (DC_NO_CNV != cnvMode) ? CPA_TRUE : CPA_FALSE,
+                           pSessionDesc->sessDirection);
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Count a batch request in the instance statistics
+ *
+ * @param[in]   pService            Pointer to the compression service
+ * @param[in]   compDecomp          Direction of the operation
+ * @param[in]   isSent              Whether the request was put on the ring
+ *
+ *****************************************************************************/
+STATIC void dcBatchRequestStatInc(sal_compression_service_t *pService,
+                                  dc_request_dir_t compDecomp,
+                                  CpaBoolean isSent)
+{
+    if (DC_COMPRESSION_REQUEST == compDecomp)
+    {
+        if (CPA_TRUE == isSent)
+        {
+            COMPRESSION_STAT_INC(numCompRequests, pService);
+        }
+        else
+        {
+            COMPRESSION_STAT_INC(numCompRequestsErrors, pService);
+        }
+    }
+    else
+    {
+        if (CPA_TRUE == isSent)
+        {
+            COMPRESSION_STAT_INC(numDecompRequests, pService);
+        }
+        else
+        {
+            COMPRESSION_STAT_INC(numDecompRequestsErrors, pService);
+        }
+    }
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Submit a batch of traditional API requests
+ *
+ * @description
+ *      Check all the entries, then build the requests DC_SEND_BURST_SIZE at a
+ *      time and put each burst on the ring with dcSendRequests. Requests the
+ *      ring has no room for are released and the caller is told how many
+ *      were submitted.
+ *
+ * @param[in]   dcInstance          Instance handle derived from discovery
+ *                                  functions
+ * @param[in]   numRequests         Number of entries in the batch
+ * @param[in]   pBatchOpData        Batch entries
+ * @param[out]  pNumSubmitted       Number of requests put on the ring
+ * @param[in]   compDecomp          Direction of the operation
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully
+ * @retval CPA_STATUS_RETRY         Ring or request pool full, the rest was
+ *                                  not submitted
+ * @retval CPA_STATUS_FAIL          Function failed
+ * @retval CPA_STATUS_RESOURCE      Resource error
+ * @retval CPA_STATUS_INVALID_PARAM Invalid parameter passed in
+ * @retval CPA_STATUS_UNSUPPORTED   Unsupported session or feature
+ *
+ *****************************************************************************/
+STATIC CpaStatus dcCompDecompDataBatch(CpaInstanceHandle dcInstance,
+                                       Cpa32U numRequests,
+                                       icp_sal_dc_batch_op_data_t *pBatchOpData,
+                                       Cpa32U *pNumSubmitted,
+                                       dc_request_dir_t compDecomp)
+{
+    sal_compression_service_t *pService = NULL;
+    CpaInstanceHandle insHandle = NULL;
+    icp_sal_dc_batch_op_data_t *pEntry = NULL;
+    dc_session_desc_t *pSessionDesc = NULL;
+    dc_compression_cookie_t *pCookie = NULL;
+    dc_compression_cookie_t *pCookies[DC_SEND_BURST_SIZE];
+    Cpa32U numDone = 0;
+    Cpa32U numMsgs = 0;
+    Cpa32U numBuilt = 0;
+    Cpa32U numSent = 0;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaStatus sendStatus = CPA_STATUS_SUCCESS;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == dcInstance)
+    {
+        insHandle = dcGetFirstHandle();
+    }
+    else
+    {
+        insHandle = dcInstance;
+    }
+
+    pService = (sal_compression_service_t *)insHandle;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_NULL_PARAM(insHandle);
+    LAC_CHECK_NULL_PARAM(pBatchOpData);
+    LAC_CHECK_NULL_PARAM(pNumSubmitted);
+    SAL_CHECK_ADDR_TRANS_SETUP(insHandle);
+#endif
+
+    /* Check if SAL is initialised otherwise return an error */
+    SAL_RUNNING_CHECK(insHandle);
+
+#ifdef ICP_PARAM_CHECK
+    /* Ensure this is a compression instance */
+    SAL_CHECK_INSTANCE_TYPE(insHandle, SAL_SERVICE_TYPE_COMPRESSION);
+
+    if (0 == numRequests)
+    {
+        LAC_INVALID_PARAM_LOG("Invalid numRequests value");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    *pNumSubmitted = 0;
+
+    /* Nothing is submitted unless the whole batch is valid */
+    for (i = 0; i < numRequests; i++)
+    {
+        status = dcBatchCheckEntry(pService, &pBatchOpData[i], compDecomp);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            return status;
+        }
+    }
+
+    while ((numDone < numRequests) && (CPA_STATUS_SUCCESS == status))
+    {
+        numMsgs = numRequests - numDone;
+        if (numMsgs > DC_SEND_BURST_SIZE)
+        {
+            numMsgs = DC_SEND_BURST_SIZE;
+        }
+
+        for (numBuilt = 0; numBuilt < numMsgs; numBuilt++)
+        {
+            pEntry = &pBatchOpData[numDone + numBuilt];
+            pSessionDesc =
+                DC_SESSION_DESC_FROM_CTX_GET(pEntry->pSessionHandle);
+
+            /* The memory is freed in the callback, or below if the request
+             * is not sent. The pool only refills when responses are polled,
+             * which the caller may do itself, so an empty pool ends the
+             * batch instead of waiting for an entry */
+            pCookie = (dc_compression_cookie_t *)Lac_MemPoolEntryAlloc(
+                pService->compression_mem_pool);
+            if (NULL == pCookie)
+            {
+                LAC_LOG_ERROR("Cannot get mem pool entry for compression");
+                status = CPA_STATUS_RESOURCE;
+            }
+            else if ((void *)CPA_STATUS_RETRY == pCookie)
+            {
+                status = CPA_STATUS_RETRY;
+            }
+
+            if (CPA_STATUS_SUCCESS == status)
+            {
+                status = dcCreateRequest(
+                    pCookie,
+                    pService,
+                    pSessionDesc,
+                    pEntry->pSessionHandle,
+                    pEntry->pSrcBuff,
+                    pEntry->pDestBuff,
+                    pEntry->pResults,
+                    pEntry->pOpData->flushFlag,
+                    pEntry->callbackTag,
+                    compDecomp,
+                    dcBatchCnvModeGet(pEntry->pOpData, compDecomp));
+                if (CPA_STATUS_SUCCESS != status)
+                {
+                    Lac_MemPoolEntryFree(pCookie);
+                }
+            }
+
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                /* An empty pool is not an error, the single request path
+                 * waits for an entry and counts nothing either */
+                if (CPA_STATUS_RETRY != status)
+                {
+                    dcBatchRequestStatInc(pService, compDecomp, CPA_FALSE);
+                }
+                break;
+            }
+
+            /* Increment number of pending callbacks for session */
+            osalAtomicInc(&(pSessionDesc->pendingStatelessCbCount));
+            pCookies[numBuilt] = pCookie;
+        }
+
+        /* Send what was built, even if building the rest of the burst
+         * failed */
+        numSent = 0;
+        if (numBuilt > 0)
+        {
+            sendStatus = dcSendRequests(pCookies, numBuilt, pService, &numSent);
+        }
+
+        for (i = 0; i < numSent; i++)
+        {
+            dcBatchRequestStatInc(pService, compDecomp, CPA_TRUE);
+        }
+        for (i = numSent; i < numBuilt; i++)
+        {
+            dcBatchRequestStatInc(pService, compDecomp, CPA_FALSE);
+            pSessionDesc = pCookies[i]->pSessionDesc;
+            osalAtomicDec(&(pSessionDesc->pendingStatelessCbCount));
+            Lac_MemPoolEntryFree(pCookies[i]);
+        }
+
+        numDone += numSent;
+        if (((CPA_STATUS_SUCCESS == status) || (CPA_STATUS_RETRY == status)) &&
+            (numSent < numBuilt))
+        {
+            status = (CPA_STATUS_SUCCESS == sendStatus) ? CPA_STATUS_RETRY
+                                                        : sendStatus;
+        }
+    }
+
+    *pNumSubmitted = numDone;
+    return status;
+}
+
+CpaStatus icp_sal_DcCompressDataBatch(CpaInstanceHandle dcInstance,
+                                      Cpa32U numRequests,
+                                      icp_sal_dc_batch_op_data_t *pBatchOpData,
+                                      Cpa32U *pNumSubmitted)
+{
+#ifdef ICP_TRACE
+    LAC_LOG4("Called with params (0x%lx, %u, 0x%lx, 0x%lx)\n",
+             (LAC_ARCH_UINT)dcInstance,
+             numRequests,
+             (LAC_ARCH_UINT)pBatchOpData,
+             (LAC_ARCH_UINT)pNumSubmitted);
+#endif
+
+    return dcCompDecompDataBatch(dcInstance,
+                                 numRequests,
+                                 pBatchOpData,
+                                 pNumSubmitted,
+                                 DC_COMPRESSION_REQUEST);
+}
+
+CpaStatus icp_sal_DcDecompressDataBatch(
+    CpaInstanceHandle dcInstance,
+    Cpa32U numRequests,
+    icp_sal_dc_batch_op_data_t *pBatchOpData,
+    Cpa32U *pNumSubmitted)
+{
+#ifdef ICP_TRACE
+    LAC_LOG4("Called with params (0x%lx, %u, 0x%lx, 0x%lx)\n",
+             (LAC_ARCH_UINT)dcInstance,
+             numRequests,
+             (LAC_ARCH_UINT)pBatchOpData,
+             (LAC_ARCH_UINT)pNumSubmitted);
+#endif
+
+    return dcCompDecompDataBatch(dcInstance,
+                                 numRequests,
+                                 pBatchOpData,
+                                 pNumSubmitted,
+                                 DC_DECOMPRESSION_REQUEST);
+}
+
 CpaStatus cpaDcBufferListGetMetaSize(const CpaInstanceHandle instanceHandle,
                                      Cpa32U numBuffers,
                                      Cpa32U *pSizeInBytes)
@@ -100,23 +100,15 @@ CpaStatus dcStatsInit(sal_compression_service_t *pService)
 {
     CpaStatus status = CPA_STATUS_SUCCESS;
 
-    status = LAC_OS_MALLOC(&(pService->pCompStatsArr),
-                           COMPRESSION_NUM_STATS * sizeof(OsalAtomic));
-
-    if (CPA_STATUS_SUCCESS == status)
-    {
-        COMPRESSION_STATS_RESET(pService);
-    }
+    status =
+        LacStats_Init(&pService->compressionStats, COMPRESSION_NUM_STATS);
 
     return status;
 }
 
 void dcStatsFree(sal_compression_service_t *pService)
 {
-    if (NULL != pService->pCompStatsArr)
-    {
-        LAC_OS_FREE(pService->pCompStatsArr);
-    }
+    LacStats_Free(&pService->compressionStats);
 }
 
 CpaStatus cpaDcGetStats(CpaInstanceHandle dcInstance, CpaDcStats *pStatistics)
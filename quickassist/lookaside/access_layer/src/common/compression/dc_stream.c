@@ -0,0 +1,939 @@
+/****************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file dc_stream.c
+ *
+ * @ingroup Dc_DataCompression
+ *
+ * @description
+ *      Implementation of the compression stream. The input is cut into
+ *      chunks that are compressed by stateless requests with
+ *      CPA_DC_FLUSH_FULL, the last one with CPA_DC_FLUSH_FINAL, so their
+ *      outputs concatenate into one deflate stream. The checksum of each
+ *      chunk is computed from the initial value and the chunk checksums are
+ *      combined in stream order, which lets the requests run in parallel.
+ *
+ *****************************************************************************/
+
+/*
+*******************************************************************************
+* Include public/global header files
+*******************************************************************************
+*/
+#include "cpa.h"
+#include "cpa_dc.h"
+#include "icp_sal_dc_stream.h"
+
+/*
+*******************************************************************************
+* Include private header files
+*******************************************************************************
+*/
+#include "dc_session.h"
+#include "dc_datapath.h"
+#include "dc_stream.h"
+#include "lac_common.h"
+#include "lac_mem.h"
+#include "lac_log.h"
+#include "lac_sal_types.h"
+#include "sal_types_compression.h"
+#include "sal_service_state.h"
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Multiply two polynomials modulo the CRC32 polynomial
+ *
+ * @description
+ *      Both operands and the result are in the bit reversed representation
+ *      used by CRC32. a must not be zero.
+ *
+ *****************************************************************************/
+STATIC Cpa32U dcStreamCrc32MultModP(Cpa32U a, Cpa32U b)
+{
+    Cpa32U m = (Cpa32U)1 << 31;
+    Cpa32U p = 0;
+
+    for (;;)
+    {
+        if (a & m)
+        {
+            p ^= b;
+            if (0 == (a & (m - 1)))
+            {
+                break;
+            }
+        }
+        m >>= 1;
+        b = (b & 1) ? ((b >> 1) ^ DC_STREAM_CRC32_POLY) : (b >> 1);
+    }
+    return p;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Fill the table of x^(2^n) modulo the CRC32 polynomial
+ *
+ *****************************************************************************/
+STATIC void dcStreamCrc32TableInit(Cpa32U *pX2n)
+{
+    /* x^1 */
+    Cpa32U p = (Cpa32U)1 << 30;
+    Cpa32U n = 0;
+
+    pX2n[0] = p;
+    for (n = 1; n < 32; n++)
+    {
+        p = dcStreamCrc32MultModP(p, p);
+        pX2n[n] = p;
+    }
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Combine the CRC32 of two consecutive blocks of data
+ *
+ * @description
+ *      Returns the CRC32 of the first block followed by the second, from the
+ *      CRC32 of each block and the length of the second. Appending len2
+ *      bytes multiplies the CRC of the first block by x^(8 * len2).
+ *
+ *****************************************************************************/
+STATIC Cpa32U dcStreamCrc32Combine(const Cpa32U *pX2n,
+                                   Cpa32U crc1,
+                                   Cpa32U crc2,
+                                   Cpa64U len2)
+{
+    /* x^0 */
+    Cpa32U p = (Cpa32U)1 << 31;
+    /* len2 counts bytes, x^(2^3) is one byte */
+    Cpa32U k = 3;
+
+    while (len2)
+    {
+        if (len2 & 1)
+        {
+            p = dcStreamCrc32MultModP(pX2n[k & 31], p);
+        }
+        len2 >>= 1;
+        k++;
+    }
+    return dcStreamCrc32MultModP(p, crc1) ^ crc2;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Combine the Adler32 of two consecutive blocks of data
+ *
+ *****************************************************************************/
+STATIC Cpa32U dcStreamAdler32Combine(Cpa32U adler1, Cpa32U adler2, Cpa64U len2)
+{
+    Cpa32U rem = (Cpa32U)(len2 % DC_STREAM_ADLER32_BASE);
+    Cpa64U sum1 = adler1 & 0xffff;
+    Cpa64U sum2 = (rem * sum1) % DC_STREAM_ADLER32_BASE;
+
+    sum1 += (adler2 & 0xffff) + DC_STREAM_ADLER32_BASE - 1;
+    sum2 += ((adler1 >> 16) & 0xffff) + ((adler2 >> 16) & 0xffff) +
+            DC_STREAM_ADLER32_BASE - rem;
+    if (sum1 >= DC_STREAM_ADLER32_BASE)
+    {
+        sum1 -= DC_STREAM_ADLER32_BASE;
+    }
+    if (sum1 >= DC_STREAM_ADLER32_BASE)
+    {
+        sum1 -= DC_STREAM_ADLER32_BASE;
+    }
+    if (sum2 >= ((Cpa64U)DC_STREAM_ADLER32_BASE << 1))
+    {
+        sum2 -= ((Cpa64U)DC_STREAM_ADLER32_BASE << 1);
+    }
+    if (sum2 >= DC_STREAM_ADLER32_BASE)
+    {
+        sum2 -= DC_STREAM_ADLER32_BASE;
+    }
+    return (Cpa32U)(sum1 | (sum2 << 16));
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Checksum of no data for the checksum type of the session
+ *
+ *****************************************************************************/
+STATIC Cpa32U dcStreamChecksumInit(const dc_stream_t *pStream)
+{
+    if (CPA_DC_ADLER32 == pStream->pSessionDesc->checksumType)
+    {
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Callback of the stream requests
+ *
+ * @description
+ *      The results were written to the slot before this is called; clearing
+ *      pending publishes them to the pull side.
+ *
+ *****************************************************************************/
+STATIC void dcStreamCallback(void *pCallbackTag, CpaStatus status)
+{
+    dc_stream_slot_t *pSlot = (dc_stream_slot_t *)pCallbackTag;
+
+    pSlot->cbStatus = status;
+    osalAtomicDec(&(pSlot->pending));
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Release the chunk buffers of a stream
+ *
+ *****************************************************************************/
+STATIC void dcStreamSlotsFree(dc_stream_t *pStream)
+{
+    dc_stream_slot_t *pSlot = NULL;
+    Cpa32U i = 0;
+
+    if (NULL == pStream->pSlots)
+    {
+        return;
+    }
+    for (i = 0; i < pStream->numSlots; i++)
+    {
+        pSlot = &(pStream->pSlots[i]);
+        LAC_OS_CAFREE(pSlot->srcFlat.pData);
+        LAC_OS_CAFREE(pSlot->dstFlat.pData);
+        LAC_OS_CAFREE(pSlot->srcList.pPrivateMetaData);
+        LAC_OS_CAFREE(pSlot->dstList.pPrivateMetaData);
+    }
+    LAC_OS_FREE(pStream->pSlots);
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Allocate the chunk buffers of a stream
+ *
+ *****************************************************************************/
+STATIC CpaStatus dcStreamSlotsAlloc(dc_stream_t *pStream,
+                                    Cpa32U dstSize,
+                                    Cpa32U metaSize,
+                                    Cpa32U node)
+{
+    dc_stream_slot_t *pSlot = NULL;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    status = LAC_OS_MALLOC(&(pStream->pSlots),
+                           pStream->numSlots * sizeof(dc_stream_slot_t));
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+    osalMemSet(
+        pStream->pSlots, 0, pStream->numSlots * sizeof(dc_stream_slot_t));
+
+    for (i = 0; (i < pStream->numSlots) && (CPA_STATUS_SUCCESS == status); i++)
+    {
+        pSlot = &(pStream->pSlots[i]);
+        pSlot->srcList.numBuffers = 1;
+        pSlot->srcList.pBuffers = &(pSlot->srcFlat);
+        pSlot->dstList.numBuffers = 1;
+        pSlot->dstList.pBuffers = &(pSlot->dstFlat);
+        pSlot->dstFlat.dataLenInBytes = dstSize;
+
+        status = LAC_OS_CAMALLOC(&(pSlot->srcFlat.pData),
+                                 pStream->chunkSize,
+                                 DC_STREAM_BUFFER_ALIGNMENT,
+                                 node);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = LAC_OS_CAMALLOC(&(pSlot->dstFlat.pData),
+                                     dstSize,
+                                     DC_STREAM_BUFFER_ALIGNMENT,
+                                     node);
+        }
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = LAC_OS_CAMALLOC(&(pSlot->srcList.pPrivateMetaData),
+                                     metaSize,
+                                     DC_STREAM_BUFFER_ALIGNMENT,
+                                     node);
+        }
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = LAC_OS_CAMALLOC(&(pSlot->dstList.pPrivateMetaData),
+                                     metaSize,
+                                     DC_STREAM_BUFFER_ALIGNMENT,
+                                     node);
+        }
+    }
+
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        dcStreamSlotsFree(pStream);
+    }
+    return status;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Set a stream back to its initial state
+ *
+ *****************************************************************************/
+STATIC void dcStreamStateReset(dc_stream_t *pStream)
+{
+    dc_stream_slot_t *pSlot = NULL;
+    Cpa32U i = 0;
+
+    for (i = 0; i < pStream->numSlots; i++)
+    {
+        pSlot = &(pStream->pSlots[i]);
+        osalAtomicSet(0, &(pSlot->pending));
+        pSlot->state = DC_STREAM_SLOT_FILLING;
+        pSlot->fill = 0;
+        pSlot->drained = 0;
+    }
+    pStream->head = 0;
+    pStream->submitted = 0;
+    pStream->lastData = CPA_FALSE;
+    pStream->complete = CPA_FALSE;
+    pStream->emptyBlockDrained = 0;
+    pStream->status = CPA_STATUS_SUCCESS;
+    pStream->checksum = dcStreamChecksumInit(pStream);
+    pStream->consumed = 0;
+    pStream->produced = 0;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Submit the slot being filled
+ *
+ * @description
+ *      Sends the slot at submitted with the given flush flag. If the ring is
+ *      full the slot is left ready and sent by a later push or pull.
+ *
+ * @retval CPA_STATUS_SUCCESS       The request is in flight
+ * @retval CPA_STATUS_RETRY         The ring is full
+ * @retval other                    The request failed, the stream is in error
+ *
+ *****************************************************************************/
+STATIC CpaStatus dcStreamSlotSubmit(dc_stream_t *pStream, CpaDcFlush flushFlag)
+{
+    dc_stream_slot_t *pSlot =
+        &(pStream->pSlots[pStream->submitted % pStream->numSlots]);
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    pSlot->state = DC_STREAM_SLOT_READY;
+    pSlot->flushFlag = flushFlag;
+    pSlot->srcFlat.dataLenInBytes = pSlot->fill;
+
+    /* A stateless request that follows a non final one starts from the
+     * checksum in its results, so seed it with the checksum of no data */
+    pSlot->results.checksum = dcStreamChecksumInit(pStream);
+    pSlot->results.consumed = 0;
+    pSlot->results.produced = 0;
+    pStream->opData.flushFlag = flushFlag;
+
+    osalAtomicSet(1, &(pSlot->pending));
+    status = cpaDcCompressData2(pStream->dcInstance,
+                                pStream->pSessionHandle,
+                                &(pSlot->srcList),
+                                &(pSlot->dstList),
+                                &(pStream->opData),
+                                &(pSlot->results),
+                                pSlot);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        pSlot->state = DC_STREAM_SLOT_INFLIGHT;
+        pStream->submitted++;
+        return CPA_STATUS_SUCCESS;
+    }
+
+    osalAtomicSet(0, &(pSlot->pending));
+    if (CPA_STATUS_RETRY != status)
+    {
+        LAC_LOG_ERROR1("Stream request failed with status %d", status);
+        pStream->status = status;
+    }
+    return status;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Resend a slot the ring had no room for
+ *
+ *****************************************************************************/
+STATIC CpaStatus dcStreamReadySubmit(dc_stream_t *pStream)
+{
+    dc_stream_slot_t *pSlot =
+        &(pStream->pSlots[pStream->submitted % pStream->numSlots]);
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    if ((pStream->submitted - pStream->head < pStream->numSlots) &&
+        (DC_STREAM_SLOT_READY == pSlot->state))
+    {
+        status = dcStreamSlotSubmit(pStream, pSlot->flushFlag);
+        if (CPA_STATUS_RETRY == status)
+        {
+            status = CPA_STATUS_SUCCESS;
+        }
+    }
+    return status;
+}
+
+CpaStatus icp_sal_DcStreamCreate(
+    CpaInstanceHandle dcInstance,
+    CpaDcSessionHandle pSessionHandle,
+    CpaDcSessionSetupData *pSessionData,
+    const icp_sal_dc_stream_setup_data_t *pStreamSetupData,
+    icp_sal_dc_stream_handle_t *phStream)
+{
+    CpaInstanceHandle insHandle = NULL;
+    sal_compression_service_t *pService = NULL;
+    dc_stream_t *pStream = NULL;
+    Cpa32U chunkSize = DC_STREAM_DEFAULT_CHUNK_SIZE;
+    Cpa32U numSlots = DC_STREAM_DEFAULT_NUM_SLOTS;
+    Cpa32U dstSize = 0;
+    Cpa32U metaSize = 0;
+    Cpa64U slotSize = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+#ifdef ICP_TRACE
+    LAC_LOG5("Called with params (0x%lx, 0x%lx, 0x%lx, 0x%lx, 0x%lx)\n",
+             (LAC_ARCH_UINT)dcInstance,
+             (LAC_ARCH_UINT)pSessionHandle,
+             (LAC_ARCH_UINT)pSessionData,
+             (LAC_ARCH_UINT)pStreamSetupData,
+             (LAC_ARCH_UINT)phStream);
+#endif
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == dcInstance)
+    {
+        insHandle = dcGetFirstHandle();
+    }
+    else
+    {
+        insHandle = dcInstance;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_NULL_PARAM(insHandle);
+    LAC_CHECK_NULL_PARAM(pSessionHandle);
+    LAC_CHECK_NULL_PARAM(pSessionData);
+    LAC_CHECK_NULL_PARAM(pStreamSetupData);
+    LAC_CHECK_NULL_PARAM(phStream);
+    SAL_CHECK_INSTANCE_TYPE(insHandle, SAL_SERVICE_TYPE_COMPRESSION);
+#endif
+    SAL_RUNNING_CHECK(insHandle);
+
+    pService = (sal_compression_service_t *)insHandle;
+
+    if ((CPA_DC_DEFLATE != pSessionData->compType) ||
+        (CPA_DC_STATELESS != pSessionData->sessState) ||
+        (CPA_DC_DIR_DECOMPRESS == pSessionData->sessDirection))
+    {
+        LAC_INVALID_PARAM_LOG("A stream needs a stateless deflate session "
+                              "that can compress");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    if (0 != pStreamSetupData->chunkSizeInBytes)
+    {
+        chunkSize = pStreamSetupData->chunkSizeInBytes;
+    }
+    if (chunkSize > (DC_BUFFER_MAX_SIZE - 1024) / 2)
+    {
+        LAC_INVALID_PARAM_LOG("Invalid chunkSizeInBytes value");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    dstSize = DC_STREAM_DEST_SIZE(chunkSize);
+    if (dstSize < pService->comp_device_data.minOutputBuffSize)
+    {
+        dstSize = pService->comp_device_data.minOutputBuffSize;
+    }
+#ifndef ICP_DC_DYN_NOT_SUPPORTED
+    /* Dynamic requests cannot produce more than an intermediate buffer, so
+     * a chunk that might not fit would overflow */
+    if ((CPA_DC_HT_FULL_DYNAMIC == pSessionData->huffType) &&
+        (dstSize > pService->minInterBuffSizeInBytes))
+    {
+        LAC_INVALID_PARAM_LOG("chunkSizeInBytes too large for the "
+                              "intermediate buffers of the instance");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    status = cpaDcBufferListGetMetaSize(insHandle, 1, &metaSize);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+
+    slotSize = (Cpa64U)chunkSize + dstSize + 2 * (Cpa64U)metaSize;
+    if (0 != pStreamSetupData->memoryBudgetInBytes)
+    {
+        numSlots = (Cpa32U)(pStreamSetupData->memoryBudgetInBytes / slotSize);
+        if (0 == numSlots)
+        {
+            LAC_INVALID_PARAM_LOG("memoryBudgetInBytes too small for one "
+                                  "chunk");
+            return CPA_STATUS_INVALID_PARAM;
+        }
+        if (numSlots > DC_STREAM_MAX_NUM_SLOTS)
+        {
+            numSlots = DC_STREAM_MAX_NUM_SLOTS;
+        }
+    }
+
+    status = LAC_OS_MALLOC(&pStream, sizeof(dc_stream_t));
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+    osalMemSet(pStream, 0, sizeof(dc_stream_t));
+    pStream->dcInstance = insHandle;
+    pStream->pSessionHandle = pSessionHandle;
+    pStream->chunkSize = chunkSize;
+    pStream->numSlots = numSlots;
+
+    /* Use the same checks on the compressed data as cpaDcCompressData */
+    if (pService->generic_service_info.dcExtendedFeatures &
+        DC_CNV_EXTENDED_CAPABILITY)
+    {
+        pStream->opData.compressAndVerify = CPA_TRUE;
+        if (pService->generic_service_info.dcExtendedFeatures &
+            DC_CNVNR_EXTENDED_CAPABILITY)
+        {
+            pStream->opData.compressAndVerifyAndRecover = CPA_TRUE;
+        }
+    }
+
+    status = dcStreamSlotsAlloc(
+        pStream, dstSize, metaSize, pService->nodeAffinity);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = cpaDcInitSession(
+            insHandle, pSessionHandle, pSessionData, NULL, dcStreamCallback);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            dcStreamSlotsFree(pStream);
+        }
+    }
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        LAC_OS_FREE(pStream);
+        return status;
+    }
+
+    pStream->pSessionDesc = DC_SESSION_DESC_FROM_CTX_GET(pSessionHandle);
+    dcStreamCrc32TableInit(pStream->crc32X2n);
+    dcStreamStateReset(pStream);
+
+    *phStream = (icp_sal_dc_stream_handle_t)pStream;
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus icp_sal_DcStreamPush(icp_sal_dc_stream_handle_t hStream,
+                               const Cpa8U *pData,
+                               Cpa32U length,
+                               CpaBoolean lastData,
+                               Cpa32U *pConsumed)
+{
+    dc_stream_t *pStream = (dc_stream_t *)hStream;
+    dc_stream_slot_t *pSlot = NULL;
+    Cpa32U consumed = 0;
+    Cpa32U copyLen = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_NULL_PARAM(pStream);
+    LAC_CHECK_NULL_PARAM(pConsumed);
+    if (0 != length)
+    {
+        LAC_CHECK_NULL_PARAM(pData);
+    }
+#endif
+
+    *pConsumed = 0;
+    if (CPA_STATUS_SUCCESS != pStream->status)
+    {
+        return pStream->status;
+    }
+    if (CPA_TRUE == pStream->lastData)
+    {
+        LAC_INVALID_PARAM_LOG("The end of the stream was already pushed");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    status = dcStreamReadySubmit(pStream);
+
+    while ((CPA_STATUS_SUCCESS == status) && (consumed < length))
+    {
+        /* All the slots hold output not pulled yet */
+        if (pStream->submitted - pStream->head >= pStream->numSlots)
+        {
+            break;
+        }
+        pSlot = &(pStream->pSlots[pStream->submitted % pStream->numSlots]);
+        if (DC_STREAM_SLOT_READY == pSlot->state)
+        {
+            /* Still waiting for room on the ring */
+            break;
+        }
+
+        if (pSlot->fill == pStream->chunkSize)
+        {
+            /* More data follows the full chunk, so it is not the last */
+            status = dcStreamSlotSubmit(pStream, CPA_DC_FLUSH_FULL);
+            if (CPA_STATUS_RETRY == status)
+            {
+                status = CPA_STATUS_SUCCESS;
+                break;
+            }
+            continue;
+        }
+
+        copyLen = pStream->chunkSize - pSlot->fill;
+        if (copyLen > length - consumed)
+        {
+            copyLen = length - consumed;
+        }
+        osalMemCopy(pSlot->srcFlat.pData + pSlot->fill,
+                    pData + consumed,
+                    copyLen);
+        pSlot->fill += copyLen;
+        consumed += copyLen;
+    }
+
+    *pConsumed = consumed;
+    if ((CPA_STATUS_SUCCESS == status) && (CPA_TRUE == lastData) &&
+        (consumed == length))
+    {
+        pStream->lastData = CPA_TRUE;
+        pSlot = &(pStream->pSlots[pStream->submitted % pStream->numSlots]);
+
+        /* Without data the stream is completed by the pull side */
+        if ((pStream->submitted - pStream->head < pStream->numSlots) &&
+            (DC_STREAM_SLOT_FILLING == pSlot->state) && (0 != pSlot->fill))
+        {
+            status = dcStreamSlotSubmit(pStream, CPA_DC_FLUSH_FINAL);
+            if (CPA_STATUS_RETRY == status)
+            {
+                status = CPA_STATUS_SUCCESS;
+            }
+        }
+    }
+    return status;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Account for the slot at the head once its response has arrived
+ *
+ * @retval CPA_STATUS_SUCCESS       The output of the slot can be pulled
+ * @retval CPA_STATUS_RETRY         The request is still in flight
+ * @retval CPA_STATUS_FAIL          The request failed
+ *
+ *****************************************************************************/
+STATIC CpaStatus dcStreamHeadComplete(dc_stream_t *pStream,
+                                      dc_stream_slot_t *pSlot)
+{
+    CpaDcRqResults *pResults = &(pSlot->results);
+
+    if (DC_STREAM_SLOT_DONE == pSlot->state)
+    {
+        return CPA_STATUS_SUCCESS;
+    }
+    if (0 != osalAtomicGet(&(pSlot->pending)))
+    {
+        return CPA_STATUS_RETRY;
+    }
+
+    /* A stateless overflow would leave input behind in the middle of the
+     * stream; the destination is sized so it cannot happen */
+    if ((CPA_STATUS_SUCCESS != pSlot->cbStatus) ||
+        (CPA_DC_OK != pResults->status) || (pResults->consumed != pSlot->fill))
+    {
+        LAC_LOG_ERROR2("Stream request failed, status %d, dc status %d",
+                       pSlot->cbStatus,
+                       pResults->status);
+        pStream->status = CPA_STATUS_FAIL;
+        return CPA_STATUS_FAIL;
+    }
+
+    if (CPA_DC_CRC32 == pStream->pSessionDesc->checksumType)
+    {
+        pStream->checksum = dcStreamCrc32Combine(pStream->crc32X2n,
+                                                 pStream->checksum,
+                                                 pResults->checksum,
+                                                 pResults->consumed);
+    }
+    else if (CPA_DC_ADLER32 == pStream->pSessionDesc->checksumType)
+    {
+        pStream->checksum = dcStreamAdler32Combine(
+            pStream->checksum, pResults->checksum, pResults->consumed);
+    }
+    pStream->consumed += pResults->consumed;
+    pStream->produced += pResults->produced;
+    pSlot->state = DC_STREAM_SLOT_DONE;
+
+    if (CPA_DC_FLUSH_FINAL == pSlot->flushFlag)
+    {
+        /* cpaDcGenerateFooter takes the length of the data from the
+         * session */
+        pStream->pSessionDesc->cumulativeConsumedBytes = pStream->consumed;
+        pStream->pSessionDesc->previousChecksum = pStream->checksum;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus icp_sal_DcStreamPull(icp_sal_dc_stream_handle_t hStream,
+                               Cpa8U *pOut,
+                               Cpa32U outLength,
+                               Cpa32U *pProduced,
+                               CpaBoolean *pEndOfStream)
+{
+    dc_stream_t *pStream = (dc_stream_t *)hStream;
+    dc_stream_slot_t *pSlot = NULL;
+    Cpa32U produced = 0;
+    Cpa32U copyLen = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_NULL_PARAM(pStream);
+    LAC_CHECK_NULL_PARAM(pOut);
+    LAC_CHECK_NULL_PARAM(pProduced);
+    LAC_CHECK_NULL_PARAM(pEndOfStream);
+#endif
+
+    *pProduced = 0;
+    *pEndOfStream = pStream->complete;
+    if (CPA_STATUS_SUCCESS != pStream->status)
+    {
+        return pStream->status;
+    }
+
+    while ((produced < outLength) && (pStream->head != pStream->submitted))
+    {
+        pSlot = &(pStream->pSlots[pStream->head % pStream->numSlots]);
+        status = dcStreamHeadComplete(pStream, pSlot);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            break;
+        }
+
+        copyLen = pSlot->results.produced - pSlot->drained;
+        if (copyLen > outLength - produced)
+        {
+            copyLen = outLength - produced;
+        }
+        osalMemCopy(
+            pOut + produced, pSlot->dstFlat.pData + pSlot->drained, copyLen);
+        pSlot->drained += copyLen;
+        produced += copyLen;
+
+        if (pSlot->drained == pSlot->results.produced)
+        {
+            if (CPA_DC_FLUSH_FINAL == pSlot->flushFlag)
+            {
+                pStream->complete = CPA_TRUE;
+            }
+            pSlot->state = DC_STREAM_SLOT_FILLING;
+            pSlot->fill = 0;
+            pSlot->drained = 0;
+            pStream->head++;
+        }
+    }
+
+    /* A stream without data is a single empty final block */
+    if ((CPA_TRUE == pStream->lastData) && (0 == pStream->submitted) &&
+        (0 == pStream->pSlots[0].fill) && (CPA_FALSE == pStream->complete))
+    {
+        while ((produced < outLength) &&
+               (pStream->emptyBlockDrained < DC_STREAM_EMPTY_BLOCK_SIZE))
+        {
+            pOut[produced++] = (0 == pStream->emptyBlockDrained)
+                                   ? DC_STREAM_EMPTY_BLOCK_BYTE0
+                                   : DC_STREAM_EMPTY_BLOCK_BYTE1;
+            pStream->emptyBlockDrained++;
+        }
+        if (DC_STREAM_EMPTY_BLOCK_SIZE == pStream->emptyBlockDrained)
+        {
+            pStream->produced = DC_STREAM_EMPTY_BLOCK_SIZE;
+            pStream->pSessionDesc->cumulativeConsumedBytes = 0;
+            pStream->pSessionDesc->previousChecksum = pStream->checksum;
+            pStream->complete = CPA_TRUE;
+        }
+    }
+
+    *pProduced = produced;
+    *pEndOfStream = pStream->complete;
+    if (CPA_STATUS_FAIL == status)
+    {
+        return status;
+    }
+
+    /* Slots freed above make room for a chunk the ring refused earlier */
+    return dcStreamReadySubmit(pStream);
+}
+
+CpaStatus icp_sal_DcStreamGetResults(icp_sal_dc_stream_handle_t hStream,
+                                     CpaDcRqResults *pResults)
+{
+    dc_stream_t *pStream = (dc_stream_t *)hStream;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_NULL_PARAM(pStream);
+    LAC_CHECK_NULL_PARAM(pResults);
+#endif
+
+    if (CPA_STATUS_SUCCESS != pStream->status)
+    {
+        return pStream->status;
+    }
+    if (CPA_TRUE != pStream->complete)
+    {
+        return CPA_STATUS_RETRY;
+    }
+
+    osalMemSet(pResults, 0, sizeof(CpaDcRqResults));
+    pResults->status = CPA_DC_OK;
+    pResults->checksum = pStream->checksum;
+    pResults->consumed = (Cpa32U)pStream->consumed;
+    pResults->produced = (Cpa32U)pStream->produced;
+    pResults->endOfLastBlock = CPA_TRUE;
+    return CPA_STATUS_SUCCESS;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Check that no request of a stream is in flight
+ *
+ *****************************************************************************/
+STATIC CpaBoolean dcStreamIsIdle(const dc_stream_t *pStream)
+{
+    Cpa32U i = 0;
+
+    for (i = 0; i < pStream->numSlots; i++)
+    {
+        if (0 != osalAtomicGet(&(pStream->pSlots[i].pending)))
+        {
+            return CPA_FALSE;
+        }
+    }
+    return CPA_TRUE;
+}
+
+CpaStatus icp_sal_DcStreamReset(icp_sal_dc_stream_handle_t hStream)
+{
+    dc_stream_t *pStream = (dc_stream_t *)hStream;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_NULL_PARAM(pStream);
+#endif
+
+    if (CPA_TRUE != dcStreamIsIdle(pStream))
+    {
+        return CPA_STATUS_RETRY;
+    }
+    dcStreamStateReset(pStream);
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus icp_sal_DcStreamRemove(icp_sal_dc_stream_handle_t hStream)
+{
+    dc_stream_t *pStream = (dc_stream_t *)hStream;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_NULL_PARAM(pStream);
+#endif
+
+    if (CPA_TRUE != dcStreamIsIdle(pStream))
+    {
+        return CPA_STATUS_RETRY;
+    }
+    status = cpaDcRemoveSession(pStream->dcInstance, pStream->pSessionHandle);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+    dcStreamSlotsFree(pStream);
+    LAC_OS_FREE(pStream);
+    return CPA_STATUS_SUCCESS;
+}
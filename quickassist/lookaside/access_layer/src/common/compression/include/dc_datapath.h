@@ -119,6 +119,9 @@
  * align the results field with the API struct  */
 #define DC_API_ALIGNMENT_OFFSET (offsetof(CpaDcDpOpData, results))
 
+/* Maximum number of requests put on the ring with a single tail update */
+#define DC_SEND_BURST_SIZE (16)
+
 /* Mask used to check the CompressAndVerify capability bit */
 #define DC_CNV_EXTENDED_CAPABILITY (0x01)
 
@@ -192,6 +195,27 @@ typedef struct dc_compression_cookie_s
  *****************************************************************************/
 void dcCompression_ProcessCallback(void *pRespMsg);
 
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Send a burst of stateless compression requests to QAT
+ *
+ * @description
+ *      Puts already built requests on the compression ring, in order, with
+ *      one ring tail update per DC_SEND_BURST_SIZE requests. Requests the
+ *      ring has no room for are left to the caller to resubmit.
+ *
+ * @param[in]   pCookies        Array of compression cookies
+ * @param[in]   numRequests     Number of cookies in the array
+ * @param[in]   dcInstance      Compression instance handle
+ * @param[out]  pNumSent        Number of requests put on the ring
+ *
+ *****************************************************************************/
+CpaStatus dcSendRequests(dc_compression_cookie_t **pCookies,
+                         Cpa32U numRequests,
+                         CpaInstanceHandle dcInstance,
+                         Cpa32U *pNumSent);
+
 /**
 *****************************************************************************
 * @ingroup Dc_DataCompression
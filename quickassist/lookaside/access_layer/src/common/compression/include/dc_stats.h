@@ -78,23 +78,22 @@
 #define COMPRESSION_NUM_STATS (sizeof(CpaDcStats) / sizeof(Cpa64U))
 
 #ifndef DISABLE_STATS
-/* Macro to increment a Compression stat (derives offset into array of
- * atomics) */
+/* Macro to increment a Compression stat (derives offset into the sharded
+ * stats) */
 #define COMPRESSION_STAT_INC(statistic, pService)                              \
     do                                                                         \
     {                                                                          \
         if (CPA_TRUE == pService->generic_service_info.stats->bDcStatsEnabled) \
         {                                                                      \
-            osalAtomicInc(                                                     \
-                &pService->pCompStatsArr[offsetof(CpaDcStats, statistic) /     \
-                                         sizeof(Cpa64U)]);                     \
+            LacStats_Inc(&pService->compressionStats,                          \
+                         offsetof(CpaDcStats, statistic) / sizeof(Cpa64U));    \
         }                                                                      \
     } while (0)
 #else
 #define COMPRESSION_STAT_INC(statistic, pService)
 #endif
 
-/* Macro to get all Compression stats (from internal array of atomics) */
+/* Macro to get all Compression stats (summed over the stats shards) */
 #define COMPRESSION_STATS_GET(compStats, pService)                             \
     do                                                                         \
     {                                                                          \
@@ -102,20 +101,13 @@
         for (i = 0; i < COMPRESSION_NUM_STATS; i++)                            \
         {                                                                      \
             ((Cpa64U *)compStats)[i] =                                         \
-                osalAtomicGet(&pService->pCompStatsArr[i]);                    \
+                LacStats_Get(&pService->compressionStats, i);                  \
         }                                                                      \
     } while (0)
 
 /* Macro to reset all Compression stats */
 #define COMPRESSION_STATS_RESET(pService)                                      \
-    do                                                                         \
-    {                                                                          \
-        int i;                                                                 \
-        for (i = 0; i < COMPRESSION_NUM_STATS; i++)                            \
-        {                                                                      \
-            osalAtomicSet(0, &pService->pCompStatsArr[i]);                     \
-        }                                                                      \
-    } while (0)
+    LacStats_Reset(&pService->compressionStats)
 
 /**
 *******************************************************************************
@@ -123,7 +115,7 @@
 *      Initialises the compression stats
 *
 * @description
-*      This function allocates and initialises the stats array to 0
+*      This function allocates and initialises the stats counters to 0
 *
 * @param[in] pService          Pointer to a compression service structure
 *
@@ -139,7 +131,7 @@ CpaStatus dcStatsInit(sal_compression_service_t *pService);
 *      Frees the compression stats
 *
 * @description
-*      This function frees the stats array
+*      This function frees the stats counters
 *
 * @param[in] pService          Pointer to a compression service structure
 *
@@ -0,0 +1,209 @@
+/****************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file dc_stream.h
+ *
+ * @ingroup Dc_DataCompression
+ *
+ * @description
+ *      Definition of the compression stream built on stateless requests.
+ *
+ *****************************************************************************/
+#ifndef DC_STREAM_H_
+#define DC_STREAM_H_
+
+#include "cpa_dc.h"
+#include "icp_sal_dc_stream.h"
+#include "dc_session.h"
+
+/* Input bytes per request when the application does not set it */
+#define DC_STREAM_DEFAULT_CHUNK_SIZE (64 * 1024)
+
+/* Number of chunks in flight when the application sets no memory budget */
+#define DC_STREAM_DEFAULT_NUM_SLOTS (8)
+
+/* Upper bound for the number of chunks in flight */
+#define DC_STREAM_MAX_NUM_SLOTS (64)
+
+/* Output buffer for a chunk. Static or dynamic deflate never expands the
+ * data by more than one bit per byte plus the block headers; with compress
+ * and verify and recover the device falls back to stored blocks, which add
+ * 5 bytes per 64KB */
+#define DC_STREAM_DEST_SIZE(chunkSize) ((chunkSize) + ((chunkSize) >> 3) + 1024)
+
+/* Alignment of the chunk buffers */
+#define DC_STREAM_BUFFER_ALIGNMENT (64)
+
+/* A deflate stream holding a single empty final block with fixed Huffman
+ * codes, returned for a stream without data as stateless requests cannot
+ * be empty */
+#define DC_STREAM_EMPTY_BLOCK_SIZE (2)
+#define DC_STREAM_EMPTY_BLOCK_BYTE0 (0x03)
+#define DC_STREAM_EMPTY_BLOCK_BYTE1 (0x00)
+
+/* CRC32 polynomial, bit reversed */
+#define DC_STREAM_CRC32_POLY (0xedb88320)
+
+/* Largest prime below 2^16, the Adler32 modulus */
+#define DC_STREAM_ADLER32_BASE (65521)
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      State of a chunk buffer
+ *****************************************************************************/
+typedef enum dc_stream_slot_state_e
+{
+    DC_STREAM_SLOT_FILLING = 0,
+    /* Being filled with input, not submitted */
+    DC_STREAM_SLOT_READY,
+    /* Complete, to be submitted once the ring has room */
+    DC_STREAM_SLOT_INFLIGHT,
+    /* Submitted, the response may not have arrived */
+    DC_STREAM_SLOT_DONE,
+    /* Response processed, output being pulled */
+} dc_stream_slot_state_t;
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Chunk buffer of a compression stream
+ *
+ * @description
+ *      Holds the input of one stateless request and its output until the
+ *      application pulls it. The slot is the callback tag of the request.
+ *****************************************************************************/
+typedef struct dc_stream_slot_s
+{
+    OsalAtomic pending;
+    /* Set while the request is in flight, cleared by the callback */
+    CpaStatus cbStatus;
+    /* Status given to the callback */
+    CpaDcRqResults results;
+    /* Results of the request */
+    dc_stream_slot_state_t state;
+    /* Owned by the push and pull side */
+    CpaDcFlush flushFlag;
+    /* Flush flag the request is sent with */
+    Cpa32U fill;
+    /* Input bytes in the slot */
+    Cpa32U drained;
+    /* Output bytes already pulled */
+    CpaBufferList srcList;
+    CpaBufferList dstList;
+    CpaFlatBuffer srcFlat;
+    CpaFlatBuffer dstFlat;
+    /* Source and destination of the request */
+} dc_stream_slot_t;
+
+/**
+ *****************************************************************************
+ * @ingroup Dc_DataCompression
+ *      Compression stream
+ *
+ * @description
+ *      The slots are used as a ring. Slots from head up to submitted are in
+ *      flight or hold output not pulled yet; the slot at submitted is the
+ *      one being filled.
+ *****************************************************************************/
+typedef struct dc_stream_s
+{
+    CpaInstanceHandle dcInstance;
+    /* Compression instance */
+    CpaDcSessionHandle pSessionHandle;
+    /* Stateless session of the stream */
+    dc_session_desc_t *pSessionDesc;
+    /* Descriptor of the session */
+    CpaDcOpData opData;
+    /* Operation data of the requests, except the flush flag */
+    Cpa32U chunkSize;
+    /* Input bytes per request */
+    Cpa32U numSlots;
+    /* Number of chunk buffers */
+    Cpa32U head;
+    /* Oldest slot with output to pull */
+    Cpa32U submitted;
+    /* Number of slots submitted since the stream started */
+    CpaBoolean lastData;
+    /* The application has pushed the end of the stream */
+    CpaBoolean complete;
+    /* All the output has been pulled */
+    Cpa32U emptyBlockDrained;
+    /* Bytes of the empty block pulled, for a stream without data */
+    CpaStatus status;
+    /* First error of the stream */
+    Cpa32U checksum;
+    /* Checksum of the chunks pulled so far */
+    Cpa64U consumed;
+    /* Input bytes of the chunks pulled so far */
+    Cpa64U produced;
+    /* Output bytes of the chunks pulled so far */
+    Cpa32U crc32X2n[32];
+    /* x^(2^n) modulo the CRC32 polynomial, to combine chunk checksums */
+    dc_stream_slot_t *pSlots;
+    /* Chunk buffers */
+} dc_stream_t;
+
+#endif /* DC_STREAM_H_ */
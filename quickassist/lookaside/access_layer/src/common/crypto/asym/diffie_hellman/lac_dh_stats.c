@@ -103,15 +103,7 @@ CpaStatus LacDh_StatsInit(CpaInstanceHandle instanceHandle)
     sal_crypto_service_t *pCryptoService =
         (sal_crypto_service_t *)instanceHandle;
 
-    status = LAC_OS_MALLOC(&(pCryptoService->pLacDhStatsArr),
-                           LAC_DH_NUM_STATS * sizeof(OsalAtomic));
-
-    if (CPA_STATUS_SUCCESS == status)
-    {
-        LAC_OS_BZERO(
-            LAC_CONST_VOLATILE_PTR_CAST(pCryptoService->pLacDhStatsArr),
-            LAC_DH_NUM_STATS * sizeof(OsalAtomic));
-    }
+    status = LacStats_Init(&pCryptoService->lacDhStats, LAC_DH_NUM_STATS);
 
     return status;
 }
@@ -121,10 +113,7 @@ void LacDh_StatsFree(CpaInstanceHandle instanceHandle)
     sal_crypto_service_t *pCryptoService =
         (sal_crypto_service_t *)instanceHandle;
 
-    if (NULL != pCryptoService->pLacDhStatsArr)
-    {
-        LAC_OS_FREE(pCryptoService->pLacDhStatsArr);
-    }
+    LacStats_Free(&pCryptoService->lacDhStats);
 }
 
 CpaStatus cpaCyDhQueryStats(CpaInstanceHandle instanceHandle_in,
@@ -161,7 +150,7 @@ CpaStatus cpaCyDhQueryStats(CpaInstanceHandle instanceHandle_in,
     for (i = 0; i < LAC_DH_NUM_STATS; i++)
     {
         ((Cpa32U *)pDhStats)[i] =
-            (Cpa32U)osalAtomicGet(&pCryptoService->pLacDhStatsArr[i]);
+            (Cpa32U)LacStats_Get(&pCryptoService->lacDhStats, i);
     }
     return CPA_STATUS_SUCCESS;
 } /* cpaCyDhQueryStats */
@@ -200,7 +189,7 @@ CpaStatus cpaCyDhQueryStats64(const CpaInstanceHandle instanceHandle_in,
     for (i = 0; i < LAC_DH_NUM_STATS; i++)
     {
         ((Cpa64U *)pDhStats)[i] =
-            osalAtomicGet(&pCryptoService->pLacDhStatsArr[i]);
+            LacStats_Get(&pCryptoService->lacDhStats, i);
     }
     return CPA_STATUS_SUCCESS;
 } /* cpaCyDhQueryStats64 */
@@ -212,7 +201,7 @@ void LacDh_StatsInc(Cpa32U offset, CpaInstanceHandle instanceHandle)
     pCryptoService = (sal_crypto_service_t *)instanceHandle;
     if (CPA_TRUE == pCryptoService->generic_service_info.stats->bDhStatsEnabled)
     {
-        osalAtomicInc(&pCryptoService->pLacDhStatsArr[offset / sizeof(Cpa64U)]);
+        LacStats_Inc(&pCryptoService->lacDhStats, offset / sizeof(Cpa64U));
     }
 } /* LacDh_StatIncrement */
 #endif /* DISABLE_STATS */
@@ -676,6 +676,7 @@ CpaStatus cpaCyKptDsaSignS(const CpaInstanceHandle instanceHandle_in,
                                           &out,
                                           internalMemIn,
                                           internalMemOut,
+                                          NULL,
                                           LacKptDsaSSignCallback,
                                           &cbData,
                                           instanceHandle);
@@ -1115,6 +1116,7 @@ CpaStatus cpaCyKptDsaSignRS(const CpaInstanceHandle instanceHandle_in,
                                           &out,
                                           internalMemIn,
                                           internalMemOut,
+                                          NULL,
                                           LacKptDsaRSSignCallback,
                                           &cbData,
                                           instanceHandle);
@@ -130,10 +130,9 @@
         if (CPA_TRUE ==                                                        \
             pCryptoService->generic_service_info.stats->bEccStatsEnabled)      \
         {                                                                      \
-            osalAtomicInc(                                                     \
-                &pCryptoService                                                \
-                     ->pLacEcStatsArr[offsetof(CpaCyEcStats64, statistic) /    \
-                                      sizeof(Cpa64U)]);                        \
+            LacStats_Inc(&pCryptoService->lacEcStats,                          \
+                         offsetof(CpaCyEcStats64, statistic) /                 \
+                             sizeof(Cpa64U));                                  \
         }                                                                      \
     } while (0)
 #else
@@ -142,7 +141,7 @@
 #endif
 
 /**< @ingroup Lac_Ec
- * macro to increment a EC stat (derives offset into array of atomics)
+ * macro to increment a EC stat (derives offset into the sharded stats)
  * assumes pCryptoService has already been validated */
 
 #define LAC_EC_STATS_GET(ecStats, pCryptoService)                              \
@@ -153,11 +152,11 @@
         for (i = 0; i < LAC_EC_NUM_STATS; i++)                                 \
         {                                                                      \
             ((Cpa64U *)&(ecStats))[i] =                                        \
-                osalAtomicGet(&pCryptoService->pLacEcStatsArr[i]);             \
+                LacStats_Get(&pCryptoService->lacEcStats, i);                  \
         }                                                                      \
     } while (0)
 /**< @ingroup Lac_Ec
- * macro to get all EC stats (from internal array of atomics)
+ * macro to get all EC stats (summed over the stats shards)
  * assumes pCryptoService has already been validated */
 
 #if defined(COUNTERS) && !defined(DISABLE_STATS)
@@ -1020,6 +1019,313 @@ CpaStatus cpaCyEcPointMultiply(const CpaInstanceHandle instanceHandle_in,
     return status;
 }
 
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      EC Point Multiply on a named curve synchronous function
+ ***************************************************************************/
+STATIC CpaStatus LacEc_PointMultiplyCurveSyn(
+    const CpaInstanceHandle instanceHandle,
+    const icp_sal_ec_point_multiply_curve_op_data_t *pOpData,
+    CpaBoolean *pMultiplyStatus,
+    CpaFlatBuffer *pXk,
+    CpaFlatBuffer *pYk)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_sync_op_data_t *pSyncCallbackData = NULL;
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+
+    status = LacSync_CreateSyncCookie(&pSyncCallbackData);
+    /*
+     * Call the asynchronous version of the function
+     * with the generic synchronous callback function as a parameter.
+     */
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = icp_sal_CyEcPointMultiplyCurve(instanceHandle,
+                                                LacSync_GenDualFlatBufVerifyCb,
+                                                pSyncCallbackData,
+                                                pOpData,
+                                                pMultiplyStatus,
+                                                pXk,
+                                                pYk);
+    }
+    else
+    {
+        LAC_EC_STAT_INC(numEcPointMultiplyRequestErrors, pCryptoService);
+        return status;
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        CpaStatus wCbStatus = CPA_STATUS_FAIL;
+        wCbStatus = LacSync_WaitForCallback(pSyncCallbackData,
+                                            LAC_PKE_SYNC_CALLBACK_TIMEOUT,
+                                            &status,
+                                            pMultiplyStatus);
+
+        if (CPA_STATUS_SUCCESS != wCbStatus)
+        {
+            LAC_EC_STAT_INC(numEcPointMultiplyCompletedError, pCryptoService);
+            status = wCbStatus;
+        }
+    }
+    else
+    {
+        /* As the Request was not sent the Callback will never
+         * be called, so need to indicate that we're finished
+         * with cookie so it can be destroyed. */
+        LacSync_SetSyncCookieComplete(pSyncCallbackData);
+    }
+
+    LacSync_DestroySyncCookie(&pSyncCallbackData);
+    return status;
+}
+
+#ifdef ICP_PARAM_CHECK
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      EC Point Multiply on a named curve parameter check
+ *
+ * @description
+ *      The curve parameters are known to be valid, only the numbers of the
+ *      request are checked.
+ ***************************************************************************/
+STATIC CpaStatus LacEc_PointMultiplyCurveParamCheck(
+    const CpaInstanceHandle instanceHandle,
+    const icp_sal_ec_point_multiply_curve_op_data_t *pOpData,
+    CpaBoolean *pMultiplyStatus,
+    CpaFlatBuffer *pXk,
+    CpaFlatBuffer *pYk)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_ec_named_curve_t *pCurve = NULL;
+
+    /* check for NULL pointers */
+    LAC_CHECK_NULL_PARAM(pMultiplyStatus);
+    LAC_CHECK_NULL_PARAM(pOpData);
+    LAC_CHECK_NULL_PARAM(pXk);
+    LAC_CHECK_NULL_PARAM(pYk);
+
+    /* Check flat buffers in pOpData for NULL and dataLen of 0*/
+    LAC_CHECK_NULL_PARAM(pOpData->k.pData);
+    LAC_CHECK_SIZE(&(pOpData->k), CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pXk->pData);
+    LAC_CHECK_SIZE(pXk, CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pYk->pData);
+    LAC_CHECK_SIZE(pYk, CHECK_NONE, 0);
+
+    status = LacEc_NamedCurveCheck(instanceHandle, pOpData->hCurve);
+    LAC_CHECK_STATUS(status);
+    pCurve = (lac_ec_named_curve_t *)pOpData->hCurve;
+
+    /* Check that output buffers are big enough */
+    if ((pXk->dataLenInBytes < pCurve->minOutputSizeBytes) ||
+        (pYk->dataLenInBytes < pCurve->minOutputSizeBytes))
+    {
+        LAC_INVALID_PARAM_LOG("Output buffers not big enough");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Check that k fits in the operand size of the curve */
+    if (LacPke_GetMinBytes(&(pOpData->k)) > pCurve->sizeBytes)
+    {
+        LAC_INVALID_PARAM_LOG("k is too big for the curve");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Either both coordinates are given or the base point is used */
+    if ((NULL == pOpData->x.pData) && (NULL == pOpData->y.pData))
+    {
+        return CPA_STATUS_SUCCESS;
+    }
+    LAC_CHECK_NULL_PARAM(pOpData->x.pData);
+    LAC_CHECK_SIZE(&(pOpData->x), CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pOpData->y.pData);
+    LAC_CHECK_SIZE(&(pOpData->y), CHECK_NONE, 0);
+
+    /* Ensure x < q and y < q */
+    if (LacPke_Compare(&(pOpData->x), 0, &(pCurve->q), 0) >= 0)
+    {
+        LAC_INVALID_PARAM_LOG("x is not < q as required");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    if (LacPke_Compare(&(pOpData->y), 0, &(pCurve->q), 0) >= 0)
+    {
+        LAC_INVALID_PARAM_LOG("y is not < q as required");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    return CPA_STATUS_SUCCESS;
+}
+#endif
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *
+ ***************************************************************************/
+CpaStatus icp_sal_CyEcPointMultiplyCurve(
+    const CpaInstanceHandle instanceHandle_in,
+    const CpaCyEcPointMultiplyCbFunc pCb,
+    void *pCallbackTag,
+    const icp_sal_ec_point_multiply_curve_op_data_t *pOpData,
+    CpaBoolean *pMultiplyStatus,
+    CpaFlatBuffer *pXk,
+    CpaFlatBuffer *pYk)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    sal_crypto_service_t *pCryptoService = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    /* instance checks - if fail, no inc stats just return */
+    /* check for valid acceleration handle */
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_ADDR_TRANS_SETUP(instanceHandle);
+#endif
+    /* ensure LAC is running - return error if not */
+    SAL_RUNNING_CHECK(instanceHandle);
+#ifdef ICP_PARAM_CHECK
+    /* ensure this is a crypto or asym instance with pke enabled */
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+#endif
+
+    /* Check if the API has been called in synchronous mode */
+    if (NULL == pCb)
+    {
+        return LacEc_PointMultiplyCurveSyn(
+            instanceHandle, pOpData, pMultiplyStatus, pXk, pYk);
+    }
+
+#ifdef ICP_PARAM_CHECK
+    status = LacEc_PointMultiplyCurveParamCheck(
+        instanceHandle, pOpData, pMultiplyStatus, pXk, pYk);
+#endif
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        lac_ec_named_curve_t *pCurve = (lac_ec_named_curve_t *)pOpData->hCurve;
+        icp_qat_fw_mmp_input_param_t in = {.flat_array = {0}};
+        icp_qat_fw_mmp_output_param_t out = {.flat_array = {0}};
+        lac_pke_op_cb_data_t cbData = {0};
+        /* All sizes have the same layout as the 256 bit service */
+        icp_qat_fw_maths_point_multiplication_gfp_l256_input_t *pIn =
+            &in.maths_point_multiplication_gfp_l256;
+        icp_qat_fw_maths_point_multiplication_gfp_l256_output_t *pOut =
+            &out.maths_point_multiplication_gfp_l256;
+
+        /* Holding the calculated size of the input/output parameters */
+        Cpa32U inArgSizeList[LAC_MAX_MMP_INPUT_PARAMS] = {0};
+        Cpa32U outArgSizeList[LAC_MAX_MMP_OUTPUT_PARAMS] = {0};
+
+        CpaBoolean internalMemInList[LAC_MAX_MMP_INPUT_PARAMS] = {CPA_FALSE};
+        CpaBoolean internalMemOutList[LAC_MAX_MMP_OUTPUT_PARAMS] = {CPA_FALSE};
+
+        /* Zero the output buffers */
+        osalMemSet(pXk->pData, 0, pXk->dataLenInBytes);
+        osalMemSet(pYk->pData, 0, pYk->dataLenInBytes);
+
+        /* populate callback data */
+        cbData.pClientCb = pCb;
+        cbData.pCallbackTag = pCallbackTag;
+        cbData.pClientOpData = pOpData;
+        cbData.pOpaqueData = NULL;
+        cbData.pOutputData1 = pXk;
+        cbData.pOutputData2 = pYk;
+
+        /* Set the size for all parameters to be padded to */
+        LAC_EC_SET_LIST_PARAMS(inArgSizeList,
+                               LAC_EC_POINT_MULTIPLY_NUM_IN_ARGS,
+                               pCurve->sizeBytes);
+        LAC_EC_SET_LIST_PARAMS(outArgSizeList,
+                               LAC_EC_POINT_MULTIPLY_NUM_OUT_ARGS,
+                               pCurve->sizeBytes);
+        inArgSizeList[LAC_IDX_OF(
+            icp_qat_fw_maths_point_multiplication_gfp_l256_input_t, h)] =
+            pCurve->h.dataLenInBytes;
+
+        /* k and the point are the only client inputs, the curve parameters
+         * are already padded in internally allocated memory */
+        LAC_MEM_SHARED_WRITE_FROM_PTR(pIn->k, &pOpData->k);
+        LAC_MEM_SHARED_WRITE_FROM_PTR(pIn->q, &pCurve->q);
+        LAC_MEM_SHARED_WRITE_FROM_PTR(pIn->a, &pCurve->a);
+        LAC_MEM_SHARED_WRITE_FROM_PTR(pIn->b, &pCurve->b);
+        LAC_MEM_SHARED_WRITE_FROM_PTR(pIn->h, &pCurve->h);
+        internalMemInList[LAC_IDX_OF(
+            icp_qat_fw_maths_point_multiplication_gfp_l256_input_t, q)] =
+            CPA_TRUE;
+        internalMemInList[LAC_IDX_OF(
+            icp_qat_fw_maths_point_multiplication_gfp_l256_input_t, a)] =
+            CPA_TRUE;
+        internalMemInList[LAC_IDX_OF(
+            icp_qat_fw_maths_point_multiplication_gfp_l256_input_t, b)] =
+            CPA_TRUE;
+        internalMemInList[LAC_IDX_OF(
+            icp_qat_fw_maths_point_multiplication_gfp_l256_input_t, h)] =
+            CPA_TRUE;
+        if ((NULL == pOpData->x.pData) && (NULL == pOpData->y.pData))
+        {
+            LAC_MEM_SHARED_WRITE_FROM_PTR(pIn->xg, &pCurve->xg);
+            LAC_MEM_SHARED_WRITE_FROM_PTR(pIn->yg, &pCurve->yg);
+            internalMemInList[LAC_IDX_OF(
+                icp_qat_fw_maths_point_multiplication_gfp_l256_input_t, xg)] =
+                CPA_TRUE;
+            internalMemInList[LAC_IDX_OF(
+                icp_qat_fw_maths_point_multiplication_gfp_l256_input_t, yg)] =
+                CPA_TRUE;
+        }
+        else
+        {
+            LAC_MEM_SHARED_WRITE_FROM_PTR(pIn->xg, &pOpData->x);
+            LAC_MEM_SHARED_WRITE_FROM_PTR(pIn->yg, &pOpData->y);
+        }
+        LAC_MEM_SHARED_WRITE_FROM_PTR(pOut->xk, pXk);
+        LAC_MEM_SHARED_WRITE_FROM_PTR(pOut->yk, pYk);
+
+        LAC_ECC_TIMESTAMP_BEGIN(
+            &cbData, LAC_ECC_POINT_MULTIPLY_REQUEST, instanceHandle);
+
+        /* send a PKE request to the QAT */
+        status = LacPke_SendSingleRequest(pCurve->pointMultiplyFunctionID,
+                                          inArgSizeList,
+                                          outArgSizeList,
+                                          &in,
+                                          &out,
+                                          internalMemInList,
+                                          internalMemOutList,
+                                          LacEc_PointMultiplyCallback,
+                                          &cbData,
+                                          instanceHandle);
+    }
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+
+    /* increment stats */
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        LAC_EC_STAT_INC(numEcPointMultiplyRequests, pCryptoService);
+    }
+    else
+    {
+        LAC_EC_STAT_INC(numEcPointMultiplyRequestErrors, pCryptoService);
+    }
+
+    return status;
+}
+
 /**
  ***************************************************************************
  * @ingroup Lac_Ec
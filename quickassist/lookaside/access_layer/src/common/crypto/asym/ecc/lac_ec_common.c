@@ -91,6 +91,7 @@
 
 /* FW includes */
 #include "icp_qat_fw_la.h"
+#include "icp_qat_fw_mmp_ids.h"
 
 /* Look Aside Includes */
 #include "lac_common.h"
@@ -107,6 +108,7 @@
 #include "lac_ec.h"
 #include "lac_sal.h"
 #include "lac_sal_ctrl.h"
+#include "sal_service_state.h"
 
 #include "lac_ec_nist_curves.h"
 
@@ -117,25 +119,87 @@
 #define LAC_EC_ALL_STATS_CLEAR(pCryptoService)                                 \
     do                                                                         \
     {                                                                          \
-        Cpa32U i = 0;                                                          \
-                                                                               \
-        for (i = 0; i < LAC_EC_NUM_STATS; i++)                                 \
-        {                                                                      \
-            osalAtomicSet(0, &pCryptoService->pLacEcStatsArr[i]);              \
-        }                                                                      \
-        for (i = 0; i < LAC_ECDH_NUM_STATS; i++)                               \
-        {                                                                      \
-            osalAtomicSet(0, &pCryptoService->pLacEcdhStatsArr[i]);            \
-        }                                                                      \
-        for (i = 0; i < LAC_ECDSA_NUM_STATS; i++)                              \
-        {                                                                      \
-            osalAtomicSet(0, &pCryptoService->pLacEcdsaStatsArr[i]);           \
-        }                                                                      \
+        LacStats_Reset(&pCryptoService->lacEcStats);                           \
+        LacStats_Reset(&pCryptoService->lacEcdhStats);                         \
+        LacStats_Reset(&pCryptoService->lacEcdsaStats);                        \
     } while (0)
 /**< @ingroup Lac_Ec
- * macro to initialize all EC stats (stored in internal array of atomics)
+ * macro to initialize all EC stats (stored in sharded stats)
  * assumes pCryptoService has already been validated */
 
+/**< @ingroup Lac_Ec
+ * size of the cofactor of a named curve: the 521 bit services take it as a
+ * single quadword */
+#define LAC_EC_NAMED_CURVE_H_SIZE(sizeBytes)                                   \
+    ((LAC_EC_SIZE_QW9_IN_BYTES == (sizeBytes)) ? LAC_QUAD_WORD_IN_BYTES       \
+                                               : (sizeBytes))
+
+/**< @ingroup Lac_Ec
+ * a curve parameter table and its length */
+#define LAC_EC_NAMED_CURVE_PARAM(table) table, sizeof(table)
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      Description of a named curve
+ ***************************************************************************/
+typedef struct lac_ec_named_curve_desc_s
+{
+    Cpa32U sizeBytes;
+    /**< operand size of the PKE services of the curve */
+    Cpa32U pointMultiplyFunctionID;
+    Cpa32U signRSFunctionID;
+    Cpa32U verifyFunctionID;
+    /**< PKE services for the curve */
+    const Cpa8U *pQ;
+    Cpa32U qLen;
+    const Cpa8U *pA;
+    Cpa32U aLen;
+    const Cpa8U *pB;
+    Cpa32U bLen;
+    const Cpa8U *pN;
+    Cpa32U nLen;
+    const Cpa8U *pXg;
+    Cpa32U xgLen;
+    const Cpa8U *pYg;
+    Cpa32U ygLen;
+    /**< curve parameters, without padding */
+} lac_ec_named_curve_desc_t;
+
+/* Named curves, indexed by icp_sal_ec_curve_t */
+STATIC const lac_ec_named_curve_desc_t
+    lacEcNamedCurveDescs[ICP_SAL_EC_CURVE_NUM] = {
+        {LAC_EC_SIZE_QW4_IN_BYTES,
+         MATHS_POINT_MULTIPLICATION_GFP_L256,
+         PKE_ECDSA_SIGN_RS_GFP_L256,
+         PKE_ECDSA_VERIFY_GFP_L256,
+         LAC_EC_NAMED_CURVE_PARAM(nist_p256_q),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p256_a),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p256_b),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p256_r),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p256_gx),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p256_gy)},
+        {LAC_EC_SIZE_QW8_IN_BYTES,
+         MATHS_POINT_MULTIPLICATION_GFP_L512,
+         PKE_ECDSA_SIGN_RS_GFP_L512,
+         PKE_ECDSA_VERIFY_GFP_L512,
+         LAC_EC_NAMED_CURVE_PARAM(nist_p384_q),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p384_a),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p384_b),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p384_r),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p384_gx),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p384_gy)},
+        {LAC_EC_SIZE_QW9_IN_BYTES,
+         MATHS_POINT_MULTIPLICATION_GFP_521,
+         PKE_ECDSA_SIGN_RS_GFP_521,
+         PKE_ECDSA_VERIFY_GFP_521,
+         LAC_EC_NAMED_CURVE_PARAM(nist_p521_q),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p521_a),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p521_b),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p521_r),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p521_gx),
+         LAC_EC_NAMED_CURVE_PARAM(nist_p521_gy)}};
+
 /**
  ***************************************************************************
  * @ingroup Lac_Ec
@@ -149,19 +213,18 @@ CpaStatus LacEc_Init(CpaInstanceHandle instanceHandle)
 
     pCryptoService = (sal_crypto_service_t *)instanceHandle;
 
-    status = LAC_OS_MALLOC(&(pCryptoService->pLacEcStatsArr),
-                           LAC_EC_NUM_STATS * sizeof(OsalAtomic));
+    status = LacStats_Init(&pCryptoService->lacEcStats, LAC_EC_NUM_STATS);
 
     if (CPA_STATUS_SUCCESS == status)
     {
-        status = LAC_OS_MALLOC(&(pCryptoService->pLacEcdhStatsArr),
-                               LAC_ECDH_NUM_STATS * sizeof(OsalAtomic));
+        status =
+            LacStats_Init(&pCryptoService->lacEcdhStats, LAC_ECDH_NUM_STATS);
     }
 
     if (CPA_STATUS_SUCCESS == status)
     {
-        status = LAC_OS_MALLOC(&(pCryptoService->pLacEcdsaStatsArr),
-                               LAC_ECDSA_NUM_STATS * sizeof(OsalAtomic));
+        status =
+            LacStats_Init(&pCryptoService->lacEcdsaStats, LAC_ECDSA_NUM_STATS);
     }
 
     /* initialize stats to zero */
@@ -170,6 +233,11 @@ CpaStatus LacEc_Init(CpaInstanceHandle instanceHandle)
         LAC_EC_ALL_STATS_CLEAR(pCryptoService);
     }
 
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = LacEc_NamedCurvesInit(instanceHandle);
+    }
+
     return status;
 }
 
@@ -178,20 +246,9 @@ void LacEc_StatsFree(CpaInstanceHandle instanceHandle)
     sal_crypto_service_t *pCryptoService = NULL;
     pCryptoService = (sal_crypto_service_t *)instanceHandle;
 
-    if (NULL != pCryptoService->pLacEcStatsArr)
-    {
-        LAC_OS_FREE(pCryptoService->pLacEcStatsArr);
-    }
-
-    if (NULL != pCryptoService->pLacEcdhStatsArr)
-    {
-        LAC_OS_FREE(pCryptoService->pLacEcdhStatsArr);
-    }
-
-    if (NULL != pCryptoService->pLacEcdsaStatsArr)
-    {
-        LAC_OS_FREE(pCryptoService->pLacEcdsaStatsArr);
-    }
+    LacStats_Free(&pCryptoService->lacEcStats);
+    LacStats_Free(&pCryptoService->lacEcdhStats);
+    LacStats_Free(&pCryptoService->lacEcdsaStats);
 }
 
 /**
@@ -1226,3 +1283,190 @@ CpaStatus LacEc_GetRange(Cpa32U size, Cpa32U *pMax)
 
     return status;
 }
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      Pads a curve parameter into pMem and points pBuff at it
+ ***************************************************************************/
+STATIC void LacEc_NamedCurveParamSet(CpaFlatBuffer *pBuff,
+                                     Cpa8U *pMem,
+                                     const Cpa8U *pValue,
+                                     Cpa32U valueLen,
+                                     Cpa32U sizeBytes)
+{
+    osalMemSet(pMem, 0, sizeBytes - valueLen);
+    memcpy(pMem + sizeBytes - valueLen, pValue, valueLen);
+    pBuff->pData = pMem;
+    pBuff->dataLenInBytes = sizeBytes;
+}
+
+CpaStatus LacEc_NamedCurvesInit(CpaInstanceHandle instanceHandle)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+    const lac_ec_named_curve_desc_t *pDesc = NULL;
+    lac_ec_named_curve_t *pCurve = NULL;
+    Cpa32U curvesSizeBytes = LAC_ALIGN_POW2_ROUNDUP(
+        ICP_SAL_EC_CURVE_NUM * sizeof(lac_ec_named_curve_t),
+        LAC_64BYTE_ALIGNMENT);
+    Cpa32U totalSizeBytes = curvesSizeBytes;
+    Cpa32U sizeBytes = 0;
+    Cpa32U minBytes = 0;
+    Cpa8U *pMem = NULL;
+    Cpa32U i = 0;
+
+    /* The structures are followed by the Sign RS and Verify parameters and
+     * the cofactor of each curve */
+    for (i = 0; i < ICP_SAL_EC_CURVE_NUM; i++)
+    {
+        sizeBytes = lacEcNamedCurveDescs[i].sizeBytes;
+        totalSizeBytes += (2 * LAC_EC_NAMED_CURVE_NUM_PARAMS * sizeBytes) +
+                          LAC_EC_NAMED_CURVE_H_SIZE(sizeBytes);
+    }
+
+    status = LAC_OS_CAMALLOC(&pCryptoService->pEcNamedCurves,
+                             totalSizeBytes,
+                             LAC_64BYTE_ALIGNMENT,
+                             pCryptoService->nodeAffinity);
+    LAC_CHECK_STATUS(status);
+    osalMemSet(pCryptoService->pEcNamedCurves, 0, totalSizeBytes);
+
+    pMem = (Cpa8U *)pCryptoService->pEcNamedCurves + curvesSizeBytes;
+    for (i = 0; i < ICP_SAL_EC_CURVE_NUM; i++)
+    {
+        pDesc = &lacEcNamedCurveDescs[i];
+        pCurve = &pCryptoService->pEcNamedCurves[i];
+        sizeBytes = pDesc->sizeBytes;
+
+        pCurve->sizeBytes = sizeBytes;
+        pCurve->pointMultiplyFunctionID = pDesc->pointMultiplyFunctionID;
+        pCurve->signRSFunctionID = pDesc->signRSFunctionID;
+        pCurve->verifyFunctionID = pDesc->verifyFunctionID;
+
+        /* Sign RS order b, a, q, n, yg, xg */
+        pCurve->pSignRSParams = pMem;
+        LacEc_NamedCurveParamSet(
+            &pCurve->b, pMem, pDesc->pB, pDesc->bLen, sizeBytes);
+        pMem += sizeBytes;
+        LacEc_NamedCurveParamSet(
+            &pCurve->a, pMem, pDesc->pA, pDesc->aLen, sizeBytes);
+        pMem += sizeBytes;
+        LacEc_NamedCurveParamSet(
+            &pCurve->q, pMem, pDesc->pQ, pDesc->qLen, sizeBytes);
+        pMem += sizeBytes;
+        LacEc_NamedCurveParamSet(
+            &pCurve->n, pMem, pDesc->pN, pDesc->nLen, sizeBytes);
+        pMem += sizeBytes;
+        LacEc_NamedCurveParamSet(
+            &pCurve->yg, pMem, pDesc->pYg, pDesc->ygLen, sizeBytes);
+        pMem += sizeBytes;
+        LacEc_NamedCurveParamSet(
+            &pCurve->xg, pMem, pDesc->pXg, pDesc->xgLen, sizeBytes);
+        pMem += sizeBytes;
+
+        /* Verify order q, b, a, then yg, xg, n */
+        pCurve->pVerifyParams = pMem;
+        memcpy(pMem, pCurve->q.pData, sizeBytes);
+        pMem += sizeBytes;
+        memcpy(pMem, pCurve->b.pData, sizeBytes);
+        pMem += sizeBytes;
+        memcpy(pMem, pCurve->a.pData, sizeBytes);
+        pMem += sizeBytes;
+        memcpy(pMem, pCurve->yg.pData, sizeBytes);
+        pMem += sizeBytes;
+        memcpy(pMem, pCurve->xg.pData, sizeBytes);
+        pMem += sizeBytes;
+        memcpy(pMem, pCurve->n.pData, sizeBytes);
+        pMem += sizeBytes;
+
+        /* NIST prime curves have a cofactor of 1 */
+        pCurve->h.pData = pMem;
+        pCurve->h.dataLenInBytes = LAC_EC_NAMED_CURVE_H_SIZE(sizeBytes);
+        pMem[pCurve->h.dataLenInBytes - 1] = 1;
+        pMem += pCurve->h.dataLenInBytes;
+
+        pCurve->minOutputSizeBytes = LacPke_GetMinBytes(&pCurve->q);
+        minBytes = LacPke_GetMinBytes(&pCurve->n);
+        if (minBytes > pCurve->minOutputSizeBytes)
+        {
+            pCurve->minOutputSizeBytes = minBytes;
+        }
+    }
+
+    return status;
+}
+
+void LacEc_NamedCurvesFree(CpaInstanceHandle instanceHandle)
+{
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+
+    LAC_OS_CAFREE(pCryptoService->pEcNamedCurves);
+}
+
+CpaStatus LacEc_NamedCurveCheck(CpaInstanceHandle instanceHandle,
+                                icp_sal_ec_curve_handle_t hCurve)
+{
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+    LAC_ARCH_UINT first = (LAC_ARCH_UINT)pCryptoService->pEcNamedCurves;
+    LAC_ARCH_UINT last =
+        first + (ICP_SAL_EC_CURVE_NUM - 1) * sizeof(lac_ec_named_curve_t);
+    LAC_ARCH_UINT curve = (LAC_ARCH_UINT)hCurve;
+
+    /* The handle must be one of the structures of this instance */
+    if ((NULL == pCryptoService->pEcNamedCurves) || (curve < first) ||
+        (curve > last) ||
+        (0 != (curve - first) % sizeof(lac_ec_named_curve_t)))
+    {
+        LAC_INVALID_PARAM_LOG("Invalid curve handle");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *
+ ***************************************************************************/
+CpaStatus icp_sal_CyEcCurveHandleGet(const CpaInstanceHandle instanceHandle_in,
+                                     icp_sal_ec_curve_t curve,
+                                     icp_sal_ec_curve_handle_t *phCurve)
+{
+    CpaInstanceHandle instanceHandle = NULL;
+    sal_crypto_service_t *pCryptoService = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    LAC_CHECK_NULL_PARAM(phCurve);
+#endif
+    SAL_RUNNING_CHECK(instanceHandle);
+#ifdef ICP_PARAM_CHECK
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+    if ((Cpa32U)curve >= ICP_SAL_EC_CURVE_NUM)
+    {
+        LAC_INVALID_PARAM_LOG("Invalid curve");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+    *phCurve = &pCryptoService->pEcNamedCurves[curve];
+
+    return CPA_STATUS_SUCCESS;
+}
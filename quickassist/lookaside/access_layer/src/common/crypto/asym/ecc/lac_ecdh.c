@@ -128,14 +128,13 @@
         if (CPA_TRUE ==                                                        \
             pCryptoService->generic_service_info.stats->bEccStatsEnabled)      \
         {                                                                      \
-            osalAtomicInc(                                                     \
-                &pCryptoService->pLacEcdhStatsArr[offsetof(CpaCyEcdhStats64,   \
-                                                           statistic) /        \
-                                                  sizeof(Cpa64U)]);            \
+            LacStats_Inc(&pCryptoService->lacEcdhStats,                        \
+                         offsetof(CpaCyEcdhStats64, statistic) /               \
+                             sizeof(Cpa64U));                                  \
         }                                                                      \
     } while (0)
 /**< @ingroup Lac_Ecdh
- * macro to increment a ECDH stat (derives offset into array of atomics) */
+ * macro to increment a ECDH stat (derives offset into the sharded stats) */
 #else
 #define LAC_ECDH_STAT_INC(statistic, pCryptoService)                           \
     do                                                                         \
@@ -151,7 +150,7 @@
         for (i = 0; i < LAC_ECDH_NUM_STATS; i++)                               \
         {                                                                      \
             ((Cpa64U *)&(ecdhStats))[i] =                                      \
-                osalAtomicGet(&pCryptoService->pLacEcdhStatsArr[i]);           \
+                LacStats_Get(&pCryptoService->lacEcdhStats, i);                \
         }                                                                      \
     } while (0)
 /**< @ingroup Lac_Ecdh
@@ -174,7 +173,7 @@ void LacEcdh_StatsEnd(void *pCbData, CpaInstanceHandle instanceHandle);
 #endif
 
 /**< @ingroup Lac_Ecdh
- * macro to get all ECDH stats (from internal array of atomics) */
+ * macro to get all ECDH stats (summed over the stats shards) */
 
 #define LacEcdhPointMultiplyOpDataWrite(in, out, pOpData, pXk, pYk)            \
     do                                                                         \
@@ -867,6 +866,7 @@ CpaStatus cpaCyEcdhPointMultiply(const CpaInstanceHandle instanceHandle_in,
                                               &outPointVerify,
                                               internalMemInListVerify,
                                               NULL,
+                                              NULL,
                                               LacEcdh_PointMultiplyCallback,
                                               &cbData,
                                               instanceHandle);
@@ -883,6 +883,7 @@ CpaStatus cpaCyEcdhPointMultiply(const CpaInstanceHandle instanceHandle_in,
                                           &outPointMultiply,
                                           internalMemInListMultiply,
                                           internalMemOutListMultiply,
+                                          NULL,
                                           LacEcdh_PointMultiplyCallback,
                                           &cbData,
                                           instanceHandle);
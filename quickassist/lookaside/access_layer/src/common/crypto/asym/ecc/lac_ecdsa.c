@@ -108,6 +108,7 @@
 /* API Includes */
 #include "cpa.h"
 #include "cpa_cy_ecdsa.h"
+#include "icp_sal_asym_batch.h"
 
 /* OSAL Includes */
 #include "Osal.h"
@@ -131,6 +132,7 @@
 #include "lac_mem_pools.h"
 #include "lac_pke_utils.h"
 #include "lac_pke_qat_comms.h"
+#include "lac_pke_profile.h"
 #include "lac_sync.h"
 #include "lac_ec.h"
 #include "lac_sym.h"
@@ -174,14 +176,13 @@
         if (CPA_TRUE ==                                                        \
             pCryptoService->generic_service_info.stats->bEccStatsEnabled)      \
         {                                                                      \
-            osalAtomicInc(                                                     \
-                &pCryptoService->pLacEcdsaStatsArr[offsetof(CpaCyEcdsaStats64, \
-                                                            statistic) /       \
-                                                   sizeof(Cpa64U)]);           \
+            LacStats_Inc(&pCryptoService->lacEcdsaStats,                       \
+                         offsetof(CpaCyEcdsaStats64, statistic) /              \
+                             sizeof(Cpa64U));                                  \
         }                                                                      \
     } while (0)
 /**< @ingroup Lac_Ec
- * macro to increment a ECDSA stat (derives offset into array of atomics) */
+ * macro to increment a ECDSA stat (derives offset into the sharded stats) */
 #else
 #define LAC_ECDSA_STAT_INC(statistic, pCryptoService)                          \
     (pCryptoService) = (pCryptoService)
@@ -195,7 +196,7 @@
         for (i = 0; i < LAC_ECDSA_NUM_STATS; i++)                              \
         {                                                                      \
             ((Cpa64U *)&(ecdsaStats))[i] =                                     \
-                osalAtomicGet(&pCryptoService->pLacEcdsaStatsArr[i]);          \
+                LacStats_Get(&pCryptoService->lacEcdsaStats, i);               \
         }                                                                      \
     } while (0)
 /**< @ingroup Lac_Ec
@@ -222,7 +223,7 @@ void LacEcdsa_StatsEnd(void *pCbData,
 #define LAC_ECDSA_TIMESTAMP_END(pCbData, OperationDir, instanceHandle)
 #endif
 /**< @ingroup Lac_Ec
- * macro to get all ECDSA stats (from internal array of atomics) */
+ * macro to get all ECDSA stats (summed over the stats shards) */
 
 #define LacEcdsaSignROpDataWrite(in, out, pOpData, pR)                         \
     do                                                                         \
@@ -1589,20 +1590,47 @@ CpaStatus LacEcdsa_SignRSBasicParamCheck(const CpaInstanceHandle instanceHandle,
 /**
  ***************************************************************************
  * @ingroup Lac_Ec
- *
+ *      Gets the MMP operand size of an ECDSA Sign R & S operation
  ***************************************************************************/
-CpaStatus cpaCyEcdsaSignRS(const CpaInstanceHandle instanceHandle_in,
-                           const CpaCyEcdsaSignRSCbFunc pCb,
-                           void *pCallbackTag,
-                           const CpaCyEcdsaSignRSOpData *pOpData,
-                           CpaBoolean *pMultiplyStatus,
-                           CpaFlatBuffer *pR,
-                           CpaFlatBuffer *pS)
+STATIC CpaStatus LacEcdsa_SignRSSizeGet(const CpaCyEcdsaSignRSOpData *pOpData,
+                                        Cpa32U *pDataOperationSizeBytes)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    /* Determine size */
+    status = LacEc_GetRange(LacEcdsa_SignRSOpDataSizeGetMax(pOpData),
+                            pDataOperationSizeBytes);
+    if ((CPA_STATUS_SUCCESS == status) &&
+        (LAC_EC_SIZE_QW4_IN_BYTES == *pDataOperationSizeBytes) &&
+        (CPA_CY_EC_FIELD_TYPE_BINARY == pOpData->fieldType))
+    {
+        /* Check if it is a NIST curve if not use 8QW */
+        LacEc_CheckCurve4QWGF2(pDataOperationSizeBytes,
+                               &(pOpData->q),
+                               &(pOpData->a),
+                               &(pOpData->b),
+                               &(pOpData->n),
+                               NULL);
+    }
+
+    return status;
+}
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      Checks the parameters of an ECDSA Sign R & S operation and gets its
+ *      MMP operand size
+ ***************************************************************************/
+STATIC CpaStatus LacEcdsa_SignRSCheck(const CpaInstanceHandle instanceHandle,
+                                      const CpaCyEcdsaSignRSOpData *pOpData,
+                                      CpaBoolean *pMultiplyStatus,
+                                      CpaFlatBuffer *pR,
+                                      CpaFlatBuffer *pS,
+                                      Cpa32U *pDataOperationSizeBytes)
 {
     CpaStatus status = CPA_STATUS_SUCCESS;
     Cpa32U dataOperationSizeBytes = 0;
-    CpaInstanceHandle instanceHandle = NULL;
-    sal_crypto_service_t *pCryptoService = NULL;
 #ifdef ICP_PARAM_CHECK
     Cpa32S compare = 0;
     Cpa32U bit_pos_q = 0, bit_pos_x = 0, bit_pos_y = 0;
@@ -1610,59 +1638,13 @@ CpaStatus cpaCyEcdsaSignRS(const CpaInstanceHandle instanceHandle_in,
     Cpa32U maxModLen = 0;
     CpaBoolean isZero = CPA_FALSE;
 #endif
-
-    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
-    {
-        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
-    }
-    else
-    {
-        instanceHandle = instanceHandle_in;
-    }
-
-#ifdef ICP_PARAM_CHECK
-    /* instance checks - if fail, no inc stats just return */
-    /* check for valid acceleration handle */
-    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
-    SAL_CHECK_ADDR_TRANS_SETUP(instanceHandle);
-#endif
-    /* ensure LAC is initialised - return error if not */
-    SAL_RUNNING_CHECK(instanceHandle);
-#ifdef ICP_PARAM_CHECK
-    /* ensure this is a crypto or asym instance with pke enabled */
-    SAL_CHECK_INSTANCE_TYPE(
-        instanceHandle,
-        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
-#endif
-
-    /* Check if the API has been called in synchronous mode */
-    if (NULL == pCb)
-    {
-#ifdef ICP_TRACE
-#ifdef ICP_PARAM_CHECK
-        /* Check for valid pointers */
-        LAC_CHECK_NULL_PARAM(pMultiplyStatus);
-#endif
-        status = LacEcdsa_SignRSSyn(
-            instanceHandle, pOpData, pMultiplyStatus, pR, pS);
-
-        LAC_LOG7("Called with params (0x%lx, 0x%lx, 0x%lx, 0x%lx, "
-                 "%d, 0x%lx, 0x%lx)\n",
-                 (LAC_ARCH_UINT)instanceHandle_in,
-                 (LAC_ARCH_UINT)pCb,
-                 (LAC_ARCH_UINT)pCallbackTag,
-                 (LAC_ARCH_UINT)pOpData,
-                 *pMultiplyStatus,
-                 (LAC_ARCH_UINT)pR,
-                 (LAC_ARCH_UINT)pS);
-        return status;
-#else
-        /* Call synchronous mode function */
-        return LacEcdsa_SignRSSyn(
-            instanceHandle, pOpData, pMultiplyStatus, pR, pS);
+#ifdef ICP_PKE_PROFILE
+    Cpa64U checkStart = 0;
+    Cpa64U curveStart = 0;
+    Cpa64U curveEnd = 0;
 #endif
-    }
 
+    LAC_PKE_PROFILE_TIMESTAMP(checkStart);
 #ifdef ICP_PARAM_CHECK
     /* Basic Param Checking */
     status = LacEcdsa_SignRSBasicParamCheck(
@@ -1681,27 +1663,10 @@ CpaStatus cpaCyEcdsaSignRS(const CpaInstanceHandle instanceHandle_in,
     }
 #endif
 
-    pCryptoService = (sal_crypto_service_t *)instanceHandle;
-
-    if (CPA_STATUS_SUCCESS == status)
-    {
-        /* Determine size */
-        status = LacEc_GetRange(LacEcdsa_SignRSOpDataSizeGetMax(pOpData),
-                                &dataOperationSizeBytes);
-    }
+    LAC_PKE_PROFILE_TIMESTAMP(curveStart);
     if (CPA_STATUS_SUCCESS == status)
     {
-        if ((LAC_EC_SIZE_QW4_IN_BYTES == dataOperationSizeBytes) &&
-            (CPA_CY_EC_FIELD_TYPE_BINARY == pOpData->fieldType))
-        {
-            /* Check if it is a NIST curve if not use 8QW */
-            LacEc_CheckCurve4QWGF2(&dataOperationSizeBytes,
-                                   &(pOpData->q),
-                                   &(pOpData->a),
-                                   &(pOpData->b),
-                                   &(pOpData->n),
-                                   NULL);
-        }
+        status = LacEcdsa_SignRSSizeGet(pOpData, &dataOperationSizeBytes);
     }
 
 #ifdef ICP_PARAM_CHECK
@@ -1734,6 +1699,9 @@ CpaStatus cpaCyEcdsaSignRS(const CpaInstanceHandle instanceHandle_in,
                                             &(pOpData->yg));
         }
     }
+#endif
+    LAC_PKE_PROFILE_TIMESTAMP(curveEnd);
+#ifdef ICP_PARAM_CHECK
 
     if (CPA_STATUS_SUCCESS == status)
     {
@@ -1826,205 +1794,365 @@ CpaStatus cpaCyEcdsaSignRS(const CpaInstanceHandle instanceHandle_in,
     }
 #endif
 
+#ifdef ICP_PKE_PROFILE
     if (CPA_STATUS_SUCCESS == status)
     {
-        Cpa8U *pMemPoolConcate = NULL;
-        Cpa8U *pConcateTemp = NULL;
-        CpaFlatBuffer *pInBuff = NULL;
+        LacPke_ProfileAdd(instanceHandle,
+                          ICP_SAL_PKE_PROFILE_CURVE_CHECK,
+                          curveEnd - curveStart);
+        LacPke_ProfileAdd(instanceHandle,
+                          ICP_SAL_PKE_PROFILE_PARAM_CHECK,
+                          LacPke_ProfileTimestamp() - checkStart -
+                              (curveEnd - curveStart));
+    }
+#endif
 
-        icp_qat_fw_mmp_input_param_t inRS = {.flat_array = {0}};
-        icp_qat_fw_mmp_output_param_t outRS = {.flat_array = {0}};
-        lac_pke_op_cb_data_t cbData = {0};
+    *pDataOperationSizeBytes = dataOperationSizeBytes;
+    return status;
+}
 
-        /* Holding the calculated size of the input/output parameters */
-        Cpa32U inArgSizeList[LAC_MAX_MMP_INPUT_PARAMS] = {0};
-        Cpa32U outArgSizeList[LAC_MAX_MMP_OUTPUT_PARAMS] = {0};
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      Builds an ECDSA Sign R & S request and sends it. If pRequestHandle is
+ *      not NULL the request is only created and the input buffer it owns is
+ *      returned in ppMemPoolConcate, so the caller can free it if it does
+ *      not send the request.
+ ***************************************************************************/
+STATIC CpaStatus
+LacEcdsa_SignRSBuildRequest(const CpaInstanceHandle instanceHandle,
+                            const CpaCyEcdsaSignRSCbFunc pCb,
+                            void *pCallbackTag,
+                            const CpaCyEcdsaSignRSOpData *pOpData,
+                            CpaFlatBuffer *pR,
+                            CpaFlatBuffer *pS,
+                            Cpa32U dataOperationSizeBytes,
+                            lac_pke_request_handle_t *pRequestHandle,
+                            Cpa8U **ppMemPoolConcate)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+    Cpa8U *pMemPoolConcate = NULL;
+    Cpa8U *pConcateTemp = NULL;
+    CpaFlatBuffer *pInBuff = NULL;
 
-        CpaBoolean internalMemInList[LAC_MAX_MMP_INPUT_PARAMS] = {CPA_FALSE};
-        CpaBoolean internalMemOutList[LAC_MAX_MMP_OUTPUT_PARAMS] = {CPA_FALSE};
+    icp_qat_fw_mmp_input_param_t inRS = {.flat_array = {0}};
+    icp_qat_fw_mmp_output_param_t outRS = {.flat_array = {0}};
+    lac_pke_op_cb_data_t cbData = {0};
 
-        Cpa32U functionID = 0;
+    /* Holding the calculated size of the input/output parameters */
+    Cpa32U inArgSizeList[LAC_MAX_MMP_INPUT_PARAMS] = {0};
+    Cpa32U outArgSizeList[LAC_MAX_MMP_OUTPUT_PARAMS] = {0};
 
-        /* clear output buffers */
-        osalMemSet(pR->pData, 0, pR->dataLenInBytes);
-        osalMemSet(pS->pData, 0, pS->dataLenInBytes);
+    CpaBoolean internalMemInList[LAC_MAX_MMP_INPUT_PARAMS] = {CPA_FALSE};
+    CpaBoolean internalMemOutList[LAC_MAX_MMP_OUTPUT_PARAMS] = {CPA_FALSE};
 
-        /* Need to concatenate user inputs - copy to ecc mempool memory */
-        do
+    Cpa32U functionID = 0;
+
+    /* clear output buffers */
+    osalMemSet(pR->pData, 0, pR->dataLenInBytes);
+    osalMemSet(pS->pData, 0, pS->dataLenInBytes);
+
+    /* Need to concatenate user inputs - copy to ecc mempool memory */
+    do
+    {
+        pMemPoolConcate =
+            (Cpa8U *)Lac_MemPoolEntryAlloc(pCryptoService->lac_ec_pool);
+        if (NULL == pMemPoolConcate)
         {
-            pMemPoolConcate =
-                (Cpa8U *)Lac_MemPoolEntryAlloc(pCryptoService->lac_ec_pool);
-            if (NULL == pMemPoolConcate)
+            LAC_LOG_ERROR("Cannot get mem pool entry");
+            status = CPA_STATUS_RESOURCE;
+        }
+        else if ((void *)CPA_STATUS_RETRY == pMemPoolConcate)
+        {
+            osalYield();
+        }
+    } while ((void *)CPA_STATUS_RETRY == pMemPoolConcate);
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        /* Concatenate x,y, n, q, a, b, k, m, d */
+        pConcateTemp = pMemPoolConcate;
+        LacEc_FlatBuffToConcate(
+            &pConcateTemp, &(pOpData->d), dataOperationSizeBytes);
+        LacEc_FlatBuffToConcate(
+            &pConcateTemp, &(pOpData->m), dataOperationSizeBytes);
+        LacEc_FlatBuffToConcate(
+            &pConcateTemp, &(pOpData->k), dataOperationSizeBytes);
+        LacEc_FlatBuffToConcate(
+            &pConcateTemp, &(pOpData->b), dataOperationSizeBytes);
+        LacEc_FlatBuffToConcate(
+            &pConcateTemp, &(pOpData->a), dataOperationSizeBytes);
+        LacEc_FlatBuffToConcate(
+            &pConcateTemp, &(pOpData->q), dataOperationSizeBytes);
+        LacEc_FlatBuffToConcate(
+            &pConcateTemp, &(pOpData->n), dataOperationSizeBytes);
+        LacEc_FlatBuffToConcate(
+            &pConcateTemp, &(pOpData->yg), dataOperationSizeBytes);
+        LacEc_FlatBuffToConcate(
+            &pConcateTemp, &(pOpData->xg), dataOperationSizeBytes);
+        pInBuff = (CpaFlatBuffer *)pConcateTemp;
+        pInBuff->dataLenInBytes =
+            (dataOperationSizeBytes * LAC_ECDSA_SIGNRS_NUM_IN_QA_API);
+        pInBuff->pData = pMemPoolConcate;
+
+        /* populate callback data */
+        cbData.pClientCb = pCb;
+        cbData.pCallbackTag = pCallbackTag;
+        cbData.pClientOpData = pOpData;
+        cbData.pOpaqueData = pMemPoolConcate;
+        cbData.pOutputData1 = pR;
+        cbData.pOutputData2 = pS;
+
+        /* Set the size for all parameters to be padded to */
+        LAC_EC_SET_LIST_PARAMS(
+            inArgSizeList,
+            LAC_ECDSA_SIGNRS_NUM_IN_ARGS,
+            (LAC_ECDSA_SIGNRS_NUM_IN_QA_API * dataOperationSizeBytes));
+        LAC_EC_SET_LIST_PARAMS(outArgSizeList,
+                               LAC_ECDSA_SIGNRS_NUM_OUT_ARGS,
+                               dataOperationSizeBytes);
+        /* Input memory to QAT is internally allocated */
+        LAC_EC_SET_LIST_PARAMS(
+            internalMemInList, LAC_ECDSA_SIGNRS_NUM_IN_ARGS, CPA_TRUE);
+        /* Output memory to QAT is externally allocated */
+        LAC_EC_SET_LIST_PARAMS(
+            internalMemOutList, LAC_ECDSA_SIGNRS_NUM_OUT_ARGS, CPA_FALSE);
+
+        /* Populate input buffers and output buffers and set function IDs */
+        if (CPA_CY_EC_FIELD_TYPE_PRIME == pOpData->fieldType)
+        {
+            switch (dataOperationSizeBytes)
             {
-                LAC_LOG_ERROR("Cannot get mem pool entry");
-                status = CPA_STATUS_RESOURCE;
+                case LAC_EC_SIZE_QW4_IN_BYTES:
+                    LacEcdsaSignRSOpDataWrite(
+                        inRS.mmp_ecdsa_sign_rs_gfp_l256,
+                        outRS.mmp_ecdsa_sign_rs_gfp_l256,
+                        pInBuff,
+                        pR,
+                        pS);
+                    functionID = PKE_ECDSA_SIGN_RS_GFP_L256;
+                    break;
+                case LAC_EC_SIZE_QW8_IN_BYTES:
+                    LacEcdsaSignRSOpDataWrite(
+                        inRS.mmp_ecdsa_sign_rs_gfp_l512,
+                        outRS.mmp_ecdsa_sign_rs_gfp_l512,
+                        pInBuff,
+                        pR,
+                        pS);
+                    functionID = PKE_ECDSA_SIGN_RS_GFP_L512;
+                    break;
+                case LAC_EC_SIZE_QW9_IN_BYTES:
+                    LacEcdsaSignRSOpDataWrite(
+                        inRS.mmp_ecdsa_sign_rs_gfp_521,
+                        outRS.mmp_ecdsa_sign_rs_gfp_521,
+                        pInBuff,
+                        pR,
+                        pS);
+                    functionID = PKE_ECDSA_SIGN_RS_GFP_521;
+                    break;
+                default:
+                    status = CPA_STATUS_INVALID_PARAM;
+                    break;
             }
-            else if ((void *)CPA_STATUS_RETRY == pMemPoolConcate)
+        }
+        else
+        {
+            switch (dataOperationSizeBytes)
             {
-                osalYield();
+                case LAC_EC_SIZE_QW4_IN_BYTES:
+                    LacEcdsaSignRSOpDataWrite(
+                        inRS.mmp_ecdsa_sign_rs_gf2_l256,
+                        outRS.mmp_ecdsa_sign_rs_gf2_l256,
+                        pInBuff,
+                        pR,
+                        pS);
+                    functionID = PKE_ECDSA_SIGN_RS_GF2_L256;
+                    break;
+                case LAC_EC_SIZE_QW8_IN_BYTES:
+                    LacEcdsaSignRSOpDataWrite(
+                        inRS.mmp_ecdsa_sign_rs_gf2_l512,
+                        outRS.mmp_ecdsa_sign_rs_gf2_l512,
+                        pInBuff,
+                        pR,
+                        pS);
+                    functionID = PKE_ECDSA_SIGN_RS_GF2_L512;
+                    break;
+                case LAC_EC_SIZE_QW9_IN_BYTES:
+                    LacEcdsaSignRSOpDataWrite(
+                        inRS.mmp_ecdsa_sign_rs_gf2_571,
+                        outRS.mmp_ecdsa_sign_rs_gf2_571,
+                        pInBuff,
+                        pR,
+                        pS);
+                    functionID = PKE_ECDSA_SIGN_RS_GF2_571;
+                    break;
+                default:
+                    status = CPA_STATUS_INVALID_PARAM;
+                    break;
             }
-        } while ((void *)CPA_STATUS_RETRY == pMemPoolConcate);
+        }
 
+        /* Send pke request */
         if (CPA_STATUS_SUCCESS == status)
         {
-            /* Concatenate x,y, n, q, a, b, k, m, d */
-            pConcateTemp = pMemPoolConcate;
-            LacEc_FlatBuffToConcate(
-                &pConcateTemp, &(pOpData->d), dataOperationSizeBytes);
-            LacEc_FlatBuffToConcate(
-                &pConcateTemp, &(pOpData->m), dataOperationSizeBytes);
-            LacEc_FlatBuffToConcate(
-                &pConcateTemp, &(pOpData->k), dataOperationSizeBytes);
-            LacEc_FlatBuffToConcate(
-                &pConcateTemp, &(pOpData->b), dataOperationSizeBytes);
-            LacEc_FlatBuffToConcate(
-                &pConcateTemp, &(pOpData->a), dataOperationSizeBytes);
-            LacEc_FlatBuffToConcate(
-                &pConcateTemp, &(pOpData->q), dataOperationSizeBytes);
-            LacEc_FlatBuffToConcate(
-                &pConcateTemp, &(pOpData->n), dataOperationSizeBytes);
-            LacEc_FlatBuffToConcate(
-                &pConcateTemp, &(pOpData->yg), dataOperationSizeBytes);
-            LacEc_FlatBuffToConcate(
-                &pConcateTemp, &(pOpData->xg), dataOperationSizeBytes);
-            pInBuff = (CpaFlatBuffer *)pConcateTemp;
-            pInBuff->dataLenInBytes =
-                (dataOperationSizeBytes * LAC_ECDSA_SIGNRS_NUM_IN_QA_API);
-            pInBuff->pData = pMemPoolConcate;
-
-            /* populate callback data */
-            cbData.pClientCb = pCb;
-            cbData.pCallbackTag = pCallbackTag;
-            cbData.pClientOpData = pOpData;
-            cbData.pOpaqueData = pMemPoolConcate;
-            cbData.pOutputData1 = pR;
-            cbData.pOutputData2 = pS;
-
-            /* Set the size for all parameters to be padded to */
-            LAC_EC_SET_LIST_PARAMS(
-                inArgSizeList,
-                LAC_ECDSA_SIGNRS_NUM_IN_ARGS,
-                (LAC_ECDSA_SIGNRS_NUM_IN_QA_API * dataOperationSizeBytes));
-            LAC_EC_SET_LIST_PARAMS(outArgSizeList,
-                                   LAC_ECDSA_SIGNRS_NUM_OUT_ARGS,
-                                   dataOperationSizeBytes);
-            /* Input memory to QAT is internally allocated */
-            LAC_EC_SET_LIST_PARAMS(
-                internalMemInList, LAC_ECDSA_SIGNRS_NUM_IN_ARGS, CPA_TRUE);
-            /* Output memory to QAT is externally allocated */
-            LAC_EC_SET_LIST_PARAMS(
-                internalMemOutList, LAC_ECDSA_SIGNRS_NUM_OUT_ARGS, CPA_FALSE);
+            LAC_ECDSA_TIMESTAMP_BEGIN(
+                &cbData,
+                LAC_ECDSA_SIGN_RS_REQUEST,
+                (sal_crypto_service_t *)instanceHandle);
 
-            /* Populate input buffers and output buffers and set function IDs */
-            if (CPA_CY_EC_FIELD_TYPE_PRIME == pOpData->fieldType)
+            if (NULL == pRequestHandle)
             {
-                switch (dataOperationSizeBytes)
-                {
-                    case LAC_EC_SIZE_QW4_IN_BYTES:
-                        LacEcdsaSignRSOpDataWrite(
-                            inRS.mmp_ecdsa_sign_rs_gfp_l256,
-                            outRS.mmp_ecdsa_sign_rs_gfp_l256,
-                            pInBuff,
-                            pR,
-                            pS);
-                        functionID = PKE_ECDSA_SIGN_RS_GFP_L256;
-                        break;
-                    case LAC_EC_SIZE_QW8_IN_BYTES:
-                        LacEcdsaSignRSOpDataWrite(
-                            inRS.mmp_ecdsa_sign_rs_gfp_l512,
-                            outRS.mmp_ecdsa_sign_rs_gfp_l512,
-                            pInBuff,
-                            pR,
-                            pS);
-                        functionID = PKE_ECDSA_SIGN_RS_GFP_L512;
-                        break;
-                    case LAC_EC_SIZE_QW9_IN_BYTES:
-                        LacEcdsaSignRSOpDataWrite(
-                            inRS.mmp_ecdsa_sign_rs_gfp_521,
-                            outRS.mmp_ecdsa_sign_rs_gfp_521,
-                            pInBuff,
-                            pR,
-                            pS);
-                        functionID = PKE_ECDSA_SIGN_RS_GFP_521;
-                        break;
-                    default:
-                        status = CPA_STATUS_INVALID_PARAM;
-                        break;
-                }
+                /* build a PKE request  */
+                status = LacPke_SendSingleRequest(functionID,
+                                                  inArgSizeList,
+                                                  outArgSizeList,
+                                                  &inRS,
+                                                  &outRS,
+                                                  internalMemInList,
+                                                  internalMemOutList,
+                                                  LacEcdsa_SignRSCallback,
+                                                  &cbData,
+                                                  instanceHandle);
             }
             else
             {
-                switch (dataOperationSizeBytes)
-                {
-                    case LAC_EC_SIZE_QW4_IN_BYTES:
-                        LacEcdsaSignRSOpDataWrite(
-                            inRS.mmp_ecdsa_sign_rs_gf2_l256,
-                            outRS.mmp_ecdsa_sign_rs_gf2_l256,
-                            pInBuff,
-                            pR,
-                            pS);
-                        functionID = PKE_ECDSA_SIGN_RS_GF2_L256;
-                        break;
-                    case LAC_EC_SIZE_QW8_IN_BYTES:
-                        LacEcdsaSignRSOpDataWrite(
-                            inRS.mmp_ecdsa_sign_rs_gf2_l512,
-                            outRS.mmp_ecdsa_sign_rs_gf2_l512,
-                            pInBuff,
-                            pR,
-                            pS);
-                        functionID = PKE_ECDSA_SIGN_RS_GF2_L512;
-                        break;
-                    case LAC_EC_SIZE_QW9_IN_BYTES:
-                        LacEcdsaSignRSOpDataWrite(
-                            inRS.mmp_ecdsa_sign_rs_gf2_571,
-                            outRS.mmp_ecdsa_sign_rs_gf2_571,
-                            pInBuff,
-                            pR,
-                            pS);
-                        functionID = PKE_ECDSA_SIGN_RS_GF2_571;
-                        break;
-                    default:
-                        status = CPA_STATUS_INVALID_PARAM;
-                        break;
-                }
-            }
-
-            /* Send pke request */
-            if (CPA_STATUS_SUCCESS == status)
-            {
-                LAC_ECDSA_TIMESTAMP_BEGIN(
-                    &cbData,
-                    LAC_ECDSA_SIGN_RS_REQUEST,
-                    (sal_crypto_service_t *)instanceHandle);
-
-                /* build a PKE request  */
-                status = LacPke_SendSingleRequest(functionID,
-                                                  inArgSizeList,
-                                                  outArgSizeList,
-                                                  &inRS,
-                                                  &outRS,
-                                                  internalMemInList,
-                                                  internalMemOutList,
-                                                  LacEcdsa_SignRSCallback,
-                                                  &cbData,
-                                                  instanceHandle);
+                /* build a PKE request, the caller sends it */
+                status = LacPke_CreateRequest(pRequestHandle,
+                                              functionID,
+                                              inArgSizeList,
+                                              outArgSizeList,
+                                              &inRS,
+                                              &outRS,
+                                              internalMemInList,
+                                              internalMemOutList,
+                                              NULL,
+                                              LacEcdsa_SignRSCallback,
+                                              &cbData,
+                                              instanceHandle);
             }
+        }
 
-            if (CPA_STATUS_SUCCESS != status)
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            /* Free Mem Pool */
+            if (NULL != pMemPoolConcate)
             {
-                /* Free Mem Pool */
-                if (NULL != pMemPoolConcate)
-                {
-                    Lac_MemPoolEntryFree(pMemPoolConcate);
-                }
+                Lac_MemPoolEntryFree(pMemPoolConcate);
             }
         }
+        else if (NULL != ppMemPoolConcate)
+        {
+            *ppMemPoolConcate = pMemPoolConcate;
+        }
+    }
+
+    return status;
+}
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *
+ ***************************************************************************/
+CpaStatus cpaCyEcdsaSignRS(const CpaInstanceHandle instanceHandle_in,
+                           const CpaCyEcdsaSignRSCbFunc pCb,
+                           void *pCallbackTag,
+                           const CpaCyEcdsaSignRSOpData *pOpData,
+                           CpaBoolean *pMultiplyStatus,
+                           CpaFlatBuffer *pR,
+                           CpaFlatBuffer *pS)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa32U dataOperationSizeBytes = 0;
+    CpaInstanceHandle instanceHandle = NULL;
+    sal_crypto_service_t *pCryptoService = NULL;
+#ifdef ICP_PKE_PROFILE
+    Cpa64U timeStamp = 0;
+#endif
+
+    LAC_PKE_PROFILE_TIMESTAMP(timeStamp);
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    /* instance checks - if fail, no inc stats just return */
+    /* check for valid acceleration handle */
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_ADDR_TRANS_SETUP(instanceHandle);
+#endif
+    /* ensure LAC is initialised - return error if not */
+    SAL_RUNNING_CHECK(instanceHandle);
+#ifdef ICP_PARAM_CHECK
+    /* ensure this is a crypto or asym instance with pke enabled */
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+#endif
+
+    /* Check if the API has been called in synchronous mode */
+    if (NULL == pCb)
+    {
+#ifdef ICP_TRACE
+#ifdef ICP_PARAM_CHECK
+        /* Check for valid pointers */
+        LAC_CHECK_NULL_PARAM(pMultiplyStatus);
+#endif
+        status = LacEcdsa_SignRSSyn(
+            instanceHandle, pOpData, pMultiplyStatus, pR, pS);
+
+        LAC_LOG7("Called with params (0x%lx, 0x%lx, 0x%lx, 0x%lx, "
+                 "%d, 0x%lx, 0x%lx)\n",
+                 (LAC_ARCH_UINT)instanceHandle_in,
+                 (LAC_ARCH_UINT)pCb,
+                 (LAC_ARCH_UINT)pCallbackTag,
+                 (LAC_ARCH_UINT)pOpData,
+                 *pMultiplyStatus,
+                 (LAC_ARCH_UINT)pR,
+                 (LAC_ARCH_UINT)pS);
+        return status;
+#else
+        /* Call synchronous mode function */
+        return LacEcdsa_SignRSSyn(
+            instanceHandle, pOpData, pMultiplyStatus, pR, pS);
+#endif
+    }
+
+    status = LacEcdsa_SignRSCheck(instanceHandle,
+                                  pOpData,
+                                  pMultiplyStatus,
+                                  pR,
+                                  pS,
+                                  &dataOperationSizeBytes);
+
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = LacEcdsa_SignRSBuildRequest(instanceHandle,
+                                             pCb,
+                                             pCallbackTag,
+                                             pOpData,
+                                             pR,
+                                             pS,
+                                             dataOperationSizeBytes,
+                                             NULL,
+                                             NULL);
     }
 
     if (CPA_STATUS_SUCCESS == status)
     {
         /* increment stats */
         LAC_ECDSA_STAT_INC(numEcdsaSignRSRequests, pCryptoService);
+        LAC_PKE_PROFILE_END(
+            instanceHandle, ICP_SAL_PKE_PROFILE_SUBMIT, timeStamp);
     }
     else
     {
@@ -2035,6 +2163,174 @@ CpaStatus cpaCyEcdsaSignRS(const CpaInstanceHandle instanceHandle_in,
     return status;
 }
 
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *
+ ***************************************************************************/
+CpaStatus icp_sal_CyEcdsaSignRSBatch(
+    const CpaInstanceHandle instanceHandle_in,
+    const CpaCyEcdsaSignRSCbFunc pCb,
+    Cpa32U numRequests,
+    icp_sal_ecdsa_sign_rs_batch_op_data_t *pBatchOpData,
+    Cpa32U *pNumSubmitted)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaStatus sendStatus = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    sal_crypto_service_t *pCryptoService = NULL;
+    icp_sal_ecdsa_sign_rs_batch_op_data_t *pEntry = NULL;
+    lac_pke_request_handle_t requestHandles[LAC_PKE_SEND_BURST_SIZE];
+    Cpa8U *pMemPoolConcates[LAC_PKE_SEND_BURST_SIZE];
+    CpaBoolean multiplyStatus = CPA_FALSE;
+    Cpa32U dataOperationSizeBytes = 0;
+    Cpa32U numDone = 0;
+    Cpa32U numMsgs = 0;
+    Cpa32U numBuilt = 0;
+    Cpa32U numSent = 0;
+    Cpa32U i = 0;
+
+#ifdef ICP_TRACE
+    LAC_LOG5("Called with params (0x%lx, 0x%lx, %u, 0x%lx, 0x%lx)\n",
+             (LAC_ARCH_UINT)instanceHandle_in,
+             (LAC_ARCH_UINT)pCb,
+             numRequests,
+             (LAC_ARCH_UINT)pBatchOpData,
+             (LAC_ARCH_UINT)pNumSubmitted);
+#endif
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_ADDR_TRANS_SETUP(instanceHandle);
+#endif
+    SAL_RUNNING_CHECK(instanceHandle);
+#ifdef ICP_PARAM_CHECK
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+    LAC_CHECK_NULL_PARAM(pBatchOpData);
+    LAC_CHECK_NULL_PARAM(pNumSubmitted);
+
+    if (0 == numRequests)
+    {
+        LAC_INVALID_PARAM_LOG("Invalid numRequests value");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    /* There is no synchronous mode for a batch */
+    if (NULL == pCb)
+    {
+        LAC_INVALID_PARAM_LOG("pCb is NULL");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+    *pNumSubmitted = 0;
+
+    /* Nothing is submitted unless the whole batch is valid. The multiply
+     * status is only returned through the callback. */
+    for (i = 0; i < numRequests; i++)
+    {
+        status = LacEcdsa_SignRSCheck(instanceHandle,
+                                      pBatchOpData[i].pOpData,
+                                      &multiplyStatus,
+                                      pBatchOpData[i].pR,
+                                      pBatchOpData[i].pS,
+                                      &dataOperationSizeBytes);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            LAC_ECDSA_STAT_INC(numEcdsaSignRSRequestErrors, pCryptoService);
+            return status;
+        }
+    }
+
+    while ((numDone < numRequests) && (CPA_STATUS_SUCCESS == status))
+    {
+        numMsgs = numRequests - numDone;
+        if (numMsgs > LAC_PKE_SEND_BURST_SIZE)
+        {
+            numMsgs = LAC_PKE_SEND_BURST_SIZE;
+        }
+
+        for (numBuilt = 0; numBuilt < numMsgs; numBuilt++)
+        {
+            pEntry = &pBatchOpData[numDone + numBuilt];
+            requestHandles[numBuilt] = LAC_PKE_INVALID_HANDLE;
+            pMemPoolConcates[numBuilt] = NULL;
+
+            status = LacEcdsa_SignRSSizeGet(pEntry->pOpData,
+                                            &dataOperationSizeBytes);
+            if (CPA_STATUS_SUCCESS == status)
+            {
+                status =
+                    LacEcdsa_SignRSBuildRequest(instanceHandle,
+                                                pCb,
+                                                pEntry->pCallbackTag,
+                                                pEntry->pOpData,
+                                                pEntry->pR,
+                                                pEntry->pS,
+                                                dataOperationSizeBytes,
+                                                &requestHandles[numBuilt],
+                                                &pMemPoolConcates[numBuilt]);
+            }
+
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                LAC_ECDSA_STAT_INC(numEcdsaSignRSRequestErrors,
+                                   pCryptoService);
+                break;
+            }
+        }
+
+        /* A burst is only sent once all of it is built, so a failure
+         * never leaves part of a burst on the ring. Requests which do not
+         * fit on the ring are destroyed by LacPke_SendRequests. */
+        numSent = 0;
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            sendStatus = LacPke_SendRequests(
+                requestHandles, numBuilt, instanceHandle, &numSent);
+        }
+        else
+        {
+            for (i = 0; i < numBuilt; i++)
+            {
+                (void)LacPke_DestroyRequest(&requestHandles[i]);
+            }
+        }
+
+        for (i = 0; i < numSent; i++)
+        {
+            LAC_ECDSA_STAT_INC(numEcdsaSignRSRequests, pCryptoService);
+        }
+        for (i = numSent; i < numBuilt; i++)
+        {
+            /* The callback will not free the input buffer */
+            LAC_ECDSA_STAT_INC(numEcdsaSignRSRequestErrors, pCryptoService);
+            Lac_MemPoolEntryFree(pMemPoolConcates[i]);
+        }
+
+        numDone += numSent;
+        if ((CPA_STATUS_SUCCESS == status) && (numSent < numBuilt))
+        {
+            status = sendStatus;
+        }
+    }
+
+    *pNumSubmitted = numDone;
+    return status;
+}
+
 /**
  ***************************************************************************
  * @ingroup Lac_Ec
@@ -2224,7 +2520,14 @@ CpaStatus cpaCyEcdsaVerify(const CpaInstanceHandle instanceHandle_in,
     Cpa32U temp = 0;
     CpaBoolean isZero = CPA_FALSE;
 #endif
+#ifdef ICP_PKE_PROFILE
+    Cpa64U timeStamp = 0;
+    Cpa64U checkStart = 0;
+    Cpa64U curveStart = 0;
+    Cpa64U curveEnd = 0;
+#endif
 
+    LAC_PKE_PROFILE_TIMESTAMP(timeStamp);
     if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
     {
         instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
@@ -2271,6 +2574,7 @@ CpaStatus cpaCyEcdsaVerify(const CpaInstanceHandle instanceHandle_in,
 #endif
     }
 
+    LAC_PKE_PROFILE_TIMESTAMP(checkStart);
 #ifdef ICP_PARAM_CHECK
     /* Basic Param Checking  */
     status =
@@ -2280,6 +2584,7 @@ CpaStatus cpaCyEcdsaVerify(const CpaInstanceHandle instanceHandle_in,
 
     pCryptoService = (sal_crypto_service_t *)instanceHandle;
 
+    LAC_PKE_PROFILE_TIMESTAMP(curveStart);
     if (CPA_STATUS_SUCCESS == status)
     {
         /* Determine size */
@@ -2331,6 +2636,9 @@ CpaStatus cpaCyEcdsaVerify(const CpaInstanceHandle instanceHandle_in,
                                             &(pOpData->yg));
         }
     }
+#endif
+    LAC_PKE_PROFILE_TIMESTAMP(curveEnd);
+#ifdef ICP_PARAM_CHECK
 
     if (CPA_STATUS_SUCCESS == status)
     {
@@ -2471,6 +2779,19 @@ CpaStatus cpaCyEcdsaVerify(const CpaInstanceHandle instanceHandle_in,
     }
 #endif
 
+#ifdef ICP_PKE_PROFILE
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        LacPke_ProfileAdd(instanceHandle,
+                          ICP_SAL_PKE_PROFILE_CURVE_CHECK,
+                          curveEnd - curveStart);
+        LacPke_ProfileAdd(instanceHandle,
+                          ICP_SAL_PKE_PROFILE_PARAM_CHECK,
+                          LacPke_ProfileTimestamp() - checkStart -
+                              (curveEnd - curveStart));
+    }
+#endif
+
     if (CPA_STATUS_SUCCESS == status)
     {
         Cpa8U *pMemPoolConcate = NULL;
@@ -2635,6 +2956,639 @@ CpaStatus cpaCyEcdsaVerify(const CpaInstanceHandle instanceHandle_in,
         }
     }
 
+    /* increment stats */
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        LAC_ECDSA_STAT_INC(numEcdsaVerifyRequests, pCryptoService);
+        LAC_PKE_PROFILE_END(
+            instanceHandle, ICP_SAL_PKE_PROFILE_SUBMIT, timeStamp);
+    }
+    else
+    {
+        LAC_ECDSA_STAT_INC(numEcdsaVerifyRequestErrors, pCryptoService);
+    }
+
+    return status;
+}
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      ECDSA Sign R & S on a named curve synchronous function
+ ***************************************************************************/
+STATIC CpaStatus
+LacEcdsa_SignRSCurveSyn(const CpaInstanceHandle instanceHandle,
+                        const icp_sal_ecdsa_sign_rs_curve_op_data_t *pOpData,
+                        CpaBoolean *pSignStatus,
+                        CpaFlatBuffer *pR,
+                        CpaFlatBuffer *pS)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_sync_op_data_t *pSyncCallbackData = NULL;
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+
+    status = LacSync_CreateSyncCookie(&pSyncCallbackData);
+    /*
+     * Call the asynchronous version of the function
+     * with the generic synchronous callback function as a parameter.
+     */
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = icp_sal_CyEcdsaSignRSCurve(instanceHandle,
+                                            LacSync_GenDualFlatBufVerifyCb,
+                                            pSyncCallbackData,
+                                            pOpData,
+                                            pSignStatus,
+                                            pR,
+                                            pS);
+    }
+    else
+    {
+        LAC_ECDSA_STAT_INC(numEcdsaSignRSRequestErrors, pCryptoService);
+        return status;
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        CpaStatus wCbStatus = CPA_STATUS_FAIL;
+        wCbStatus = LacSync_WaitForCallback(pSyncCallbackData,
+                                            LAC_PKE_SYNC_CALLBACK_TIMEOUT,
+                                            &status,
+                                            pSignStatus);
+
+        if (CPA_STATUS_SUCCESS != wCbStatus)
+        {
+            LAC_ECDSA_STAT_INC(numEcdsaSignRSCompletedErrors, pCryptoService);
+            status = wCbStatus;
+        }
+    }
+    else
+    {
+        /* As the Request was not sent the Callback will never
+         * be called, so need to indicate that we're finished
+         * with cookie so it can be destroyed. */
+        LacSync_SetSyncCookieComplete(pSyncCallbackData);
+    }
+
+    LacSync_DestroySyncCookie(&pSyncCallbackData);
+    return status;
+}
+
+#ifdef ICP_PARAM_CHECK
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      ECDSA Sign R & S on a named curve parameter check
+ *
+ * @description
+ *      The curve parameters are known to be valid, only the numbers of the
+ *      request are checked.
+ ***************************************************************************/
+STATIC
+CpaStatus LacEcdsa_SignRSCurveParamCheck(
+    const CpaInstanceHandle instanceHandle,
+    const icp_sal_ecdsa_sign_rs_curve_op_data_t *pOpData,
+    CpaBoolean *pSignStatus,
+    CpaFlatBuffer *pR,
+    CpaFlatBuffer *pS)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_ec_named_curve_t *pCurve = NULL;
+
+    /* check for NULL pointers */
+    LAC_CHECK_NULL_PARAM(pSignStatus);
+    LAC_CHECK_NULL_PARAM(pOpData);
+    LAC_CHECK_NULL_PARAM(pR);
+    LAC_CHECK_NULL_PARAM(pS);
+
+    /* Check flat buffers in pOpData for NULL and dataLen of 0*/
+    LAC_CHECK_NULL_PARAM(pOpData->m.pData);
+    LAC_CHECK_SIZE(&(pOpData->m), CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pOpData->d.pData);
+    LAC_CHECK_SIZE(&(pOpData->d), CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pOpData->k.pData);
+    LAC_CHECK_SIZE(&(pOpData->k), CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pR->pData);
+    LAC_CHECK_SIZE(pR, CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pS->pData);
+    LAC_CHECK_SIZE(pS, CHECK_NONE, 0);
+
+    status = LacEc_NamedCurveCheck(instanceHandle, pOpData->hCurve);
+    LAC_CHECK_STATUS(status);
+    pCurve = (lac_ec_named_curve_t *)pOpData->hCurve;
+
+    /* Check that output buffers are big enough */
+    if ((pR->dataLenInBytes < pCurve->minOutputSizeBytes) ||
+        (pS->dataLenInBytes < pCurve->minOutputSizeBytes))
+    {
+        LAC_INVALID_PARAM_LOG("Output buffer not big enough");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Check that m fits in the operand size of the curve */
+    if (LacPke_GetMinBytes(&(pOpData->m)) > pCurve->sizeBytes)
+    {
+        LAC_INVALID_PARAM_LOG("m is too big for the curve");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Check  0 < k < n */
+    LAC_CHECK_NON_ZERO_PARAM(&(pOpData->k));
+    if (LacPke_Compare(&(pOpData->k), 0, &(pCurve->n), 0) >= 0)
+    {
+        LAC_INVALID_PARAM_LOG("k is not < n as required");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Check  0 < d < n */
+    LAC_CHECK_NON_ZERO_PARAM(&(pOpData->d));
+    if (LacPke_Compare(&(pOpData->d), 0, &(pCurve->n), 0) >= 0)
+    {
+        LAC_INVALID_PARAM_LOG("d is not < n as required");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    return CPA_STATUS_SUCCESS;
+}
+#endif
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *
+ ***************************************************************************/
+CpaStatus icp_sal_CyEcdsaSignRSCurve(
+    const CpaInstanceHandle instanceHandle_in,
+    const CpaCyEcdsaSignRSCbFunc pCb,
+    void *pCallbackTag,
+    const icp_sal_ecdsa_sign_rs_curve_op_data_t *pOpData,
+    CpaBoolean *pSignStatus,
+    CpaFlatBuffer *pR,
+    CpaFlatBuffer *pS)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    sal_crypto_service_t *pCryptoService = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    /* instance checks - if fail, no inc stats just return */
+    /* check for valid acceleration handle */
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_ADDR_TRANS_SETUP(instanceHandle);
+#endif
+    /* ensure LAC is initialised - return error if not */
+    SAL_RUNNING_CHECK(instanceHandle);
+#ifdef ICP_PARAM_CHECK
+    /* ensure this is a crypto or asym instance with pke enabled */
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+#endif
+
+    /* Check if the API has been called in synchronous mode */
+    if (NULL == pCb)
+    {
+        return LacEcdsa_SignRSCurveSyn(
+            instanceHandle, pOpData, pSignStatus, pR, pS);
+    }
+
+#ifdef ICP_PARAM_CHECK
+    status = LacEcdsa_SignRSCurveParamCheck(
+        instanceHandle, pOpData, pSignStatus, pR, pS);
+#endif
+
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        lac_ec_named_curve_t *pCurve = (lac_ec_named_curve_t *)pOpData->hCurve;
+        Cpa32U sizeBytes = pCurve->sizeBytes;
+        Cpa8U *pMemPoolConcate = NULL;
+        Cpa8U *pConcateTemp = NULL;
+        CpaFlatBuffer *pInBuff = NULL;
+
+        icp_qat_fw_mmp_input_param_t inRS = {.flat_array = {0}};
+        icp_qat_fw_mmp_output_param_t outRS = {.flat_array = {0}};
+        lac_pke_op_cb_data_t cbData = {0};
+
+        /* Holding the calculated size of the input/output parameters */
+        Cpa32U inArgSizeList[LAC_MAX_MMP_INPUT_PARAMS] = {0};
+        Cpa32U outArgSizeList[LAC_MAX_MMP_OUTPUT_PARAMS] = {0};
+
+        CpaBoolean internalMemInList[LAC_MAX_MMP_INPUT_PARAMS] = {CPA_FALSE};
+        CpaBoolean internalMemOutList[LAC_MAX_MMP_OUTPUT_PARAMS] = {CPA_FALSE};
+
+        /* clear output buffers */
+        osalMemSet(pR->pData, 0, pR->dataLenInBytes);
+        osalMemSet(pS->pData, 0, pS->dataLenInBytes);
+
+        /* Need to concatenate user inputs - copy to ecc mempool memory */
+        do
+        {
+            pMemPoolConcate =
+                (Cpa8U *)Lac_MemPoolEntryAlloc(pCryptoService->lac_ec_pool);
+            if (NULL == pMemPoolConcate)
+            {
+                LAC_LOG_ERROR("Cannot get mem pool entry");
+                status = CPA_STATUS_RESOURCE;
+            }
+            else if ((void *)CPA_STATUS_RETRY == pMemPoolConcate)
+            {
+                osalYield();
+            }
+        } while ((void *)CPA_STATUS_RETRY == pMemPoolConcate);
+
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            /* Concatenate d, m, k followed by the padded b, a, q, n, yg, xg
+             * of the curve */
+            pConcateTemp = pMemPoolConcate;
+            LacEc_FlatBuffToConcate(&pConcateTemp, &(pOpData->d), sizeBytes);
+            LacEc_FlatBuffToConcate(&pConcateTemp, &(pOpData->m), sizeBytes);
+            LacEc_FlatBuffToConcate(&pConcateTemp, &(pOpData->k), sizeBytes);
+            memcpy(pConcateTemp,
+                   pCurve->pSignRSParams,
+                   LAC_EC_NAMED_CURVE_NUM_PARAMS * sizeBytes);
+            pConcateTemp += LAC_EC_NAMED_CURVE_NUM_PARAMS * sizeBytes;
+            pInBuff = (CpaFlatBuffer *)pConcateTemp;
+            pInBuff->dataLenInBytes =
+                (sizeBytes * LAC_ECDSA_SIGNRS_NUM_IN_QA_API);
+            pInBuff->pData = pMemPoolConcate;
+
+            /* populate callback data */
+            cbData.pClientCb = pCb;
+            cbData.pCallbackTag = pCallbackTag;
+            cbData.pClientOpData = pOpData;
+            cbData.pOpaqueData = pMemPoolConcate;
+            cbData.pOutputData1 = pR;
+            cbData.pOutputData2 = pS;
+
+            /* Set the size for all parameters to be padded to */
+            LAC_EC_SET_LIST_PARAMS(
+                inArgSizeList,
+                LAC_ECDSA_SIGNRS_NUM_IN_ARGS,
+                (LAC_ECDSA_SIGNRS_NUM_IN_QA_API * sizeBytes));
+            LAC_EC_SET_LIST_PARAMS(
+                outArgSizeList, LAC_ECDSA_SIGNRS_NUM_OUT_ARGS, sizeBytes);
+            /* Input memory to QAT is internally allocated */
+            LAC_EC_SET_LIST_PARAMS(
+                internalMemInList, LAC_ECDSA_SIGNRS_NUM_IN_ARGS, CPA_TRUE);
+            /* Output memory to QAT is externally allocated */
+            LAC_EC_SET_LIST_PARAMS(
+                internalMemOutList, LAC_ECDSA_SIGNRS_NUM_OUT_ARGS, CPA_FALSE);
+
+            /* The Sign RS parameters have the same layout for all sizes */
+            LacEcdsaSignRSOpDataWrite(inRS.mmp_ecdsa_sign_rs_gfp_l256,
+                                      outRS.mmp_ecdsa_sign_rs_gfp_l256,
+                                      pInBuff,
+                                      pR,
+                                      pS);
+
+            LAC_ECDSA_TIMESTAMP_BEGIN(&cbData,
+                                      LAC_ECDSA_SIGN_RS_REQUEST,
+                                      (sal_crypto_service_t *)instanceHandle);
+
+            /* build a PKE request  */
+            status = LacPke_SendSingleRequest(pCurve->signRSFunctionID,
+                                              inArgSizeList,
+                                              outArgSizeList,
+                                              &inRS,
+                                              &outRS,
+                                              internalMemInList,
+                                              internalMemOutList,
+                                              LacEcdsa_SignRSCallback,
+                                              &cbData,
+                                              instanceHandle);
+
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                /* Free Mem Pool */
+                Lac_MemPoolEntryFree(pMemPoolConcate);
+            }
+        }
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        /* increment stats */
+        LAC_ECDSA_STAT_INC(numEcdsaSignRSRequests, pCryptoService);
+    }
+    else
+    {
+        /* increment stats */
+        LAC_ECDSA_STAT_INC(numEcdsaSignRSRequestErrors, pCryptoService);
+    }
+
+    return status;
+}
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      ECDSA Verify on a named curve synchronous function
+ ***************************************************************************/
+STATIC CpaStatus
+LacEcdsa_VerifyCurveSyn(const CpaInstanceHandle instanceHandle,
+                        const icp_sal_ecdsa_verify_curve_op_data_t *pOpData,
+                        CpaBoolean *pVerifyStatus)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_sync_op_data_t *pSyncCallbackData = NULL;
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+
+    status = LacSync_CreateSyncCookie(&pSyncCallbackData);
+    /*
+     * Call the asynchronous version of the function
+     * with the generic synchronous callback function as a parameter.
+     */
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = icp_sal_CyEcdsaVerifyCurve(instanceHandle,
+                                            LacSync_GenVerifyCb,
+                                            pSyncCallbackData,
+                                            pOpData,
+                                            pVerifyStatus);
+    }
+    else
+    {
+        LAC_ECDSA_STAT_INC(numEcdsaVerifyRequestErrors, pCryptoService);
+        return status;
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        CpaStatus wCbStatus = CPA_STATUS_FAIL;
+        wCbStatus = LacSync_WaitForCallback(pSyncCallbackData,
+                                            LAC_PKE_SYNC_CALLBACK_TIMEOUT,
+                                            &status,
+                                            pVerifyStatus);
+
+        if (CPA_STATUS_SUCCESS != wCbStatus)
+        {
+            LAC_ECDSA_STAT_INC(numEcdsaVerifyCompletedErrors, pCryptoService);
+            status = wCbStatus;
+        }
+    }
+    else
+    {
+        /* As the Request was not sent the Callback will never
+         * be called, so need to indicate that we're finished
+         * with cookie so it can be destroyed. */
+        LacSync_SetSyncCookieComplete(pSyncCallbackData);
+    }
+
+    LacSync_DestroySyncCookie(&pSyncCallbackData);
+    return status;
+}
+
+#ifdef ICP_PARAM_CHECK
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *      ECDSA Verify on a named curve parameter check
+ *
+ * @description
+ *      The curve parameters are known to be valid, only the numbers of the
+ *      request are checked.
+ ***************************************************************************/
+STATIC
+CpaStatus LacEcdsa_VerifyCurveParamCheck(
+    const CpaInstanceHandle instanceHandle,
+    const icp_sal_ecdsa_verify_curve_op_data_t *pOpData,
+    CpaBoolean *pVerifyStatus)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_ec_named_curve_t *pCurve = NULL;
+
+    /* check for NULL pointers */
+    LAC_CHECK_NULL_PARAM(pVerifyStatus);
+    LAC_CHECK_NULL_PARAM(pOpData);
+
+    /* Check flat buffers in pOpData for NULL and dataLen of 0*/
+    LAC_CHECK_NULL_PARAM(pOpData->m.pData);
+    LAC_CHECK_SIZE(&(pOpData->m), CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pOpData->r.pData);
+    LAC_CHECK_SIZE(&(pOpData->r), CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pOpData->s.pData);
+    LAC_CHECK_SIZE(&(pOpData->s), CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pOpData->xp.pData);
+    LAC_CHECK_SIZE(&(pOpData->xp), CHECK_NONE, 0);
+    LAC_CHECK_NULL_PARAM(pOpData->yp.pData);
+    LAC_CHECK_SIZE(&(pOpData->yp), CHECK_NONE, 0);
+
+    status = LacEc_NamedCurveCheck(instanceHandle, pOpData->hCurve);
+    LAC_CHECK_STATUS(status);
+    pCurve = (lac_ec_named_curve_t *)pOpData->hCurve;
+
+    /* Check that m fits in the operand size of the curve */
+    if (LacPke_GetMinBytes(&(pOpData->m)) > pCurve->sizeBytes)
+    {
+        LAC_INVALID_PARAM_LOG("m is too big for the curve");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Check  0 < r < n */
+    LAC_CHECK_NON_ZERO_PARAM(&(pOpData->r));
+    if (LacPke_Compare(&(pOpData->r), 0, &(pCurve->n), 0) >= 0)
+    {
+        LAC_INVALID_PARAM_LOG("r is not < n as required");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Check  0 < s < n */
+    LAC_CHECK_NON_ZERO_PARAM(&(pOpData->s));
+    if (LacPke_Compare(&(pOpData->s), 0, &(pCurve->n), 0) >= 0)
+    {
+        LAC_INVALID_PARAM_LOG("s is not < n as required");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Ensure public key is not (0,0) */
+    if ((0 == LacPke_CompareZero(&(pOpData->xp), 0)) &&
+        (0 == LacPke_CompareZero(&(pOpData->yp), 0)))
+    {
+        LAC_INVALID_PARAM_LOG("Invalid public point");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Ensure xp < q and yp < q */
+    if (LacPke_Compare(&(pOpData->xp), 0, &(pCurve->q), 0) >= 0)
+    {
+        LAC_INVALID_PARAM_LOG("xp is not < q as required");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    if (LacPke_Compare(&(pOpData->yp), 0, &(pCurve->q), 0) >= 0)
+    {
+        LAC_INVALID_PARAM_LOG("yp is not < q as required");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    return CPA_STATUS_SUCCESS;
+}
+#endif
+
+/**
+ ***************************************************************************
+ * @ingroup Lac_Ec
+ *
+ ***************************************************************************/
+CpaStatus icp_sal_CyEcdsaVerifyCurve(
+    const CpaInstanceHandle instanceHandle_in,
+    const CpaCyEcdsaVerifyCbFunc pCb,
+    void *pCallbackTag,
+    const icp_sal_ecdsa_verify_curve_op_data_t *pOpData,
+    CpaBoolean *pVerifyStatus)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    sal_crypto_service_t *pCryptoService = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    /* instance checks - if fail, no inc stats just return */
+    /* check for valid acceleration handle */
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_ADDR_TRANS_SETUP(instanceHandle);
+#endif
+    /* ensure LAC is initialised - return error if not */
+    SAL_RUNNING_CHECK(instanceHandle);
+#ifdef ICP_PARAM_CHECK
+    /* ensure this is a crypto or asym instance with pke enabled */
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+#endif
+
+    /* Check if the API has been called in synchronous mode */
+    if (NULL == pCb)
+    {
+        return LacEcdsa_VerifyCurveSyn(instanceHandle, pOpData, pVerifyStatus);
+    }
+
+#ifdef ICP_PARAM_CHECK
+    status =
+        LacEcdsa_VerifyCurveParamCheck(instanceHandle, pOpData, pVerifyStatus);
+#endif
+
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        lac_ec_named_curve_t *pCurve = (lac_ec_named_curve_t *)pOpData->hCurve;
+        Cpa32U sizeBytes = pCurve->sizeBytes;
+        Cpa32U curveParamsSizeBytes = LAC_EC_NAMED_CURVE_NUM_PARAMS / 2 *
+                                      sizeBytes;
+        Cpa8U *pMemPoolConcate = NULL;
+        Cpa8U *pConcateTemp = NULL;
+        CpaFlatBuffer *pInBuff = NULL;
+
+        icp_qat_fw_mmp_input_param_t inVerify = {.flat_array = {0}};
+        icp_qat_fw_mmp_output_param_t outVerify = {.flat_array = {0}};
+        lac_pke_op_cb_data_t cbData = {0};
+
+        /* Holding the calculated size of the input/output parameters */
+        Cpa32U inArgSizeList[LAC_MAX_MMP_INPUT_PARAMS] = {0};
+        CpaBoolean internalMemInList[LAC_MAX_MMP_INPUT_PARAMS] = {CPA_FALSE};
+
+        /* Need to concatenate user inputs - copy to ecc mempool memory */
+        do
+        {
+            pMemPoolConcate =
+                (Cpa8U *)Lac_MemPoolEntryAlloc(pCryptoService->lac_ec_pool);
+            if (NULL == pMemPoolConcate)
+            {
+                LAC_LOG_ERROR("Cannot get mem pool entry");
+                status = CPA_STATUS_RESOURCE;
+            }
+            else if ((void *)CPA_STATUS_RETRY == pMemPoolConcate)
+            {
+                osalYield();
+            }
+        } while ((void *)CPA_STATUS_RETRY == pMemPoolConcate);
+
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            /* Concatenate q, b, a, yp, xp, yg, xg, n, r, s, m with the
+             * padded curve parameters copied as two blocks */
+            pConcateTemp = pMemPoolConcate;
+            memcpy(pConcateTemp, pCurve->pVerifyParams, curveParamsSizeBytes);
+            pConcateTemp += curveParamsSizeBytes;
+            LacEc_FlatBuffToConcate(&pConcateTemp, &(pOpData->yp), sizeBytes);
+            LacEc_FlatBuffToConcate(&pConcateTemp, &(pOpData->xp), sizeBytes);
+            memcpy(pConcateTemp,
+                   pCurve->pVerifyParams + curveParamsSizeBytes,
+                   curveParamsSizeBytes);
+            pConcateTemp += curveParamsSizeBytes;
+            LacEc_FlatBuffToConcate(&pConcateTemp, &(pOpData->r), sizeBytes);
+            LacEc_FlatBuffToConcate(&pConcateTemp, &(pOpData->s), sizeBytes);
+            LacEc_FlatBuffToConcate(&pConcateTemp, &(pOpData->m), sizeBytes);
+            pInBuff = (CpaFlatBuffer *)pConcateTemp;
+            pInBuff->dataLenInBytes =
+                (sizeBytes * LAC_ECDSA_VERIFY_NUM_IN_QA_API);
+            pInBuff->pData = pMemPoolConcate;
+
+            /* populate callback data */
+            cbData.pClientCb = pCb;
+            cbData.pCallbackTag = pCallbackTag;
+            cbData.pClientOpData = pOpData;
+            cbData.pOpaqueData = pMemPoolConcate;
+
+            /* Set the size for all parameters to be padded to */
+            LAC_EC_SET_LIST_PARAMS(
+                inArgSizeList,
+                LAC_ECDSA_VERIFY_NUM_IN_ARGS,
+                (LAC_ECDSA_VERIFY_NUM_IN_QA_API * sizeBytes));
+
+            /* Input Memory to QAT is internally allocated */
+            internalMemInList[0] = CPA_TRUE;
+
+            /* The Verify parameters have the same layout for all sizes */
+            LacEcdsaVerifyOpDataWrite(inVerify.mmp_ecdsa_verify_gfp_l256,
+                                      pInBuff);
+
+            LAC_ECDSA_TIMESTAMP_BEGIN(&cbData,
+                                      LAC_ECDSA_VERIFY_REQUEST,
+                                      (sal_crypto_service_t *)instanceHandle);
+
+            /* build a PKE request  */
+            status = LacPke_SendSingleRequest(pCurve->verifyFunctionID,
+                                              inArgSizeList,
+                                              NULL,
+                                              &inVerify,
+                                              &outVerify,
+                                              internalMemInList,
+                                              NULL,
+                                              LacEcdsa_VerifyCallback,
+                                              &cbData,
+                                              instanceHandle);
+
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                /* Free Mem Pool */
+                Lac_MemPoolEntryFree(pMemPoolConcate);
+            }
+        }
+    }
+
     /* increment stats */
     if (CPA_STATUS_SUCCESS == status)
     {
@@ -121,10 +121,9 @@
         if (CPA_TRUE ==                                                        \
             pCryptoService->generic_service_info.stats->bEccStatsEnabled)      \
         {                                                                      \
-            osalAtomicInc(                                                     \
-                &pCryptoService                                                \
-                     ->pLacEcStatsArr[offsetof(CpaCyEcStats64, statistic) /    \
-                                      sizeof(Cpa64U)]);                        \
+            LacStats_Inc(&pCryptoService->lacEcStats,                          \
+                         offsetof(CpaCyEcStats64, statistic) /                 \
+                             sizeof(Cpa64U));                                  \
         }                                                                      \
     } while (0)
 #else
@@ -766,6 +765,7 @@ CpaStatus cpaCyKptEcPointMultiply(const CpaInstanceHandle instanceHandle_in,
                                               &out,
                                               internalMemInList,
                                               internalMemOutList,
+                                              NULL,
                                               LacKptEc_PointMultiplyCallback,
                                               &cbData,
                                               instanceHandle);
@@ -168,14 +168,13 @@
         if (CPA_TRUE ==                                                        \
             pCryptoService->generic_service_info.stats->bEccStatsEnabled)      \
         {                                                                      \
-            osalAtomicInc(                                                     \
-                &pCryptoService->pLacEcdsaStatsArr[offsetof(CpaCyEcdsaStats64, \
-                                                            statistic) /       \
-                                                   sizeof(Cpa64U)]);           \
+            LacStats_Inc(&pCryptoService->lacEcdsaStats,                       \
+                         offsetof(CpaCyEcdsaStats64, statistic) /              \
+                             sizeof(Cpa64U));                                  \
         }                                                                      \
     } while (0)
 /**< @ingroup Lac_KptEc
- * macro to increment a ECDSA stat (derives offset into array of atomics) */
+ * macro to increment a ECDSA stat (derives offset into the sharded stats) */
 #else
 #define LAC_KPT_ECDSA_STAT_INC(statistic, pCryptoService)                      \
     (pCryptoService) = (pCryptoService)
@@ -890,6 +889,7 @@ CpaStatus cpaCyKptEcdsaSignRS(const CpaInstanceHandle instanceHandle_in,
                                               &outRS,
                                               internalMemInList,
                                               internalMemOutList,
+                                              NULL,
                                               LacKptEcdsa_SignRSCallback,
                                               &cbData,
                                               instanceHandle);
@@ -63,6 +63,8 @@
 #ifndef LAC_EC_H
 #define LAC_EC_H
 
+#include "icp_sal_ec_curve.h"
+
 #define LAC_EC_SIZE_BYTES_MAX LAC_BITS_TO_BYTES(LAC_576_BITS)
 #define LAC_EC_SIZE_BYTES_MIN LAC_BITS_TO_BYTES(LAC_256_BITS)
 
@@ -222,4 +224,91 @@ CpaStatus LacEc_CheckCurve9QWGF2(const CpaFlatBuffer *pQ,
                                  const CpaFlatBuffer *pH,
                                  const CpaFlatBuffer *pX,
                                  const CpaFlatBuffer *pY);
+
+/**
+ ******************************************************************************
+ * @ingroup Lac_Ec
+ *      Named curve
+ *
+ * @description
+ *      Parameters of a named NIST prime curve, set up once per instance in
+ *      DMA-able memory. Every parameter is padded to the operand size of the
+ *      PKE service of the curve so it is passed to the QAT without being
+ *      resized. The address of this structure is the curve handle.
+ *
+ *****************************************************************************/
+typedef struct lac_ec_named_curve_s
+{
+    Cpa32U sizeBytes;
+    /**< operand size of the PKE services of the curve */
+    Cpa32U minOutputSizeBytes;
+    /**< size of the modulus and of the order without leading zeros */
+    Cpa32U pointMultiplyFunctionID;
+    Cpa32U signRSFunctionID;
+    Cpa32U verifyFunctionID;
+    /**< PKE services for the curve */
+    CpaFlatBuffer q;
+    CpaFlatBuffer a;
+    CpaFlatBuffer b;
+    CpaFlatBuffer n;
+    CpaFlatBuffer xg;
+    CpaFlatBuffer yg;
+    /**< curve parameters, each within pSignRSParams */
+    CpaFlatBuffer h;
+    /**< cofactor, one quadword for P-521 */
+    Cpa8U *pSignRSParams;
+    /**< b, a, q, n, yg and xg as they follow d, m and k in a Sign RS
+     * request */
+    Cpa8U *pVerifyParams;
+    /**< q, b, a, yg, xg and n as they are placed in a Verify request, the
+     * first three before the public key, the last three after it */
+} lac_ec_named_curve_t;
+
+/**< @ingroup Lac_Ec
+ * number of curve parameters concatenated in a Sign RS or Verify request */
+#define LAC_EC_NAMED_CURVE_NUM_PARAMS 6
+
+/**
+ ******************************************************************************
+ * @ingroup Lac_Ec
+ *      Set up the named curves of an instance
+ *
+ * @description
+ *      Allocates and fills the named curves on the node of the instance.
+ *
+ * @param[in]  instanceHandle       Instance handle
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_RESOURCE      Memory allocation failed.
+ *
+ *****************************************************************************/
+CpaStatus LacEc_NamedCurvesInit(CpaInstanceHandle instanceHandle);
+
+/**
+ ******************************************************************************
+ * @ingroup Lac_Ec
+ *      Free the named curves of an instance
+ *
+ * @param[in]  instanceHandle       Instance handle
+ *
+ *****************************************************************************/
+void LacEc_NamedCurvesFree(CpaInstanceHandle instanceHandle);
+
+/**
+ ******************************************************************************
+ * @ingroup Lac_Ec
+ *      Check a named curve handle
+ *
+ * @description
+ *      Checks that a curve handle was returned for the given instance.
+ *
+ * @param[in]  instanceHandle       Instance handle
+ * @param[in]  hCurve               Curve handle
+ *
+ * @retval CPA_STATUS_SUCCESS       The handle is valid.
+ * @retval CPA_STATUS_INVALID_PARAM The handle is not a curve of the instance.
+ *
+ *****************************************************************************/
+CpaStatus LacEc_NamedCurveCheck(CpaInstanceHandle instanceHandle,
+                                icp_sal_ec_curve_handle_t hCurve);
 #endif /* LAC_EC_H */
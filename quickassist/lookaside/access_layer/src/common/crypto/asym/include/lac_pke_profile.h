@@ -0,0 +1,165 @@
+/***************************************************************************
+ *
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @defgroup LacAsym Asymmetric
+ *
+ * @ingroup Lac
+ *
+ * Asymmetric component includes Diffie Hellman, Rsa, Dsa, ECC and Prime.
+ **************************************************************************/
+
+/**
+ ***************************************************************************
+ * @defgroup LacAsymCommon Asymmetric Common
+ *
+ * @ingroup LacAsym
+ *
+ * Asymmetric common includes pke utils, mmp and qat communication layer
+ **************************************************************************/
+/**
+ ***************************************************************************
+ * @file lac_pke_profile.h
+ *
+ * @ingroup LacAsymCommonQatComms
+ *
+ * Host cycle profile of the PKE request path
+ *
+ * When the access layer is built with ICP_PKE_PROFILE, the stages listed in
+ * icp_sal_pke_profile_stage_t are timed with the time stamp counter. Each
+ * sample adds to the sample count, the cycle sum and one power of two
+ * histogram bucket of its stage, in the statistics shard of the calling
+ * thread, or in kernel space in the counters of the current CPU. Without
+ * ICP_PKE_PROFILE the macros expand to nothing.
+ *
+ ****************************************************************************/
+
+#ifndef _LAC_PKE_PROFILE_H_
+#define _LAC_PKE_PROFILE_H_
+
+#include "cpa.h"
+#include "icp_sal.h"
+#include "lac_stats.h"
+#include "lac_sal_types_crypto.h"
+
+/* Number of counters of one stage */
+#define LAC_PKE_PROFILE_STAGE_NUM_STATS                                        \
+    (sizeof(icp_sal_pke_profile_stage_stats_t) / sizeof(Cpa64U))
+
+/* Number of counters of the profile of an instance */
+#define LAC_PKE_PROFILE_NUM_STATS                                              \
+    (sizeof(icp_sal_pke_profile_t) / sizeof(Cpa64U))
+
+/* Index of the first histogram bucket within the counters of a stage */
+#define LAC_PKE_PROFILE_HISTOGRAM_INDEX 2
+
+#ifdef ICP_PKE_PROFILE
+
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Reads the time stamp counter
+ *
+ * @description
+ *      In kernel space osalTimestampGet already reads the time stamp
+ *      counter, in user space it has a microsecond resolution so the
+ *      counter is read directly where it exists.
+ ***************************************************************************/
+static inline Cpa64U LacPke_ProfileTimestamp(void)
+{
+#if defined(USER_SPACE) && (defined(__x86_64__) || defined(__i386__))
+    Cpa32U low = 0;
+    Cpa32U high = 0;
+
+    __asm__ __volatile__("rdtsc" : "=a"(low), "=d"(high));
+    return (((Cpa64U)high) << 32) | low;
+#else
+    return osalTimestampGet();
+#endif
+}
+
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Adds one sample to the profile of a stage
+ *
+ * @param[in] instanceHandle  instanceHandle
+ * @param[in] stage           stage the sample was taken in
+ * @param[in] cycles          cycles spent in the stage
+ ***************************************************************************/
+static inline void LacPke_ProfileAdd(CpaInstanceHandle instanceHandle,
+                                     icp_sal_pke_profile_stage_t stage,
+                                     Cpa64U cycles)
+{
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+    Cpa32U index = stage * LAC_PKE_PROFILE_STAGE_NUM_STATS;
+    Cpa32U bucket = 0;
+
+    while ((bucket < ICP_SAL_PKE_PROFILE_NUM_BUCKETS - 1) &&
+           ((cycles >> (bucket + 1)) != 0))
+    {
+        bucket++;
+    }
+
+    LacStats_Inc(&pCryptoService->lacPkeProfileStats, index);
+    LacStats_Add(&pCryptoService->lacPkeProfileStats, index + 1, cycles);
+    LacStats_Inc(&pCryptoService->lacPkeProfileStats,
+                 index + LAC_PKE_PROFILE_HISTOGRAM_INDEX + bucket);
+}
+
+/* Reads the time stamp counter into a Cpa64U */
+#define LAC_PKE_PROFILE_TIMESTAMP(timeStamp)                                   \
+    ((timeStamp) = LacPke_ProfileTimestamp())
+
+/* Adds the cycles since timeStamp to a stage */
+#define LAC_PKE_PROFILE_END(instanceHandle, stage, timeStamp)                  \
+    LacPke_ProfileAdd(                                                         \
+        (instanceHandle), (stage), LacPke_ProfileTimestamp() - (timeStamp))
+
+/* Adds a number of cycles to a stage */
+#define LAC_PKE_PROFILE_ADD(instanceHandle, stage, cycles)                     \
+    LacPke_ProfileAdd((instanceHandle), (stage), (cycles))
+
+#else
+#define LAC_PKE_PROFILE_TIMESTAMP(timeStamp)
+#define LAC_PKE_PROFILE_END(instanceHandle, stage, timeStamp)
+#define LAC_PKE_PROFILE_ADD(instanceHandle, stage, cycles)
+#endif
+
+#endif /* _LAC_PKE_PROFILE_H_ */
@@ -151,8 +151,24 @@
 
 /* SAL include */
 #include "lac_pke_mmp.h"
+#include "lac_pke_utils.h"
 #include "lac_sync.h"
 
+#ifdef PKE_OPERAND_ARENA_SIZE
+#define LAC_PKE_OPERAND_ARENA_SIZE PKE_OPERAND_ARENA_SIZE
+#else
+#define LAC_PKE_OPERAND_ARENA_SIZE                                             \
+    (9 * LAC_BITS_TO_BYTES(LAC_MAX_OP_SIZE_IN_BITS) / 2)
+#endif
+/**< @ingroup LacAsymCommonQatComms
+ * Size in bytes of an operand arena. A request chain takes one arena from
+ * the AsymArenaPool of the instance for its first operand that must be
+ * padded to the MMP operand size. Padded operands are copied into the arena
+ * rather than into buffers allocated from the resize pool. The default
+ * holds every operand of the largest CRT decrypt: the ciphertext and
+ * message at the modulus size and the five key components at half of it.
+ * Can be decided at compile time, must be a multiple of 8. */
+
 /**
  *****************************************************************************
  * @ingroup LacAsymCommonQatComms
@@ -285,6 +301,13 @@ typedef struct lac_pke_qat_req_data_s
         Cpa8U padding[1 << LAC_OPTIMAL_ALIGNMENT_SHIFT];
     } u3;
 
+    Cpa8U *pOperandArena;
+    /**< padded copies of the operands of the chain, see
+     * LAC_PKE_OPERAND_ARENA_SIZE. Only valid in the head request data,
+     * NULL until an operand is padded */
+    Cpa32U arenaUsed;
+    /**< bytes of the operand arena in use, only valid in the head */
+
     lac_pke_qat_req_data_cb_info_t cbInfo;       /**< Callback info */
     lac_pke_qat_req_data_param_info_t paramInfo; /**< Parameter info */
 
@@ -303,6 +326,10 @@ typedef void *lac_pke_request_handle_t;
 /**< @ingroup LacAsymCommonQatComms
  * Invalid PKE request handle. */
 
+#define LAC_PKE_SEND_BURST_SIZE 16
+/**< @ingroup LacAsymCommonQatComms
+ * Maximum number of PKE requests put on the ring with one tail update. */
+
 /**
  ***************************************************************************
  * @ingroup LacAsymCommonQatComms
@@ -339,6 +366,31 @@ void LacPke_MsgCallback(void *pRespMsg);
  ******************************************************************************/
 void LacPke_InitAsymRequest(Cpa8U *pData, CpaInstanceHandle instanceHandle);
 
+/**
+ *******************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Allocates the operand marshalling counters of an instance, and its
+ *      PKE profile counters when built with ICP_PKE_PROFILE.
+ *
+ * @param[in] instanceHandle        instanceHandle
+ *
+ * @retval CPA_STATUS_SUCCESS       No error
+ * @retval CPA_STATUS_RESOURCE      Failed to allocate the counters
+ *
+ ******************************************************************************/
+CpaStatus LacPke_StatsInit(CpaInstanceHandle instanceHandle);
+
+/**
+ *******************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Frees the operand marshalling and PKE profile counters of an
+ *      instance.
+ *
+ * @param[in] instanceHandle        instanceHandle
+ *
+ ******************************************************************************/
+void LacPke_StatsFree(CpaInstanceHandle instanceHandle);
+
 /**
  *******************************************************************************
  * @ingroup LacAsymCommonQatComms
@@ -371,8 +423,11 @@ void LacPke_InitAsymRequest(Cpa8U *pData, CpaInstanceHandle instanceHandle);
  *                              greater than or equal to their corresponding
  *                              size will be passed to QAT. Buffers that are
  *                              less than the required size will be copied into
- *                              internal driver buffers before being passed to
- *                              QAT.
+ *                              the operand arena of the request chain, or into
+ *                              internal driver buffers if it is full or none is
+ *                              free, before being passed to QAT. If pre-padded
+ *                              operands are configured for the instance such
+ *                              client buffers are rejected instead.
  * @param[in] pOutArgSizeList   pointer to a list of output sizes required by
  *                              QAT.
  * @param[in] pInArgList        pointer to the list of input params. This
@@ -391,6 +446,12 @@ void LacPke_InitAsymRequest(Cpa8U *pData, CpaInstanceHandle instanceHandle);
  * @param[in] pInternalInMemList pointer to a list of Booleans that indicate if
  *                              output data buffers passed to QAT are internally
  *                              or externally allocated.
+ * @param[in] pInArgPhysList    optional list of the physical addresses of the
+ *                              input params, translated by the caller when
+ *                              the buffers were allocated. A zero entry, or a
+ *                              NULL list, means the address is translated
+ *                              here. An address is only used if the param is
+ *                              passed to QAT without being resized.
  * @param[in] pPkeOpCbFunc      this function is invoked when the response is
  *                              received from the QAT
  * @param[in] pCbData           callback data to be returned (by copy)
@@ -399,6 +460,8 @@ void LacPke_InitAsymRequest(Cpa8U *pData, CpaInstanceHandle instanceHandle);
  *
  * @retval CPA_STATUS_SUCCESS   No error
  * @retval CPA_STATUS_RESOURCE  Resource error (e.g. failed memory allocation)
+ * @retval CPA_STATUS_INVALID_PARAM  Operand shorter than its size while
+ *                              pre-padded operands are configured
  *
  ******************************************************************************/
 CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
@@ -409,6 +472,7 @@ CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
                                icp_qat_fw_mmp_output_param_t *pOutArgList,
                                CpaBoolean *pInternalInMemList,
                                CpaBoolean *pInternalOutMemList,
+                               const Cpa64U *pInArgPhysList,
                                lac_pke_op_cb_func_t pPkeOpCbFunc,
                                lac_pke_op_cb_data_t *pCbData,
                                CpaInstanceHandle instanceHandle);
@@ -437,6 +501,57 @@ CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
 CpaStatus LacPke_SendRequest(lac_pke_request_handle_t *pRequestHandle,
                              CpaInstanceHandle instanceHandle);
 
+/**
+ *******************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Sends a burst of PKE requests to the QAT.
+ *
+ * @description
+ *      This function sends several PKE requests (or request chains),
+ * previously created using LacPke_CreateRequest(), to the QAT in order,
+ * updating the ring tail once per LAC_PKE_SEND_BURST_SIZE requests. It does
+ * not block waiting for a response. Requests which do not fit on the ring
+ * are destroyed, exactly as LacPke_SendRequest() does for a single request,
+ * and their handles are set to LAC_PKE_INVALID_HANDLE.
+ *
+ * @param[in,out] pRequestHandles   array of handles of the PKE requests to be
+ *                                  sent.
+ * @param[in] numRequests           number of handles in the array.
+ * @param[in] instanceHandle        Acceleration engine to which the messages
+ *                                  will be sent.
+ * @param[out] pNumSent             number of requests put on the ring. These
+ *                                  are always the first pNumSent handles.
+ *
+ * @retval CPA_STATUS_SUCCESS       All requests sent
+ * @retval CPA_STATUS_RETRY         Ring full, not all requests were sent
+ *
+ ******************************************************************************/
+CpaStatus LacPke_SendRequests(lac_pke_request_handle_t *pRequestHandles,
+                              Cpa32U numRequests,
+                              CpaInstanceHandle instanceHandle,
+                              Cpa32U *pNumSent);
+
+/**
+ *******************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Destroys a PKE request
+ *
+ * @description
+ *      This function destroys a PKE request that was created using
+ * LacPke_CreateRequest().  It should be called if an error occurs during
+ * request create or request send, or else as part of the response callback.
+ *
+ * @param pRequestHandle    IN  Pointer to the request handle that identifies
+ *                              the request to be destroyed.  The request
+ *                              handle will get set to LAC_PKE_INVALID_HANDLE.
+ *
+ * @retval CPA_STATUS_SUCCESS       No error
+ * @retval CPA_STATUS_RESOURCE       Resource error (e.g. failed memory free)
+ *
+ * @see LacPke_CreateRequest()
+ ******************************************************************************/
+CpaStatus LacPke_DestroyRequest(lac_pke_request_handle_t *pRequestHandle);
+
 /**
  *******************************************************************************
  * @ingroup LacAsymCommonQatComms
@@ -454,8 +569,11 @@ CpaStatus LacPke_SendRequest(lac_pke_request_handle_t *pRequestHandle,
  *                              greater than or equal to their corresponding
  *                              size will be passed to QAT. Buffers that are
  *                              less than the required size will be copied into
- *                              internal driver buffers before being passed to
- *                              QAT.
+ *                              the operand arena of the request chain, or into
+ *                              internal driver buffers if it is full or none is
+ *                              free, before being passed to QAT. If pre-padded
+ *                              operands are configured for the instance such
+ *                              client buffers are rejected instead.
  * @param[in] pOutArgSizeList   pointer to a list of output sizes required by
  *                              QAT.
  * @param[in] pInArgList        pointer to the list of input params. This
@@ -474,6 +592,12 @@ CpaStatus LacPke_SendRequest(lac_pke_request_handle_t *pRequestHandle,
  * @param[in] pInternalInMemList pointer to a list of Booleans that indicate if
  *                              output data buffers passed to QAT are internally
  *                              or externally allocated.
+ * @param[in] pInArgPhysList    optional list of the physical addresses of the
+ *                              input params, translated by the caller when
+ *                              the buffers were allocated. A zero entry, or a
+ *                              NULL list, means the address is translated
+ *                              here. An address is only used if the param is
+ *                              passed to QAT without being resized.
  * @param[in] pPkeOpCbFunc      this function is invoked when the response is
  *                              received from the QAT
  * @param[in] pCbData           callback data to be returned (by copy)
@@ -483,6 +607,8 @@ CpaStatus LacPke_SendRequest(lac_pke_request_handle_t *pRequestHandle,
  * @retval CPA_STATUS_SUCCESS   No error
  * @retval CPA_STATUS_RESOURCE  Resource error (e.g. failed memory allocation)
  * @retval CPA_STATUS_RETRY         Ring full
+ * @retval CPA_STATUS_INVALID_PARAM  Operand shorter than its size while
+ *                              pre-padded operands are configured
  *
  ******************************************************************************/
 CpaStatus LacPke_SendSingleRequest(Cpa32U functionalityId,
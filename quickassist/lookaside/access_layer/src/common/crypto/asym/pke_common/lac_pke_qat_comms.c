@@ -78,10 +78,14 @@
 #include "lac_list.h"
 #include "lac_sym_qat.h"
 #include "lac_sal_types_crypto.h"
+#include "lac_stats.h"
 #include "sal_qat_cmn_msg.h"
+#include "sal_statistics.h"
+#include "icp_sal.h"
 #include "lac_pke_qat_comms.h"
 #include "lac_pke_utils.h"
 #include "lac_pke_mmp.h"
+#include "lac_pke_profile.h"
 #ifdef KPT
 #include "lac_kpt_ksp_qat_comms.h"
 #endif
@@ -92,6 +96,10 @@
 ****************************************************************************
 */
 
+/* Number of operand marshalling counters */
+#define LAC_PKE_RESIZE_NUM_STATS                                               \
+    (sizeof(icp_sal_pke_resize_stats_t) / sizeof(Cpa64U))
+
 /*
 ****************************************************************************
 * Define static function definitions
@@ -137,6 +145,122 @@ void LacPke_HdrWrite(icp_qat_fw_pke_request_t *pMsg,
     pHeader->kpt_rn_mask = 0;
 }
 
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Resizes one parameter of a PKE request if required
+ *
+ * @description
+ *      The parameter is used in place if it is already workingLen bytes
+ *  long. Otherwise it is zero padded into the operand arena of the
+ *  request chain, or into a buffer from the resize pool once the arena is
+ *  full. The head request takes the arena from the arena pool for the
+ *  first padded parameter of the chain; if none is free the resize pool is
+ *  used. Client parameters which need padding are rejected if the instance
+ *  requires pre-padded operands.
+ *
+ * @param[in] pReqData        request the parameter belongs to
+ * @param[in] pUserData       parameter data
+ * @param[in] userLen         parameter length in bytes
+ * @param[in] workingLen      operand size in bytes, a multiple of 8
+ * @param[in,out] pInternalMem  CPA_TRUE if the parameter is internally
+ *                            allocated, set to CPA_TRUE if it is padded
+ * @param[out] ppWorkingData  operand passed to the QAT
+ * @param[in,out] pCounts     marshalling counters of the request
+ * @param[in] instanceHandle  instanceHandle
+ *
+ * @retval CPA_STATUS_SUCCESS       No error
+ * @retval CPA_STATUS_RESOURCE      Failed to allocate a buffer
+ * @retval CPA_STATUS_INVALID_PARAM Client parameter shorter than the
+ *                                  operand size with pre-padded operands
+ ***************************************************************************/
+STATIC
+CpaStatus LacPke_ResizeParam(lac_pke_qat_req_data_t *pReqData,
+                             Cpa8U *pUserData,
+                             Cpa32U userLen,
+                             Cpa32U workingLen,
+                             CpaBoolean *pInternalMem,
+                             Cpa8U **ppWorkingData,
+                             icp_sal_pke_resize_stats_t *pCounts,
+                             CpaInstanceHandle instanceHandle)
+{
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+    lac_pke_qat_req_data_t *pHeadReqData = pReqData->pHeadReqData;
+    Cpa8U *pWorkingData = NULL;
+    Cpa32U padSize = 0;
+
+    if (userLen == workingLen)
+    {
+        *ppWorkingData = pUserData;
+        pCounts->numInPlace++;
+        return CPA_STATUS_SUCCESS;
+    }
+
+    if ((CPA_TRUE == pCryptoService->asymPrePaddedOperands) &&
+        (CPA_FALSE == *pInternalMem))
+    {
+        LAC_INVALID_PARAM_LOG2("Operand of %u bytes is not padded to %u bytes",
+                               userLen,
+                               workingLen);
+        pCounts->numRejected++;
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    if ((userLen < workingLen) && (NULL == pHeadReqData->pOperandArena) &&
+        (workingLen <= LAC_PKE_OPERAND_ARENA_SIZE))
+    {
+        /* Do not wait for an arena, the resize pool is used instead */
+        pWorkingData =
+            Lac_MemPoolEntryAlloc(pCryptoService->lac_pke_arena_pool);
+        if ((NULL != pWorkingData) &&
+            ((void *)CPA_STATUS_RETRY != (void *)pWorkingData))
+        {
+            pHeadReqData->pOperandArena = pWorkingData;
+            pHeadReqData->arenaUsed = 0;
+        }
+    }
+
+    if ((userLen < workingLen) && (NULL != pHeadReqData->pOperandArena) &&
+        (workingLen <= LAC_PKE_OPERAND_ARENA_SIZE - pHeadReqData->arenaUsed))
+    {
+        if ((userLen > 0) && (NULL == pUserData))
+        {
+            LAC_LOG_ERROR("pUserBuffer parameter is NULL");
+            return CPA_STATUS_RESOURCE;
+        }
+
+        pWorkingData = pHeadReqData->pOperandArena + pHeadReqData->arenaUsed;
+        pHeadReqData->arenaUsed += workingLen;
+
+        /* Zero MSB of buffer and copy the data after it */
+        padSize = workingLen - userLen;
+        LAC_OS_BZERO(pWorkingData, padSize);
+        if (userLen)
+        {
+            memcpy(pWorkingData + padSize, pUserData, userLen);
+        }
+
+        /* the arena is internally allocated memory */
+        *pInternalMem = CPA_TRUE;
+        pCounts->numArena++;
+    }
+    else
+    {
+        pWorkingData = icp_LacBufferResize(
+            instanceHandle, pUserData, userLen, workingLen, pInternalMem);
+        if (NULL == pWorkingData)
+        {
+            return CPA_STATUS_RESOURCE;
+        }
+        pCounts->numAllocated++;
+    }
+    pCounts->numBytesCopied += userLen;
+
+    *ppWorkingData = pWorkingData;
+    return CPA_STATUS_SUCCESS;
+}
+
 /**
  ***************************************************************************
  * @ingroup LacAsymCommonQatComms
@@ -144,20 +268,21 @@ void LacPke_HdrWrite(icp_qat_fw_pke_request_t *pMsg,
  *
  * @description
  *      This function resizes the flat buffer parameters for a PKE request, if
- *  required, by calling icp_LacBufferResize for each input/output flat buffer
+ *  required, by calling LacPke_ResizeParam for each input/output flat buffer
  *  parameter in the request data structure.  LacPke_RestoreParams is the
  *  corresponding function for undoing the buffer copies.
  *
- * @param[in] pParamInfo  The data pointers of the flat buffers from the
+ * @param[in] pReqData    The data pointers of the flat buffers from the
  *                        clientInputParams and clientOutputParams
- *                        arrays are resized as necessary and stored in
- *                        the pkeInputParams and pkeOutputParams arrays
- *                        respectively.  The client...Params arrays are
- *                        processed one-by-one from the start, and
- *                        processing ends once a NULL parameter is
- *                        encountered.  Consequently, the pke...Params
- *                        arrays should be initialized to zero as NULL
- *                        inputs won't be written as NULL outputs.
+ *                        arrays of the param info are resized as
+ *                        necessary and stored in the pkeInputParams and
+ *                        pkeOutputParams arrays respectively.  The
+ *                        client...Params arrays are processed one-by-one
+ *                        from the start, and processing ends once a NULL
+ *                        parameter is encountered.  Consequently, the
+ *                        pke...Params arrays should be initialized to
+ *                        zero as NULL inputs won't be written as NULL
+ *                        outputs.
  * @param[in/out] pInternalInMemList
  *                        pointer to a list of Booleans that indicate if
  *                        input data buffers passed to QAT are internally or
@@ -169,21 +294,26 @@ void LacPke_HdrWrite(icp_qat_fw_pke_request_t *pMsg,
  *                        output data buffers passed to QAT are internally
  *                        or externally allocated, values may be updated by
  *                        this function.
+ * @param[in/out] pCounts marshalling counters of the request
  * @param[in] instanceHandle  instanceHandle
  *
  *
  * @retval CPA_STATUS_SUCCESS     No error
  * @retval CPA_STATUS_RESOURCE    Resource error (e.g. failed memory allocation)
+ * @retval CPA_STATUS_INVALID_PARAM  Parameter not padded with pre-padded
+ *                                operands
  *
  * @see LacPke_RestoreParams()
- * @see icp_LacBufferResize()
+ * @see LacPke_ResizeParam()
  ***************************************************************************/
 STATIC
-CpaStatus LacPke_ResizeParams(lac_pke_qat_req_data_param_info_t *pParamInfo,
+CpaStatus LacPke_ResizeParams(lac_pke_qat_req_data_t *pReqData,
                               CpaBoolean *pInternalInMemList,
                               CpaBoolean *pInternalOutMemList,
+                              icp_sal_pke_resize_stats_t *pCounts,
                               CpaInstanceHandle instanceHandle)
 {
+    lac_pke_qat_req_data_param_info_t *pParamInfo = &pReqData->paramInfo;
     CpaStatus status = CPA_STATUS_SUCCESS;
     Cpa32U i = 0;
 
@@ -204,14 +334,15 @@ CpaStatus LacPke_ResizeParams(lac_pke_qat_req_data_param_info_t *pParamInfo,
                          ? (dataLen - pParamInfo->inArgSizeList[i])
                          : 0;
         }
-        pParamInfo->pkeInputParams[i] = icp_LacBufferResize(
-            instanceHandle,
+        status = LacPke_ResizeParam(
+            pReqData,
             pParamInfo->clientInputParams[i]->pData + offset,
             dataLen - offset,
             LAC_ALIGN_POW2_ROUNDUP(dataRoundLen, LAC_QUAD_WORD_IN_BYTES),
-            &(pInternalInMemList[i]));
-        status =
-            (!pParamInfo->pkeInputParams[i] ? CPA_STATUS_RESOURCE : status);
+            &(pInternalInMemList[i]),
+            &(pParamInfo->pkeInputParams[i]),
+            pCounts,
+            instanceHandle);
         LAC_CHECK_STATUS(status);
     }
 
@@ -234,21 +365,76 @@ CpaStatus LacPke_ResizeParams(lac_pke_qat_req_data_param_info_t *pParamInfo,
                          ? (dataLen - pParamInfo->outArgSizeList[i])
                          : 0;
         }
-        pParamInfo->pkeOutputParams[i] = icp_LacBufferResize(
-            instanceHandle,
+        status = LacPke_ResizeParam(
+            pReqData,
             pParamInfo->clientOutputParams[i]->pData + offset,
             dataLen - offset,
             LAC_ALIGN_POW2_ROUNDUP(dataRoundLen, LAC_QUAD_WORD_IN_BYTES),
-            &(pInternalOutMemList[i]));
-
-        status =
-            (!pParamInfo->pkeOutputParams[i] ? CPA_STATUS_RESOURCE : status);
+            &(pInternalOutMemList[i]),
+            &(pParamInfo->pkeOutputParams[i]),
+            pCounts,
+            instanceHandle);
         LAC_CHECK_STATUS(status);
     }
 
     return status;
 }
 
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Restores one parameter of a PKE request
+ *
+ * @description
+ *      Undoes LacPke_ResizeParam. Padded output parameters are copied back
+ *  to the client buffer. Buffers from the resize pool are freed, the arena
+ *  is released with the request chain.
+ *
+ * @param[in] pArena          operand arena of the request chain, or NULL
+ * @param[in] pUserData       parameter data
+ * @param[in] userLen         parameter length in bytes
+ * @param[in] pWorkingData    operand passed to the QAT
+ * @param[in] workingLen      operand size in bytes
+ * @param[in] copyBuf         CPA_TRUE to copy the result back
+ * @param[in,out] pCounts     marshalling counters of the request
+ *
+ * @retval CPA_STATUS_SUCCESS       No error
+ * @retval CPA_STATUS_INVALID_PARAM Invalid buffer sizes
+ ***************************************************************************/
+STATIC
+CpaStatus LacPke_RestoreParam(const Cpa8U *pArena,
+                              Cpa8U *pUserData,
+                              Cpa32U userLen,
+                              Cpa8U *pWorkingData,
+                              Cpa32U workingLen,
+                              CpaBoolean copyBuf,
+                              icp_sal_pke_resize_stats_t *pCounts)
+{
+    if (pUserData == pWorkingData)
+    {
+        return CPA_STATUS_SUCCESS;
+    }
+
+    if (CPA_TRUE == copyBuf)
+    {
+        pCounts->numBytesCopied += userLen;
+    }
+
+    if ((NULL != pArena) && (pWorkingData >= pArena) &&
+        (pWorkingData < pArena + LAC_PKE_OPERAND_ARENA_SIZE))
+    {
+        if ((CPA_TRUE == copyBuf) && (userLen))
+        {
+            /* Copy from the arena to the user buffer */
+            memcpy(pUserData, pWorkingData + (workingLen - userLen), userLen);
+        }
+        return CPA_STATUS_SUCCESS;
+    }
+
+    return icp_LacBufferRestore(
+        pUserData, userLen, pWorkingData, workingLen, copyBuf);
+}
+
 /**
  ***************************************************************************
  * @ingroup LacAsymCommonQatComms
@@ -256,31 +442,36 @@ CpaStatus LacPke_ResizeParams(lac_pke_qat_req_data_param_info_t *pParamInfo,
  *
  * @description
  *      This function restores the flat buffer parameters for a PKE request, by
- * calling icp_LacBufferRestore for each input/output flat buffer parameter in
+ * calling LacPke_RestoreParam for each input/output flat buffer parameter in
  * the request data structure.  LacPke_ResizeParams is the corresponding
  * function for doing the buffer resize.
  *
- * @param pParamInfo        IN  The data pointers from the pkeInputParams and
- *                              pkeOutputParams arrays are restored and stored
- *                              in the data pointers of the flat buffers in
- *                              the clientInputParams and clientOutputParams
- *                              arrays respectively.  The pke...Params arrays
- *                              are processed one-by-one from the start, and
- *                              processing ends once a NULL parameter is
- *                              encountered.  Consequently, the
- *                              client...Params arrays should be initialized
- *                              to zero as NULL inputs won't be written as
- *                              NULL outputs.
+ * @param pReqData          IN  The data pointers from the pkeInputParams and
+ *                              pkeOutputParams arrays of the param info are
+ *                              restored and stored in the data pointers of
+ *                              the flat buffers in the clientInputParams and
+ *                              clientOutputParams arrays respectively.  The
+ *                              pke...Params arrays are processed one-by-one
+ *                              from the start, and processing ends once a
+ *                              NULL parameter is encountered.  Consequently,
+ *                              the client...Params arrays should be
+ *                              initialized to zero as NULL inputs won't be
+ *                              written as NULL outputs.
+ * @param pArena            IN  operand arena of the request chain, or NULL
+ * @param pCounts           IN/OUT  marshalling counters of the request
  *
  * @retval CPA_STATUS_SUCCESS       No error
  * @retval CPA_STATUS_RESOURCE       Resource error (e.g. failed memory free)
  *
  * @see LacPke_ResizeParams()
- * @see icp_LacBufferRestore()
+ * @see LacPke_RestoreParam()
  ***************************************************************************/
 STATIC
-CpaStatus LacPke_RestoreParams(lac_pke_qat_req_data_param_info_t *pParamInfo)
+CpaStatus LacPke_RestoreParams(lac_pke_qat_req_data_t *pReqData,
+                               const Cpa8U *pArena,
+                               icp_sal_pke_resize_stats_t *pCounts)
 {
+    lac_pke_qat_req_data_param_info_t *pParamInfo = &pReqData->paramInfo;
     CpaStatus status = CPA_STATUS_SUCCESS;
     Cpa32U i = 0;
 
@@ -301,12 +492,14 @@ CpaStatus LacPke_RestoreParams(lac_pke_qat_req_data_param_info_t *pParamInfo)
                          ? (dataLen - pParamInfo->inArgSizeList[i])
                          : 0;
         }
-        status = icp_LacBufferRestore(
+        status = LacPke_RestoreParam(
+            pArena,
             pParamInfo->clientInputParams[i]->pData + offset,
             dataLen - offset,
             pParamInfo->pkeInputParams[i],
             LAC_ALIGN_POW2_ROUNDUP(dataRoundLen, LAC_QUAD_WORD_IN_BYTES),
-            CPA_FALSE);
+            CPA_FALSE,
+            pCounts);
         LAC_CHECK_STATUS(status);
     }
 
@@ -326,12 +519,14 @@ CpaStatus LacPke_RestoreParams(lac_pke_qat_req_data_param_info_t *pParamInfo)
                          ? (dataLen - pParamInfo->outArgSizeList[i])
                          : 0;
         }
-        status = icp_LacBufferRestore(
+        status = LacPke_RestoreParam(
+            pArena,
             pParamInfo->clientOutputParams[i]->pData + offset,
             dataLen - offset,
             pParamInfo->pkeOutputParams[i],
             LAC_ALIGN_POW2_ROUNDUP(dataRoundLen, LAC_QUAD_WORD_IN_BYTES),
-            CPA_TRUE);
+            CPA_TRUE,
+            pCounts);
         LAC_CHECK_STATUS(status);
     }
 
@@ -341,27 +536,49 @@ CpaStatus LacPke_RestoreParams(lac_pke_qat_req_data_param_info_t *pParamInfo)
 /**
  ***************************************************************************
  * @ingroup LacAsymCommonQatComms
- *      Destroys a PKE request
- *
- * @description
- *      This function destroys a PKE request that was created using
- * LacPke_CreateRequest().  It should be called if an error occurs during
- * request create or request send, or else as part of the response callback.
- *
- * @param pRequestHandle    IN  Pointer to the request handle that identifies
- *                              the request to be destroyed.  The request
- *                              handle will get set to LAC_PKE_INVALID_HANDLE.
+ *      Adds the marshalling counters of a request to the instance counters
  *
- * @retval CPA_STATUS_SUCCESS       No error
- * @retval CPA_STATUS_RESOURCE       Resource error (e.g. failed memory free)
- *
- * @see LacPke_CreateRequest()
+ * @param[in] pCounts         marshalling counters of the request
+ * @param[in] instanceHandle  instanceHandle
  ***************************************************************************/
 STATIC
+void LacPke_StatsAdd(const icp_sal_pke_resize_stats_t *pCounts,
+                     CpaInstanceHandle instanceHandle)
+{
+#ifndef DISABLE_STATS
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+    Cpa32U i = 0;
+
+    if (CPA_TRUE != pCryptoService->generic_service_info.stats->bStatsEnabled)
+    {
+        return;
+    }
+
+    for (i = 0; i < LAC_PKE_RESIZE_NUM_STATS; i++)
+    {
+        Cpa64U value = ((const Cpa64U *)pCounts)[i];
+
+        if (value)
+        {
+            LacStats_Add(&pCryptoService->lacPkeResizeStats, i, value);
+        }
+    }
+#endif
+}
+
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Destroys a PKE request
+ ***************************************************************************/
 CpaStatus LacPke_DestroyRequest(lac_pke_request_handle_t *pRequestHandle)
 {
     CpaStatus status = CPA_STATUS_SUCCESS;
     lac_pke_qat_req_data_t *pReqData = NULL;
+    icp_sal_pke_resize_stats_t counts = {0};
+    CpaInstanceHandle instanceHandle = NULL;
+    Cpa8U *pArena = NULL;
 
     /* extract head request data pointer from the request handle */
     pReqData = *pRequestHandle;
@@ -369,6 +586,13 @@ CpaStatus LacPke_DestroyRequest(lac_pke_request_handle_t *pRequestHandle)
     /* invalidate the request handle */
     *pRequestHandle = LAC_PKE_INVALID_HANDLE;
 
+    if (NULL != pReqData)
+    {
+        instanceHandle = pReqData->cbInfo.instanceHandle;
+        /* the arena is freed once every request of the chain is restored */
+        pArena = pReqData->pOperandArena;
+    }
+
     /* free all request data structures in the chain - continue even in
        the case of errors */
     while (NULL != pReqData)
@@ -376,7 +600,8 @@ CpaStatus LacPke_DestroyRequest(lac_pke_request_handle_t *pRequestHandle)
         lac_pke_qat_req_data_t *pNextReqData = pReqData->pNextReqData;
 
         /* restore parameters (i.e. undo resizing) */
-        if (CPA_STATUS_SUCCESS != LacPke_RestoreParams(&pReqData->paramInfo))
+        if (CPA_STATUS_SUCCESS !=
+            LacPke_RestoreParams(pReqData, pArena, &counts))
         {
             status = CPA_STATUS_RESOURCE;
         }
@@ -388,6 +613,16 @@ CpaStatus LacPke_DestroyRequest(lac_pke_request_handle_t *pRequestHandle)
         pReqData = pNextReqData;
     }
 
+    if (NULL != pArena)
+    {
+        Lac_MemPoolEntryFree(pArena);
+    }
+
+    if (NULL != instanceHandle)
+    {
+        LacPke_StatsAdd(&counts, instanceHandle);
+    }
+
     return status;
 }
 
@@ -407,6 +642,9 @@ void LacPke_MsgCallback(void *pRespMsg)
     lac_pke_qat_req_data_t *pReqData = NULL;
     lac_pke_op_cb_func_t pCbFunc = NULL;
     lac_pke_op_cb_data_t cbData = {0};
+#ifdef ICP_PKE_PROFILE
+    Cpa64U timeStamp = 0;
+#endif
 #ifdef KPT
     icp_qat_fw_comn_resp_hdr_t *pRespMsgFn =
         (icp_qat_fw_comn_resp_hdr_t *)pRespMsg;
@@ -436,6 +674,8 @@ void LacPke_MsgCallback(void *pRespMsg)
     }
 #endif
 
+    LAC_PKE_PROFILE_TIMESTAMP(timeStamp);
+
     /* cast response message to PKE response message type */
     pPkeRespMsg = (icp_qat_fw_pke_resp_t *)pRespMsg;
 
@@ -497,6 +737,9 @@ void LacPke_MsgCallback(void *pRespMsg)
         status = CPA_STATUS_UNSUPPORTED;
     }
 
+    LAC_PKE_PROFILE_END(
+        instanceHandle, ICP_SAL_PKE_PROFILE_CALLBACK, timeStamp);
+
     /* call the client callback */
     (*pCbFunc)(status, pass, instanceHandle, &cbData);
 }
@@ -563,15 +806,24 @@ CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
                                icp_qat_fw_mmp_output_param_t *pOutArgList,
                                CpaBoolean *pInternalInMemList,
                                CpaBoolean *pInternalOutMemList,
+                               const Cpa64U *pInArgPhysList,
                                lac_pke_op_cb_func_t pPkeOpCbFunc,
                                lac_pke_op_cb_data_t *pCbData,
                                CpaInstanceHandle instanceHandle)
 {
     CpaStatus status = CPA_STATUS_SUCCESS;
     lac_pke_qat_req_data_t *pReqData = NULL;
+    icp_sal_pke_resize_stats_t counts = {0};
     size_t i = 0;
     sal_crypto_service_t *pCryptoService =
         (sal_crypto_service_t *)instanceHandle;
+#ifdef ICP_PKE_PROFILE
+    Cpa64U timeStamp = 0;
+    Cpa64U resizeStart = 0;
+    Cpa64U resizeCycles = 0;
+#endif
+
+    LAC_PKE_PROFILE_TIMESTAMP(timeStamp);
 
     /* allocate request data */
     do
@@ -607,7 +859,6 @@ CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
                                        LAC_OPTIMAL_ALIGNMENT_SHIFT),
                    "outArgList structure not correctly aligned");
 
-
         /* initialize handle for single request, or first in a chain */
         if (*pRequestHandle == LAC_PKE_INVALID_HANDLE)
         {
@@ -619,6 +870,10 @@ CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
             pReqData->pHeadReqData = pReqData;
             /* note: tail pointer is only valid in head request data struct */
             pReqData->pTailReqData = pReqData;
+
+            /* the arena is taken for the first padded operand of the chain */
+            pReqData->pOperandArena = NULL;
+            pReqData->arenaUsed = 0;
         }
         else /* handle second or subsequent request in a chain */
         {
@@ -643,6 +898,7 @@ CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
             pReqData->pNextReqData = NULL;
             pReqData->pHeadReqData = pHeadReqData;
             /* note: tail pointer not stored here as it changes (unlike head) */
+            pReqData->pOperandArena = NULL;
         }
 
         /* populate request data structure */
@@ -694,10 +950,16 @@ CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
         }
 
         /* resize parameters */
-        status = LacPke_ResizeParams(&pReqData->paramInfo,
+        LAC_PKE_PROFILE_TIMESTAMP(resizeStart);
+        status = LacPke_ResizeParams(pReqData,
                                      pInternalInMemList,
                                      pInternalOutMemList,
+                                     &counts,
                                      instanceHandle);
+        LacPke_StatsAdd(&counts, instanceHandle);
+#ifdef ICP_PKE_PROFILE
+        resizeCycles = LacPke_ProfileTimestamp() - resizeStart;
+#endif
     }
 
     if (CPA_STATUS_SUCCESS == status)
@@ -716,7 +978,15 @@ CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
                     (NULL != pReqData->paramInfo.pkeInputParams[i]);
              i++)
         {
-            if (CPA_TRUE == pInternalInMemList[i])
+            if ((NULL != pInArgPhysList) && (0 != pInArgPhysList[i]) &&
+                (pReqData->paramInfo.pkeInputParams[i] ==
+                 pReqData->paramInfo.clientInputParams[i]->pData))
+            {
+                /* the caller translated the address of the (unresized)
+                   param when it was allocated */
+                pReqData->u2.inArgList.flat_array[i] = pInArgPhysList[i];
+            }
+            else if (CPA_TRUE == pInternalInMemList[i])
             {
                 /* pkeInputParams[i] is referencing internally allocated
                    memory */
@@ -764,6 +1034,14 @@ CpaStatus LacPke_CreateRequest(lac_pke_request_handle_t *pRequestHandle,
         /* Complete LW12 */
         pReqData->u1.request.input_param_count = numInputParams;
         pReqData->u1.request.output_param_count = numOutputParams;
+
+        /* the resize is profiled on its own */
+        LAC_PKE_PROFILE_ADD(
+            instanceHandle, ICP_SAL_PKE_PROFILE_RESIZE, resizeCycles);
+        LAC_PKE_PROFILE_ADD(instanceHandle,
+                            ICP_SAL_PKE_PROFILE_CREATE_REQUEST,
+                            LacPke_ProfileTimestamp() - timeStamp -
+                                resizeCycles);
     }
 
     /* clean up in the event of an error */
@@ -788,6 +1066,9 @@ CpaStatus LacPke_SendRequest(lac_pke_request_handle_t *pRequestHandle,
     lac_pke_qat_req_data_t *pHeadReqData = NULL;
     sal_crypto_service_t *pCryptoService =
         (sal_crypto_service_t *)instanceHandle;
+#ifdef ICP_PKE_PROFILE
+    Cpa64U timeStamp = 0;
+#endif
 
     LAC_ASSERT_NOT_NULL(pRequestHandle);
 
@@ -796,6 +1077,7 @@ CpaStatus LacPke_SendRequest(lac_pke_request_handle_t *pRequestHandle,
     LAC_ASSERT_NOT_NULL(pHeadReqData);
 
     /* send the request (chain) */
+    LAC_PKE_PROFILE_TIMESTAMP(timeStamp);
     status = SalQatMsg_transPutMsg(pCryptoService->trans_handle_asym_tx,
                                    (void *)&(pHeadReqData->u1.request),
                                    LAC_QAT_ASYM_REQ_SZ_LW,
@@ -807,7 +1089,85 @@ CpaStatus LacPke_SendRequest(lac_pke_request_handle_t *pRequestHandle,
         (void)LacPke_DestroyRequest(pRequestHandle);
         return status;
     }
+    LAC_PKE_PROFILE_END(
+        instanceHandle, ICP_SAL_PKE_PROFILE_RING_PUT, timeStamp);
+
+    return status;
+}
+
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      PKE request burst send to QAT
+ ***************************************************************************/
+CpaStatus LacPke_SendRequests(lac_pke_request_handle_t *pRequestHandles,
+                              Cpa32U numRequests,
+                              CpaInstanceHandle instanceHandle,
+                              Cpa32U *pNumSent)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_pke_qat_req_data_t *pHeadReqData = NULL;
+    void *pMsgs[LAC_PKE_SEND_BURST_SIZE];
+    Cpa32U numSent = 0;
+    Cpa32U numPut = 0;
+    Cpa32U numMsgs = 0;
+    Cpa32U i = 0;
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+#ifdef ICP_PKE_PROFILE
+    Cpa64U timeStamp = 0;
+#endif
+
+    LAC_ASSERT_NOT_NULL(pRequestHandles);
+    LAC_ASSERT_NOT_NULL(pNumSent);
+
+    while ((numSent < numRequests) && (CPA_STATUS_SUCCESS == status))
+    {
+        numMsgs = numRequests - numSent;
+        if (numMsgs > LAC_PKE_SEND_BURST_SIZE)
+        {
+            numMsgs = LAC_PKE_SEND_BURST_SIZE;
+        }
+
+        /* collect the head request of each (chain) */
+        for (i = 0; i < numMsgs; i++)
+        {
+            pHeadReqData = pRequestHandles[numSent + i];
+            LAC_ASSERT_NOT_NULL(pHeadReqData);
+            pMsgs[i] = (void *)&(pHeadReqData->u1.request);
+        }
+
+        /* send the burst */
+        numPut = 0;
+        LAC_PKE_PROFILE_TIMESTAMP(timeStamp);
+        status = SalQatMsg_transPutMsgs(pCryptoService->trans_handle_asym_tx,
+                                        pMsgs,
+                                        LAC_QAT_ASYM_REQ_SZ_LW,
+                                        numMsgs,
+                                        &numPut,
+                                        LAC_LOG_MSG_PKE);
+#ifdef ICP_PKE_PROFILE
+        if (numPut > 0)
+        {
+            LAC_PKE_PROFILE_END(
+                instanceHandle, ICP_SAL_PKE_PROFILE_RING_PUT, timeStamp);
+        }
+#endif
+        numSent += numPut;
+        if ((CPA_STATUS_SUCCESS == status) && (numPut < numMsgs))
+        {
+            /* ring is full */
+            status = CPA_STATUS_RETRY;
+        }
+    }
 
+    /* destroy the request (chains) which were not sent */
+    for (i = numSent; i < numRequests; i++)
+    {
+        (void)LacPke_DestroyRequest(&pRequestHandles[i]);
+    }
+
+    *pNumSent = numSent;
     return status;
 }
 
@@ -839,6 +1199,7 @@ CpaStatus LacPke_SendSingleRequest(Cpa32U functionalityId,
                                   pOutArgList,
                                   pInMemBool,
                                   pOutMemBool,
+                                  NULL,
                                   pPkeOpCbFunc,
                                   pCbData,
                                   instanceHandle);
@@ -851,3 +1212,152 @@ CpaStatus LacPke_SendSingleRequest(Cpa32U functionalityId,
 
     return status;
 }
+
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Operand marshalling and profile counters init
+ ***************************************************************************/
+CpaStatus LacPke_StatsInit(CpaInstanceHandle instanceHandle)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+
+    status = LacStats_Init(&pCryptoService->lacPkeResizeStats,
+                           LAC_PKE_RESIZE_NUM_STATS);
+#ifdef ICP_PKE_PROFILE
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = LacStats_Init(&pCryptoService->lacPkeProfileStats,
+                               LAC_PKE_PROFILE_NUM_STATS);
+    }
+#endif
+    return status;
+}
+
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Operand marshalling and profile counters free
+ ***************************************************************************/
+void LacPke_StatsFree(CpaInstanceHandle instanceHandle)
+{
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+
+    LacStats_Free(&pCryptoService->lacPkeResizeStats);
+    LacStats_Free(&pCryptoService->lacPkeProfileStats);
+}
+
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Operand marshalling counters query
+ ***************************************************************************/
+CpaStatus icp_sal_CyGetPkeResizeStats(CpaInstanceHandle instanceHandle_in,
+                                      icp_sal_pke_resize_stats_t *pStats)
+{
+    CpaInstanceHandle instanceHandle = NULL;
+    sal_crypto_service_t *pCryptoService = NULL;
+    Cpa32U i = 0;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+    LAC_CHECK_NULL_PARAM(pStats);
+
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+
+    for (i = 0; i < LAC_PKE_RESIZE_NUM_STATS; i++)
+    {
+        ((Cpa64U *)pStats)[i] =
+            LacStats_Get(&pCryptoService->lacPkeResizeStats, i);
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Host cycle profile query
+ ***************************************************************************/
+CpaStatus icp_sal_CyGetPkeProfile(CpaInstanceHandle instanceHandle_in,
+                                  icp_sal_pke_profile_t *pProfile)
+{
+    CpaInstanceHandle instanceHandle = NULL;
+#ifdef ICP_PKE_PROFILE
+    sal_crypto_service_t *pCryptoService = NULL;
+    Cpa32U i = 0;
+#endif
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+    LAC_CHECK_NULL_PARAM(pProfile);
+
+#ifdef ICP_PKE_PROFILE
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+
+    for (i = 0; i < LAC_PKE_PROFILE_NUM_STATS; i++)
+    {
+        ((Cpa64U *)pProfile)[i] =
+            LacStats_Get(&pCryptoService->lacPkeProfileStats, i);
+    }
+    return CPA_STATUS_SUCCESS;
+#else
+    return CPA_STATUS_UNSUPPORTED;
+#endif
+}
+
+/**
+ ***************************************************************************
+ * @ingroup LacAsymCommonQatComms
+ *      Host cycle profile reset
+ ***************************************************************************/
+CpaStatus icp_sal_CyResetPkeProfile(CpaInstanceHandle instanceHandle_in)
+{
+    CpaInstanceHandle instanceHandle = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+
+#ifdef ICP_PKE_PROFILE
+    LacStats_Reset(
+        &((sal_crypto_service_t *)instanceHandle)->lacPkeProfileStats);
+    return CPA_STATUS_SUCCESS;
+#else
+    return CPA_STATUS_UNSUPPORTED;
+#endif
+}
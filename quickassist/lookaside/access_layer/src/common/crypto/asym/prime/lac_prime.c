@@ -915,6 +915,7 @@ CpaStatus cpaCyPrimeTest(const CpaInstanceHandle instanceHandle_in,
                                           &outArgList,
                                           internalMemInList,
                                           NULL,
+                                          NULL,
                                           LacPrimeTestCallback,
                                           &primeTestData,
                                           instanceHandle);
@@ -557,6 +557,7 @@ LacKptRsa_Type1Decrypt(const CpaInstanceHandle instanceHandle,
                                           &out,
                                           internalMemInList,
                                           internalMemOutList,
+                                          NULL,
                                           LacKptRsaType1_ProcessDecCb,
                                           &cbData,
                                           instanceHandle);
@@ -789,6 +790,7 @@ LacKptRsa_Type2Decrypt(const CpaInstanceHandle instanceHandle,
                                           &out,
                                           internalMemInList,
                                           internalMemOutList,
+                                          NULL,
                                           LacKptRsaType2_ProcessDecCb,
                                           &cbData,
                                           instanceHandle);
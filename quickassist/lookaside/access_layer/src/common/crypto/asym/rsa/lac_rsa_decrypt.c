@@ -53,6 +53,8 @@
 
 #include "cpa.h"
 #include "cpa_cy_rsa.h"
+#include "icp_sal_asym_batch.h"
+#include "icp_sal_rsa_key_context.h"
 
 /*
 ********************************************************************************
@@ -78,6 +80,7 @@
 #include "lac_pke_qat_comms.h"
 #include "lac_pke_utils.h"
 #include "lac_pke_mmp.h"
+#include "lac_pke_profile.h"
 #include "lac_sym.h"
 #include "lac_list.h"
 #include "sal_service_state.h"
@@ -140,22 +143,56 @@ STATIC void LacRsa_ProcessDecCb(CpaStatus status,
                                 lac_pke_op_cb_data_t *pCbData);
 
 /*
- * This function performs RSA Decrypt for type 1 private keys.
+ * This function is the callback of a decrypt with a private key context. It
+ * releases the context before completing the request as
+ * LacRsa_ProcessDecCb does.
+ */
+STATIC void LacRsa_ProcessDecKeyContextCb(CpaStatus status,
+                                          CpaBoolean pass,
+                                          CpaInstanceHandle instanceHandle,
+                                          lac_pke_op_cb_data_t *pCbData);
+
+/*
+ * This function performs RSA Decrypt for type 1 private keys. If
+ * pRequestHandle is not NULL the request is only created, not sent.
  */
 STATIC CpaStatus LacRsa_Type1Decrypt(const CpaInstanceHandle instanceHandle,
                                      const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
                                      void *pCallbackTag,
                                      const CpaCyRsaDecryptOpData *pDecryptData,
-                                     CpaFlatBuffer *pOutputData);
+                                     CpaFlatBuffer *pOutputData,
+                                     lac_pke_request_handle_t *pRequestHandle);
 
 /*
- * This function performs RSA Decrypt for type 2 private keys.
+ * This function performs RSA Decrypt for type 2 private keys. If
+ * pRequestHandle is not NULL the request is only created, not sent.
  */
 STATIC CpaStatus LacRsa_Type2Decrypt(const CpaInstanceHandle instanceHandle,
                                      const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
                                      void *pCallbackTag,
                                      const CpaCyRsaDecryptOpData *pDecryptData,
-                                     CpaFlatBuffer *pOutputData);
+                                     CpaFlatBuffer *pOutputData,
+                                     lac_pke_request_handle_t *pRequestHandle);
+
+/*
+ * This function builds the request of a type 2 decrypt from the CRT
+ * components in pPrivateKeyRep2 and sends it, or only creates it if
+ * pRequestHandle is not NULL. When pKeyContext is not NULL the components
+ * are those of the context, whose in flight count is decremented by the
+ * callback.
+ */
+STATIC CpaStatus
+LacRsa_Type2DecryptRequest(const CpaInstanceHandle instanceHandle,
+                           const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
+                           void *pCallbackTag,
+                           const void *pClientOpData,
+                           Cpa32U functionalityId,
+                           Cpa32U opSizeInBytes,
+                           const CpaFlatBuffer *pInputData,
+                           const CpaCyRsaPrivateKeyRep2 *pPrivateKeyRep2,
+                           lac_rsa_key_context_t *pKeyContext,
+                           CpaFlatBuffer *pOutputData,
+                           lac_pke_request_handle_t *pRequestHandle);
 
 /*
  * This is the LAC RSA Decrypt synchronous function.
@@ -177,6 +214,14 @@ CpaStatus cpaCyRsaDecrypt(const CpaInstanceHandle instanceHandle_in,
 {
     CpaStatus status = CPA_STATUS_SUCCESS;
     CpaInstanceHandle instanceHandle = NULL;
+#ifdef ICP_PKE_PROFILE
+    Cpa64U timeStamp = 0;
+#ifdef ICP_PARAM_CHECK
+    Cpa64U checkStart = 0;
+#endif
+#endif
+
+    LAC_PKE_PROFILE_TIMESTAMP(timeStamp);
 #ifdef ICP_TRACE
     LAC_LOG5("Called with params (0x%lx, 0x%lx, 0x%lx, 0x%lx, "
              "0x%lx)\n",
@@ -212,8 +257,16 @@ CpaStatus cpaCyRsaDecrypt(const CpaInstanceHandle instanceHandle_in,
     }
 #ifdef ICP_PARAM_CHECK
     /* Check RSA Decrypt params and return an error if invalid */
+    LAC_PKE_PROFILE_TIMESTAMP(checkStart);
     status = LacRsa_DecryptParamsCheck(
         instanceHandle, pRsaDecryptCb, pDecryptData, pOutputData);
+#ifdef ICP_PKE_PROFILE
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        LAC_PKE_PROFILE_END(
+            instanceHandle, ICP_SAL_PKE_PROFILE_PARAM_CHECK, checkStart);
+    }
+#endif
 #endif
     if (CPA_STATUS_SUCCESS == status)
     {
@@ -224,7 +277,8 @@ CpaStatus cpaCyRsaDecrypt(const CpaInstanceHandle instanceHandle_in,
                                          pRsaDecryptCb,
                                          pCallbackTag,
                                          pDecryptData,
-                                         pOutputData);
+                                         pOutputData,
+                                         NULL);
         }
         else /* Must be type2 key as param check has passed */
         {
@@ -232,7 +286,8 @@ CpaStatus cpaCyRsaDecrypt(const CpaInstanceHandle instanceHandle_in,
                                          pRsaDecryptCb,
                                          pCallbackTag,
                                          pDecryptData,
-                                         pOutputData);
+                                         pOutputData,
+                                         NULL);
         }
     }
 
@@ -240,6 +295,8 @@ CpaStatus cpaCyRsaDecrypt(const CpaInstanceHandle instanceHandle_in,
     if (CPA_STATUS_SUCCESS == status)
     {
         LAC_RSA_STAT_INC(numRsaDecryptRequests, instanceHandle);
+        LAC_PKE_PROFILE_END(
+            instanceHandle, ICP_SAL_PKE_PROFILE_SUBMIT, timeStamp);
     }
     else
     {
@@ -249,6 +306,166 @@ CpaStatus cpaCyRsaDecrypt(const CpaInstanceHandle instanceHandle_in,
     return status;
 }
 
+/**
+ *****************************************************************************
+ * @ingroup LacRsa
+ *
+ *****************************************************************************/
+CpaStatus icp_sal_CyRsaDecryptBatch(
+    const CpaInstanceHandle instanceHandle_in,
+    const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
+    Cpa32U numRequests,
+    icp_sal_rsa_decrypt_batch_op_data_t *pBatchOpData,
+    Cpa32U *pNumSubmitted)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaStatus sendStatus = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    icp_sal_rsa_decrypt_batch_op_data_t *pEntry = NULL;
+    lac_pke_request_handle_t requestHandles[LAC_PKE_SEND_BURST_SIZE];
+    Cpa32U numDone = 0;
+    Cpa32U numMsgs = 0;
+    Cpa32U numBuilt = 0;
+    Cpa32U numSent = 0;
+    Cpa32U i = 0;
+#ifdef ICP_TRACE
+    LAC_LOG5("Called with params (0x%lx, 0x%lx, %u, 0x%lx, 0x%lx)\n",
+             (LAC_ARCH_UINT)instanceHandle_in,
+             (LAC_ARCH_UINT)pRsaDecryptCb,
+             numRequests,
+             (LAC_ARCH_UINT)pBatchOpData,
+             (LAC_ARCH_UINT)pNumSubmitted);
+#endif
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_ADDR_TRANS_SETUP(instanceHandle);
+#endif
+    SAL_RUNNING_CHECK(instanceHandle);
+#ifdef ICP_PARAM_CHECK
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+    LAC_CHECK_NULL_PARAM(pBatchOpData);
+    LAC_CHECK_NULL_PARAM(pNumSubmitted);
+
+    if (0 == numRequests)
+    {
+        LAC_INVALID_PARAM_LOG("Invalid numRequests value");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    /* There is no synchronous mode for a batch */
+    if (NULL == pRsaDecryptCb)
+    {
+        LAC_INVALID_PARAM_LOG("pRsaDecryptCb is NULL");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    *pNumSubmitted = 0;
+
+#ifdef ICP_PARAM_CHECK
+    /* Nothing is submitted unless the whole batch is valid */
+    for (i = 0; i < numRequests; i++)
+    {
+        status = LacRsa_DecryptParamsCheck(instanceHandle,
+                                           pRsaDecryptCb,
+                                           pBatchOpData[i].pDecryptOpData,
+                                           pBatchOpData[i].pOutputData);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            LAC_RSA_STAT_INC(numRsaDecryptRequestErrors, instanceHandle);
+            return status;
+        }
+    }
+#endif
+
+    while ((numDone < numRequests) && (CPA_STATUS_SUCCESS == status))
+    {
+        numMsgs = numRequests - numDone;
+        if (numMsgs > LAC_PKE_SEND_BURST_SIZE)
+        {
+            numMsgs = LAC_PKE_SEND_BURST_SIZE;
+        }
+
+        for (numBuilt = 0; numBuilt < numMsgs; numBuilt++)
+        {
+            pEntry = &pBatchOpData[numDone + numBuilt];
+            requestHandles[numBuilt] = LAC_PKE_INVALID_HANDLE;
+
+            if (CPA_CY_RSA_PRIVATE_KEY_REP_TYPE_1 ==
+                pEntry->pDecryptOpData->pRecipientPrivateKey
+                    ->privateKeyRepType)
+            {
+                status = LacRsa_Type1Decrypt(instanceHandle,
+                                             pRsaDecryptCb,
+                                             pEntry->pCallbackTag,
+                                             pEntry->pDecryptOpData,
+                                             pEntry->pOutputData,
+                                             &requestHandles[numBuilt]);
+            }
+            else
+            {
+                status = LacRsa_Type2Decrypt(instanceHandle,
+                                             pRsaDecryptCb,
+                                             pEntry->pCallbackTag,
+                                             pEntry->pDecryptOpData,
+                                             pEntry->pOutputData,
+                                             &requestHandles[numBuilt]);
+            }
+
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                LAC_RSA_STAT_INC(numRsaDecryptRequestErrors, instanceHandle);
+                break;
+            }
+        }
+
+        /* A burst is only sent once all of it is built, so a failure
+         * never leaves part of a burst on the ring. Requests which do not
+         * fit on the ring are destroyed by LacPke_SendRequests. */
+        numSent = 0;
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            sendStatus = LacPke_SendRequests(
+                requestHandles, numBuilt, instanceHandle, &numSent);
+        }
+        else
+        {
+            for (i = 0; i < numBuilt; i++)
+            {
+                (void)LacPke_DestroyRequest(&requestHandles[i]);
+            }
+        }
+
+        for (i = 0; i < numSent; i++)
+        {
+            LAC_RSA_STAT_INC(numRsaDecryptRequests, instanceHandle);
+        }
+        for (i = numSent; i < numBuilt; i++)
+        {
+            LAC_RSA_STAT_INC(numRsaDecryptRequestErrors, instanceHandle);
+        }
+
+        numDone += numSent;
+        if ((CPA_STATUS_SUCCESS == status) && (numSent < numBuilt))
+        {
+            status = sendStatus;
+        }
+    }
+
+    *pNumSubmitted = numDone;
+    return status;
+}
+
 STATIC CpaStatus LacRsa_DecryptSynch(const CpaInstanceHandle instanceHandle,
                                      const CpaCyRsaDecryptOpData *pDecryptData,
                                      CpaFlatBuffer *pOutputData)
@@ -385,7 +602,8 @@ CpaStatus LacRsa_Type1Decrypt(const CpaInstanceHandle instanceHandle,
                               const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
                               void *pCallbackTag,
                               const CpaCyRsaDecryptOpData *pDecryptData,
-                              CpaFlatBuffer *pOutputData)
+                              CpaFlatBuffer *pOutputData,
+                              lac_pke_request_handle_t *pRequestHandle)
 {
     Cpa32U opSizeInBytes = 0;
     Cpa32U functionalityId = LAC_PKE_INVALID_FUNC_ID;
@@ -461,17 +679,36 @@ CpaStatus LacRsa_Type1Decrypt(const CpaInstanceHandle instanceHandle,
         LAC_RSA_TIMESTAMP_BEGIN(
             &cbData, LAC_RSA_DECRYPT_REQUEST, instanceHandle);
 
-        /* send a PKE request to the QAT */
-        status = LacPke_SendSingleRequest(functionalityId,
+        if (NULL == pRequestHandle)
+        {
+            /* send a PKE request to the QAT */
+            status = LacPke_SendSingleRequest(functionalityId,
+                                              pInArgSizeList,
+                                              pOutArgSizeList,
+                                              &in,
+                                              &out,
+                                              internalMemInList,
+                                              internalMemOutList,
+                                              LacRsa_ProcessDecCb,
+                                              &cbData,
+                                              instanceHandle);
+        }
+        else
+        {
+            /* build the PKE request, the caller sends it */
+            status = LacPke_CreateRequest(pRequestHandle,
+                                          functionalityId,
                                           pInArgSizeList,
                                           pOutArgSizeList,
                                           &in,
                                           &out,
                                           internalMemInList,
                                           internalMemOutList,
+                                          NULL,
                                           LacRsa_ProcessDecCb,
                                           &cbData,
                                           instanceHandle);
+        }
     }
 
     return status;
@@ -481,18 +718,12 @@ CpaStatus LacRsa_Type2Decrypt(const CpaInstanceHandle instanceHandle,
                               const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
                               void *pCallbackTag,
                               const CpaCyRsaDecryptOpData *pDecryptData,
-                              CpaFlatBuffer *pOutputData)
+                              CpaFlatBuffer *pOutputData,
+                              lac_pke_request_handle_t *pRequestHandle)
 {
     Cpa32U opSizeInBytes = 0;
     Cpa32U functionalityId = LAC_PKE_INVALID_FUNC_ID;
     CpaStatus status = CPA_STATUS_FAIL;
-    Cpa32U pInArgSizeList[LAC_MAX_MMP_INPUT_PARAMS] = {0};
-    Cpa32U pOutArgSizeList[LAC_MAX_MMP_OUTPUT_PARAMS] = {0};
-    CpaBoolean internalMemInList[LAC_MAX_MMP_INPUT_PARAMS] = {CPA_FALSE};
-    CpaBoolean internalMemOutList[LAC_MAX_MMP_OUTPUT_PARAMS] = {CPA_FALSE};
-    lac_pke_op_cb_data_t cbData = {0};
-    icp_qat_fw_mmp_input_param_t in = {.flat_array = {0}};
-    icp_qat_fw_mmp_output_param_t out = {.flat_array = {0}};
 
     LAC_ASSERT_NOT_NULL(pDecryptData);
     LAC_ASSERT_NOT_NULL(pOutputData);
@@ -511,86 +742,164 @@ CpaStatus LacRsa_Type2Decrypt(const CpaInstanceHandle instanceHandle,
     }
     else
     {
-        /* Zero ms bytes of output buffer */
-        osalMemSet(pOutputData->pData,
-                   0,
-                   (pOutputData->dataLenInBytes - opSizeInBytes));
-
-        /* populate input parameters */
-        LAC_MEM_SHARED_WRITE_FROM_PTR(in.mmp_rsa_dp2_1024.c,
-                                      &(pDecryptData->inputData));
-        pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, c)] =
-            opSizeInBytes;
-        internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, c)] =
-            CPA_FALSE;
-
-        LAC_MEM_SHARED_WRITE_FROM_PTR(
-            in.mmp_rsa_dp2_1024.p,
-            &(pDecryptData->pRecipientPrivateKey->privateKeyRep2.prime1P));
-        pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, p)] =
-            LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
-        internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, p)] =
-            CPA_FALSE;
-
-        LAC_MEM_SHARED_WRITE_FROM_PTR(
-            in.mmp_rsa_dp2_1024.q,
-            &(pDecryptData->pRecipientPrivateKey->privateKeyRep2.prime2Q));
-        pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, q)] =
-            LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
-        internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, q)] =
-            CPA_FALSE;
-
-        LAC_MEM_SHARED_WRITE_FROM_PTR(
-            in.mmp_rsa_dp2_1024.dp,
-            &(pDecryptData->pRecipientPrivateKey->privateKeyRep2.exponent1Dp));
-        pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dp)] =
-            LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
-        internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dp)] =
-            CPA_FALSE;
-
-        LAC_MEM_SHARED_WRITE_FROM_PTR(
-            in.mmp_rsa_dp2_1024.dq,
-            &(pDecryptData->pRecipientPrivateKey->privateKeyRep2.exponent2Dq));
-        pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dq)] =
-            LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
-        internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dq)] =
-            CPA_FALSE;
-
-        LAC_MEM_SHARED_WRITE_FROM_PTR(in.mmp_rsa_dp2_1024.qinv,
-                                      &(pDecryptData->pRecipientPrivateKey
-                                            ->privateKeyRep2.coefficientQInv));
-        pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, qinv)] =
-            LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
-        internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, qinv)] =
-            CPA_FALSE;
+        status = LacRsa_Type2DecryptRequest(
+            instanceHandle,
+            pRsaDecryptCb,
+            pCallbackTag,
+            pDecryptData,
+            functionalityId,
+            opSizeInBytes,
+            &(pDecryptData->inputData),
+            &(pDecryptData->pRecipientPrivateKey->privateKeyRep2),
+            NULL,
+            pOutputData,
+            pRequestHandle);
+    }
 
-        /* populate output parameters */
-        LAC_MEM_SHARED_WRITE_FROM_PTR(out.mmp_rsa_dp2_1024.m, pOutputData);
-        pOutArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_output_t, m)] =
-            opSizeInBytes;
-        internalMemOutList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_output_t, m)] =
-            CPA_FALSE;
+    return status;
+}
 
-        /* populate callback data */
-        cbData.pClientCb = pRsaDecryptCb;
-        cbData.pCallbackTag = pCallbackTag;
-        cbData.pClientOpData = pDecryptData;
-        cbData.pOutputData1 = pOutputData;
+CpaStatus
+LacRsa_Type2DecryptRequest(const CpaInstanceHandle instanceHandle,
+                           const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
+                           void *pCallbackTag,
+                           const void *pClientOpData,
+                           Cpa32U functionalityId,
+                           Cpa32U opSizeInBytes,
+                           const CpaFlatBuffer *pInputData,
+                           const CpaCyRsaPrivateKeyRep2 *pPrivateKeyRep2,
+                           lac_rsa_key_context_t *pKeyContext,
+                           CpaFlatBuffer *pOutputData,
+                           lac_pke_request_handle_t *pRequestHandle)
+{
+    CpaStatus status = CPA_STATUS_FAIL;
+    Cpa32U pInArgSizeList[LAC_MAX_MMP_INPUT_PARAMS] = {0};
+    Cpa32U pOutArgSizeList[LAC_MAX_MMP_OUTPUT_PARAMS] = {0};
+    CpaBoolean internalMemInList[LAC_MAX_MMP_INPUT_PARAMS] = {CPA_FALSE};
+    CpaBoolean internalMemOutList[LAC_MAX_MMP_OUTPUT_PARAMS] = {CPA_FALSE};
+    Cpa64U inArgPhysList[LAC_MAX_MMP_INPUT_PARAMS] = {0};
+    CpaBoolean keyInternalMem = CPA_FALSE;
+    lac_pke_request_handle_t requestHandle = LAC_PKE_INVALID_HANDLE;
+    lac_pke_op_cb_func_t pPkeOpCbFunc = LacRsa_ProcessDecCb;
+    lac_pke_op_cb_data_t cbData = {0};
+    icp_qat_fw_mmp_input_param_t in = {.flat_array = {0}};
+    icp_qat_fw_mmp_output_param_t out = {.flat_array = {0}};
 
-        LAC_RSA_TIMESTAMP_BEGIN(
-            &cbData, LAC_RSA_DECRYPT_REQUEST, instanceHandle);
+    if (NULL != pKeyContext)
+    {
+        /* The components of a context are used in place at the addresses
+         * translated when it was created */
+        keyInternalMem = CPA_TRUE;
+        pPkeOpCbFunc = LacRsa_ProcessDecKeyContextCb;
+        inArgPhysList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, p)] =
+            pKeyContext->paramPhysAddr[0];
+        inArgPhysList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, q)] =
+            pKeyContext->paramPhysAddr[1];
+        inArgPhysList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dp)] =
+            pKeyContext->paramPhysAddr[2];
+        inArgPhysList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dq)] =
+            pKeyContext->paramPhysAddr[3];
+        inArgPhysList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, qinv)] =
+            pKeyContext->paramPhysAddr[4];
+    }
 
-        /* send a PKE request to the QAT */
-        status = LacPke_SendSingleRequest(functionalityId,
-                                          pInArgSizeList,
-                                          pOutArgSizeList,
-                                          &in,
-                                          &out,
-                                          internalMemInList,
-                                          internalMemOutList,
-                                          LacRsa_ProcessDecCb,
-                                          &cbData,
-                                          instanceHandle);
+    /* Zero ms bytes of output buffer */
+    osalMemSet(
+        pOutputData->pData, 0, (pOutputData->dataLenInBytes - opSizeInBytes));
+
+    /* populate input parameters */
+    LAC_MEM_SHARED_WRITE_FROM_PTR(in.mmp_rsa_dp2_1024.c, pInputData);
+    pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, c)] =
+        opSizeInBytes;
+    internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, c)] =
+        CPA_FALSE;
+
+    LAC_MEM_SHARED_WRITE_FROM_PTR(in.mmp_rsa_dp2_1024.p,
+                                  &(pPrivateKeyRep2->prime1P));
+    pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, p)] =
+        LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
+    internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, p)] =
+        keyInternalMem;
+
+    LAC_MEM_SHARED_WRITE_FROM_PTR(in.mmp_rsa_dp2_1024.q,
+                                  &(pPrivateKeyRep2->prime2Q));
+    pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, q)] =
+        LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
+    internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, q)] =
+        keyInternalMem;
+
+    LAC_MEM_SHARED_WRITE_FROM_PTR(in.mmp_rsa_dp2_1024.dp,
+                                  &(pPrivateKeyRep2->exponent1Dp));
+    pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dp)] =
+        LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
+    internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dp)] =
+        keyInternalMem;
+
+    LAC_MEM_SHARED_WRITE_FROM_PTR(in.mmp_rsa_dp2_1024.dq,
+                                  &(pPrivateKeyRep2->exponent2Dq));
+    pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dq)] =
+        LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
+    internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, dq)] =
+        keyInternalMem;
+
+    LAC_MEM_SHARED_WRITE_FROM_PTR(in.mmp_rsa_dp2_1024.qinv,
+                                  &(pPrivateKeyRep2->coefficientQInv));
+    pInArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, qinv)] =
+        LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
+    internalMemInList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_input_t, qinv)] =
+        keyInternalMem;
+
+    /* populate output parameters */
+    LAC_MEM_SHARED_WRITE_FROM_PTR(out.mmp_rsa_dp2_1024.m, pOutputData);
+    pOutArgSizeList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_output_t, m)] =
+        opSizeInBytes;
+    internalMemOutList[LAC_IDX_OF(icp_qat_fw_mmp_rsa_dp2_output_t, m)] =
+        CPA_FALSE;
+
+    /* populate callback data */
+    cbData.pClientCb = pRsaDecryptCb;
+    cbData.pCallbackTag = pCallbackTag;
+    cbData.pClientOpData = pClientOpData;
+    cbData.pOpaqueData = pKeyContext;
+    cbData.pOutputData1 = pOutputData;
+
+    LAC_RSA_TIMESTAMP_BEGIN(&cbData, LAC_RSA_DECRYPT_REQUEST, instanceHandle);
+
+    if (NULL == pRequestHandle)
+    {
+        /* build the PKE request and send it to the QAT */
+        status = LacPke_CreateRequest(&requestHandle,
+                                      functionalityId,
+                                      pInArgSizeList,
+                                      pOutArgSizeList,
+                                      &in,
+                                      &out,
+                                      internalMemInList,
+                                      internalMemOutList,
+                                      inArgPhysList,
+                                      pPkeOpCbFunc,
+                                      &cbData,
+                                      instanceHandle);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = LacPke_SendRequest(&requestHandle, instanceHandle);
+        }
+    }
+    else
+    {
+        /* build the PKE request, the caller sends it */
+        status = LacPke_CreateRequest(pRequestHandle,
+                                      functionalityId,
+                                      pInArgSizeList,
+                                      pOutArgSizeList,
+                                      &in,
+                                      &out,
+                                      internalMemInList,
+                                      internalMemOutList,
+                                      inArgPhysList,
+                                      pPkeOpCbFunc,
+                                      &cbData,
+                                      instanceHandle);
     }
 
     return status;
@@ -631,3 +940,407 @@ void LacRsa_ProcessDecCb(CpaStatus status,
     /* invoke the user callback */
     pCb(pCallbackTag, status, pOpData, pOutputData);
 }
+
+STATIC void LacRsa_ProcessDecKeyContextCb(CpaStatus status,
+                                          CpaBoolean pass,
+                                          CpaInstanceHandle instanceHandle,
+                                          lac_pke_op_cb_data_t *pCbData)
+{
+    lac_rsa_key_context_t *pKeyContext = NULL;
+
+    LAC_ASSERT_NOT_NULL(pCbData);
+    pKeyContext = (lac_rsa_key_context_t *)pCbData->pOpaqueData;
+    LAC_ASSERT_NOT_NULL(pKeyContext);
+
+    /* The QAT no longer reads the components, so the user callback may
+     * destroy the context */
+    osalAtomicDec(&(pKeyContext->numInFlight));
+
+    LacRsa_ProcessDecCb(status, pass, instanceHandle, pCbData);
+}
+
+/* Clears key material in a way the compiler can not drop as a dead store */
+STATIC void LacRsa_KeyContextWipe(void *pBuffer, Cpa32U sizeInBytes)
+{
+    volatile Cpa8U *p = (volatile Cpa8U *)pBuffer;
+
+    while (sizeInBytes--)
+    {
+        *p++ = 0;
+    }
+}
+
+/* Pads a CRT component into pMem and points pBuff at it. A component longer
+ * than sizeBytes is cut to its sizeBytes least significant bytes, as the
+ * resizing of a request would do. */
+STATIC void LacRsa_KeyContextParamSet(CpaFlatBuffer *pBuff,
+                                      Cpa8U *pMem,
+                                      const CpaFlatBuffer *pValue,
+                                      Cpa32U sizeBytes)
+{
+    Cpa32U len = pValue->dataLenInBytes;
+
+    if (len > sizeBytes)
+    {
+        memcpy(pMem, pValue->pData + len - sizeBytes, sizeBytes);
+    }
+    else
+    {
+        osalMemSet(pMem, 0, sizeBytes - len);
+        memcpy(pMem + sizeBytes - len, pValue->pData, len);
+    }
+    pBuff->pData = pMem;
+    pBuff->dataLenInBytes = sizeBytes;
+}
+
+/* Checks that a key context was created on the instance and is not
+ * destroyed */
+STATIC CpaStatus
+LacRsa_KeyContextCheck(const CpaInstanceHandle instanceHandle,
+                       icp_sal_rsa_key_context_handle_t hKeyContext)
+{
+    lac_rsa_key_context_t *pKeyContext = (lac_rsa_key_context_t *)hKeyContext;
+
+    if ((NULL == pKeyContext) ||
+        (instanceHandle != pKeyContext->instanceHandle))
+    {
+        LAC_INVALID_PARAM_LOG("Invalid key context handle");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup LacRsa
+ *
+ *****************************************************************************/
+CpaStatus icp_sal_CyRsaPrivateKeyContextCreate(
+    const CpaInstanceHandle instanceHandle_in,
+    const CpaCyRsaPrivateKey *pPrivateKey,
+    icp_sal_rsa_key_context_handle_t *phKeyContext)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    sal_crypto_service_t *pCryptoService = NULL;
+    CpaCyRsaPrivateKey *pKey = LAC_CONST_PTR_CAST(pPrivateKey);
+    lac_rsa_key_context_t *pKeyContext = NULL;
+    Cpa32U structSizeBytes = LAC_ALIGN_POW2_ROUNDUP(
+        sizeof(lac_rsa_key_context_t), LAC_64BYTE_ALIGNMENT);
+    Cpa32U opSizeInBytes = 0;
+    Cpa32U functionalityId = LAC_PKE_INVALID_FUNC_ID;
+    Cpa32U paramSizeBytes = 0;
+    Cpa32U sizeBytes = 0;
+    Cpa8U *pMem = NULL;
+    CpaFlatBuffer *pComponents[LAC_RSA_KEY_CONTEXT_NUM_PARAMS] = {NULL};
+    const CpaFlatBuffer *pValues[LAC_RSA_KEY_CONTEXT_NUM_PARAMS] = {NULL};
+    Cpa32U i = 0;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    LAC_CHECK_NULL_PARAM(phKeyContext);
+#endif
+    SAL_RUNNING_CHECK(instanceHandle);
+#ifdef ICP_PARAM_CHECK
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+#endif
+
+    /* The key is checked here, whatever the build, as decryptions with the
+     * context no longer check it */
+    status = LacRsa_CheckPrivateKeyParam(pKey);
+    LAC_CHECK_STATUS(status);
+    if (CPA_CY_RSA_PRIVATE_KEY_REP_TYPE_2 != pKey->privateKeyRepType)
+    {
+        LAC_INVALID_PARAM_LOG("Only type 2 private keys have key contexts");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    opSizeInBytes = LacRsa_GetPrivateKeyOpSize(pKey);
+    if (CPA_FALSE == LacRsa_IsValidRsaSize(opSizeInBytes))
+    {
+        LAC_INVALID_PARAM_LOG("Invalid Private Key Size - pPrivateKey");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    functionalityId = LacPke_GetMmpId(LAC_BYTES_TO_BITS(opSizeInBytes),
+                                      lacRsaDp2SizeIdMap,
+                                      LAC_ARRAY_LEN(lacRsaDp2SizeIdMap));
+    if (LAC_PKE_INVALID_FUNC_ID == functionalityId)
+    {
+        LAC_INVALID_PARAM_LOG("Invalid Private Key Size - pPrivateKey");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    paramSizeBytes = LAC_RSA_TYPE_2_BUF_SIZE_GET(opSizeInBytes);
+    LAC_CHECK_FLAT_BUFFER_MSB_LSB(
+        &(pKey->privateKeyRep2.prime1P), paramSizeBytes, CPA_TRUE, CPA_TRUE);
+    LAC_CHECK_FLAT_BUFFER_MSB_LSB(
+        &(pKey->privateKeyRep2.prime2Q), paramSizeBytes, CPA_TRUE, CPA_TRUE);
+    status = LacRsa_Type2StdsCheck(&(pKey->privateKeyRep2));
+    LAC_CHECK_STATUS(status);
+
+    /* The structure is followed by p, q, dP, dQ and qInv */
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+    sizeBytes =
+        structSizeBytes + LAC_RSA_KEY_CONTEXT_NUM_PARAMS * paramSizeBytes;
+    status = LAC_OS_CAMALLOC(&pKeyContext,
+                             sizeBytes,
+                             LAC_64BYTE_ALIGNMENT,
+                             pCryptoService->nodeAffinity);
+    LAC_CHECK_STATUS(status);
+
+    pKeyContext->instanceHandle = instanceHandle;
+    pKeyContext->sizeBytes = sizeBytes;
+    pKeyContext->opSizeInBytes = opSizeInBytes;
+    pKeyContext->functionalityId = functionalityId;
+    osalAtomicSet(0, &(pKeyContext->numInFlight));
+
+    pComponents[0] = &(pKeyContext->privateKeyRep2.prime1P);
+    pComponents[1] = &(pKeyContext->privateKeyRep2.prime2Q);
+    pComponents[2] = &(pKeyContext->privateKeyRep2.exponent1Dp);
+    pComponents[3] = &(pKeyContext->privateKeyRep2.exponent2Dq);
+    pComponents[4] = &(pKeyContext->privateKeyRep2.coefficientQInv);
+    pValues[0] = &(pKey->privateKeyRep2.prime1P);
+    pValues[1] = &(pKey->privateKeyRep2.prime2Q);
+    pValues[2] = &(pKey->privateKeyRep2.exponent1Dp);
+    pValues[3] = &(pKey->privateKeyRep2.exponent2Dq);
+    pValues[4] = &(pKey->privateKeyRep2.coefficientQInv);
+
+    /* The addresses are translated once here instead of for each request */
+    pMem = (Cpa8U *)pKeyContext + structSizeBytes;
+    for (i = 0; i < LAC_RSA_KEY_CONTEXT_NUM_PARAMS; i++)
+    {
+        LacRsa_KeyContextParamSet(
+            pComponents[i], pMem, pValues[i], paramSizeBytes);
+        LAC_MEM_SHARED_WRITE_VIRT_TO_PHYS_PTR_INTERNAL(
+            pKeyContext->paramPhysAddr[i], pMem);
+        pMem += paramSizeBytes;
+    }
+
+    *phKeyContext = pKeyContext;
+    return CPA_STATUS_SUCCESS;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup LacRsa
+ *
+ *****************************************************************************/
+CpaStatus icp_sal_CyRsaPrivateKeyContextDestroy(
+    const CpaInstanceHandle instanceHandle_in,
+    icp_sal_rsa_key_context_handle_t hKeyContext)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    lac_rsa_key_context_t *pKeyContext = (lac_rsa_key_context_t *)hKeyContext;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+#endif
+    status = LacRsa_KeyContextCheck(instanceHandle, hKeyContext);
+    LAC_CHECK_STATUS(status);
+
+    /* The QAT may still be reading the components */
+    if (0 != osalAtomicGet(&(pKeyContext->numInFlight)))
+    {
+        return CPA_STATUS_RETRY;
+    }
+
+    LacRsa_KeyContextWipe(pKeyContext, pKeyContext->sizeBytes);
+    LAC_OS_CAFREE(pKeyContext);
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/*
+ * RSA decrypt with a private key context synchronous function
+ */
+STATIC CpaStatus LacRsa_DecryptKeyContextSynch(
+    const CpaInstanceHandle instanceHandle,
+    const icp_sal_rsa_decrypt_key_context_op_data_t *pDecryptData,
+    CpaFlatBuffer *pOutputData)
+{
+    CpaStatus status = CPA_STATUS_FAIL;
+    lac_sync_op_data_t *pSyncCallbackData = NULL;
+
+    status = LacSync_CreateSyncCookie(&pSyncCallbackData);
+    /*
+     * Call the async version of the function
+     * with the sync callback function as a parameter.
+     */
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = icp_sal_CyRsaDecryptKeyContext(instanceHandle,
+                                                LacSync_GenFlatBufCb,
+                                                pSyncCallbackData,
+                                                pDecryptData,
+                                                pOutputData);
+    }
+    else
+    {
+        LAC_RSA_STAT_INC(numRsaDecryptRequestErrors, instanceHandle);
+        return status;
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        CpaStatus wCbStatus = CPA_STATUS_FAIL;
+        wCbStatus = LacSync_WaitForCallback(
+            pSyncCallbackData, LAC_PKE_SYNC_CALLBACK_TIMEOUT, &status, NULL);
+        if (CPA_STATUS_SUCCESS != wCbStatus)
+        {
+            /*
+             * Inc stats only if the wait for callback failed.
+             */
+            LAC_RSA_STAT_INC(numRsaDecryptCompletedErrors, instanceHandle);
+            status = wCbStatus;
+        }
+    }
+    else
+    {
+        /* As the Request was not sent the Callback will never
+         * be called, so need to indicate that we're finished
+         * with cookie so it can be destroyed. */
+        LacSync_SetSyncCookieComplete(pSyncCallbackData);
+    }
+    LacSync_DestroySyncCookie(&pSyncCallbackData);
+    return status;
+}
+
+#ifdef ICP_PARAM_CHECK
+/*
+ * Checks the parameters of an RSA decrypt with a private key context. The
+ * key itself was checked when the context was created.
+ */
+STATIC CpaStatus LacRsa_DecryptKeyContextParamsCheck(
+    const CpaInstanceHandle instanceHandle,
+    const icp_sal_rsa_decrypt_key_context_op_data_t *pDecryptData,
+    CpaFlatBuffer *pOutputData)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_rsa_key_context_t *pKeyContext = NULL;
+
+    LAC_CHECK_NULL_PARAM(pDecryptData);
+    status = LacRsa_KeyContextCheck(instanceHandle, pDecryptData->hKeyContext);
+    LAC_CHECK_STATUS(status);
+    pKeyContext = (lac_rsa_key_context_t *)pDecryptData->hKeyContext;
+
+    /* Check message and ciphertext buffers */
+    LAC_CHECK_FLAT_BUFFER_PARAM_PKE(&(pDecryptData->inputData),
+                                    CHECK_LESS_EQUALS,
+                                    pKeyContext->opSizeInBytes,
+                                    CPA_FALSE);
+    LAC_CHECK_FLAT_BUFFER_PARAM(
+        pOutputData, CHECK_GREATER_EQUALS, pKeyContext->opSizeInBytes);
+
+    return status;
+}
+#endif
+
+/**
+ *****************************************************************************
+ * @ingroup LacRsa
+ *
+ *****************************************************************************/
+CpaStatus icp_sal_CyRsaDecryptKeyContext(
+    const CpaInstanceHandle instanceHandle_in,
+    const CpaCyGenFlatBufCbFunc pRsaDecryptCb,
+    void *pCallbackTag,
+    const icp_sal_rsa_decrypt_key_context_op_data_t *pDecryptData,
+    CpaFlatBuffer *pOutputData)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    lac_rsa_key_context_t *pKeyContext = NULL;
+#ifdef ICP_TRACE
+    LAC_LOG5("Called with params (0x%lx, 0x%lx, 0x%lx, 0x%lx, "
+             "0x%lx)\n",
+             (LAC_ARCH_UINT)instanceHandle_in,
+             (LAC_ARCH_UINT)pRsaDecryptCb,
+             (LAC_ARCH_UINT)pCallbackTag,
+             (LAC_ARCH_UINT)pDecryptData,
+             (LAC_ARCH_UINT)pOutputData);
+#endif
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_ASYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_ADDR_TRANS_SETUP(instanceHandle);
+#endif
+    SAL_RUNNING_CHECK(instanceHandle);
+#ifdef ICP_PARAM_CHECK
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_ASYM));
+#endif
+
+    /* Check if the API has been called in sync mode */
+    if (NULL == pRsaDecryptCb)
+    {
+        return LacRsa_DecryptKeyContextSynch(
+            instanceHandle, pDecryptData, pOutputData);
+    }
+#ifdef ICP_PARAM_CHECK
+    status = LacRsa_DecryptKeyContextParamsCheck(
+        instanceHandle, pDecryptData, pOutputData);
+#endif
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        /* Only the ciphertext is resized, the CRT components are already
+         * padded in internal memory */
+        pKeyContext = (lac_rsa_key_context_t *)pDecryptData->hKeyContext;
+
+        /* Counted before the send as the response may arrive first */
+        osalAtomicInc(&(pKeyContext->numInFlight));
+        status = LacRsa_Type2DecryptRequest(instanceHandle,
+                                            pRsaDecryptCb,
+                                            pCallbackTag,
+                                            pDecryptData,
+                                            pKeyContext->functionalityId,
+                                            pKeyContext->opSizeInBytes,
+                                            &(pDecryptData->inputData),
+                                            &(pKeyContext->privateKeyRep2),
+                                            pKeyContext,
+                                            pOutputData,
+                                            NULL);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            osalAtomicDec(&(pKeyContext->numInFlight));
+        }
+    }
+
+    /* increment stats */
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        LAC_RSA_STAT_INC(numRsaDecryptRequests, instanceHandle);
+    }
+    else
+    {
+        LAC_RSA_STAT_INC(numRsaDecryptRequestErrors, instanceHandle);
+    }
+
+    return status;
+}
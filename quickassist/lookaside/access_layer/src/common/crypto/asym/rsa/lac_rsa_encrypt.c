@@ -79,6 +79,7 @@
 #include "lac_pke_qat_comms.h"
 #include "lac_pke_utils.h"
 #include "lac_pke_mmp.h"
+#include "lac_pke_profile.h"
 #include "lac_sym.h"
 #include "lac_list.h"
 #include "sal_service_state.h"
@@ -172,6 +173,12 @@ CpaStatus cpaCyRsaEncrypt(const CpaInstanceHandle instanceHandle_in,
     Cpa32U opSizeInBytes = 0;
     Cpa32U functionalityId = LAC_PKE_INVALID_FUNC_ID;
     CpaInstanceHandle instanceHandle = NULL;
+#ifdef ICP_PKE_PROFILE
+    Cpa64U timeStamp = 0;
+    Cpa64U checkStart = 0;
+#endif
+
+    LAC_PKE_PROFILE_TIMESTAMP(timeStamp);
 #ifdef ICP_TRACE
     LAC_LOG5("Called with params (0x%lx, 0x%lx, 0x%lx, 0x%lx, "
              "0x%lx)\n",
@@ -209,11 +216,19 @@ CpaStatus cpaCyRsaEncrypt(const CpaInstanceHandle instanceHandle_in,
 
     /* Get the opSize and check RSA Encrypt params and
        return an error if invalid */
+    LAC_PKE_PROFILE_TIMESTAMP(checkStart);
     status = LacRsa_EncGetOpSizeAndCheck(instanceHandle,
                                          pRsaEncryptCb,
                                          pEncryptData,
                                          pOutputData,
                                          &opSizeInBytes);
+#ifdef ICP_PKE_PROFILE
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        LAC_PKE_PROFILE_END(
+            instanceHandle, ICP_SAL_PKE_PROFILE_PARAM_CHECK, checkStart);
+    }
+#endif
 
     if (CPA_STATUS_SUCCESS == status)
     {
@@ -292,6 +307,8 @@ CpaStatus cpaCyRsaEncrypt(const CpaInstanceHandle instanceHandle_in,
     if (CPA_STATUS_SUCCESS == status)
     {
         LAC_RSA_STAT_INC(numRsaEncryptRequests, instanceHandle);
+        LAC_PKE_PROFILE_END(
+            instanceHandle, ICP_SAL_PKE_PROFILE_SUBMIT, timeStamp);
     }
     else
     {
@@ -161,6 +161,40 @@ Cpa32U LacRsa_GetPrivateKeyOpSize(const CpaCyRsaPrivateKey *pPrivateKey);
  */
 CpaStatus LacRsa_Type2StdsCheck(CpaCyRsaPrivateKeyRep2 *pPrivateKeyRep2);
 
+/* Number of CRT components held by a private key context */
+#define LAC_RSA_KEY_CONTEXT_NUM_PARAMS 5
+
+/**
+ *******************************************************************************
+ * @ingroup LacRsa
+ *      RSA private key context
+ *
+ * @description
+ *      A type 2 private key set up for repeated decryptions. The structure is
+ * followed, in the same DMA-able allocation, by p, q, dP, dQ and qInv, each
+ * padded to half the operation size so that they are passed to the QAT
+ * without being resized. Their physical addresses are translated once, when
+ * the context is created. The address of this structure is the key context
+ * handle.
+ ******************************************************************************/
+typedef struct lac_rsa_key_context_s
+{
+    CpaInstanceHandle instanceHandle;
+    /**< instance the context was created on */
+    Cpa32U sizeBytes;
+    /**< size of the allocation */
+    Cpa32U opSizeInBytes;
+    /**< size of the modulus */
+    Cpa32U functionalityId;
+    /**< PKE service for the operation size */
+    OsalAtomic numInFlight;
+    /**< decryptions sent with the context and not yet completed */
+    CpaCyRsaPrivateKeyRep2 privateKeyRep2;
+    /**< CRT components, pointing into the allocation */
+    Cpa64U paramPhysAddr[LAC_RSA_KEY_CONTEXT_NUM_PARAMS];
+    /**< physical addresses of p, q, dP, dQ and qInv */
+} lac_rsa_key_context_t;
+
 /*
  * Performs compile time checks on RSA interface
  */
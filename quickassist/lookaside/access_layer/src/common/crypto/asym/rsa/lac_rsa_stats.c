@@ -95,15 +95,7 @@ CpaStatus LacRsa_StatsInit(CpaInstanceHandle instanceHandle)
     sal_crypto_service_t *pCryptoService =
         (sal_crypto_service_t *)instanceHandle;
 
-    status = LAC_OS_MALLOC(&(pCryptoService->pLacRsaStatsArr),
-                           LAC_RSA_NUM_STATS * sizeof(OsalAtomic));
-
-    if (CPA_STATUS_SUCCESS == status)
-    {
-        LAC_OS_BZERO(
-            LAC_CONST_VOLATILE_PTR_CAST(pCryptoService->pLacRsaStatsArr),
-            LAC_RSA_NUM_STATS * sizeof(OsalAtomic));
-    }
+    status = LacStats_Init(&pCryptoService->lacRsaStats, LAC_RSA_NUM_STATS);
 
     return status;
 }
@@ -113,10 +105,7 @@ void LacRsa_StatsFree(CpaInstanceHandle instanceHandle)
     sal_crypto_service_t *pCryptoService =
         (sal_crypto_service_t *)instanceHandle;
 
-    if (NULL != pCryptoService->pLacRsaStatsArr)
-    {
-        LAC_OS_FREE(pCryptoService->pLacRsaStatsArr);
-    }
+    LacStats_Free(&pCryptoService->lacRsaStats);
 }
 
 /**
@@ -155,7 +144,7 @@ CpaStatus cpaCyRsaQueryStats(CpaInstanceHandle instanceHandle_in,
     for (i = 0; i < LAC_RSA_NUM_STATS; i++)
     {
         ((Cpa32U *)pRsaStats)[i] =
-            (Cpa32U)osalAtomicGet(&pCryptoService->pLacRsaStatsArr[i]);
+            (Cpa32U)LacStats_Get(&pCryptoService->lacRsaStats, i);
     }
     return CPA_STATUS_SUCCESS;
 } /* cpaCyRsaQueryStats */
@@ -196,7 +185,7 @@ CpaStatus cpaCyRsaQueryStats64(CpaInstanceHandle instanceHandle_in,
     for (i = 0; i < LAC_RSA_NUM_STATS; i++)
     {
         ((Cpa64U *)pRsaStats)[i] =
-            osalAtomicGet(&pCryptoService->pLacRsaStatsArr[i]);
+            LacStats_Get(&pCryptoService->lacRsaStats, i);
     }
     return CPA_STATUS_SUCCESS;
 } /* cpaCyRsaQueryStats64 */
@@ -210,8 +199,7 @@ void LacRsa_StatsInc(Cpa32U offset, CpaInstanceHandle instanceHandle)
     if (CPA_TRUE ==
         pCryptoService->generic_service_info.stats->bRsaStatsEnabled)
     {
-        osalAtomicInc(
-            &pCryptoService->pLacRsaStatsArr[offset / sizeof(Cpa64U)]);
+        LacStats_Inc(&pCryptoService->lacRsaStats, offset / sizeof(Cpa64U));
     }
 } /* LacRsa_StatIncrement */
 #endif /* DISABLE_STATS */
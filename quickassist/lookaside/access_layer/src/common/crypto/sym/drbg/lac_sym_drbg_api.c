@@ -80,6 +80,1001 @@
 #include "cpa.h"
 #include "cpa_cy_drbg.h"
 
+/*
+*******************************************************************************
+* Include private header files
+*******************************************************************************
+*/
+#include "icp_accel_devices.h"
+#include "icp_adf_debug.h"
+#include "icp_sal_drbg_impl.h"
+#include "lac_common.h"
+#include "lac_log.h"
+#include "lac_mem.h"
+#include "lac_sym_drbg.h"
+#include "lac_sal_types_crypto.h"
+#include "sal_service_state.h"
+#include "sal_statistics.h"
+
+/*
+*******************************************************************************
+* Static Variables and defines
+*******************************************************************************
+*/
+
+#define LAC_DRBG_SESSION_MAGIC 0x44524247
+/**< Marks an initialized session ("DRBG") */
+
+#define LAC_DRBG_NUM_STATS (sizeof(CpaCyDrbgStats64) / sizeof(Cpa64U))
+/**< Number of DRBG statistics */
+
+#define LAC_DRBG_STATS_INIT(pCryptoService)                                    \
+    do                                                                         \
+    {                                                                          \
+        Cpa32U i;                                                              \
+                                                                               \
+        for (i = 0; i < LAC_DRBG_NUM_STATS; i++)                               \
+        {                                                                      \
+            osalAtomicSet(0, &(pCryptoService)->pLacDrbgStatsArr[i]);          \
+        }                                                                      \
+    } while (0)
+/**< macro to initialize all DRBG stats (stored in internal array of atomics) */
+
+#ifndef DISABLE_STATS
+#define LAC_DRBG_STAT_INC(statistic, pCryptoService)                           \
+    do                                                                         \
+    {                                                                          \
+        if (CPA_TRUE ==                                                        \
+            (pCryptoService)->generic_service_info.stats->bDrbgStatsEnabled)   \
+        {                                                                      \
+            osalAtomicInc(&(pCryptoService)                                    \
+                               ->pLacDrbgStatsArr[offsetof(CpaCyDrbgStats64,   \
+                                                           statistic) /        \
+                                                  sizeof(Cpa64U)]);            \
+        }                                                                      \
+    } while (0)
+/**< macro to increment a DRBG stat (derives offset into array of atomics) */
+#else
+#define LAC_DRBG_STAT_INC(statistic, pCryptoService)                           \
+    (pCryptoService) = (pCryptoService)
+#endif
+
+#define LAC_DRBG_STATS64_GET(drbgStats, pCryptoService)                        \
+    do                                                                         \
+    {                                                                          \
+        Cpa32U i;                                                              \
+                                                                               \
+        for (i = 0; i < LAC_DRBG_NUM_STATS; i++)                               \
+        {                                                                      \
+            ((Cpa64U *)&(drbgStats))[i] =                                      \
+                osalAtomicGet(&(pCryptoService)->pLacDrbgStatsArr[i]);         \
+        }                                                                      \
+    } while (0)
+/**< macro to get all DRBG 64bit stats (from internal array of atomics) */
+
+/* Key of the block cipher derivation function, SP 800-90A 10.3.2 */
+static const Cpa8U lacDrbgDfKey[LAC_DRBG_MAX_KEY_LEN_IN_BYTES] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
+
+/* Running state of a BCC computation, SP 800-90A 10.3.3 */
+typedef struct lac_sym_drbg_bcc_s
+{
+    Cpa8U chain[LAC_DRBG_BLOCK_LEN_IN_BYTES];
+    Cpa8U block[LAC_DRBG_BLOCK_LEN_IN_BYTES];
+    Cpa32U fill;
+    Cpa32U keyLenInBytes;
+    CpaStatus status;
+} lac_sym_drbg_bcc_t;
+
+#define LAC_DRBG_KAT_OUT_LEN_IN_BYTES 64
+/**< Length of the output checked by a known answer test */
+
+/* An input of a known answer test, none if its length is 0 */
+typedef struct lac_sym_drbg_kat_input_s
+{
+    Cpa32U lenInBytes;
+    Cpa8U data[LAC_DRBG_MAX_SEED_LEN_IN_BYTES];
+} lac_sym_drbg_kat_input_t;
+
+/*
+ * A known answer test, run in the CAVP order: instantiate, reseed if there
+ * is reseed entropy, then two generate requests. The output of the second
+ * one is checked.
+ */
+typedef struct lac_sym_drbg_kat_s
+{
+    CpaCyDrbgSecStrength secStrength;
+    CpaBoolean isDFRequired;
+    lac_sym_drbg_kat_input_t entropy;
+    lac_sym_drbg_kat_input_t nonce;
+    lac_sym_drbg_kat_input_t personalization;
+    lac_sym_drbg_kat_input_t entropyReseed;
+    lac_sym_drbg_kat_input_t additionalReseed;
+    lac_sym_drbg_kat_input_t additional1;
+    lac_sym_drbg_kat_input_t additional2;
+    Cpa8U returnedBits[LAC_DRBG_KAT_OUT_LEN_IN_BYTES];
+} lac_sym_drbg_kat_t;
+
+/*
+ * Known answer tests run when an instance starts. The first two are from
+ * the NIST CAVP CTR_DRBG response file, the others cover the paths those
+ * do not and were checked against OpenSSL.
+ */
+static const lac_sym_drbg_kat_t lacDrbgKats[] = {
+    /* SP 800-90A CAVP CTR_DRBG, AES-128 use df, COUNT 0 */
+    {CPA_CY_RBG_SEC_STRENGTH_128,
+     CPA_TRUE,
+     {16, {0x89, 0x0e, 0xb0, 0x67, 0xac, 0xf7, 0x38, 0x2e,
+           0xff, 0x80, 0xb0, 0xc7, 0x3b, 0xc8, 0x72, 0xc6}},
+     {8, {0xaa, 0xd4, 0x71, 0xef, 0x3e, 0xf1, 0xd2, 0x03}},
+     {0},
+     {0},
+     {0},
+     {0},
+     {0},
+     {0xa5, 0x51, 0x4e, 0xd7, 0x09, 0x5f, 0x64, 0xf3,
+      0xd0, 0xd3, 0xa5, 0x76, 0x03, 0x94, 0xab, 0x42,
+      0x06, 0x2f, 0x37, 0x3a, 0x25, 0x07, 0x2a, 0x6e,
+      0xa6, 0xbc, 0xfd, 0x84, 0x89, 0xe9, 0x4a, 0xf6,
+      0xcf, 0x18, 0x65, 0x9f, 0xea, 0x22, 0xed, 0x1c,
+      0xa0, 0xa9, 0xe3, 0x3f, 0x71, 0x8b, 0x11, 0x5e,
+      0xe5, 0x36, 0xb1, 0x28, 0x09, 0xc3, 0x1b, 0x72,
+      0xb0, 0x8d, 0xdd, 0x8b, 0xe1, 0x91, 0x0f, 0xa3}},
+    /* SP 800-90A CAVP CTR_DRBG, AES-256 use df, COUNT 0 */
+    {CPA_CY_RBG_SEC_STRENGTH_256,
+     CPA_TRUE,
+     {32, {0x36, 0x40, 0x19, 0x40, 0xfa, 0x8b, 0x1f, 0xba,
+           0x91, 0xa1, 0x66, 0x1f, 0x21, 0x1d, 0x78, 0xa0,
+           0xb9, 0x38, 0x9a, 0x74, 0xe5, 0xbc, 0xcf, 0xec,
+           0xe8, 0xd7, 0x66, 0xaf, 0x1a, 0x6d, 0x3b, 0x14}},
+     {16, {0x49, 0x6f, 0x25, 0xb0, 0xf1, 0x30, 0x1b, 0x4f,
+           0x50, 0x1b, 0xe3, 0x03, 0x80, 0xa1, 0x37, 0xeb}},
+     {0},
+     {0},
+     {0},
+     {0},
+     {0},
+     {0x58, 0x62, 0xeb, 0x38, 0xbd, 0x55, 0x8d, 0xd9,
+      0x78, 0xa6, 0x96, 0xe6, 0xdf, 0x16, 0x47, 0x82,
+      0xdd, 0xd8, 0x87, 0xe7, 0xe9, 0xa6, 0xc9, 0xf3,
+      0xf1, 0xfb, 0xaf, 0xb7, 0x89, 0x41, 0xb5, 0x35,
+      0xa6, 0x49, 0x12, 0xdf, 0xd2, 0x24, 0xc6, 0xdc,
+      0x74, 0x54, 0xe5, 0x25, 0x0b, 0x3d, 0x97, 0x16,
+      0x5e, 0x16, 0x26, 0x0c, 0x2f, 0xaf, 0x1c, 0xc7,
+      0x73, 0x5c, 0xb7, 0x5f, 0xb4, 0xf0, 0x7e, 0x1d}},
+    /* AES-128 no df, personalization and additional input */
+    {CPA_CY_RBG_SEC_STRENGTH_128,
+     CPA_FALSE,
+     {32, {0x76, 0xc9, 0x03, 0x82, 0xe0, 0xed, 0xec, 0x71,
+           0x1e, 0x32, 0x16, 0x80, 0x86, 0xd0, 0x4e, 0xec,
+           0x52, 0x79, 0x44, 0x2b, 0x0d, 0x4e, 0xe9, 0x31,
+           0x14, 0x65, 0x47, 0x6c, 0x42, 0x29, 0x1e, 0x82}},
+     {0},
+     {32, {0x74, 0x47, 0x7c, 0x6e, 0xa7, 0xde, 0xe9, 0xc5,
+           0xcb, 0x24, 0x06, 0x73, 0x0f, 0x53, 0x63, 0x8f,
+           0x9c, 0x1e, 0xf1, 0x55, 0xf0, 0x4d, 0x0e, 0xf0,
+           0x8f, 0x13, 0x68, 0x3e, 0x39, 0xc2, 0x8a, 0xb1}},
+     {0},
+     {0},
+     {32, {0xb8, 0xb5, 0x33, 0x28, 0x09, 0xe0, 0x23, 0xad,
+           0x69, 0xd6, 0x59, 0xf0, 0x75, 0xdd, 0x10, 0x3e,
+           0x0d, 0xcd, 0xfb, 0x40, 0x9f, 0xd6, 0x67, 0xcb,
+           0x21, 0x63, 0xb7, 0x33, 0x75, 0x09, 0xb5, 0x14}},
+     {32, {0x92, 0xa1, 0x14, 0x00, 0x5d, 0x86, 0x68, 0x91,
+           0xeb, 0x48, 0xf5, 0x52, 0xf5, 0x5d, 0xf3, 0x79,
+           0x4c, 0xda, 0xb3, 0xd4, 0xb5, 0x12, 0x6b, 0x5a,
+           0x1e, 0x9f, 0xdd, 0xe7, 0x21, 0xe3, 0xf9, 0x12}},
+     {0x07, 0x23, 0x05, 0x2c, 0xdc, 0xc4, 0x3f, 0xf8,
+      0x55, 0x53, 0xab, 0x8d, 0x78, 0x2e, 0xaa, 0x63,
+      0x45, 0x7c, 0x09, 0x5c, 0xb5, 0x39, 0x3d, 0xd5,
+      0xc1, 0x3a, 0x0f, 0x2f, 0x65, 0xd6, 0x17, 0x8f,
+      0x2a, 0x30, 0x92, 0xc5, 0x38, 0x42, 0x3b, 0xfb,
+      0x24, 0x3e, 0x03, 0x13, 0x76, 0x04, 0x5a, 0x77,
+      0x8f, 0x53, 0x40, 0xa8, 0x7a, 0xce, 0xe6, 0x13,
+      0xf3, 0xad, 0xd2, 0xa4, 0x6b, 0xb6, 0xcc, 0xbc}},
+    /* AES-256 no df, reseed and additional input */
+    {CPA_CY_RBG_SEC_STRENGTH_256,
+     CPA_FALSE,
+     {48, {0x6a, 0x35, 0x90, 0x1f, 0xc5, 0x41, 0x1b, 0x81,
+           0x7a, 0x6e, 0x07, 0x8a, 0xa3, 0xa1, 0x65, 0xed,
+           0x7a, 0x18, 0x09, 0xcc, 0x37, 0xe3, 0x9c, 0x1b,
+           0x98, 0x9b, 0xa4, 0x78, 0xad, 0x9e, 0xf1, 0x04,
+           0x38, 0xfa, 0xbf, 0xdc, 0x2e, 0x46, 0x97, 0xba,
+           0x1c, 0x15, 0xb1, 0x4e, 0x90, 0x28, 0xa5, 0x02}},
+     {0},
+     {0},
+     {48, {0x92, 0xab, 0x43, 0x19, 0x7b, 0xec, 0x0d, 0xbe,
+           0xbc, 0xac, 0x39, 0x88, 0x18, 0xda, 0x38, 0xb7,
+           0x98, 0x04, 0x93, 0x2e, 0xb7, 0x5c, 0x9f, 0xbf,
+           0x5c, 0x96, 0x92, 0xd7, 0x95, 0xa4, 0xa9, 0xd3,
+           0xc3, 0x8e, 0x6d, 0x7f, 0x1f, 0x9a, 0x93, 0x45,
+           0xf1, 0x9c, 0x99, 0xa2, 0xbc, 0x29, 0x3a, 0x8d}},
+     {48, {0xa1, 0xea, 0xff, 0x49, 0xda, 0xd1, 0x4f, 0xf5,
+           0xea, 0xab, 0xba, 0xbf, 0x43, 0xa7, 0x0e, 0x62,
+           0xbe, 0xaf, 0x63, 0xfc, 0x72, 0x36, 0x06, 0xb0,
+           0xdf, 0xfd, 0x14, 0x4c, 0x96, 0xc6, 0xdd, 0xdd,
+           0x97, 0xca, 0xaf, 0xe9, 0x99, 0xb7, 0xc7, 0xaa,
+           0x8b, 0x34, 0x6e, 0x0a, 0x5c, 0xf1, 0x38, 0x44}},
+     {48, {0x69, 0x1d, 0xe8, 0x70, 0x91, 0x44, 0x8b, 0x46,
+           0x67, 0x4f, 0x52, 0x39, 0x43, 0x84, 0x69, 0x81,
+           0x51, 0x6b, 0xf3, 0x16, 0x6c, 0x42, 0xf8, 0x78,
+           0xc8, 0xd8, 0x47, 0x0d, 0x11, 0x5a, 0xff, 0x1e,
+           0xdd, 0x03, 0xd5, 0xcc, 0xbc, 0x8f, 0x5d, 0x5d,
+           0x3c, 0x26, 0x2e, 0xa8, 0xc3, 0x82, 0x0c, 0xb7}},
+     {48, {0x93, 0x63, 0x04, 0x88, 0x38, 0x18, 0xbd, 0x70,
+           0x92, 0x0e, 0x8f, 0xd1, 0x9f, 0xe1, 0x87, 0x48,
+           0x92, 0xa8, 0xec, 0xee, 0xac, 0xd5, 0x3e, 0xc8,
+           0x44, 0xec, 0x7e, 0xc3, 0xf2, 0x65, 0x44, 0x3e,
+           0x45, 0xc2, 0xf7, 0x4b, 0x96, 0xce, 0xe3, 0xc9,
+           0xa2, 0x3f, 0x69, 0xcf, 0xce, 0xc6, 0xc6, 0x46}},
+     {0xd9, 0xe5, 0x41, 0x41, 0xb9, 0x9c, 0xb2, 0x56,
+      0xc7, 0x66, 0xb6, 0x69, 0x63, 0x17, 0x4c, 0xb0,
+      0x69, 0xb8, 0xac, 0x24, 0x62, 0x63, 0xfc, 0x43,
+      0x5c, 0x9c, 0xdb, 0xd6, 0xb8, 0x8f, 0x28, 0x85,
+      0x96, 0x17, 0x19, 0xdd, 0xd7, 0xd2, 0x2f, 0x36,
+      0x86, 0xac, 0x2f, 0x38, 0xe0, 0xa9, 0x9e, 0xdf,
+      0xf4, 0x4e, 0x79, 0xb2, 0x93, 0x86, 0x5a, 0xd8,
+      0x16, 0x75, 0xf8, 0xb9, 0x89, 0x97, 0x02, 0x61}},
+    /* AES-192 use df, personalization, reseed and additional input */
+    {CPA_CY_RBG_SEC_STRENGTH_192,
+     CPA_TRUE,
+     {24, {0x42, 0xf6, 0x7b, 0xa8, 0xa9, 0x3a, 0x62, 0xfd,
+           0x77, 0x80, 0x1c, 0xf8, 0xca, 0x99, 0x7d, 0xee,
+           0x79, 0x7f, 0xa3, 0x44, 0xf7, 0x06, 0x81, 0xdb}},
+     {12, {0x4c, 0x67, 0x14, 0xb6, 0x58, 0xbe, 0xd6, 0xdb,
+           0xac, 0x2a, 0xe2, 0x02}},
+     {24, {0x7d, 0x5b, 0x0a, 0x43, 0x65, 0xcb, 0x26, 0x31,
+           0xc0, 0x99, 0xfc, 0x45, 0x10, 0x62, 0x67, 0x6f,
+           0x83, 0x97, 0xb0, 0x03, 0xf2, 0xd1, 0x1f, 0x69}},
+     {24, {0x33, 0x38, 0x16, 0x47, 0x6c, 0xf8, 0x68, 0x90,
+           0x41, 0xcc, 0xf7, 0x29, 0x0a, 0x76, 0x18, 0x44,
+           0x47, 0x21, 0x32, 0x43, 0x89, 0xe5, 0x39, 0xab}},
+     {24, {0x94, 0x88, 0xfe, 0xce, 0xd9, 0xa6, 0xc9, 0x7d,
+           0xa6, 0xcb, 0x5b, 0xa5, 0xbc, 0x3c, 0x58, 0x43,
+           0x61, 0xc4, 0xb6, 0x43, 0x47, 0xc8, 0x6a, 0x6a}},
+     {24, {0x70, 0x08, 0xf2, 0x25, 0xac, 0x69, 0x86, 0x21,
+           0x87, 0x05, 0x9b, 0xec, 0xd4, 0x57, 0xec, 0xf9,
+           0x15, 0x22, 0xbf, 0x7d, 0x00, 0x87, 0xf2, 0x7f}},
+     {24, {0xc8, 0x27, 0x60, 0x4c, 0xb2, 0x36, 0xc6, 0xe5,
+           0xd8, 0x3d, 0x05, 0xda, 0xc6, 0xc0, 0xd9, 0x16,
+           0xc8, 0x83, 0x1f, 0x83, 0x2e, 0x73, 0x58, 0xfa}},
+     {0x97, 0xd8, 0x22, 0x11, 0x36, 0xd7, 0x17, 0x36,
+      0x94, 0xcf, 0x07, 0x2d, 0x5f, 0x72, 0x29, 0x1e,
+      0x83, 0xf4, 0x7f, 0x4c, 0x5c, 0x59, 0x48, 0x4c,
+      0x75, 0x2b, 0x53, 0x8f, 0x50, 0x65, 0x6b, 0x19,
+      0x42, 0x83, 0xc5, 0x19, 0xf9, 0x5d, 0xff, 0x7d,
+      0xb0, 0xc5, 0x73, 0x84, 0x41, 0x17, 0xf3, 0x76,
+      0xed, 0x73, 0x4a, 0xf3, 0xd8, 0x6e, 0x17, 0xe4,
+      0x2b, 0xaa, 0x81, 0xc8, 0x6d, 0xbf, 0xed, 0xa1}}
+};
+
+STATIC CpaStatus LacSymDrbg_DefaultGetEntropyInput(
+    IcpSalDrbgGetEntropyInputCbFunc pCb,
+    void *pCallbackTag,
+    icp_sal_drbg_get_entropy_op_data_t *pOpData,
+    CpaFlatBuffer *pBuffer,
+    Cpa32U *pLengthReturned);
+STATIC CpaStatus LacSymDrbg_DefaultGetNonce(
+    icp_sal_drbg_get_entropy_op_data_t *pOpData,
+    CpaFlatBuffer *pBuffer,
+    Cpa32U *pLengthReturned);
+STATIC CpaBoolean LacSymDrbg_DefaultIsDFReq(void);
+
+static IcpSalDrbgGetEntropyInputFunc pLacDrbgGetEntropyInputFunc =
+    LacSymDrbg_DefaultGetEntropyInput;
+static IcpSalDrbgGetNonceFunc pLacDrbgGetNonceFunc = LacSymDrbg_DefaultGetNonce;
+static IcpSalDrbgIsDFReqFunc pLacDrbgIsDFReqFunc = LacSymDrbg_DefaultIsDFReq;
+
+/*
+*******************************************************************************
+* Define static function definitions
+*******************************************************************************
+*/
+
+/* Clears state in a way the compiler can not drop as a dead store */
+STATIC void LacSymDrbg_Wipe(void *pBuffer, Cpa32U sizeInBytes)
+{
+    volatile Cpa8U *p = (volatile Cpa8U *)pBuffer;
+
+    while (sizeInBytes--)
+    {
+        *p++ = 0;
+    }
+}
+
+STATIC Cpa32U LacSymDrbg_StrengthInBits(CpaCyDrbgSecStrength secStrength)
+{
+    switch (secStrength)
+    {
+        case CPA_CY_RBG_SEC_STRENGTH_112:
+            return 112;
+        case CPA_CY_RBG_SEC_STRENGTH_128:
+            return 128;
+        case CPA_CY_RBG_SEC_STRENGTH_192:
+            return 192;
+        case CPA_CY_RBG_SEC_STRENGTH_256:
+            return 256;
+        default:
+            return 0;
+    }
+}
+
+/* AES-128 serves the 112 and 128 bit strengths */
+STATIC Cpa32U LacSymDrbg_KeyLenInBytes(CpaCyDrbgSecStrength secStrength)
+{
+    switch (secStrength)
+    {
+        case CPA_CY_RBG_SEC_STRENGTH_112:
+        case CPA_CY_RBG_SEC_STRENGTH_128:
+            return 16;
+        case CPA_CY_RBG_SEC_STRENGTH_192:
+            return 24;
+        case CPA_CY_RBG_SEC_STRENGTH_256:
+            return 32;
+        default:
+            return 0;
+    }
+}
+
+STATIC CpaStatus LacSymDrbg_DefaultGetEntropyInput(
+    IcpSalDrbgGetEntropyInputCbFunc pCb,
+    void *pCallbackTag,
+    icp_sal_drbg_get_entropy_op_data_t *pOpData,
+    CpaFlatBuffer *pBuffer,
+    Cpa32U *pLengthReturned)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa32U length = pOpData->maxLength;
+
+    if (OSAL_SUCCESS != osalGetRandomBytes(pBuffer->pData, length))
+    {
+        status = CPA_STATUS_RESOURCE;
+        length = 0;
+    }
+
+    if (NULL != pCb)
+    {
+        pCb(pCallbackTag, status, pOpData, length, pBuffer);
+        return CPA_STATUS_SUCCESS;
+    }
+    *pLengthReturned = length;
+    return status;
+}
+
+STATIC CpaStatus LacSymDrbg_DefaultGetNonce(
+    icp_sal_drbg_get_entropy_op_data_t *pOpData,
+    CpaFlatBuffer *pBuffer,
+    Cpa32U *pLengthReturned)
+{
+    return LacSymDrbg_DefaultGetEntropyInput(
+        NULL, NULL, pOpData, pBuffer, pLengthReturned);
+}
+
+STATIC CpaBoolean LacSymDrbg_DefaultIsDFReq(void)
+{
+    return CPA_TRUE;
+}
+
+/*
+ * Fetches entropy input, or a nonce, for the session. The registered
+ * functions are always called synchronously.
+ */
+STATIC CpaStatus LacSymDrbg_EntropyGet(lac_sym_drbg_session_t *pSession,
+                                       CpaBoolean isNonce,
+                                       Cpa8U *pData,
+                                       Cpa32U *pLengthReturned)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    icp_sal_drbg_get_entropy_op_data_t opData;
+    CpaFlatBuffer buffer;
+    Cpa32U strengthInBits = LacSymDrbg_StrengthInBits(pSession->secStrength);
+    Cpa32U strengthInBytes = (strengthInBits + 7) >> 3;
+
+    opData.sessionHandle = pSession;
+    if (CPA_TRUE == isNonce)
+    {
+        opData.minEntropy = strengthInBits >> 1;
+        opData.minLength = (strengthInBytes + 1) >> 1;
+        opData.maxLength = strengthInBytes;
+    }
+    else if (CPA_TRUE == pSession->isDFRequired)
+    {
+        opData.minEntropy = strengthInBits;
+        opData.minLength = strengthInBytes;
+        opData.maxLength = pSession->seedLenInBytes;
+    }
+    else
+    {
+        /* Without the derivation function the entropy input is used as
+         * the seed material directly and must be full entropy */
+        opData.minEntropy = pSession->seedLenInBytes << 3;
+        opData.minLength = pSession->seedLenInBytes;
+        opData.maxLength = pSession->seedLenInBytes;
+    }
+
+    buffer.pData = pData;
+    buffer.dataLenInBytes = opData.maxLength;
+    *pLengthReturned = 0;
+
+    if (CPA_TRUE == isNonce)
+    {
+        status = pLacDrbgGetNonceFunc(&opData, &buffer, pLengthReturned);
+    }
+    else
+    {
+        status = pLacDrbgGetEntropyInputFunc(
+            NULL, NULL, &opData, &buffer, pLengthReturned);
+    }
+
+    if ((CPA_STATUS_SUCCESS == status) &&
+        ((*pLengthReturned < opData.minLength) ||
+         (*pLengthReturned > opData.maxLength)))
+    {
+        LAC_LOG_ERROR("Entropy source returned an invalid length");
+        status = CPA_STATUS_RESOURCE;
+    }
+    else if ((CPA_STATUS_SUCCESS != status) && (CPA_STATUS_RETRY != status))
+    {
+        LAC_LOG_ERROR("Failed to get entropy input");
+        status = CPA_STATUS_RESOURCE;
+    }
+    return status;
+}
+
+STATIC void LacSymDrbg_BccUpdate(lac_sym_drbg_bcc_t *pBcc,
+                                 const Cpa8U *pData,
+                                 Cpa32U lengthInBytes)
+{
+    Cpa32U i;
+
+    while (lengthInBytes--)
+    {
+        pBcc->block[pBcc->fill++] = *pData++;
+        if (LAC_DRBG_BLOCK_LEN_IN_BYTES == pBcc->fill)
+        {
+            for (i = 0; i < LAC_DRBG_BLOCK_LEN_IN_BYTES; i++)
+            {
+                pBcc->chain[i] ^= pBcc->block[i];
+            }
+            if (OSAL_SUCCESS !=
+                osalAESEncrypt(LAC_CONST_PTR_CAST(lacDrbgDfKey),
+                               pBcc->keyLenInBytes,
+                               pBcc->chain,
+                               pBcc->chain))
+            {
+                pBcc->status = CPA_STATUS_FAIL;
+            }
+            pBcc->fill = 0;
+        }
+    }
+}
+
+/*
+ * Block_Cipher_df (SP 800-90A 10.3.2) over the concatenation of the input
+ * buffers, returning seedlen bytes. The string S is fed to BCC as it is
+ * formed rather than being assembled in memory first.
+ */
+STATIC CpaStatus LacSymDrbg_Df(lac_sym_drbg_session_t *pSession,
+                               const CpaFlatBuffer *pInputs,
+                               Cpa32U numInputs,
+                               Cpa8U *pSeed)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_sym_drbg_bcc_t bcc;
+    Cpa8U temp[LAC_DRBG_MAX_SEED_LEN_IN_BLOCKS * LAC_DRBG_BLOCK_LEN_IN_BYTES];
+    Cpa8U key[LAC_DRBG_MAX_KEY_LEN_IN_BYTES];
+    Cpa8U x[LAC_DRBG_BLOCK_LEN_IN_BYTES];
+    Cpa8U iv[LAC_DRBG_BLOCK_LEN_IN_BYTES];
+    Cpa8U lengths[2 * sizeof(Cpa32U)];
+    static const Cpa8U pad[LAC_DRBG_BLOCK_LEN_IN_BYTES] = {0x80};
+    Cpa32U numBlocks = (pSession->seedLenInBytes +
+                        LAC_DRBG_BLOCK_LEN_IN_BYTES - 1) /
+                       LAC_DRBG_BLOCK_LEN_IN_BYTES;
+    Cpa32U inputLen = 0;
+    Cpa32U i, j;
+
+    for (j = 0; j < numInputs; j++)
+    {
+        inputLen += pInputs[j].dataLenInBytes;
+    }
+    /* L and N as 32 bit big endian integers */
+    for (j = 0; j < sizeof(Cpa32U); j++)
+    {
+        lengths[j] = (Cpa8U)(inputLen >> (24 - (j << 3)));
+        lengths[sizeof(Cpa32U) + j] =
+            (Cpa8U)(pSession->seedLenInBytes >> (24 - (j << 3)));
+    }
+
+    for (i = 0; i < numBlocks; i++)
+    {
+        osalMemSet(&bcc, 0, sizeof(bcc));
+        bcc.keyLenInBytes = pSession->keyLenInBytes;
+        bcc.status = CPA_STATUS_SUCCESS;
+
+        osalMemSet(iv, 0, sizeof(iv));
+        iv[0] = (Cpa8U)(i >> 24);
+        iv[1] = (Cpa8U)(i >> 16);
+        iv[2] = (Cpa8U)(i >> 8);
+        iv[3] = (Cpa8U)i;
+        LacSymDrbg_BccUpdate(&bcc, iv, sizeof(iv));
+        LacSymDrbg_BccUpdate(&bcc, lengths, sizeof(lengths));
+        for (j = 0; j < numInputs; j++)
+        {
+            LacSymDrbg_BccUpdate(
+                &bcc, pInputs[j].pData, pInputs[j].dataLenInBytes);
+        }
+        /* 0x80 then zeros up to the block boundary */
+        LacSymDrbg_BccUpdate(&bcc, pad, 1);
+        if (0 != bcc.fill)
+        {
+            LacSymDrbg_BccUpdate(
+                &bcc, pad + 1, LAC_DRBG_BLOCK_LEN_IN_BYTES - bcc.fill);
+        }
+
+        if (CPA_STATUS_SUCCESS != bcc.status)
+        {
+            status = bcc.status;
+            break;
+        }
+        memcpy(temp + i * LAC_DRBG_BLOCK_LEN_IN_BYTES,
+               bcc.chain,
+               LAC_DRBG_BLOCK_LEN_IN_BYTES);
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        memcpy(key, temp, pSession->keyLenInBytes);
+        memcpy(x, temp + pSession->keyLenInBytes, sizeof(x));
+        for (i = 0; i < numBlocks; i++)
+        {
+            if (OSAL_SUCCESS !=
+                osalAESEncrypt(key, pSession->keyLenInBytes, x, x))
+            {
+                status = CPA_STATUS_FAIL;
+                break;
+            }
+            /* The last block is partial for AES-192 */
+            j = pSession->seedLenInBytes - i * LAC_DRBG_BLOCK_LEN_IN_BYTES;
+            if (j > LAC_DRBG_BLOCK_LEN_IN_BYTES)
+            {
+                j = LAC_DRBG_BLOCK_LEN_IN_BYTES;
+            }
+            memcpy(pSeed + i * LAC_DRBG_BLOCK_LEN_IN_BYTES, x, j);
+        }
+    }
+
+    LacSymDrbg_Wipe(&bcc, sizeof(bcc));
+    LacSymDrbg_Wipe(temp, sizeof(temp));
+    LacSymDrbg_Wipe(key, sizeof(key));
+    LacSymDrbg_Wipe(x, sizeof(x));
+    return status;
+}
+
+/*
+ * Turns the input buffers into seedlen bytes of seed material: through the
+ * derivation function, or else by XORing them together, each padded with
+ * zeros to seedlen.
+ */
+STATIC CpaStatus LacSymDrbg_SeedMaterial(lac_sym_drbg_session_t *pSession,
+                                         const CpaFlatBuffer *pInputs,
+                                         Cpa32U numInputs,
+                                         Cpa8U *pSeed)
+{
+    Cpa32U i, j;
+
+    if (CPA_TRUE == pSession->isDFRequired)
+    {
+        return LacSymDrbg_Df(pSession, pInputs, numInputs, pSeed);
+    }
+
+    osalMemSet(pSeed, 0, pSession->seedLenInBytes);
+    for (i = 0; i < numInputs; i++)
+    {
+        if (pInputs[i].dataLenInBytes > pSession->seedLenInBytes)
+        {
+            LAC_INVALID_PARAM_LOG("Input longer than the seed length");
+            return CPA_STATUS_INVALID_PARAM;
+        }
+        for (j = 0; j < pInputs[i].dataLenInBytes; j++)
+        {
+            pSeed[j] ^= pInputs[i].pData[j];
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/*
+ * Second half of CTR_DRBG_Update (SP 800-90A 10.2.1.2): pTemp holds the
+ * seedlen bytes of keystream, pProvided the provided data or NULL for
+ * none.
+ */
+STATIC void LacSymDrbg_UpdateFinish(lac_sym_drbg_session_t *pSession,
+                                    Cpa8U *pTemp,
+                                    const Cpa8U *pProvided)
+{
+    Cpa32U i;
+
+    if (NULL != pProvided)
+    {
+        for (i = 0; i < pSession->seedLenInBytes; i++)
+        {
+            pTemp[i] ^= pProvided[i];
+        }
+    }
+    memcpy(pSession->key, pTemp, pSession->keyLenInBytes);
+    memcpy(
+        pSession->v, pTemp + pSession->keyLenInBytes, LAC_DRBG_BLOCK_LEN_IN_BYTES);
+}
+
+/* CTR_DRBG_Update, SP 800-90A 10.2.1.2 */
+STATIC CpaStatus LacSymDrbg_Update(lac_sym_drbg_session_t *pSession,
+                                   const Cpa8U *pProvided)
+{
+    Cpa8U temp[LAC_DRBG_MAX_SEED_LEN_IN_BLOCKS * LAC_DRBG_BLOCK_LEN_IN_BYTES];
+    Cpa32U numBlocks = (pSession->seedLenInBytes +
+                        LAC_DRBG_BLOCK_LEN_IN_BYTES - 1) /
+                       LAC_DRBG_BLOCK_LEN_IN_BYTES;
+
+    if (OSAL_SUCCESS != osalAESCtrKeystream(pSession->key,
+                                            pSession->keyLenInBytes,
+                                            pSession->v,
+                                            temp,
+                                            numBlocks))
+    {
+        LAC_LOG_ERROR("AES counter mode failed");
+        return CPA_STATUS_FAIL;
+    }
+    LacSymDrbg_UpdateFinish(pSession, temp, pProvided);
+    LacSymDrbg_Wipe(temp, sizeof(temp));
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Wipes and empties the pool of pre-generated output */
+STATIC void LacSymDrbg_PoolDiscard(lac_sym_drbg_session_t *pSession)
+{
+    if (pSession->poolOffset < LAC_DRBG_POOL_SIZE_IN_BYTES)
+    {
+        LacSymDrbg_Wipe(pSession->pool + pSession->poolOffset,
+                        LAC_DRBG_POOL_SIZE_IN_BYTES - pSession->poolOffset);
+    }
+    pSession->poolOffset = LAC_DRBG_POOL_SIZE_IN_BYTES;
+}
+
+/*
+ * CTR_DRBG_Instantiate_algorithm, SP 800-90A 10.2.1.3. The nonce is only
+ * used with the derivation function.
+ */
+STATIC CpaStatus LacSymDrbg_Instantiate(lac_sym_drbg_session_t *pSession,
+                                        const CpaFlatBuffer *pEntropy,
+                                        const CpaFlatBuffer *pNonce,
+                                        const CpaFlatBuffer *pPersonalization)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa8U seed[LAC_DRBG_MAX_SEED_LEN_IN_BYTES];
+    CpaFlatBuffer inputs[3];
+    Cpa32U numInputs = 0;
+
+    inputs[numInputs++] = *pEntropy;
+    if (CPA_TRUE == pSession->isDFRequired)
+    {
+        inputs[numInputs++] = *pNonce;
+    }
+    if (0 != pPersonalization->dataLenInBytes)
+    {
+        inputs[numInputs++] = *pPersonalization;
+    }
+
+    status = LacSymDrbg_SeedMaterial(pSession, inputs, numInputs, seed);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        osalMemSet(pSession->key, 0, sizeof(pSession->key));
+        osalMemSet(pSession->v, 0, sizeof(pSession->v));
+        status = LacSymDrbg_Update(pSession, seed);
+        pSession->reseedCounter = 1;
+        pSession->poolOffset = LAC_DRBG_POOL_SIZE_IN_BYTES;
+    }
+
+    LacSymDrbg_Wipe(seed, sizeof(seed));
+    return status;
+}
+
+/*
+ * CTR_DRBG_Reseed_algorithm, SP 800-90A 10.2.1.4, with entropy input the
+ * caller collected before taking the session lock
+ */
+STATIC CpaStatus LacSymDrbg_Reseed(lac_sym_drbg_session_t *pSession,
+                                   const CpaFlatBuffer *pEntropy,
+                                   const CpaFlatBuffer *pAdditionalInput)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa8U seed[LAC_DRBG_MAX_SEED_LEN_IN_BYTES];
+    CpaFlatBuffer inputs[2];
+    Cpa32U numInputs = 0;
+
+    inputs[numInputs++] = *pEntropy;
+    if ((NULL != pAdditionalInput) &&
+        (0 != pAdditionalInput->dataLenInBytes))
+    {
+        inputs[numInputs++] = *pAdditionalInput;
+    }
+
+    status = LacSymDrbg_SeedMaterial(pSession, inputs, numInputs, seed);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = LacSymDrbg_Update(pSession, seed);
+        pSession->reseedCounter = 1;
+        /* Output pooled before the reseed must not be handed out after it */
+        LacSymDrbg_PoolDiscard(pSession);
+    }
+
+    LacSymDrbg_Wipe(seed, sizeof(seed));
+    return status;
+}
+
+/*
+ * CTR_DRBG_Generate_algorithm, SP 800-90A 10.2.1.5, for at most
+ * LAC_DRBG_MAX_BYTES_PER_REQUEST bytes. The output blocks and the blocks
+ * of the update that follows are one keystream: whole output blocks are
+ * written straight to pOut, the rest goes through a small local buffer.
+ */
+STATIC CpaStatus LacSymDrbg_Generate(lac_sym_drbg_session_t *pSession,
+                                     const CpaFlatBuffer *pAdditionalInput,
+                                     Cpa8U *pOut,
+                                     Cpa32U lengthInBytes)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa8U additionalInput[LAC_DRBG_MAX_SEED_LEN_IN_BYTES] = {0};
+    Cpa8U tail[(LAC_DRBG_MAX_SEED_LEN_IN_BLOCKS + 1) *
+               LAC_DRBG_BLOCK_LEN_IN_BYTES];
+    Cpa32U numFullBlocks = lengthInBytes / LAC_DRBG_BLOCK_LEN_IN_BYTES;
+    Cpa32U remainder = lengthInBytes % LAC_DRBG_BLOCK_LEN_IN_BYTES;
+    Cpa32U numTailBlocks = (pSession->seedLenInBytes +
+                            LAC_DRBG_BLOCK_LEN_IN_BYTES - 1) /
+                           LAC_DRBG_BLOCK_LEN_IN_BYTES;
+    const Cpa8U *pProvided = NULL;
+
+    if ((NULL != pAdditionalInput) &&
+        (0 == pAdditionalInput->dataLenInBytes))
+    {
+        pAdditionalInput = NULL;
+    }
+
+    /* Callers reseed ahead of the interval, see LacSymDrbg_RequestLock */
+    if (pSession->reseedCounter > LAC_DRBG_RESEED_INTERVAL)
+    {
+        LAC_LOG_ERROR("DRBG reseed required");
+        return CPA_STATUS_FAIL;
+    }
+
+    if (NULL != pAdditionalInput)
+    {
+        status = LacSymDrbg_SeedMaterial(
+            pSession, pAdditionalInput, 1, additionalInput);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = LacSymDrbg_Update(pSession, additionalInput);
+            pProvided = additionalInput;
+        }
+    }
+
+    if ((CPA_STATUS_SUCCESS == status) && (0 != numFullBlocks))
+    {
+        if (OSAL_SUCCESS != osalAESCtrKeystream(pSession->key,
+                                                pSession->keyLenInBytes,
+                                                pSession->v,
+                                                pOut,
+                                                numFullBlocks))
+        {
+            status = CPA_STATUS_FAIL;
+        }
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        if (0 != remainder)
+        {
+            numTailBlocks++;
+        }
+        if (OSAL_SUCCESS != osalAESCtrKeystream(pSession->key,
+                                                pSession->keyLenInBytes,
+                                                pSession->v,
+                                                tail,
+                                                numTailBlocks))
+        {
+            status = CPA_STATUS_FAIL;
+        }
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        memcpy(pOut + numFullBlocks * LAC_DRBG_BLOCK_LEN_IN_BYTES,
+               tail,
+               remainder);
+        LacSymDrbg_UpdateFinish(
+            pSession,
+            tail + ((0 != remainder) ? LAC_DRBG_BLOCK_LEN_IN_BYTES : 0),
+            pProvided);
+        pSession->reseedCounter++;
+    }
+    else
+    {
+        LAC_LOG_ERROR("AES counter mode failed");
+    }
+
+    LacSymDrbg_Wipe(additionalInput, sizeof(additionalInput));
+    LacSymDrbg_Wipe(tail, sizeof(tail));
+    return status;
+}
+
+/* Copies a small request out of the pool, refilling it first if needed */
+STATIC CpaStatus LacSymDrbg_PoolGet(lac_sym_drbg_session_t *pSession,
+                                    Cpa8U *pOut,
+                                    Cpa32U lengthInBytes)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    if (LAC_DRBG_POOL_SIZE_IN_BYTES - pSession->poolOffset < lengthInBytes)
+    {
+        /* The bytes left over were never handed out and are overwritten */
+        status = LacSymDrbg_Generate(
+            pSession, NULL, pSession->pool, LAC_DRBG_POOL_SIZE_IN_BYTES);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            LacSymDrbg_Wipe(pSession->pool, LAC_DRBG_POOL_SIZE_IN_BYTES);
+            pSession->poolOffset = LAC_DRBG_POOL_SIZE_IN_BYTES;
+            return status;
+        }
+        pSession->poolOffset = 0;
+    }
+
+    memcpy(pOut, pSession->pool + pSession->poolOffset, lengthInBytes);
+    LacSymDrbg_Wipe(pSession->pool + pSession->poolOffset, lengthInBytes);
+    pSession->poolOffset += lengthInBytes;
+    return status;
+}
+
+/*
+ * Takes the session lock for a request. The entropy source may be slow or
+ * sleep, so entropy input for a reseed is collected before the lock is
+ * taken. A reseed is needed if *pReseed is set on entry, or if the
+ * numGenerates generate requests the call makes would pass the reseed
+ * interval, which sets *pReseed. On success the lock is held and, if a
+ * reseed is needed, pEntropy holds its entropy input.
+ */
+STATIC CpaStatus LacSymDrbg_RequestLock(lac_sym_drbg_session_t *pSession,
+                                        Cpa64U numGenerates,
+                                        CpaBoolean *pReseed,
+                                        CpaFlatBuffer *pEntropy)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    for (;;)
+    {
+        if ((CPA_TRUE == *pReseed) && (0 == pEntropy->dataLenInBytes))
+        {
+            status = LacSymDrbg_EntropyGet(pSession,
+                                           CPA_FALSE,
+                                           pEntropy->pData,
+                                           &pEntropy->dataLenInBytes);
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                return status;
+            }
+        }
+
+        LAC_SPINLOCK(&pSession->sessionLock);
+        if (pSession->reseedCounter + numGenerates >
+            LAC_DRBG_RESEED_INTERVAL + 1)
+        {
+            *pReseed = CPA_TRUE;
+        }
+        if ((CPA_TRUE != *pReseed) || (0 != pEntropy->dataLenInBytes))
+        {
+            return CPA_STATUS_SUCCESS;
+        }
+        /* Other requests reached the interval before the lock was taken */
+        LAC_SPINUNLOCK(&pSession->sessionLock);
+    }
+}
+
+/* Returns the crypto service for an API call, NULL if there is none */
+STATIC CpaInstanceHandle LacSymDrbg_InstanceGet(
+    const CpaInstanceHandle instanceHandle_in)
+{
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        return Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_SYM);
+    }
+    return instanceHandle_in;
+}
+
+/* Points a flat buffer at a known answer test input */
+STATIC void LacSymDrbg_KatInput(const lac_sym_drbg_kat_input_t *pInput,
+                                CpaFlatBuffer *pBuffer)
+{
+    pBuffer->dataLenInBytes = pInput->lenInBytes;
+    pBuffer->pData = (Cpa8U *)pInput->data;
+}
+
+/*
+ * Runs the known answer tests on a session of local memory. The DRBG
+ * functions are called directly, so no entropy source or lock is used.
+ */
+STATIC CpaStatus LacSymDrbg_SelfTest(void)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    lac_sym_drbg_session_t *pSession = NULL;
+    const lac_sym_drbg_kat_t *pKat = NULL;
+    CpaFlatBuffer entropy, nonce, personalization, additional;
+    Cpa8U out[LAC_DRBG_KAT_OUT_LEN_IN_BYTES];
+    Cpa32U i;
+
+    status = LAC_OS_MALLOC(&pSession, sizeof(lac_sym_drbg_session_t));
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+
+    for (i = 0; (CPA_STATUS_SUCCESS == status) &&
+                (i < sizeof(lacDrbgKats) / sizeof(lacDrbgKats[0]));
+         i++)
+    {
+        pKat = &lacDrbgKats[i];
+        osalMemSet(pSession, 0, sizeof(*pSession));
+        pSession->secStrength = pKat->secStrength;
+        pSession->isDFRequired = pKat->isDFRequired;
+        pSession->keyLenInBytes = LacSymDrbg_KeyLenInBytes(pKat->secStrength);
+        pSession->seedLenInBytes =
+            pSession->keyLenInBytes + LAC_DRBG_BLOCK_LEN_IN_BYTES;
+
+        LacSymDrbg_KatInput(&pKat->entropy, &entropy);
+        LacSymDrbg_KatInput(&pKat->nonce, &nonce);
+        LacSymDrbg_KatInput(&pKat->personalization, &personalization);
+        status = LacSymDrbg_Instantiate(
+            pSession, &entropy, &nonce, &personalization);
+        if ((CPA_STATUS_SUCCESS == status) &&
+            (0 != pKat->entropyReseed.lenInBytes))
+        {
+            LacSymDrbg_KatInput(&pKat->entropyReseed, &entropy);
+            LacSymDrbg_KatInput(&pKat->additionalReseed, &additional);
+            status = LacSymDrbg_Reseed(pSession, &entropy, &additional);
+        }
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            LacSymDrbg_KatInput(&pKat->additional1, &additional);
+            status =
+                LacSymDrbg_Generate(pSession, &additional, out, sizeof(out));
+        }
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            LacSymDrbg_KatInput(&pKat->additional2, &additional);
+            status =
+                LacSymDrbg_Generate(pSession, &additional, out, sizeof(out));
+        }
+        if ((CPA_STATUS_SUCCESS == status) &&
+            (0 != memcmp(out, pKat->returnedBits, sizeof(out))))
+        {
+            status = CPA_STATUS_FAIL;
+        }
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            LAC_LOG_ERROR1("DRBG known answer test %u failed", i);
+        }
+    }
+
+    LacSymDrbg_Wipe(pSession, sizeof(*pSession));
+    LAC_OS_FREE(pSession);
+    return status;
+}
+
+/*
+*******************************************************************************
+* Define public/global function definitions
+*******************************************************************************
+*/
+
 /**
  * @ingroup cpaCyDrbg
  */
@@ -87,7 +1082,20 @@ CpaStatus cpaCyDrbgSessionGetSize(const CpaInstanceHandle instanceHandle_in,
                                   const CpaCyDrbgSessionSetupData *pSetupData,
                                   Cpa32U *pSize)
 {
-    return CPA_STATUS_UNSUPPORTED;
+#ifdef ICP_PARAM_CHECK
+    CpaInstanceHandle instanceHandle =
+        LacSymDrbg_InstanceGet(instanceHandle_in);
+
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_SYM));
+    LAC_CHECK_NULL_PARAM(pSetupData);
+    LAC_CHECK_NULL_PARAM(pSize);
+#endif
+
+    *pSize = sizeof(lac_sym_drbg_session_t);
+    return CPA_STATUS_SUCCESS;
 }
 
 /**
@@ -100,7 +1108,93 @@ CpaStatus cpaCyDrbgInitSession(const CpaInstanceHandle instanceHandle_in,
                                CpaCyDrbgSessionHandle sessionHandle,
                                Cpa32U *pSeedLen)
 {
-    return CPA_STATUS_UNSUPPORTED;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle =
+        LacSymDrbg_InstanceGet(instanceHandle_in);
+    sal_crypto_service_t *pCryptoService = NULL;
+    lac_sym_drbg_session_t *pSession = (lac_sym_drbg_session_t *)sessionHandle;
+    Cpa8U entropyData[LAC_DRBG_MAX_SEED_LEN_IN_BYTES];
+    Cpa8U nonceData[LAC_DRBG_MAX_KEY_LEN_IN_BYTES];
+    CpaFlatBuffer entropy;
+    CpaFlatBuffer nonce;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_SYM));
+    LAC_CHECK_NULL_PARAM(pSetupData);
+    LAC_CHECK_NULL_PARAM(sessionHandle);
+    LAC_CHECK_NULL_PARAM(pSeedLen);
+    if ((0 != pSetupData->personalizationString.dataLenInBytes) &&
+        (NULL == pSetupData->personalizationString.pData))
+    {
+        LAC_INVALID_PARAM_LOG("personalizationString.pData is NULL");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    SAL_RUNNING_CHECK(instanceHandle);
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+
+    if (0 == LacSymDrbg_KeyLenInBytes(pSetupData->secStrength))
+    {
+        LAC_INVALID_PARAM_LOG("Invalid security strength");
+        LAC_DRBG_STAT_INC(numSessionErrors, pCryptoService);
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    osalMemSet(pSession, 0, sizeof(*pSession));
+    pSession->secStrength = pSetupData->secStrength;
+    pSession->predictionResistanceRequired =
+        pSetupData->predictionResistanceRequired;
+    pSession->isDFRequired = pLacDrbgIsDFReqFunc();
+    pSession->keyLenInBytes = LacSymDrbg_KeyLenInBytes(pSession->secStrength);
+    pSession->seedLenInBytes =
+        pSession->keyLenInBytes + LAC_DRBG_BLOCK_LEN_IN_BYTES;
+    pSession->pGenCb = pGenCb;
+    pSession->pReseedCb = pReseedCb;
+    pSession->poolOffset = LAC_DRBG_POOL_SIZE_IN_BYTES;
+
+    entropy.pData = entropyData;
+    nonce.pData = nonceData;
+    nonce.dataLenInBytes = 0;
+    status = LacSymDrbg_EntropyGet(
+        pSession, CPA_FALSE, entropy.pData, &entropy.dataLenInBytes);
+    if ((CPA_STATUS_SUCCESS == status) &&
+        (CPA_TRUE == pSession->isDFRequired))
+    {
+        status = LacSymDrbg_EntropyGet(
+            pSession, CPA_TRUE, nonce.pData, &nonce.dataLenInBytes);
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = LAC_SPINLOCK_INIT(&pSession->sessionLock);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = LacSymDrbg_Instantiate(
+            pSession, &entropy, &nonce, &pSetupData->personalizationString);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            LAC_SPINLOCK_DESTROY(&pSession->sessionLock);
+        }
+    }
+    LacSymDrbg_Wipe(entropyData, sizeof(entropyData));
+    LacSymDrbg_Wipe(nonceData, sizeof(nonceData));
+
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        LacSymDrbg_Wipe(pSession, sizeof(*pSession));
+        LAC_DRBG_STAT_INC(numSessionErrors, pCryptoService);
+        return status;
+    }
+
+    pSession->magic = LAC_DRBG_SESSION_MAGIC;
+    *pSeedLen = pSession->seedLenInBytes;
+    LAC_DRBG_STAT_INC(numSessionsInitialized, pCryptoService);
+    return CPA_STATUS_SUCCESS;
 }
 
 /**
@@ -111,7 +1205,146 @@ CpaStatus cpaCyDrbgGen(const CpaInstanceHandle instanceHandle_in,
                        CpaCyDrbgGenOpData *pOpData,
                        CpaFlatBuffer *pPseudoRandomBits)
 {
-    return CPA_STATUS_UNSUPPORTED;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle =
+        LacSymDrbg_InstanceGet(instanceHandle_in);
+    sal_crypto_service_t *pCryptoService = NULL;
+    lac_sym_drbg_session_t *pSession = NULL;
+    const CpaFlatBuffer *pAdditionalInput = NULL;
+    CpaCyGenFlatBufCbFunc pGenCb = NULL;
+    Cpa8U *pOut = NULL;
+    Cpa32U remaining = 0;
+    Cpa32U chunk = 0;
+    Cpa8U entropyData[LAC_DRBG_MAX_SEED_LEN_IN_BYTES];
+    CpaFlatBuffer entropy;
+    CpaBoolean reseed = CPA_FALSE;
+    CpaBoolean isPooled = CPA_FALSE;
+    Cpa64U numGenerates = 0;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_SYM));
+    LAC_CHECK_NULL_PARAM(pOpData);
+    LAC_CHECK_NULL_PARAM(pOpData->sessionHandle);
+    LAC_CHECK_NULL_PARAM(pPseudoRandomBits);
+    LAC_CHECK_NULL_PARAM(pPseudoRandomBits->pData);
+    if (LAC_DRBG_SESSION_MAGIC !=
+        ((lac_sym_drbg_session_t *)pOpData->sessionHandle)->magic)
+    {
+        LAC_INVALID_PARAM_LOG("Session is not initialized");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    if ((0 == pOpData->lengthInBytes) ||
+        (pPseudoRandomBits->dataLenInBytes < pOpData->lengthInBytes))
+    {
+        LAC_INVALID_PARAM_LOG("Invalid lengthInBytes");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    if ((0 != pOpData->additionalInput.dataLenInBytes) &&
+        (NULL == pOpData->additionalInput.pData))
+    {
+        LAC_INVALID_PARAM_LOG("additionalInput.pData is NULL");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    SAL_RUNNING_CHECK(instanceHandle);
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+    pSession = (lac_sym_drbg_session_t *)pOpData->sessionHandle;
+
+    /* SP 800-90A 9.3.1: requests the session was not instantiated for */
+    if ((LacSymDrbg_StrengthInBits(pOpData->secStrength) >
+         LacSymDrbg_StrengthInBits(pSession->secStrength)) ||
+        ((CPA_TRUE == pOpData->predictionResistanceRequired) &&
+         (CPA_TRUE != pSession->predictionResistanceRequired)))
+    {
+        LAC_INVALID_PARAM_LOG("Request exceeds the session capabilities");
+        LAC_DRBG_STAT_INC(numGenRequestErrors, pCryptoService);
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    if (0 != pOpData->additionalInput.dataLenInBytes)
+    {
+        pAdditionalInput = &pOpData->additionalInput;
+    }
+    pOut = pPseudoRandomBits->pData;
+    remaining = pOpData->lengthInBytes;
+    entropy.dataLenInBytes = 0;
+    entropy.pData = entropyData;
+
+    /* Small requests without additional input or prediction resistance
+     * are served from the pool, with one generate request to refill it */
+    if ((CPA_TRUE != pOpData->predictionResistanceRequired) &&
+        (NULL == pAdditionalInput) &&
+        (remaining <= LAC_DRBG_POOL_MAX_REQ_IN_BYTES))
+    {
+        isPooled = CPA_TRUE;
+        numGenerates = 1;
+    }
+    else
+    {
+        numGenerates =
+            ((Cpa64U)remaining + LAC_DRBG_MAX_BYTES_PER_REQUEST - 1) /
+            LAC_DRBG_MAX_BYTES_PER_REQUEST;
+    }
+    reseed = pOpData->predictionResistanceRequired;
+
+    status = LacSymDrbg_RequestLock(pSession, numGenerates, &reseed, &entropy);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        LacSymDrbg_Wipe(entropyData, sizeof(entropyData));
+        LAC_DRBG_STAT_INC(numGenRequestErrors, pCryptoService);
+        return status;
+    }
+
+    /* A reseed the interval requires is made ahead of the generate
+     * requests, and takes the additional input like one made for
+     * prediction resistance */
+    if (CPA_TRUE == reseed)
+    {
+        status = LacSymDrbg_Reseed(pSession, &entropy, pAdditionalInput);
+        pAdditionalInput = NULL;
+    }
+    if ((CPA_STATUS_SUCCESS == status) && (CPA_TRUE == isPooled))
+    {
+        status = LacSymDrbg_PoolGet(pSession, pOut, remaining);
+        remaining = 0;
+    }
+
+    /* Anything else is generated directly into the client buffer, in as
+     * many generate requests as the per request limit needs. The
+     * additional input goes with the first one. */
+    while ((CPA_STATUS_SUCCESS == status) && (0 != remaining))
+    {
+        chunk = (remaining < LAC_DRBG_MAX_BYTES_PER_REQUEST)
+                    ? remaining
+                    : LAC_DRBG_MAX_BYTES_PER_REQUEST;
+        status = LacSymDrbg_Generate(pSession, pAdditionalInput, pOut, chunk);
+        pAdditionalInput = NULL;
+        pOut += chunk;
+        remaining -= chunk;
+    }
+    pGenCb = pSession->pGenCb;
+    LAC_SPINUNLOCK(&pSession->sessionLock);
+    LacSymDrbg_Wipe(entropyData, sizeof(entropyData));
+
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        LAC_DRBG_STAT_INC(numGenRequestErrors, pCryptoService);
+        return status;
+    }
+    LAC_DRBG_STAT_INC(numGenRequests, pCryptoService);
+    LAC_DRBG_STAT_INC(numGenCompleted, pCryptoService);
+
+    /* The request completes on the host, so the callback is made before
+     * returning */
+    if (NULL != pGenCb)
+    {
+        pGenCb(pCallbackTag, CPA_STATUS_SUCCESS, pOpData, pPseudoRandomBits);
+    }
+    return CPA_STATUS_SUCCESS;
 }
 
 /**
@@ -121,7 +1354,66 @@ CpaStatus cpaCyDrbgReseed(const CpaInstanceHandle instanceHandle_in,
                           void *pCallbackTag,
                           CpaCyDrbgReseedOpData *pOpData)
 {
-    return CPA_STATUS_UNSUPPORTED;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle =
+        LacSymDrbg_InstanceGet(instanceHandle_in);
+    sal_crypto_service_t *pCryptoService = NULL;
+    lac_sym_drbg_session_t *pSession = NULL;
+    CpaCyGenericCbFunc pReseedCb = NULL;
+    Cpa8U entropyData[LAC_DRBG_MAX_SEED_LEN_IN_BYTES];
+    CpaFlatBuffer entropy;
+    CpaBoolean reseed = CPA_TRUE;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_SYM));
+    LAC_CHECK_NULL_PARAM(pOpData);
+    LAC_CHECK_NULL_PARAM(pOpData->sessionHandle);
+    if (LAC_DRBG_SESSION_MAGIC !=
+        ((lac_sym_drbg_session_t *)pOpData->sessionHandle)->magic)
+    {
+        LAC_INVALID_PARAM_LOG("Session is not initialized");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    if ((0 != pOpData->additionalInput.dataLenInBytes) &&
+        (NULL == pOpData->additionalInput.pData))
+    {
+        LAC_INVALID_PARAM_LOG("additionalInput.pData is NULL");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    SAL_RUNNING_CHECK(instanceHandle);
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+    pSession = (lac_sym_drbg_session_t *)pOpData->sessionHandle;
+    entropy.dataLenInBytes = 0;
+    entropy.pData = entropyData;
+
+    status = LacSymDrbg_RequestLock(pSession, 0, &reseed, &entropy);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status =
+            LacSymDrbg_Reseed(pSession, &entropy, &pOpData->additionalInput);
+        pReseedCb = pSession->pReseedCb;
+        LAC_SPINUNLOCK(&pSession->sessionLock);
+    }
+    LacSymDrbg_Wipe(entropyData, sizeof(entropyData));
+
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        LAC_DRBG_STAT_INC(numReseedRequestErrors, pCryptoService);
+        return status;
+    }
+    LAC_DRBG_STAT_INC(numReseedRequests, pCryptoService);
+    LAC_DRBG_STAT_INC(numReseedCompleted, pCryptoService);
+
+    if (NULL != pReseedCb)
+    {
+        pReseedCb(pCallbackTag, CPA_STATUS_SUCCESS, pOpData);
+    }
+    return CPA_STATUS_SUCCESS;
 }
 
 /**
@@ -130,7 +1422,34 @@ CpaStatus cpaCyDrbgReseed(const CpaInstanceHandle instanceHandle_in,
 CpaStatus cpaCyDrbgRemoveSession(const CpaInstanceHandle instanceHandle_in,
                                  CpaCyDrbgSessionHandle sessionHandle)
 {
-    return CPA_STATUS_UNSUPPORTED;
+    CpaInstanceHandle instanceHandle =
+        LacSymDrbg_InstanceGet(instanceHandle_in);
+    sal_crypto_service_t *pCryptoService = NULL;
+    lac_sym_drbg_session_t *pSession = (lac_sym_drbg_session_t *)sessionHandle;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_SYM));
+    LAC_CHECK_NULL_PARAM(sessionHandle);
+#endif
+
+    SAL_RUNNING_CHECK(instanceHandle);
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+
+    if (LAC_DRBG_SESSION_MAGIC != pSession->magic)
+    {
+        LAC_INVALID_PARAM_LOG("Session is not initialized");
+        LAC_DRBG_STAT_INC(numSessionErrors, pCryptoService);
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    /* Requests complete before returning, so none can be outstanding */
+    LAC_SPINLOCK_DESTROY(&pSession->sessionLock);
+    LacSymDrbg_Wipe(pSession, sizeof(*pSession));
+    LAC_DRBG_STAT_INC(numSessionsRemoved, pCryptoService);
+    return CPA_STATUS_SUCCESS;
 }
 
 /**
@@ -139,5 +1458,157 @@ CpaStatus cpaCyDrbgRemoveSession(const CpaInstanceHandle instanceHandle_in,
 CpaStatus cpaCyDrbgQueryStats64(const CpaInstanceHandle instanceHandle_in,
                                 CpaCyDrbgStats64 *pStats)
 {
-    return CPA_STATUS_UNSUPPORTED;
+    CpaInstanceHandle instanceHandle =
+        LacSymDrbg_InstanceGet(instanceHandle_in);
+    sal_crypto_service_t *pCryptoService = NULL;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_SYM));
+    LAC_CHECK_NULL_PARAM(pStats);
+#endif
+
+    SAL_RUNNING_CHECK(instanceHandle);
+    pCryptoService = (sal_crypto_service_t *)instanceHandle;
+
+    LAC_DRBG_STATS64_GET(*pStats, pCryptoService);
+    return CPA_STATUS_SUCCESS;
+}
+
+IcpSalDrbgGetEntropyInputFunc icp_sal_drbgGetEntropyInputFuncRegister(
+    IcpSalDrbgGetEntropyInputFunc func)
+{
+    IcpSalDrbgGetEntropyInputFunc pPrev = pLacDrbgGetEntropyInputFunc;
+
+    pLacDrbgGetEntropyInputFunc =
+        (NULL != func) ? func : LacSymDrbg_DefaultGetEntropyInput;
+    return pPrev;
+}
+
+IcpSalDrbgGetNonceFunc icp_sal_drbgGetNonceFuncRegister(
+    IcpSalDrbgGetNonceFunc func)
+{
+    IcpSalDrbgGetNonceFunc pPrev = pLacDrbgGetNonceFunc;
+
+    pLacDrbgGetNonceFunc = (NULL != func) ? func : LacSymDrbg_DefaultGetNonce;
+    return pPrev;
+}
+
+IcpSalDrbgIsDFReqFunc icp_sal_drbgIsDFReqFuncRegister(
+    IcpSalDrbgIsDFReqFunc func)
+{
+    IcpSalDrbgIsDFReqFunc pPrev = pLacDrbgIsDFReqFunc;
+
+    pLacDrbgIsDFReqFunc = (NULL != func) ? func : LacSymDrbg_DefaultIsDFReq;
+    return pPrev;
+}
+
+CpaStatus LacSymDrbg_Init(CpaInstanceHandle instanceHandle)
+{
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    status = LacSymDrbg_SelfTest();
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+
+    status = LAC_OS_MALLOC(&(pCryptoService->pLacDrbgStatsArr),
+                           LAC_DRBG_NUM_STATS * sizeof(OsalAtomic));
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        LAC_DRBG_STATS_INIT(pCryptoService);
+    }
+    return status;
+}
+
+void LacSymDrbg_StatsFree(CpaInstanceHandle instanceHandle)
+{
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+
+    if (NULL != pCryptoService->pLacDrbgStatsArr)
+    {
+        LAC_OS_FREE(pCryptoService->pLacDrbgStatsArr);
+    }
+}
+
+void LacSymDrbg_StatsShow(CpaInstanceHandle instanceHandle)
+{
+    sal_crypto_service_t *pCryptoService =
+        (sal_crypto_service_t *)instanceHandle;
+    CpaCyDrbgStats64 drbgStats = {0};
+
+    if (CPA_TRUE !=
+        pCryptoService->generic_service_info.stats->bDrbgStatsEnabled)
+    {
+        return;
+    }
+
+    (void)cpaCyDrbgQueryStats64(instanceHandle, &drbgStats);
+
+    osalLog64(OSAL_LOG_LVL_USER,
+              OSAL_LOG_DEV_STDOUT,
+              SEPARATOR BORDER
+              "                 DRBG Stats                 " BORDER
+              "\n" SEPARATOR,
+              0,
+              0,
+              0,
+              0,
+              0,
+              0,
+              0,
+              0);
+
+    osalLog64(OSAL_LOG_LVL_USER,
+              OSAL_LOG_DEV_STDOUT,
+              BORDER
+              " Sessions Initialized:           %16llu " BORDER "\n" BORDER
+              " Sessions Removed:               %16llu " BORDER "\n" BORDER
+              " Session Errors:                 %16llu " BORDER "\n" SEPARATOR,
+              drbgStats.numSessionsInitialized,
+              drbgStats.numSessionsRemoved,
+              drbgStats.numSessionErrors,
+              0,
+              0,
+              0,
+              0,
+              0);
+
+    osalLog64(OSAL_LOG_LVL_USER,
+              OSAL_LOG_DEV_STDOUT,
+              BORDER
+              " Generate Requests:              %16llu " BORDER "\n" BORDER
+              " Generate Request Errors:        %16llu " BORDER "\n" BORDER
+              " Generate Completed:             %16llu " BORDER "\n" BORDER
+              " Generate Completed Errors:      %16llu " BORDER "\n" SEPARATOR,
+              drbgStats.numGenRequests,
+              drbgStats.numGenRequestErrors,
+              drbgStats.numGenCompleted,
+              drbgStats.numGenCompletedErrors,
+              0,
+              0,
+              0,
+              0);
+
+    osalLog64(OSAL_LOG_LVL_USER,
+              OSAL_LOG_DEV_STDOUT,
+              BORDER
+              " Reseed Requests:                %16llu " BORDER "\n" BORDER
+              " Reseed Request Errors:          %16llu " BORDER "\n" BORDER
+              " Reseed Completed:               %16llu " BORDER "\n" BORDER
+              " Reseed Completed Errors:        %16llu " BORDER "\n" SEPARATOR,
+              drbgStats.numReseedRequests,
+              drbgStats.numReseedRequestErrors,
+              drbgStats.numReseedCompleted,
+              drbgStats.numReseedCompletedErrors,
+              0,
+              0,
+              0,
+              0);
 }
@@ -140,8 +140,8 @@
 #define LAC_SYM_SESSION_H
 
 /*
- * Common alignment attributes to ensure
- * hashStatePrefixBuffer is 64-byte aligned
+ * Common alignment attributes to ensure hashStatePrefixBuffer and the
+ * session descriptor field groups are 64-byte aligned
  */
 #define ALIGN_START(x)
 #define ALIGN_END(x) __attribute__((__aligned__(x)))
@@ -180,6 +180,12 @@
 *      for determining the size of memory to allocate.
 *      The comments section of each of the other two structures below show
 *      the conditions that determine which session context memory size to use.
+*      Fields after the content descriptors are grouped by cache line: the
+*      request templates and configuration read on every request come first,
+*      followed by one line written on the submit path and one written on
+*      the completion path, so the two sides do not false share. Fields only
+*      used at session init/update fill the tail of the written lines. The
+*      layout is checked in LacSym_CompileTimeAssertions.
 *****************************************************************************/
 typedef struct lac_session_desc_s
 {
@@ -191,64 +197,51 @@ typedef struct lac_session_desc_s
     /**< QAT Optimised Content Descriptor for this session.
      * NOTE: Field must be correctly aligned in memory for access by QAT engine
      */
+
+    /* Request templates - read by every perform, written only at session
+     * init/update. */
+    ALIGN_START(64)
+    icp_qat_la_bulk_req_hdr_t reqCacheHdr ALIGN_END(64);
+    icp_qat_fw_la_key_gen_common_t reqCacheMid;
+    icp_qat_la_bulk_req_ftr_t reqCacheFtr;
+    /**< Cache as much as possible of the bulk request in a pre built
+     * request (header, mid & footer). */
+    CpaCySymCbFunc pSymCb;
+    /**< symmetric function callback pointer */
+    ALIGN_START(64)
+    icp_qat_la_bulk_req_hdr_t shramReqCacheHdr ALIGN_END(64);
+    icp_qat_fw_la_key_gen_common_t shramReqCacheMid;
+    icp_qat_la_bulk_req_ftr_t shramReqCacheFtr;
+    /**< Alternative pre-built request (header, mid & footer)
+     * for use with symConstantsTable. */
+    CpaInstanceHandle pInstance;
+    /**< Pointer to Crypto instance running this session. */
+
+    /* Session configuration read on the perform and callback paths -
+     * written only at session init/update. */
+    ALIGN_START(64)
+    lac_sym_qat_hash_state_buffer_info_t hashStateBufferInfo ALIGN_END(64);
+    /**< info on the hash state prefix buffer */
+    void *writeRingMsgFunc;
+    /**< function which will be called to write ring message */
     CpaCySymOp symOperation;
     /**< type of command to be performed */
-    sal_qat_content_desc_info_t contentDescInfo;
-    /**< info on the content descriptor */
-    sal_qat_content_desc_info_t contentDescOptimisedInfo;
-    /**< info on the optimised content descriptor */
     icp_qat_fw_la_cmd_id_t laCmdId;
     /**<Command Id for the QAT FW */
-    lac_sym_qat_hash_state_buffer_info_t hashStateBufferInfo;
-    /**< info on the hash state prefix buffer */
     CpaCySymHashAlgorithm hashAlgorithm;
     /**< hash algorithm */
-    Cpa32U authKeyLenInBytes;
-    /**< Authentication key length in bytes */
-    CpaCySymHashMode hashMode;
-    /**< Mode of the hash operation. plain, auth or nested */
     Cpa32U hashResultSize;
     /**< size of the digest produced/compared in bytes */
     CpaCySymCipherAlgorithm cipherAlgorithm;
     /**< Cipher algorithm and mode */
-    Cpa32U cipherKeyLenInBytes;
-    /**< Cipher key length in bytes */
     CpaCySymCipherDirection cipherDirection;
     /**< This parameter determines if the cipher operation is an encrypt or
      * a decrypt operation. */
-    CpaCySymPacketType partialState;
-    /**< state of the partial packet. This can be written to by the perform
-     * because the SpinLock pPartialInFlightSpinlock guarantees that the
-     * state is accessible in only one place at a time. */
-    icp_qat_la_bulk_req_hdr_t reqCacheHdr;
-    icp_qat_fw_la_key_gen_common_t reqCacheMid;
-    icp_qat_la_bulk_req_ftr_t reqCacheFtr;
-    /**< Cache as much as possible of the bulk request in a pre built
-     * request (header, mid & footer). */
-    CpaCySymCbFunc pSymCb;
-    /**< symmetric function callback pointer */
-    union {
-        OsalAtomic pendingCbCount;
-        /**< Keeps track of number of pending requests.  */
-        Cpa64U pendingDpCbCount;
-        /**< Keeps track of number of pending DP requests (not thread safe)*/
-    } u;
-    struct lac_sym_bulk_cookie_s *pRequestQueueHead;
-    /**< A fifo list of queued QAT requests. Head points to first queue entry */
-    struct lac_sym_bulk_cookie_s *pRequestQueueTail;
-    /**< A fifo list of queued QAT requests. Tail points to last queue entry */
-    lac_lock_t requestQueueLock;
-    /**< A lock to protect accesses to the above request queue  */
-    CpaInstanceHandle pInstance;
-    /**< Pointer to Crypto instance running this session. */
+    Cpa32U aadLenInBytes;
+    /**< For CCM,GCM and Snow3G cases, this parameter holds the AAD size,
+     * otherwise it is set to zero */
     CpaBoolean isAuthEncryptOp : 1;
     /**< if the algorithm chaining operation is auth encrypt */
-    CpaBoolean nonBlockingOpsInProgress : 1;
-    /**< Flag is set if a non blocking operation is in progress for a session.
-     * If set to false, new requests will be queued until the condition is
-     * cleared.
-     * ASSUMPTION: Only one blocking condition per session can exist at any time
-     */
     CpaBoolean internalSession : 1;
     /**< Flag which is set if the session was set up internally for DRBG */
     CpaBoolean isDPSession : 1;
@@ -267,23 +260,61 @@ typedef struct lac_session_desc_s
     /**< Flag indicating whether the SymConstantsTable can be used or not */
     CpaBoolean useOptimisedContentDesc : 1;
     /**< Flag indicating whether to use the optimised CD or not */
-    icp_qat_la_bulk_req_hdr_t shramReqCacheHdr;
-    icp_qat_fw_la_key_gen_common_t shramReqCacheMid;
-    icp_qat_la_bulk_req_ftr_t shramReqCacheFtr;
-    /**< Alternative pre-built request (header, mid & footer)
-     * for use with symConstantsTable. */
-    icp_qat_hw_auth_mode_t qatHashMode;
-    /**< Hash Mode for the qat slices. Not to be confused with QA-API hashMode
-     */
-    void *writeRingMsgFunc;
-    /**< function which will be called to write ring message */
-    OsalMutex accessLock;
+
+    /* Written by the submitting thread on every trad API perform. The tail
+     * of the line holds fields only touched at session init/update. */
+    ALIGN_START(64)
+    OsalMutex accessLock ALIGN_END(64);
     /**< Session access lock */
     Cpa32U accessReaders;
     /**< Session readers counter */
-    Cpa32U aadLenInBytes;
-    /**< For CCM,GCM and Snow3G cases, this parameter holds the AAD size,
-     * otherwise it is set to zero */
+    CpaCySymPacketType partialState;
+    /**< state of the partial packet. This can be written to by the perform
+     * because the SpinLock pPartialInFlightSpinlock guarantees that the
+     * state is accessible in only one place at a time. */
+    sal_qat_content_desc_info_t contentDescInfo;
+    /**< info on the content descriptor */
+    sal_qat_content_desc_info_t contentDescOptimisedInfo;
+    /**< info on the optimised content descriptor */
+
+    /* Written on the completion path (and by the submitter when a request
+     * is queued). The tail of the line holds fields only touched at session
+     * init/update or on rare callback paths. */
+    ALIGN_START(64)
+    union {
+        OsalAtomic pendingCbCount;
+        /**< Keeps track of number of pending requests.  */
+        Cpa64U pendingDpCbCount;
+        /**< Keeps track of number of pending DP requests (not thread safe)*/
+    } u ALIGN_END(64);
+    OsalAtomic requestQueueCount;
+    /**< Number of requests queued on the session plus one while a partial
+     * packet is in flight or the queue is being drained, plus
+     * LAC_SYM_QUEUE_HOLD while a hash precompute is in progress. Requests
+     * are only sent directly when it is zero; whoever raises it from zero
+     * owns sending the queued requests.
+     * ASSUMPTION: Only one blocking condition per session can exist at any time
+     */
+    struct lac_sym_bulk_cookie_s *pRequestQueueHead;
+    /**< A fifo list of queued QAT requests taken over by the owner of the
+     * queue. Head points to first queue entry. Only accessed by the owner */
+    struct lac_sym_bulk_cookie_s *volatile pRequestQueueNew;
+    /**< A lifo list of QAT requests queued since the owner last took them
+     * over, newest first. Producers push with a compare and exchange and
+     * the owner takes the whole list with an exchange. A drain waiting for
+     * a request that is counted but not pushed yet leaves a stall marker
+     * here instead, and the producer that replaces it finishes the drain */
+    CpaCySymHashMode hashMode;
+    /**< Mode of the hash operation. plain, auth or nested */
+    icp_qat_hw_auth_mode_t qatHashMode;
+    /**< Hash Mode for the qat slices. Not to be confused with QA-API hashMode
+     */
+    Cpa32U authKeyLenInBytes;
+    /**< Authentication key length in bytes */
+    Cpa32U cipherKeyLenInBytes;
+    /**< Cipher key length in bytes */
+    Cpa32U sessionCtxSizeInBytes;
+    /**< Size of the session context the descriptor was set up for */
     ALIGN_START(64)
     Cpa8U hashStatePrefixBuffer[LAC_MAX_AAD_SIZE_BYTES] ALIGN_END(64);
     /**< hash state prefix buffer used for hash operations - AAD only
@@ -334,64 +365,51 @@ typedef struct lac_session_desc_d1_s
     /**< QAT Optimised Content Descriptor for this session.
      * NOTE: Field must be correctly aligned in memory for access by QAT engine
      */
+
+    /* Request templates - read by every perform, written only at session
+     * init/update. */
+    ALIGN_START(64)
+    icp_qat_la_bulk_req_hdr_t reqCacheHdr ALIGN_END(64);
+    icp_qat_fw_la_key_gen_common_t reqCacheMid;
+    icp_qat_la_bulk_req_ftr_t reqCacheFtr;
+    /**< Cache as much as possible of the bulk request in a pre built
+     * request (header, mid & footer). */
+    CpaCySymCbFunc pSymCb;
+    /**< symmetric function callback pointer */
+    ALIGN_START(64)
+    icp_qat_la_bulk_req_hdr_t shramReqCacheHdr ALIGN_END(64);
+    icp_qat_fw_la_key_gen_common_t shramReqCacheMid;
+    icp_qat_la_bulk_req_ftr_t shramReqCacheFtr;
+    /**< Alternative pre-built request (header, mid & footer)
+     * for use with symConstantsTable. */
+    CpaInstanceHandle pInstance;
+    /**< Pointer to Crypto instance running this session. */
+
+    /* Session configuration read on the perform and callback paths -
+     * written only at session init/update. */
+    ALIGN_START(64)
+    lac_sym_qat_hash_state_buffer_info_t hashStateBufferInfo ALIGN_END(64);
+    /**< info on the hash state prefix buffer */
+    void *writeRingMsgFunc;
+    /**< function which will be called to write ring message */
     CpaCySymOp symOperation;
     /**< type of command to be performed */
-    sal_qat_content_desc_info_t contentDescInfo;
-    /**< info on the content descriptor */
-    sal_qat_content_desc_info_t contentDescOptimisedInfo;
-    /**< info on the optimised content descriptor */
     icp_qat_fw_la_cmd_id_t laCmdId;
     /**<Command Id for the QAT FW */
-    lac_sym_qat_hash_state_buffer_info_t hashStateBufferInfo;
-    /**< info on the hash state prefix buffer */
     CpaCySymHashAlgorithm hashAlgorithm;
     /**< hash algorithm */
-    Cpa32U authKeyLenInBytes;
-    /**< Authentication key length in bytes */
-    CpaCySymHashMode hashMode;
-    /**< Mode of the hash operation. plain, auth or nested */
     Cpa32U hashResultSize;
     /**< size of the digest produced/compared in bytes */
     CpaCySymCipherAlgorithm cipherAlgorithm;
     /**< Cipher algorithm and mode */
-    Cpa32U cipherKeyLenInBytes;
-    /**< Cipher key length in bytes */
     CpaCySymCipherDirection cipherDirection;
     /**< This parameter determines if the cipher operation is an encrypt or
      * a decrypt operation. */
-    CpaCySymPacketType partialState;
-    /**< state of the partial packet. This can be written to by the perform
-     * because the SpinLock pPartialInFlightSpinlock guarantees that that the
-     * state is accessible in only one place at a time. */
-    icp_qat_la_bulk_req_hdr_t reqCacheHdr;
-    icp_qat_fw_la_key_gen_common_t reqCacheMid;
-    icp_qat_la_bulk_req_ftr_t reqCacheFtr;
-    /**< Cache as much as possible of the bulk request in a pre built
-     * request (header, mid & footer). */
-    CpaCySymCbFunc pSymCb;
-    /**< symmetric function callback pointer */
-    union {
-        OsalAtomic pendingCbCount;
-        /**< Keeps track of number of pending requests.  */
-        Cpa64U pendingDpCbCount;
-        /**< Keeps track of number of pending DP requests (not thread safe)*/
-    } u;
-    struct lac_sym_bulk_cookie_s *pRequestQueueHead;
-    /**< A fifo list of queued QAT requests. Head points to first queue entry */
-    struct lac_sym_bulk_cookie_s *pRequestQueueTail;
-    /**< A fifo list of queued QAT requests. Tail points to last queue entry */
-    lac_lock_t requestQueueLock;
-    /**< A lock to protect accesses to the above request queue  */
-    CpaInstanceHandle pInstance;
-    /**< Pointer to Crypto instance running this session. */
+    Cpa32U aadLenInBytes;
+    /**< For CCM,GCM and Snow3G cases, this parameter holds the AAD size,
+     * otherwise it is set to zero */
     CpaBoolean isAuthEncryptOp : 1;
     /**< if the algorithm chaining operation is auth encrypt */
-    CpaBoolean nonBlockingOpsInProgress : 1;
-    /**< Flag is set if a non blocking operation is in progress for a session.
-     * If set to false, new requests will be queued until the condition is
-     * cleared.
-     * ASSUMPTION: Only one blocking condition per session can exist at any time
-     */
     CpaBoolean internalSession : 1;
     /**< Flag which is set if the session was set up internally for DRBG */
     CpaBoolean isDPSession : 1;
@@ -410,20 +428,61 @@ typedef struct lac_session_desc_d1_s
     /**< Flag indicating whether the SymConstantsTable can be used or not */
     CpaBoolean useOptimisedContentDesc : 1;
     /**< Flag indicating whether to use the optimised CD or not */
-    icp_qat_la_bulk_req_hdr_t shramReqCacheHdr;
-    icp_qat_fw_la_key_gen_common_t shramReqCacheMid;
-    icp_qat_la_bulk_req_ftr_t shramReqCacheFtr;
-    /**< Alternative pre-built request (header, mid & footer)
-     * for use with symConstantsTable. */
-    icp_qat_hw_auth_mode_t qatHashMode;
-    /**< Hash Mode for the qat slices. Not to be confused with QA-API hashMode
-     */
-    void *writeRingMsgFunc;
-    /**< function which will be called to write ring message */
-    OsalMutex accessLock;
+
+    /* Written by the submitting thread on every trad API perform. The tail
+     * of the line holds fields only touched at session init/update. */
+    ALIGN_START(64)
+    OsalMutex accessLock ALIGN_END(64);
     /**< Session access lock */
     Cpa32U accessReaders;
     /**< Session readers counter */
+    CpaCySymPacketType partialState;
+    /**< state of the partial packet. This can be written to by the perform
+     * because the SpinLock pPartialInFlightSpinlock guarantees that the
+     * state is accessible in only one place at a time. */
+    sal_qat_content_desc_info_t contentDescInfo;
+    /**< info on the content descriptor */
+    sal_qat_content_desc_info_t contentDescOptimisedInfo;
+    /**< info on the optimised content descriptor */
+
+    /* Written on the completion path (and by the submitter when a request
+     * is queued). The tail of the line holds fields only touched at session
+     * init/update or on rare callback paths. */
+    ALIGN_START(64)
+    union {
+        OsalAtomic pendingCbCount;
+        /**< Keeps track of number of pending requests.  */
+        Cpa64U pendingDpCbCount;
+        /**< Keeps track of number of pending DP requests (not thread safe)*/
+    } u ALIGN_END(64);
+    OsalAtomic requestQueueCount;
+    /**< Number of requests queued on the session plus one while a partial
+     * packet is in flight or the queue is being drained, plus
+     * LAC_SYM_QUEUE_HOLD while a hash precompute is in progress. Requests
+     * are only sent directly when it is zero; whoever raises it from zero
+     * owns sending the queued requests.
+     * ASSUMPTION: Only one blocking condition per session can exist at any time
+     */
+    struct lac_sym_bulk_cookie_s *pRequestQueueHead;
+    /**< A fifo list of queued QAT requests taken over by the owner of the
+     * queue. Head points to first queue entry. Only accessed by the owner */
+    struct lac_sym_bulk_cookie_s *volatile pRequestQueueNew;
+    /**< A lifo list of QAT requests queued since the owner last took them
+     * over, newest first. Producers push with a compare and exchange and
+     * the owner takes the whole list with an exchange. A drain waiting for
+     * a request that is counted but not pushed yet leaves a stall marker
+     * here instead, and the producer that replaces it finishes the drain */
+    CpaCySymHashMode hashMode;
+    /**< Mode of the hash operation. plain, auth or nested */
+    icp_qat_hw_auth_mode_t qatHashMode;
+    /**< Hash Mode for the qat slices. Not to be confused with QA-API hashMode
+     */
+    Cpa32U authKeyLenInBytes;
+    /**< Authentication key length in bytes */
+    Cpa32U cipherKeyLenInBytes;
+    /**< Cipher key length in bytes */
+    Cpa32U sessionCtxSizeInBytes;
+    /**< Size of the session context the descriptor was set up for */
 } lac_session_desc_d1_t;
 
 /**
@@ -449,64 +508,51 @@ typedef struct lac_session_desc_d2_s
     /**< QAT Optimised Content Descriptor for this session.
      * NOTE: Field must be correctly aligned in memory for access by QAT engine
      */
+
+    /* Request templates - read by every perform, written only at session
+     * init/update. */
+    ALIGN_START(64)
+    icp_qat_la_bulk_req_hdr_t reqCacheHdr ALIGN_END(64);
+    icp_qat_fw_la_key_gen_common_t reqCacheMid;
+    icp_qat_la_bulk_req_ftr_t reqCacheFtr;
+    /**< Cache as much as possible of the bulk request in a pre built
+     * request (header, mid & footer). */
+    CpaCySymCbFunc pSymCb;
+    /**< symmetric function callback pointer */
+    ALIGN_START(64)
+    icp_qat_la_bulk_req_hdr_t shramReqCacheHdr ALIGN_END(64);
+    icp_qat_fw_la_key_gen_common_t shramReqCacheMid;
+    icp_qat_la_bulk_req_ftr_t shramReqCacheFtr;
+    /**< Alternative pre-built request (header, mid & footer)
+     * for use with symConstantsTable. */
+    CpaInstanceHandle pInstance;
+    /**< Pointer to Crypto instance running this session. */
+
+    /* Session configuration read on the perform and callback paths -
+     * written only at session init/update. */
+    ALIGN_START(64)
+    lac_sym_qat_hash_state_buffer_info_t hashStateBufferInfo ALIGN_END(64);
+    /**< info on the hash state prefix buffer */
+    void *writeRingMsgFunc;
+    /**< function which will be called to write ring message */
     CpaCySymOp symOperation;
     /**< type of command to be performed */
-    sal_qat_content_desc_info_t contentDescInfo;
-    /**< info on the content descriptor */
-    sal_qat_content_desc_info_t contentDescOptimisedInfo;
-    /**< info on the optimised content descriptor */
     icp_qat_fw_la_cmd_id_t laCmdId;
     /**<Command Id for the QAT FW */
-    lac_sym_qat_hash_state_buffer_info_t hashStateBufferInfo;
-    /**< info on the hash state prefix buffer */
     CpaCySymHashAlgorithm hashAlgorithm;
     /**< hash algorithm */
-    Cpa32U authKeyLenInBytes;
-    /**< Authentication key length in bytes */
-    CpaCySymHashMode hashMode;
-    /**< Mode of the hash operation. plain, auth or nested */
     Cpa32U hashResultSize;
     /**< size of the digest produced/compared in bytes */
     CpaCySymCipherAlgorithm cipherAlgorithm;
     /**< Cipher algorithm and mode */
-    Cpa32U cipherKeyLenInBytes;
-    /**< Cipher key length in bytes */
     CpaCySymCipherDirection cipherDirection;
     /**< This parameter determines if the cipher operation is an encrypt or
      * a decrypt operation. */
-    CpaCySymPacketType partialState;
-    /**< state of the partial packet. This can be written to by the perform
-     * because the SpinLock pPartialInFlightSpinlock guarantees that that the
-     * state is accessible in only one place at a time. */
-    icp_qat_la_bulk_req_hdr_t reqCacheHdr;
-    icp_qat_fw_la_key_gen_common_t reqCacheMid;
-    icp_qat_la_bulk_req_ftr_t reqCacheFtr;
-    /**< Cache as much as possible of the bulk request in a pre built
-     * request (header. mid & footer). */
-    CpaCySymCbFunc pSymCb;
-    /**< symmetric function callback pointer */
-    union {
-        OsalAtomic pendingCbCount;
-        /**< Keeps track of number of pending requests.  */
-        Cpa64U pendingDpCbCount;
-        /**< Keeps track of number of pending DP requests (not thread safe)*/
-    } u;
-    struct lac_sym_bulk_cookie_s *pRequestQueueHead;
-    /**< A fifo list of queued QAT requests. Head points to first queue entry */
-    struct lac_sym_bulk_cookie_s *pRequestQueueTail;
-    /**< A fifo list of queued QAT requests. Tail points to last queue entry */
-    lac_lock_t requestQueueLock;
-    /**< A lock to protect accesses to the above request queue  */
-    CpaInstanceHandle pInstance;
-    /**< Pointer to Crypto instance running this session. */
+    Cpa32U aadLenInBytes;
+    /**< For CCM,GCM and Snow3G cases, this parameter holds the AAD size,
+     * otherwise it is set to zero */
     CpaBoolean isAuthEncryptOp : 1;
     /**< if the algorithm chaining operation is auth encrypt */
-    CpaBoolean nonBlockingOpsInProgress : 1;
-    /**< Flag is set if a non blocking operation is in progress for a session.
-     * If set to false, new requests will be queued until the condition is
-     * cleared.
-     * ASSUMPTION: Only one blocking condition per session can exist at any time
-     */
     CpaBoolean internalSession : 1;
     /**< Flag which is set if the session was set up internally for DRBG */
     CpaBoolean isDPSession : 1;
@@ -525,23 +571,61 @@ typedef struct lac_session_desc_d2_s
     /**< Flag indicating whether the SymConstantsTable can be used or not */
     CpaBoolean useOptimisedContentDesc : 1;
     /**< Flag indicating whether to use the optimised CD or not */
-    icp_qat_la_bulk_req_hdr_t shramReqCacheHdr;
-    icp_qat_fw_la_key_gen_common_t shramReqCacheMid;
-    icp_qat_la_bulk_req_ftr_t shramReqCacheFtr;
-    /**< Alternative pre-built request (header. mid & footer)
-     * for use with symConstantsTable. */
-    icp_qat_hw_auth_mode_t qatHashMode;
-    /**< Hash Mode for the qat slices. Not to be confused with QA-API hashMode
-     */
-    void *writeRingMsgFunc;
-    /**< function which will be called to write ring message */
-    OsalMutex accessLock;
+
+    /* Written by the submitting thread on every trad API perform. The tail
+     * of the line holds fields only touched at session init/update. */
+    ALIGN_START(64)
+    OsalMutex accessLock ALIGN_END(64);
     /**< Session access lock */
     Cpa32U accessReaders;
     /**< Session readers counter */
-    Cpa32U aadLenInBytes;
-    /**< For CCM,GCM and Snow3G cases, this parameter holds the AAD size,
-     * otherwise it is set to zero */
+    CpaCySymPacketType partialState;
+    /**< state of the partial packet. This can be written to by the perform
+     * because the SpinLock pPartialInFlightSpinlock guarantees that the
+     * state is accessible in only one place at a time. */
+    sal_qat_content_desc_info_t contentDescInfo;
+    /**< info on the content descriptor */
+    sal_qat_content_desc_info_t contentDescOptimisedInfo;
+    /**< info on the optimised content descriptor */
+
+    /* Written on the completion path (and by the submitter when a request
+     * is queued). The tail of the line holds fields only touched at session
+     * init/update or on rare callback paths. */
+    ALIGN_START(64)
+    union {
+        OsalAtomic pendingCbCount;
+        /**< Keeps track of number of pending requests.  */
+        Cpa64U pendingDpCbCount;
+        /**< Keeps track of number of pending DP requests (not thread safe)*/
+    } u ALIGN_END(64);
+    OsalAtomic requestQueueCount;
+    /**< Number of requests queued on the session plus one while a partial
+     * packet is in flight or the queue is being drained, plus
+     * LAC_SYM_QUEUE_HOLD while a hash precompute is in progress. Requests
+     * are only sent directly when it is zero; whoever raises it from zero
+     * owns sending the queued requests.
+     * ASSUMPTION: Only one blocking condition per session can exist at any time
+     */
+    struct lac_sym_bulk_cookie_s *pRequestQueueHead;
+    /**< A fifo list of queued QAT requests taken over by the owner of the
+     * queue. Head points to first queue entry. Only accessed by the owner */
+    struct lac_sym_bulk_cookie_s *volatile pRequestQueueNew;
+    /**< A lifo list of QAT requests queued since the owner last took them
+     * over, newest first. Producers push with a compare and exchange and
+     * the owner takes the whole list with an exchange. A drain waiting for
+     * a request that is counted but not pushed yet leaves a stall marker
+     * here instead, and the producer that replaces it finishes the drain */
+    CpaCySymHashMode hashMode;
+    /**< Mode of the hash operation. plain, auth or nested */
+    icp_qat_hw_auth_mode_t qatHashMode;
+    /**< Hash Mode for the qat slices. Not to be confused with QA-API hashMode
+     */
+    Cpa32U authKeyLenInBytes;
+    /**< Authentication key length in bytes */
+    Cpa32U cipherKeyLenInBytes;
+    /**< Cipher key length in bytes */
+    Cpa32U sessionCtxSizeInBytes;
+    /**< Size of the session context the descriptor was set up for */
     ALIGN_START(64)
     Cpa8U hashStatePrefixBuffer[LAC_MAX_AAD_SIZE_BYTES] ALIGN_END(64);
     /**< hash state prefix buffer used for hash operations - AAD only
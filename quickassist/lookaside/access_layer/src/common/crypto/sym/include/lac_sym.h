@@ -233,6 +233,9 @@ typedef struct lac_sym_bulk_cookie_s
     CpaBoolean updateKeySizeOnRecieve;
     /**< Boolean flag to indicate if the cipher key size should be
      * updated after receiving the response from the QAT */
+    const CpaBufferList *pSrcBuffer;
+    /**< Pointer to source buffer, only read when the request is executed
+     * on the host instead of the QAT */
     CpaBufferList *pDstBuffer;
     /**< Pointer to destination buffer to hold the data output */
     struct lac_sym_bulk_cookie_s *pNext;
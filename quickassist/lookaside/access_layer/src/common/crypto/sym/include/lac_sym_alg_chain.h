@@ -242,6 +242,45 @@ CpaStatus LacAlgChain_SessionUpdate(
     lac_session_desc_t *pSessionDesc,
     const CpaCySymSessionUpdateData *pSessionUpdateData);
 
+/**
+*******************************************************************************
+* @ingroup LacAlgChain
+*      Clone an Algorithm-Chaining session with new keys
+*
+* @description
+*      This function copies an initialised session descriptor into a new
+*      one, points the copied content descriptor and request templates at
+*      the new memory, re-initialises the per session locks and counters,
+*      and then writes the new keys through the same path as
+*      LacAlgChain_SessionUpdate, so only key dependent precomputes run.
+*
+* @param[in] instanceHandle         Instance Handle
+* @param[in] pTemplateDesc          Pointer to the initialised session
+* @param[in] pSessionDesc           Pointer to the new session descriptor,
+*                                   64 byte aligned
+* @param[in] descSizeInBytes        Number of bytes of the descriptor in use
+* @param[in] physAddressAligned     Physical address of pSessionDesc
+* @param[in] pCipherKey             New cipher key or NULL
+* @param[in] pAuthKey               New authentication key or NULL
+*
+* @retval CPA_STATUS_SUCCESS        Function executed successfully.
+* @retval CPA_STATUS_FAIL           Function failed.
+* @retval CPA_STATUS_RETRY          Template session not ready to be copied.
+* @retval CPA_STATUS_INVALID_PARAM  Invalid parameter passed in.
+* @retval CPA_STATUS_RESOURCE       Lock initialisation failed.
+* @retval CPA_STATUS_UNSUPPORTED    Key update not supported for the session.
+*
+* @see icp_sal_CySymCloneSession()
+*
+*****************************************************************************/
+CpaStatus LacAlgChain_SessionClone(const CpaInstanceHandle instanceHandle,
+                                   lac_session_desc_t *pTemplateDesc,
+                                   lac_session_desc_t *pSessionDesc,
+                                   Cpa32U descSizeInBytes,
+                                   CpaPhysicalAddr physAddressAligned,
+                                   Cpa8U *pCipherKey,
+                                   Cpa8U *pAuthKey);
+
 /**
 *******************************************************************************
 * @ingroup LacAlgChain
@@ -97,6 +97,30 @@
  ****************************************************************************/
 CpaStatus LacSymCb_PendingReqsDequeue(lac_session_desc_t *pSessionDesc);
 
+/**
+ *****************************************************************************
+ * @ingroup LacSym
+ *      Complete a request executed on the host
+ *
+ * @description
+ *      This function completes a request that was executed on the host
+ *      instead of being sent to the QAT, in the same way as a response
+ *      from the QAT: the cookie is freed and the session callback is made.
+ *
+ * @param[in] pCookie       Cookie of the request
+ * @param[in] okFlag        CPA_FALSE if the digest did not verify or the
+ *                          operation failed
+ * @param[in] status        Status of the operation
+ * @param[in] pSessionDesc  Pointer to the session descriptor
+ *
+ * @return None
+ *
+ ****************************************************************************/
+void LacSymCb_ProcessHostResponse(lac_sym_bulk_cookie_t *pCookie,
+                                  CpaBoolean okFlag,
+                                  CpaStatus status,
+                                  lac_session_desc_t *pSessionDesc);
+
 /**
  *****************************************************************************
  * @ingroup LacSym
@@ -0,0 +1,232 @@
+/******************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ *****************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file lac_sym_drbg.h
+ *
+ * @defgroup LacSym_Drbg Deterministic Random Bit Generation
+ *
+ * @ingroup LacSym
+ *
+ * @description
+ *      Definitions for the NIST SP 800-90A CTR_DRBG behind the cpaCyDrbg
+ *      API.
+ *
+ * @lld_start
+ *      - The DRBG uses AES at the key size matching the session security
+ *        strength, with the counter field covering the whole block.
+ *      - The key and V are updated on the host. The output of a generate
+ *        request and the update that follows it are one AES-CTR keystream
+ *        computed with a single key schedule, see osalAESCtrKeystream.
+ *      - Each session holds a pool of output produced by one generate
+ *        request. Small requests without additional input or prediction
+ *        resistance are copied from the pool, so that the cost of the
+ *        request and of its state update is shared by many callers. Pool
+ *        bytes are wiped as they are handed out, and the whole pool is
+ *        discarded when the session is reseeded.
+ *      - Entropy input and nonces come from the functions registered
+ *        through icp_sal_drbg_impl.h, by default the operating system
+ *        random number generator. They are collected before the session
+ *        lock is taken, including for the reseed a request makes when the
+ *        reseed interval is reached.
+ *      - Known answer tests run when an instance starts, and a failure
+ *        fails the start of the instance.
+ * @lld_end
+ *
+ ***************************************************************************/
+
+#ifndef LAC_SYM_DRBG_H
+#define LAC_SYM_DRBG_H
+
+/*
+******************************************************************************
+* Include public/global header files
+******************************************************************************
+*/
+
+#include "cpa.h"
+#include "cpa_cy_drbg.h"
+
+/*
+*******************************************************************************
+* Include private header files
+*******************************************************************************
+*/
+
+#include "lac_common.h"
+
+#define LAC_DRBG_BLOCK_LEN_IN_BYTES 16
+/**< @ingroup LacSym_Drbg
+ * AES block length, also the length of V */
+
+#define LAC_DRBG_MAX_KEY_LEN_IN_BYTES 32
+/**< @ingroup LacSym_Drbg
+ * Key length for a security strength of 256 */
+
+#define LAC_DRBG_MAX_SEED_LEN_IN_BYTES                                         \
+    (LAC_DRBG_MAX_KEY_LEN_IN_BYTES + LAC_DRBG_BLOCK_LEN_IN_BYTES)
+/**< @ingroup LacSym_Drbg
+ * Seed length for a security strength of 256 */
+
+#define LAC_DRBG_MAX_SEED_LEN_IN_BLOCKS                                        \
+    (LAC_DRBG_MAX_SEED_LEN_IN_BYTES / LAC_DRBG_BLOCK_LEN_IN_BYTES)
+/**< @ingroup LacSym_Drbg
+ * Number of AES blocks the update function encrypts at most */
+
+#define LAC_DRBG_MAX_BYTES_PER_REQUEST (1 << 16)
+/**< @ingroup LacSym_Drbg
+ * max_number_of_bits_per_request of the AES CTR_DRBG (2^19 bits). Larger
+ * cpaCyDrbgGen requests are split into several generate requests */
+
+#define LAC_DRBG_RESEED_INTERVAL ((Cpa64U)1 << 48)
+/**< @ingroup LacSym_Drbg
+ * Number of generate requests between reseeds */
+
+#define LAC_DRBG_POOL_SIZE_IN_BYTES 4096
+/**< @ingroup LacSym_Drbg
+ * Size of the per session pool of pre-generated output */
+
+#define LAC_DRBG_POOL_MAX_REQ_IN_BYTES 256
+/**< @ingroup LacSym_Drbg
+ * Largest cpaCyDrbgGen request served from the pool */
+
+/**
+ *******************************************************************************
+ * @ingroup LacSym_Drbg
+ *      DRBG session
+ *
+ * @description
+ *      Internal layout of the memory the client allocates for a DRBG
+ *      session. Everything except the callbacks is protected by
+ *      sessionLock.
+ *****************************************************************************/
+typedef struct lac_sym_drbg_session_s
+{
+    Cpa32U magic;
+    /**< Set while the session is initialized */
+    CpaCyDrbgSecStrength secStrength;
+    /**< Security strength the session was instantiated with */
+    CpaBoolean predictionResistanceRequired;
+    /**< Prediction resistance may be requested on this session */
+    CpaBoolean isDFRequired;
+    /**< Seed material goes through the block cipher derivation function */
+    Cpa32U keyLenInBytes;
+    /**< AES key length for the security strength */
+    Cpa32U seedLenInBytes;
+    /**< keyLenInBytes plus the block length */
+    Cpa64U reseedCounter;
+    /**< Number of generate requests since the last (re)seed, plus one */
+    CpaCyGenFlatBufCbFunc pGenCb;
+    /**< Callback for cpaCyDrbgGen, NULL for synchronous operation */
+    CpaCyGenericCbFunc pReseedCb;
+    /**< Callback for cpaCyDrbgReseed, NULL for synchronous operation */
+    lac_lock_t sessionLock;
+    /**< Serialises requests on the session */
+    Cpa8U key[LAC_DRBG_MAX_KEY_LEN_IN_BYTES];
+    /**< Working state Key */
+    Cpa8U v[LAC_DRBG_BLOCK_LEN_IN_BYTES];
+    /**< Working state V */
+    Cpa32U poolOffset;
+    /**< Offset of the first unused pool byte, the pool size when empty */
+    Cpa8U pool[LAC_DRBG_POOL_SIZE_IN_BYTES];
+    /**< Output of the last generate request made to refill the pool */
+} lac_sym_drbg_session_t;
+
+/**
+*******************************************************************************
+* @ingroup LacSym_Drbg
+*      Initialises the DRBG statistics
+*
+* @description
+*      This function allocates and initialises the DRBG stats array to 0
+*
+* @param[in] instanceHandle    Instance handle
+*
+* @retval CPA_STATUS_SUCCESS   initialisation successful
+* @retval CPA_STATUS_RESOURCE  array allocation failed
+*
+*****************************************************************************/
+CpaStatus LacSymDrbg_Init(CpaInstanceHandle instanceHandle);
+
+/**
+*******************************************************************************
+* @ingroup LacSym_Drbg
+*      Frees the DRBG statistics
+*
+* @param[in] instanceHandle    Instance handle
+*
+*****************************************************************************/
+void LacSymDrbg_StatsFree(CpaInstanceHandle instanceHandle);
+
+/**
+*******************************************************************************
+* @ingroup LacSym_Drbg
+*      Prints the DRBG statistics to standard output
+*
+* @param[in] instanceHandle    Instance handle
+*
+*****************************************************************************/
+void LacSymDrbg_StatsShow(CpaInstanceHandle instanceHandle);
+
+#endif /* LAC_SYM_DRBG_H */
@@ -349,6 +349,7 @@
 
 #include "cpa.h"
 #include "cpa_cy_sym.h"
+#include "icp_sal.h"
 
 /*
 *******************************************************************************
@@ -606,4 +607,24 @@ CpaStatus LacSymHash_HmacPrecompInit(CpaInstanceHandle instanceHandle);
 *****************************************************************************/
 void LacSymHash_HmacPrecompShutdown(CpaInstanceHandle instanceHandle);
 
+/**
+*******************************************************************************
+* @ingroup LacHash
+*      get the counters of the hash precompute cache
+*
+* @description
+*      Copies the hit, miss and eviction counters of the precompute cache of
+*      the instance. The cache is only available with software precomputes.
+*
+* @param[in]  instanceHandle       Instance Handle
+* @param[out] pStats               Cache counters
+*
+* @retval CPA_STATUS_SUCCESS       Success
+* @retval CPA_STATUS_UNSUPPORTED   The instance has no precompute cache
+*
+*****************************************************************************/
+CpaStatus LacSymHash_PrecompCacheStatsGet(
+    CpaInstanceHandle instanceHandle,
+    icp_sal_hash_precomp_cache_stats_t *pStats);
+
 #endif /* LAC_SYM_HASH_H */
@@ -0,0 +1,264 @@
+/******************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ *****************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file lac_sym_host.h
+ *
+ * @defgroup LacSymHost Host execution of symmetric requests
+ *
+ * @ingroup LacSym
+ *
+ * @description
+ *      Optional per instance overflow policy for the traditional symmetric
+ *      API. When the sym tx ring of the instance is full, or holds more
+ *      requests than a configured threshold, small AES-GCM and AES-CBC with
+ *      HMAC requests are executed on the host and completed through the
+ *      session callback instead of being returned with CPA_STATUS_RETRY.
+ *
+ * @lld_start
+ *      - The policy is set with Cy<n>SymHostFallback in the configuration
+ *        file: 0 disables it, 1 executes eligible requests on the host when
+ *        the ring is busy and 2 executes every eligible request on the host,
+ *        as if the ring was always full. Cy<n>SymHostFallbackThreshold is
+ *        the number of requests in flight above which the ring is treated
+ *        as busy, 0 only when the ring rejects the request.
+ *        Cy<n>SymHostFallbackMaxSize limits the source buffer size.
+ *      - Only full packets on traditional API sessions, in single flat
+ *        buffers, are eligible. Keys and HMAC states are read from the
+ *        session content descriptor, so the session needs no extra state.
+ *      - The cipher and hash run through the OSAL primitives, which use
+ *        AES-NI, PCLMULQDQ and the SHA extensions when the CPU has them.
+ *      - The callback is made in the context of the submitting thread,
+ *        possibly before requests of the same session that are still on
+ *        the ring complete.
+ *      - Kernel instances always offload.
+ * @lld_end
+ *
+ ***************************************************************************/
+
+#ifndef LAC_SYM_HOST_H
+#define LAC_SYM_HOST_H
+
+/*
+******************************************************************************
+* Include public/global header files
+******************************************************************************
+*/
+
+#include "cpa.h"
+#include "icp_sal.h"
+
+/*
+*******************************************************************************
+* Include private header files
+*******************************************************************************
+*/
+
+#include "lac_session.h"
+#include "lac_sym.h"
+
+#define LAC_SYM_HOST_FALLBACK_OFF 0
+/**< @ingroup LacSymHost
+ * Requests are only ever offloaded */
+
+#define LAC_SYM_HOST_FALLBACK_ON_BUSY 1
+/**< @ingroup LacSymHost
+ * Eligible requests run on the host when the ring is busy */
+
+#define LAC_SYM_HOST_FALLBACK_ALWAYS 2
+/**< @ingroup LacSymHost
+ * Eligible requests always run on the host, used to test the host path */
+
+#define LAC_SYM_HOST_DEFAULT_MAX_SIZE 2048
+/**< @ingroup LacSymHost
+ * Default largest source buffer executed on the host */
+
+/**
+ *******************************************************************************
+ * @ingroup LacSymHost
+ *      Host execution state of an instance
+ *****************************************************************************/
+typedef struct lac_sym_host_s
+{
+    Cpa32U mode;
+    /**< One of the LAC_SYM_HOST_FALLBACK values */
+    Cpa32U threshold;
+    /**< Requests in flight above which the ring is busy, 0 to only use the
+     * host when the ring is full */
+    Cpa32U maxSize;
+    /**< Largest eligible source buffer in bytes */
+    OsalAtomic numOffloaded;
+    /**< Requests put on the ring by the traditional API */
+    OsalAtomic numHostExecuted;
+    /**< Requests executed on the host */
+    OsalAtomic numHostIneligible;
+    /**< Requests that found the ring busy but could not run on the host */
+} lac_sym_host_t;
+
+/**
+*******************************************************************************
+* @ingroup LacSymHost
+*      Sets up host execution for an instance
+*
+* @description
+*      Allocates the host execution state when the symHostFallback config
+*      value of the instance enables it, otherwise leaves pSymHost NULL.
+*
+* @param[in] instanceHandle    Instance handle
+*
+* @retval CPA_STATUS_SUCCESS   initialisation successful
+* @retval CPA_STATUS_RESOURCE  allocation failed
+*
+*****************************************************************************/
+CpaStatus LacSymHost_Init(CpaInstanceHandle instanceHandle);
+
+/**
+*******************************************************************************
+* @ingroup LacSymHost
+*      Frees the host execution state of an instance
+*
+* @param[in] instanceHandle    Instance handle
+*
+*****************************************************************************/
+void LacSymHost_Free(CpaInstanceHandle instanceHandle);
+
+/**
+*******************************************************************************
+* @ingroup LacSymHost
+*      Checks whether requests should be executed on the host
+*
+* @description
+*      Returns CPA_TRUE when host execution is forced or the number of
+*      requests in flight on the sym tx ring has reached the threshold.
+*      The caller checks that pSymHost is not NULL.
+*
+* @param[in] instanceHandle    Instance handle
+*
+*****************************************************************************/
+CpaBoolean LacSymHost_RingBusy(CpaInstanceHandle instanceHandle);
+
+/**
+*******************************************************************************
+* @ingroup LacSymHost
+*      Executes a request on the host
+*
+* @description
+*      Performs the operation described by the cookie on the host. The
+*      request is not completed: the caller passes pOkFlag and the returned
+*      status to the session callback once the request no longer owns the
+*      session queue. Nothing is changed when the request is not eligible.
+*
+* @param[in]  instanceHandle   Instance handle
+* @param[in]  pCookie          Request cookie, fully populated
+* @param[in]  pSessionDesc     Session of the request
+* @param[out] pOkFlag          CPA_FALSE when the digest did not verify
+*
+* @retval CPA_STATUS_SUCCESS      The request was executed
+* @retval CPA_STATUS_FAIL         The request was executed but failed
+* @retval CPA_STATUS_UNSUPPORTED  The request is not eligible
+*
+*****************************************************************************/
+CpaStatus LacSymHost_Perform(CpaInstanceHandle instanceHandle,
+                             lac_sym_bulk_cookie_t *pCookie,
+                             lac_session_desc_t *pSessionDesc,
+                             CpaBoolean *pOkFlag);
+
+/**
+*******************************************************************************
+* @ingroup LacSymHost
+*      Counts requests put on the ring
+*
+* @param[in] instanceHandle    Instance handle
+* @param[in] numRequests       Number of requests
+*
+*****************************************************************************/
+void LacSymHost_OffloadedAdd(CpaInstanceHandle instanceHandle,
+                             Cpa32U numRequests);
+
+/**
+*******************************************************************************
+* @ingroup LacSymHost
+*      Copies the host execution counters of an instance
+*
+* @param[in]  instanceHandle       Instance handle
+* @param[out] pStats               Counters
+*
+* @retval CPA_STATUS_SUCCESS       Success
+* @retval CPA_STATUS_UNSUPPORTED   Host execution is disabled
+*
+*****************************************************************************/
+CpaStatus LacSymHost_StatsGet(CpaInstanceHandle instanceHandle,
+                              icp_sal_sym_host_fallback_stats_t *pStats);
+
+/**
+*******************************************************************************
+* @ingroup LacSymHost
+*      Prints the host execution counters to standard output
+*
+* @param[in] instanceHandle    Instance handle
+*
+*****************************************************************************/
+void LacSymHost_StatsShow(CpaInstanceHandle instanceHandle);
+
+#endif /* LAC_SYM_HOST_H */
@@ -209,6 +209,32 @@ void LacSymQat_HashContentDescInit(
     lac_sym_qat_hash_precompute_info_t *pPrecompute,
     Cpa32U *pHashBlkSizeInBytes);
 
+/**
+ ******************************************************************************
+ * @ingroup LacSymQatHash
+ *      Get the inner hash states of an optimised content descriptor
+ *
+ * @description
+ *      This function returns where the precomputed inner hash states live
+ *      in an optimised content descriptor built by
+ *      LacSymQat_HashContentDescInit, so they can be recomputed for a new
+ *      authentication key.
+ *
+ * @param[in]  pMsg                 Pointer to the SHRAM req Parameter Footer
+ *                                  the optimised descriptor was built with
+ * @param[in]  pHwBlockBase         Pointer to the base of the optimised
+ *                                  hardware setup block
+ * @param[out] ppState1             Inner hash state 1
+ * @param[out] ppState2             Inner hash state 2
+ *
+ * @return None
+ *
+ *****************************************************************************/
+void LacSymQat_HashOptimisedStatePtrsGet(icp_qat_la_bulk_req_ftr_t *pMsg,
+                                         void *pHwBlockBase,
+                                         Cpa8U **ppState1,
+                                         Cpa8U **ppState2);
+
 /**
  ******************************************************************************
  * @ingroup LacSymQatHash
@@ -79,6 +79,14 @@
 #include "lac_session.h"
 #include "lac_sym.h"
 
+/**
+ * Added to the request queue count of a session while a hash precompute of
+ * its setup or update blocks it. The hold is a bit of its own above the
+ * count of queued requests, so it is told apart from them and released
+ * exactly once, while both still change together in one atomic.
+ */
+#define LAC_SYM_QUEUE_HOLD ((Cpa64U)1 << 32)
+
 /**
 *******************************************************************************
 * @ingroup LacSymQueue
@@ -107,4 +115,37 @@ CpaStatus LacSymQueue_RequestSend(const CpaInstanceHandle instanceHandle,
                                   lac_sym_bulk_cookie_t *pRequest,
                                   lac_session_desc_t *pSessionDesc);
 
+/**
+*******************************************************************************
+* @ingroup LacSymQueue
+*      Release ownership of the request queue and send queued requests
+*
+* @description
+*      This function is called by the owner of the request queue of a
+*      session when requests it accounted for in the queue count no longer
+*      block the session (a partial packet completed, a request was sent, or
+*      a hash precompute released LAC_SYM_QUEUE_HOLD). It drops numReleased
+*      from the queue count and, as long as requests remain queued, sends
+*      them to the QAT in order. If a partial packet request is sent,
+*      ownership passes to that request and the function returns; its
+*      completion calls this function again.
+*
+*      It never waits for another context. If a request is counted but its
+*      producer has not pushed it yet, the queue is marked as stalled and
+*      the function returns; the producer finishes the drain once it has
+*      pushed the request. It is therefore safe to call from a completion
+*      that interrupts a producer on the same CPU.
+*
+* @param[in]  pSessionDesc         Pointer to session descriptor
+* @param[in]  numReleased          Amount released from the queue count
+*
+* @retval CPA_STATUS_SUCCESS        Success
+* @retval CPA_STATUS_RETRY          Queued requests could not be sent as the
+*                                   ring stayed full; they remain queued
+* @retval CPA_STATUS_FAIL           Function failed.
+*
+*****************************************************************************/
+CpaStatus LacSymQueue_RequestsDrain(lac_session_desc_t *pSessionDesc,
+                                    Cpa64U numReleased);
+
 #endif /* LAC_SYM_QUEUE_H */
@@ -206,7 +206,25 @@ static inline void LacAlgChain_UnlockSessionWriter(
  */
 STATIC void LacSymAlgChain_HashPrecomputeDoneCb(void *callbackTag)
 {
-    LacSymCb_PendingReqsDequeue((lac_session_desc_t *)callbackTag);
+    (void)LacSymQueue_RequestsDrain((lac_session_desc_t *)callbackTag,
+                                    LAC_SYM_QUEUE_HOLD);
+}
+
+/**
+ * @ingroup LacAlgChain
+ * Callback of a hash precompute that is followed by another precompute on
+ * the same session. Precomputes complete in order, so only the last one
+ * releases the request queue, which each session precompute holds once.
+ *
+ * @param[in] callbackTag  Opaque value provided by user. This will
+ *                         be a pointer to the session descriptor.
+ *
+ * @retval
+ *     None
+ *
+ */
+STATIC void LacSymAlgChain_HashPrecomputeFirstDoneCb(void *callbackTag)
+{
 }
 
 /**
@@ -505,6 +523,19 @@ static CpaStatus LacAlgChain_SessionCipherKeyUpdate(
                     cipherSetupData.cipherKeyLenInBytes,
                     pCipherKeyField,
                     &sizeInBytes);
+
+                if (pSessionDesc->useOptimisedContentDesc)
+                {
+                    /* The key leads the optimised content descriptor */
+                    pCipherKeyField =
+                        (Cpa8U *)pSessionDesc->contentDescOptimisedInfo.pData;
+
+                    LacSymQat_CipherHwBlockPopulateKeySetup(
+                        &(cipherSetupData),
+                        cipherSetupData.cipherKeyLenInBytes,
+                        pCipherKeyField,
+                        &sizeInBytes);
+                }
             }
             break;
 
@@ -610,17 +641,40 @@ static CpaStatus LacAlgChain_SessionAuthKeyUpdate(
             memset(pInnerState2, 0, cd_ctrl->inner_state2_sz);
         }
 
-        /* Block messages until precompute is completed */
-        pSessionDesc->nonBlockingOpsInProgress = CPA_FALSE;
+        /* Block messages until precompute is completed; the precompute
+         * holds the request queue until its callback */
+        osalAtomicAdd(LAC_SYM_QUEUE_HOLD, &pSessionDesc->requestQueueCount);
 
         status = LacHash_PrecomputeDataCreate(
             pSessionDesc->pInstance,
             (CpaCySymSessionSetupData *)&(sessionSetup),
-            LacSymAlgChain_HashPrecomputeDoneCb,
+            pSessionDesc->useOptimisedContentDesc
+                ? LacSymAlgChain_HashPrecomputeFirstDoneCb
+                : LacSymAlgChain_HashPrecomputeDoneCb,
             pSessionDesc,
             pSessionDesc->hashStatePrefixBuffer,
             pInnerState1,
             pInnerState2);
+
+        /* The optimised content descriptor holds its own copy of the
+         * inner states */
+        if (pSessionDesc->useOptimisedContentDesc)
+        {
+            LacSymQat_HashOptimisedStatePtrsGet(
+                &(pSessionDesc->shramReqCacheFtr),
+                pSessionDesc->contentDescOptimisedInfo.pData,
+                &pInnerState1,
+                &pInnerState2);
+
+            status = LacHash_PrecomputeDataCreate(
+                pSessionDesc->pInstance,
+                (CpaCySymSessionSetupData *)&(sessionSetup),
+                LacSymAlgChain_HashPrecomputeDoneCb,
+                pSessionDesc,
+                pSessionDesc->hashStatePrefixBuffer,
+                pInnerState1,
+                pInnerState2);
+        }
     }
 
     return status;
@@ -1121,6 +1175,126 @@ CpaStatus LacAlgChain_SessionUpdate(
     return status;
 }
 
+/** @ingroup LacAlgChain */
+CpaStatus LacAlgChain_SessionClone(const CpaInstanceHandle instanceHandle,
+                                   lac_session_desc_t *pTemplateDesc,
+                                   lac_session_desc_t *pSessionDesc,
+                                   Cpa32U descSizeInBytes,
+                                   CpaPhysicalAddr physAddressAligned,
+                                   Cpa8U *pCipherKey,
+                                   Cpa8U *pAuthKey)
+{
+    CpaStatus stat, status = CPA_STATUS_SUCCESS;
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+    CpaCySymSessionUpdateData updateData = {0};
+
+    LAC_ENSURE_NOT_NULL(instanceHandle);
+    LAC_ENSURE_NOT_NULL(pTemplateDesc);
+    LAC_ENSURE_NOT_NULL(pSessionDesc);
+
+    /* Keep the template stable while it is copied; its content descriptor
+     * is only complete once any outstanding precompute has finished */
+    LacAlgChain_LockSessionReader(pTemplateDesc);
+    if ((Cpa64U)osalAtomicGet(&pTemplateDesc->requestQueueCount) <
+        LAC_SYM_QUEUE_HOLD)
+    {
+        memcpy(pSessionDesc, pTemplateDesc, descSizeInBytes);
+    }
+    else
+    {
+        status = CPA_STATUS_RETRY;
+    }
+    LacAlgChain_UnlockSessionReader(pTemplateDesc);
+    LAC_CHECK_STATUS(status);
+
+    /* Everything addressed by the QAT lives inside the descriptor, so move
+     * the content descriptor info over to the new memory */
+    pSessionDesc->contentDescInfo.pData = (Cpa8U *)pSessionDesc;
+    pSessionDesc->contentDescInfo.hardwareSetupBlockPhys = physAddressAligned;
+    pSessionDesc->contentDescOptimisedInfo.pData =
+        ((Cpa8U *)pSessionDesc + LAC_SYM_QAT_CONTENT_DESC_MAX_SIZE);
+    pSessionDesc->contentDescOptimisedInfo.hardwareSetupBlockPhys =
+        (physAddressAligned + LAC_SYM_QAT_CONTENT_DESC_MAX_SIZE);
+    SalQatMsg_ContentDescHdrWrite(
+        (icp_qat_fw_comn_req_t *)&(pSessionDesc->reqCacheHdr),
+        &(pSessionDesc->contentDescInfo));
+
+    if (pSessionDesc->useOptimisedContentDesc)
+    {
+        SalQatMsg_ContentDescHdrWrite(
+            (icp_qat_fw_comn_req_t *)&(pSessionDesc->shramReqCacheHdr),
+            &(pSessionDesc->contentDescOptimisedInfo));
+    }
+
+    if (pSessionDesc->isCipher &&
+        LAC_CIPHER_IS_ARC4(pSessionDesc->cipherAlgorithm))
+    {
+        pSessionDesc->cipherARC4InitialStatePhysAddr =
+            LAC_OS_VIRT_TO_PHYS_EXTERNAL(pService->generic_service_info,
+                                         pSessionDesc->cipherARC4InitialState);
+        if (0 == pSessionDesc->cipherARC4InitialStatePhysAddr)
+        {
+            LAC_LOG_ERROR("Unable to get the physical address of "
+                          "the initial state for ARC4\n");
+            return CPA_STATUS_FAIL;
+        }
+    }
+
+    if (NULL != pSessionDesc->hashStateBufferInfo.pData)
+    {
+        pSessionDesc->hashStateBufferInfo.pData =
+            pSessionDesc->hashStatePrefixBuffer;
+        pSessionDesc->hashStateBufferInfo.pDataPhys =
+            LAC_MEM_CAST_PTR_TO_UINT64(LAC_OS_VIRT_TO_PHYS_EXTERNAL(
+                pService->generic_service_info,
+                pSessionDesc->hashStatePrefixBuffer));
+        if (0 == pSessionDesc->hashStateBufferInfo.pDataPhys)
+        {
+            LAC_LOG_ERROR("Unable to get the physical address of "
+                          "the hash state buffer\n");
+            return CPA_STATUS_FAIL;
+        }
+    }
+
+    /* The copied locks and counters belong to the template */
+    stat = LAC_INIT_MUTEX(&pSessionDesc->accessLock);
+    if (CPA_STATUS_SUCCESS != stat)
+    {
+        LAC_LOG_ERROR("Mutex init failed for accessLock");
+        return CPA_STATUS_RESOURCE;
+    }
+
+    pSessionDesc->pRequestQueueHead = NULL;
+    pSessionDesc->pRequestQueueNew = NULL;
+    osalAtomicSet(0, &pSessionDesc->requestQueueCount);
+    pSessionDesc->internalSession = CPA_FALSE;
+    pSessionDesc->partialState = CPA_CY_SYM_PACKET_TYPE_FULL;
+    osalAtomicSet(0, &pSessionDesc->u.pendingCbCount);
+    pSessionDesc->u.pendingDpCbCount = 0;
+    pSessionDesc->accessReaders = 0;
+
+    if (NULL != pCipherKey)
+    {
+        updateData.flags |= CPA_CY_SYM_SESUPD_CIPHER_KEY;
+        updateData.pCipherKey = pCipherKey;
+    }
+    if (NULL != pAuthKey)
+    {
+        updateData.flags |= CPA_CY_SYM_SESUPD_AUTH_KEY;
+        updateData.authKey = pAuthKey;
+    }
+    if (0 != updateData.flags)
+    {
+        status = LacAlgChain_SessionUpdate(pSessionDesc, &updateData);
+    }
+
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        LAC_DESTROY_MUTEX(&pSessionDesc->accessLock);
+    }
+    return status;
+}
+
 /** @ingroup LacAlgChain */
 CpaStatus LacAlgChain_SessionInit(
     const CpaInstanceHandle instanceHandle,
@@ -1159,14 +1333,6 @@ CpaStatus LacAlgChain_SessionInit(
      * Populate session data
      *-----------------------------------------------------------------------*/
 
-    /* Initialise Request Queue */
-    stat = LAC_SPINLOCK_INIT(&pSessionDesc->requestQueueLock);
-    if (CPA_STATUS_SUCCESS != stat)
-    {
-        LAC_LOG_ERROR("Spinlock init failed for sessionLock");
-        return CPA_STATUS_RESOURCE;
-    }
-
     /* Initialise session readers writers */
     stat = LAC_INIT_MUTEX(&pSessionDesc->accessLock);
     if (CPA_STATUS_SUCCESS != stat)
@@ -1175,9 +1341,10 @@ CpaStatus LacAlgChain_SessionInit(
         return CPA_STATUS_RESOURCE;
     }
 
+    /* Initialise Request Queue */
     pSessionDesc->pRequestQueueHead = NULL;
-    pSessionDesc->pRequestQueueTail = NULL;
-    pSessionDesc->nonBlockingOpsInProgress = CPA_TRUE;
+    pSessionDesc->pRequestQueueNew = NULL;
+    osalAtomicSet(0, &pSessionDesc->requestQueueCount);
     pSessionDesc->pInstance = instanceHandle;
     pSessionDesc->digestIsAppended = pSessionSetupData->digestIsAppended;
     pSessionDesc->digestVerify = pSessionSetupData->verifyDigest;
@@ -1582,12 +1749,16 @@ CpaStatus LacAlgChain_SessionInit(
                     &(pSessionDesc->hashStatePrefixBuffer[0]));
 #endif
 
-                /* Block messages until precompute is completed */
-                pSessionDesc->nonBlockingOpsInProgress = CPA_FALSE;
+                /* Block messages until precompute is completed; the
+                 * precompute holds the request queue until its callback */
+                osalAtomicAdd(LAC_SYM_QUEUE_HOLD,
+                              &pSessionDesc->requestQueueCount);
                 status = LacHash_PrecomputeDataCreate(
                     instanceHandle,
                     (CpaCySymSessionSetupData *)pSessionSetupData,
-                    LacSymAlgChain_HashPrecomputeDoneCb,
+                    pSessionDesc->useOptimisedContentDesc
+                        ? LacSymAlgChain_HashPrecomputeFirstDoneCb
+                        : LacSymAlgChain_HashPrecomputeDoneCb,
                     pSessionDesc,
                     pSessionDesc->hashStatePrefixBuffer,
                     precomputeData.pState1,
@@ -1802,6 +1973,7 @@ CpaStatus LacAlgChain_Perform(const CpaInstanceHandle instanceHandle,
         pCookie->pCallbackTag = pCallbackTag;
         pCookie->sessionCtx = pOpData->sessionCtx;
         pCookie->pOpData = (const CpaCySymOpData *)pOpData;
+        pCookie->pSrcBuffer = pSrcBuffer;
         pCookie->pDstBuffer = pDstBuffer;
         pCookie->updateSessionIvOnSend = CPA_FALSE;
         pCookie->updateUserIvOnRecieve = CPA_FALSE;
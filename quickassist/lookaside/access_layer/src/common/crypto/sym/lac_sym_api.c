@@ -109,6 +109,7 @@
 #include "lac_sym_partial.h"
 #include "lac_sym_qat_hash_defs_lookup.h"
 #include "lac_sym_cb.h"
+#include "lac_sym_host.h"
 #include "lac_buffer_desc.h"
 #include "lac_sync.h"
 #include "lac_hooks.h"
@@ -486,6 +487,60 @@ LacSymPerform_BufferParamCheck(const CpaBufferList *const pSrcBuffer,
 }
 #endif
 
+/**
+ *****************************************************************************
+ * @ingroup LacSym
+ *      Find the 64 byte aligned session descriptor in the session memory
+ *
+ * @description
+ *      The session descriptor holds the content descriptor read by the QAT,
+ *      so it is placed at the first 64 byte aligned physical address after
+ *      the pointer at the start of the user memory. That pointer is set to
+ *      the descriptor.
+ *
+ * @param[in]  pService              Crypto service
+ * @param[in]  pSessionCtx           User allocated session memory
+ * @param[out] pPhysAddressAligned   Physical address of the descriptor
+ *
+ * @return Pointer to the session descriptor, NULL on failure
+ *
+ *****************************************************************************/
+STATIC lac_session_desc_t *LacSym_SessionDescAlign(
+    sal_service_t *pService,
+    CpaCySymSessionCtx pSessionCtx,
+    CpaPhysicalAddr *pPhysAddressAligned)
+{
+    lac_session_desc_t *pSessionDesc = NULL;
+    CpaPhysicalAddr physAddress = 0;
+    CpaPhysicalAddr physAddressAligned = 0;
+
+    /* Re-align the session structure to 64 byte alignment */
+    physAddress = LAC_OS_VIRT_TO_PHYS_EXTERNAL(
+        (*pService), (Cpa8U *)pSessionCtx + sizeof(void *));
+
+    if (0 == physAddress)
+    {
+        LAC_LOG_ERROR("Unable to get the physical address of the session\n");
+        return NULL;
+    }
+
+    physAddressAligned =
+        LAC_ALIGN_POW2_ROUNDUP(physAddress, LAC_64BYTE_ALIGNMENT);
+
+    pSessionDesc = (lac_session_desc_t *)
+        /* Move the session pointer by the physical offset
+        between aligned and unaligned memory */
+        ((Cpa8U *)pSessionCtx + sizeof(void *) +
+         (physAddressAligned - physAddress));
+
+    /* save the aligned pointer in the first bytes (size of unsigned long)
+     * of the session memory */
+    *((LAC_ARCH_UINT *)pSessionCtx) = (LAC_ARCH_UINT)pSessionDesc;
+
+    *pPhysAddressAligned = physAddressAligned;
+    return pSessionDesc;
+}
+
 /** @ingroup LacSym */
 CpaStatus cpaCySymInitSession(const CpaInstanceHandle instanceHandle_in,
                               const CpaCySymCbFunc pSymCb,
@@ -582,7 +637,6 @@ CpaStatus LacSym_InitSession(const CpaInstanceHandle instanceHandle,
     CpaStatus status = CPA_STATUS_SUCCESS;
     lac_session_desc_t *pSessionDesc = NULL;
     Cpa32U sessionCtxSizeInBytes = 0;
-    CpaPhysicalAddr physAddress = 0;
     CpaPhysicalAddr physAddressAligned = 0;
     sal_service_t *pService = NULL;
     const CpaCySymCipherSetupData *pCipherSetupData = NULL;
@@ -615,29 +669,13 @@ CpaStatus LacSym_InitSession(const CpaInstanceHandle instanceHandle,
 
     pService = (sal_service_t *)instanceHandle;
 
-    /* Re-align the session structure to 64 byte alignment */
-    physAddress = LAC_OS_VIRT_TO_PHYS_EXTERNAL(
-        (*pService), (Cpa8U *)pSessionCtx + sizeof(void *));
-
-    if (0 == physAddress)
+    pSessionDesc =
+        LacSym_SessionDescAlign(pService, pSessionCtx, &physAddressAligned);
+    if (NULL == pSessionDesc)
     {
-        LAC_LOG_ERROR("Unable to get the physical address of the session\n");
         return CPA_STATUS_FAIL;
     }
 
-    physAddressAligned =
-        LAC_ALIGN_POW2_ROUNDUP(physAddress, LAC_64BYTE_ALIGNMENT);
-
-    pSessionDesc = (lac_session_desc_t *)
-        /* Move the session pointer by the physical offset
-        between aligned and unaligned memory */
-        ((Cpa8U *)pSessionCtx + sizeof(void *) +
-         (physAddressAligned - physAddress));
-
-    /* save the aligned pointer in the first bytes (size of unsigned long)
-     * of the session memory */
-    *((LAC_ARCH_UINT *)pSessionCtx) = (LAC_ARCH_UINT)pSessionDesc;
-
     /* start off with a clean session */
     /* Choose Session Context size */
     getCtxSize(pSessionSetupData, &sessionCtxSizeInBytes);
@@ -653,6 +691,7 @@ CpaStatus LacSym_InitSession(const CpaInstanceHandle instanceHandle,
             memset(pSessionDesc, 0, sizeof(lac_session_desc_t));
             break;
     }
+    pSessionDesc->sessionCtxSizeInBytes = sessionCtxSizeInBytes;
 
     /* Setup content descriptor info structure
      * assumption that content descriptor is the first field in
@@ -800,7 +839,6 @@ CpaStatus cpaCySymRemoveSession(const CpaInstanceHandle instanceHandle_in,
     }
     if (CPA_STATUS_SUCCESS == status)
     {
-        LAC_SPINLOCK_DESTROY(&pSessionDesc->requestQueueLock);
         LAC_DESTROY_MUTEX(&pSessionDesc->accessLock);
         if (CPA_FALSE == pSessionDesc->isDPSession)
         {
@@ -838,6 +876,208 @@ CpaStatus cpaCySymUpdateSession(
     return status;
 }
 
+/** @ingroup LacSym */
+CpaStatus icp_sal_CySymCloneSession(
+    const CpaInstanceHandle instanceHandle_in,
+    const CpaCySymSessionCtx pTemplateSessionCtx,
+    Cpa32U sessionCtxSizeInBytes,
+    Cpa8U *pCipherKey,
+    Cpa8U *pAuthKey,
+    CpaCySymSessionCtx pSessionCtx)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    lac_session_desc_t *pTemplateDesc = NULL;
+    lac_session_desc_t *pSessionDesc = NULL;
+    CpaPhysicalAddr physAddressAligned = 0;
+    Cpa32U descSizeInBytes = 0;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_SYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_ADDR_TRANS_SETUP(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_SYM));
+    LAC_CHECK_NULL_PARAM(pTemplateSessionCtx);
+    LAC_CHECK_NULL_PARAM(pSessionCtx);
+#endif /*ICP_PARAM_CHECK*/
+
+    /* check crypto service is running otherwise return an error */
+    SAL_RUNNING_CHECK(instanceHandle);
+
+    /* Only the part of the descriptor backed by the context memory is
+     * copied, as the smaller context sizes hold a truncated descriptor */
+    switch (sessionCtxSizeInBytes)
+    {
+        case LAC_SYM_SESSION_D1_SIZE:
+            descSizeInBytes = sizeof(lac_session_desc_d1_t);
+            break;
+        case LAC_SYM_SESSION_D2_SIZE:
+            descSizeInBytes = sizeof(lac_session_desc_d2_t);
+            break;
+        case LAC_SYM_SESSION_SIZE:
+            descSizeInBytes = sizeof(lac_session_desc_t);
+            break;
+        default:
+            LAC_INVALID_PARAM_LOG("sessionCtxSizeInBytes");
+            return CPA_STATUS_INVALID_PARAM;
+    }
+
+    pTemplateDesc = LAC_SYM_SESSION_DESC_FROM_CTX_GET(pTemplateSessionCtx);
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_NULL_PARAM(pTemplateDesc);
+    if (pTemplateDesc->pInstance != instanceHandle)
+    {
+        LAC_INVALID_PARAM_LOG("Template session is on another instance");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif /*ICP_PARAM_CHECK*/
+
+    /* The template descriptor is only valid up to the context size it was
+     * set up for, so the clone must use the same size */
+    if (pTemplateDesc->sessionCtxSizeInBytes != sessionCtxSizeInBytes)
+    {
+        LAC_INVALID_PARAM_LOG("sessionCtxSizeInBytes");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    pSessionDesc = LacSym_SessionDescAlign(
+        (sal_service_t *)instanceHandle, pSessionCtx, &physAddressAligned);
+    if (NULL == pSessionDesc)
+    {
+        status = CPA_STATUS_FAIL;
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = LacAlgChain_SessionClone(instanceHandle,
+                                          pTemplateDesc,
+                                          pSessionDesc,
+                                          descSizeInBytes,
+                                          physAddressAligned,
+                                          pCipherKey,
+                                          pAuthKey);
+    }
+
+    if (CPA_FALSE == pTemplateDesc->isDPSession)
+    {
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            LAC_SYM_STAT_INC(numSessionsInitialized, instanceHandle);
+        }
+        else if (CPA_STATUS_RETRY != status)
+        {
+            LAC_SYM_STAT_INC(numSessionErrors, instanceHandle);
+        }
+    }
+    return status;
+}
+
+/** @ingroup LacSym */
+CpaStatus icp_sal_CySymInitSessions(
+    const CpaInstanceHandle instanceHandle_in,
+    const CpaCySymCbFunc pSymCb,
+    const CpaCySymSessionSetupData *pSessionSetupData,
+    Cpa32U numSessions,
+    Cpa8U **ppCipherKeys,
+    Cpa8U **ppAuthKeys,
+    CpaCySymSessionCtx *pSessionCtxs)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceHandle instanceHandle = NULL;
+    CpaCySymSessionSetupData setupData;
+    Cpa32U sessionCtxSizeInBytes = 0;
+    Cpa8U *pCipherKey = NULL;
+    Cpa8U *pAuthKey = NULL;
+    Cpa32U i = 0;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_SYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    LAC_CHECK_NULL_PARAM(pSessionSetupData);
+    LAC_CHECK_NULL_PARAM(pSessionCtxs);
+    if (0 == numSessions)
+    {
+        LAC_INVALID_PARAM_LOG("numSessions");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif /*ICP_PARAM_CHECK*/
+
+    /* The contexts are allocated with cpaCySymSessionCtxGetSize, which
+     * covers the smaller descriptor the first session is set up with */
+    getCtxSize(pSessionSetupData, &sessionCtxSizeInBytes);
+    setupData = *pSessionSetupData;
+
+    for (i = 0; i < numSessions; i++)
+    {
+        pCipherKey = (NULL != ppCipherKeys) ? ppCipherKeys[i] : NULL;
+        pAuthKey = (NULL != ppAuthKeys) ? ppAuthKeys[i] : NULL;
+
+        if (0 != i)
+        {
+            status = icp_sal_CySymCloneSession(instanceHandle,
+                                               pSessionCtxs[0],
+                                               sessionCtxSizeInBytes,
+                                               pCipherKey,
+                                               pAuthKey,
+                                               pSessionCtxs[i]);
+            /* A template whose precompute is still in flight cannot be
+             * copied yet, set the session up in full instead */
+            if (CPA_STATUS_RETRY != status)
+            {
+                if (CPA_STATUS_SUCCESS != status)
+                {
+                    break;
+                }
+                continue;
+            }
+        }
+
+        setupData.cipherSetupData.pCipherKey =
+            (NULL != pCipherKey) ? pCipherKey
+                                 : pSessionSetupData->cipherSetupData.pCipherKey;
+        setupData.hashSetupData.authModeSetupData.authKey =
+            (NULL != pAuthKey)
+                ? pAuthKey
+                : pSessionSetupData->hashSetupData.authModeSetupData.authKey;
+        status = cpaCySymInitSession(
+            instanceHandle, pSymCb, &setupData, pSessionCtxs[i]);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            break;
+        }
+    }
+
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        /* Leave nothing behind on failure */
+        while (i > 0)
+        {
+            i--;
+            cpaCySymRemoveSession(instanceHandle, pSessionCtxs[i]);
+        }
+    }
+    return status;
+}
+
 /** @ingroup LacSym */
 STATIC CpaStatus LacSym_Perform(const CpaInstanceHandle instanceHandle,
                                 void *callbackTag,
@@ -849,6 +1089,7 @@ STATIC CpaStatus LacSym_Perform(const CpaInstanceHandle instanceHandle,
 {
     lac_session_desc_t *pSessionDesc = NULL;
     CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaCySymPacketType packetType = CPA_CY_SYM_PACKET_TYPE_FULL;
 
 #ifdef ICP_PARAM_CHECK
     LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
@@ -947,6 +1188,9 @@ STATIC CpaStatus LacSym_Perform(const CpaInstanceHandle instanceHandle,
     }
 
 #endif /*ICP_PARAM_CHECK*/
+    /* Read before the perform: a request executed on the host completes
+     * inline and the callback may already have released pOpData */
+    packetType = pOpData->packetType;
     status = LacAlgChain_Perform(instanceHandle,
                                  pSessionDesc,
                                  callbackTag,
@@ -958,9 +1202,9 @@ STATIC CpaStatus LacSym_Perform(const CpaInstanceHandle instanceHandle,
     if (CPA_STATUS_SUCCESS == status)
     {
         /* check for partial packet suport for the session operation */
-        if (CPA_CY_SYM_PACKET_TYPE_FULL != pOpData->packetType)
+        if (CPA_CY_SYM_PACKET_TYPE_FULL != packetType)
         {
-            LacSym_PartialPacketStateUpdate(pOpData->packetType,
+            LacSym_PartialPacketStateUpdate(packetType,
                                             &pSessionDesc->partialState);
         }
         /* increment #requests stat */
@@ -1100,6 +1344,56 @@ CpaStatus cpaCySymQueryStats64(const CpaInstanceHandle instanceHandle_in,
     return CPA_STATUS_SUCCESS;
 }
 
+/** @ingroup LacSym */
+CpaStatus icp_sal_CyGetHashPrecompCacheStats(
+    CpaInstanceHandle instanceHandle_in,
+    icp_sal_hash_precomp_cache_stats_t *pStats)
+{
+    CpaInstanceHandle instanceHandle = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_SYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_SYM));
+    LAC_CHECK_NULL_PARAM(pStats);
+
+    return LacSymHash_PrecompCacheStatsGet(instanceHandle, pStats);
+}
+
+/** @ingroup LacSym */
+CpaStatus icp_sal_CyGetSymHostFallbackStats(
+    CpaInstanceHandle instanceHandle_in,
+    icp_sal_sym_host_fallback_stats_t *pStats)
+{
+    CpaInstanceHandle instanceHandle = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        instanceHandle = Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO_SYM);
+    }
+    else
+    {
+        instanceHandle = instanceHandle_in;
+    }
+
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(
+        instanceHandle,
+        (SAL_SERVICE_TYPE_CRYPTO | SAL_SERVICE_TYPE_CRYPTO_SYM));
+    LAC_CHECK_NULL_PARAM(pStats);
+
+    return LacSymHost_StatsGet(instanceHandle, pStats);
+}
+
 /** @ingroup LacSym */
 CpaStatus cpaCySymSessionCtxGetSize(
     const CpaInstanceHandle instanceHandle_in,
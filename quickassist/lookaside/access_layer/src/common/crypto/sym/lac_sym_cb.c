@@ -96,12 +96,11 @@
 #include "lac_sym_stats.h"
 #include "lac_log.h"
 #include "lac_sym_cb.h"
+#include "lac_sym_queue.h"
 #include "lac_sym_hash.h"
 #include "lac_sym_qat_cipher.h"
 #include "lac_sym_qat.h"
 
-#define DEQUEUE_MSGPUT_MAX_RETRIES 10000
-
 /*
 *******************************************************************************
 * Define static function definitions
@@ -469,113 +468,27 @@ STATIC void LacSymCb_ProcessCallback(icp_qat_fw_la_cmd_id_t lacCmdId,
  * @ingroup LacSymCb
  *
  * @return CpaStatus
- *      value returned will be the result of icp_adf_transPutMsg
+ *      value returned will be the result of icp_adf_transPutMsgs
  */
 CpaStatus LacSymCb_PendingReqsDequeue(lac_session_desc_t *pSessionDesc)
 {
-    CpaStatus status = CPA_STATUS_SUCCESS;
-    sal_crypto_service_t *pService = NULL;
-    Cpa32U retries = 0;
-
     LAC_ENSURE(pSessionDesc != NULL,
                "LacSymCb_PendingReqsDequeue - pSessionDesc NULL\n");
 
-    pService = (sal_crypto_service_t *)pSessionDesc->pInstance;
-
-    /* Need to protect access to queue head and tail pointers, which may
-     * be accessed by multiple contexts simultaneously for enqueue and
-     * dequeue operations
-     */
-    LAC_SPINLOCK(&pSessionDesc->requestQueueLock);
-
-    /* Clear the blocking flag in the session descriptor */
-    pSessionDesc->nonBlockingOpsInProgress = CPA_TRUE;
-
-    while ((NULL != pSessionDesc->pRequestQueueHead) &&
-           (CPA_TRUE == pSessionDesc->nonBlockingOpsInProgress))
-    {
-
-        /* If we send a partial packet request, set the blockingOpsInProgress
-         * flag for the session to indicate that subsequent requests must be
-         * queued up until this request completes
-         */
-        if (CPA_CY_SYM_PACKET_TYPE_FULL !=
-            pSessionDesc->pRequestQueueHead->pOpData->packetType)
-        {
-            pSessionDesc->nonBlockingOpsInProgress = CPA_FALSE;
-        }
-
-        /* At this point, we're clear to send the request.  For cipher requests,
-         * we need to check if the session IV needs to be updated.  This can
-         * only be done when no other partials are in flight for this session,
-         * to ensure the cipherPartialOpState buffer in the session descriptor
-         * is not currently in use
-         */
-        if (CPA_TRUE == pSessionDesc->pRequestQueueHead->updateSessionIvOnSend)
-        {
-            if (LAC_CIPHER_IS_ARC4(pSessionDesc->cipherAlgorithm))
-            {
-                memcpy(pSessionDesc->cipherPartialOpState,
-                       pSessionDesc->cipherARC4InitialState,
-                       LAC_CIPHER_ARC4_STATE_LEN_BYTES);
-            }
-            else
-            {
-                memcpy(pSessionDesc->cipherPartialOpState,
-                       pSessionDesc->pRequestQueueHead->pOpData->pIv,
-                       pSessionDesc->pRequestQueueHead->pOpData->ivLenInBytes);
-            }
-        }
-
-        /*
-         * Now we'll attempt to send the message directly to QAT. We'll keep
-         * looing until it succeeds (or at least a very high number of retries),
-         * as the failure only happens when the ring is full, and this is only
-         * a temporary situation. After a few retries, space will become
-         * availble, allowing the putMsg to succeed.
-         */
-        retries = 0;
-        do
-        {
-            /* Send directly to QAT */
-            status = icp_adf_transPutMsg(
-                pService->trans_handle_sym_tx,
-                (void *)&(pSessionDesc->pRequestQueueHead->qatMsg),
-                LAC_QAT_SYM_REQ_SZ_LW);
-
-            retries++;
-            /*
-             * Yield to allow other threads that may be on this session to poll
-             * and make some space on the ring
-             */
-            if (CPA_STATUS_SUCCESS != status)
-            {
-                osalYield();
-            }
-        } while ((CPA_STATUS_SUCCESS != status) &&
-                 (retries < DEQUEUE_MSGPUT_MAX_RETRIES));
-
-        if ((CPA_STATUS_SUCCESS != status) ||
-            (retries >= DEQUEUE_MSGPUT_MAX_RETRIES))
-        {
-            LAC_LOG_ERROR(
-                "Failed to icp_adf_transPutMsg, maximum retries exceeded.");
-            goto cleanup;
-        }
-
-        pSessionDesc->pRequestQueueHead =
-            pSessionDesc->pRequestQueueHead->pNext;
-    }
-
-    /* If we've drained the queue, ensure the tail pointer is set to NULL */
-    if (NULL == pSessionDesc->pRequestQueueHead)
-    {
-        pSessionDesc->pRequestQueueTail = NULL;
-    }
+    /* The completed blocking operation owned the request queue; release it
+     * and send the requests queued behind it */
+    return LacSymQueue_RequestsDrain(pSessionDesc, 1);
+}
 
-cleanup:
-    LAC_SPINUNLOCK(&pSessionDesc->requestQueueLock);
-    return status;
+/**
+ * @ingroup LacSymCb
+ */
+void LacSymCb_ProcessHostResponse(lac_sym_bulk_cookie_t *pCookie,
+                                  CpaBoolean okFlag,
+                                  CpaStatus status,
+                                  lac_session_desc_t *pSessionDesc)
+{
+    LacSymCb_ProcessCallbackInternal(pCookie, okFlag, status, pSessionDesc);
 }
 
 /**
@@ -79,6 +79,7 @@
 #include "icp_accel_devices.h"
 #include "icp_adf_debug.h"
 #include "lac_sym.h"
+#include "lac_session.h"
 #include "cpa_cy_sym_dp.h"
 
 #define COMPILE_TIME_ASSERT(pred)                                              \
@@ -88,6 +89,9 @@
         case pred:;                                                            \
     }
 
+#define LAC_SESSION_LINE(field)                                                \
+    (offsetof(lac_session_desc_t, field) / LAC_64BYTE_ALIGNMENT)
+
 void LacSym_CompileTimeAssertions(void)
 {
     /* *************************************************************
@@ -99,4 +103,49 @@ void LacSym_CompileTimeAssertions(void)
 
     COMPILE_TIME_ASSERT(offsetof(lac_sym_bulk_cookie_t, sessionCtx) ==
                         offsetof(CpaCySymDpOpData, sessionCtx));
+
+    /* *************************************************************
+     * Check the cache line layout of the session descriptor.
+     * Each field group starts a new cache line so that fields
+     * written on the submit path, fields written on the completion
+     * path and fields only read per request never share a line.
+     * The read-mostly groups must fit in three lines.
+     * ************************************************************* */
+
+    COMPILE_TIME_ASSERT(
+        0 == offsetof(lac_session_desc_t, reqCacheHdr) % LAC_64BYTE_ALIGNMENT);
+    COMPILE_TIME_ASSERT(0 == offsetof(lac_session_desc_t, shramReqCacheHdr) %
+                                 LAC_64BYTE_ALIGNMENT);
+    COMPILE_TIME_ASSERT(0 == offsetof(lac_session_desc_t, hashStateBufferInfo) %
+                                 LAC_64BYTE_ALIGNMENT);
+    COMPILE_TIME_ASSERT(
+        0 == offsetof(lac_session_desc_t, accessLock) % LAC_64BYTE_ALIGNMENT);
+    COMPILE_TIME_ASSERT(0 ==
+                        offsetof(lac_session_desc_t, u) % LAC_64BYTE_ALIGNMENT);
+    COMPILE_TIME_ASSERT(0 == offsetof(lac_session_desc_t,
+                                      hashStatePrefixBuffer) %
+                                 LAC_64BYTE_ALIGNMENT);
+
+    COMPILE_TIME_ASSERT(offsetof(lac_session_desc_t, accessLock) -
+                            offsetof(lac_session_desc_t, reqCacheHdr) ==
+                        3 * LAC_64BYTE_ALIGNMENT);
+    COMPILE_TIME_ASSERT(LAC_SESSION_LINE(accessReaders) ==
+                        LAC_SESSION_LINE(accessLock));
+    COMPILE_TIME_ASSERT(LAC_SESSION_LINE(partialState) ==
+                        LAC_SESSION_LINE(accessLock));
+
+    /* *************************************************************
+     * Check the d1 and d2 session descriptors are exact prefixes of
+     * the full descriptor, as only the full descriptor offsets are
+     * used to access a session.
+     * ************************************************************* */
+
+    COMPILE_TIME_ASSERT(sizeof(lac_session_desc_d1_t) ==
+                        offsetof(lac_session_desc_t, hashStatePrefixBuffer));
+    COMPILE_TIME_ASSERT(offsetof(lac_session_desc_d1_t, u) ==
+                        offsetof(lac_session_desc_t, u));
+    COMPILE_TIME_ASSERT(sizeof(lac_session_desc_d2_t) ==
+                        offsetof(lac_session_desc_t, hashStatePrefixBufferExt));
+    COMPILE_TIME_ASSERT(offsetof(lac_session_desc_d2_t, u) ==
+                        offsetof(lac_session_desc_t, u));
 }
@@ -299,6 +299,14 @@ void LacSymHash_HmacPrecompShutdown(CpaInstanceHandle instanceHandle)
     }
 }
 
+CpaStatus LacSymHash_PrecompCacheStatsGet(
+    CpaInstanceHandle instanceHandle,
+    icp_sal_hash_precomp_cache_stats_t *pStats)
+{
+    /* Precomputes run on the device, their results are not cached */
+    return CPA_STATUS_UNSUPPORTED;
+}
+
 /**
 *******************************************************************************
 * @ingroup LacHashDefs
@@ -102,6 +102,220 @@
 #include "lac_session.h"
 #include "lac_sym_hash_precomputes.h"
 
+/* Number of entries sharing a set of the precompute cache */
+#define LAC_HASH_PRECOMP_CACHE_WAYS 4
+/* Largest cache accepted from the configuration file */
+#define LAC_HASH_PRECOMP_CACHE_MAX_ENTRIES (1 << 16)
+/* Largest key and state held by a cache entry. HMAC keys are at most one
+ * block, AES precomputes produce at most 3 AES blocks */
+#define LAC_HASH_PRECOMP_CACHE_KEY_SZ LAC_HASH_SHA512_BLOCK_SIZE
+#define LAC_HASH_PRECOMP_CACHE_STATE_SZ LAC_HASH_SHA512_STATE_SIZE
+
+/*
+ * An entry holds the key next to the precompute results so a lookup is a
+ * compare rather than a digest computation, which would cost as much as the
+ * precompute it saves. The HMAC states are key equivalent anyway, so the
+ * entries are wiped whenever they are evicted or the cache is freed.
+ */
+typedef struct lac_sym_hash_precomp_entry_s
+{
+    Cpa64U lastUse;
+    /**< value of the cache use counter at the last hit, for LRU */
+    CpaCySymHashAlgorithm hashAlgorithm;
+    /**< algorithm of the entry, 0 for an empty entry */
+    Cpa32U keyLenInBytes;
+    Cpa32U stateLenInBytes;
+    Cpa8U key[LAC_HASH_PRECOMP_CACHE_KEY_SZ];
+    Cpa8U state1[LAC_HASH_PRECOMP_CACHE_STATE_SZ];
+    Cpa8U state2[LAC_HASH_PRECOMP_CACHE_STATE_SZ];
+} lac_sym_hash_precomp_entry_t;
+
+typedef struct lac_sym_hash_precomp_cache_s
+{
+    lac_lock_t lock;
+    /**< protects the entries and the counters */
+    Cpa32U numSets;
+    /**< number of sets, a power of 2 */
+    Cpa64U useCounter;
+    Cpa64U numHits;
+    Cpa64U numMisses;
+    Cpa64U numEvictions;
+    lac_sym_hash_precomp_entry_t *pEntries;
+    /**< numSets * LAC_HASH_PRECOMP_CACHE_WAYS entries */
+} lac_sym_hash_precomp_cache_t;
+
+/* Clears key material in a way the compiler can not drop as a dead store */
+STATIC void LacSymHash_PrecompWipe(void *pBuffer, Cpa32U sizeInBytes)
+{
+    volatile Cpa8U *p = (volatile Cpa8U *)pBuffer;
+
+    while (sizeInBytes--)
+    {
+        *p++ = 0;
+    }
+}
+
+/* Returns the first entry of the set a key maps to (FNV-1a) */
+STATIC lac_sym_hash_precomp_entry_t *LacSymHash_PrecompCacheSet(
+    lac_sym_hash_precomp_cache_t *pCache,
+    CpaCySymHashAlgorithm hashAlgorithm,
+    const Cpa8U *pKey,
+    Cpa32U keyLenInBytes)
+{
+    Cpa32U hash = 2166136261U ^ (Cpa32U)hashAlgorithm;
+    Cpa32U i = 0;
+
+    for (i = 0; i < keyLenInBytes; i++)
+    {
+        hash = (hash ^ pKey[i]) * 16777619U;
+    }
+    return &pCache->pEntries[(hash & (pCache->numSets - 1)) *
+                             LAC_HASH_PRECOMP_CACHE_WAYS];
+}
+
+STATIC CpaBoolean
+LacSymHash_PrecompEntryMatch(const lac_sym_hash_precomp_entry_t *pEntry,
+                             CpaCySymHashAlgorithm hashAlgorithm,
+                             const Cpa8U *pKey,
+                             Cpa32U keyLenInBytes)
+{
+    Cpa8U diff = 0;
+    Cpa32U i = 0;
+
+    if (pEntry->hashAlgorithm != hashAlgorithm ||
+        pEntry->keyLenInBytes != keyLenInBytes)
+    {
+        return CPA_FALSE;
+    }
+    /* Constant time compare, the key is secret */
+    for (i = 0; i < keyLenInBytes; i++)
+    {
+        diff |= pEntry->key[i] ^ pKey[i];
+    }
+    return (0 == diff) ? CPA_TRUE : CPA_FALSE;
+}
+
+/* Copies the cached states for a key, returns CPA_FALSE on a miss or if
+ * the cache is disabled. pState2 may be NULL for single state results */
+STATIC CpaBoolean
+LacSymHash_PrecompCacheLookup(sal_crypto_service_t *pService,
+                              CpaCySymHashAlgorithm hashAlgorithm,
+                              const Cpa8U *pKey,
+                              Cpa32U keyLenInBytes,
+                              Cpa8U *pState1,
+                              Cpa8U *pState2,
+                              Cpa32U stateLenInBytes)
+{
+    lac_sym_hash_precomp_cache_t *pCache = pService->pHashPrecompCache;
+    lac_sym_hash_precomp_entry_t *pEntry = NULL;
+    CpaBoolean hit = CPA_FALSE;
+    Cpa32U i = 0;
+
+    if (NULL == pCache || keyLenInBytes > LAC_HASH_PRECOMP_CACHE_KEY_SZ ||
+        stateLenInBytes > LAC_HASH_PRECOMP_CACHE_STATE_SZ)
+    {
+        return CPA_FALSE;
+    }
+
+    pEntry =
+        LacSymHash_PrecompCacheSet(pCache, hashAlgorithm, pKey, keyLenInBytes);
+
+    LAC_SPINLOCK(&pCache->lock);
+    for (i = 0; i < LAC_HASH_PRECOMP_CACHE_WAYS; i++, pEntry++)
+    {
+        if (CPA_TRUE == LacSymHash_PrecompEntryMatch(
+                            pEntry, hashAlgorithm, pKey, keyLenInBytes) &&
+            pEntry->stateLenInBytes == stateLenInBytes)
+        {
+            memcpy(pState1, pEntry->state1, stateLenInBytes);
+            if (NULL != pState2)
+            {
+                memcpy(pState2, pEntry->state2, stateLenInBytes);
+            }
+            pEntry->lastUse = ++pCache->useCounter;
+            hit = CPA_TRUE;
+            break;
+        }
+    }
+    if (CPA_TRUE == hit)
+    {
+        pCache->numHits++;
+    }
+    else
+    {
+        pCache->numMisses++;
+    }
+    LAC_SPINUNLOCK(&pCache->lock);
+
+    return hit;
+}
+
+/* Adds the states computed for a key, replacing the least recently used
+ * entry of its set */
+STATIC void LacSymHash_PrecompCacheInsert(sal_crypto_service_t *pService,
+                                          CpaCySymHashAlgorithm hashAlgorithm,
+                                          const Cpa8U *pKey,
+                                          Cpa32U keyLenInBytes,
+                                          const Cpa8U *pState1,
+                                          const Cpa8U *pState2,
+                                          Cpa32U stateLenInBytes)
+{
+    lac_sym_hash_precomp_cache_t *pCache = pService->pHashPrecompCache;
+    lac_sym_hash_precomp_entry_t *pSet = NULL;
+    lac_sym_hash_precomp_entry_t *pVictim = NULL;
+    Cpa32U i = 0;
+
+    if (NULL == pCache || keyLenInBytes > LAC_HASH_PRECOMP_CACHE_KEY_SZ ||
+        stateLenInBytes > LAC_HASH_PRECOMP_CACHE_STATE_SZ)
+    {
+        return;
+    }
+
+    pSet =
+        LacSymHash_PrecompCacheSet(pCache, hashAlgorithm, pKey, keyLenInBytes);
+
+    LAC_SPINLOCK(&pCache->lock);
+    pVictim = pSet;
+    for (i = 0; i < LAC_HASH_PRECOMP_CACHE_WAYS; i++)
+    {
+        /* Another thread may have added the same key meanwhile */
+        if (CPA_TRUE == LacSymHash_PrecompEntryMatch(
+                            &pSet[i], hashAlgorithm, pKey, keyLenInBytes))
+        {
+            pVictim = &pSet[i];
+            break;
+        }
+        if (0 == pSet[i].hashAlgorithm)
+        {
+            pVictim = &pSet[i];
+        }
+        else if (0 != pVictim->hashAlgorithm &&
+                 pSet[i].lastUse < pVictim->lastUse)
+        {
+            pVictim = &pSet[i];
+        }
+    }
+    if (0 != pVictim->hashAlgorithm &&
+        CPA_TRUE != LacSymHash_PrecompEntryMatch(
+                        pVictim, hashAlgorithm, pKey, keyLenInBytes))
+    {
+        pCache->numEvictions++;
+    }
+    LacSymHash_PrecompWipe(pVictim, sizeof(*pVictim));
+
+    pVictim->hashAlgorithm = hashAlgorithm;
+    pVictim->keyLenInBytes = keyLenInBytes;
+    pVictim->stateLenInBytes = stateLenInBytes;
+    memcpy(pVictim->key, pKey, keyLenInBytes);
+    memcpy(pVictim->state1, pState1, stateLenInBytes);
+    if (NULL != pState2)
+    {
+        memcpy(pVictim->state2, pState2, stateLenInBytes);
+    }
+    pVictim->lastUse = ++pCache->useCounter;
+    LAC_SPINUNLOCK(&pCache->lock);
+}
+
 STATIC
 CpaStatus LacSymHash_Compute(CpaCySymHashAlgorithm hashAlgorithm,
                              lac_sym_qat_hash_alg_info_t *pHashAlgInfo,
@@ -226,6 +440,20 @@ CpaStatus LacSymHash_HmacPreComputes(CpaInstanceHandle instanceHandle,
     Cpa32U padLenBytes = 0;
 
     LacSymQat_HashAlgLookupGet(instanceHandle, hashAlgorithm, &pHashAlgInfo);
+
+    if (CPA_TRUE ==
+        LacSymHash_PrecompCacheLookup((sal_crypto_service_t *)instanceHandle,
+                                      hashAlgorithm,
+                                      pAuthKey,
+                                      authKeyLenInBytes,
+                                      pState1,
+                                      pState2,
+                                      pHashAlgInfo->stateSize))
+    {
+        callbackFn(pCallbackTag);
+        return CPA_STATUS_SUCCESS;
+    }
+
     pHmacIpadOpData->stateSize = pHashAlgInfo->stateSize;
     pHmacOpadOpData->stateSize = pHashAlgInfo->stateSize;
 
@@ -268,6 +496,13 @@ CpaStatus LacSymHash_HmacPreComputes(CpaInstanceHandle instanceHandle,
 
     if (CPA_STATUS_SUCCESS == status)
     {
+        LacSymHash_PrecompCacheInsert((sal_crypto_service_t *)instanceHandle,
+                                      hashAlgorithm,
+                                      pAuthKey,
+                                      authKeyLenInBytes,
+                                      pState1,
+                                      pState2,
+                                      pHashAlgInfo->stateSize);
         callbackFn(pCallbackTag);
     }
     return status;
@@ -284,8 +519,36 @@ CpaStatus LacSymHash_AesECBPreCompute(CpaInstanceHandle instanceHandle,
 {
     CpaStatus status = CPA_STATUS_FAIL;
     Cpa32U stateSize = 0, x = 0;
+    Cpa32U resultSize = 0;
     lac_sym_qat_hash_alg_info_t *pHashAlgInfo = NULL;
 
+    /* Size of the derived keys written to pState */
+    if (CPA_CY_SYM_HASH_AES_XCBC == hashAlgorithm)
+    {
+        resultSize =
+            LAC_HASH_XCBC_PRECOMP_KEY_NUM * LAC_HASH_XCBC_MAC_BLOCK_SIZE;
+    }
+    else if (CPA_CY_SYM_HASH_AES_CMAC == hashAlgorithm)
+    {
+        resultSize = LAC_HASH_XCBC_PRECOMP_KEY_NUM * LAC_HASH_CMAC_BLOCK_SIZE;
+    }
+    else
+    {
+        resultSize = ICP_QAT_HW_GALOIS_H_SZ;
+    }
+    if (CPA_TRUE ==
+        LacSymHash_PrecompCacheLookup((sal_crypto_service_t *)instanceHandle,
+                                      hashAlgorithm,
+                                      pAuthKey,
+                                      authKeyLenInBytes,
+                                      pState,
+                                      NULL,
+                                      resultSize))
+    {
+        callbackFn(pCallbackTag);
+        return CPA_STATUS_SUCCESS;
+    }
+
     if (CPA_CY_SYM_HASH_AES_XCBC == hashAlgorithm)
     {
         Cpa8U *in = pWorkingMemory;
@@ -405,6 +668,13 @@ CpaStatus LacSymHash_AesECBPreCompute(CpaInstanceHandle instanceHandle,
     {
         return CPA_STATUS_INVALID_PARAM;
     }
+    LacSymHash_PrecompCacheInsert((sal_crypto_service_t *)instanceHandle,
+                                  hashAlgorithm,
+                                  pAuthKey,
+                                  authKeyLenInBytes,
+                                  pState,
+                                  NULL,
+                                  resultSize);
     callbackFn(pCallbackTag);
     return status;
 }
@@ -412,10 +682,94 @@ CpaStatus LacSymHash_AesECBPreCompute(CpaInstanceHandle instanceHandle,
 CpaStatus LacSymHash_HmacPrecompInit(CpaInstanceHandle instanceHandle)
 {
     CpaStatus status = CPA_STATUS_SUCCESS;
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+    lac_sym_hash_precomp_cache_t *pCache = NULL;
+    Cpa32U numSets = 1;
+
+    pService->pHashPrecompCache = NULL;
+    if (0 == pService->hashPrecompCacheSize)
+    {
+        return status;
+    }
+    if (pService->hashPrecompCacheSize > LAC_HASH_PRECOMP_CACHE_MAX_ENTRIES)
+    {
+        LAC_LOG_ERROR1("Hash precompute cache limited to %u entries",
+                       LAC_HASH_PRECOMP_CACHE_MAX_ENTRIES);
+        pService->hashPrecompCacheSize = LAC_HASH_PRECOMP_CACHE_MAX_ENTRIES;
+    }
+    while (numSets * LAC_HASH_PRECOMP_CACHE_WAYS <
+           pService->hashPrecompCacheSize)
+    {
+        numSets <<= 1;
+    }
+
+    status = LAC_OS_MALLOC(&pCache, sizeof(lac_sym_hash_precomp_cache_t));
+    LAC_CHECK_STATUS(status);
+    LAC_OS_BZERO(pCache, sizeof(lac_sym_hash_precomp_cache_t));
+
+    status = LAC_OS_MALLOC(&pCache->pEntries,
+                           numSets * LAC_HASH_PRECOMP_CACHE_WAYS *
+                               sizeof(lac_sym_hash_precomp_entry_t));
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        LAC_OS_FREE(pCache);
+        return status;
+    }
+    LAC_OS_BZERO(pCache->pEntries,
+                 numSets * LAC_HASH_PRECOMP_CACHE_WAYS *
+                     sizeof(lac_sym_hash_precomp_entry_t));
+    pCache->numSets = numSets;
+
+    status = LAC_SPINLOCK_INIT(&pCache->lock);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        LAC_OS_FREE(pCache->pEntries);
+        LAC_OS_FREE(pCache);
+        return status;
+    }
+    pService->hashPrecompCacheSize = numSets * LAC_HASH_PRECOMP_CACHE_WAYS;
+    pService->pHashPrecompCache = pCache;
+
     return status;
 }
 
 void LacSymHash_HmacPrecompShutdown(CpaInstanceHandle instanceHandle)
 {
-    return;
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+    lac_sym_hash_precomp_cache_t *pCache = pService->pHashPrecompCache;
+
+    if (NULL == pCache)
+    {
+        return;
+    }
+    pService->pHashPrecompCache = NULL;
+
+    LacSymHash_PrecompWipe(pCache->pEntries,
+                           pCache->numSets * LAC_HASH_PRECOMP_CACHE_WAYS *
+                               sizeof(lac_sym_hash_precomp_entry_t));
+    LAC_SPINLOCK_DESTROY(&pCache->lock);
+    LAC_OS_FREE(pCache->pEntries);
+    LAC_OS_FREE(pCache);
+}
+
+CpaStatus LacSymHash_PrecompCacheStatsGet(
+    CpaInstanceHandle instanceHandle,
+    icp_sal_hash_precomp_cache_stats_t *pStats)
+{
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+    lac_sym_hash_precomp_cache_t *pCache = pService->pHashPrecompCache;
+
+    if (NULL == pCache)
+    {
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+    LAC_SPINLOCK(&pCache->lock);
+    pStats->numHits = pCache->numHits;
+    pStats->numMisses = pCache->numMisses;
+    pStats->numEvictions = pCache->numEvictions;
+    LAC_SPINUNLOCK(&pCache->lock);
+    pStats->numEntries = pCache->numSets * LAC_HASH_PRECOMP_CACHE_WAYS;
+
+    return CPA_STATUS_SUCCESS;
 }
@@ -0,0 +1,711 @@
+/******************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ *****************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file lac_sym_host.c     Host execution of symmetric requests
+ *
+ * @ingroup LacSymHost
+ *
+ ***************************************************************************/
+
+/*
+*******************************************************************************
+* Include public/global header files
+*******************************************************************************
+*/
+#include "cpa.h"
+#include "cpa_cy_sym.h"
+#include "icp_sal.h"
+
+/*
+*******************************************************************************
+* Include private header files
+*******************************************************************************
+*/
+#include "Osal.h"
+#include "icp_accel_devices.h"
+#include "icp_adf_init.h"
+#include "icp_adf_debug.h"
+#include "icp_adf_transport.h"
+#include "icp_qat_fw_la.h"
+#include "icp_qat_hw.h"
+#include "lac_common.h"
+#include "lac_log.h"
+#include "lac_mem.h"
+#include "lac_session.h"
+#include "lac_sym.h"
+#include "lac_sym_hash_defs.h"
+#include "lac_sym_host.h"
+#include "lac_sal_types_crypto.h"
+#include "sal_statistics.h"
+
+/*
+*******************************************************************************
+* Static Variables and defines
+*******************************************************************************
+*/
+
+#define LAC_SYM_HOST_BLOCK_SIZE 16
+/**< AES and GHASH block size */
+
+#define LAC_SYM_HOST_CTR_CHUNK_BLOCKS 16
+/**< AES-CTR keystream blocks generated per call */
+
+#define LAC_SYM_HOST_GCM_IV_LEN 12
+/**< GCM IV length for which J0 is built from the IV, pIv holds J0
+ * for any other length */
+
+typedef OSAL_STATUS (*lac_sym_host_hash_resume_fn_t)(UINT8 *state,
+                                                     UINT8 *in,
+                                                     UINT32 len,
+                                                     UINT8 *out);
+/**< Completes a hash from the state after one block */
+
+/*
+*******************************************************************************
+* Define static function definitions
+*******************************************************************************
+*/
+
+/* Clears state in a way the compiler can not drop as a dead store */
+STATIC void LacSymHost_Wipe(void *pBuffer, Cpa32U sizeInBytes)
+{
+    volatile Cpa8U *p = (volatile Cpa8U *)pBuffer;
+
+    while (sizeInBytes--)
+    {
+        *p++ = 0;
+    }
+}
+
+/* Compares two digests in constant time */
+STATIC CpaBoolean LacSymHost_DigestEqual(const Cpa8U *pA,
+                                         const Cpa8U *pB,
+                                         Cpa32U len)
+{
+    Cpa8U diff = 0;
+    Cpa32U i = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        diff |= pA[i] ^ pB[i];
+    }
+    return (0 == diff) ? CPA_TRUE : CPA_FALSE;
+}
+
+STATIC void LacSymHost_StoreBe32(Cpa8U *p, Cpa32U value)
+{
+    p[0] = (Cpa8U)(value >> 24);
+    p[1] = (Cpa8U)(value >> 16);
+    p[2] = (Cpa8U)(value >> 8);
+    p[3] = (Cpa8U)value;
+}
+
+STATIC void LacSymHost_StoreBe64(Cpa8U *p, Cpa64U value)
+{
+    LacSymHost_StoreBe32(p, (Cpa32U)(value >> 32));
+    LacSymHost_StoreBe32(p + 4, (Cpa32U)value);
+}
+
+STATIC Cpa32U LacSymHost_LoadBe32(const Cpa8U *p)
+{
+    return ((Cpa32U)p[0] << 24) | ((Cpa32U)p[1] << 16) |
+           ((Cpa32U)p[2] << 8) | (Cpa32U)p[3];
+}
+
+/* Returns the hash completion function and digest length for the HMAC
+ * algorithms executed on the host, NULL for any other algorithm */
+STATIC lac_sym_host_hash_resume_fn_t
+LacSymHost_HashResumeGet(CpaCySymHashAlgorithm hashAlgorithm,
+                         Cpa32U *pDigestLen)
+{
+    switch (hashAlgorithm)
+    {
+        case CPA_CY_SYM_HASH_SHA1:
+            *pDigestLen = LAC_HASH_SHA1_DIGEST_SIZE;
+            return osalHashSHA1Resume;
+        case CPA_CY_SYM_HASH_SHA224:
+            *pDigestLen = LAC_HASH_SHA224_DIGEST_SIZE;
+            return osalHashSHA224Resume;
+        case CPA_CY_SYM_HASH_SHA256:
+            *pDigestLen = LAC_HASH_SHA256_DIGEST_SIZE;
+            return osalHashSHA256Resume;
+        case CPA_CY_SYM_HASH_SHA384:
+            *pDigestLen = LAC_HASH_SHA384_DIGEST_SIZE;
+            return osalHashSHA384Resume;
+        case CPA_CY_SYM_HASH_SHA512:
+            *pDigestLen = LAC_HASH_SHA512_DIGEST_SIZE;
+            return osalHashSHA512Resume;
+        default:
+            return NULL;
+    }
+}
+
+/* Checks that a request can be executed on the host without touching any
+ * of its data */
+STATIC CpaBoolean LacSymHost_IsEligible(const lac_sym_host_t *pHost,
+                                        const lac_sym_bulk_cookie_t *pCookie,
+                                        const lac_session_desc_t *pSessionDesc)
+{
+    const CpaCySymOpData *pOpData = pCookie->pOpData;
+    const CpaBufferList *pSrcBuffer = pCookie->pSrcBuffer;
+    const CpaBufferList *pDstBuffer = pCookie->pDstBuffer;
+    Cpa32U digestLen = 0;
+
+    if ((CPA_TRUE == pSessionDesc->isDPSession) ||
+        (CPA_CY_SYM_PACKET_TYPE_FULL != pOpData->packetType) ||
+        (CPA_CY_SYM_OP_ALGORITHM_CHAINING != pSessionDesc->symOperation))
+    {
+        return CPA_FALSE;
+    }
+
+    /* Single flat buffers only */
+    if ((NULL == pSrcBuffer) || (NULL == pDstBuffer) ||
+        (1 != pSrcBuffer->numBuffers) || (1 != pDstBuffer->numBuffers) ||
+        (pSrcBuffer->pBuffers[0].dataLenInBytes > pHost->maxSize) ||
+        (pDstBuffer->pBuffers[0].dataLenInBytes <
+         pSrcBuffer->pBuffers[0].dataLenInBytes))
+    {
+        return CPA_FALSE;
+    }
+
+    if ((ICP_QAT_HW_AES_128_KEY_SZ != pSessionDesc->cipherKeyLenInBytes) &&
+        (ICP_QAT_HW_AES_192_KEY_SZ != pSessionDesc->cipherKeyLenInBytes) &&
+        (ICP_QAT_HW_AES_256_KEY_SZ != pSessionDesc->cipherKeyLenInBytes))
+    {
+        return CPA_FALSE;
+    }
+
+    if (CPA_CY_SYM_CIPHER_AES_GCM == pSessionDesc->cipherAlgorithm)
+    {
+        return ((CPA_CY_SYM_HASH_AES_GCM == pSessionDesc->hashAlgorithm) &&
+                ((LAC_SYM_HOST_GCM_IV_LEN == pOpData->ivLenInBytes) ||
+                 (LAC_SYM_HOST_BLOCK_SIZE == pOpData->ivLenInBytes)))
+                   ? CPA_TRUE
+                   : CPA_FALSE;
+    }
+
+    if (CPA_CY_SYM_CIPHER_AES_CBC == pSessionDesc->cipherAlgorithm)
+    {
+        return ((CPA_CY_SYM_HASH_MODE_AUTH == pSessionDesc->hashMode) &&
+                (ICP_QAT_HW_AUTH_MODE1 == pSessionDesc->qatHashMode) &&
+                (NULL != LacSymHost_HashResumeGet(pSessionDesc->hashAlgorithm,
+                                                  &digestLen)) &&
+                (pSessionDesc->hashResultSize <= digestLen) &&
+                (LAC_SYM_HOST_BLOCK_SIZE == pOpData->ivLenInBytes) &&
+                (0 == (pOpData->messageLenToCipherInBytes %
+                       LAC_SYM_HOST_BLOCK_SIZE)))
+                   ? CPA_TRUE
+                   : CPA_FALSE;
+    }
+    return CPA_FALSE;
+}
+
+/* Returns the cipher key held in the content descriptor of the session */
+STATIC Cpa8U *LacSymHost_CipherKeyGet(lac_session_desc_t *pSessionDesc)
+{
+    icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *pCdCtrl =
+        (icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *)&pSessionDesc->reqCacheFtr
+            .cd_ctrl;
+
+    return (Cpa8U *)pSessionDesc->contentDescInfo.pData +
+           pCdCtrl->cipher_cfg_offset * LAC_QUAD_WORD_IN_BYTES +
+           sizeof(icp_qat_hw_cipher_config_t);
+}
+
+/* Absorbs data into a GHASH state, zero padding the last block */
+STATIC OSAL_STATUS LacSymHost_GhashData(Cpa8U *pHashKey,
+                                        Cpa8U *pState,
+                                        Cpa8U *pData,
+                                        Cpa32U len)
+{
+    Cpa8U block[LAC_SYM_HOST_BLOCK_SIZE] = {0};
+    Cpa32U numBlocks = len / LAC_SYM_HOST_BLOCK_SIZE;
+    Cpa32U rem = len % LAC_SYM_HOST_BLOCK_SIZE;
+    OSAL_STATUS status = OSAL_SUCCESS;
+
+    if (0 != numBlocks)
+    {
+        status = osalGhash(pHashKey, pState, pData, numBlocks);
+    }
+    if ((OSAL_SUCCESS == status) && (0 != rem))
+    {
+        memcpy(block, pData + numBlocks * LAC_SYM_HOST_BLOCK_SIZE, rem);
+        status = osalGhash(pHashKey, pState, block, 1);
+    }
+    return status;
+}
+
+/* GCTR of NIST SP 800-38D from the initial counter block J0. Only the low
+ * 32 bits of the counter are incremented, so the keystream is generated in
+ * chunks that stop where they would carry into the upper bits. */
+STATIC OSAL_STATUS LacSymHost_Gctr(Cpa8U *pKey,
+                                   Cpa32U keyLen,
+                                   const Cpa8U *pJ0,
+                                   Cpa8U *pData,
+                                   Cpa32U len)
+{
+    Cpa8U counter[LAC_SYM_HOST_BLOCK_SIZE];
+    Cpa8U start[LAC_SYM_HOST_BLOCK_SIZE];
+    Cpa8U keystream[LAC_SYM_HOST_CTR_CHUNK_BLOCKS * LAC_SYM_HOST_BLOCK_SIZE];
+    Cpa32U low = LacSymHost_LoadBe32(pJ0 + 12) + 1;
+    OSAL_STATUS status = OSAL_SUCCESS;
+
+    memcpy(counter, pJ0, LAC_SYM_HOST_BLOCK_SIZE);
+    while ((0 != len) && (OSAL_SUCCESS == status))
+    {
+        Cpa64U toWrap = ((Cpa64U)1 << 32) - low;
+        Cpa32U numBlocks =
+            (len + LAC_SYM_HOST_BLOCK_SIZE - 1) / LAC_SYM_HOST_BLOCK_SIZE;
+        Cpa32U numBytes = 0;
+        Cpa32U i = 0;
+
+        if (numBlocks > LAC_SYM_HOST_CTR_CHUNK_BLOCKS)
+        {
+            numBlocks = LAC_SYM_HOST_CTR_CHUNK_BLOCKS;
+        }
+        if (numBlocks > toWrap)
+        {
+            numBlocks = (Cpa32U)toWrap;
+        }
+
+        /* osalAESCtrKeystream increments before encrypting, so it starts
+         * one below the first counter block of the chunk */
+        LacSymHost_StoreBe32(counter + 12, low);
+        memcpy(start, counter, LAC_SYM_HOST_BLOCK_SIZE);
+        for (i = LAC_SYM_HOST_BLOCK_SIZE; i-- > 0;)
+        {
+            if (0 != start[i]--)
+            {
+                break;
+            }
+        }
+        status = osalAESCtrKeystream(pKey, keyLen, start, keystream, numBlocks);
+
+        numBytes = numBlocks * LAC_SYM_HOST_BLOCK_SIZE;
+        if (numBytes > len)
+        {
+            numBytes = len;
+        }
+        for (i = 0; i < numBytes; i++)
+        {
+            pData[i] ^= keystream[i];
+        }
+        pData += numBytes;
+        len -= numBytes;
+        low += numBlocks;
+    }
+    LacSymHost_Wipe(keystream, sizeof(keystream));
+    return status;
+}
+
+/* AES-GCM, authenticating the AAD and the ciphertext */
+STATIC OSAL_STATUS LacSymHost_Gcm(lac_session_desc_t *pSessionDesc,
+                                  const CpaCySymOpData *pOpData,
+                                  Cpa8U *pData,
+                                  Cpa8U *pTag)
+{
+    Cpa8U *pKey = LacSymHost_CipherKeyGet(pSessionDesc);
+    Cpa32U keyLen = pSessionDesc->cipherKeyLenInBytes;
+    Cpa8U *pText = pData + pOpData->cryptoStartSrcOffsetInBytes;
+    Cpa32U len = pOpData->messageLenToCipherInBytes;
+    Cpa32U aadLen = pSessionDesc->aadLenInBytes;
+    CpaBoolean isEncrypt =
+        (CPA_CY_SYM_CIPHER_DIRECTION_ENCRYPT == pSessionDesc->cipherDirection)
+            ? CPA_TRUE
+            : CPA_FALSE;
+    Cpa8U hashKey[LAC_SYM_HOST_BLOCK_SIZE] = {0};
+    Cpa8U zero[LAC_SYM_HOST_BLOCK_SIZE] = {0};
+    Cpa8U j0[LAC_SYM_HOST_BLOCK_SIZE] = {0};
+    Cpa8U state[LAC_SYM_HOST_BLOCK_SIZE] = {0};
+    Cpa8U lengths[LAC_SYM_HOST_BLOCK_SIZE];
+    Cpa32U i = 0;
+    OSAL_STATUS status = OSAL_SUCCESS;
+
+    status = osalAESEncrypt(pKey, keyLen, zero, hashKey);
+
+    if (LAC_SYM_HOST_GCM_IV_LEN == pOpData->ivLenInBytes)
+    {
+        memcpy(j0, pOpData->pIv, LAC_SYM_HOST_GCM_IV_LEN);
+        j0[LAC_SYM_HOST_BLOCK_SIZE - 1] = 1;
+    }
+    else
+    {
+        memcpy(j0, pOpData->pIv, LAC_SYM_HOST_BLOCK_SIZE);
+    }
+
+    /* The AAD buffer was zero padded to a whole block by the perform */
+    if ((OSAL_SUCCESS == status) && (0 != aadLen))
+    {
+        status = osalGhash(hashKey,
+                           state,
+                           pOpData->pAdditionalAuthData,
+                           (aadLen + LAC_SYM_HOST_BLOCK_SIZE - 1) /
+                               LAC_SYM_HOST_BLOCK_SIZE);
+    }
+    if ((OSAL_SUCCESS == status) && (CPA_FALSE == isEncrypt))
+    {
+        status = LacSymHost_GhashData(hashKey, state, pText, len);
+    }
+    if (OSAL_SUCCESS == status)
+    {
+        status = LacSymHost_Gctr(pKey, keyLen, j0, pText, len);
+    }
+    if ((OSAL_SUCCESS == status) && (CPA_TRUE == isEncrypt))
+    {
+        status = LacSymHost_GhashData(hashKey, state, pText, len);
+    }
+    if (OSAL_SUCCESS == status)
+    {
+        LacSymHost_StoreBe64(lengths, (Cpa64U)aadLen * 8);
+        LacSymHost_StoreBe64(lengths + 8, (Cpa64U)len * 8);
+        status = osalGhash(hashKey, state, lengths, 1);
+    }
+    if (OSAL_SUCCESS == status)
+    {
+        status = osalAESEncrypt(pKey, keyLen, j0, pTag);
+    }
+    for (i = 0; i < LAC_SYM_HOST_BLOCK_SIZE; i++)
+    {
+        pTag[i] ^= state[i];
+    }
+
+    LacSymHost_Wipe(hashKey, sizeof(hashKey));
+    LacSymHost_Wipe(state, sizeof(state));
+    return status;
+}
+
+/* HMAC from the inner and outer states held in the content descriptor */
+STATIC OSAL_STATUS LacSymHost_Hmac(lac_session_desc_t *pSessionDesc,
+                                   Cpa8U *pData,
+                                   Cpa32U len,
+                                   Cpa8U *pDigest)
+{
+    icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *pCdCtrl =
+        (icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *)&pSessionDesc->reqCacheFtr
+            .cd_ctrl;
+    Cpa8U *pState1 = (Cpa8U *)pSessionDesc->contentDescInfo.pData +
+                     pCdCtrl->hash_cfg_offset * LAC_QUAD_WORD_IN_BYTES +
+                     sizeof(icp_qat_hw_auth_setup_t);
+    Cpa8U *pState2 = pState1 + pCdCtrl->inner_state1_sz;
+    Cpa8U inner[LAC_HASH_SHA512_DIGEST_SIZE];
+    Cpa32U digestLen = 0;
+    lac_sym_host_hash_resume_fn_t pResume =
+        LacSymHost_HashResumeGet(pSessionDesc->hashAlgorithm, &digestLen);
+    OSAL_STATUS status = OSAL_SUCCESS;
+
+    status = pResume(pState1, pData, len, inner);
+    if (OSAL_SUCCESS == status)
+    {
+        status = pResume(pState2, inner, digestLen, pDigest);
+    }
+    LacSymHost_Wipe(inner, sizeof(inner));
+    return status;
+}
+
+/* AES-CBC chained with HMAC, in the order of the session command */
+STATIC OSAL_STATUS LacSymHost_CbcHmac(lac_session_desc_t *pSessionDesc,
+                                      const CpaCySymOpData *pOpData,
+                                      Cpa8U *pData,
+                                      Cpa8U *pDigest)
+{
+    Cpa8U *pKey = LacSymHost_CipherKeyGet(pSessionDesc);
+    Cpa8U *pText = pData + pOpData->cryptoStartSrcOffsetInBytes;
+    Cpa32U numBlocks =
+        pOpData->messageLenToCipherInBytes / LAC_SYM_HOST_BLOCK_SIZE;
+    Cpa8U iv[LAC_SYM_HOST_BLOCK_SIZE];
+    CpaBoolean cipherFirst =
+        (ICP_QAT_FW_LA_CMD_CIPHER_HASH == pSessionDesc->laCmdId) ? CPA_TRUE
+                                                                 : CPA_FALSE;
+    OSAL_STATUS status = OSAL_SUCCESS;
+
+    if (CPA_FALSE == cipherFirst)
+    {
+        status = LacSymHost_Hmac(pSessionDesc,
+                                 pData + pOpData->hashStartSrcOffsetInBytes,
+                                 pOpData->messageLenToHashInBytes,
+                                 pDigest);
+    }
+    if ((OSAL_SUCCESS == status) && (0 != numBlocks))
+    {
+        memcpy(iv, pOpData->pIv, LAC_SYM_HOST_BLOCK_SIZE);
+        if (CPA_CY_SYM_CIPHER_DIRECTION_ENCRYPT ==
+            pSessionDesc->cipherDirection)
+        {
+            status = osalAESCbcEncrypt(pKey,
+                                       pSessionDesc->cipherKeyLenInBytes,
+                                       iv,
+                                       pText,
+                                       pText,
+                                       numBlocks);
+        }
+        else
+        {
+            status = osalAESCbcDecrypt(pKey,
+                                       pSessionDesc->cipherKeyLenInBytes,
+                                       iv,
+                                       pText,
+                                       pText,
+                                       numBlocks);
+        }
+    }
+    if ((OSAL_SUCCESS == status) && (CPA_TRUE == cipherFirst))
+    {
+        status = LacSymHost_Hmac(pSessionDesc,
+                                 pData + pOpData->hashStartSrcOffsetInBytes,
+                                 pOpData->messageLenToHashInBytes,
+                                 pDigest);
+    }
+    return status;
+}
+
+/*
+*******************************************************************************
+* Define public/global function definitions
+*******************************************************************************
+*/
+
+CpaStatus LacSymHost_Init(CpaInstanceHandle instanceHandle)
+{
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+    lac_sym_host_t *pHost = NULL;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    pService->pSymHost = NULL;
+    if (LAC_SYM_HOST_FALLBACK_OFF == pService->symHostFallback)
+    {
+        return status;
+    }
+    if (pService->symHostFallback > LAC_SYM_HOST_FALLBACK_ALWAYS)
+    {
+        LAC_LOG_ERROR1("Invalid SymHostFallback value %u, using 1",
+                       pService->symHostFallback);
+        pService->symHostFallback = LAC_SYM_HOST_FALLBACK_ON_BUSY;
+    }
+
+    status = LAC_OS_MALLOC(&pHost, sizeof(lac_sym_host_t));
+    LAC_CHECK_STATUS(status);
+    LAC_OS_BZERO(pHost, sizeof(lac_sym_host_t));
+
+    pHost->mode = pService->symHostFallback;
+    pHost->threshold = pService->symHostFallbackThreshold;
+    pHost->maxSize = pService->symHostFallbackMaxSize;
+    osalAtomicSet(0, &pHost->numOffloaded);
+    osalAtomicSet(0, &pHost->numHostExecuted);
+    osalAtomicSet(0, &pHost->numHostIneligible);
+    pService->pSymHost = pHost;
+
+    return status;
+}
+
+void LacSymHost_Free(CpaInstanceHandle instanceHandle)
+{
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+
+    if (NULL != pService->pSymHost)
+    {
+        LAC_OS_FREE(pService->pSymHost);
+        pService->pSymHost = NULL;
+    }
+}
+
+CpaBoolean LacSymHost_RingBusy(CpaInstanceHandle instanceHandle)
+{
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+    lac_sym_host_t *pHost = pService->pSymHost;
+    Cpa32U numInflight = 0;
+    Cpa32U maxInflight = 0;
+
+    if (LAC_SYM_HOST_FALLBACK_ALWAYS == pHost->mode)
+    {
+        return CPA_TRUE;
+    }
+    if ((0 != pHost->threshold) &&
+        (CPA_STATUS_SUCCESS ==
+         icp_adf_transGetInflight(
+             pService->trans_handle_sym_tx, &numInflight, &maxInflight)) &&
+        (numInflight >= pHost->threshold))
+    {
+        return CPA_TRUE;
+    }
+    return CPA_FALSE;
+}
+
+CpaStatus LacSymHost_Perform(CpaInstanceHandle instanceHandle,
+                             lac_sym_bulk_cookie_t *pCookie,
+                             lac_session_desc_t *pSessionDesc,
+                             CpaBoolean *pOkFlag)
+{
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+    lac_sym_host_t *pHost = pService->pSymHost;
+    const CpaCySymOpData *pOpData = pCookie->pOpData;
+    Cpa8U *pSrc = NULL;
+    Cpa8U *pData = NULL;
+    Cpa8U *pDigest = NULL;
+    Cpa32U hashEnd = 0;
+    Cpa8U digest[LAC_HASH_SHA512_DIGEST_SIZE];
+    OSAL_STATUS status = OSAL_SUCCESS;
+
+    if (CPA_TRUE != LacSymHost_IsEligible(pHost, pCookie, pSessionDesc))
+    {
+        osalAtomicInc(&pHost->numHostIneligible);
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+    /* Out of place requests are executed in place on the destination */
+    pSrc = pCookie->pSrcBuffer->pBuffers[0].pData;
+    pData = pCookie->pDstBuffer->pBuffers[0].pData;
+    if (pSrc != pData)
+    {
+        memcpy(pData, pSrc, pCookie->pSrcBuffer->pBuffers[0].dataLenInBytes);
+    }
+
+    if (CPA_CY_SYM_CIPHER_AES_GCM == pSessionDesc->cipherAlgorithm)
+    {
+        /* For GCM the hash and cipher data regions are equal */
+        hashEnd = pOpData->cryptoStartSrcOffsetInBytes +
+                  pOpData->messageLenToCipherInBytes;
+        status = LacSymHost_Gcm(pSessionDesc, pOpData, pData, digest);
+    }
+    else
+    {
+        hashEnd = pOpData->hashStartSrcOffsetInBytes +
+                  pOpData->messageLenToHashInBytes;
+        status = LacSymHost_CbcHmac(pSessionDesc, pOpData, pData, digest);
+    }
+
+    pDigest = (CPA_TRUE == pSessionDesc->digestIsAppended)
+                  ? pData + hashEnd
+                  : pOpData->pDigestResult;
+    *pOkFlag = CPA_TRUE;
+    if (OSAL_SUCCESS != status)
+    {
+        LAC_LOG_ERROR("Host execution of the request failed");
+        *pOkFlag = CPA_FALSE;
+    }
+    else if (CPA_TRUE == pSessionDesc->digestVerify)
+    {
+        *pOkFlag = LacSymHost_DigestEqual(
+            digest, pDigest, pSessionDesc->hashResultSize);
+    }
+    else
+    {
+        memcpy(pDigest, digest, pSessionDesc->hashResultSize);
+    }
+    LacSymHost_Wipe(digest, sizeof(digest));
+
+    osalAtomicInc(&pHost->numHostExecuted);
+    return (OSAL_SUCCESS == status) ? CPA_STATUS_SUCCESS : CPA_STATUS_FAIL;
+}
+
+void LacSymHost_OffloadedAdd(CpaInstanceHandle instanceHandle,
+                             Cpa32U numRequests)
+{
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+
+    osalAtomicAdd(numRequests, &pService->pSymHost->numOffloaded);
+}
+
+CpaStatus LacSymHost_StatsGet(CpaInstanceHandle instanceHandle,
+                              icp_sal_sym_host_fallback_stats_t *pStats)
+{
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+    lac_sym_host_t *pHost = pService->pSymHost;
+
+    if (NULL == pHost)
+    {
+        return CPA_STATUS_UNSUPPORTED;
+    }
+    pStats->numOffloaded = (Cpa64U)osalAtomicGet(&pHost->numOffloaded);
+    pStats->numHostExecuted = (Cpa64U)osalAtomicGet(&pHost->numHostExecuted);
+    pStats->numHostIneligible =
+        (Cpa64U)osalAtomicGet(&pHost->numHostIneligible);
+
+    return CPA_STATUS_SUCCESS;
+}
+
+void LacSymHost_StatsShow(CpaInstanceHandle instanceHandle)
+{
+    icp_sal_sym_host_fallback_stats_t hostStats = {0};
+
+    if (CPA_STATUS_SUCCESS != LacSymHost_StatsGet(instanceHandle, &hostStats))
+    {
+        return;
+    }
+
+    osalLog64(OSAL_LOG_LVL_USER,
+              OSAL_LOG_DEV_STDOUT,
+              BORDER
+              " Requests Offloaded:             %16llu " BORDER "\n" BORDER
+              " Requests Executed On Host:      %16llu " BORDER "\n" BORDER
+              " Requests Not Host Eligible:     %16llu " BORDER "\n" SEPARATOR,
+              hostStats.numOffloaded,
+              hostStats.numHostExecuted,
+              hostStats.numHostIneligible,
+              0,
+              0,
+              0,
+              0,
+              0);
+}
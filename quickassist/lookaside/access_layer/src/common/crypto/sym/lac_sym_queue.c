@@ -93,117 +93,376 @@
 #include "lac_log.h"
 #include "icp_qat_fw_la.h"
 #include "lac_sal_types_crypto.h"
+#include "lac_sym_cb.h"
+#include "lac_sym_host.h"
 
 #define GetSingleBitFromByte(byte, bit) ((byte) & (1 << (bit)))
 
+#define DEQUEUE_MSGPUT_MAX_RETRIES 10000
+#define DEQUEUE_MSGPUT_BURST_SIZE 16
+
+/*
+*******************************************************************************
+* Define static function definitions
+*******************************************************************************
+*/
+
+/* The request queue of a session is a multi-producer, single-consumer FIFO.
+ * Producers push on to the pRequestQueueNew list with a compare and
+ * exchange. The consumer is whoever owns the queue (see requestQueueCount in
+ * the session descriptor); it takes the whole list with an exchange and
+ * appends it, reversed, to its private pRequestQueueHead list. Requests are
+ * never removed from the shared list one at a time, so a request that
+ * completes and is reused while still referenced cannot corrupt it.
+ *
+ * A producer counts its request before pushing it. The consumer never waits
+ * for a counted request to be pushed, as it may be a completion that
+ * interrupted that very producer: it leaves LAC_SYM_QUEUE_STALLED in the
+ * shared list instead, and the producer that replaces the marker takes
+ * over the drain. */
+
+/* Marks the shared list of a queue whose drain stalled */
+#define LAC_SYM_QUEUE_STALLED ((lac_sym_bulk_cookie_t *)(LAC_ARCH_UINT)1)
+
+/* Pushes a request on to the shared list. Returns CPA_TRUE if this
+ * replaced the stall marker, the caller then owns the drain */
+static CpaBoolean LacSymQueue_Push(lac_session_desc_t *pSessionDesc,
+                                   lac_sym_bulk_cookie_t *pRequest)
+{
+    lac_sym_bulk_cookie_t *pTop = NULL;
+
+    do
+    {
+        pTop = pSessionDesc->pRequestQueueNew;
+        pRequest->pNext = (LAC_SYM_QUEUE_STALLED == pTop) ? NULL : pTop;
+    } while (OSAL_SUCCESS !=
+             osalAtomicPtrCmpXchg(
+                 (void *volatile *)&pSessionDesc->pRequestQueueNew,
+                 pTop,
+                 pRequest));
+
+    return (LAC_SYM_QUEUE_STALLED == pTop) ? CPA_TRUE : CPA_FALSE;
+}
+
+/* Returns the queued request following pPrev, or the first queued request
+ * if pPrev is NULL. Returns NULL if the request is counted in the queue but
+ * its producer has not pushed it yet. */
+static lac_sym_bulk_cookie_t *LacSymQueue_Next(
+    lac_session_desc_t *pSessionDesc,
+    lac_sym_bulk_cookie_t *pPrev)
+{
+    lac_sym_bulk_cookie_t *pNew = NULL;
+    lac_sym_bulk_cookie_t *pFifo = NULL;
+    lac_sym_bulk_cookie_t *pNext = NULL;
+
+    pNext = (NULL == pPrev) ? pSessionDesc->pRequestQueueHead : pPrev->pNext;
+    if (NULL != pNext)
+    {
+        return pNext;
+    }
+
+    /* The private list is exhausted: take over the newly queued requests.
+     * The stall marker is only set once the owner has left the queue, so
+     * it is never taken here */
+    pNew = (lac_sym_bulk_cookie_t *)osalAtomicPtrXchg(
+        (void *volatile *)&pSessionDesc->pRequestQueueNew, NULL);
+
+    /* Reverse into submission order */
+    while (NULL != pNew)
+    {
+        pNext = pNew->pNext;
+        pNew->pNext = pFifo;
+        pFifo = pNew;
+        pNew = pNext;
+    }
+
+    if (NULL == pPrev)
+    {
+        pSessionDesc->pRequestQueueHead = pFifo;
+    }
+    else
+    {
+        pPrev->pNext = pFifo;
+    }
+    return pFifo;
+}
+
+/* Loads the session IV state for a partial packet request about to be
+ * sent. This can only be done when no other partials are in flight for
+ * this session, to ensure the cipherPartialOpState buffer in the session
+ * descriptor is not currently in use */
+static void LacSymQueue_SessionIvUpdate(lac_session_desc_t *pSessionDesc,
+                                        lac_sym_bulk_cookie_t *pRequest)
+{
+    if (CPA_TRUE == pRequest->updateSessionIvOnSend)
+    {
+        if (LAC_CIPHER_IS_ARC4(pSessionDesc->cipherAlgorithm))
+        {
+            memcpy(pSessionDesc->cipherPartialOpState,
+                   pSessionDesc->cipherARC4InitialState,
+                   LAC_CIPHER_ARC4_STATE_LEN_BYTES);
+        }
+        else
+        {
+            memcpy(pSessionDesc->cipherPartialOpState,
+                   pRequest->pOpData->pIv,
+                   pRequest->pOpData->ivLenInBytes);
+        }
+    }
+}
+
 /*
 *******************************************************************************
 * Define public/global function definitions
 *******************************************************************************
 */
 
-CpaStatus LacSymQueue_RequestSend(const CpaInstanceHandle instanceHandle,
-                                  lac_sym_bulk_cookie_t *pRequest,
-                                  lac_session_desc_t *pSessionDesc)
+CpaStatus LacSymQueue_RequestsDrain(lac_session_desc_t *pSessionDesc,
+                                    Cpa64U numReleased)
 {
     CpaStatus status = CPA_STATUS_SUCCESS;
-    CpaBoolean enqueued = CPA_FALSE;
-    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
-    /* Enqueue the message instead of sending directly if:
-     * (i) a blocking operation is in progress
-     * (ii) there are previous requests already in the queue
-     */
-    if ((CPA_FALSE == pSessionDesc->nonBlockingOpsInProgress) ||
-        (NULL != pSessionDesc->pRequestQueueTail))
+    sal_crypto_service_t *pService =
+        (sal_crypto_service_t *)pSessionDesc->pInstance;
+    lac_sym_bulk_cookie_t *pRequest = NULL;
+    lac_sym_bulk_cookie_t *pNext = NULL;
+    lac_sym_bulk_cookie_t *pReqs[DEQUEUE_MSGPUT_BURST_SIZE + 1];
+    Cpa32U *pMsgs[DEQUEUE_MSGPUT_BURST_SIZE];
+    CpaBoolean partialSent = CPA_FALSE;
+    INT64 numPending = 0;
+    Cpa32U numReqs = 0;
+    Cpa32U numSent = 0;
+    Cpa32U retries = 0;
+
+    numPending =
+        osalAtomicSub((INT64)numReleased, &pSessionDesc->requestQueueCount);
+
+    while (numPending > 0)
     {
-        LAC_SPINLOCK(&pSessionDesc->requestQueueLock);
+        /* Gather a burst of queued requests so that they can be put on the
+         * ring with a single tail update. A partial packet request must
+         * complete before any request behind it is sent, so it always ends
+         * the burst.
+         */
+        numReqs = 0;
+        pRequest = NULL;
+        while ((numReqs < DEQUEUE_MSGPUT_BURST_SIZE) &&
+               (numReqs < numPending))
+        {
+            pNext = LacSymQueue_Next(pSessionDesc, pRequest);
+            if (NULL == pNext)
+            {
+                /* Counted but not pushed yet */
+                break;
+            }
+            pRequest = pNext;
+            pReqs[numReqs] = pRequest;
+            pMsgs[numReqs++] = (Cpa32U *)&(pRequest->qatMsg);
+
+            if (CPA_CY_SYM_PACKET_TYPE_FULL != pRequest->pOpData->packetType)
+            {
+                LacSymQueue_SessionIvUpdate(pSessionDesc, pRequest);
+                break;
+            }
+        }
 
-        /* Re-check blockingOpsInProgress and pRequestQueueTail in case either
-         * changed before the lock was acquired.  The lock is shared with
-         * the callback context which drains this queue
+        if (0 == numReqs)
+        {
+            /* Leave the drain to the producer of the next request, unless
+             * it pushed the request in the meantime */
+            if (OSAL_SUCCESS ==
+                osalAtomicPtrCmpXchg(
+                    (void *volatile *)&pSessionDesc->pRequestQueueNew,
+                    NULL,
+                    LAC_SYM_QUEUE_STALLED))
+            {
+                break;
+            }
+            continue;
+        }
+
+        /* A request may complete and be reused as soon as it is sent, so
+         * the entry following the burst is read beforehand */
+        pReqs[numReqs] = pRequest->pNext;
+        partialSent = (CPA_CY_SYM_PACKET_TYPE_FULL !=
+                       pRequest->pOpData->packetType)
+                          ? CPA_TRUE
+                          : CPA_FALSE;
+
+        /*
+         * Now we'll attempt to send the burst directly to QAT. We'll keep
+         * looing until it succeeds (or at least a very high number of retries),
+         * as the failure only happens when the ring is full, and this is only
+         * a temporary situation. After a few retries, space will become
+         * availble, allowing the putMsgs to take the rest of the burst.
          */
-        if ((CPA_FALSE == pSessionDesc->nonBlockingOpsInProgress) ||
-            (NULL != pSessionDesc->pRequestQueueTail))
+        retries = 0;
+        numSent = 0;
+        do
         {
-            /* Enqueue the message and exit */
-            /* The FIFO queue is made up of a head and tail pointer.
-             * The head pointer points to the first/oldest, entry
-             * in the queue, and the tail pointer points to the last/newest
-             * entry in the queue
-             */
+            Cpa32U numPut = 0;
+
+            /* Send directly to QAT */
+            status = icp_adf_transPutMsgs(pService->trans_handle_sym_tx,
+                                          &pMsgs[numSent],
+                                          LAC_QAT_SYM_REQ_SZ_LW,
+                                          numReqs - numSent,
+                                          &numPut);
 
-            if (NULL != pSessionDesc->pRequestQueueTail)
+            /* Dequeue whatever the ring accepted */
+            numSent += numPut;
+            pSessionDesc->pRequestQueueHead = pReqs[numSent];
+            if ((NULL != pService->pSymHost) && (0 != numPut))
             {
-                /* Queue is non-empty. Add this request to the list */
-                pSessionDesc->pRequestQueueTail->pNext = pRequest;
+                LacSymHost_OffloadedAdd(pService, numPut);
             }
-            else
+
+            retries++;
+            /*
+             * Yield to allow other threads that may be on this session to poll
+             * and make some space on the ring
+             */
+            if (numSent < numReqs)
             {
-                /* Queue is empty. Initialise the head pointer as well */
-                pSessionDesc->pRequestQueueHead = pRequest;
+                osalYield();
             }
+        } while ((numSent < numReqs) &&
+                 ((CPA_STATUS_SUCCESS == status) ||
+                  (CPA_STATUS_RETRY == status)) &&
+                 (retries < DEQUEUE_MSGPUT_MAX_RETRIES));
 
-            pSessionDesc->pRequestQueueTail = pRequest;
+        if (numSent < numReqs)
+        {
+            /* The unsent requests stay queued and keep the queue owned */
+            if (CPA_STATUS_SUCCESS == status)
+            {
+                status = CPA_STATUS_RETRY;
+            }
+            LAC_LOG_ERROR(
+                "Failed to icp_adf_transPutMsgs, maximum retries exceeded.");
+            if (0 != numSent)
+            {
+                osalAtomicSub(numSent, &pSessionDesc->requestQueueCount);
+            }
+            break;
+        }
 
-            /* request is queued, don't send to QAT here */
-            enqueued = CPA_TRUE;
+        if (CPA_TRUE == partialSent)
+        {
+            /* The partial packet request now owns the queue until it
+             * completes; release the requests sent ahead of it */
+            if (numSent > 1)
+            {
+                osalAtomicSub(numSent - 1, &pSessionDesc->requestQueueCount);
+            }
+            break;
         }
-        LAC_SPINUNLOCK(&pSessionDesc->requestQueueLock);
+
+        numPending =
+            osalAtomicSub(numSent, &pSessionDesc->requestQueueCount);
     }
+    return status;
+}
+
+CpaStatus LacSymQueue_RequestSend(const CpaInstanceHandle instanceHandle,
+                                  lac_sym_bulk_cookie_t *pRequest,
+                                  lac_session_desc_t *pSessionDesc)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaStatus hostStatus = CPA_STATUS_UNSUPPORTED;
+    sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
+    CpaBoolean isQueueOwner = CPA_FALSE;
+    CpaBoolean hostTried = CPA_FALSE;
+    CpaBoolean hostOkFlag = CPA_FALSE;
+    CpaBoolean isFullPacket =
+        (CPA_CY_SYM_PACKET_TYPE_FULL == pRequest->pOpData->packetType)
+            ? CPA_TRUE
+            : CPA_FALSE;
 
-    if (CPA_FALSE == enqueued)
+    /* A full packet request on a session with nothing queued or blocking
+     * is sent directly, without touching the queue */
+    if ((CPA_FALSE == isFullPacket) ||
+        (0 != osalAtomicGet(&pSessionDesc->requestQueueCount)))
     {
-        /* If we send a partial packet request, set the blockingOpsInProgress
-         * flag for the session to indicate that subsequent requests must be
-         * queued up until this request completes
-         *
-         * @assumption
-         * If we have got here it means that there were no previous blocking
-         * operations in progress and, since multiple partial packet requests
-         * on a given session cannot be issued concurrently, there should be
-         * no need for a critical section around the following code
+        /* Enqueue the message instead of sending directly if:
+         * (i) a blocking operation is in progress
+         * (ii) there are previous requests already in the queue
+         * in both cases the queue count was already non-zero and the owner
+         * of the queue will send it.
          */
-        if (CPA_CY_SYM_PACKET_TYPE_FULL != pRequest->pOpData->packetType)
+        if (1 != osalAtomicInc(&pSessionDesc->requestQueueCount))
         {
-            /* Select blocking operations which this reqest will complete */
-            pSessionDesc->nonBlockingOpsInProgress = CPA_FALSE;
+            if (CPA_TRUE == LacSymQueue_Push(pSessionDesc, pRequest))
+            {
+                /* The drain stalled on this request, carry it on */
+                (void)LacSymQueue_RequestsDrain(pSessionDesc, 0);
+            }
+            return CPA_STATUS_SUCCESS;
         }
 
-        /* At this point, we're clear to send the request.  For cipher requests,
-         * we need to check if the session IV needs to be updated.  This can
-         * only be done when no other partials are in flight for this session,
-         * to ensure the cipherPartialOpState buffer in the session descriptor
-         * is not currently in use
+        /* This request took the queue count from zero so it owns the queue.
+         * A partial packet request keeps it until it completes, which
+         * blocks subsequent requests on the session.
          */
-        if (CPA_TRUE == pRequest->updateSessionIvOnSend)
+        isQueueOwner = CPA_TRUE;
+        if (CPA_FALSE == isFullPacket)
         {
-            if (LAC_CIPHER_IS_ARC4(pSessionDesc->cipherAlgorithm))
-            {
-                memcpy(pSessionDesc->cipherPartialOpState,
-                       pSessionDesc->cipherARC4InitialState,
-                       LAC_CIPHER_ARC4_STATE_LEN_BYTES);
-            }
-            else
-            {
-                memcpy(pSessionDesc->cipherPartialOpState,
-                       pRequest->pOpData->pIv,
-                       pRequest->pOpData->ivLenInBytes);
-            }
+            LacSymQueue_SessionIvUpdate(pSessionDesc, pRequest);
         }
+    }
+
+    /* With host execution enabled a request that finds the ring busy may
+     * be executed on the host instead */
+    if ((NULL != pService->pSymHost) && (CPA_TRUE == isFullPacket) &&
+        (CPA_TRUE == LacSymHost_RingBusy(instanceHandle)))
+    {
+        hostTried = CPA_TRUE;
+        hostStatus = LacSymHost_Perform(
+            instanceHandle, pRequest, pSessionDesc, &hostOkFlag);
+    }
 
+    if (CPA_STATUS_UNSUPPORTED == hostStatus)
+    {
         /* Send to QAT */
         status = SalQatMsg_transPutMsg(pService->trans_handle_sym_tx,
                                        (void *)&(pRequest->qatMsg),
                                        LAC_QAT_SYM_REQ_SZ_LW,
                                        LAC_LOG_MSG_SYMCYBULK);
-        /* if fail to send request, we need to change nonBlockingOpsInProgress
-         * to CPA_TRUE
-         */
-        if ((CPA_STATUS_SUCCESS != status) &&
-            (CPA_CY_SYM_PACKET_TYPE_FULL != pRequest->pOpData->packetType))
+
+        if (NULL != pService->pSymHost)
         {
-            pSessionDesc->nonBlockingOpsInProgress = CPA_TRUE;
+            if (CPA_STATUS_SUCCESS == status)
+            {
+                LacSymHost_OffloadedAdd(instanceHandle, 1);
+            }
+            else if ((CPA_STATUS_RETRY == status) &&
+                     (CPA_TRUE == isFullPacket) && (CPA_FALSE == hostTried))
+            {
+                hostStatus = LacSymHost_Perform(
+                    instanceHandle, pRequest, pSessionDesc, &hostOkFlag);
+            }
         }
     }
+    if (CPA_STATUS_UNSUPPORTED != hostStatus)
+    {
+        status = CPA_STATUS_SUCCESS;
+    }
+
+    /* If this request owns the queue, give up ownership once the request
+     * no longer blocks the session, sending whatever was queued behind it.
+     * The status of those requests is reported through their callbacks.
+     */
+    if ((CPA_TRUE == isQueueOwner) &&
+        ((CPA_TRUE == isFullPacket) || (CPA_STATUS_SUCCESS != status)))
+    {
+        (void)LacSymQueue_RequestsDrain(pSessionDesc, 1);
+    }
+
+    /* A request executed on the host completes last, the callback may
+     * release the session */
+    if (CPA_STATUS_UNSUPPORTED != hostStatus)
+    {
+        LacSymCb_ProcessHostResponse(
+            pRequest, hostOkFlag, hostStatus, pSessionDesc);
+    }
     return status;
 }
@@ -90,6 +90,9 @@
 #include "lac_sym_qat.h"
 #include "lac_sal_types_crypto.h"
 #include "sal_statistics.h"
+#include "lac_sym_hash.h"
+#include "lac_sym_drbg.h"
+#include "lac_sym_host.h"
 
 /* Number of Symmetric Crypto statistics */
 #define LAC_SYM_NUM_STATS (sizeof(CpaCySymStats64) / sizeof(Cpa64U))
@@ -99,25 +102,16 @@ CpaStatus LacSym_StatsInit(CpaInstanceHandle instanceHandle)
     CpaStatus status = CPA_STATUS_SUCCESS;
     sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
 
-    status = LAC_OS_MALLOC(&(pService->pLacSymStatsArr),
-                           LAC_SYM_NUM_STATS * sizeof(OsalAtomic));
+    status = LacStats_Init(&pService->lacSymStats, LAC_SYM_NUM_STATS);
 
-    if (CPA_STATUS_SUCCESS == status)
-    {
-        LAC_OS_BZERO(
-            (void *)LAC_CONST_VOLATILE_PTR_CAST(pService->pLacSymStatsArr),
-            LAC_SYM_NUM_STATS * sizeof(OsalAtomic));
-    }
     return status;
 }
 
 void LacSym_StatsFree(CpaInstanceHandle instanceHandle)
 {
     sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
-    if (NULL != pService->pLacSymStatsArr)
-    {
-        LAC_OS_FREE(pService->pLacSymStatsArr);
-    }
+
+    LacStats_Free(&pService->lacSymStats);
 }
 
 #ifndef DISABLE_STATS
@@ -126,7 +120,7 @@ void LacSym_StatsInc(Cpa32U offset, CpaInstanceHandle instanceHandle)
     sal_crypto_service_t *pService = (sal_crypto_service_t *)instanceHandle;
     if (CPA_TRUE == pService->generic_service_info.stats->bSymStatsEnabled)
     {
-        osalAtomicInc(&pService->pLacSymStatsArr[offset / sizeof(Cpa64U)]);
+        LacStats_Inc(&pService->lacSymStats, offset / sizeof(Cpa64U));
     }
 }
 #endif /* DISABLE_STATS */
@@ -142,7 +136,7 @@ void LacSym_Stats32CopyGet(CpaInstanceHandle instanceHandle,
     for (i = 0; i < LAC_SYM_NUM_STATS; i++)
     {
         ((Cpa32U *)pSymStats)[i] =
-            (Cpa32U)osalAtomicGet(&pService->pLacSymStatsArr[i]);
+            (Cpa32U)LacStats_Get(&pService->lacSymStats, i);
     }
 }
 
@@ -156,10 +150,36 @@ void LacSym_Stats64CopyGet(CpaInstanceHandle instanceHandle,
 
     for (i = 0; i < LAC_SYM_NUM_STATS; i++)
     {
-        ((Cpa64U *)pSymStats)[i] = osalAtomicGet(&pService->pLacSymStatsArr[i]);
+        ((Cpa64U *)pSymStats)[i] = LacStats_Get(&pService->lacSymStats, i);
     }
 }
 
+STATIC void LacSym_PrecompCacheStatsShow(CpaInstanceHandle instanceHandle)
+{
+    icp_sal_hash_precomp_cache_stats_t cacheStats = {0};
+
+    if (CPA_STATUS_SUCCESS !=
+        LacSymHash_PrecompCacheStatsGet(instanceHandle, &cacheStats))
+    {
+        return;
+    }
+
+    osalLog64(OSAL_LOG_LVL_USER,
+              OSAL_LOG_DEV_STDOUT,
+              BORDER
+              " Precompute Cache Hits:          %16llu " BORDER "\n" BORDER
+              " Precompute Cache Misses:        %16llu " BORDER "\n" BORDER
+              " Precompute Cache Evictions:     %16llu " BORDER "\n" SEPARATOR,
+              cacheStats.numHits,
+              cacheStats.numMisses,
+              cacheStats.numEvictions,
+              0,
+              0,
+              0,
+              0,
+              0);
+}
+
 void LacSym_StatsShow(CpaInstanceHandle instanceHandle)
 {
     CpaCySymStats64 symStats = {0};
@@ -213,4 +233,8 @@ void LacSym_StatsShow(CpaInstanceHandle instanceHandle)
               0,
               0,
               0);
+
+    LacSym_PrecompCacheStatsShow(instanceHandle);
+    LacSymHost_StatsShow(instanceHandle);
+    LacSymDrbg_StatsShow(instanceHandle);
 }
@@ -759,6 +759,22 @@ void LacSymQat_HashOpHwBlockPtrsInit(
         (Cpa8U *)(pHashBlkPtrs->pInHashInitState1) + cd_ctrl->inner_state1_sz;
 }
 
+void LacSymQat_HashOptimisedStatePtrsGet(icp_qat_la_bulk_req_ftr_t *pMsg,
+                                         void *pHwBlockBase,
+                                         Cpa8U **ppState1,
+                                         Cpa8U **ppState2)
+{
+    lac_hash_blk_ptrs_optimised_t hashBlkPtrs = {0};
+
+    LacSymQat_HashOpHwBlockPtrsInit(
+        (icp_qat_fw_auth_cd_ctrl_hdr_t *)&(pMsg->cd_ctrl),
+        pHwBlockBase,
+        &hashBlkPtrs);
+
+    *ppState1 = hashBlkPtrs.pInHashInitState1;
+    *ppState2 = hashBlkPtrs.pInHashInitState2;
+}
+
 STATIC void LacSymQat_HashSetupBlockOptimisedFormatInit(
     const CpaCySymHashSetupData *pHashSetupData,
     icp_qat_fw_auth_cd_ctrl_hdr_t *pHashControlBlock,
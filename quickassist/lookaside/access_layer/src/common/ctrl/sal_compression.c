@@ -395,8 +395,9 @@ CpaStatus SalCtrl_CompressionInit(icp_accel_dev_t *device,
         (Cpa8U)Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC);
 
 #ifdef KERNEL_SPACE
-    /* Kernel instances do not support epoll mode */
-    if (SAL_RESP_EPOLL_CFG_FILE == pCompressionService->isPolled)
+    /* Kernel instances do not support epoll or hybrid mode */
+    if (SAL_RESP_EPOLL_CFG_FILE == pCompressionService->isPolled ||
+        SAL_RESP_HYBRID_CFG_FILE == pCompressionService->isPolled)
     {
         LAC_LOG_ERROR_PARAMS(
             "IsPolled %u is not supported for kernel instance %s",
@@ -406,9 +407,10 @@ CpaStatus SalCtrl_CompressionInit(icp_accel_dev_t *device,
     }
 #endif
 #ifndef KERNEL_SPACE
-    /* User instances only support poll and epoll mode */
+    /* User instances support poll, epoll and hybrid mode */
     if (SAL_RESP_POLL_CFG_FILE != pCompressionService->isPolled &&
-        SAL_RESP_EPOLL_CFG_FILE != pCompressionService->isPolled)
+        SAL_RESP_EPOLL_CFG_FILE != pCompressionService->isPolled &&
+        SAL_RESP_HYBRID_CFG_FILE != pCompressionService->isPolled)
     {
         LAC_LOG_ERROR_PARAMS(
             "IsPolled %u is not supported for user instance %s",
@@ -422,6 +424,10 @@ CpaStatus SalCtrl_CompressionInit(icp_accel_dev_t *device,
     {
         rx_resp_type = ICP_RESP_TYPE_POLL;
     }
+    else if (SAL_RESP_HYBRID_CFG_FILE == pCompressionService->isPolled)
+    {
+        rx_resp_type = ICP_RESP_TYPE_HYBRID;
+    }
 
     status = icp_adf_cfgGetParamValue(
         device, LAC_CFG_SECTION_GENERAL, ADF_DEV_PKG_ID, adfGetParam);
@@ -594,6 +600,44 @@ CpaStatus SalCtrl_CompressionInit(icp_accel_dev_t *device,
         goto cleanup;
     }
 
+    /* Exclusive owner mode is optional, default to off if not present */
+    pCompressionService->isExclusiveOwner = CPA_FALSE;
+#ifndef KERNEL_SPACE
+    status =
+        Sal_StringParsing("Dc",
+                          pCompressionService->generic_service_info.instance,
+                          "ExclusiveOwner",
+                          temp_string);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        LAC_LOG_ERROR("Failed to parse DcExclusiveOwner string");
+        goto cleanup;
+    }
+    if ((CPA_STATUS_SUCCESS ==
+         icp_adf_cfgGetParamValue(device, section, temp_string, adfGetParam)) &&
+        (0 != Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC)))
+    {
+        /* Exclusive owner mode is only an optimisation, fall back to the
+         * locked rings if the transport cannot provide it */
+        if (CPA_STATUS_SUCCESS !=
+            icp_sal_DcSetExclusiveOwner(pCompressionService, CPA_TRUE))
+        {
+            LAC_LOG_ERROR("Exclusive owner mode not available for instance\n");
+            icp_sal_DcSetExclusiveOwner(pCompressionService, CPA_FALSE);
+            pCompressionService->isExclusiveOwner = CPA_FALSE;
+        }
+    }
+#endif
+
+    if (SAL_RESP_HYBRID_CFG_FILE == pCompressionService->isPolled)
+    {
+        status = SalCtrl_HybridPollInit(device, service, section, "Dc");
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            goto cleanup;
+        }
+    }
+
     /* 2. Allocates memory pools */
     status =
         Sal_StringParsing("Comp",
@@ -1517,7 +1561,8 @@ CpaStatus cpaDcInstanceGetInfo2(const CpaInstanceHandle instanceHandle,
     pInstanceInfo2->requiresPhysicallyContiguousMemory = CPA_TRUE;
 
     if (SAL_RESP_POLL_CFG_FILE == pCompressionService->isPolled ||
-        SAL_RESP_EPOLL_CFG_FILE == pCompressionService->isPolled)
+        SAL_RESP_EPOLL_CFG_FILE == pCompressionService->isPolled ||
+        SAL_RESP_HYBRID_CFG_FILE == pCompressionService->isPolled)
     {
         pInstanceInfo2->isPolled = CPA_TRUE;
     }
@@ -1817,6 +1862,110 @@ CpaStatus icp_sal_DcPollInstance(CpaInstanceHandle instanceHandle_in,
     return status;
 }
 
+/**
+ ******************************************************************************
+ * @ingroup cpaDcCommon
+ * Adaptive poll and wait on a hybrid compression instance.
+ *****************************************************************************/
+CpaStatus icp_sal_DcWaitInstance(CpaInstanceHandle instanceHandle_in,
+                                 Cpa32U response_quota,
+                                 Cpa32U timeout_ms)
+{
+    sal_compression_service_t *dc_handle = NULL;
+    icp_comms_trans_handle trans_hndTable[DC_NUM_RX_RINGS];
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        dc_handle = (sal_compression_service_t *)dcGetFirstHandle();
+    }
+    else
+    {
+        dc_handle = (sal_compression_service_t *)instanceHandle_in;
+    }
+
+    LAC_CHECK_NULL_PARAM(dc_handle);
+    SAL_RUNNING_CHECK(dc_handle);
+    SAL_CHECK_INSTANCE_TYPE(dc_handle, SAL_SERVICE_TYPE_COMPRESSION);
+    if (SAL_RESP_HYBRID_CFG_FILE != dc_handle->isPolled)
+    {
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+    trans_hndTable[0] = dc_handle->trans_handle_compression_rx;
+
+    return SalCtrl_HybridWait(&dc_handle->generic_service_info,
+                              trans_hndTable,
+                              DC_NUM_RX_RINGS,
+                              response_quota,
+                              timeout_ms);
+}
+
+/**
+ ******************************************************************************
+ * @ingroup cpaDcCommon
+ * Returns the adaptive wait counters of a hybrid compression instance.
+ *****************************************************************************/
+CpaStatus icp_sal_DcGetWaitStats(CpaInstanceHandle instanceHandle_in,
+                                 icp_sal_wait_stats_t *pWaitStats)
+{
+    sal_compression_service_t *dc_handle = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        dc_handle = (sal_compression_service_t *)dcGetFirstHandle();
+    }
+    else
+    {
+        dc_handle = (sal_compression_service_t *)instanceHandle_in;
+    }
+
+    LAC_CHECK_NULL_PARAM(dc_handle);
+    LAC_CHECK_NULL_PARAM(pWaitStats);
+    SAL_CHECK_INSTANCE_TYPE(dc_handle, SAL_SERVICE_TYPE_COMPRESSION);
+    if (SAL_RESP_HYBRID_CFG_FILE != dc_handle->isPolled)
+    {
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+    SalCtrl_HybridWaitStatsGet(&dc_handle->generic_service_info, pWaitStats);
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/**
+ ******************************************************************************
+ * @ingroup cpaDcCommon
+ * Marks the rings of a compression instance as used by a single thread.
+ *****************************************************************************/
+CpaStatus icp_sal_DcSetExclusiveOwner(CpaInstanceHandle instanceHandle_in,
+                                      CpaBoolean exclusive)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    sal_compression_service_t *dc_handle = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        dc_handle = (sal_compression_service_t *)dcGetFirstHandle();
+    }
+    else
+    {
+        dc_handle = (sal_compression_service_t *)instanceHandle_in;
+    }
+
+    LAC_CHECK_NULL_PARAM(dc_handle);
+    SAL_CHECK_INSTANCE_TYPE(dc_handle, SAL_SERVICE_TYPE_COMPRESSION);
+
+    status = icp_adf_transSetExclusiveOwner(
+        dc_handle->trans_handle_compression_tx, exclusive);
+    LAC_CHECK_STATUS(status);
+    status = icp_adf_transSetExclusiveOwner(
+        dc_handle->trans_handle_compression_rx, exclusive);
+    LAC_CHECK_STATUS(status);
+    dc_handle->isExclusiveOwner = exclusive;
+
+    return status;
+}
+
 /**
  ******************************************************************************
  * @ingroup cpaDcCommon
@@ -118,6 +118,8 @@
 #include "lac_sym_hash.h"
 #include "lac_sym_cb.h"
 #include "lac_sym_stats.h"
+#include "lac_sym_drbg.h"
+#include "lac_sym_host.h"
 #include "lac_pke_utils.h"
 #include "lac_pke_qat_comms.h"
 #include "lac_ec.h"
@@ -300,6 +302,7 @@ STATIC CpaStatus SalCtrl_AsymFreeResources(sal_crypto_service_t *pCryptoService)
     /* Free memory pools if not NULL */
     Lac_MemPoolDestroy(pCryptoService->lac_pke_align_pool);
     Lac_MemPoolDestroy(pCryptoService->lac_pke_req_pool);
+    Lac_MemPoolDestroy(pCryptoService->lac_pke_arena_pool);
     Lac_MemPoolDestroy(pCryptoService->lac_ec_pool);
     Lac_MemPoolDestroy(pCryptoService->lac_prime_pool);
 #ifdef KPT
@@ -307,6 +310,9 @@ STATIC CpaStatus SalCtrl_AsymFreeResources(sal_crypto_service_t *pCryptoService)
     Lac_MemPoolDestroy(pCryptoService->lac_kpt_array_pool);
 #endif
 
+    /* Free the named curves */
+    LacEc_NamedCurvesFree(pCryptoService);
+
     /* Free the statistics */
     LacDh_StatsFree(pCryptoService);
     LacDsa_StatsFree(pCryptoService);
@@ -314,6 +320,7 @@ STATIC CpaStatus SalCtrl_AsymFreeResources(sal_crypto_service_t *pCryptoService)
     LacEc_StatsFree(pCryptoService);
     LacPrime_StatsFree(pCryptoService);
     LacLn_StatsFree(pCryptoService);
+    LacPke_StatsFree(pCryptoService);
 
     /* Free transport handles */
     status = SalCtrl_AsymReleaseTransHandle((sal_service_t *)pCryptoService);
@@ -351,6 +358,8 @@ STATIC CpaStatus SalCtrl_SymFreeResources(sal_crypto_service_t *pCryptoService)
 
     /* Free statistics */
     LacSym_StatsFree(pCryptoService);
+    LacSymDrbg_StatsFree(pCryptoService);
+    LacSymHost_Free(pCryptoService);
 
     /* Free transport handles */
     status = SalCtrl_SymReleaseTransHandle((sal_service_t *)pCryptoService);
@@ -422,6 +431,10 @@ STATIC CpaStatus SalCtrl_AsymCreateTransHandle(icp_accel_dev_t *device,
     {
         rx_resp_type = ICP_RESP_TYPE_POLL;
     }
+    else if (SAL_RESP_HYBRID_CFG_FILE == pCryptoService->isPolled)
+    {
+        rx_resp_type = ICP_RESP_TYPE_HYBRID;
+    }
 
     if (CPA_FALSE == pCryptoService->generic_service_info.is_dyn)
     {
@@ -494,6 +507,10 @@ STATIC CpaStatus SalCtrl_SymCreateTransHandle(icp_accel_dev_t *device,
     {
         rx_resp_type = ICP_RESP_TYPE_POLL;
     }
+    else if (SAL_RESP_HYBRID_CFG_FILE == pCryptoService->isPolled)
+    {
+        rx_resp_type = ICP_RESP_TYPE_HYBRID;
+    }
 
     if (CPA_FALSE == pCryptoService->generic_service_info.is_dyn)
     {
@@ -564,6 +581,8 @@ STATIC int SalCtrl_CryptoDebug(void *private_data,
         case SAL_STATS_SYM:
         {
             CpaCySymStats64 symStats = {0};
+            icp_sal_hash_precomp_cache_stats_t cacheStats = {0};
+            icp_sal_sym_host_fallback_stats_t hostStats = {0};
             if (CPA_TRUE !=
                 pCryptoService->generic_service_info.stats->bSymStatsEnabled)
             {
@@ -614,6 +633,38 @@ STATIC int SalCtrl_CryptoDebug(void *private_data,
                 (long long unsigned int)symStats.numSymOpCompleted,
                 (long long unsigned int)symStats.numSymOpCompletedErrors,
                 (long long unsigned int)symStats.numSymOpVerifyFailures);
+
+            /* Precompute cache info, only when the cache is enabled */
+            if (CPA_STATUS_SUCCESS ==
+                LacSymHash_PrecompCacheStatsGet(pCryptoService, &cacheStats))
+            {
+                len += snprintf(
+                    data + len,
+                    size - len,
+                    BORDER
+                    " Precompute Cache Hits:          %16llu " BORDER "\n" BORDER
+                    " Precompute Cache Misses:        %16llu " BORDER "\n" BORDER
+                    " Precompute Cache Evictions:     %16llu " BORDER "\n",
+                    (long long unsigned int)cacheStats.numHits,
+                    (long long unsigned int)cacheStats.numMisses,
+                    (long long unsigned int)cacheStats.numEvictions);
+            }
+
+            /* Host execution info, only when it is enabled */
+            if (CPA_STATUS_SUCCESS ==
+                LacSymHost_StatsGet(pCryptoService, &hostStats))
+            {
+                len += snprintf(
+                    data + len,
+                    size - len,
+                    BORDER
+                    " Requests Offloaded:             %16llu " BORDER "\n" BORDER
+                    " Requests Executed On Host:      %16llu " BORDER "\n" BORDER
+                    " Requests Not Host Eligible:     %16llu " BORDER "\n",
+                    (long long unsigned int)hostStats.numOffloaded,
+                    (long long unsigned int)hostStats.numHostExecuted,
+                    (long long unsigned int)hostStats.numHostIneligible);
+            }
             break;
         }
         case SAL_STATS_DSA:
@@ -1216,6 +1267,51 @@ STATIC int SalCtrl_CryptoDebug(void *private_data,
                     ecdsaStats.numEcdsaVerifyCompletedOutputInvalid);
             break;
         }
+        case SAL_STATS_DRBG:
+        {
+            CpaCyDrbgStats64 drbgStats = {0};
+            if (CPA_TRUE !=
+                pCryptoService->generic_service_info.stats->bDrbgStatsEnabled)
+            {
+                break;
+            }
+            status = cpaCyDrbgQueryStats64(pCryptoService, &drbgStats);
+            if (status != CPA_STATUS_SUCCESS)
+            {
+                LAC_LOG_ERROR("cpaCyDrbgQueryStats64 returned error\n");
+                return 0;
+            }
+
+            len += snprintf(
+                data + len,
+                size - len,
+                SEPARATOR BORDER
+                " DRBG Stats                                       " BORDER
+                "\n" SEPARATOR);
+            len += snprintf(
+                data + len,
+                size - len,
+                BORDER
+                " DRBG Sessions Initialized:      %16llu " BORDER "\n" BORDER
+                " DRBG Sessions Removed:          %16llu " BORDER "\n" BORDER
+                " DRBG Session Errors:            %16llu " BORDER "\n" BORDER
+                " DRBG Gen Requests:              %16llu " BORDER "\n" BORDER
+                " DRBG Gen Request Errors:        %16llu " BORDER "\n" BORDER
+                " DRBG Gen Completed:             %16llu " BORDER "\n" BORDER
+                " DRBG Reseed Requests:           %16llu " BORDER "\n" BORDER
+                " DRBG Reseed Request Errors:     %16llu " BORDER "\n" BORDER
+                " DRBG Reseed Completed:          %16llu " BORDER "\n",
+                (long long unsigned int)drbgStats.numSessionsInitialized,
+                (long long unsigned int)drbgStats.numSessionsRemoved,
+                (long long unsigned int)drbgStats.numSessionErrors,
+                (long long unsigned int)drbgStats.numGenRequests,
+                (long long unsigned int)drbgStats.numGenRequestErrors,
+                (long long unsigned int)drbgStats.numGenCompleted,
+                (long long unsigned int)drbgStats.numReseedRequests,
+                (long long unsigned int)drbgStats.numReseedRequestErrors,
+                (long long unsigned int)drbgStats.numReseedCompleted);
+            break;
+        }
         default:
         {
             len += snprintf(data + len, size - len, SEPARATOR);
@@ -1266,6 +1362,22 @@ STATIC CpaStatus SalCtrl_AsymInit(icp_accel_dev_t *device,
         return CPA_STATUS_FAIL;
     }
 
+    /* Pre-padded operands are optional, disabled if not present */
+    pCryptoService->asymPrePaddedOperands = CPA_FALSE;
+    status = Sal_StringParsing("Cy",
+                               pCryptoService->generic_service_info.instance,
+                               "AsymPrePaddedOperands",
+                               temp_string);
+    LAC_CHECK_STATUS(status);
+    if (CPA_STATUS_SUCCESS ==
+        icp_adf_cfgGetParamValue(device, section, temp_string, adfGetParam))
+    {
+        pCryptoService->asymPrePaddedOperands =
+            (0 != Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC))
+                ? CPA_TRUE
+                : CPA_FALSE;
+    }
+
     /* Create transport handles */
     status = SalCtrl_AsymCreateTransHandle(
         device, service, numAsymConcurrentReq, section);
@@ -1305,6 +1417,22 @@ STATIC CpaStatus SalCtrl_AsymInit(icp_accel_dev_t *device,
         pCryptoService->nodeAffinity);
     LAC_CHECK_STATUS_ASYM_INIT(status);
 
+    /* Allocate pke operand arena memory pool, one arena per request chain */
+    pCryptoService->lac_pke_arena_pool = LAC_MEM_POOL_INIT_POOL_ID;
+    status = Sal_StringParsing("Cy",
+                               pCryptoService->generic_service_info.instance,
+                               "AsymArenaPool",
+                               temp_string);
+    LAC_CHECK_STATUS_ASYM_INIT(status);
+    status = Lac_MemPoolCreate(&pCryptoService->lac_pke_arena_pool,
+                               temp_string,
+                               (numAsymConcurrentReq + 1),
+                               LAC_PKE_OPERAND_ARENA_SIZE,
+                               LAC_64BYTE_ALIGNMENT,
+                               CPA_FALSE,
+                               pCryptoService->nodeAffinity);
+    LAC_CHECK_STATUS_ASYM_INIT(status);
+
     /* Allocate prime memory pool */
     pCryptoService->lac_prime_pool = LAC_MEM_POOL_INIT_POOL_ID;
     status = Sal_StringParsing("Cy",
@@ -1399,6 +1527,10 @@ STATIC CpaStatus SalCtrl_AsymInit(icp_accel_dev_t *device,
     status = LacRsa_Init(pCryptoService);
     LAC_CHECK_STATUS_ASYM_INIT(status);
 
+    /* Init operand marshalling stats */
+    status = LacPke_StatsInit(pCryptoService);
+    LAC_CHECK_STATUS_ASYM_INIT(status);
+
     /* Build Flow ID for all pke request sent on this instance */
     pCryptoService->pkeFlowId =
         (LAC_PKE_FLOW_ID_TAG |
@@ -1501,6 +1633,20 @@ STATIC CpaStatus SalCtrl_SymInit(icp_accel_dev_t *device,
     status = LacSymQat_Init(pCryptoService);
     LAC_CHECK_STATUS_SYM_INIT(status);
 
+    /* The precompute cache is optional, disabled if not present */
+    pCryptoService->hashPrecompCacheSize = 0;
+    status = Sal_StringParsing("Cy",
+                               pCryptoService->generic_service_info.instance,
+                               "HashPrecompCacheSize",
+                               temp_string);
+    LAC_CHECK_STATUS_SYM_INIT(status);
+    if (CPA_STATUS_SUCCESS ==
+        icp_adf_cfgGetParamValue(device, section, temp_string, adfGetParam))
+    {
+        pCryptoService->hashPrecompCacheSize =
+            (Cpa32U)Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC);
+    }
+
     /* Fills out content descriptor for precomputes and registers the
        hash precompute callback */
     status = LacSymHash_HmacPrecompInit(pCryptoService);
@@ -1510,6 +1656,53 @@ STATIC CpaStatus SalCtrl_SymInit(icp_accel_dev_t *device,
     status = LacSym_StatsInit(pCryptoService);
     LAC_CHECK_STATUS_SYM_INIT(status);
 
+    /* Init the DRBG stats */
+    status = LacSymDrbg_Init(pCryptoService);
+    LAC_CHECK_STATUS_SYM_INIT(status);
+
+    /* Host execution of sym requests is optional, disabled if not present.
+     * Kernel instances always offload. */
+    pCryptoService->symHostFallback = LAC_SYM_HOST_FALLBACK_OFF;
+    pCryptoService->symHostFallbackThreshold = 0;
+    pCryptoService->symHostFallbackMaxSize = LAC_SYM_HOST_DEFAULT_MAX_SIZE;
+#ifndef KERNEL_SPACE
+    status = Sal_StringParsing("Cy",
+                               pCryptoService->generic_service_info.instance,
+                               "SymHostFallback",
+                               temp_string);
+    LAC_CHECK_STATUS_SYM_INIT(status);
+    if (CPA_STATUS_SUCCESS ==
+        icp_adf_cfgGetParamValue(device, section, temp_string, adfGetParam))
+    {
+        pCryptoService->symHostFallback =
+            (Cpa32U)Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC);
+    }
+    status = Sal_StringParsing("Cy",
+                               pCryptoService->generic_service_info.instance,
+                               "SymHostFallbackThreshold",
+                               temp_string);
+    LAC_CHECK_STATUS_SYM_INIT(status);
+    if (CPA_STATUS_SUCCESS ==
+        icp_adf_cfgGetParamValue(device, section, temp_string, adfGetParam))
+    {
+        pCryptoService->symHostFallbackThreshold =
+            (Cpa32U)Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC);
+    }
+    status = Sal_StringParsing("Cy",
+                               pCryptoService->generic_service_info.instance,
+                               "SymHostFallbackMaxSize",
+                               temp_string);
+    LAC_CHECK_STATUS_SYM_INIT(status);
+    if (CPA_STATUS_SUCCESS ==
+        icp_adf_cfgGetParamValue(device, section, temp_string, adfGetParam))
+    {
+        pCryptoService->symHostFallbackMaxSize =
+            (Cpa32U)Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC);
+    }
+#endif
+    status = LacSymHost_Init(pCryptoService);
+    LAC_CHECK_STATUS_SYM_INIT(status);
+
     return status;
 }
 
@@ -1654,8 +1847,9 @@ STATIC CpaStatus SalCtr_InstInit(icp_accel_dev_t *device,
         (Cpa8U)Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC);
 
 #ifdef KERNEL_SPACE
-    /* Kernel instances do not support epoll mode */
-    if (SAL_RESP_EPOLL_CFG_FILE == pCryptoService->isPolled)
+    /* Kernel instances do not support epoll or hybrid mode */
+    if (SAL_RESP_EPOLL_CFG_FILE == pCryptoService->isPolled ||
+        SAL_RESP_HYBRID_CFG_FILE == pCryptoService->isPolled)
     {
         LAC_LOG_ERROR_PARAMS(
             "IsPolled %u is not supported for kernel instance %s",
@@ -1665,9 +1859,10 @@ STATIC CpaStatus SalCtr_InstInit(icp_accel_dev_t *device,
     }
 #endif
 #ifndef KERNEL_SPACE
-    /* User instances only support poll and epoll mode */
+    /* User instances support poll, epoll and hybrid mode */
     if (SAL_RESP_POLL_CFG_FILE != pCryptoService->isPolled &&
-        SAL_RESP_EPOLL_CFG_FILE != pCryptoService->isPolled)
+        SAL_RESP_EPOLL_CFG_FILE != pCryptoService->isPolled &&
+        SAL_RESP_HYBRID_CFG_FILE != pCryptoService->isPolled)
     {
         LAC_LOG_ERROR_PARAMS("IsPolled %u is not supported for "
                              "user instance %s",
@@ -1737,6 +1932,57 @@ STATIC CpaStatus SalCtr_InstInit(icp_accel_dev_t *device,
     /* No Execution Engine in DH895xcc, so make sure it is zero */
     pCryptoService->executionEngine = 0;
 
+    /* Exclusive owner mode is optional, default to off if not present */
+    pCryptoService->isExclusiveOwner = CPA_FALSE;
+#ifndef KERNEL_SPACE
+    status = Sal_StringParsing("Cy",
+                               pCryptoService->generic_service_info.instance,
+                               "ExclusiveOwner",
+                               temp_string);
+    LAC_CHECK_STATUS(status);
+    if (CPA_STATUS_SUCCESS ==
+        icp_adf_cfgGetParamValue(device, section, temp_string, adfGetParam))
+    {
+        pCryptoService->isExclusiveOwner =
+            (0 != Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC)) ? CPA_TRUE
+                                                                    : CPA_FALSE;
+    }
+#endif
+
+    if (SAL_RESP_HYBRID_CFG_FILE == pCryptoService->isPolled)
+    {
+        status = SalCtrl_HybridPollInit(device, service, section, "Cy");
+        LAC_CHECK_STATUS(status);
+    }
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Applies the exclusive owner setting to all the transport handles
+ * of the instance */
+STATIC CpaStatus SalCtrl_CySetExclusiveOwner(
+    sal_crypto_service_t *pCryptoService,
+    CpaBoolean exclusive)
+{
+    icp_comms_trans_handle trans_hndTable[] = {
+        pCryptoService->trans_handle_sym_tx,
+        pCryptoService->trans_handle_sym_rx,
+        pCryptoService->trans_handle_asym_tx,
+        pCryptoService->trans_handle_asym_rx};
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa32U i = 0;
+
+    for (i = 0; i < sizeof(trans_hndTable) / sizeof(trans_hndTable[0]); i++)
+    {
+        if (NULL == trans_hndTable[i])
+        {
+            continue;
+        }
+        status = icp_adf_transSetExclusiveOwner(trans_hndTable[i], exclusive);
+        LAC_CHECK_STATUS(status);
+    }
+    pCryptoService->isExclusiveOwner = exclusive;
+
     return status;
 }
 
@@ -1813,6 +2059,17 @@ CpaStatus SalCtrl_CryptoInit(icp_accel_dev_t *device, sal_service_t *service)
             break;
     }
 
+    /* Exclusive owner mode is only an optimisation, fall back to the
+     * locked rings if the transport cannot provide it */
+    if ((CPA_STATUS_SUCCESS == status) &&
+        (CPA_TRUE == pCryptoService->isExclusiveOwner) &&
+        (CPA_STATUS_SUCCESS !=
+         SalCtrl_CySetExclusiveOwner(pCryptoService, CPA_TRUE)))
+    {
+        LAC_LOG_ERROR("Exclusive owner mode not available for instance\n");
+        SalCtrl_CySetExclusiveOwner(pCryptoService, CPA_FALSE);
+    }
+
     pCryptoService->generic_service_info.state = SAL_SERVICE_STATE_INITIALIZED;
 #ifdef KPT
     osalAtomicSet(0, &(pCryptoService->kpt_keyhandle_loaded));
@@ -2473,7 +2730,8 @@ CpaStatus cpaCyInstanceGetInfo2(const CpaInstanceHandle instanceHandle_in,
 
     pInstanceInfo2->requiresPhysicallyContiguousMemory = CPA_TRUE;
     if (SAL_RESP_POLL_CFG_FILE == pCryptoService->isPolled ||
-        SAL_RESP_EPOLL_CFG_FILE == pCryptoService->isPolled)
+        SAL_RESP_EPOLL_CFG_FILE == pCryptoService->isPolled ||
+        SAL_RESP_HYBRID_CFG_FILE == pCryptoService->isPolled)
     {
         pInstanceInfo2->isPolled = CPA_TRUE;
     }
@@ -2594,7 +2852,7 @@ CpaStatus cpaCyQueryCapabilities(const CpaInstanceHandle instanceHandle_in,
         }
 #endif
     }
-    pCapInfo->drbgSupported = CPA_FALSE;
+    pCapInfo->drbgSupported = CPA_TRUE;
     pCapInfo->nrbgSupported = CPA_FALSE;
     pCapInfo->randSupported = CPA_FALSE;
 
@@ -2732,6 +2990,35 @@ CpaStatus cpaCySetAddressTranslation(const CpaInstanceHandle instanceHandle_in,
     return CPA_STATUS_SUCCESS;
 }
 
+/* Fills the table with the response ring handles of a crypto instance
+ * and returns their number */
+STATIC Cpa32U SalCtrl_CyGetRxHandles(sal_crypto_service_t *crypto_handle,
+                                     icp_comms_trans_handle *trans_hndTable)
+{
+    Cpa32U num_rx_rings = 0;
+
+    switch (crypto_handle->generic_service_info.type)
+    {
+        case SAL_SERVICE_TYPE_CRYPTO_ASYM:
+            trans_hndTable[TH_CY_RX_0] = crypto_handle->trans_handle_asym_rx;
+            num_rx_rings = 1;
+            break;
+        case SAL_SERVICE_TYPE_CRYPTO_SYM:
+            trans_hndTable[TH_CY_RX_0] = crypto_handle->trans_handle_sym_rx;
+            num_rx_rings = 1;
+            break;
+        case SAL_SERVICE_TYPE_CRYPTO:
+            trans_hndTable[TH_CY_RX_0] = crypto_handle->trans_handle_sym_rx;
+            trans_hndTable[TH_CY_RX_1] = crypto_handle->trans_handle_asym_rx;
+            num_rx_rings = MAX_CY_RX_RINGS;
+            break;
+        default:
+            break;
+    }
+
+    return num_rx_rings;
+}
+
 /**
  ******************************************************************************
  * @ingroup cpaCyCommon
@@ -2742,7 +3029,6 @@ CpaStatus icp_sal_CyPollInstance(CpaInstanceHandle instanceHandle_in,
 {
     CpaStatus status = CPA_STATUS_SUCCESS;
     sal_crypto_service_t *crypto_handle = NULL;
-    sal_service_t *gen_handle = NULL;
     icp_comms_trans_handle trans_hndTable[MAX_CY_RX_RINGS];
     Cpa32U num_rx_rings = 0;
 
@@ -2762,31 +3048,12 @@ CpaStatus icp_sal_CyPollInstance(CpaInstanceHandle instanceHandle_in,
                              SAL_SERVICE_TYPE_CRYPTO_ASYM |
                              SAL_SERVICE_TYPE_CRYPTO_SYM));
 
-    gen_handle = &(crypto_handle->generic_service_info);
-
     /*
      * From the instanceHandle we must get the trans_handle and send
      * down to adf for polling.
      * Populate our trans handle table with the appropriate handles.
      */
-    switch (gen_handle->type)
-    {
-        case SAL_SERVICE_TYPE_CRYPTO_ASYM:
-            trans_hndTable[TH_CY_RX_0] = crypto_handle->trans_handle_asym_rx;
-            num_rx_rings = 1;
-            break;
-        case SAL_SERVICE_TYPE_CRYPTO_SYM:
-            trans_hndTable[TH_CY_RX_0] = crypto_handle->trans_handle_sym_rx;
-            num_rx_rings = 1;
-            break;
-        case SAL_SERVICE_TYPE_CRYPTO:
-            trans_hndTable[TH_CY_RX_0] = crypto_handle->trans_handle_sym_rx;
-            trans_hndTable[TH_CY_RX_1] = crypto_handle->trans_handle_asym_rx;
-            num_rx_rings = MAX_CY_RX_RINGS;
-            break;
-        default:
-            break;
-    }
+    num_rx_rings = SalCtrl_CyGetRxHandles(crypto_handle, trans_hndTable);
 
     /* Call adf to do the polling. */
     status = icp_adf_pollInstance(trans_hndTable, num_rx_rings, response_quota);
@@ -2794,6 +3061,111 @@ CpaStatus icp_sal_CyPollInstance(CpaInstanceHandle instanceHandle_in,
     return status;
 }
 
+/**
+ ******************************************************************************
+ * @ingroup cpaCyCommon
+ * Adaptive poll and wait on a hybrid crypto instance.
+ *****************************************************************************/
+CpaStatus icp_sal_CyWaitInstance(CpaInstanceHandle instanceHandle_in,
+                                 Cpa32U response_quota,
+                                 Cpa32U timeout_ms)
+{
+    sal_crypto_service_t *crypto_handle = NULL;
+    icp_comms_trans_handle trans_hndTable[MAX_CY_RX_RINGS];
+    Cpa32U num_rx_rings = 0;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        crypto_handle =
+            (sal_crypto_service_t *)Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO);
+    }
+    else
+    {
+        crypto_handle = (sal_crypto_service_t *)instanceHandle_in;
+    }
+    LAC_CHECK_NULL_PARAM(crypto_handle);
+    SAL_RUNNING_CHECK(crypto_handle);
+    SAL_CHECK_INSTANCE_TYPE(crypto_handle,
+                            (SAL_SERVICE_TYPE_CRYPTO |
+                             SAL_SERVICE_TYPE_CRYPTO_ASYM |
+                             SAL_SERVICE_TYPE_CRYPTO_SYM));
+    if (SAL_RESP_HYBRID_CFG_FILE != crypto_handle->isPolled)
+    {
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+    num_rx_rings = SalCtrl_CyGetRxHandles(crypto_handle, trans_hndTable);
+
+    return SalCtrl_HybridWait(&crypto_handle->generic_service_info,
+                              trans_hndTable,
+                              num_rx_rings,
+                              response_quota,
+                              timeout_ms);
+}
+
+/**
+ ******************************************************************************
+ * @ingroup cpaCyCommon
+ * Returns the adaptive wait counters of a hybrid crypto instance.
+ *****************************************************************************/
+CpaStatus icp_sal_CyGetWaitStats(CpaInstanceHandle instanceHandle_in,
+                                 icp_sal_wait_stats_t *pWaitStats)
+{
+    sal_crypto_service_t *crypto_handle = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        crypto_handle =
+            (sal_crypto_service_t *)Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO);
+    }
+    else
+    {
+        crypto_handle = (sal_crypto_service_t *)instanceHandle_in;
+    }
+    LAC_CHECK_NULL_PARAM(crypto_handle);
+    LAC_CHECK_NULL_PARAM(pWaitStats);
+    SAL_CHECK_INSTANCE_TYPE(crypto_handle,
+                            (SAL_SERVICE_TYPE_CRYPTO |
+                             SAL_SERVICE_TYPE_CRYPTO_ASYM |
+                             SAL_SERVICE_TYPE_CRYPTO_SYM));
+    if (SAL_RESP_HYBRID_CFG_FILE != crypto_handle->isPolled)
+    {
+        return CPA_STATUS_UNSUPPORTED;
+    }
+
+    SalCtrl_HybridWaitStatsGet(&crypto_handle->generic_service_info, pWaitStats);
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/**
+ ******************************************************************************
+ * @ingroup cpaCyCommon
+ * Marks all the rings of a crypto instance as used by a single thread.
+ *****************************************************************************/
+CpaStatus icp_sal_CySetExclusiveOwner(CpaInstanceHandle instanceHandle_in,
+                                      CpaBoolean exclusive)
+{
+    sal_crypto_service_t *crypto_handle = NULL;
+
+    if (CPA_INSTANCE_HANDLE_SINGLE == instanceHandle_in)
+    {
+        crypto_handle =
+            (sal_crypto_service_t *)Lac_GetFirstHandle(SAL_SERVICE_TYPE_CRYPTO);
+    }
+    else
+    {
+        crypto_handle = (sal_crypto_service_t *)instanceHandle_in;
+    }
+    LAC_CHECK_NULL_PARAM(crypto_handle);
+    SAL_CHECK_INSTANCE_TYPE(crypto_handle,
+                            (SAL_SERVICE_TYPE_CRYPTO |
+                             SAL_SERVICE_TYPE_CRYPTO_ASYM |
+                             SAL_SERVICE_TYPE_CRYPTO_SYM));
+
+    return SalCtrl_CySetExclusiveOwner(crypto_handle, exclusive);
+}
+
 /* Returns the handle to the first asym crypto instance */
 STATIC CpaInstanceHandle
 Lac_GetFirstAsymHandle(icp_accel_dev_t *adfInsts[ADF_MAX_DEVICES],
@@ -72,6 +72,12 @@
  *
  *****************************************************************************/
 
+#ifdef KERNEL_SPACE
+#include <linux/ktime.h>
+#else
+#include <time.h>
+#endif
+
 /* QAT-API includes */
 #include "cpa.h"
 #include "cpa_cy_key.h"
@@ -95,6 +101,7 @@
 #include "icp_adf_init.h"
 #include "icp_adf_accel_mgr.h"
 #include "icp_adf_debug.h"
+#include "icp_adf_poll.h"
 
 /* SAL includes */
 #include "lac_log.h"
@@ -116,6 +123,20 @@
 #define SAL_USER_SPACE_START_TIMEOUT_MS 120000
 #define MAX_SUBSYSTEM_RETRY 64
 
+/* Empty polls of a hybrid instance before it blocks, unless configured */
+#define SAL_HYBRID_IDLE_THRESHOLD_DEFAULT 256
+/* Empty polls backed off by spinning, each spinning twice as long */
+#define SAL_HYBRID_SPIN_STEPS 10
+/* Sleep slice for hybrid rings with no interrupt to block on, and after a
+ * wait that returned with nothing to poll */
+#define SAL_HYBRID_NO_IRQ_SLEEP_MS 1
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SAL_CPU_RELAX() __asm__ __volatile__("pause" ::: "memory")
+#else
+#define SAL_CPU_RELAX() __asm__ __volatile__("" ::: "memory")
+#endif
+
 static char *subsystem_name = "SAL";
 /**< Name used by ADF to identify this component. */
 #ifndef ICP_DC_ONLY
@@ -1444,3 +1465,138 @@ CpaStatus validateConcurrRequest(Cpa32U numConcurrRequests)
 
     return CPA_STATUS_SUCCESS;
 }
+
+CpaStatus SalCtrl_HybridPollInit(icp_accel_dev_t *device,
+                                 sal_service_t *service,
+                                 char *section,
+                                 char *prefix)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    char temp_string[SAL_CFG_MAX_VAL_LEN_IN_BYTES] = {0};
+    char adfGetParam[ADF_CFG_MAX_VAL_LEN_IN_BYTES] = {0};
+
+    service->hybridIdleThreshold = SAL_HYBRID_IDLE_THRESHOLD_DEFAULT;
+    osalAtomicSet(0, &service->waitStats.numPolls);
+    osalAtomicSet(0, &service->waitStats.numSpins);
+    osalAtomicSet(0, &service->waitStats.numYields);
+    osalAtomicSet(0, &service->waitStats.numSleeps);
+    osalAtomicSet(0, &service->waitStats.numWakeups);
+
+    status = Sal_StringParsing(
+        prefix, service->instance, "HybridIdleThreshold", temp_string);
+    LAC_CHECK_STATUS(status);
+    if (CPA_STATUS_SUCCESS ==
+        icp_adf_cfgGetParamValue(device, section, temp_string, adfGetParam))
+    {
+        service->hybridIdleThreshold =
+            (Cpa32U)Sal_Strtoul(adfGetParam, NULL, SAL_CFG_BASE_DEC);
+    }
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Milliseconds on a clock that does not jump with the time of day */
+static Cpa64U SalCtrl_HybridNowMs(void)
+{
+#ifdef KERNEL_SPACE
+    return (Cpa64U)ktime_to_ms(ktime_get());
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (Cpa64U)ts.tv_sec * 1000 + (Cpa64U)ts.tv_nsec / 1000000;
+#endif
+}
+
+CpaStatus SalCtrl_HybridWait(sal_service_t *service,
+                             icp_comms_trans_handle *trans_hnd,
+                             Cpa32U num_transHandles,
+                             Cpa32U response_quota,
+                             Cpa32U timeout_ms)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    sal_wait_stats_t *pStats = &service->waitStats;
+    const Cpa64U deadline_ms = SalCtrl_HybridNowMs() + timeout_ms;
+    Cpa64U now_ms = 0;
+    Cpa32U idle = 0, spin = 0;
+    CpaBoolean woken = CPA_FALSE;
+
+    for (;;)
+    {
+        osalAtomicInc(&pStats->numPolls);
+        status =
+            icp_adf_pollInstance(trans_hnd, num_transHandles, response_quota);
+        if (CPA_STATUS_RETRY != status)
+        {
+            return status;
+        }
+
+        if (idle < SAL_HYBRID_SPIN_STEPS)
+        {
+            osalAtomicInc(&pStats->numSpins);
+            for (spin = 0; spin < (1U << idle); spin++)
+            {
+                SAL_CPU_RELAX();
+            }
+            idle++;
+            continue;
+        }
+        if (idle < service->hybridIdleThreshold)
+        {
+            osalAtomicInc(&pStats->numYields);
+            osalYield();
+            idle++;
+            continue;
+        }
+
+        now_ms = SalCtrl_HybridNowMs();
+        if (now_ms >= deadline_ms)
+        {
+            return CPA_STATUS_RETRY;
+        }
+
+        if (CPA_TRUE == woken)
+        {
+            /* The wait returned but there was nothing to poll. Either
+             * another thread is polling the rings, in which case the wait
+             * returns at once, or it took the responses first. Sleep a
+             * slice rather than go straight back to the wait and spin */
+            woken = CPA_FALSE;
+            osalSleep(SAL_HYBRID_NO_IRQ_SLEEP_MS);
+            continue;
+        }
+
+        /* Idle for long enough, block until the interrupt fires or the
+         * time left runs out. The idle count is kept so a spurious wake up
+         * goes straight back to sleep */
+        osalAtomicInc(&pStats->numSleeps);
+        status = icp_adf_waitInstance(
+            trans_hnd, num_transHandles, (Cpa32U)(deadline_ms - now_ms));
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            osalAtomicInc(&pStats->numWakeups);
+            woken = CPA_TRUE;
+        }
+        else if (CPA_STATUS_UNSUPPORTED == status)
+        {
+            /* No interrupt behind the rings, sleep in short slices */
+            osalSleep(SAL_HYBRID_NO_IRQ_SLEEP_MS);
+        }
+        else
+        {
+            return status;
+        }
+    }
+}
+
+void SalCtrl_HybridWaitStatsGet(sal_service_t *service,
+                                icp_sal_wait_stats_t *pWaitStats)
+{
+    sal_wait_stats_t *pStats = &service->waitStats;
+
+    pWaitStats->numPolls = (Cpa64U)osalAtomicGet(&pStats->numPolls);
+    pWaitStats->numSpins = (Cpa64U)osalAtomicGet(&pStats->numSpins);
+    pWaitStats->numYields = (Cpa64U)osalAtomicGet(&pStats->numYields);
+    pWaitStats->numSleeps = (Cpa64U)osalAtomicGet(&pStats->numSleeps);
+    pWaitStats->numWakeups = (Cpa64U)osalAtomicGet(&pStats->numWakeups);
+}
@@ -177,6 +177,7 @@
 
 #define SAL_RESP_POLL_CFG_FILE 1
 #define SAL_RESP_EPOLL_CFG_FILE 2
+#define SAL_RESP_HYBRID_CFG_FILE 3
 
 /*
  * @ingroup LacCommon
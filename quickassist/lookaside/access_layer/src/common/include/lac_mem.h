@@ -638,4 +638,30 @@ CpaStatus icp_LacBufferRestore(Cpa8U *pUserBuffer,
  ******************************************************************************/
 CpaPhysicalAddr SalMem_virt2PhysExternal(void *pVirtAddr, void *pServiceGen);
 
+/**
+ *******************************************************************************
+ * @ingroup LacMem
+ *    Converts an array of virtual addresses to physical addresses.
+ *
+ * @description
+ *    Same as SalMem_virt2PhysExternal for a number of addresses. When the
+ *    client has not set a virt2phys function for the instance, user space
+ *    converts the whole array with a single call to the memory driver.
+ *
+ * @param[in] pVirtAddr         array of virtual addresses to be converted
+ * @param[out] pPhysAddr        array receiving the physical addresses
+ * @param[in] numAddr           number of addresses to convert
+ * @param[in] pServiceGen       Pointer on the sal_service_t structure
+ *                              so client supplied virt2phys function can be
+ *                              called.
+ *
+ * @retval CPA_STATUS_SUCCESS   all addresses were converted
+ * @retval CPA_STATUS_FAIL      an address could not be converted
+ *
+ ******************************************************************************/
+CpaStatus SalMem_virt2PhysExternalBatch(void *pVirtAddr[],
+                                        Cpa64U pPhysAddr[],
+                                        Cpa32U numAddr,
+                                        void *pServiceGen);
+
 #endif /* LAC_MEM_H */
@@ -193,6 +193,7 @@ CpaStatus Lac_MemPoolCreate(lac_memory_pool_id_t *poolID,
  * the pool indetifier will be freed and assigned to NULL. It is the
  * responsibility of the pool creators to return all memory before a destroy or
  * memory will be leaked.
+ * Blocks cached in the magazines of any thread are returned to the pool first.
  *
  * @blocking
  *      Yes
@@ -212,6 +213,11 @@ void Lac_MemPoolDestroy(lac_memory_pool_id_t poolID);
  * This function allocates a block from the pool which has been previously
  * created. It does not check the validity of the pool Id prior to accessing the
  * pool. It is up to the calling code to ensure the value is correct.
+ * In user space, pools large enough give each thread a small magazine of
+ * free blocks, refilled from and flushed to the pool in batches, so that
+ * most allocations and frees do not touch the shared pool. The magazines
+ * together hold at most half of the pool; threads beyond that use the pool
+ * directly.
  *
  * @blocking
  *      Yes
@@ -74,6 +74,9 @@
 #ifndef LAC_SAL_CTRL_H
 #define LAC_SAL_CTRL_H
 
+#include "icp_adf_transport.h"
+#include "lac_sal_types.h"
+
 /*******************************************************************
  * @ingroup SalCtrl
  * @description
@@ -157,4 +160,77 @@ CpaStatus SalCtrl_AdfServicesRegister(void);
  ******************************************************************/
 CpaStatus SalCtrl_AdfServicesUnregister(void);
 
+/*******************************************************************
+ * @ingroup SalCtrl
+ * @description
+ *    This function reads the <prefix><n>HybridIdleThreshold key of a
+ *    hybrid instance. The key is optional.
+ *
+ * @context
+ *      This function is called from the service init functions
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ ******************************************************************/
+CpaStatus SalCtrl_HybridPollInit(icp_accel_dev_t *device,
+                                 sal_service_t *service,
+                                 char *section,
+                                 char *prefix);
+
+/*******************************************************************
+ * @ingroup SalCtrl
+ * @description
+ *    This function polls the response rings of a hybrid instance,
+ *    backing off with spins, then yields, then by blocking on the
+ *    ring interrupt once the idle threshold is reached.
+ *
+ * @context
+ *      This function is called from icp_sal_CyWaitInstance and
+ *      icp_sal_DcWaitInstance
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      Updates the wait counters of the service
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ ******************************************************************/
+CpaStatus SalCtrl_HybridWait(sal_service_t *service,
+                             icp_comms_trans_handle *trans_hnd,
+                             Cpa32U num_transHandles,
+                             Cpa32U response_quota,
+                             Cpa32U timeout_ms);
+
+/*******************************************************************
+ * @ingroup SalCtrl
+ * @description
+ *    This function copies the wait counters of a hybrid instance.
+ *
+ * @context
+ *      This function is called from icp_sal_CyGetWaitStats and
+ *      icp_sal_DcGetWaitStats
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      Yes
+ * @threadSafe
+ *      Yes
+ *
+ ******************************************************************/
+void SalCtrl_HybridWaitStatsGet(sal_service_t *service,
+                                icp_sal_wait_stats_t *pWaitStats);
+
 #endif
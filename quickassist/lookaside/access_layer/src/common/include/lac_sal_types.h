@@ -79,6 +79,7 @@
 #include "icp_accel_devices.h"
 #include "sal_statistics.h"
 #include "icp_adf_debug.h"
+#include "icp_sal_poll.h"
 
 #define SAL_CFG_BASE_DEC 10
 #define SAL_CFG_BASE_HEX 16
@@ -104,6 +105,25 @@ typedef enum sal_service_state_s
     SAL_SERVICE_STATE_END
 } sal_service_state_t;
 
+/**
+ *****************************************************************************
+ * @ingroup SalCtrl
+ *      Adaptive wait counters
+ *
+ * @description
+ *      The counters of icp_sal_wait_stats_t, kept as atomics since several
+ *      threads may wait on the same hybrid instance.
+ *
+ *****************************************************************************/
+typedef struct sal_wait_stats_s
+{
+    OsalAtomic numPolls;
+    OsalAtomic numSpins;
+    OsalAtomic numYields;
+    OsalAtomic numSleeps;
+    OsalAtomic numWakeups;
+} sal_wait_stats_t;
+
 /**
  *****************************************************************************
  * @ingroup SalCtrl
@@ -187,6 +207,12 @@ typedef struct sal_service_s
 
     CpaBoolean isInstanceStarted;
     /**< True if user called StartInstance on this instance */
+
+    Cpa32U hybridIdleThreshold;
+    /**< Empty polls before a hybrid instance blocks on its interrupt */
+
+    sal_wait_stats_t waitStats;
+    /**< Adaptive wait counters of a hybrid instance */
 } sal_service_t;
 /* clang-format on */
 
@@ -83,6 +83,7 @@
 #include "lac_sal_types.h"
 #include "icp_adf_transport.h"
 #include "lac_mem_pools.h"
+#include "lac_stats.h"
 
 #define LAC_PKE_FLOW_ID_TAG 0xFFFFFFFC
 #define LAC_PKE_ACCEL_ID_BIT_POS 1
@@ -112,34 +113,36 @@ typedef struct sal_crypto_service_s
     /**< Memory pool ID used for asymmetric operations */
     lac_memory_pool_id_t lac_pke_align_pool;
     /**< Memory pool ID used for asymmetric operations */
+    lac_memory_pool_id_t lac_pke_arena_pool;
+    /**< Memory pool ID of the operand arenas of asymmetric requests */
     lac_memory_pool_id_t lac_kpt_pool;
     /**< Memory pool ID used for asymmetric kpt operations */
     lac_memory_pool_id_t lac_kpt_array_pool;
     /**< Memory pool ID used for asymmetric kpt operations */
 
-    OsalAtomic *pLacSymStatsArr;
-    /**< pointer to an array of atomic stats for symmetric */
+    lac_stats_t lacSymStats;
+    /**< sharded stats for symmetric */
 
     OsalAtomic *pLacKeyStats;
     /**< pointer to an array of atomic stats for key */
 
-    OsalAtomic *pLacDhStatsArr;
-    /**< pointer to an array of atomic stats for DH */
+    lac_stats_t lacDhStats;
+    /**< sharded stats for DH */
 
     OsalAtomic *pLacDsaStatsArr;
     /**< pointer to an array of atomic stats for Dsa */
 
-    OsalAtomic *pLacRsaStatsArr;
-    /**< pointer to an array of atomic stats for Rsa */
+    lac_stats_t lacRsaStats;
+    /**< sharded stats for Rsa */
 
-    OsalAtomic *pLacEcStatsArr;
-    /**< pointer to an array of atomic stats for Ecc */
+    lac_stats_t lacEcStats;
+    /**< sharded stats for Ecc */
 
-    OsalAtomic *pLacEcdhStatsArr;
-    /**< pointer to an array of atomic stats for Ecc DH */
+    lac_stats_t lacEcdhStats;
+    /**< sharded stats for Ecc DH */
 
-    OsalAtomic *pLacEcdsaStatsArr;
-    /**< pointer to an array of atomic stats for Ecc DSA */
+    lac_stats_t lacEcdsaStats;
+    /**< sharded stats for Ecc DSA */
 
     OsalAtomic *pLacPrimeStatsArr;
     /**< pointer to an array of atomic stats for prime */
@@ -149,6 +152,14 @@ typedef struct sal_crypto_service_s
 
     OsalAtomic *pLacDrbgStatsArr;
     /**< pointer to an array of atomic stats for DRBG */
+
+    lac_stats_t lacPkeResizeStats;
+    /**< sharded stats for the PKE operand marshalling */
+    lac_stats_t lacPkeProfileStats;
+    /**< sharded host cycle histograms of the PKE request path, only
+     * allocated when built with ICP_PKE_PROFILE */
+    CpaBoolean asymPrePaddedOperands;
+    /**< Config Info - PKE operands must be passed at the operand size */
     OsalAtomic kpt_keyhandle_loaded;
     /**< total number of kpt key handle that has been loaded into CPM */
     Cpa32U maxNumKptKeyHandle;
@@ -172,6 +183,8 @@ typedef struct sal_crypto_service_s
     Cpa16U bankNum;
     Cpa16U pkgID;
     Cpa8U isPolled;
+    Cpa8U isExclusiveOwner;
+    /**< Rings are only used by a single thread, no ring locking */
     Cpa8U executionEngine;
     Cpa32U coreAffinity;
     Cpa32U nodeAffinity;
@@ -190,6 +203,25 @@ typedef struct sal_crypto_service_s
     Cpa8U **ppHmacContentDesc;
     /**< table of pointers to CD for Hmac precomputes - used at session init */
 
+    struct lac_sym_hash_precomp_cache_s *pHashPrecompCache;
+    /**< cache of precompute results keyed by algorithm and key, NULL when
+     * disabled */
+    Cpa32U hashPrecompCacheSize;
+    /**< Config Info - number of entries in the precompute cache */
+
+    struct lac_sym_host_s *pSymHost;
+    /**< host execution of sym requests when the ring is busy, NULL when
+     * disabled */
+    Cpa32U symHostFallback;
+    /**< Config Info - host execution policy, see lac_sym_host.h */
+    Cpa32U symHostFallbackThreshold;
+    /**< Config Info - requests in flight above which the ring is busy */
+    Cpa32U symHostFallbackMaxSize;
+    /**< Config Info - largest request executed on the host, in bytes */
+
+    struct lac_ec_named_curve_s *pEcNamedCurves;
+    /**< parameters of the named curves, indexed by icp_sal_ec_curve_t */
+
     Cpa8U *pSslLabel;
     /**< pointer to memory holding the standard SSL label ABBCCC.. */
 
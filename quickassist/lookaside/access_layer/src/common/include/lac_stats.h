@@ -0,0 +1,252 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file lac_stats.h
+ *
+ * @defgroup LacStats     Sharded statistics counters
+ *
+ * @ingroup LacCommon
+ *
+ * Service statistics counters spread over several cache line aligned
+ * shards. Each thread increments the copy of a counter held in its own
+ * shard, so threads submitting on the same instance do not bounce one
+ * cache line between cores. In kernel space the counters are per CPU
+ * instead. The shards are summed when the statistics are queried, which
+ * gives the same totals as a single array of atomics.
+ *
+ ***************************************************************************/
+
+#ifndef LAC_STATS_H
+#define LAC_STATS_H
+
+#include "cpa.h"
+#include "Osal.h"
+#include "lac_common.h"
+
+#ifdef KERNEL_SPACE
+#include <linux/percpu.h>
+#else
+#include <pthread.h>
+#endif
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *      Number of counter shards per statistics object in user space
+ *
+ * @description
+ *      Must be a power of two.
+ *
+ *****************************************************************************/
+#define LAC_STATS_NUM_SHARDS 16
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *      Sharded statistics object
+ *
+ * @description
+ *      Holds LAC_STATS_NUM_SHARDS copies of numStats atomic counters. Each
+ *      shard starts on its own cache line. In kernel space it holds one
+ *      copy of the counters per possible CPU.
+ *
+ *****************************************************************************/
+typedef struct lac_stats_s
+{
+#ifdef KERNEL_SPACE
+    Cpa64U __percpu *pCounters;
+    /**< Per CPU counters */
+#else
+    OsalAtomic *pCounters;
+    /**< First shard, cache line aligned */
+#endif
+    Cpa32U numStats;
+    /**< Number of counters in each shard */
+#ifndef KERNEL_SPACE
+    Cpa32U shardStride;
+    /**< Distance in counters between two shards */
+    void *pAllocated;
+    /**< Start of the allocation, used to free the counters */
+#endif
+} lac_stats_t;
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *      Allocate and zero a sharded statistics object
+ *
+ * @param[out] pStats        Statistics object to initialise
+ * @param[in] numStats       Number of counters
+ *
+ * @retval CPA_STATUS_SUCCESS      Counters allocated
+ * @retval CPA_STATUS_RESOURCE     Allocation failed
+ *
+ *****************************************************************************/
+CpaStatus LacStats_Init(lac_stats_t *pStats, Cpa32U numStats);
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *      Free the counters of a statistics object
+ *
+ * @description
+ *      Safe to call on an object that was never initialised, as long as it
+ *      was zeroed.
+ *
+ * @param[in] pStats         Statistics object
+ *
+ *****************************************************************************/
+void LacStats_Free(lac_stats_t *pStats);
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *      Sum one counter over all shards
+ *
+ * @param[in] pStats         Statistics object
+ * @param[in] index          Counter index
+ *
+ * @return Current value of the counter
+ *
+ *****************************************************************************/
+Cpa64U LacStats_Get(lac_stats_t *pStats, Cpa32U index);
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *      Set every counter of every shard to zero
+ *
+ * @param[in] pStats         Statistics object
+ *
+ *****************************************************************************/
+void LacStats_Reset(lac_stats_t *pStats);
+
+#ifndef KERNEL_SPACE
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *      Shard used by the calling thread
+ *
+ * @description
+ *      Threads are spread over the shards by a multiplicative hash of
+ *      their thread handle. Two threads may share a shard; the counters
+ *      stay atomic so this only costs some contention, never a count.
+ *
+ *****************************************************************************/
+static inline Cpa32U LacStats_ShardGet(void)
+{
+    Cpa64U self = (Cpa64U)(LAC_ARCH_UINT)pthread_self();
+
+    return (Cpa32U)((self * 0x9E3779B97F4A7C15ULL) >> 32) &
+           (LAC_STATS_NUM_SHARDS - 1);
+}
+#endif
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *      Increment one counter in the calling thread's shard
+ *
+ * @description
+ *      In kernel space the counter of the current CPU is incremented. The
+ *      this_cpu operation is safe against preemption and interrupts, so no
+ *      other CPU ever writes the same counter.
+ *
+ * @param[in] pStats         Statistics object
+ * @param[in] index          Counter index
+ *
+ *****************************************************************************/
+static inline void LacStats_Inc(lac_stats_t *pStats, Cpa32U index)
+{
+#ifdef KERNEL_SPACE
+    this_cpu_inc(pStats->pCounters[index]);
+#else
+    osalAtomicInc(
+        &pStats->pCounters[LacStats_ShardGet() * pStats->shardStride + index]);
+#endif
+}
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *      Add a value to one counter in the calling thread's shard
+ * @param[in] pStats         Statistics object
+ * @param[in] index          Counter index
+ * @param[in] value          Value to add
+ *****************************************************************************/
+static inline void LacStats_Add(lac_stats_t *pStats,
+                                Cpa32U index,
+                                Cpa64U value)
+{
+#ifdef KERNEL_SPACE
+    this_cpu_add(pStats->pCounters[index], value);
+#else
+    osalAtomicAdd(
+        (INT64)value,
+        &pStats->pCounters[LacStats_ShardGet() * pStats->shardStride + index]);
+#endif
+}
+
+#endif /* LAC_STATS_H */
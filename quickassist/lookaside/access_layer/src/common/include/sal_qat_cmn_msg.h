@@ -252,6 +252,31 @@ CpaStatus SalQatMsg_transPutMsg(icp_comms_trans_handle trans_handle,
                                 Cpa32U size_in_lws,
                                 Cpa8U service);
 
+/********************************************************************
+ * @ingroup SalQatMsg_transPutMsgs
+ *
+ * @description
+ *      Sends a burst of messages with a single ring tail update. The
+ *      number of messages accepted by the ring is returned in pnum_sent.
+ *
+ * @param[in]   trans_handle
+ * @param[in]   ppqat_msgs
+ * @param[in]   size_in_lws
+ * @param[in]   num_msgs
+ * @param[out]  pnum_sent
+ * @param[in]   service
+ *
+ * @return
+ *      CpaStatus
+ *
+ *****************************************/
+CpaStatus SalQatMsg_transPutMsgs(icp_comms_trans_handle trans_handle,
+                                 void **ppqat_msgs,
+                                 Cpa32U size_in_lws,
+                                 Cpa32U num_msgs,
+                                 Cpa32U *pnum_sent,
+                                 Cpa8U service);
+
 /********************************************************************
  * @ingroup SalQatMsg_updateQueueTail
  *
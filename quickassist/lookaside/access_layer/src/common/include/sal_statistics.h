@@ -112,6 +112,7 @@
 #define SAL_STATS_ECC 8
 #define SAL_STATS_ECDH 9
 #define SAL_STATS_ECDSA 10
+#define SAL_STATS_DRBG 11
 /**< Numeric values for crypto statistics */
 
 #define SAL_STATISTICS_STRING_OFF "0"
@@ -134,6 +135,8 @@ typedef struct sal_statistics_collection_s
     /**< If CPA_TRUE then Compression statistics are enabled */
     CpaBoolean bDhStatsEnabled;
     /**< If CPA_TRUE then Diffie-Helman statistics are enabled */
+    CpaBoolean bDrbgStatsEnabled;
+    /**< If CPA_TRUE then DRBG statistics are enabled */
     CpaBoolean bDsaStatsEnabled;
     /**< If CPA_TRUE then DSA statistics are enabled */
     CpaBoolean bEccStatsEnabled;
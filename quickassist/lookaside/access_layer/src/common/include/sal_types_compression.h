@@ -80,6 +80,7 @@
 #include "icp_buffer_desc.h"
 
 #include "lac_mem_pools.h"
+#include "lac_stats.h"
 #include "icp_adf_transport.h"
 #include "lac_sym_qat_hash_defs_lookup.h"
 #include "lac_sym_qat_constants_table.h"
@@ -180,8 +181,8 @@ typedef struct sal_compression_service_s
     /* Memory pool ID used for compression */
     lac_memory_pool_id_t compression_mem_pool;
 
-    /* Pointer to an array of atomic stats for compression */
-    OsalAtomic *pCompStatsArr;
+    /* Sharded stats for compression */
+    lac_stats_t compressionStats;
 
     /* Size of the DRAM intermediate buffer in bytes */
     Cpa64U minInterBuffSizeInBytes;
@@ -207,6 +208,7 @@ typedef struct sal_compression_service_s
     Cpa16U bankNum;
     Cpa16U pkgID;
     Cpa16U isPolled;
+    Cpa16U isExclusiveOwner;
     Cpa32U coreAffinity;
     Cpa32U nodeAffinity;
 
@@ -277,6 +277,36 @@ CpaStatus SalQatMsg_transPutMsg(icp_comms_trans_handle trans_handle,
 #endif
 }
 
+/********************************************************************
+ * @ingroup SalQatMsg_transPutMsgs
+ *
+ * @description
+ *
+ *
+ * @param[in]   trans_handle
+ * @param[in]   ppqat_msgs
+ * @param[in]   size_in_lws
+ * @param[in]   num_msgs
+ * @param[out]  pnum_sent
+ * @param[in]   service
+ *
+ * @return
+ *      CpaStatus
+ *
+ *****************************************/
+CpaStatus SalQatMsg_transPutMsgs(icp_comms_trans_handle trans_handle,
+                                 void **ppqat_msgs,
+                                 Cpa32U size_in_lws,
+                                 Cpa32U num_msgs,
+                                 Cpa32U *pnum_sent,
+                                 Cpa8U service)
+{
+#ifndef MSG_DEBUG
+    return icp_adf_transPutMsgs(
+        trans_handle, (Cpa32U **)ppqat_msgs, size_in_lws, num_msgs, pnum_sent);
+#endif
+}
+
 void SalQatMsg_updateQueueTail(icp_comms_trans_handle trans_handle)
 {
 #ifndef MSG_DEBUG
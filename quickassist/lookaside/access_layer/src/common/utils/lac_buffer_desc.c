@@ -85,6 +85,7 @@
 #include "lac_mem.h"
 #include "cpa_cy_common.h"
 #include "dc_session.h"
+#include "icp_sal.h"
 
 /*
 *******************************************************************************
@@ -94,6 +95,203 @@
 /* Invalid physical address value */
 #define INVALID_PHYSICAL_ADDRESS 0
 
+/* Number of client buffer addresses converted to physical ones at once */
+#define LAC_BUFF_DESC_V2P_BATCH 16
+
+/* Writes the physical addresses of the client buffers to the flat buffer
+ * descriptors, the addresses are converted in batches */
+static CpaStatus LacBuffDesc_FlatBufferDescPhysWrite(
+    const CpaFlatBuffer *pClientFlatBuffer,
+    icp_flat_buffer_desc_t *pFlatBufDesc,
+    Cpa32U numBuffers,
+    sal_service_t *pService)
+{
+    void *virtAddr[LAC_BUFF_DESC_V2P_BATCH];
+    Cpa64U physAddr[LAC_BUFF_DESC_V2P_BATCH];
+    Cpa32U batchSize = 0;
+    Cpa32U i = 0;
+
+    while (0 != numBuffers)
+    {
+        batchSize = (numBuffers < LAC_BUFF_DESC_V2P_BATCH)
+                        ? numBuffers
+                        : LAC_BUFF_DESC_V2P_BATCH;
+
+        for (i = 0; i < batchSize; i++)
+        {
+            virtAddr[i] = pClientFlatBuffer[i].pData;
+        }
+
+        if (CPA_STATUS_SUCCESS !=
+            SalMem_virt2PhysExternalBatch(
+                virtAddr, physAddr, batchSize, pService))
+        {
+            LAC_LOG_ERROR("Unable to get the physical address of the "
+                          "client buffer\n");
+            return CPA_STATUS_FAIL;
+        }
+
+        for (i = 0; i < batchSize; i++)
+        {
+            pFlatBufDesc[i].phyBuffer = physAddr[i];
+        }
+
+        pClientFlatBuffer += batchSize;
+        pFlatBufDesc += batchSize;
+        numBuffers -= batchSize;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Registration state of a buffer list, kept in the reserved word of its
+ * firmware descriptor. The state is combined with the address of the
+ * CpaBufferList so metadata that was not registered for that list is
+ * never taken as registered. */
+#define LAC_BUFF_DESC_REG_VALID 0x52454756
+#define LAC_BUFF_DESC_REG_DIRTY 0x52454744
+#define LAC_BUFF_DESC_REG_TAG(pList, state)                                    \
+    ((Cpa32U)(LAC_ARCH_UINT)(pList) ^ (state))
+
+/* Record of a registered buffer list, pointed to by the resrvd word of its
+ * firmware descriptor. It holds the buffers the cached descriptor was
+ * built for, so a list whose buffers changed is rebuilt. */
+typedef struct lac_buff_desc_reg_s
+{
+    Cpa64U bufListAlignedPhyAddr;
+    /**< Physical address of the cached descriptor */
+    const CpaFlatBuffer *pBuffers;
+    /**< Flat buffer array the descriptor was built from */
+    Cpa32U numBuffers;
+    /**< Number of buffers the descriptor was built for */
+    Cpa32U maxBuffers;
+    /**< Number of entries in pData */
+    void *pData[];
+    /**< Buffer addresses the descriptor was built for */
+} lac_buff_desc_reg_t;
+
+#define LAC_BUFF_DESC_REG_GET(pBufferListDesc)                                 \
+    ((lac_buff_desc_reg_t *)(LAC_ARCH_UINT)(pBufferListDesc)->resrvd)
+
+/* Returns the descriptor in the metadata of a buffer list. The virtual and
+ * physical addresses of the metadata have the same offset within a page,
+ * so the aligned descriptor can be located without a translation. */
+static inline icp_buffer_list_desc_t *LacBuffDesc_RegisteredDescGet(
+    const CpaBufferList *pUserBufferList)
+{
+    return (icp_buffer_list_desc_t *)LAC_ALIGN_POW2_ROUNDUP(
+        (LAC_ARCH_UINT)pUserBufferList->pPrivateMetaData,
+        ICP_DESCRIPTOR_ALIGNMENT_BYTES);
+}
+
+static inline CpaBoolean LacBuffDesc_IsRegistered(
+    const CpaBufferList *pUserBufferList,
+    const icp_buffer_list_desc_t *pBufferListDesc)
+{
+    return (LAC_BUFF_DESC_REG_TAG(pUserBufferList, LAC_BUFF_DESC_REG_VALID) ==
+                pBufferListDesc->reserved ||
+            LAC_BUFF_DESC_REG_TAG(pUserBufferList, LAC_BUFF_DESC_REG_DIRTY) ==
+                pBufferListDesc->reserved)
+               ? CPA_TRUE
+               : CPA_FALSE;
+}
+
+/* Reuses the descriptor of a registered buffer list whose buffers are the
+ * ones it was built for. Only the buffer lengths are refreshed, the
+ * physical addresses of the buffers and of the descriptor are taken from
+ * the cache. Returns CPA_FALSE if the descriptor has to be built. */
+static CpaBoolean LacBuffDesc_RegisteredDescReuse(
+    const CpaBufferList *pUserBufferList,
+    Cpa64U *pBufListAlignedPhyAddr,
+    Cpa64U *pTotalDataLenInBytes)
+{
+    icp_buffer_list_desc_t *pBufferListDesc = NULL;
+    icp_flat_buffer_desc_t *pCurrFlatBufDesc = NULL;
+    const CpaFlatBuffer *pCurrClientFlatBuffer = NULL;
+    lac_buff_desc_reg_t *pReg = NULL;
+    Cpa32U numBuffers = pUserBufferList->numBuffers;
+    Cpa64U totalDataLenInBytes = 0;
+    Cpa32U i = 0;
+
+    pBufferListDesc = LacBuffDesc_RegisteredDescGet(pUserBufferList);
+    if (LAC_BUFF_DESC_REG_TAG(pUserBufferList, LAC_BUFF_DESC_REG_VALID) !=
+        pBufferListDesc->reserved)
+    {
+        return CPA_FALSE;
+    }
+
+    pReg = LAC_BUFF_DESC_REG_GET(pBufferListDesc);
+    if ((pUserBufferList->pBuffers != pReg->pBuffers) ||
+        (numBuffers != pReg->numBuffers))
+    {
+        return CPA_FALSE;
+    }
+
+    /* The addresses are checked before anything is written, so a list
+     * whose buffers moved is rebuilt from scratch */
+    pCurrClientFlatBuffer = pUserBufferList->pBuffers;
+    for (i = 0; i < numBuffers; i++)
+    {
+        if (pCurrClientFlatBuffer[i].pData != pReg->pData[i])
+        {
+            return CPA_FALSE;
+        }
+    }
+
+    pCurrFlatBufDesc = pBufferListDesc->phyBuffers;
+    while (0 != numBuffers)
+    {
+        pCurrFlatBufDesc->dataLenInBytes =
+            pCurrClientFlatBuffer->dataLenInBytes;
+        totalDataLenInBytes += pCurrClientFlatBuffer->dataLenInBytes;
+
+        pCurrFlatBufDesc++;
+        pCurrClientFlatBuffer++;
+        numBuffers--;
+    }
+
+    if (NULL != pTotalDataLenInBytes)
+    {
+        *pTotalDataLenInBytes = totalDataLenInBytes;
+    }
+    *pBufListAlignedPhyAddr = pReg->bufListAlignedPhyAddr;
+    return CPA_TRUE;
+}
+
+/* Records the buffers and the physical address of a freshly written
+ * descriptor if the buffer list is registered, so the next request can
+ * reuse it. A list that grew past the record is rebuilt every time. */
+static inline void LacBuffDesc_RegisteredDescArm(
+    const CpaBufferList *pUserBufferList,
+    icp_buffer_list_desc_t *pBufferListDesc,
+    Cpa64U bufListAlignedPhyAddr)
+{
+    lac_buff_desc_reg_t *pReg = NULL;
+    Cpa32U i = 0;
+
+    if (CPA_TRUE != LacBuffDesc_IsRegistered(pUserBufferList, pBufferListDesc))
+    {
+        return;
+    }
+
+    pReg = LAC_BUFF_DESC_REG_GET(pBufferListDesc);
+    if (pUserBufferList->numBuffers > pReg->maxBuffers)
+    {
+        pBufferListDesc->reserved =
+            LAC_BUFF_DESC_REG_TAG(pUserBufferList, LAC_BUFF_DESC_REG_DIRTY);
+        return;
+    }
+
+    for (i = 0; i < pUserBufferList->numBuffers; i++)
+    {
+        pReg->pData[i] = pUserBufferList->pBuffers[i].pData;
+    }
+    pReg->pBuffers = pUserBufferList->pBuffers;
+    pReg->numBuffers = pUserBufferList->numBuffers;
+    pReg->bufListAlignedPhyAddr = bufListAlignedPhyAddr;
+    pBufferListDesc->reserved =
+        LAC_BUFF_DESC_REG_TAG(pUserBufferList, LAC_BUFF_DESC_REG_VALID);
+}
+
 /* This function implements the buffer description writes for the traditional
  * APIs */
 CpaStatus LacBuffDesc_BufferListDescWrite(const CpaBufferList *pUserBufferList,
@@ -107,12 +305,20 @@ CpaStatus LacBuffDesc_BufferListDescWrite(const CpaBufferList *pUserBufferList,
     CpaFlatBuffer *pCurrClientFlatBuffer = NULL;
     icp_buffer_list_desc_t *pBufferListDesc = NULL;
     icp_flat_buffer_desc_t *pCurrFlatBufDesc = NULL;
+    icp_flat_buffer_desc_t *pFirstFlatBufDesc = NULL;
 
     LAC_ENSURE_NOT_NULL(pUserBufferList);
     LAC_ENSURE_NOT_NULL(pUserBufferList->pBuffers);
     LAC_ENSURE_NOT_NULL(pUserBufferList->pPrivateMetaData);
     LAC_ENSURE_NOT_NULL(pBufListAlignedPhyAddr);
 
+    if ((CPA_TRUE != isPhysicalAddress) &&
+        (CPA_TRUE == LacBuffDesc_RegisteredDescReuse(
+                         pUserBufferList, pBufListAlignedPhyAddr, NULL)))
+    {
+        return CPA_STATUS_SUCCESS;
+    }
+
     numBuffers = pUserBufferList->numBuffers;
     pCurrClientFlatBuffer = pUserBufferList->pBuffers;
 
@@ -140,6 +346,7 @@ CpaStatus LacBuffDesc_BufferListDescWrite(const CpaBufferList *pUserBufferList,
     /* Go past the Buffer List descriptor to the list of buffer descriptors */
     pCurrFlatBufDesc =
         (icp_flat_buffer_desc_t *)((pBufferListDesc->phyBuffers));
+    pFirstFlatBufDesc = pCurrFlatBufDesc;
 
     pBufferListDesc->numBuffers = numBuffers;
 
@@ -160,26 +367,13 @@ CpaStatus LacBuffDesc_BufferListDescWrite(const CpaBufferList *pUserBufferList,
         pCurrFlatBufDesc->dataLenInBytes =
             pCurrClientFlatBuffer->dataLenInBytes;
 
-        /* Check if providing a physical address in the function. If not we
-         * need to convert it to a physical one */
+        /* Check if providing a physical address in the function. If not it
+         * is converted to a physical one below */
         if (CPA_TRUE == isPhysicalAddress)
         {
             pCurrFlatBufDesc->phyBuffer = LAC_MEM_CAST_PTR_TO_UINT64(
                 (LAC_ARCH_UINT)(pCurrClientFlatBuffer->pData));
         }
-        else
-        {
-            pCurrFlatBufDesc->phyBuffer =
-                LAC_MEM_CAST_PTR_TO_UINT64(LAC_OS_VIRT_TO_PHYS_EXTERNAL(
-                    (*pService), pCurrClientFlatBuffer->pData));
-
-            if (INVALID_PHYSICAL_ADDRESS == pCurrFlatBufDesc->phyBuffer)
-            {
-                LAC_LOG_ERROR("Unable to get the physical address of the "
-                              "client buffer\n");
-                return CPA_STATUS_FAIL;
-            }
-        }
 
         pCurrFlatBufDesc++;
         pCurrClientFlatBuffer++;
@@ -187,6 +381,21 @@ CpaStatus LacBuffDesc_BufferListDescWrite(const CpaBufferList *pUserBufferList,
         numBuffers--;
     }
 
+    if (CPA_TRUE != isPhysicalAddress)
+    {
+        if (CPA_STATUS_SUCCESS !=
+            LacBuffDesc_FlatBufferDescPhysWrite(pUserBufferList->pBuffers,
+                                                pFirstFlatBufDesc,
+                                                pUserBufferList->numBuffers,
+                                                pService))
+        {
+            return CPA_STATUS_FAIL;
+        }
+
+        LacBuffDesc_RegisteredDescArm(
+            pUserBufferList, pBufferListDesc, bufListAlignedPhyAddr);
+    }
+
     *pBufListAlignedPhyAddr = bufListAlignedPhyAddr;
     return CPA_STATUS_SUCCESS;
 }
@@ -206,6 +415,7 @@ CpaStatus LacBuffDesc_BufferListDescWriteAndGetSize(
     CpaFlatBuffer *pCurrClientFlatBuffer = NULL;
     icp_buffer_list_desc_t *pBufferListDesc = NULL;
     icp_flat_buffer_desc_t *pCurrFlatBufDesc = NULL;
+    icp_flat_buffer_desc_t *pFirstFlatBufDesc = NULL;
     *totalDataLenInBytes = 0;
 
     LAC_ENSURE_NOT_NULL(pUserBufferList);
@@ -213,6 +423,14 @@ CpaStatus LacBuffDesc_BufferListDescWriteAndGetSize(
     LAC_ENSURE_NOT_NULL(pUserBufferList->pPrivateMetaData);
     LAC_ENSURE_NOT_NULL(pBufListAlignedPhyAddr);
 
+    if ((CPA_TRUE != isPhysicalAddress) &&
+        (CPA_TRUE ==
+         LacBuffDesc_RegisteredDescReuse(
+             pUserBufferList, pBufListAlignedPhyAddr, totalDataLenInBytes)))
+    {
+        return CPA_STATUS_SUCCESS;
+    }
+
     numBuffers = pUserBufferList->numBuffers;
     pCurrClientFlatBuffer = pUserBufferList->pBuffers;
 
@@ -240,6 +458,7 @@ CpaStatus LacBuffDesc_BufferListDescWriteAndGetSize(
     /* Go past the Buffer List descriptor to the list of buffer descriptors */
     pCurrFlatBufDesc =
         (icp_flat_buffer_desc_t *)((pBufferListDesc->phyBuffers));
+    pFirstFlatBufDesc = pCurrFlatBufDesc;
 
     pBufferListDesc->numBuffers = numBuffers;
 
@@ -256,19 +475,6 @@ CpaStatus LacBuffDesc_BufferListDescWriteAndGetSize(
             pCurrFlatBufDesc->phyBuffer = LAC_MEM_CAST_PTR_TO_UINT64(
                 (LAC_ARCH_UINT)(pCurrClientFlatBuffer->pData));
         }
-        else
-        {
-            pCurrFlatBufDesc->phyBuffer =
-                LAC_MEM_CAST_PTR_TO_UINT64(LAC_OS_VIRT_TO_PHYS_EXTERNAL(
-                    (*pService), pCurrClientFlatBuffer->pData));
-
-            if (INVALID_PHYSICAL_ADDRESS == pCurrFlatBufDesc->phyBuffer)
-            {
-                LAC_LOG_ERROR("Unable to get the physical address of the "
-                              "client buffer\n");
-                return CPA_STATUS_FAIL;
-            }
-        }
 
         pCurrFlatBufDesc++;
         pCurrClientFlatBuffer++;
@@ -276,6 +482,21 @@ CpaStatus LacBuffDesc_BufferListDescWriteAndGetSize(
         numBuffers--;
     }
 
+    if (isPhysicalAddress != CPA_TRUE)
+    {
+        if (CPA_STATUS_SUCCESS !=
+            LacBuffDesc_FlatBufferDescPhysWrite(pUserBufferList->pBuffers,
+                                                pFirstFlatBufDesc,
+                                                pUserBufferList->numBuffers,
+                                                pService))
+        {
+            return CPA_STATUS_FAIL;
+        }
+
+        LacBuffDesc_RegisteredDescArm(
+            pUserBufferList, pBufferListDesc, bufListAlignedPhyAddr);
+    }
+
     *pBufListAlignedPhyAddr = bufListAlignedPhyAddr;
     return CPA_STATUS_SUCCESS;
 }
@@ -511,3 +732,104 @@ void LacBuffDesc_BufferListZeroFromOffset(CpaBufferList *pBuffList,
 
     } /* end while */
 }
+
+CpaStatus icp_sal_BufferListRegister(const CpaInstanceHandle instanceHandle,
+                                     CpaBufferList *pBufferList)
+{
+    icp_buffer_list_desc_t *pBufferListDesc = NULL;
+    lac_buff_desc_reg_t *pReg = NULL;
+    Cpa64U bufListAlignedPhyAddr = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+#ifdef ICP_PARAM_CHECK
+    LAC_CHECK_INSTANCE_HANDLE(instanceHandle);
+    SAL_CHECK_INSTANCE_TYPE(instanceHandle,
+                            (SAL_SERVICE_TYPE_CRYPTO |
+                             SAL_SERVICE_TYPE_CRYPTO_SYM |
+                             SAL_SERVICE_TYPE_COMPRESSION));
+    LAC_CHECK_NULL_PARAM(pBufferList);
+    LAC_CHECK_NULL_PARAM(pBufferList->pBuffers);
+    LAC_CHECK_NULL_PARAM(pBufferList->pPrivateMetaData);
+    if (0 == pBufferList->numBuffers)
+    {
+        LAC_INVALID_PARAM_LOG("Number of Buffers");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+#endif
+
+    pBufferListDesc = LacBuffDesc_RegisteredDescGet(pBufferList);
+    if (CPA_TRUE == LacBuffDesc_IsRegistered(pBufferList, pBufferListDesc))
+    {
+        LAC_INVALID_PARAM_LOG("Buffer list already registered");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    status = LAC_OS_MALLOC(&pReg,
+                           sizeof(lac_buff_desc_reg_t) +
+                               pBufferList->numBuffers * sizeof(void *));
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return CPA_STATUS_RESOURCE;
+    }
+    pReg->numBuffers = 0;
+    pReg->maxBuffers = pBufferList->numBuffers;
+
+    /* Registered but without a valid descriptor yet: the write below
+     * builds the descriptor and arms it */
+    pBufferListDesc->resrvd = (Cpa64U)(LAC_ARCH_UINT)pReg;
+    pBufferListDesc->reserved =
+        LAC_BUFF_DESC_REG_TAG(pBufferList, LAC_BUFF_DESC_REG_DIRTY);
+
+    status = LacBuffDesc_BufferListDescWrite(pBufferList,
+                                             &bufListAlignedPhyAddr,
+                                             CPA_FALSE,
+                                             (sal_service_t *)instanceHandle);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        pBufferListDesc->reserved = 0;
+        pBufferListDesc->resrvd = 0;
+        LAC_OS_FREE(pReg);
+    }
+    return status;
+}
+
+CpaStatus icp_sal_BufferListInvalidate(CpaBufferList *pBufferList)
+{
+    icp_buffer_list_desc_t *pBufferListDesc = NULL;
+
+    LAC_CHECK_NULL_PARAM(pBufferList);
+    LAC_CHECK_NULL_PARAM(pBufferList->pPrivateMetaData);
+
+    pBufferListDesc = LacBuffDesc_RegisteredDescGet(pBufferList);
+    if (CPA_TRUE != LacBuffDesc_IsRegistered(pBufferList, pBufferListDesc))
+    {
+        LAC_INVALID_PARAM_LOG("Buffer list not registered");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    pBufferListDesc->reserved =
+        LAC_BUFF_DESC_REG_TAG(pBufferList, LAC_BUFF_DESC_REG_DIRTY);
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus icp_sal_BufferListDeregister(CpaBufferList *pBufferList)
+{
+    icp_buffer_list_desc_t *pBufferListDesc = NULL;
+    lac_buff_desc_reg_t *pReg = NULL;
+
+    LAC_CHECK_NULL_PARAM(pBufferList);
+    LAC_CHECK_NULL_PARAM(pBufferList->pPrivateMetaData);
+
+    pBufferListDesc = LacBuffDesc_RegisteredDescGet(pBufferList);
+    if (CPA_TRUE != LacBuffDesc_IsRegistered(pBufferList, pBufferListDesc))
+    {
+        LAC_INVALID_PARAM_LOG("Buffer list not registered");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    pReg = LAC_BUFF_DESC_REG_GET(pBufferListDesc);
+    pBufferListDesc->reserved = 0;
+    pBufferListDesc->resrvd = 0;
+    LAC_OS_FREE(pReg);
+    return CPA_STATUS_SUCCESS;
+}
@@ -144,6 +144,58 @@ static inline void push(lock_free_stack_t *stack, lac_mem_blk_t *val)
         &stack->top.atomic, old_top.atomic, new_top.atomic));
 }
 
+/* Pops up to num blocks with a single CAS. The blocks are walked before
+ * the CAS, which is safe as a block's pNext is always NULL or another
+ * block of the pool; any concurrent change to the stack bumps the counter
+ * and makes the CAS fail. Returns the number of blocks popped. */
+static inline unsigned int pop_list(lock_free_stack_t *stack,
+                                    lac_mem_blk_t **blks,
+                                    unsigned int num)
+{
+    pointer_t old_top;
+    pointer_t new_top;
+    lac_mem_blk_t *next;
+    unsigned int i;
+
+    do
+    {
+        old_top.atomic = stack->top.atomic;
+        next = PTR(old_top.ptr);
+        for (i = 0; i < num && NULL != next; i++)
+        {
+            blks[i] = next;
+            next = next->pNext;
+        }
+        if (0 == i)
+            return 0;
+
+        new_top.ptr = (uintptr_t)next;
+        new_top.ctr = old_top.ctr + 1;
+    } while (!__sync_bool_compare_and_swap(
+        &stack->top.atomic, old_top.atomic, new_top.atomic));
+
+    return i;
+}
+
+/* Pushes a chain of blocks, already linked from first to last, with a
+ * single CAS */
+static inline void push_list(lock_free_stack_t *stack,
+                             lac_mem_blk_t *first,
+                             lac_mem_blk_t *last)
+{
+    pointer_t new_top;
+    pointer_t old_top;
+
+    do
+    {
+        old_top.atomic = stack->top.atomic;
+        last->pNext = PTR(old_top.ptr);
+        new_top.ptr = (uintptr_t)first;
+        new_top.ctr = old_top.ctr + 1;
+    } while (!__sync_bool_compare_and_swap(
+        &stack->top.atomic, old_top.atomic, new_top.atomic));
+}
+
 static inline lock_free_stack_t _init_stack(void)
 {
     lock_free_stack_t stack = {{{0}}};
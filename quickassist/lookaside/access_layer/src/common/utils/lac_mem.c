@@ -237,6 +237,33 @@ CpaPhysicalAddr SalMem_virt2PhysExternal(void *pVirtAddr, void *pServiceGen)
     }
 }
 
+CpaStatus SalMem_virt2PhysExternalBatch(void *pVirtAddr[],
+                                        Cpa64U pPhysAddr[],
+                                        Cpa32U numAddr,
+                                        void *pServiceGen)
+{
+    sal_service_t *pService = (sal_service_t *)pServiceGen;
+    Cpa32U i = 0;
+
+#ifdef USER_SPACE
+    if (NULL == pService->virt2PhysClient)
+    {
+        return (0 == qaeVirtToPhysNUMABatch(pVirtAddr, pPhysAddr, numAddr))
+                   ? CPA_STATUS_SUCCESS
+                   : CPA_STATUS_FAIL;
+    }
+#endif
+    for (i = 0; i < numAddr; i++)
+    {
+        pPhysAddr[i] = SalMem_virt2PhysExternal(pVirtAddr[i], pService);
+        if (0 == pPhysAddr[i])
+        {
+            return CPA_STATUS_FAIL;
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
 size_t icp_sal_iommu_get_remap_size(size_t size)
 {
 #if (defined(USER_SPACE) || defined(_WIN64))
@@ -96,6 +96,10 @@
 #define ASYM_NOT_SUPPORTED
 #endif
 
+#ifndef KERNEL_SPACE
+#include <pthread.h>
+#endif
+
 #define LAC_MEM_POOLS_NUM_SUPPORTED 32000
 /**< @ingroup LacMemPool
  * Number of mem pools supported */
@@ -104,6 +108,84 @@
 /**< @ingroup LacMemPool
  * 16 bytes including '\\0' terminator to prevent padding in the structure */
 
+#ifdef KERNEL_SPACE
+#define LAC_MEM_POOL_SLAB_PAGES 4
+/**< @ingroup LacMemPool
+ * Number of pages of the kmalloc behind a slab. An order 2 allocation is
+ * below PAGE_ALLOC_COSTLY_ORDER, so it is served from fragmented memory
+ * without compaction */
+
+#define LAC_MEM_POOL_SLAB_SIZE(align)                                          \
+    (((align) < LAC_MEM_POOL_SLAB_PAGES * OSAL_PAGE_SIZE / 2)                  \
+         ? (LAC_MEM_POOL_SLAB_PAGES * OSAL_PAGE_SIZE - (align) -               \
+            sizeof(OsalMemAllocInfoStruct))                                    \
+         : 0)
+/**< @ingroup LacMemPool
+ * Maximum size of the contiguous slabs the pool elements are carved from.
+ * osalMemAllocContiguousNUMA adds the alignment and its header to the size
+ * and rounds it up to whole pages, so this fills LAC_MEM_POOL_SLAB_PAGES.
+ * Pools with larger alignments or elements get one element per slab */
+#else
+#define LAC_MEM_POOL_SLAB_SIZE(align) (512 * 1024)
+/**< @ingroup LacMemPool
+ * Maximum size of the contiguous slabs the pool elements are carved from.
+ * Kept well below the 2MB USDM slab and huge page size so that each slab
+ * is physically contiguous and the physical address of an element can be
+ * computed from its offset in the slab */
+#endif
+
+#ifndef KERNEL_SPACE
+#define LAC_MEM_POOL_MAGAZINE_SIZE 32
+/**< @ingroup LacMemPool
+ * Maximum number of entries a thread caches for any one pool */
+
+#define LAC_MEM_POOL_MAGAZINE_SHIFT 5
+/**< @ingroup LacMemPool
+ * A thread caches at most 1/32 of the entries of a pool, so that small
+ * pools are not emptied into the caches of a few threads */
+
+#define LAC_MEM_POOL_MAGAZINE_MIN 4
+/**< @ingroup LacMemPool
+ * Pools whose magazines would be smaller than this do not use them */
+
+#define LAC_MEM_POOL_MAGAZINE_CACHE_SHIFT 1
+/**< @ingroup LacMemPool
+ * The magazines of all threads together cache at most 1/2 of the entries
+ * of a pool. Threads attaching beyond that get a magazine of size 0 and use
+ * the pool stack directly, so entries cannot all be stranded in the caches
+ * of other threads */
+
+/**< @ingroup LacMemPool
+ *     Per thread cache of free entries of one pool. Entries are allocated
+ * from and freed to the magazine without touching the shared stack, which
+ * is only accessed to refill or flush half a magazine at a time.
+ */
+typedef struct lac_mem_pool_magazine_s
+{
+    lac_mem_blk_t *blks[LAC_MEM_POOL_MAGAZINE_SIZE];
+    /**< cached free entries */
+    unsigned int count;
+    /**< number of entries in the magazine */
+    unsigned int size;
+    /**< capacity of the magazine, 0 if the thread uses the pool stack */
+    struct lac_mem_pool_hdr_s *pPool;
+    /**< pool the magazine is attached to, NULL if none */
+    struct lac_mem_pool_magazine_s *pNextInPool;
+    /**< next magazine attached to the same pool */
+} lac_mem_pool_magazine_t;
+
+/**< @ingroup LacMemPool
+ *     Magazines of a thread, indexed by the pool index
+ */
+typedef struct lac_mem_pool_thread_mags_s
+{
+    unsigned int numMags;
+    /**< number of entries in pMags */
+    lac_mem_pool_magazine_t *pMags[];
+    /**< magazine for each pool index, NULL if not used yet */
+} lac_mem_pool_thread_mags_t;
+#endif
+
 /**< @ingroup LacMemPool
  *     This structure is used to manage each pool created using this utility
  * feature. The client will maintain a pointer (identifier) to the created
@@ -122,8 +204,22 @@ typedef struct lac_mem_pool_hdr_s
     /**< block alignment in bytes */
     lac_mem_blk_t **trackBlks;
     /* An array of mem block pointers to track the allocated entries in pool */
+    void **pSlabs;
+    /* Contiguous memory slabs the entries of the pool are carved from */
+    unsigned int numSlabs;
+    /* Number of slabs allocated */
     volatile size_t availBlks;
     /* Number of blocks available for allocation in this pool */
+#ifndef KERNEL_SPACE
+    unsigned int poolIndex;
+    /**< index of the pool in lac_mem_pools */
+    unsigned int magazineSize;
+    /**< size of the per thread magazines, 0 if not used */
+    unsigned int numMagazines;
+    /**< number of attached magazines of non zero size */
+    lac_mem_pool_magazine_t *pMagazines;
+    /**< list of the magazines attached to the pool */
+#endif
 } lac_mem_pool_hdr_t;
 
 static lac_mem_pool_hdr_t *lac_mem_pools[LAC_MEM_POOLS_NUM_SUPPORTED] = {NULL};
@@ -131,6 +227,20 @@ static lac_mem_pool_hdr_t *lac_mem_pools[LAC_MEM_POOLS_NUM_SUPPORTED] = {NULL};
  * Array of pointers to the mem pool header structure
  */
 
+#ifndef KERNEL_SPACE
+static pthread_key_t lac_mem_pool_mags_key;
+/**< @ingroup LacMemPool
+ * Thread specific key holding the magazines of each thread */
+
+static pthread_once_t lac_mem_pool_mags_once = PTHREAD_ONCE_INIT;
+static CpaBoolean lac_mem_pool_mags_key_valid = CPA_FALSE;
+
+static pthread_mutex_t lac_mem_pool_mags_lock = PTHREAD_MUTEX_INITIALIZER;
+/**< @ingroup LacMemPool
+ * Protects the magazine lists of the pools. Only taken when a magazine is
+ * attached to or detached from a pool, never on the alloc and free path */
+#endif
+
 LAC_DECLARE_HIGHEST_BIT_OF(lac_mem_blk_t);
 /**< @ingroup LacMemPool
  * local constant for quickening computation of additional space allocated
@@ -144,6 +254,206 @@ LAC_DECLARE_HIGHEST_BIT_OF(lac_mem_blk_t);
  ******************************************************************************/
 void Lac_MemPoolCleanUpInternal(lac_mem_pool_hdr_t *pPoolID);
 
+#ifndef KERNEL_SPACE
+/* Returns the top num entries of a magazine to the pool stack */
+static void Lac_MemPoolMagazineFlush(lac_mem_pool_hdr_t *pPoolID,
+                                     lac_mem_pool_magazine_t *pMag,
+                                     unsigned int num)
+{
+    unsigned int i = 0;
+    unsigned int first = pMag->count - num;
+
+    if (0 == num)
+    {
+        return;
+    }
+    for (i = first; i < pMag->count - 1; i++)
+    {
+        pMag->blks[i]->pNext = pMag->blks[i + 1];
+    }
+    push_list(&pPoolID->stack, pMag->blks[first], pMag->blks[pMag->count - 1]);
+    __sync_add_and_fetch(&pPoolID->availBlks, num);
+    pMag->count = first;
+}
+
+static void Lac_MemPoolMagazineRefill(lac_mem_pool_hdr_t *pPoolID,
+                                      lac_mem_pool_magazine_t *pMag)
+{
+    unsigned int num = 0;
+
+    num = pop_list(&pPoolID->stack,
+                   &pMag->blks[pMag->count],
+                   (pMag->size >> 1) - pMag->count);
+    if (num > 0)
+    {
+        __sync_sub_and_fetch(&pPoolID->availBlks, num);
+        pMag->count += num;
+    }
+}
+
+/* Destructor of the thread specific key, called on thread exit */
+static void Lac_MemPoolMagazinesThreadExit(void *pArg)
+{
+    lac_mem_pool_thread_mags_t *pThreadMags = pArg;
+    lac_mem_pool_magazine_t *pMag = NULL;
+    lac_mem_pool_magazine_t **ppLink = NULL;
+    unsigned int i = 0;
+
+    pthread_mutex_lock(&lac_mem_pool_mags_lock);
+    for (i = 0; i < pThreadMags->numMags; i++)
+    {
+        pMag = pThreadMags->pMags[i];
+        if (NULL == pMag)
+        {
+            continue;
+        }
+        if (NULL != pMag->pPool)
+        {
+            Lac_MemPoolMagazineFlush(pMag->pPool, pMag, pMag->count);
+            if (0 != pMag->size)
+            {
+                pMag->pPool->numMagazines--;
+            }
+            ppLink = &pMag->pPool->pMagazines;
+            while (*ppLink != pMag)
+            {
+                ppLink = &(*ppLink)->pNextInPool;
+            }
+            *ppLink = pMag->pNextInPool;
+        }
+        LAC_OS_FREE(pMag);
+    }
+    pthread_mutex_unlock(&lac_mem_pool_mags_lock);
+    LAC_OS_FREE(pThreadMags);
+}
+
+static void Lac_MemPoolMagazinesKeyCreate(void)
+{
+    if (0 ==
+        pthread_key_create(&lac_mem_pool_mags_key,
+                           Lac_MemPoolMagazinesThreadExit))
+    {
+        lac_mem_pool_mags_key_valid = CPA_TRUE;
+    }
+}
+
+/* Slow path of Lac_MemPoolGetMagazine, attaches a magazine of the calling
+ * thread to the pool. Returns NULL if no magazine can be used, in which
+ * case the caller goes to the pool stack directly. */
+static lac_mem_pool_magazine_t *Lac_MemPoolMagazineAttach(
+    lac_mem_pool_hdr_t *pPoolID,
+    lac_mem_pool_thread_mags_t *pThreadMags)
+{
+    lac_mem_pool_thread_mags_t *pNewMags = NULL;
+    lac_mem_pool_magazine_t *pMag = NULL;
+    unsigned int numMags = 0;
+
+    pthread_once(&lac_mem_pool_mags_once, Lac_MemPoolMagazinesKeyCreate);
+    if (CPA_TRUE != lac_mem_pool_mags_key_valid)
+    {
+        return NULL;
+    }
+
+    if (NULL == pThreadMags || pPoolID->poolIndex >= pThreadMags->numMags)
+    {
+        numMags = pPoolID->poolIndex + 1;
+        if (CPA_STATUS_SUCCESS !=
+            LAC_OS_MALLOC(&pNewMags,
+                          sizeof(lac_mem_pool_thread_mags_t) +
+                              numMags * sizeof(lac_mem_pool_magazine_t *)))
+        {
+            return NULL;
+        }
+        memset(pNewMags->pMags, 0, numMags * sizeof(lac_mem_pool_magazine_t *));
+        pNewMags->numMags = numMags;
+        if (NULL != pThreadMags)
+        {
+            memcpy(pNewMags->pMags,
+                   pThreadMags->pMags,
+                   pThreadMags->numMags * sizeof(lac_mem_pool_magazine_t *));
+        }
+        if (0 != pthread_setspecific(lac_mem_pool_mags_key, pNewMags))
+        {
+            LAC_OS_FREE(pNewMags);
+            return NULL;
+        }
+        if (NULL != pThreadMags)
+        {
+            LAC_OS_FREE(pThreadMags);
+        }
+        pThreadMags = pNewMags;
+    }
+
+    pMag = pThreadMags->pMags[pPoolID->poolIndex];
+    if (NULL == pMag)
+    {
+        if (CPA_STATUS_SUCCESS !=
+            LAC_OS_MALLOC(&pMag, sizeof(lac_mem_pool_magazine_t)))
+        {
+            return NULL;
+        }
+        pThreadMags->pMags[pPoolID->poolIndex] = pMag;
+    }
+
+    /* A magazine left attached to a destroyed pool has been detached by
+     * Lac_MemPoolDestroy, so it can be reused for the pool now using the
+     * same index */
+    pthread_mutex_lock(&lac_mem_pool_mags_lock);
+    pMag->count = 0;
+    pMag->size = 0;
+    if ((pPoolID->numMagazines + 1) * pPoolID->magazineSize <=
+        (pPoolID->numElementsInPool >> LAC_MEM_POOL_MAGAZINE_CACHE_SHIFT))
+    {
+        pMag->size = pPoolID->magazineSize;
+        pPoolID->numMagazines++;
+    }
+    pMag->pPool = pPoolID;
+    pMag->pNextInPool = pPoolID->pMagazines;
+    pPoolID->pMagazines = pMag;
+    pthread_mutex_unlock(&lac_mem_pool_mags_lock);
+
+    return pMag;
+}
+
+static inline lac_mem_pool_magazine_t *Lac_MemPoolGetMagazine(
+    lac_mem_pool_hdr_t *pPoolID)
+{
+    lac_mem_pool_thread_mags_t *pThreadMags = NULL;
+    lac_mem_pool_magazine_t *pMag = NULL;
+
+    if (CPA_TRUE == lac_mem_pool_mags_key_valid)
+    {
+        pThreadMags = pthread_getspecific(lac_mem_pool_mags_key);
+        if (NULL != pThreadMags && pPoolID->poolIndex < pThreadMags->numMags)
+        {
+            pMag = pThreadMags->pMags[pPoolID->poolIndex];
+            if (NULL != pMag && pMag->pPool == pPoolID)
+            {
+                return pMag;
+            }
+        }
+    }
+    return Lac_MemPoolMagazineAttach(pPoolID, pThreadMags);
+}
+
+/* Returns the entries cached by all threads to the pool stack and
+ * detaches their magazines from the pool */
+static void Lac_MemPoolMagazinesDrain(lac_mem_pool_hdr_t *pPoolID)
+{
+    lac_mem_pool_magazine_t *pMag = NULL;
+
+    pthread_mutex_lock(&lac_mem_pool_mags_lock);
+    for (pMag = pPoolID->pMagazines; NULL != pMag; pMag = pMag->pNextInPool)
+    {
+        Lac_MemPoolMagazineFlush(pPoolID, pMag, pMag->count);
+        pMag->pPool = NULL;
+    }
+    pPoolID->pMagazines = NULL;
+    pPoolID->numMagazines = 0;
+    pthread_mutex_unlock(&lac_mem_pool_mags_lock);
+}
+#endif
+
 static inline Cpa32U Lac_MemPoolGetElementRealSize(Cpa32U blkSizeInBytes,
                                                    Cpa32U blkAlignmentInBytes)
 {
@@ -165,8 +475,16 @@ CpaStatus Lac_MemPoolCreate(
     unsigned int poolSearch = 0;
     unsigned int counter = 0;
     lac_mem_blk_t *pMemBlkCurrent = NULL;
+    lac_mem_pool_hdr_t *pPool = NULL;
+    Cpa32U realSize = 0;
+    Cpa32U addSize = 0;
+    Cpa32U elemsPerSlab = 0;
+    Cpa32U slabIndex = 0;
+    Cpa32U numInSlab = 0;
+    CpaPhysicalAddr slabPhysAddr = 0;
 
     void *pMemBlk = NULL;
+    void *pSlab = NULL;
 
     if (pPoolID == NULL)
     {
@@ -228,38 +546,76 @@ CpaStatus Lac_MemPoolCreate(
         lac_mem_pools[poolSearch]->trackBlks = NULL;
     }
 
-    lac_mem_pools[poolSearch]->availBlks = 0;
-    lac_mem_pools[poolSearch]->stack = _init_stack();
+    /* realSize is computed for allocation of  blkSize bytes + additional
+       capacity for lac_mem_blk_t structure storage due to the some OSes
+       (BSD) limitations for memory alignment to be power of 2;
+       sizeof(lac_mem_blk_t) is being round up to the closest power of 2 -
+       optimised towards the least CPU overhead but at additional memory
+       cost
+     */
+    realSize =
+        Lac_MemPoolGetElementRealSize(blkSizeInBytes, blkAlignmentInBytes);
+    addSize = realSize - blkSizeInBytes;
+
+    /* Elements are laid out back to back in the slabs. addSize is a power
+       of 2 not smaller than blkAlignmentInBytes, so rounding the element
+       size up to it keeps every element aligned */
+    realSize = LAC_ALIGN_POW2_ROUNDUP(realSize, addSize);
+    elemsPerSlab = LAC_MEM_POOL_SLAB_SIZE(blkAlignmentInBytes) / realSize;
+    if (0 == elemsPerSlab)
+    {
+        elemsPerSlab = 1;
+    }
 
-    /* Calculate alignment needed for allocation   */
-    for (counter = 0; counter < numElementsInPool; counter++)
+    pPool = lac_mem_pools[poolSearch];
+    pPool->numSlabs = 0;
+    if (CPA_STATUS_SUCCESS !=
+        LAC_OS_MALLOC(&pPool->pSlabs,
+                      sizeof(void *) *
+                          ((numElementsInPool + elemsPerSlab) / elemsPerSlab)))
     {
-        CpaPhysicalAddr physAddr = 0;
-        /* realSize is computed for allocation of  blkSize bytes + additional
-           capacity for lac_mem_blk_t structure storage due to the some OSes
-           (BSD) limitations for memory alignment to be power of 2;
-           sizeof(lac_mem_blk_t) is being round up to the closest power of 2 -
-           optimised towards the least CPU overhead but at additional memory
-           cost
-         */
-        Cpa32U realSize =
-            Lac_MemPoolGetElementRealSize(blkSizeInBytes, blkAlignmentInBytes);
-        Cpa32U addSize = realSize - blkSizeInBytes;
+        if (NULL != pPool->trackBlks)
+        {
+            LAC_OS_FREE(pPool->trackBlks);
+        }
+        LAC_OS_FREE(lac_mem_pools[poolSearch]);
+        lac_mem_pools[poolSearch] = NULL;
+        LAC_LOG_ERROR("Unable to allocate memory for tracking memory slabs");
+        return CPA_STATUS_RESOURCE; /*Error*/
+    }
 
-        if (CPA_STATUS_SUCCESS !=
-            LAC_OS_CAMALLOC(&pMemBlk, realSize, blkAlignmentInBytes, node))
+    pPool->availBlks = 0;
+    pPool->stack = _init_stack();
+    pPool->numElementsInPool = 0;
+
+    for (counter = 0; counter < numElementsInPool; counter++)
+    {
+        slabIndex = counter % elemsPerSlab;
+        if (0 == slabIndex)
         {
-            Lac_MemPoolCleanUpInternal(lac_mem_pools[poolSearch]);
-            lac_mem_pools[poolSearch] = NULL;
-            LAC_LOG_ERROR("Unable to allocate contiguous chunk of memory");
-            return CPA_STATUS_RESOURCE;
+            numInSlab = numElementsInPool - counter;
+            if (numInSlab > elemsPerSlab)
+            {
+                numInSlab = elemsPerSlab;
+            }
+            if (CPA_STATUS_SUCCESS != LAC_OS_CAMALLOC(&pSlab,
+                                                      numInSlab * realSize,
+                                                      blkAlignmentInBytes,
+                                                      node))
+            {
+                Lac_MemPoolCleanUpInternal(pPool);
+                lac_mem_pools[poolSearch] = NULL;
+                LAC_LOG_ERROR("Unable to allocate contiguous chunk of memory");
+                return CPA_STATUS_RESOURCE;
+            }
+            pPool->pSlabs[pPool->numSlabs++] = pSlab;
+            slabPhysAddr = LAC_OS_VIRT_TO_PHYS_INTERNAL(pSlab);
         }
 
         /* Calcaulate various offsets */
-        physAddr = LAC_OS_VIRT_TO_PHYS_INTERNAL(
-            (void *)((LAC_ARCH_UINT)pMemBlk + addSize));
+        pMemBlk = (void *)((LAC_ARCH_UINT)pSlab + slabIndex * realSize);
 
-        /* physAddr is now already aligned to the greater power of 2:
+        /* The data block is now already aligned to the greater power of 2:
             blkAlignmentInBytes or sizeof(lac_mem_blk_t) round up
             We safely put the structure right before the blkSize
             real data block
@@ -267,24 +623,41 @@ CpaStatus Lac_MemPoolCreate(
         pMemBlkCurrent = (lac_mem_blk_t *)(((LAC_ARCH_UINT)(pMemBlk)) +
                                            addSize - sizeof(lac_mem_blk_t));
 
-        pMemBlkCurrent->physDataPtr = physAddr;
+        pMemBlkCurrent->physDataPtr =
+            slabPhysAddr + slabIndex * realSize + addSize;
         pMemBlkCurrent->pMemAllocPtr = pMemBlk;
-        pMemBlkCurrent->pPoolID = lac_mem_pools[poolSearch];
+        pMemBlkCurrent->pPoolID = pPool;
         pMemBlkCurrent->isInUse = CPA_FALSE;
         pMemBlkCurrent->pNext = NULL;
 
-        push(&lac_mem_pools[poolSearch]->stack, pMemBlkCurrent);
+        push(&pPool->stack, pMemBlkCurrent);
 
         /* Store allocated memory pointer */
-        if (lac_mem_pools[poolSearch]->trackBlks != NULL)
+        if (pPool->trackBlks != NULL)
         {
-            (lac_mem_pools[poolSearch]->trackBlks[counter]) =
-                (lac_mem_blk_t *)pMemBlkCurrent;
+            (pPool->trackBlks[counter]) = (lac_mem_blk_t *)pMemBlkCurrent;
         }
-        __sync_add_and_fetch(&lac_mem_pools[poolSearch]->availBlks, 1);
+        pPool->numElementsInPool++;
+        __sync_add_and_fetch(&pPool->availBlks, 1);
     }
 
     /* Set Pool details in the header */
+#ifndef KERNEL_SPACE
+    (lac_mem_pools[poolSearch])->poolIndex = poolSearch;
+    (lac_mem_pools[poolSearch])->magazineSize =
+        numElementsInPool >> LAC_MEM_POOL_MAGAZINE_SHIFT;
+    if ((lac_mem_pools[poolSearch])->magazineSize > LAC_MEM_POOL_MAGAZINE_SIZE)
+    {
+        (lac_mem_pools[poolSearch])->magazineSize = LAC_MEM_POOL_MAGAZINE_SIZE;
+    }
+    else if ((lac_mem_pools[poolSearch])->magazineSize <
+             LAC_MEM_POOL_MAGAZINE_MIN)
+    {
+        (lac_mem_pools[poolSearch])->magazineSize = 0;
+    }
+    (lac_mem_pools[poolSearch])->numMagazines = 0;
+    (lac_mem_pools[poolSearch])->pMagazines = NULL;
+#endif
     (lac_mem_pools[poolSearch])->numElementsInPool = numElementsInPool;
     (lac_mem_pools[poolSearch])->blkSizeInBytes = blkSizeInBytes;
     (lac_mem_pools[poolSearch])->blkAlignmentInBytes = blkAlignmentInBytes;
@@ -298,6 +671,9 @@ void *Lac_MemPoolEntryAlloc(lac_memory_pool_id_t poolID)
 {
     lac_mem_pool_hdr_t *pPoolID = (lac_mem_pool_hdr_t *)poolID;
     lac_mem_blk_t *pMemBlkCurrent = NULL;
+#ifndef KERNEL_SPACE
+    lac_mem_pool_magazine_t *pMag = NULL;
+#endif
 
 #ifdef ICP_DEBUG
     /* Explicitly removing NULL PoolID check for speed */
@@ -308,6 +684,26 @@ void *Lac_MemPoolEntryAlloc(lac_memory_pool_id_t poolID)
     }
 #endif /* ICP_DEBUG */
 
+#ifndef KERNEL_SPACE
+    /* Take the block from the thread's magazine if the pool uses them */
+    if (0 != pPoolID->magazineSize &&
+        NULL != (pMag = Lac_MemPoolGetMagazine(pPoolID)) && 0 != pMag->size)
+    {
+        if (0 == pMag->count)
+        {
+            Lac_MemPoolMagazineRefill(pPoolID, pMag);
+            if (0 == pMag->count)
+            {
+                return (void *)CPA_STATUS_RETRY;
+            }
+        }
+        pMemBlkCurrent = pMag->blks[--pMag->count];
+        pMemBlkCurrent->isInUse = CPA_TRUE;
+        return (void *)((LAC_ARCH_UINT)(pMemBlkCurrent) +
+                        sizeof(lac_mem_blk_t));
+    }
+#endif
+
     /* Remove block from pool */
     pMemBlkCurrent = pop(&pPoolID->stack);
     if (NULL == pMemBlkCurrent)
@@ -322,6 +718,9 @@ void *Lac_MemPoolEntryAlloc(lac_memory_pool_id_t poolID)
 void Lac_MemPoolEntryFree(void *pEntry)
 {
     lac_mem_blk_t *pMemBlk = NULL;
+#ifndef KERNEL_SPACE
+    lac_mem_pool_magazine_t *pMag = NULL;
+#endif
 
 #ifdef ICP_DEBUG
     /* Explicitly NULL pointer check */
@@ -335,6 +734,22 @@ void Lac_MemPoolEntryFree(void *pEntry)
     pMemBlk = (lac_mem_blk_t *)((LAC_ARCH_UINT)pEntry - sizeof(lac_mem_blk_t));
     pMemBlk->isInUse = CPA_FALSE;
 
+#ifndef KERNEL_SPACE
+    /* Return the block to the thread's magazine, flushing half of it to
+     * the pool stack when it is full */
+    if (0 != pMemBlk->pPoolID->magazineSize &&
+        NULL != (pMag = Lac_MemPoolGetMagazine(pMemBlk->pPoolID)) &&
+        0 != pMag->size)
+    {
+        if (pMag->count == pMag->size)
+        {
+            Lac_MemPoolMagazineFlush(pMemBlk->pPoolID, pMag, pMag->size >> 1);
+        }
+        pMag->blks[pMag->count++] = pMemBlk;
+        return;
+    }
+#endif
+
     push(&pMemBlk->pPoolID->stack, pMemBlk);
     __sync_add_and_fetch(&pMemBlk->pPoolID->availBlks, 1);
 }
@@ -360,35 +775,26 @@ void Lac_MemPoolDestroy(lac_memory_pool_id_t poolID)
 
         lac_mem_pools[poolSearch] = NULL; /*Remove handle from pool*/
 
+#ifndef KERNEL_SPACE
+        Lac_MemPoolMagazinesDrain(pPoolID);
+#endif
         Lac_MemPoolCleanUpInternal(pPoolID);
     }
 }
 
 void Lac_MemPoolCleanUpInternal(lac_mem_pool_hdr_t *pPoolID)
 {
-    lac_mem_blk_t *pCurrentBlk = NULL;
-    void *pFreePtr = NULL;
     Cpa32U count = 0;
 
-    if (pPoolID->trackBlks == NULL)
+    /* Entries are carved from the slabs, so freeing the slabs frees all
+     * of them whether or not they are tracked */
+    for (count = 0; count < pPoolID->numSlabs; count++)
     {
-        pCurrentBlk = pop(&pPoolID->stack);
-
-        while (pCurrentBlk != NULL)
-        {
-            /* Free Data Blocks */
-            pFreePtr = pCurrentBlk->pMemAllocPtr;
-            pCurrentBlk = pop(&pPoolID->stack);
-            LAC_OS_CAFREE(pFreePtr);
-        }
+        LAC_OS_CAFREE(pPoolID->pSlabs[count]);
     }
-    else
+    LAC_OS_FREE(pPoolID->pSlabs);
+    if (pPoolID->trackBlks != NULL)
     {
-        for (count = 0; count < pPoolID->numElementsInPool; count++)
-        {
-            pFreePtr = (pPoolID->trackBlks[count])->pMemAllocPtr;
-            LAC_OS_CAFREE(pFreePtr);
-        }
         LAC_OS_FREE(pPoolID->trackBlks);
     }
     LAC_OS_FREE(pPoolID);
@@ -397,12 +803,27 @@ void Lac_MemPoolCleanUpInternal(lac_mem_pool_hdr_t *pPoolID)
 unsigned int Lac_MemPoolAvailableEntries(lac_memory_pool_id_t poolID)
 {
     lac_mem_pool_hdr_t *pPoolID = (lac_mem_pool_hdr_t *)poolID;
+    unsigned int availBlks = 0;
+#ifndef KERNEL_SPACE
+    lac_mem_pool_magazine_t *pMag = NULL;
+#endif
+
     if (pPoolID == NULL)
     {
         LAC_LOG_ERROR("Invalid Pool ID");
         return 0;
     }
-    return pPoolID->availBlks;
+    availBlks = pPoolID->availBlks;
+#ifndef KERNEL_SPACE
+    /* Entries cached in the thread magazines are also available */
+    pthread_mutex_lock(&lac_mem_pool_mags_lock);
+    for (pMag = pPoolID->pMagazines; NULL != pMag; pMag = pMag->pNextInPool)
+    {
+        availBlks += pMag->count;
+    }
+    pthread_mutex_unlock(&lac_mem_pool_mags_lock);
+#endif
+    return availBlks;
 }
 
 void Lac_MemPoolStatsShow(void)
@@ -435,7 +856,8 @@ void Lac_MemPoolStatsShow(void)
                     lac_mem_pools[index]->numElementsInPool,
                     lac_mem_pools[index]->blkSizeInBytes,
                     lac_mem_pools[index]->blkAlignmentInBytes,
-                    lac_mem_pools[index]->availBlks,
+                    Lac_MemPoolAvailableEntries(
+                        (lac_memory_pool_id_t)lac_mem_pools[index]),
                     0,
                     0,
                     0);
@@ -0,0 +1,216 @@
+/******************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ *****************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file lac_stats.c Sharded statistics counters
+ *
+ * @ingroup LacStats
+ *
+ *****************************************************************************/
+
+/*
+*******************************************************************************
+* Include public/global header files
+*******************************************************************************
+*/
+#include "cpa.h"
+#include "Osal.h"
+
+/*
+*******************************************************************************
+* Include private header files
+*******************************************************************************
+*/
+#include "lac_common.h"
+#include "lac_mem.h"
+#include "lac_stats.h"
+
+/*
+*******************************************************************************
+* Define public/global function definitions
+*******************************************************************************
+*/
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *****************************************************************************/
+CpaStatus LacStats_Init(lac_stats_t *pStats, Cpa32U numStats)
+{
+#ifdef KERNEL_SPACE
+    /* Per CPU memory is zeroed on allocation */
+    pStats->pCounters =
+        __alloc_percpu(numStats * sizeof(Cpa64U), LAC_64BYTE_ALIGNMENT);
+    if (NULL == pStats->pCounters)
+    {
+        return CPA_STATUS_RESOURCE;
+    }
+#else
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa32U shardBytes = 0;
+    Cpa8U *pAligned = NULL;
+
+    /* Round each shard up to whole cache lines so no two shards share one */
+    shardBytes = LAC_ALIGN_POW2_ROUNDUP(numStats * sizeof(OsalAtomic),
+                                        LAC_64BYTE_ALIGNMENT);
+
+    status = LAC_OS_MALLOC(&(pStats->pAllocated),
+                           shardBytes * LAC_STATS_NUM_SHARDS +
+                               LAC_64BYTE_ALIGNMENT);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        pStats->pAllocated = NULL;
+        return status;
+    }
+
+    pAligned = (Cpa8U *)LAC_ALIGN_POW2_ROUNDUP(
+        (LAC_ARCH_UINT)pStats->pAllocated, LAC_64BYTE_ALIGNMENT);
+    LAC_OS_BZERO(pAligned, shardBytes * LAC_STATS_NUM_SHARDS);
+
+    pStats->pCounters = (OsalAtomic *)pAligned;
+    pStats->shardStride = shardBytes / sizeof(OsalAtomic);
+#endif
+    pStats->numStats = numStats;
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *****************************************************************************/
+void LacStats_Free(lac_stats_t *pStats)
+{
+#ifdef KERNEL_SPACE
+    if (NULL != pStats->pCounters)
+    {
+        free_percpu(pStats->pCounters);
+        pStats->pCounters = NULL;
+    }
+#else
+    if (NULL != pStats->pAllocated)
+    {
+        LAC_OS_FREE(pStats->pAllocated);
+        pStats->pAllocated = NULL;
+        pStats->pCounters = NULL;
+    }
+#endif
+}
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *****************************************************************************/
+Cpa64U LacStats_Get(lac_stats_t *pStats, Cpa32U index)
+{
+    Cpa64U total = 0;
+#ifdef KERNEL_SPACE
+    int cpu = 0;
+
+    for_each_possible_cpu(cpu)
+    {
+        total += per_cpu_ptr(pStats->pCounters, cpu)[index];
+    }
+#else
+    Cpa32U shard = 0;
+
+    for (shard = 0; shard < LAC_STATS_NUM_SHARDS; shard++)
+    {
+        total += osalAtomicGet(
+            &pStats->pCounters[shard * pStats->shardStride + index]);
+    }
+#endif
+    return total;
+}
+
+/**
+ *****************************************************************************
+ * @ingroup LacStats
+ *****************************************************************************/
+void LacStats_Reset(lac_stats_t *pStats)
+{
+    Cpa32U i = 0;
+#ifdef KERNEL_SPACE
+    int cpu = 0;
+
+    for_each_possible_cpu(cpu)
+    {
+        for (i = 0; i < pStats->numStats; i++)
+        {
+            per_cpu_ptr(pStats->pCounters, cpu)[i] = 0;
+        }
+    }
+#else
+    Cpa32U shard = 0;
+
+    for (shard = 0; shard < LAC_STATS_NUM_SHARDS; shard++)
+    {
+        for (i = 0; i < pStats->numStats; i++)
+        {
+            osalAtomicSet(
+                0, &pStats->pCounters[shard * pStats->shardStride + i]);
+        }
+    }
+#endif
+}
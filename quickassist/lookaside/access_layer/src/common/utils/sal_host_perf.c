@@ -0,0 +1,467 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file sal_host_perf.c
+ *
+ * @ingroup SalUser
+ *
+ * @description
+ *    Test only entry points of the host benchmarks of the performance
+ *    sample code. The accesses of the session functions follow the
+ *    session descriptor and must be kept in step with the sym perform and
+ *    callback paths.
+ *
+ *****************************************************************************/
+
+#include "cpa.h"
+#include "Osal.h"
+#include "icp_sal_host_perf.h"
+
+#include "lac_common.h"
+#include "lac_mem.h"
+#include "lac_mem_pools.h"
+#include "lac_stats.h"
+#include "lac_sal_types.h"
+#include "lac_buffer_desc.h"
+#include "dc_session.h"
+#include "dc_datapath.h"
+#ifndef ICP_DC_ONLY
+#include "lac_session.h"
+#include "lac_sym.h"
+#include "lac_pke_qat_comms.h"
+#endif
+
+/* Accesses of a request to a field of the session descriptor */
+typedef struct sal_host_perf_field_s
+{
+    Cpa32U offset;
+    Cpa32U size;
+    CpaBoolean isWrite;
+} sal_host_perf_field_t;
+
+#define SAL_HOST_PERF_FIELD(field, isWrite)                                    \
+    {                                                                          \
+        offsetof(lac_session_desc_t, field),                                   \
+            sizeof(((lac_session_desc_t *)NULL)->field), isWrite               \
+    }
+
+/* Instance of icp_sal_HostPerfInstanceGet. Without a virt2phys client it
+ * translates with USDM */
+static sal_service_t salHostPerfService = {
+    .type = SAL_SERVICE_TYPE_CRYPTO_SYM};
+
+#ifndef ICP_DC_ONLY
+/*number of cache lines of a session descriptor*/
+#define SAL_HOST_PERF_SESSION_NUM_LINES                                        \
+    ((sizeof(lac_session_desc_t) + LAC_64BYTE_ALIGNMENT - 1) /               \
+     LAC_64BYTE_ALIGNMENT)
+
+/*fields a full packet request touches in LacSym_Perform, the alg chain
+ * perform and LacSymQueue_RequestSend. The flags bitfield follows
+ * aadLenInBytes*/
+static const sal_host_perf_field_t salHostPerfSubmitFields[] = {
+    SAL_HOST_PERF_FIELD(reqCacheHdr, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(reqCacheMid, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(reqCacheFtr, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(pInstance, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(hashStateBufferInfo, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(writeRingMsgFunc, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(symOperation, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(laCmdId, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(hashAlgorithm, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(cipherAlgorithm, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(aadLenInBytes, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(accessLock, CPA_TRUE),
+    SAL_HOST_PERF_FIELD(accessReaders, CPA_TRUE),
+    SAL_HOST_PERF_FIELD(partialState, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(u.pendingCbCount, CPA_TRUE),
+    SAL_HOST_PERF_FIELD(requestQueueCount, CPA_FALSE)};
+
+/*fields the completion of a full packet request touches in
+ * LacSymCb_ProcessCallbackInternal*/
+static const sal_host_perf_field_t salHostPerfCompleteFields[] = {
+    SAL_HOST_PERF_FIELD(pSymCb, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(symOperation, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(hashResultSize, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(cipherAlgorithm, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(aadLenInBytes, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(cipherKeyLenInBytes, CPA_FALSE),
+    SAL_HOST_PERF_FIELD(u.pendingCbCount, CPA_TRUE)};
+#endif
+
+CpaStatus icp_sal_HostPerfPoolCreate(icp_sal_host_perf_pool_t type,
+                                     Cpa32U numConcurrentReq,
+                                     void **ppPool,
+                                     Cpa32U *pNumEntries)
+{
+    lac_memory_pool_id_t poolID = LAC_MEM_POOL_INIT_POOL_ID;
+    char poolName[] = "HostPerfPool";
+    Cpa32U numEntries = 0;
+    Cpa32U entrySize = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    LAC_CHECK_NULL_PARAM(ppPool);
+    LAC_CHECK_NULL_PARAM(pNumEntries);
+
+    /*as the pools are created by SalCtrl_SymInit, SalCtrl_AsymInit and
+     * SalCtrl_CompressionInit*/
+    switch (type)
+    {
+#ifndef ICP_DC_ONLY
+        case ICP_SAL_HOST_PERF_POOL_SYM_COOKIE:
+            numEntries = (numConcurrentReq + numConcurrentReq + 1) << 1;
+            entrySize = sizeof(lac_sym_cookie_t);
+            break;
+        case ICP_SAL_HOST_PERF_POOL_ASYM_REQUEST:
+            numEntries = (numConcurrentReq + 1) * LAC_PKE_MAX_CHAIN_LENGTH;
+            entrySize = sizeof(lac_pke_qat_req_data_t);
+            break;
+#endif
+        case ICP_SAL_HOST_PERF_POOL_DC_COOKIE:
+            numEntries = numConcurrentReq + 1;
+            entrySize = sizeof(dc_compression_cookie_t);
+            break;
+        default:
+            LAC_INVALID_PARAM_LOG("Invalid pool type");
+            return CPA_STATUS_INVALID_PARAM;
+    }
+    status = Lac_MemPoolCreate(&poolID,
+                               poolName,
+                               numEntries,
+                               entrySize,
+                               LAC_64BYTE_ALIGNMENT,
+                               CPA_FALSE,
+                               0);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return CPA_STATUS_RESOURCE;
+    }
+    *ppPool = (void *)poolID;
+    *pNumEntries = numEntries;
+    return CPA_STATUS_SUCCESS;
+}
+
+void *icp_sal_HostPerfPoolAlloc(void *pPool)
+{
+    void *pEntry = Lac_MemPoolEntryAlloc((lac_memory_pool_id_t)pPool);
+
+    if ((void *)CPA_STATUS_RETRY == pEntry)
+    {
+        return NULL;
+    }
+    return pEntry;
+}
+
+void icp_sal_HostPerfPoolFree(void *pEntry)
+{
+    Lac_MemPoolEntryFree(pEntry);
+}
+
+Cpa32U icp_sal_HostPerfPoolAvailable(void *pPool)
+{
+    return Lac_MemPoolAvailableEntries((lac_memory_pool_id_t)pPool);
+}
+
+void icp_sal_HostPerfPoolDestroy(void *pPool)
+{
+    Lac_MemPoolDestroy((lac_memory_pool_id_t)pPool);
+}
+
+CpaStatus icp_sal_HostPerfStatsCreate(Cpa32U numStats, void **ppStats)
+{
+    lac_stats_t *pStats = NULL;
+
+    LAC_CHECK_NULL_PARAM(ppStats);
+
+    if (CPA_STATUS_SUCCESS != LAC_OS_MALLOC(&pStats, sizeof(lac_stats_t)))
+    {
+        return CPA_STATUS_RESOURCE;
+    }
+    osalMemSet(pStats, 0, sizeof(lac_stats_t));
+    if (CPA_STATUS_SUCCESS != LacStats_Init(pStats, numStats))
+    {
+        LAC_OS_FREE(pStats);
+        return CPA_STATUS_RESOURCE;
+    }
+    *ppStats = pStats;
+    return CPA_STATUS_SUCCESS;
+}
+
+void icp_sal_HostPerfStatsInc(void *pStats, Cpa32U index)
+{
+    LacStats_Inc((lac_stats_t *)pStats, index);
+}
+
+Cpa64U icp_sal_HostPerfStatsGet(void *pStats, Cpa32U index)
+{
+    return LacStats_Get((lac_stats_t *)pStats, index);
+}
+
+void icp_sal_HostPerfStatsReset(void *pStats)
+{
+    LacStats_Reset((lac_stats_t *)pStats);
+}
+
+void icp_sal_HostPerfStatsDestroy(void *pStats)
+{
+    LacStats_Free((lac_stats_t *)pStats);
+    LAC_OS_FREE(pStats);
+}
+
+#ifndef ICP_DC_ONLY
+CpaStatus icp_sal_HostPerfSessionCreate(void **ppSession)
+{
+    lac_session_desc_t *pSessionDesc = NULL;
+
+    LAC_CHECK_NULL_PARAM(ppSession);
+
+    if (CPA_STATUS_SUCCESS != LAC_OS_CAMALLOC(&pSessionDesc,
+                                              sizeof(lac_session_desc_t),
+                                              LAC_64BYTE_ALIGNMENT,
+                                              0))
+    {
+        return CPA_STATUS_RESOURCE;
+    }
+    osalMemSet(pSessionDesc, 0, sizeof(lac_session_desc_t));
+    if (OSAL_SUCCESS != osalMutexInit(&pSessionDesc->accessLock))
+    {
+        LAC_OS_CAFREE(pSessionDesc);
+        return CPA_STATUS_RESOURCE;
+    }
+    pSessionDesc->partialState = CPA_CY_SYM_PACKET_TYPE_FULL;
+    pSessionDesc->symOperation = CPA_CY_SYM_OP_ALGORITHM_CHAINING;
+    pSessionDesc->isCipher = CPA_TRUE;
+    pSessionDesc->isAuth = CPA_TRUE;
+    *ppSession = pSessionDesc;
+    return CPA_STATUS_SUCCESS;
+}
+
+void icp_sal_HostPerfSessionSubmit(void *pSession)
+{
+    lac_session_desc_t *pSessionDesc = (lac_session_desc_t *)pSession;
+    icp_qat_fw_la_bulk_req_t msg;
+    Cpa8U *pMsgBytes = (Cpa8U *)&msg;
+
+    osalMutexLock(&pSessionDesc->accessLock, OSAL_WAIT_FOREVER);
+    pSessionDesc->accessReaders++;
+    osalMutexUnlock(&pSessionDesc->accessLock);
+
+    memcpy(pMsgBytes,
+           &pSessionDesc->reqCacheHdr,
+           sizeof(pSessionDesc->reqCacheHdr));
+    pMsgBytes += sizeof(pSessionDesc->reqCacheHdr);
+    memcpy(pMsgBytes,
+           &pSessionDesc->reqCacheMid,
+           sizeof(pSessionDesc->reqCacheMid));
+    pMsgBytes += sizeof(pSessionDesc->reqCacheMid);
+    memcpy(pMsgBytes,
+           &pSessionDesc->reqCacheFtr,
+           sizeof(pSessionDesc->reqCacheFtr));
+    msg.comn_mid.opaque_data = (Cpa64U)(LAC_ARCH_UINT)pSessionDesc->pInstance;
+    msg.comn_mid.src_data_addr = pSessionDesc->hashStateBufferInfo.pDataPhys +
+                                 pSessionDesc->aadLenInBytes;
+    msg.comn_mid.dest_data_addr =
+        (Cpa64U)(LAC_ARCH_UINT)pSessionDesc->writeRingMsgFunc;
+    msg.comn_mid.src_length = pSessionDesc->symOperation +
+                              pSessionDesc->laCmdId +
+                              pSessionDesc->hashAlgorithm +
+                              pSessionDesc->cipherAlgorithm +
+                              pSessionDesc->isCipher + pSessionDesc->isAuth;
+    msg.comn_mid.dst_length = pSessionDesc->partialState +
+                              osalAtomicGet(&pSessionDesc->requestQueueCount);
+    /*keep the compiler from dropping the build of the message*/
+    __asm__ __volatile__("" : : "r"(&msg) : "memory");
+    osalAtomicInc(&pSessionDesc->u.pendingCbCount);
+
+    osalMutexLock(&pSessionDesc->accessLock, OSAL_WAIT_FOREVER);
+    pSessionDesc->accessReaders--;
+    osalMutexUnlock(&pSessionDesc->accessLock);
+}
+
+void icp_sal_HostPerfSessionComplete(void *pSession)
+{
+    lac_session_desc_t *pSessionDesc = (lac_session_desc_t *)pSession;
+    icp_qat_fw_la_bulk_req_t msg;
+
+    msg.comn_mid.opaque_data = (Cpa64U)(LAC_ARCH_UINT)pSessionDesc->pSymCb;
+    msg.comn_mid.src_length = pSessionDesc->symOperation +
+                              pSessionDesc->cipherAlgorithm +
+                              pSessionDesc->hashResultSize +
+                              pSessionDesc->cipherKeyLenInBytes +
+                              pSessionDesc->digestVerify +
+                              pSessionDesc->digestIsAppended +
+                              pSessionDesc->internalSession;
+    __asm__ __volatile__("" : : "r"(&msg) : "memory");
+    osalAtomicDec(&pSessionDesc->u.pendingCbCount);
+}
+
+/*marks the cache lines of the descriptor the fields are in*/
+static void SalHostPerf_LinesMark(const sal_host_perf_field_t *pFields,
+                                  Cpa32U numFields,
+                                  Cpa8U *pRead,
+                                  Cpa8U *pWritten)
+{
+    Cpa32U i = 0;
+    Cpa32U line = 0;
+
+    for (i = 0; i < numFields; i++)
+    {
+        for (line = pFields[i].offset / LAC_64BYTE_ALIGNMENT;
+             line <= (pFields[i].offset + pFields[i].size - 1) /
+                         LAC_64BYTE_ALIGNMENT;
+             line++)
+        {
+            pRead[line] = 1;
+            if (CPA_TRUE == pFields[i].isWrite)
+            {
+                pWritten[line] = 1;
+            }
+        }
+    }
+}
+
+void icp_sal_HostPerfSessionLinesGet(
+    icp_sal_host_perf_session_lines_t *pLines)
+{
+    Cpa8U submitRead[SAL_HOST_PERF_SESSION_NUM_LINES] = {0};
+    Cpa8U submitWritten[SAL_HOST_PERF_SESSION_NUM_LINES] = {0};
+    Cpa8U completeRead[SAL_HOST_PERF_SESSION_NUM_LINES] = {0};
+    Cpa8U completeWritten[SAL_HOST_PERF_SESSION_NUM_LINES] = {0};
+    Cpa32U i = 0;
+
+    osalMemSet(pLines, 0, sizeof(icp_sal_host_perf_session_lines_t));
+    SalHostPerf_LinesMark(salHostPerfSubmitFields,
+                          sizeof(salHostPerfSubmitFields) /
+                              sizeof(salHostPerfSubmitFields[0]),
+                          submitRead,
+                          submitWritten);
+    SalHostPerf_LinesMark(salHostPerfCompleteFields,
+                          sizeof(salHostPerfCompleteFields) /
+                              sizeof(salHostPerfCompleteFields[0]),
+                          completeRead,
+                          completeWritten);
+    for (i = 0; i < SAL_HOST_PERF_SESSION_NUM_LINES; i++)
+    {
+        pLines->numSubmit += submitRead[i];
+        pLines->numSubmitWritten += submitWritten[i];
+        pLines->numComplete += completeRead[i];
+        pLines->numCompleteWritten += completeWritten[i];
+        if ((submitWritten[i] && completeRead[i]) ||
+            (completeWritten[i] && submitRead[i]))
+        {
+            pLines->numShared++;
+        }
+    }
+}
+
+void icp_sal_HostPerfSessionDestroy(void *pSession)
+{
+    lac_session_desc_t *pSessionDesc = (lac_session_desc_t *)pSession;
+
+    osalMutexDestroy(&pSessionDesc->accessLock);
+    LAC_OS_CAFREE(pSessionDesc);
+}
+#else
+CpaStatus icp_sal_HostPerfSessionCreate(void **ppSession)
+{
+    return CPA_STATUS_UNSUPPORTED;
+}
+
+void icp_sal_HostPerfSessionSubmit(void *pSession)
+{
+}
+
+void icp_sal_HostPerfSessionComplete(void *pSession)
+{
+}
+
+void icp_sal_HostPerfSessionLinesGet(
+    icp_sal_host_perf_session_lines_t *pLines)
+{
+    osalMemSet(pLines, 0, sizeof(icp_sal_host_perf_session_lines_t));
+}
+
+void icp_sal_HostPerfSessionDestroy(void *pSession)
+{
+}
+#endif
+
+CpaInstanceHandle icp_sal_HostPerfInstanceGet(void)
+{
+    return &salHostPerfService;
+}
+
+CpaStatus icp_sal_HostPerfBufferListDescWrite(
+    const CpaInstanceHandle instanceHandle,
+    CpaBufferList *pBufferList,
+    Cpa64U *pPhysAddr)
+{
+    LAC_CHECK_NULL_PARAM(instanceHandle);
+    LAC_CHECK_NULL_PARAM(pBufferList);
+    LAC_CHECK_NULL_PARAM(pPhysAddr);
+
+    return LacBuffDesc_BufferListDescWrite(
+        pBufferList, pPhysAddr, CPA_FALSE, (sal_service_t *)instanceHandle);
+}
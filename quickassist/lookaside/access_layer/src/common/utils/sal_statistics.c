@@ -168,6 +168,7 @@ CpaStatus SalStatistics_InitStatisticsCollection(icp_accel_dev_t *device)
     {
         pStatsCollection->bDcStatsEnabled = CPA_FALSE;
         pStatsCollection->bDhStatsEnabled = CPA_FALSE;
+        pStatsCollection->bDrbgStatsEnabled = CPA_FALSE;
         pStatsCollection->bDsaStatsEnabled = CPA_FALSE;
         pStatsCollection->bEccStatsEnabled = CPA_FALSE;
         pStatsCollection->bKeyGenStatsEnabled = CPA_FALSE;
@@ -240,6 +241,10 @@ CpaStatus SalStatistics_InitStatisticsCollection(icp_accel_dev_t *device)
         status = SalStatistics_GetStatEnabled(
             device, SAL_STATS_CFG_SYM, &pStatsCollection->bSymStatsEnabled);
         LAC_CHECK_STATUS(status);
+
+        status = SalStatistics_GetStatEnabled(
+            device, SAL_STATS_CFG_DRBG, &pStatsCollection->bDrbgStatsEnabled);
+        LAC_CHECK_STATUS(status);
     }
     return status;
 }
@@ -42,6 +42,9 @@
 #include <icp_accel_devices.h>
 #include <icp_adf_init.h>
 #include <icp_adf_transport.h>
+#ifdef _DEBUG_
+#include <pthread.h>
+#endif
 
 #define EMPTY_RING_SIG_BYTE 0x7f
 #define EMPTY_RING_SIG_WORD 0x7f7f7f7f
@@ -90,6 +93,7 @@ typedef struct adf_dev_ring_handle_s
     uint32_t pollingMask;
     uint32_t is_wireless : 1;
     uint32_t is_dyn : 1;
+    uint32_t is_exclusive : 1; /* only ever used by a single thread */
     adf_dev_bank_handle_t *bank_data;
 
     /* userspace shadow values */
@@ -106,6 +110,11 @@ typedef struct adf_dev_ring_handle_s
     uint32_t min_resps_per_head_write;
     /* the offset  of the actual csr tail */
     uint32_t csrTailOffset;
+#ifdef _DEBUG_
+    /* thread using an exclusive ring, for detecting misuse */
+    pthread_t owner_thread;
+    uint32_t owner_set;
+#endif
 
     uint32_t *csr_addr;
 } adf_dev_ring_handle_t;
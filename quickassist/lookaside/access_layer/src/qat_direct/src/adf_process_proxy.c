@@ -52,7 +52,9 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <pthread.h>
+#ifndef ICP_SW_DEVICE
 #include <libudev.h>
+#endif
 
 #include "cpa.h"
 #include "icp_accel_devices.h"
@@ -90,8 +92,10 @@
  */
 #define SLEEP_TIME 2000
 
+#ifndef ICP_SW_DEVICE
 STATIC struct udev *udev;
 STATIC struct udev_monitor *mon;
+#endif
 
 /*
  * Proxy init counter
@@ -143,6 +147,7 @@ STATIC inline Cpa32U adf_process_proxy_running(void)
     return (Cpa32U)osalAtomicGet(&process_proxy_status);
 }
 
+#ifndef ICP_SW_DEVICE
 STATIC CpaStatus adf_event_monitor_create(void)
 {
     int ret = CPA_STATUS_SUCCESS;
@@ -264,6 +269,22 @@ int adf_proxy_poll_event(Cpa32U *dev_id, enum adf_event *event)
     }
     return 0;
 }
+#else
+/* The software device raises no hotplug or reset events */
+STATIC CpaStatus adf_event_monitor_create(void)
+{
+    return CPA_STATUS_SUCCESS;
+}
+
+void adf_event_monitor_delete(void)
+{
+}
+
+int adf_proxy_poll_event(Cpa32U *dev_id, enum adf_event *event)
+{
+    return 0;
+}
+#endif
 
 /*
  * adf_process_proxy_init
@@ -378,6 +399,15 @@ CpaStatus icp_adf_userProcessToStart(char const *const name_tml, char *name)
         return CPA_STATUS_FAIL;
     }
 
+#ifdef ICP_SW_DEVICE
+    /* No kernel driver to arbitrate process sections, always take the
+     * first one */
+    snprintf(name,
+             ADF_CFG_MAX_SECTION_LEN_IN_BYTES,
+             "%s" ADF_INTERNAL_USERSPACE_SEC_SUFF "0",
+             name_tml);
+    return CPA_STATUS_SUCCESS;
+#endif
     if (osalMutexLock(&processes_lock, OSAL_WAIT_FOREVER))
     {
         ADF_ERROR("Mutex lock error %d\n", errno);
@@ -0,0 +1,2891 @@
+/***************************************************************************
+ *
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/*****************************************************************************
+ * @file adf_user_sw_device.c
+ *
+ * @description
+ *      Software QAT device used when the library is built with
+ *      ICP_SW_DEVICE. It replaces the UIO bundle, configuration and ring
+ *      control interfaces with in-memory equivalents and runs a responder
+ *      thread that services the request rings on the host, so the access
+ *      layer and the sample code can run on machines without a QAT device.
+ *
+ *****************************************************************************/
+#ifdef ICP_SW_DEVICE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+
+#include "cpa.h"
+#include "icp_platform.h"
+#include "icp_accel_devices.h"
+#include "icp_buffer_desc.h"
+#include "icp_qat_fw_la.h"
+#include "icp_qat_fw_comp.h"
+#include "icp_qat_fw_pke.h"
+#include "icp_qat_fw_mmp_ids.h"
+#include "icp_qat_hw.h"
+#include "adf_platform_common.h"
+#include "adf_platform_acceldev_common.h"
+#include "adf_dev_ring_ctl.h"
+#include "adf_cfg_user.h"
+#include "uio_user.h"
+#include "uio_user_cfg.h"
+
+#ifdef USE_OPENSSL
+#include <openssl/md5.h>
+#include <openssl/sha.h>
+#include <openssl/aes.h>
+#else
+#include "openssl/md5.h"
+#include "openssl/sha.h"
+#include "openssl/aes.h"
+#endif
+
+#ifdef USE_OPENSSL
+#define INIT(TYPE) TYPE##_Init
+#define UPDATE(TYPE) TYPE##_Update
+#define FINAL(TYPE) TYPE##_Final
+#define ADF_SW_AES_SET_ENCRYPT AES_set_encrypt_key
+#define ADF_SW_AES_SET_DECRYPT AES_set_decrypt_key
+#define ADF_SW_AES_ENCRYPT AES_encrypt
+#define ADF_SW_AES_DECRYPT AES_decrypt
+#else
+#define INIT(TYPE) ossl_##TYPE##_Init
+#define UPDATE(TYPE) ossl_##TYPE##_Update
+#define FINAL(TYPE) ossl_##TYPE##_Final
+#define ADF_SW_AES_SET_ENCRYPT ossl_AES_set_encrypt_key
+#define ADF_SW_AES_SET_DECRYPT ossl_AES_set_decrypt_key
+#define ADF_SW_AES_ENCRYPT ossl_AES_encrypt
+#define ADF_SW_AES_DECRYPT ossl_AES_decrypt
+#endif
+
+/*
+ * Number of software devices and of crypto and compression instances
+ * exposed on each of them. Every instance gets a bank of its own.
+ */
+#ifndef ADF_SW_NUM_DEVICES
+#define ADF_SW_NUM_DEVICES 1
+#endif
+#ifndef ADF_SW_NUM_CY_INSTANCES
+#define ADF_SW_NUM_CY_INSTANCES 1
+#endif
+#ifndef ADF_SW_NUM_DC_INSTANCES
+#define ADF_SW_NUM_DC_INSTANCES 1
+#endif
+
+#define ADF_SW_NUM_BANKS 16
+#define ADF_SW_NUM_RINGS_PER_BANK 16
+#define ADF_SW_NUM_TX_RINGS 8
+
+#if (ADF_SW_NUM_CY_INSTANCES + ADF_SW_NUM_DC_INSTANCES) > ADF_SW_NUM_BANKS
+#error "Software device instances exceed the number of banks"
+#endif
+
+/*
+ * Ring numbers handed out to the instances, responses go to tx + 8
+ */
+#define ADF_SW_RING_ASYM_TX 0
+#define ADF_SW_RING_SYM_TX 2
+#define ADF_SW_RING_DC_TX 6
+#define ADF_SW_RX_RING_OFFSET 8
+
+#define ADF_SW_NUM_SYM_REQUESTS 512
+#define ADF_SW_NUM_ASYM_REQUESTS 64
+#define ADF_SW_NUM_DC_REQUESTS 512
+
+/* Size of the CSR space of a bank, covers the arbiter enable register */
+#define ADF_SW_CSR_SIZE 0x2000
+#define ADF_SW_RING_SIZE_MASK 0x1F
+#define ADF_SW_RING_BASE_SHIFT 6
+
+#define ADF_SW_LA_REQ_SIZE 128
+#define ADF_SW_PKE_REQ_SIZE 64
+#define ADF_SW_RESP_SIZE 32
+#define ADF_SW_RESP_LW (ADF_SW_RESP_SIZE / sizeof(Cpa32U))
+/* Offset of the service type in both the common and the PKE header */
+#define ADF_SW_SERVICE_TYPE_OFFSET 2
+
+/* Responder back-off: yield for a while, then sleep between passes */
+#define ADF_SW_IDLE_SPINS 1000
+#define ADF_SW_IDLE_SLEEP_US 50
+
+#define ADF_SW_MAX_DIGEST_SIZE 64
+#define ADF_SW_MAX_KEY_SIZE 32
+#define ADF_SW_HMAC_BLOCK_BITS 512
+#define ADF_SW_HMAC_BLOCK_BITS_64 1024
+#define ADF_SW_QUADWORD_SHIFT 3
+
+/* Deflate stored blocks */
+#define ADF_SW_STORED_HDR_SIZE 5
+#define ADF_SW_STORED_MAX_LEN 0xFFFF
+#define ADF_SW_STORED_BFINAL 0x1
+
+/* Deflate block decoding */
+#define ADF_SW_BTYPE_STORED 0
+#define ADF_SW_BTYPE_FIXED 1
+#define ADF_SW_BTYPE_DYNAMIC 2
+#define ADF_SW_BITS_PER_BYTE 8
+#define ADF_SW_MAX_CODE_BITS 15
+#define ADF_SW_MAX_LIT_CODES 286
+#define ADF_SW_FIXED_LIT_CODES 288
+#define ADF_SW_MAX_DIST_CODES 30
+#define ADF_SW_NUM_CLEN_CODES 19
+#define ADF_SW_NUM_LEN_SYMS 29
+#define ADF_SW_END_OF_BLOCK 256
+
+/* PKE operands, the widest function is 4096 bits */
+#define ADF_SW_PKE_MAX_BITS 4096
+#define ADF_SW_PKE_OPERAND_SIZE(bits) ((((bits) + 63) / 64) * sizeof(Cpa64U))
+#define ADF_SW_BN_LIMB_BITS 32
+#define ADF_SW_BN_LIMBS(bytes) (((bytes) + sizeof(Cpa32U) - 1) / sizeof(Cpa32U))
+#define ADF_SW_BN_MAX_LIMBS (2 * ADF_SW_PKE_MAX_BITS / ADF_SW_BN_LIMB_BITS + 2)
+#define ADF_SW_GCD_PT_BOUND 1024
+#define ADF_SW_LUCAS_FIRST_D 5
+#define ADF_SW_LUCAS_MAX_D 1000
+
+#define ADF_SW_CRC32_POLY 0xEDB88320
+#define ADF_SW_ADLER_BASE 65521
+#define ADF_SW_ADLER_NMAX 5552
+
+#define ADF_SW_PTR(addr) ((void *)(UARCH_INT)(addr))
+#define ADF_SW_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define ADF_SW_ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+typedef struct adf_sw_bank_s
+{
+    struct adf_uio_user_bundle bundle;
+    Cpa32U csr[ADF_SW_CSR_SIZE / sizeof(Cpa32U)];
+    Cpa32U enabled;
+    Cpa32U req_head[ADF_SW_NUM_TX_RINGS];
+    Cpa32U resp_tail[ADF_SW_NUM_TX_RINGS];
+} adf_sw_bank_t;
+
+typedef struct adf_sw_buf_s
+{
+    Cpa8U *data;
+    Cpa32U size;
+} adf_sw_buf_t;
+
+typedef struct adf_sw_device_s
+{
+    pthread_t responder;
+    ICP_MUTEX lock;
+    volatile Cpa32U running;
+    adf_sw_bank_t banks[ADF_SW_NUM_BANKS];
+    adf_sw_buf_t src;
+    adf_sw_buf_t dst;
+} adf_sw_device_t;
+
+/* Canonical Huffman code: number of codes per length, symbols by code */
+typedef struct adf_sw_huff_s
+{
+    Cpa16U count[ADF_SW_MAX_CODE_BITS + 1];
+    Cpa16U symbol[ADF_SW_FIXED_LIT_CODES];
+} adf_sw_huff_t;
+
+typedef struct adf_sw_inflate_s
+{
+    const Cpa8U *src;
+    Cpa32U src_len;
+    Cpa32U in;
+    Cpa32U bitbuf;
+    Cpa32U bitcnt;
+    CpaBoolean overrun;
+    Cpa8U *dst;
+    Cpa32U dst_len;
+    Cpa32U out;
+} adf_sw_inflate_t;
+
+typedef struct adf_sw_bn_s
+{
+    Cpa32U len;
+    Cpa32U d[ADF_SW_BN_MAX_LIMBS];
+} adf_sw_bn_t;
+
+typedef enum adf_sw_pke_op_e
+{
+    ADF_SW_PKE_MODEXP,
+    ADF_SW_PKE_MODEXP_G2,
+    ADF_SW_PKE_RSA_KP1,
+    ADF_SW_PKE_RSA_KP2,
+    ADF_SW_PKE_RSA_DP2,
+    ADF_SW_PKE_GCD_PT,
+    ADF_SW_PKE_FERMAT_PT,
+    ADF_SW_PKE_MR_PT,
+    ADF_SW_PKE_LUCAS_PT
+} adf_sw_pke_op_t;
+
+typedef struct adf_sw_pke_func_s
+{
+    Cpa32U func_id;
+    adf_sw_pke_op_t op;
+    Cpa32U bits;
+} adf_sw_pke_func_t;
+
+typedef struct adf_sw_la_op_s
+{
+    Cpa32U cipher_algo;
+    Cpa32U cipher_mode;
+    Cpa32U cipher_dir;
+    Cpa32U cipher_convert;
+    const Cpa8U *key;
+    Cpa32U auth_algo;
+    Cpa32U auth_mode;
+    const Cpa8U *state1;
+    const Cpa8U *state2;
+} adf_sw_la_op_t;
+
+/*
+ * Content descriptor layouts kept in the firmware shared RAM, indexed by
+ * the cipher and hash config offsets LAC writes when
+ * ICP_QAT_FW_CIPH_AUTH_CFG_OFFSET_IN_SHRAM_CP is set. Only the AES and
+ * hash entries the emulator implements are listed.
+ */
+typedef struct adf_sw_shram_cipher_s
+{
+    Cpa8U offset;
+    Cpa8U algo;
+    Cpa8U mode;
+    Cpa8U dir;
+} adf_sw_shram_cipher_t;
+
+typedef struct adf_sw_shram_auth_s
+{
+    Cpa8U offset;
+    Cpa8U algo;
+    Cpa8U mode;
+} adf_sw_shram_auth_t;
+
+STATIC const adf_sw_shram_cipher_t adf_sw_shram_cipher_tbl[] = {
+    {14, ICP_QAT_HW_CIPHER_ALGO_AES128, ICP_QAT_HW_CIPHER_ECB_MODE,
+     ICP_QAT_HW_CIPHER_ENCRYPT},
+    {15, ICP_QAT_HW_CIPHER_ALGO_AES128, ICP_QAT_HW_CIPHER_ECB_MODE,
+     ICP_QAT_HW_CIPHER_ENCRYPT},
+    {17, ICP_QAT_HW_CIPHER_ALGO_AES128, ICP_QAT_HW_CIPHER_ECB_MODE,
+     ICP_QAT_HW_CIPHER_DECRYPT},
+    {18, ICP_QAT_HW_CIPHER_ALGO_AES128, ICP_QAT_HW_CIPHER_CBC_MODE,
+     ICP_QAT_HW_CIPHER_ENCRYPT},
+    {19, ICP_QAT_HW_CIPHER_ALGO_AES128, ICP_QAT_HW_CIPHER_CBC_MODE,
+     ICP_QAT_HW_CIPHER_ENCRYPT},
+    {21, ICP_QAT_HW_CIPHER_ALGO_AES128, ICP_QAT_HW_CIPHER_CBC_MODE,
+     ICP_QAT_HW_CIPHER_DECRYPT},
+    {22, ICP_QAT_HW_CIPHER_ALGO_AES128, ICP_QAT_HW_CIPHER_CTR_MODE,
+     ICP_QAT_HW_CIPHER_ENCRYPT}};
+
+STATIC const adf_sw_shram_auth_t adf_sw_shram_auth_tbl[] = {
+    {37, ICP_QAT_HW_AUTH_ALGO_MD5, ICP_QAT_HW_AUTH_MODE0},
+    {41, ICP_QAT_HW_AUTH_ALGO_SHA1, ICP_QAT_HW_AUTH_MODE0},
+    {46, ICP_QAT_HW_AUTH_ALGO_SHA1, ICP_QAT_HW_AUTH_MODE1},
+    {48, ICP_QAT_HW_AUTH_ALGO_SHA224, ICP_QAT_HW_AUTH_MODE0},
+    {54, ICP_QAT_HW_AUTH_ALGO_SHA256, ICP_QAT_HW_AUTH_MODE0},
+    {60, ICP_QAT_HW_AUTH_ALGO_SHA384, ICP_QAT_HW_AUTH_MODE0},
+    {70, ICP_QAT_HW_AUTH_ALGO_SHA512, ICP_QAT_HW_AUTH_MODE0}};
+
+STATIC adf_sw_device_t sw_devices[ADF_SW_NUM_DEVICES];
+STATIC Cpa32U adf_sw_crc32_tbl[256];
+
+/*
+ * adf_sw_get_num_devices
+ * Number of software devices, reported in place of the kernel ioctl
+ */
+Cpa32U adf_sw_get_num_devices(void)
+{
+    return ADF_SW_NUM_DEVICES;
+}
+
+/*
+ * Bundle interface
+ */
+struct adf_uio_user_bundle *uio_get_bundle_from_accelid(int accelid,
+                                                        int bundle_nr)
+{
+    if (accelid < 0 || accelid >= ADF_SW_NUM_DEVICES || bundle_nr < 0 ||
+        bundle_nr >= ADF_SW_NUM_BANKS)
+        return NULL;
+
+    return &sw_devices[accelid].banks[bundle_nr].bundle;
+}
+
+void uio_free_bundle(struct adf_uio_user_bundle *bundle)
+{
+    /* Bundles are part of the device, released in uio_destroy_accel_dev */
+    (void)bundle;
+}
+
+int uio_acces_dev_exist(int dev_id, struct udev_device **udev_dev)
+{
+    if (udev_dev)
+        *udev_dev = NULL;
+
+    return (dev_id >= 0 && dev_id < ADF_SW_NUM_DEVICES);
+}
+
+STATIC void adf_sw_crc32_init(void)
+{
+    Cpa32U i = 0, j = 0, crc = 0;
+
+    for (i = 0; i < 256; i++)
+    {
+        crc = i;
+        for (j = 0; j < 8; j++)
+            crc = (crc & 1) ? (crc >> 1) ^ ADF_SW_CRC32_POLY : crc >> 1;
+        adf_sw_crc32_tbl[i] = crc;
+    }
+}
+
+STATIC int adf_sw_populate_accel_dev(icp_accel_dev_t *accel_dev, int dev_id)
+{
+    char config_value[ADF_CFG_MAX_VAL_LEN_IN_BYTES];
+
+    memset(accel_dev, '\0', sizeof(*accel_dev));
+    accel_dev->accelId = dev_id;
+    accel_dev->maxNumRingsPerBank = ADF_SW_NUM_RINGS_PER_BANK;
+
+    if (CPA_STATUS_SUCCESS !=
+        icp_adf_cfgGetParamValue(
+            accel_dev, ADF_GENERAL_SEC, ADF_DEV_MAX_BANKS, config_value))
+    {
+        return -EINVAL;
+    }
+    accel_dev->maxNumBanks =
+        (Cpa32U)strtoul(config_value, NULL, ADF_CFG_BASE_DEC);
+
+    if (CPA_STATUS_SUCCESS !=
+        icp_adf_cfgGetParamValue(accel_dev,
+                                 ADF_GENERAL_SEC,
+                                 ADF_DEV_CAPABILITIES_MASK,
+                                 config_value))
+    {
+        return -EINVAL;
+    }
+    accel_dev->accelCapabilitiesMask =
+        (Cpa32U)strtoul(config_value, NULL, ADF_CFG_BASE_HEX);
+
+    if (CPA_STATUS_SUCCESS !=
+        icp_adf_cfgGetParamValue(
+            accel_dev, ADF_GENERAL_SEC, ADF_DC_EXTENDED_FEATURES, config_value))
+    {
+        return -EINVAL;
+    }
+    accel_dev->dcExtendedFeatures =
+        (Cpa32U)strtoul(config_value, NULL, ADF_CFG_BASE_HEX);
+
+    accel_dev->deviceType = DEVICE_C62X;
+    ICP_STRNCPY(accel_dev->deviceName, "c6xx", ADF_DEVICE_TYPE_LENGTH);
+    accel_dev->revisionId = 0;
+    accel_dev->numa_node = 0;
+
+    return 0;
+}
+
+int uio_create_accel_dev(icp_accel_dev_t **accel_dev, int dev_id)
+{
+    adf_sw_device_t *dev = NULL;
+    Cpa32U i = 0;
+
+    if (!uio_acces_dev_exist(dev_id, NULL))
+        return -EINVAL;
+
+    *accel_dev = ICP_MALLOC_GEN(sizeof(**accel_dev));
+    if (!*accel_dev)
+        return -ENOMEM;
+
+    if (adf_sw_populate_accel_dev(*accel_dev, dev_id))
+    {
+        ICP_FREE(*accel_dev);
+        *accel_dev = NULL;
+        return -EINVAL;
+    }
+
+    if (0 == adf_sw_crc32_tbl[1])
+        adf_sw_crc32_init();
+
+    dev = &sw_devices[dev_id];
+    ICP_MEMSET(dev, 0, sizeof(*dev));
+    for (i = 0; i < ADF_SW_NUM_BANKS; i++)
+    {
+        dev->banks[i].bundle.device_minor = i;
+        dev->banks[i].bundle.fd = -1;
+        dev->banks[i].bundle.ptr = dev->banks[i].csr;
+        /* No ring holds responses yet */
+        ICP_ADF_CSR_WR(dev->banks[i].csr, ICP_RING_CSR_E_STAT, ~0U);
+    }
+    if (ICP_MUTEX_INIT(&dev->lock))
+    {
+        ADF_ERROR("Failed to init software device mutex\n");
+        ICP_FREE(*accel_dev);
+        *accel_dev = NULL;
+        return -ENOMEM;
+    }
+
+    return 0;
+}
+
+/* The responder is started with the first ring and stopped here */
+void uio_destroy_accel_dev(icp_accel_dev_t *accel_dev)
+{
+    adf_sw_device_t *dev = &sw_devices[accel_dev->accelId];
+
+    if (dev->running)
+    {
+        dev->running = 0;
+        pthread_join(dev->responder, NULL);
+    }
+    ICP_MUTEX_UNINIT(&dev->lock);
+    ICP_FREE(dev->src.data);
+    ICP_FREE(dev->dst.data);
+    dev->src.size = 0;
+    dev->dst.size = 0;
+    ICP_FREE(accel_dev);
+}
+
+/*
+ * Configuration interface
+ * Every process section gets ADF_SW_NUM_CY_INSTANCES polled crypto
+ * instances on the first banks and ADF_SW_NUM_DC_INSTANCES polled
+ * compression instances on the banks after them.
+ */
+#define ADF_SW_LO_COMPAT_DRV_KEY "Lowest_Compat_Drv_Ver"
+#define ADF_SW_STATS_KEY_PREFIX "stats"
+#define ADF_SW_VERSION_STR "4.5.0"
+/* Process section keys can be set from the environment as ADF_SW_<key>,
+ * e.g. ADF_SW_Cy0SymHostFallback=2, there is no configuration file */
+#define ADF_SW_CFG_ENV_PREFIX "ADF_SW_"
+
+#define ADF_SW_CFG_SET(value, fmt, ...)                                        \
+    snprintf(value, ADF_CFG_MAX_VAL_LEN_IN_BYTES, fmt, __VA_ARGS__)
+
+STATIC CpaStatus adf_sw_cfg_general(const char *param, char *value)
+{
+    if (!strcmp(param, ADF_DEV_MAX_BANKS))
+    {
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_NUM_BANKS);
+    }
+    else if (!strcmp(param, ADF_DEV_CAPABILITIES_MASK))
+    {
+        ADF_SW_CFG_SET(value,
+                       "0x%x",
+                       ICP_ACCEL_CAPABILITIES_CRYPTO_SYMMETRIC |
+                           ICP_ACCEL_CAPABILITIES_CRYPTO_ASYMMETRIC |
+                           ICP_ACCEL_CAPABILITIES_CIPHER |
+                           ICP_ACCEL_CAPABILITIES_AUTHENTICATION |
+                           ICP_ACCEL_CAPABILITIES_COMPRESSION |
+                           ICP_ACCEL_CAPABILITIES_RANDOM_NUMBER);
+    }
+    else if (!strcmp(param, ADF_DC_EXTENDED_FEATURES))
+    {
+        ADF_SW_CFG_SET(value, "0x%x", 0);
+    }
+    else if (!strcmp(param, ADF_DEV_NODE_ID) || !strcmp(param, ADF_DEV_PKG_ID))
+    {
+        ADF_SW_CFG_SET(value, "%d", 0);
+    }
+    else if (!strcmp(param, ADF_SERVICES_ENABLED))
+    {
+        ADF_SW_CFG_SET(value, "%s", ADF_CFG_CY ";" ADF_CFG_DC);
+    }
+    else if (!strcmp(param, ADF_HW_REV_ID_KEY))
+    {
+        ADF_SW_CFG_SET(value, "%s", "sw");
+    }
+    else if (!strcmp(param, ADF_UOF_VER_KEY) ||
+             !strcmp(param, ADF_MMP_VER_KEY) ||
+             !strcmp(param, ADF_SW_LO_COMPAT_DRV_KEY))
+    {
+        ADF_SW_CFG_SET(value, "%s", ADF_SW_VERSION_STR);
+    }
+    else if (!strncmp(param,
+                      ADF_SW_STATS_KEY_PREFIX,
+                      sizeof(ADF_SW_STATS_KEY_PREFIX) - 1))
+    {
+        ADF_SW_CFG_SET(value, "%d", 1);
+    }
+    else
+    {
+        return CPA_STATUS_FAIL;
+    }
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Splits "<prefix><instance><key>" into instance number and key */
+STATIC const char *adf_sw_cfg_instance_key(const char *param,
+                                           const char *prefix,
+                                           Cpa32U *instance)
+{
+    size_t len = strlen(prefix);
+    char *key = NULL;
+
+    if (strncmp(param, prefix, len) || param[len] < '0' || param[len] > '9')
+        return NULL;
+
+    *instance = (Cpa32U)strtoul(param + len, &key, ADF_CFG_BASE_DEC);
+
+    return key;
+}
+
+/* Returns the value of a process section key set in the environment */
+STATIC CpaStatus adf_sw_cfg_env(const char *param, char *value)
+{
+    char name[sizeof(ADF_SW_CFG_ENV_PREFIX) + ADF_CFG_MAX_KEY_LEN_IN_BYTES];
+    const char *env = NULL;
+
+    snprintf(name, sizeof(name), ADF_SW_CFG_ENV_PREFIX "%s", param);
+    env = getenv(name);
+    if (NULL == env)
+        return CPA_STATUS_FAIL;
+
+    ADF_SW_CFG_SET(value, "%s", env);
+
+    return CPA_STATUS_SUCCESS;
+}
+
+STATIC CpaStatus adf_sw_cfg_cy(Cpa32U inst, const char *key, char *value)
+{
+    if (inst >= ADF_SW_NUM_CY_INSTANCES)
+        return CPA_STATUS_FAIL;
+
+    if (!strcmp(key, "Name"))
+        ADF_SW_CFG_SET(value, ADF_CY "%u", inst);
+    else if (!strcmp(key, ADF_POLL_MODE))
+        ADF_SW_CFG_SET(value, "%d", 1);
+    else if (!strcmp(key, ADF_RING_BANK_NUM) ||
+             !strcmp(key, ADF_ETRMGR_CORE_AFFINITY))
+        ADF_SW_CFG_SET(value, "%u", inst);
+    else if (!strcmp(key, ADF_RING_SYM_SIZE))
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_NUM_SYM_REQUESTS);
+    else if (!strcmp(key, ADF_RING_ASYM_SIZE))
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_NUM_ASYM_REQUESTS);
+    else if (!strcmp(key, ADF_RING_ASYM_TX))
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_RING_ASYM_TX);
+    else if (!strcmp(key, ADF_RING_SYM_TX))
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_RING_SYM_TX);
+    else if (!strcmp(key, ADF_RING_ASYM_RX))
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_RING_ASYM_TX + ADF_SW_RX_RING_OFFSET);
+    else if (!strcmp(key, ADF_RING_SYM_RX))
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_RING_SYM_TX + ADF_SW_RX_RING_OFFSET);
+    else
+        return CPA_STATUS_FAIL;
+
+    return CPA_STATUS_SUCCESS;
+}
+
+STATIC CpaStatus adf_sw_cfg_dc(Cpa32U inst, const char *key, char *value)
+{
+    if (inst >= ADF_SW_NUM_DC_INSTANCES)
+        return CPA_STATUS_FAIL;
+
+    if (!strcmp(key, "Name"))
+        ADF_SW_CFG_SET(value, ADF_DC "%u", inst);
+    else if (!strcmp(key, ADF_POLL_MODE))
+        ADF_SW_CFG_SET(value, "%d", 1);
+    else if (!strcmp(key, ADF_RING_BANK_NUM))
+        ADF_SW_CFG_SET(value, "%u", ADF_SW_NUM_CY_INSTANCES + inst);
+    else if (!strcmp(key, ADF_ETRMGR_CORE_AFFINITY))
+        ADF_SW_CFG_SET(value, "%u", inst);
+    else if (!strcmp(key, ADF_RING_DC_SIZE))
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_NUM_DC_REQUESTS);
+    else if (!strcmp(key, ADF_RING_DC_TX))
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_RING_DC_TX);
+    else if (!strcmp(key, ADF_RING_DC_RX))
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_RING_DC_TX + ADF_SW_RX_RING_OFFSET);
+    else
+        return CPA_STATUS_FAIL;
+
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus icp_adf_cfgGetParamValue(icp_accel_dev_t *accel_dev,
+                                   const char *section,
+                                   const char *param,
+                                   char *value)
+{
+    const char *key = NULL;
+    Cpa32U inst = 0;
+
+    ICP_CHECK_FOR_NULL_PARAM(section);
+    ICP_CHECK_FOR_NULL_PARAM(param);
+    ICP_CHECK_FOR_NULL_PARAM(value);
+    (void)accel_dev;
+
+    if (!strcmp(section, ADF_GENERAL_SEC))
+        return adf_sw_cfg_general(param, value);
+
+    /* Any other section is the section of this process */
+    if (!strcmp(param, ADF_NUM_CY))
+    {
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_NUM_CY_INSTANCES);
+        return CPA_STATUS_SUCCESS;
+    }
+    if (!strcmp(param, ADF_NUM_DC))
+    {
+        ADF_SW_CFG_SET(value, "%d", ADF_SW_NUM_DC_INSTANCES);
+        return CPA_STATUS_SUCCESS;
+    }
+    if (CPA_STATUS_SUCCESS == adf_sw_cfg_env(param, value))
+        return CPA_STATUS_SUCCESS;
+    if ((key = adf_sw_cfg_instance_key(param, ADF_CY, &inst)))
+        return adf_sw_cfg_cy(inst, key, value);
+    if ((key = adf_sw_cfg_instance_key(param, ADF_DC, &inst)))
+        return adf_sw_cfg_dc(inst, key, value);
+
+    return CPA_STATUS_FAIL;
+}
+
+Cpa32S icp_adf_cfgGetDomainAddress(Cpa16U packageId)
+{
+    return 0;
+}
+
+Cpa16U icp_adf_cfgGetBusAddress(Cpa16U packageId)
+{
+    return 0;
+}
+
+Cpa32U icp_adf_cfgGetKptAcHandle(Cpa16U packageId)
+{
+    return 0;
+}
+
+/*
+ * Ring control interface
+ */
+STATIC void *adf_sw_responder(void *arg);
+
+CpaStatus icp_adf_reserve_ring(Cpa16U accel_id, Cpa16U bank_nr, Cpa16U ring_nr)
+{
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus icp_adf_release_ring(Cpa16U accel_id, Cpa16U bank_nr, Cpa16U ring_nr)
+{
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus icp_adf_enable_ring(Cpa16U accel_id, Cpa16U bank_nr, Cpa16U ring_nr)
+{
+    adf_sw_device_t *dev = NULL;
+    adf_sw_bank_t *bank = NULL;
+
+    if (accel_id >= ADF_SW_NUM_DEVICES || bank_nr >= ADF_SW_NUM_BANKS ||
+        ring_nr >= ADF_SW_NUM_RINGS_PER_BANK)
+        return CPA_STATUS_INVALID_PARAM;
+
+    dev = &sw_devices[accel_id];
+    bank = &dev->banks[bank_nr];
+
+    if (ICP_MUTEX_LOCK(&dev->lock))
+        return CPA_STATUS_FAIL;
+    if (ring_nr < ADF_SW_NUM_TX_RINGS)
+        bank->req_head[ring_nr] = 0;
+    else
+        bank->resp_tail[ring_nr - ADF_SW_RX_RING_OFFSET] = 0;
+    bank->enabled |= (1 << ring_nr);
+
+    if (!dev->running)
+    {
+        dev->running = 1;
+        if (pthread_create(&dev->responder, NULL, adf_sw_responder, dev))
+        {
+            ADF_ERROR("Failed to start software device responder\n");
+            dev->running = 0;
+            bank->enabled &= ~(1 << ring_nr);
+            ICP_MUTEX_UNLOCK(&dev->lock);
+            return CPA_STATUS_FAIL;
+        }
+    }
+    ICP_MUTEX_UNLOCK(&dev->lock);
+
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus icp_adf_disable_ring(Cpa16U accel_id, Cpa16U bank_nr, Cpa16U ring_nr)
+{
+    adf_sw_device_t *dev = NULL;
+
+    if (accel_id >= ADF_SW_NUM_DEVICES || bank_nr >= ADF_SW_NUM_BANKS ||
+        ring_nr >= ADF_SW_NUM_RINGS_PER_BANK)
+        return CPA_STATUS_INVALID_PARAM;
+
+    dev = &sw_devices[accel_id];
+    if (ICP_MUTEX_LOCK(&dev->lock))
+        return CPA_STATUS_FAIL;
+    dev->banks[bank_nr].enabled &= ~(1 << ring_nr);
+    ICP_MUTEX_UNLOCK(&dev->lock);
+
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus icp_adf_reset_device(Cpa32U accelId)
+{
+    return CPA_STATUS_UNSUPPORTED;
+}
+
+/*
+ * Buffer helpers
+ * Physical addresses handed to the device are virtual addresses with the
+ * software USDM backend, so descriptors are dereferenced directly.
+ */
+STATIC Cpa32U adf_sw_buf_len(Cpa64U addr, Cpa32U flat_len, CpaBoolean is_sgl)
+{
+    const icp_buffer_list_desc_t *list = ADF_SW_PTR(addr);
+    Cpa32U len = 0, i = 0;
+
+    if (!is_sgl)
+        return flat_len;
+
+    for (i = 0; i < list->numBuffers; i++)
+        len += list->phyBuffers[i].dataLenInBytes;
+
+    return len;
+}
+
+/* Copies len bytes between a flat or SGL buffer and linear memory */
+STATIC void adf_sw_buf_copy(Cpa64U addr,
+                            CpaBoolean is_sgl,
+                            Cpa8U *data,
+                            Cpa32U len,
+                            CpaBoolean to_buf)
+{
+    const icp_buffer_list_desc_t *list = ADF_SW_PTR(addr);
+    Cpa32U i = 0, chunk = 0;
+    Cpa8U *buf = NULL;
+
+    if (!is_sgl)
+    {
+        buf = ADF_SW_PTR(addr);
+        if (to_buf)
+            memcpy(buf, data, len);
+        else
+            memcpy(data, buf, len);
+        return;
+    }
+
+    for (i = 0; i < list->numBuffers && len > 0; i++)
+    {
+        buf = ADF_SW_PTR(list->phyBuffers[i].phyBuffer);
+        chunk = ADF_SW_MIN(len, list->phyBuffers[i].dataLenInBytes);
+        if (to_buf)
+            memcpy(buf, data, chunk);
+        else
+            memcpy(data, buf, chunk);
+        data += chunk;
+        len -= chunk;
+    }
+}
+
+STATIC Cpa8U *adf_sw_scratch(adf_sw_buf_t *scratch, Cpa32U len)
+{
+    if (scratch->size < len || NULL == scratch->data)
+    {
+        ICP_FREE(scratch->data);
+        scratch->size = 0;
+        scratch->data = ICP_MALLOC_GEN(len ? len : 1);
+        if (NULL == scratch->data)
+            return NULL;
+        scratch->size = len;
+    }
+
+    return scratch->data;
+}
+
+STATIC inline Cpa32U adf_sw_be32(const Cpa8U *p)
+{
+    return ((Cpa32U)p[0] << 24) | ((Cpa32U)p[1] << 16) | ((Cpa32U)p[2] << 8) |
+           (Cpa32U)p[3];
+}
+
+STATIC inline Cpa64U adf_sw_be64(const Cpa8U *p)
+{
+    return ((Cpa64U)adf_sw_be32(p) << 32) | adf_sw_be32(p + 4);
+}
+
+STATIC inline Cpa32U adf_sw_le32(const Cpa8U *p)
+{
+    return ((Cpa32U)p[3] << 24) | ((Cpa32U)p[2] << 16) | ((Cpa32U)p[1] << 8) |
+           (Cpa32U)p[0];
+}
+
+/*
+ * adf_sw_hash
+ * Hashes data starting from the given precomputed block state, or from the
+ * initial state when state is NULL. Returns the digest size, 0 if the
+ * algorithm is not supported.
+ */
+STATIC Cpa32U adf_sw_hash(Cpa32U algo,
+                          const Cpa8U *state,
+                          const Cpa8U *data,
+                          Cpa32U len,
+                          Cpa8U *digest)
+{
+    Cpa32U i = 0;
+
+    switch (algo)
+    {
+        case ICP_QAT_HW_AUTH_ALGO_MD5:
+        {
+            MD5_CTX ctx;
+
+            INIT(MD5)(&ctx);
+            if (state)
+            {
+                ctx.A = adf_sw_le32(state);
+                ctx.B = adf_sw_le32(state + 4);
+                ctx.C = adf_sw_le32(state + 8);
+                ctx.D = adf_sw_le32(state + 12);
+                ctx.Nl = ADF_SW_HMAC_BLOCK_BITS;
+            }
+            UPDATE(MD5)(&ctx, data, len);
+            FINAL(MD5)(digest, &ctx);
+            return MD5_DIGEST_LENGTH;
+        }
+        case ICP_QAT_HW_AUTH_ALGO_SHA1:
+        {
+            SHA_CTX ctx;
+
+            INIT(SHA1)(&ctx);
+            if (state)
+            {
+                ctx.h0 = adf_sw_be32(state);
+                ctx.h1 = adf_sw_be32(state + 4);
+                ctx.h2 = adf_sw_be32(state + 8);
+                ctx.h3 = adf_sw_be32(state + 12);
+                ctx.h4 = adf_sw_be32(state + 16);
+                ctx.Nl = ADF_SW_HMAC_BLOCK_BITS;
+            }
+            UPDATE(SHA1)(&ctx, data, len);
+            FINAL(SHA1)(digest, &ctx);
+            return SHA_DIGEST_LENGTH;
+        }
+        case ICP_QAT_HW_AUTH_ALGO_SHA224:
+        case ICP_QAT_HW_AUTH_ALGO_SHA256:
+        {
+            SHA256_CTX ctx;
+
+            if (ICP_QAT_HW_AUTH_ALGO_SHA224 == algo)
+                INIT(SHA224)(&ctx);
+            else
+                INIT(SHA256)(&ctx);
+            if (state)
+            {
+                for (i = 0; i < 8; i++)
+                    ctx.h[i] = adf_sw_be32(state + i * sizeof(Cpa32U));
+                ctx.Nl = ADF_SW_HMAC_BLOCK_BITS;
+            }
+            /* SHA224_Final is SHA256_Final, the context carries md_len */
+            UPDATE(SHA256)(&ctx, data, len);
+            FINAL(SHA256)(digest, &ctx);
+            return (ICP_QAT_HW_AUTH_ALGO_SHA224 == algo)
+                       ? SHA224_DIGEST_LENGTH
+                       : SHA256_DIGEST_LENGTH;
+        }
+        case ICP_QAT_HW_AUTH_ALGO_SHA384:
+        case ICP_QAT_HW_AUTH_ALGO_SHA512:
+        {
+            SHA512_CTX ctx;
+
+            if (ICP_QAT_HW_AUTH_ALGO_SHA384 == algo)
+                INIT(SHA384)(&ctx);
+            else
+                INIT(SHA512)(&ctx);
+            if (state)
+            {
+                for (i = 0; i < 8; i++)
+                    ctx.h[i] = adf_sw_be64(state + i * sizeof(Cpa64U));
+                ctx.Nl = ADF_SW_HMAC_BLOCK_BITS_64;
+            }
+            /* Likewise SHA384 finishes through SHA512_Final */
+            UPDATE(SHA512)(&ctx, data, len);
+            FINAL(SHA512)(digest, &ctx);
+            return (ICP_QAT_HW_AUTH_ALGO_SHA384 == algo)
+                       ? SHA384_DIGEST_LENGTH
+                       : SHA512_DIGEST_LENGTH;
+        }
+        default:
+            return 0;
+    }
+}
+
+/*
+ * adf_sw_cipher
+ * Runs the AES or NULL cipher in place, updating the IV for CBC and CTR.
+ */
+STATIC CpaBoolean adf_sw_cipher(const adf_sw_la_op_t *op,
+                                Cpa8U *iv,
+                                Cpa8U *data,
+                                Cpa32U len)
+{
+    AES_KEY aes_key;
+    Cpa8U block[AES_BLOCK_SIZE];
+    Cpa32U bits = 0, off = 0, i = 0, chunk = 0;
+    CpaBoolean decrypt = (ICP_QAT_HW_CIPHER_DECRYPT == op->cipher_dir);
+
+    switch (op->cipher_algo)
+    {
+        case ICP_QAT_HW_CIPHER_ALGO_NULL:
+            return CPA_TRUE;
+        case ICP_QAT_HW_CIPHER_ALGO_AES128:
+            bits = 128;
+            break;
+        case ICP_QAT_HW_CIPHER_ALGO_AES192:
+            bits = 192;
+            break;
+        case ICP_QAT_HW_CIPHER_ALGO_AES256:
+            bits = 256;
+            break;
+        default:
+            return CPA_FALSE;
+    }
+
+    if (ICP_QAT_HW_CIPHER_CTR_MODE == op->cipher_mode)
+    {
+        ADF_SW_AES_SET_ENCRYPT(op->key, bits, &aes_key);
+        for (off = 0; off < len; off += chunk)
+        {
+            ADF_SW_AES_ENCRYPT(iv, block, &aes_key);
+            chunk = ADF_SW_MIN(len - off, AES_BLOCK_SIZE);
+            for (i = 0; i < chunk; i++)
+                data[off + i] ^= block[i];
+            for (i = AES_BLOCK_SIZE; i > 0 && 0 == ++iv[i - 1]; i--)
+                ;
+        }
+        return CPA_TRUE;
+    }
+
+    if ((ICP_QAT_HW_CIPHER_ECB_MODE != op->cipher_mode &&
+         ICP_QAT_HW_CIPHER_CBC_MODE != op->cipher_mode) ||
+        (len % AES_BLOCK_SIZE) ||
+        (decrypt && ICP_QAT_HW_CIPHER_KEY_CONVERT != op->cipher_convert))
+        return CPA_FALSE;
+
+    if (decrypt)
+        ADF_SW_AES_SET_DECRYPT(op->key, bits, &aes_key);
+    else
+        ADF_SW_AES_SET_ENCRYPT(op->key, bits, &aes_key);
+
+    for (off = 0; off < len; off += AES_BLOCK_SIZE)
+    {
+        if (ICP_QAT_HW_CIPHER_ECB_MODE == op->cipher_mode)
+        {
+            if (decrypt)
+                ADF_SW_AES_DECRYPT(data + off, data + off, &aes_key);
+            else
+                ADF_SW_AES_ENCRYPT(data + off, data + off, &aes_key);
+        }
+        else if (decrypt)
+        {
+            memcpy(block, data + off, AES_BLOCK_SIZE);
+            ADF_SW_AES_DECRYPT(data + off, data + off, &aes_key);
+            for (i = 0; i < AES_BLOCK_SIZE; i++)
+                data[off + i] ^= iv[i];
+            memcpy(iv, block, AES_BLOCK_SIZE);
+        }
+        else
+        {
+            for (i = 0; i < AES_BLOCK_SIZE; i++)
+                data[off + i] ^= iv[i];
+            ADF_SW_AES_ENCRYPT(data + off, data + off, &aes_key);
+            memcpy(iv, data + off, AES_BLOCK_SIZE);
+        }
+    }
+
+    return CPA_TRUE;
+}
+
+/*
+ * adf_sw_la_decode
+ * Extracts the cipher and auth setup either from the content descriptor
+ * or, for the optimised layouts, from the shared RAM tables.
+ */
+STATIC CpaBoolean adf_sw_la_decode(const icp_qat_fw_la_bulk_req_t *req,
+                                   CpaBoolean do_cipher,
+                                   CpaBoolean do_auth,
+                                   adf_sw_la_op_t *op)
+{
+    const icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *cd_ctrl =
+        (const icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *)&req->cd_ctrl;
+    Cpa16U la_flags = req->comn_hdr.serv_specif_flags;
+    const Cpa8U *cd = ADF_SW_PTR(req->cd_pars.s.content_desc_addr);
+    const icp_qat_hw_cipher_config_t *cipher_cfg = NULL;
+    const icp_qat_hw_auth_setup_t *auth_setup = NULL;
+    Cpa32U i = 0, key_len = 0;
+
+    if (ICP_QAT_FW_CIPH_AUTH_CFG_OFFSET_IN_SHRAM_CP !=
+        ICP_QAT_FW_LA_CIPH_AUTH_CFG_OFFSET_FLAG_GET(la_flags))
+    {
+        if (do_cipher)
+        {
+            cipher_cfg = (const icp_qat_hw_cipher_config_t *)(
+                cd + (cd_ctrl->cipher_cfg_offset << ADF_SW_QUADWORD_SHIFT));
+            op->cipher_algo = QAT_FIELD_GET(
+                cipher_cfg->val, QAT_CIPHER_ALGO_BITPOS, QAT_CIPHER_ALGO_MASK);
+            op->cipher_mode = QAT_FIELD_GET(
+                cipher_cfg->val, QAT_CIPHER_MODE_BITPOS, QAT_CIPHER_MODE_MASK);
+            op->cipher_dir = QAT_FIELD_GET(
+                cipher_cfg->val, QAT_CIPHER_DIR_BITPOS, QAT_CIPHER_DIR_MASK);
+            op->cipher_convert = QAT_FIELD_GET(cipher_cfg->val,
+                                               QAT_CIPHER_CONVERT_BITPOS,
+                                               QAT_CIPHER_CONVERT_MASK);
+            op->key = (const Cpa8U *)(cipher_cfg + 1);
+        }
+        if (do_auth)
+        {
+            auth_setup = (const icp_qat_hw_auth_setup_t *)(
+                cd + (cd_ctrl->hash_cfg_offset << ADF_SW_QUADWORD_SHIFT));
+            op->auth_algo = QAT_FIELD_GET(auth_setup->auth_config.config,
+                                          QAT_AUTH_ALGO_BITPOS,
+                                          QAT_AUTH_ALGO_MASK);
+            op->auth_mode = QAT_FIELD_GET(auth_setup->auth_config.config,
+                                          QAT_AUTH_MODE_BITPOS,
+                                          QAT_AUTH_MODE_MASK);
+            op->state1 = (const Cpa8U *)(auth_setup + 1);
+            op->state2 =
+                cd + (cd_ctrl->inner_state2_offset << ADF_SW_QUADWORD_SHIFT);
+        }
+        return CPA_TRUE;
+    }
+
+    if (do_cipher)
+    {
+        for (i = 0; i < ADF_SW_ARRAY_SIZE(adf_sw_shram_cipher_tbl); i++)
+        {
+            if (adf_sw_shram_cipher_tbl[i].offset == cd_ctrl->cipher_cfg_offset)
+                break;
+        }
+        if (ADF_SW_ARRAY_SIZE(adf_sw_shram_cipher_tbl) == i)
+            return CPA_FALSE;
+        op->cipher_algo = adf_sw_shram_cipher_tbl[i].algo;
+        op->cipher_mode = adf_sw_shram_cipher_tbl[i].mode;
+        op->cipher_dir = adf_sw_shram_cipher_tbl[i].dir;
+        op->cipher_convert = ICP_QAT_HW_CIPHER_KEY_CONVERT;
+        /* Cipher only requests carry the key in the request itself */
+        if (QAT_COMN_CD_FLD_TYPE_16BYTE_DATA ==
+            ICP_QAT_FW_COMN_CD_FLD_TYPE_GET(req->comn_hdr.comn_req_flags))
+            op->key = (const Cpa8U *)req->cd_pars.s1.serv_specif_fields;
+        else
+            op->key = cd;
+        key_len = cd_ctrl->cipher_key_sz << ADF_SW_QUADWORD_SHIFT;
+    }
+    if (do_auth)
+    {
+        for (i = 0; i < ADF_SW_ARRAY_SIZE(adf_sw_shram_auth_tbl); i++)
+        {
+            if (adf_sw_shram_auth_tbl[i].offset == cd_ctrl->hash_cfg_offset)
+                break;
+        }
+        if (ADF_SW_ARRAY_SIZE(adf_sw_shram_auth_tbl) == i)
+            return CPA_FALSE;
+        op->auth_algo = adf_sw_shram_auth_tbl[i].algo;
+        op->auth_mode = adf_sw_shram_auth_tbl[i].mode;
+        /* HMAC states follow the key in the optimised descriptor, its
+         * state sizes are in bytes */
+        op->state1 = cd + key_len;
+        op->state2 = op->state1 + cd_ctrl->inner_state1_sz;
+    }
+
+    return CPA_TRUE;
+}
+
+/*
+ * adf_sw_la_auth
+ * Computes the digest of the auth region and writes or verifies it, in the
+ * buffer when the digest is appended, at auth_res_addr otherwise.
+ */
+STATIC CpaBoolean adf_sw_la_auth(const icp_qat_fw_la_bulk_req_t *req,
+                                 const adf_sw_la_op_t *op,
+                                 Cpa8U *data,
+                                 Cpa32U len)
+{
+    const icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *cd_ctrl =
+        (const icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *)&req->cd_ctrl;
+    const icp_qat_fw_la_auth_req_params_t *auth_params =
+        (const icp_qat_fw_la_auth_req_params_t
+             *)((const Cpa8U *)&req->serv_specif_rqpars +
+                ICP_QAT_FW_HASH_REQUEST_PARAMETERS_OFFSET);
+    Cpa16U la_flags = req->comn_hdr.serv_specif_flags;
+    Cpa8U inner[ADF_SW_MAX_DIGEST_SIZE];
+    Cpa8U digest[ADF_SW_MAX_DIGEST_SIZE];
+    Cpa8U *result = NULL;
+    Cpa32U digest_len = 0, cmp_len = 0;
+
+    if ((Cpa64U)auth_params->auth_off + auth_params->auth_len > len)
+        return CPA_FALSE;
+
+    if (ICP_QAT_HW_AUTH_MODE0 == op->auth_mode)
+    {
+        digest_len = adf_sw_hash(op->auth_algo,
+                                 NULL,
+                                 data + auth_params->auth_off,
+                                 auth_params->auth_len,
+                                 digest);
+    }
+    else if (ICP_QAT_HW_AUTH_MODE1 == op->auth_mode)
+    {
+        digest_len = adf_sw_hash(op->auth_algo,
+                                 op->state1,
+                                 data + auth_params->auth_off,
+                                 auth_params->auth_len,
+                                 inner);
+        if (digest_len)
+            adf_sw_hash(op->auth_algo, op->state2, inner, digest_len, digest);
+    }
+    if (0 == digest_len || cd_ctrl->final_sz > digest_len)
+        return CPA_FALSE;
+
+    if (0 != auth_params->auth_res_addr)
+    {
+        result = ADF_SW_PTR(auth_params->auth_res_addr);
+    }
+    else if (ICP_QAT_FW_LA_DIGEST_IN_BUFFER_GET(la_flags))
+    {
+        result = data + auth_params->auth_off + auth_params->auth_len;
+        if ((Cpa64U)auth_params->auth_off + auth_params->auth_len +
+                cd_ctrl->final_sz >
+            len)
+            return CPA_FALSE;
+    }
+    else
+    {
+        return CPA_TRUE;
+    }
+
+    if (ICP_QAT_FW_LA_CMP_AUTH_GET(la_flags))
+    {
+        cmp_len = auth_params->auth_res_sz ? auth_params->auth_res_sz
+                                           : cd_ctrl->final_sz;
+        if (cmp_len > digest_len)
+            return CPA_FALSE;
+        return (CpaBoolean)(0 == memcmp(result, digest, cmp_len));
+    }
+    if (ICP_QAT_FW_LA_RET_AUTH_GET(la_flags))
+        memcpy(result, digest, cd_ctrl->final_sz);
+
+    return CPA_TRUE;
+}
+
+/*
+ * adf_sw_process_la
+ * Services a symmetric bulk request. The source is gathered into a
+ * linear buffer, transformed in the order given by the command and then
+ * scattered to the destination. Returns the crypto status flag.
+ */
+STATIC Cpa8U adf_sw_process_la(adf_sw_device_t *dev,
+                               const icp_qat_fw_la_bulk_req_t *req)
+{
+    const icp_qat_fw_la_cipher_req_params_t *cipher_params =
+        (const icp_qat_fw_la_cipher_req_params_t *)&req->serv_specif_rqpars;
+    const icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *cd_ctrl =
+        (const icp_qat_fw_cipher_auth_cd_ctrl_hdr_t *)&req->cd_ctrl;
+    Cpa16U la_flags = req->comn_hdr.serv_specif_flags;
+    Cpa8U cmd = req->comn_hdr.service_cmd_id;
+    CpaBoolean is_sgl =
+        (QAT_COMN_PTR_TYPE_SGL ==
+         ICP_QAT_FW_COMN_PTR_TYPE_GET(req->comn_hdr.comn_req_flags));
+    CpaBoolean do_cipher = CPA_FALSE, do_auth = CPA_FALSE;
+    adf_sw_la_op_t op;
+    Cpa8U iv[AES_BLOCK_SIZE];
+    Cpa8U *iv_ptr = NULL;
+    Cpa8U *data = NULL;
+    Cpa32U src_len = 0, dst_len = 0;
+
+    switch (cmd)
+    {
+        case ICP_QAT_FW_LA_CMD_CIPHER:
+            do_cipher = CPA_TRUE;
+            break;
+        case ICP_QAT_FW_LA_CMD_AUTH:
+            do_auth = CPA_TRUE;
+            break;
+        case ICP_QAT_FW_LA_CMD_CIPHER_HASH:
+        case ICP_QAT_FW_LA_CMD_HASH_CIPHER:
+            do_cipher = CPA_TRUE;
+            do_auth = CPA_TRUE;
+            break;
+        default:
+            return ICP_QAT_FW_COMN_STATUS_FLAG_ERROR;
+    }
+
+    /* Partial and nested hashes need state the emulator does not keep */
+    if (do_auth &&
+        (ICP_QAT_FW_LA_PARTIAL_NONE != ICP_QAT_FW_LA_PARTIAL_GET(la_flags) ||
+         (cd_ctrl->hash_flags & ICP_QAT_FW_AUTH_HDR_FLAG_DO_NESTED)))
+        return ICP_QAT_FW_COMN_STATUS_FLAG_ERROR;
+
+    ICP_MEMSET(&op, 0, sizeof(op));
+    if (!adf_sw_la_decode(req, do_cipher, do_auth, &op))
+        return ICP_QAT_FW_COMN_STATUS_FLAG_ERROR;
+
+    src_len = adf_sw_buf_len(
+        req->comn_mid.src_data_addr, req->comn_mid.src_length, is_sgl);
+    dst_len = adf_sw_buf_len(
+        req->comn_mid.dest_data_addr, req->comn_mid.dst_length, is_sgl);
+    data = adf_sw_scratch(&dev->src, src_len);
+    if (NULL == data)
+        return ICP_QAT_FW_COMN_STATUS_FLAG_ERROR;
+    adf_sw_buf_copy(req->comn_mid.src_data_addr, is_sgl, data, src_len, 0);
+
+    if (do_cipher)
+    {
+        if ((Cpa64U)cipher_params->cipher_offset +
+                cipher_params->cipher_length >
+            src_len)
+            return ICP_QAT_FW_COMN_STATUS_FLAG_ERROR;
+        if (ICP_QAT_FW_CIPH_IV_16BYTE_DATA ==
+            ICP_QAT_FW_LA_CIPH_IV_FLD_FLAG_GET(la_flags))
+        {
+            memcpy(iv, cipher_params->u.cipher_IV_array, AES_BLOCK_SIZE);
+        }
+        else if (0 != cipher_params->u.s.cipher_IV_ptr)
+        {
+            iv_ptr = ADF_SW_PTR(cipher_params->u.s.cipher_IV_ptr);
+            memcpy(iv, iv_ptr, AES_BLOCK_SIZE);
+        }
+    }
+
+    if (ICP_QAT_FW_LA_CMD_HASH_CIPHER == cmd &&
+        !adf_sw_la_auth(req, &op, data, src_len))
+        return ICP_QAT_FW_COMN_STATUS_FLAG_ERROR;
+
+    if (do_cipher && !adf_sw_cipher(&op,
+                                    iv,
+                                    data + cipher_params->cipher_offset,
+                                    cipher_params->cipher_length))
+        return ICP_QAT_FW_COMN_STATUS_FLAG_ERROR;
+
+    if (ICP_QAT_FW_LA_CMD_HASH_CIPHER != cmd && do_auth &&
+        !adf_sw_la_auth(req, &op, data, src_len))
+        return ICP_QAT_FW_COMN_STATUS_FLAG_ERROR;
+
+    if (iv_ptr && ICP_QAT_FW_LA_UPDATE_STATE_GET(la_flags))
+        memcpy(iv_ptr, iv, AES_BLOCK_SIZE);
+
+    adf_sw_buf_copy(req->comn_mid.dest_data_addr,
+                    is_sgl,
+                    data,
+                    ADF_SW_MIN(src_len, dst_len),
+                    1);
+
+    return ICP_QAT_FW_COMN_STATUS_FLAG_OK;
+}
+
+STATIC Cpa32U adf_sw_crc32(Cpa32U crc, const Cpa8U *data, Cpa32U len)
+{
+    crc = ~crc;
+    while (len--)
+        crc = adf_sw_crc32_tbl[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+
+    return ~crc;
+}
+
+STATIC Cpa32U adf_sw_adler32(Cpa32U adler, const Cpa8U *data, Cpa32U len)
+{
+    Cpa32U a = adler & 0xFFFF, b = adler >> 16, chunk = 0;
+
+    while (len > 0)
+    {
+        chunk = ADF_SW_MIN(len, ADF_SW_ADLER_NMAX);
+        len -= chunk;
+        while (chunk--)
+        {
+            a += *data++;
+            b += a;
+        }
+        a %= ADF_SW_ADLER_BASE;
+        b %= ADF_SW_ADLER_BASE;
+    }
+
+    return (b << 16) | a;
+}
+
+/*
+ * adf_sw_deflate_stored
+ * Emits the input as deflate stored blocks, the last one flagged final
+ * when bfinal is set. Stops at a block boundary on overflow.
+ */
+STATIC Cpa8S adf_sw_deflate_stored(const Cpa8U *src,
+                                   Cpa32U src_len,
+                                   Cpa8U *dst,
+                                   Cpa32U dst_len,
+                                   CpaBoolean bfinal,
+                                   Cpa32U *consumed,
+                                   Cpa32U *produced)
+{
+    Cpa32U in = 0, out = 0, blk = 0;
+    CpaBoolean last = CPA_FALSE;
+
+    do
+    {
+        blk = ADF_SW_MIN(src_len - in, ADF_SW_STORED_MAX_LEN);
+        last = (CpaBoolean)(bfinal && (in + blk == src_len));
+        if (0 == blk && !last)
+            break;
+        if ((Cpa64U)out + ADF_SW_STORED_HDR_SIZE + blk > dst_len)
+        {
+            *consumed = in;
+            *produced = out;
+            return ERR_CODE_OVERFLOW_ERROR;
+        }
+        dst[out++] = last ? ADF_SW_STORED_BFINAL : 0;
+        dst[out++] = blk & 0xFF;
+        dst[out++] = (blk >> 8) & 0xFF;
+        dst[out++] = ~blk & 0xFF;
+        dst[out++] = (~blk >> 8) & 0xFF;
+        memcpy(dst + out, src + in, blk);
+        in += blk;
+        out += blk;
+    } while (in < src_len);
+
+    *consumed = in;
+    *produced = out;
+
+    return ERR_CODE_NO_ERROR;
+}
+
+/* Deflate code tables (RFC 1951, section 3.2.5 to 3.2.7) */
+STATIC const Cpa16U adf_sw_len_base[ADF_SW_NUM_LEN_SYMS] = {
+    3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+    31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+STATIC const Cpa8U adf_sw_len_extra[ADF_SW_NUM_LEN_SYMS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+    2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+STATIC const Cpa16U adf_sw_dist_base[ADF_SW_MAX_DIST_CODES] = {
+    1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+    33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+STATIC const Cpa8U adf_sw_dist_extra[ADF_SW_MAX_DIST_CODES] = {
+    0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+    6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+STATIC const Cpa8U adf_sw_clen_order[ADF_SW_NUM_CLEN_CODES] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+/*
+ * adf_sw_bits
+ * Returns the next need bits of the input, least significant first. Running
+ * out of input sets the overrun flag and returns zero.
+ */
+STATIC Cpa32U adf_sw_bits(adf_sw_inflate_t *s, Cpa32U need)
+{
+    Cpa32U val = s->bitbuf;
+
+    while (s->bitcnt < need)
+    {
+        if (s->in == s->src_len)
+        {
+            s->overrun = CPA_TRUE;
+            return 0;
+        }
+        val |= (Cpa32U)s->src[s->in++] << s->bitcnt;
+        s->bitcnt += ADF_SW_BITS_PER_BYTE;
+    }
+    s->bitbuf = (Cpa32U)((Cpa64U)val >> need);
+    s->bitcnt -= need;
+
+    return val & ((1U << need) - 1);
+}
+
+/*
+ * adf_sw_huff_build
+ * Builds the canonical code of the n symbols from their code lengths.
+ * Returns zero for a complete code, a positive count of missing codes for
+ * an incomplete one and a negative value for an over-subscribed one.
+ */
+STATIC Cpa32S adf_sw_huff_build(adf_sw_huff_t *h, const Cpa16U *length, Cpa32U n)
+{
+    Cpa16U offs[ADF_SW_MAX_CODE_BITS + 1];
+    Cpa32U sym = 0, len = 0;
+    Cpa32S left = 1;
+
+    ICP_MEMSET(h->count, 0, sizeof(h->count));
+    for (sym = 0; sym < n; sym++)
+        h->count[length[sym]]++;
+    if (h->count[0] == n)
+        return 0;
+
+    for (len = 1; len <= ADF_SW_MAX_CODE_BITS; len++)
+    {
+        left <<= 1;
+        left -= h->count[len];
+        if (left < 0)
+            return left;
+    }
+
+    offs[1] = 0;
+    for (len = 1; len < ADF_SW_MAX_CODE_BITS; len++)
+        offs[len + 1] = offs[len] + h->count[len];
+    for (sym = 0; sym < n; sym++)
+    {
+        if (0 != length[sym])
+            h->symbol[offs[length[sym]]++] = sym;
+    }
+
+    return left;
+}
+
+/*
+ * adf_sw_huff_decode
+ * Decodes one symbol, reading the code a bit at a time. Returns a negative
+ * value for a code the table does not hold.
+ */
+STATIC Cpa32S adf_sw_huff_decode(adf_sw_inflate_t *s, const adf_sw_huff_t *h)
+{
+    Cpa32S code = 0, first = 0, index = 0, count = 0;
+    Cpa32U len = 0;
+
+    for (len = 1; len <= ADF_SW_MAX_CODE_BITS; len++)
+    {
+        code |= adf_sw_bits(s, 1);
+        if (s->overrun)
+            return -1;
+        count = h->count[len];
+        if (code - count < first)
+            return h->symbol[index + (code - first)];
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+
+    return -1;
+}
+
+/*
+ * adf_sw_inflate_codes
+ * Decodes the literals and matches of a fixed or dynamic block up to its
+ * end of block code. Matches may only reach back into this request's
+ * output, no history is kept between requests.
+ */
+STATIC Cpa8S adf_sw_inflate_codes(adf_sw_inflate_t *s,
+                                  const adf_sw_huff_t *lencode,
+                                  const adf_sw_huff_t *distcode)
+{
+    Cpa32S sym = 0;
+    Cpa32U len = 0, dist = 0;
+
+    for (;;)
+    {
+        sym = adf_sw_huff_decode(s, lencode);
+        if (s->overrun)
+            return ERR_CODE_NO_ERROR;
+        if (sym < 0)
+            return ERR_CODE_INV_LIT_LEN_DIS_IN_BLK;
+        if (sym < ADF_SW_END_OF_BLOCK)
+        {
+            if (s->out == s->dst_len)
+                return ERR_CODE_OVERFLOW_ERROR;
+            s->dst[s->out++] = (Cpa8U)sym;
+            continue;
+        }
+        if (ADF_SW_END_OF_BLOCK == sym)
+            return ERR_CODE_NO_ERROR;
+
+        sym -= ADF_SW_END_OF_BLOCK + 1;
+        if (sym >= ADF_SW_NUM_LEN_SYMS)
+            return ERR_CODE_INV_LIT_LEN_DIS_IN_BLK;
+        len = adf_sw_len_base[sym] + adf_sw_bits(s, adf_sw_len_extra[sym]);
+        sym = adf_sw_huff_decode(s, distcode);
+        if (s->overrun)
+            return ERR_CODE_NO_ERROR;
+        if (sym < 0 || sym >= ADF_SW_MAX_DIST_CODES)
+            return ERR_CODE_INV_LIT_LEN_DIS_IN_BLK;
+        dist = adf_sw_dist_base[sym] + adf_sw_bits(s, adf_sw_dist_extra[sym]);
+        if (s->overrun)
+            return ERR_CODE_NO_ERROR;
+        if (dist > s->out)
+            return ERR_CODE_DIS_TOO_FAR_BACK;
+        if (s->dst_len - s->out < len)
+            return ERR_CODE_OVERFLOW_ERROR;
+        /* Byte by byte, a match may overlap its own output */
+        while (len--)
+        {
+            s->dst[s->out] = s->dst[s->out - dist];
+            s->out++;
+        }
+    }
+}
+
+/*
+ * adf_sw_inflate_stored
+ * Copies a stored block out, its header bits already read.
+ */
+STATIC Cpa8S adf_sw_inflate_stored(adf_sw_inflate_t *s)
+{
+    Cpa32U blk = 0, nblk = 0;
+
+    /* Stored data starts on the next byte boundary */
+    s->bitbuf = 0;
+    s->bitcnt = 0;
+    if (s->src_len - s->in < ADF_SW_STORED_HDR_SIZE - 1)
+    {
+        s->overrun = CPA_TRUE;
+        return ERR_CODE_NO_ERROR;
+    }
+    blk = s->src[s->in] | (s->src[s->in + 1] << 8);
+    nblk = s->src[s->in + 2] | (s->src[s->in + 3] << 8);
+    if ((blk ^ nblk) != ADF_SW_STORED_MAX_LEN)
+        return ERR_CODE_NO_MATCH_ONES_COMP;
+    s->in += ADF_SW_STORED_HDR_SIZE - 1;
+    if (s->src_len - s->in < blk)
+    {
+        s->overrun = CPA_TRUE;
+        return ERR_CODE_NO_ERROR;
+    }
+    if (s->dst_len - s->out < blk)
+        return ERR_CODE_OVERFLOW_ERROR;
+    memcpy(s->dst + s->out, s->src + s->in, blk);
+    s->in += blk;
+    s->out += blk;
+
+    return ERR_CODE_NO_ERROR;
+}
+
+/*
+ * adf_sw_inflate_fixed
+ * Decodes a block coded with the fixed Huffman tables.
+ */
+STATIC Cpa8S adf_sw_inflate_fixed(adf_sw_inflate_t *s)
+{
+    adf_sw_huff_t lencode, distcode;
+    Cpa16U lengths[ADF_SW_FIXED_LIT_CODES];
+    Cpa32U sym = 0;
+
+    /* RFC 1951, section 3.2.6 */
+    for (sym = 0; sym < 144; sym++)
+        lengths[sym] = 8;
+    for (; sym < 256; sym++)
+        lengths[sym] = 9;
+    for (; sym < 280; sym++)
+        lengths[sym] = 7;
+    for (; sym < ADF_SW_FIXED_LIT_CODES; sym++)
+        lengths[sym] = 8;
+    adf_sw_huff_build(&lencode, lengths, ADF_SW_FIXED_LIT_CODES);
+
+    for (sym = 0; sym < ADF_SW_MAX_DIST_CODES; sym++)
+        lengths[sym] = 5;
+    adf_sw_huff_build(&distcode, lengths, ADF_SW_MAX_DIST_CODES);
+
+    return adf_sw_inflate_codes(s, &lencode, &distcode);
+}
+
+/*
+ * adf_sw_inflate_dynamic
+ * Reads the code lengths of a dynamic block and decodes it.
+ */
+STATIC Cpa8S adf_sw_inflate_dynamic(adf_sw_inflate_t *s)
+{
+    adf_sw_huff_t lencode, distcode;
+    Cpa16U lengths[ADF_SW_MAX_LIT_CODES + ADF_SW_MAX_DIST_CODES];
+    Cpa32U nlen = 0, ndist = 0, ncode = 0, index = 0, len = 0, rep = 0;
+    Cpa32S sym = 0, err = 0;
+
+    nlen = adf_sw_bits(s, 5) + 257;
+    ndist = adf_sw_bits(s, 5) + 1;
+    ncode = adf_sw_bits(s, 4) + 4;
+    if (s->overrun)
+        return ERR_CODE_NO_ERROR;
+    if (nlen > ADF_SW_MAX_LIT_CODES || ndist > ADF_SW_MAX_DIST_CODES)
+        return ERR_CODE_TOO_MANY_LEN_OR_DIS;
+
+    ICP_MEMSET(lengths, 0, sizeof(lengths));
+    for (index = 0; index < ncode; index++)
+        lengths[adf_sw_clen_order[index]] = adf_sw_bits(s, 3);
+    if (s->overrun)
+        return ERR_CODE_NO_ERROR;
+    if (0 != adf_sw_huff_build(&lencode, lengths, ADF_SW_NUM_CLEN_CODES))
+        return ERR_CODE_INCOMPLETE_LEN;
+
+    for (index = 0; index < nlen + ndist;)
+    {
+        sym = adf_sw_huff_decode(s, &lencode);
+        if (s->overrun)
+            return ERR_CODE_NO_ERROR;
+        if (sym < 0)
+            return ERR_CODE_INCOMPLETE_LEN;
+        if (sym < 16)
+        {
+            lengths[index++] = sym;
+            continue;
+        }
+        len = 0;
+        if (16 == sym)
+        {
+            if (0 == index)
+                return ERR_CODE_RPT_LEN_NO_FIRST_LEN;
+            len = lengths[index - 1];
+            rep = 3 + adf_sw_bits(s, 2);
+        }
+        else if (17 == sym)
+        {
+            rep = 3 + adf_sw_bits(s, 3);
+        }
+        else
+        {
+            rep = 11 + adf_sw_bits(s, 7);
+        }
+        if (s->overrun)
+            return ERR_CODE_NO_ERROR;
+        if (index + rep > nlen + ndist)
+            return ERR_CODE_RPT_GT_SPEC_LEN;
+        while (rep--)
+            lengths[index++] = len;
+    }
+
+    /* A block must be able to end */
+    if (0 == lengths[ADF_SW_END_OF_BLOCK])
+        return ERR_CODE_INV_LIT_LEN_CODE_LEN;
+
+    /* Incomplete codes are only allowed for a single length */
+    err = adf_sw_huff_build(&lencode, lengths, nlen);
+    if (err < 0 || (err > 0 && nlen - lencode.count[0] != 1))
+        return ERR_CODE_INV_LIT_LEN_CODE_LEN;
+    err = adf_sw_huff_build(&distcode, lengths + nlen, ndist);
+    if (err < 0 || (err > 0 && ndist - distcode.count[0] != 1))
+        return ERR_CODE_INV_DIS_CODE_LEN;
+
+    return adf_sw_inflate_codes(s, &lencode, &distcode);
+}
+
+/*
+ * adf_sw_inflate
+ * Decodes deflate blocks of any type. The emulator keeps no bit state
+ * between requests, so a block split across requests is left unconsumed
+ * when it starts on a byte boundary, as the blocks adf_sw_deflate_stored
+ * emits do, and is reported as an incomplete file otherwise. Overflow
+ * stops at the start of the block that did not fit.
+ */
+STATIC Cpa8S adf_sw_inflate(const Cpa8U *src,
+                            Cpa32U src_len,
+                            Cpa8U *dst,
+                            Cpa32U dst_len,
+                            Cpa32U *consumed,
+                            Cpa32U *produced,
+                            CpaBoolean *end_of_last_block)
+{
+    adf_sw_inflate_t s;
+    Cpa32U blk_in = 0, blk_bitcnt = 0, blk_out = 0, last = 0;
+    Cpa8S err = ERR_CODE_NO_ERROR;
+
+    ICP_MEMSET(&s, 0, sizeof(s));
+    s.src = src;
+    s.src_len = src_len;
+    s.dst = dst;
+    s.dst_len = dst_len;
+
+    while (!*end_of_last_block && (s.in < src_len || s.bitcnt > 0))
+    {
+        blk_in = s.in;
+        blk_bitcnt = s.bitcnt;
+        blk_out = s.out;
+
+        last = adf_sw_bits(&s, 1);
+        switch (adf_sw_bits(&s, 2))
+        {
+            case ADF_SW_BTYPE_STORED:
+                err = s.overrun ? ERR_CODE_NO_ERROR
+                                : adf_sw_inflate_stored(&s);
+                break;
+            case ADF_SW_BTYPE_FIXED:
+                err = s.overrun ? ERR_CODE_NO_ERROR : adf_sw_inflate_fixed(&s);
+                break;
+            case ADF_SW_BTYPE_DYNAMIC:
+                err = s.overrun ? ERR_CODE_NO_ERROR
+                                : adf_sw_inflate_dynamic(&s);
+                break;
+            default:
+                err = s.overrun ? ERR_CODE_NO_ERROR
+                                : ERR_CODE_INVALID_BLOCK_TYPE;
+                break;
+        }
+
+        if (s.overrun || ERR_CODE_OVERFLOW_ERROR == err)
+        {
+            /* Rewind to the start of the block */
+            s.in = blk_in;
+            s.out = blk_out;
+            if (s.overrun && 0 != blk_bitcnt)
+                err = ERR_CODE_HW_INCOMPLETE_FILE;
+            s.bitcnt = 0;
+            break;
+        }
+        if (ERR_CODE_NO_ERROR != err)
+            break;
+        if (last)
+            *end_of_last_block = CPA_TRUE;
+    }
+
+    *consumed = s.in;
+    *produced = s.out;
+
+    return err;
+}
+
+/*
+ * adf_sw_process_dc
+ * Services a compression request, compressing into stored deflate blocks
+ * and decompressing blocks of any type, and fills in the counters and
+ * checksums of the response.
+ */
+STATIC void adf_sw_process_dc(adf_sw_device_t *dev,
+                              const icp_qat_fw_comp_req_t *req,
+                              icp_qat_fw_comp_resp_t *resp)
+{
+    CpaBoolean is_sgl =
+        (QAT_COMN_PTR_TYPE_SGL ==
+         ICP_QAT_FW_COMN_PTR_TYPE_GET(req->comn_hdr.comn_req_flags));
+    Cpa32U src_len = req->comp_pars.comp_len;
+    Cpa32U dst_len = req->comp_pars.out_buffer_sz;
+    Cpa32U consumed = 0, produced = 0;
+    CpaBoolean eolb = CPA_FALSE;
+    const Cpa8U *plain = NULL;
+    Cpa32U plain_len = 0;
+    Cpa8U *src = NULL, *dst = NULL;
+    Cpa8S err = ERR_CODE_NO_ERROR;
+
+    src = adf_sw_scratch(&dev->src, src_len);
+    dst = adf_sw_scratch(&dev->dst, dst_len);
+    if (NULL == src || NULL == dst)
+    {
+        err = ERR_CODE_OVERFLOW_ERROR;
+        goto out;
+    }
+    adf_sw_buf_copy(req->comn_mid.src_data_addr, is_sgl, src, src_len, 0);
+
+    switch (req->comn_hdr.service_cmd_id)
+    {
+        case ICP_QAT_FW_COMP_CMD_STATIC:
+        case ICP_QAT_FW_COMP_CMD_DYNAMIC:
+            err = adf_sw_deflate_stored(
+                src,
+                src_len,
+                dst,
+                dst_len,
+                (CpaBoolean)ICP_QAT_FW_COMP_BFINAL_GET(
+                    req->comp_pars.req_par_flags),
+                &consumed,
+                &produced);
+            plain = src;
+            plain_len = consumed;
+            break;
+        case ICP_QAT_FW_COMP_CMD_DECOMPRESS:
+            err = adf_sw_inflate(
+                src, src_len, dst, dst_len, &consumed, &produced, &eolb);
+            plain = dst;
+            plain_len = produced;
+            break;
+        default:
+            err = ERR_CODE_INVALID_BLOCK_TYPE;
+            break;
+    }
+
+    adf_sw_buf_copy(req->comn_mid.dest_data_addr, is_sgl, dst, produced, 1);
+    resp->comp_resp_pars.curr_crc32 =
+        adf_sw_crc32(req->comp_pars.initial_crc32, plain, plain_len);
+    resp->comp_resp_pars.curr_adler_32 =
+        adf_sw_adler32(req->comp_pars.initial_adler, plain, plain_len);
+
+out:
+    resp->comp_resp_pars.input_byte_counter = consumed;
+    resp->comp_resp_pars.output_byte_counter = produced;
+    resp->comn_resp.comn_error.s1.cmp_err_code = err;
+    resp->comn_resp.comn_status = ICP_QAT_FW_COMN_RESP_STATUS_BUILD(
+        ICP_QAT_FW_COMN_STATUS_FLAG_OK,
+        ICP_QAT_FW_COMN_STATUS_FLAG_OK,
+        (ERR_CODE_NO_ERROR == err) ? ICP_QAT_FW_COMN_STATUS_FLAG_OK
+                                   : ICP_QAT_FW_COMN_STATUS_FLAG_ERROR,
+        ICP_QAT_FW_COMN_STATUS_FLAG_OK,
+        eolb ? ICP_QAT_FW_COMN_STATUS_CMP_END_OF_LAST_BLK_FLAG_SET : 0,
+        0,
+        0);
+}
+
+/*
+ * Big number helpers for the PKE functions. Numbers are little endian
+ * arrays of 32 bit limbs with no leading zero limbs, large enough for the
+ * product of two operands of the widest function.
+ */
+STATIC void adf_sw_bn_norm(adf_sw_bn_t *a)
+{
+    while (a->len > 0 && 0 == a->d[a->len - 1])
+        a->len--;
+}
+
+STATIC void adf_sw_bn_set(adf_sw_bn_t *r, Cpa32U w)
+{
+    r->d[0] = w;
+    r->len = (0 != w);
+}
+
+STATIC void adf_sw_bn_copy(adf_sw_bn_t *r, const adf_sw_bn_t *a)
+{
+    if (r != a)
+    {
+        memcpy(r->d, a->d, a->len * sizeof(Cpa32U));
+        r->len = a->len;
+    }
+}
+
+STATIC CpaBoolean adf_sw_bn_is_word(const adf_sw_bn_t *a, Cpa32U w)
+{
+    return (CpaBoolean)((0 == w) ? (0 == a->len)
+                                 : (1 == a->len && w == a->d[0]));
+}
+
+STATIC Cpa32U adf_sw_bn_bits(const adf_sw_bn_t *a)
+{
+    Cpa32U bits = a->len * ADF_SW_BN_LIMB_BITS;
+    Cpa32U top = 0;
+
+    if (0 == a->len)
+        return 0;
+    for (top = a->d[a->len - 1]; !(top & 0x80000000); top <<= 1)
+        bits--;
+
+    return bits;
+}
+
+STATIC Cpa32U adf_sw_bn_bit(const adf_sw_bn_t *a, Cpa32U i)
+{
+    if (i / ADF_SW_BN_LIMB_BITS >= a->len)
+        return 0;
+
+    return (a->d[i / ADF_SW_BN_LIMB_BITS] >> (i % ADF_SW_BN_LIMB_BITS)) & 1;
+}
+
+/* Loads a big endian operand */
+STATIC void adf_sw_bn_from_bytes(adf_sw_bn_t *r, const Cpa8U *p, Cpa32U n)
+{
+    Cpa32U i = 0;
+
+    ICP_MEMSET(r->d, 0, ADF_SW_BN_LIMBS(n) * sizeof(Cpa32U));
+    for (i = 0; i < n; i++)
+        r->d[i / sizeof(Cpa32U)] |= (Cpa32U)p[n - 1 - i]
+                                    << (ADF_SW_BITS_PER_BYTE *
+                                        (i % sizeof(Cpa32U)));
+    r->len = ADF_SW_BN_LIMBS(n);
+    adf_sw_bn_norm(r);
+}
+
+/* Stores a big endian operand, zero padded to n bytes */
+STATIC void adf_sw_bn_to_bytes(const adf_sw_bn_t *a, Cpa8U *p, Cpa32U n)
+{
+    Cpa32U i = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        p[n - 1 - i] =
+            (i / sizeof(Cpa32U) < a->len)
+                ? (Cpa8U)(a->d[i / sizeof(Cpa32U)] >>
+                          (ADF_SW_BITS_PER_BYTE * (i % sizeof(Cpa32U))))
+                : 0;
+    }
+}
+
+STATIC Cpa32S adf_sw_bn_cmp(const adf_sw_bn_t *a, const adf_sw_bn_t *b)
+{
+    Cpa32U i = a->len;
+
+    if (a->len != b->len)
+        return (a->len > b->len) ? 1 : -1;
+    while (i-- > 0)
+    {
+        if (a->d[i] != b->d[i])
+            return (a->d[i] > b->d[i]) ? 1 : -1;
+    }
+
+    return 0;
+}
+
+/* r = a + b, r may be a or b */
+STATIC void adf_sw_bn_add(adf_sw_bn_t *r,
+                          const adf_sw_bn_t *a,
+                          const adf_sw_bn_t *b)
+{
+    Cpa32U len = (a->len > b->len) ? a->len : b->len;
+    Cpa64U carry = 0;
+    Cpa32U i = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        carry += (Cpa64U)(i < a->len ? a->d[i] : 0) +
+                 (i < b->len ? b->d[i] : 0);
+        r->d[i] = (Cpa32U)carry;
+        carry >>= ADF_SW_BN_LIMB_BITS;
+    }
+    r->d[len] = (Cpa32U)carry;
+    r->len = len + 1;
+    adf_sw_bn_norm(r);
+}
+
+/* r = a - b for a >= b, r may be a or b */
+STATIC void adf_sw_bn_sub(adf_sw_bn_t *r,
+                          const adf_sw_bn_t *a,
+                          const adf_sw_bn_t *b)
+{
+    Cpa64U borrow = 0, diff = 0;
+    Cpa32U i = 0;
+
+    for (i = 0; i < a->len; i++)
+    {
+        diff = (Cpa64U)a->d[i] - (i < b->len ? b->d[i] : 0) - borrow;
+        r->d[i] = (Cpa32U)diff;
+        borrow = (diff >> ADF_SW_BN_LIMB_BITS) & 1;
+    }
+    r->len = a->len;
+    adf_sw_bn_norm(r);
+}
+
+/* r = a - w for a >= w */
+STATIC void adf_sw_bn_sub_word(adf_sw_bn_t *r, const adf_sw_bn_t *a, Cpa32U w)
+{
+    adf_sw_bn_t t;
+
+    adf_sw_bn_set(&t, w);
+    adf_sw_bn_sub(r, a, &t);
+}
+
+/* r = a * b, r may not be a or b */
+STATIC void adf_sw_bn_mul(adf_sw_bn_t *r,
+                          const adf_sw_bn_t *a,
+                          const adf_sw_bn_t *b)
+{
+    Cpa64U carry = 0;
+    Cpa32U i = 0, j = 0;
+
+    ICP_MEMSET(r->d, 0, (a->len + b->len) * sizeof(Cpa32U));
+    for (i = 0; i < a->len; i++)
+    {
+        carry = 0;
+        for (j = 0; j < b->len; j++)
+        {
+            carry += (Cpa64U)a->d[i] * b->d[j] + r->d[i + j];
+            r->d[i + j] = (Cpa32U)carry;
+            carry >>= ADF_SW_BN_LIMB_BITS;
+        }
+        r->d[i + b->len] = (Cpa32U)carry;
+    }
+    r->len = a->len + b->len;
+    adf_sw_bn_norm(r);
+}
+
+/* r = a >> shift, r may be a */
+STATIC void adf_sw_bn_shr(adf_sw_bn_t *r, const adf_sw_bn_t *a, Cpa32U shift)
+{
+    Cpa32U limbs = shift / ADF_SW_BN_LIMB_BITS;
+    Cpa32U bits = shift % ADF_SW_BN_LIMB_BITS;
+    Cpa32U i = 0;
+
+    if (limbs >= a->len)
+    {
+        r->len = 0;
+        return;
+    }
+    for (i = 0; i + limbs < a->len; i++)
+    {
+        r->d[i] = a->d[i + limbs] >> bits;
+        if (bits && i + limbs + 1 < a->len)
+            r->d[i] |= a->d[i + limbs + 1] << (ADF_SW_BN_LIMB_BITS - bits);
+    }
+    r->len = a->len - limbs;
+    adf_sw_bn_norm(r);
+}
+
+STATIC Cpa32U adf_sw_bn_mod_word(const adf_sw_bn_t *a, Cpa32U w)
+{
+    Cpa64U rem = 0;
+    Cpa32U i = a->len;
+
+    while (i-- > 0)
+        rem = ((rem << ADF_SW_BN_LIMB_BITS) | a->d[i]) % w;
+
+    return (Cpa32U)rem;
+}
+
+/*
+ * adf_sw_bn_divmod
+ * Long division of a by a non zero m (Knuth, TAOCP vol. 2, 4.3.1,
+ * algorithm D). The quotient is only returned if q is not NULL; q and r
+ * may not be a or m.
+ */
+STATIC void adf_sw_bn_divmod(adf_sw_bn_t *q,
+                             adf_sw_bn_t *r,
+                             const adf_sw_bn_t *a,
+                             const adf_sw_bn_t *m)
+{
+    Cpa32U u[ADF_SW_BN_MAX_LIMBS + 1], v[ADF_SW_BN_MAX_LIMBS];
+    Cpa32U n = m->len, shift = 0, i = 0, j = 0;
+    Cpa64U qhat = 0, rhat = 0, prod = 0, carry = 0;
+    Cpa64S borrow = 0, diff = 0;
+
+    if (adf_sw_bn_cmp(a, m) < 0)
+    {
+        if (q)
+            q->len = 0;
+        adf_sw_bn_copy(r, a);
+        return;
+    }
+    if (1 == n)
+    {
+        if (q)
+        {
+            for (i = a->len, carry = 0; i-- > 0;)
+            {
+                carry = (carry << ADF_SW_BN_LIMB_BITS) | a->d[i];
+                q->d[i] = (Cpa32U)(carry / m->d[0]);
+                carry %= m->d[0];
+            }
+            q->len = a->len;
+            adf_sw_bn_norm(q);
+        }
+        adf_sw_bn_set(r, adf_sw_bn_mod_word(a, m->d[0]));
+        return;
+    }
+
+    /* Normalise so the top limb of the divisor has its top bit set */
+    for (shift = 0; !((m->d[n - 1] << shift) & 0x80000000); shift++)
+        ;
+    for (i = n - 1; i > 0; i--)
+        v[i] = (m->d[i] << shift) |
+               (shift ? m->d[i - 1] >> (ADF_SW_BN_LIMB_BITS - shift) : 0);
+    v[0] = m->d[0] << shift;
+    u[a->len] = shift ? a->d[a->len - 1] >> (ADF_SW_BN_LIMB_BITS - shift) : 0;
+    for (i = a->len - 1; i > 0; i--)
+        u[i] = (a->d[i] << shift) |
+               (shift ? a->d[i - 1] >> (ADF_SW_BN_LIMB_BITS - shift) : 0);
+    u[0] = a->d[0] << shift;
+
+    for (j = a->len - n + 1; j-- > 0;)
+    {
+        /* Estimate the quotient limb from the top two limbs */
+        carry = ((Cpa64U)u[j + n] << ADF_SW_BN_LIMB_BITS) | u[j + n - 1];
+        qhat = carry / v[n - 1];
+        rhat = carry % v[n - 1];
+        while ((qhat >> ADF_SW_BN_LIMB_BITS) ||
+               qhat * v[n - 2] >
+                   ((rhat << ADF_SW_BN_LIMB_BITS) | u[j + n - 2]))
+        {
+            qhat--;
+            rhat += v[n - 1];
+            if (rhat >> ADF_SW_BN_LIMB_BITS)
+                break;
+        }
+
+        /* Multiply and subtract */
+        borrow = 0;
+        for (i = 0; i < n; i++)
+        {
+            prod = qhat * v[i];
+            diff = (Cpa64S)u[i + j] - borrow - (Cpa64S)(prod & 0xFFFFFFFF);
+            u[i + j] = (Cpa32U)diff;
+            borrow = (Cpa64S)(prod >> ADF_SW_BN_LIMB_BITS) -
+                     (diff >> ADF_SW_BN_LIMB_BITS);
+        }
+        diff = (Cpa64S)u[j + n] - borrow;
+        u[j + n] = (Cpa32U)diff;
+
+        /* The estimate was one too large, add the divisor back */
+        if (diff < 0)
+        {
+            qhat--;
+            carry = 0;
+            for (i = 0; i < n; i++)
+            {
+                carry += (Cpa64U)u[i + j] + v[i];
+                u[i + j] = (Cpa32U)carry;
+                carry >>= ADF_SW_BN_LIMB_BITS;
+            }
+            u[j + n] += (Cpa32U)carry;
+        }
+        if (q)
+            q->d[j] = (Cpa32U)qhat;
+    }
+    if (q)
+    {
+        q->len = a->len - n + 1;
+        adf_sw_bn_norm(q);
+    }
+
+    for (i = 0; i < n; i++)
+        r->d[i] = (u[i] >> shift) |
+                  (shift ? u[i + 1] << (ADF_SW_BN_LIMB_BITS - shift) : 0);
+    r->len = n;
+    adf_sw_bn_norm(r);
+}
+
+/* r = a mod m, r may be a */
+STATIC void adf_sw_bn_mod(adf_sw_bn_t *r,
+                          const adf_sw_bn_t *a,
+                          const adf_sw_bn_t *m)
+{
+    adf_sw_bn_t t;
+
+    adf_sw_bn_divmod(NULL, &t, a, m);
+    adf_sw_bn_copy(r, &t);
+}
+
+/* r = a * b mod m, r may be a or b */
+STATIC void adf_sw_bn_mulmod(adf_sw_bn_t *r,
+                             const adf_sw_bn_t *a,
+                             const adf_sw_bn_t *b,
+                             const adf_sw_bn_t *m)
+{
+    adf_sw_bn_t t;
+
+    adf_sw_bn_mul(&t, a, b);
+    adf_sw_bn_divmod(NULL, r, &t, m);
+}
+
+/* r = b ^ e mod m, left to right square and multiply */
+STATIC void adf_sw_bn_modexp(adf_sw_bn_t *r,
+                             const adf_sw_bn_t *b,
+                             const adf_sw_bn_t *e,
+                             const adf_sw_bn_t *m)
+{
+    adf_sw_bn_t base, acc;
+    Cpa32U i = adf_sw_bn_bits(e);
+
+    adf_sw_bn_mod(&base, b, m);
+    adf_sw_bn_set(&acc, 1);
+    adf_sw_bn_mod(&acc, &acc, m);
+    while (i-- > 0)
+    {
+        adf_sw_bn_mulmod(&acc, &acc, &acc, m);
+        if (adf_sw_bn_bit(e, i))
+            adf_sw_bn_mulmod(&acc, &acc, &base, m);
+    }
+    adf_sw_bn_copy(r, &acc);
+}
+
+/*
+ * adf_sw_bn_modinv
+ * r = a ^ -1 mod m by the extended Euclidean algorithm, keeping the
+ * coefficient reduced mod m. Returns CPA_FALSE if a has no inverse.
+ */
+STATIC CpaBoolean adf_sw_bn_modinv(adf_sw_bn_t *r,
+                                   const adf_sw_bn_t *a,
+                                   const adf_sw_bn_t *m)
+{
+    adf_sw_bn_t r0, r1, t0, t1, q, rem, tmp;
+
+    adf_sw_bn_copy(&r0, m);
+    adf_sw_bn_mod(&r1, a, m);
+    adf_sw_bn_set(&t0, 0);
+    adf_sw_bn_set(&t1, 1);
+    while (0 != r1.len)
+    {
+        adf_sw_bn_divmod(&q, &rem, &r0, &r1);
+        adf_sw_bn_copy(&r0, &r1);
+        adf_sw_bn_copy(&r1, &rem);
+
+        /* t0, t1 = t1, t0 - q * t1 mod m */
+        adf_sw_bn_mulmod(&tmp, &q, &t1, m);
+        if (adf_sw_bn_cmp(&t0, &tmp) < 0)
+            adf_sw_bn_add(&t0, &t0, m);
+        adf_sw_bn_sub(&tmp, &t0, &tmp);
+        adf_sw_bn_copy(&t0, &t1);
+        adf_sw_bn_copy(&t1, &tmp);
+    }
+    if (!adf_sw_bn_is_word(&r0, 1))
+        return CPA_FALSE;
+    adf_sw_bn_copy(r, &t0);
+
+    return CPA_TRUE;
+}
+
+/* r = x / 2 mod m for an odd m, r may be x */
+STATIC void adf_sw_bn_half_mod(adf_sw_bn_t *r,
+                               const adf_sw_bn_t *x,
+                               const adf_sw_bn_t *m)
+{
+    adf_sw_bn_t t;
+
+    adf_sw_bn_copy(&t, x);
+    if (t.len && (t.d[0] & 1))
+        adf_sw_bn_add(&t, &t, m);
+    adf_sw_bn_shr(r, &t, 1);
+}
+
+/*
+ * PKE functions. Operands are big endian, each padded to the size the
+ * function id implies.
+ */
+STATIC const adf_sw_pke_func_t adf_sw_pke_func_tbl[] = {
+    {PKE_DH_768, ADF_SW_PKE_MODEXP, 768},
+    {PKE_DH_1024, ADF_SW_PKE_MODEXP, 1024},
+    {PKE_DH_1536, ADF_SW_PKE_MODEXP, 1536},
+    {PKE_DH_2048, ADF_SW_PKE_MODEXP, 2048},
+    {PKE_DH_3072, ADF_SW_PKE_MODEXP, 3072},
+    {PKE_DH_4096, ADF_SW_PKE_MODEXP, 4096},
+    {PKE_DH_G2_768, ADF_SW_PKE_MODEXP_G2, 768},
+    {PKE_DH_G2_1024, ADF_SW_PKE_MODEXP_G2, 1024},
+    {PKE_DH_G2_1536, ADF_SW_PKE_MODEXP_G2, 1536},
+    {PKE_DH_G2_2048, ADF_SW_PKE_MODEXP_G2, 2048},
+    {PKE_DH_G2_3072, ADF_SW_PKE_MODEXP_G2, 3072},
+    {PKE_DH_G2_4096, ADF_SW_PKE_MODEXP_G2, 4096},
+    {PKE_RSA_EP_512, ADF_SW_PKE_MODEXP, 512},
+    {PKE_RSA_EP_1024, ADF_SW_PKE_MODEXP, 1024},
+    {PKE_RSA_EP_1536, ADF_SW_PKE_MODEXP, 1536},
+    {PKE_RSA_EP_2048, ADF_SW_PKE_MODEXP, 2048},
+    {PKE_RSA_EP_3072, ADF_SW_PKE_MODEXP, 3072},
+    {PKE_RSA_EP_4096, ADF_SW_PKE_MODEXP, 4096},
+    {PKE_RSA_DP1_512, ADF_SW_PKE_MODEXP, 512},
+    {PKE_RSA_DP1_1024, ADF_SW_PKE_MODEXP, 1024},
+    {PKE_RSA_DP1_1536, ADF_SW_PKE_MODEXP, 1536},
+    {PKE_RSA_DP1_2048, ADF_SW_PKE_MODEXP, 2048},
+    {PKE_RSA_DP1_3072, ADF_SW_PKE_MODEXP, 3072},
+    {PKE_RSA_DP1_4096, ADF_SW_PKE_MODEXP, 4096},
+    {PKE_RSA_DP2_512, ADF_SW_PKE_RSA_DP2, 512},
+    {PKE_RSA_DP2_1024, ADF_SW_PKE_RSA_DP2, 1024},
+    {PKE_RSA_DP2_1536, ADF_SW_PKE_RSA_DP2, 1536},
+    {PKE_RSA_DP2_2048, ADF_SW_PKE_RSA_DP2, 2048},
+    {PKE_RSA_DP2_3072, ADF_SW_PKE_RSA_DP2, 3072},
+    {PKE_RSA_DP2_4096, ADF_SW_PKE_RSA_DP2, 4096},
+    {PKE_RSA_KP1_512, ADF_SW_PKE_RSA_KP1, 512},
+    {PKE_RSA_KP1_1024, ADF_SW_PKE_RSA_KP1, 1024},
+    {PKE_RSA_KP1_1536, ADF_SW_PKE_RSA_KP1, 1536},
+    {PKE_RSA_KP1_2048, ADF_SW_PKE_RSA_KP1, 2048},
+    {PKE_RSA_KP1_3072, ADF_SW_PKE_RSA_KP1, 3072},
+    {PKE_RSA_KP1_4096, ADF_SW_PKE_RSA_KP1, 4096},
+    {PKE_RSA_KP2_512, ADF_SW_PKE_RSA_KP2, 512},
+    {PKE_RSA_KP2_1024, ADF_SW_PKE_RSA_KP2, 1024},
+    {PKE_RSA_KP2_1536, ADF_SW_PKE_RSA_KP2, 1536},
+    {PKE_RSA_KP2_2048, ADF_SW_PKE_RSA_KP2, 2048},
+    {PKE_RSA_KP2_3072, ADF_SW_PKE_RSA_KP2, 3072},
+    {PKE_RSA_KP2_4096, ADF_SW_PKE_RSA_KP2, 4096},
+    {PKE_GCD_PT_192, ADF_SW_PKE_GCD_PT, 192},
+    {PKE_GCD_PT_256, ADF_SW_PKE_GCD_PT, 256},
+    {PKE_GCD_PT_384, ADF_SW_PKE_GCD_PT, 384},
+    {PKE_GCD_PT_512, ADF_SW_PKE_GCD_PT, 512},
+    {PKE_GCD_PT_768, ADF_SW_PKE_GCD_PT, 768},
+    {PKE_GCD_PT_1024, ADF_SW_PKE_GCD_PT, 1024},
+    {PKE_GCD_PT_1536, ADF_SW_PKE_GCD_PT, 1536},
+    {PKE_GCD_PT_2048, ADF_SW_PKE_GCD_PT, 2048},
+    {PKE_GCD_PT_3072, ADF_SW_PKE_GCD_PT, 3072},
+    {PKE_GCD_PT_4096, ADF_SW_PKE_GCD_PT, 4096},
+    {PKE_FERMAT_PT_160, ADF_SW_PKE_FERMAT_PT, 160},
+    {PKE_FERMAT_PT_512, ADF_SW_PKE_FERMAT_PT, 512},
+    {PKE_FERMAT_PT_L512, ADF_SW_PKE_FERMAT_PT, 512},
+    {PKE_FERMAT_PT_768, ADF_SW_PKE_FERMAT_PT, 768},
+    {PKE_FERMAT_PT_1024, ADF_SW_PKE_FERMAT_PT, 1024},
+    {PKE_FERMAT_PT_1536, ADF_SW_PKE_FERMAT_PT, 1536},
+    {PKE_FERMAT_PT_2048, ADF_SW_PKE_FERMAT_PT, 2048},
+    {PKE_FERMAT_PT_3072, ADF_SW_PKE_FERMAT_PT, 3072},
+    {PKE_FERMAT_PT_4096, ADF_SW_PKE_FERMAT_PT, 4096},
+    {PKE_MR_PT_160, ADF_SW_PKE_MR_PT, 160},
+    {PKE_MR_PT_512, ADF_SW_PKE_MR_PT, 512},
+    {PKE_MR_PT_L512, ADF_SW_PKE_MR_PT, 512},
+    {PKE_MR_PT_768, ADF_SW_PKE_MR_PT, 768},
+    {PKE_MR_PT_1024, ADF_SW_PKE_MR_PT, 1024},
+    {PKE_MR_PT_1536, ADF_SW_PKE_MR_PT, 1536},
+    {PKE_MR_PT_2048, ADF_SW_PKE_MR_PT, 2048},
+    {PKE_MR_PT_3072, ADF_SW_PKE_MR_PT, 3072},
+    {PKE_MR_PT_4096, ADF_SW_PKE_MR_PT, 4096},
+    {PKE_LUCAS_PT_160, ADF_SW_PKE_LUCAS_PT, 160},
+    {PKE_LUCAS_PT_512, ADF_SW_PKE_LUCAS_PT, 512},
+    {PKE_LUCAS_PT_L512, ADF_SW_PKE_LUCAS_PT, 512},
+    {PKE_LUCAS_PT_768, ADF_SW_PKE_LUCAS_PT, 768},
+    {PKE_LUCAS_PT_1024, ADF_SW_PKE_LUCAS_PT, 1024},
+    {PKE_LUCAS_PT_1536, ADF_SW_PKE_LUCAS_PT, 1536},
+    {PKE_LUCAS_PT_2048, ADF_SW_PKE_LUCAS_PT, 2048},
+    {PKE_LUCAS_PT_3072, ADF_SW_PKE_LUCAS_PT, 3072},
+    {PKE_LUCAS_PT_4096, ADF_SW_PKE_LUCAS_PT, 4096}};
+
+/*
+ * adf_sw_pke_param
+ * Returns the index'th operand of an input or output parameter list.
+ */
+STATIC Cpa8U *adf_sw_pke_param(Cpa64U list, Cpa32U index)
+{
+    const Cpa64U *addrs = ADF_SW_PTR(list);
+
+    return ADF_SW_PTR(addrs[index]);
+}
+
+/*
+ * adf_sw_pke_rsa_kp
+ * Derives n and d from p, q and e, plus the CRT form of the private key
+ * when crt is set. Fails if e is not invertible mod (p - 1)(q - 1).
+ */
+STATIC CpaBoolean adf_sw_pke_rsa_kp(const icp_qat_fw_pke_request_t *req,
+                                    Cpa32U size,
+                                    CpaBoolean crt)
+{
+    Cpa64U in = req->pke_mid.src_data_addr;
+    Cpa64U out = req->pke_mid.dest_data_addr;
+    adf_sw_bn_t p, q, e, p1, q1, phi, n, d, t;
+
+    adf_sw_bn_from_bytes(&p, adf_sw_pke_param(in, 0), size / 2);
+    adf_sw_bn_from_bytes(&q, adf_sw_pke_param(in, 1), size / 2);
+    adf_sw_bn_from_bytes(&e, adf_sw_pke_param(in, 2), size);
+    if (p.len == 0 || q.len == 0)
+        return CPA_FALSE;
+
+    adf_sw_bn_mul(&n, &p, &q);
+    adf_sw_bn_sub_word(&p1, &p, 1);
+    adf_sw_bn_sub_word(&q1, &q, 1);
+    adf_sw_bn_mul(&phi, &p1, &q1);
+    if (phi.len == 0 || !adf_sw_bn_modinv(&d, &e, &phi))
+        return CPA_FALSE;
+
+    adf_sw_bn_to_bytes(&n, adf_sw_pke_param(out, 0), size);
+    adf_sw_bn_to_bytes(&d, adf_sw_pke_param(out, 1), size);
+    if (crt)
+    {
+        adf_sw_bn_mod(&t, &d, &p1);
+        adf_sw_bn_to_bytes(&t, adf_sw_pke_param(out, 2), size / 2);
+        adf_sw_bn_mod(&t, &d, &q1);
+        adf_sw_bn_to_bytes(&t, adf_sw_pke_param(out, 3), size / 2);
+        if (!adf_sw_bn_modinv(&t, &q, &p))
+            return CPA_FALSE;
+        adf_sw_bn_to_bytes(&t, adf_sw_pke_param(out, 4), size / 2);
+    }
+
+    return CPA_TRUE;
+}
+
+/*
+ * adf_sw_pke_rsa_dp2
+ * RSA decryption with the CRT form of the private key.
+ */
+STATIC CpaBoolean adf_sw_pke_rsa_dp2(const icp_qat_fw_pke_request_t *req,
+                                     Cpa32U size)
+{
+    Cpa64U in = req->pke_mid.src_data_addr;
+    adf_sw_bn_t c, p, q, dp, dq, qinv, m1, m2, h;
+
+    adf_sw_bn_from_bytes(&c, adf_sw_pke_param(in, 0), size);
+    adf_sw_bn_from_bytes(&p, adf_sw_pke_param(in, 1), size / 2);
+    adf_sw_bn_from_bytes(&q, adf_sw_pke_param(in, 2), size / 2);
+    adf_sw_bn_from_bytes(&dp, adf_sw_pke_param(in, 3), size / 2);
+    adf_sw_bn_from_bytes(&dq, adf_sw_pke_param(in, 4), size / 2);
+    adf_sw_bn_from_bytes(&qinv, adf_sw_pke_param(in, 5), size / 2);
+    if (p.len == 0 || q.len == 0)
+        return CPA_FALSE;
+
+    /* m = m2 + q * (qinv * (m1 - m2) mod p) */
+    adf_sw_bn_modexp(&m1, &c, &dp, &p);
+    adf_sw_bn_modexp(&m2, &c, &dq, &q);
+    adf_sw_bn_mod(&h, &m2, &p);
+    if (adf_sw_bn_cmp(&m1, &h) < 0)
+        adf_sw_bn_add(&m1, &m1, &p);
+    adf_sw_bn_sub(&h, &m1, &h);
+    adf_sw_bn_mulmod(&h, &h, &qinv, &p);
+    adf_sw_bn_mul(&m1, &h, &q);
+    adf_sw_bn_add(&m1, &m1, &m2);
+    adf_sw_bn_to_bytes(&m1,
+                       adf_sw_pke_param(req->pke_mid.dest_data_addr, 0),
+                       size);
+
+    return CPA_TRUE;
+}
+
+/*
+ * adf_sw_pke_gcd_pt
+ * Checks the candidate has no factor below ADF_SW_GCD_PT_BOUND, which is
+ * what its GCD with the product of the small primes tests.
+ */
+STATIC CpaBoolean adf_sw_pke_gcd_pt(const adf_sw_bn_t *m)
+{
+    Cpa32U f = 0;
+
+    if (adf_sw_bn_is_word(m, 2))
+        return CPA_TRUE;
+    if (m->len == 0 || !(m->d[0] & 1) || adf_sw_bn_is_word(m, 1))
+        return CPA_FALSE;
+    /* Odd composite divisors are covered by their prime factors */
+    for (f = 3; f < ADF_SW_GCD_PT_BOUND; f += 2)
+    {
+        if (adf_sw_bn_is_word(m, f))
+            return CPA_TRUE;
+        if (0 == adf_sw_bn_mod_word(m, f))
+            return CPA_FALSE;
+    }
+
+    return CPA_TRUE;
+}
+
+/*
+ * adf_sw_pke_mr_pt
+ * One Miller-Rabin round of the odd candidate m to base x.
+ */
+STATIC CpaBoolean adf_sw_pke_mr_pt(const adf_sw_bn_t *x, const adf_sw_bn_t *m)
+{
+    adf_sw_bn_t m1, d, y;
+    Cpa32U s = 0, i = 0;
+
+    if (m->len == 0 || !(m->d[0] & 1) || adf_sw_bn_is_word(m, 1))
+        return CPA_FALSE;
+    adf_sw_bn_sub_word(&m1, m, 1);
+    while (!adf_sw_bn_bit(&m1, s))
+        s++;
+    adf_sw_bn_shr(&d, &m1, s);
+
+    adf_sw_bn_modexp(&y, x, &d, m);
+    if (adf_sw_bn_is_word(&y, 1) || 0 == adf_sw_bn_cmp(&y, &m1))
+        return CPA_TRUE;
+    for (i = 1; i < s; i++)
+    {
+        adf_sw_bn_mulmod(&y, &y, &y, m);
+        if (0 == adf_sw_bn_cmp(&y, &m1))
+            return CPA_TRUE;
+        if (adf_sw_bn_is_word(&y, 1))
+            return CPA_FALSE;
+    }
+
+    return CPA_FALSE;
+}
+
+/*
+ * adf_sw_pke_jacobi
+ * Jacobi symbol (a / n) of a small odd a against an odd n.
+ */
+STATIC Cpa32S adf_sw_pke_jacobi(Cpa32S a, const adf_sw_bn_t *n)
+{
+    Cpa32U x = (Cpa32U)((a < 0) ? -a : a), y = 0, t = 0;
+    Cpa32U n_mod8 = n->d[0] & 7;
+    Cpa32S j = 1;
+
+    /* (-1 / n) is -1 for n = 3 mod 4 */
+    if (a < 0 && 3 == (n_mod8 & 3))
+        j = -j;
+    /* Reciprocity on two odd numbers, then Euclid on words */
+    y = adf_sw_bn_mod_word(n, x);
+    if (3 == (x & 3) && 3 == (n_mod8 & 3))
+        j = -j;
+    while (0 != y)
+    {
+        while (!(y & 1))
+        {
+            y >>= 1;
+            if (3 == (x & 7) || 5 == (x & 7))
+                j = -j;
+        }
+        t = x;
+        x = y;
+        y = t;
+        if (3 == (x & 3) && 3 == (y & 3))
+            j = -j;
+        y %= x;
+    }
+
+    return (1 == x) ? j : 0;
+}
+
+/*
+ * adf_sw_pke_lucas_pt
+ * Lucas probable prime test of FIPS 186-4, C.3.3: with the first D of
+ * 5, -7, 9, -11, ... whose Jacobi symbol is -1, m passes if U(m + 1) is
+ * 0 mod m for P = 1, Q = (1 - D) / 4.
+ */
+STATIC CpaBoolean adf_sw_pke_lucas_pt(const adf_sw_bn_t *m)
+{
+    adf_sw_bn_t dm, k, u, v, ut, vt, t;
+    Cpa32S d = ADF_SW_LUCAS_FIRST_D, j = 0;
+    Cpa32U i = 0;
+
+    if (m->len == 0 || !(m->d[0] & 1) || adf_sw_bn_is_word(m, 1))
+        return CPA_FALSE;
+
+    /* A perfect square has no such D, give up on it after a bound */
+    for (i = 0;; i++)
+    {
+        if (i == ADF_SW_LUCAS_MAX_D)
+            return CPA_FALSE;
+        j = adf_sw_pke_jacobi(d, m);
+        if (-1 == j)
+            break;
+        if (0 == j && !adf_sw_bn_is_word(m, (Cpa32U)((d < 0) ? -d : d)))
+            return CPA_FALSE;
+        d = (d < 0) ? 2 - d : -d - 2;
+    }
+
+    /* D mod m */
+    adf_sw_bn_set(&t, (Cpa32U)((d < 0) ? -d : d));
+    adf_sw_bn_mod(&dm, &t, m);
+    if (d < 0 && dm.len)
+        adf_sw_bn_sub(&dm, m, &dm);
+
+    adf_sw_bn_set(&t, 1);
+    adf_sw_bn_add(&k, m, &t);
+    adf_sw_bn_set(&u, 1);
+    adf_sw_bn_set(&v, 1);
+    for (i = adf_sw_bn_bits(&k) - 1; i-- > 0;)
+    {
+        /* U(2k) = U(k)V(k), V(2k) = (V(k)^2 + D U(k)^2) / 2 */
+        adf_sw_bn_mulmod(&ut, &u, &v, m);
+        adf_sw_bn_mulmod(&t, &u, &u, m);
+        adf_sw_bn_mulmod(&t, &t, &dm, m);
+        adf_sw_bn_mulmod(&vt, &v, &v, m);
+        adf_sw_bn_add(&vt, &vt, &t);
+        adf_sw_bn_mod(&vt, &vt, m);
+        adf_sw_bn_half_mod(&vt, &vt, m);
+        if (adf_sw_bn_bit(&k, i))
+        {
+            /* U(2k+1) = (U + V) / 2, V(2k+1) = (V + D U) / 2 */
+            adf_sw_bn_add(&u, &ut, &vt);
+            adf_sw_bn_mod(&u, &u, m);
+            adf_sw_bn_half_mod(&u, &u, m);
+            adf_sw_bn_mulmod(&t, &ut, &dm, m);
+            adf_sw_bn_add(&v, &vt, &t);
+            adf_sw_bn_mod(&v, &v, m);
+            adf_sw_bn_half_mod(&v, &v, m);
+        }
+        else
+        {
+            adf_sw_bn_copy(&u, &ut);
+            adf_sw_bn_copy(&v, &vt);
+        }
+    }
+
+    return (CpaBoolean)(0 == u.len);
+}
+
+/*
+ * adf_sw_pke_exec
+ * Runs one PKE request. Returns CPA_FALSE where the firmware would report
+ * a failed PKE status: a prime test that did not pass or an RSA key that
+ * cannot be derived. Functions the emulator does not implement pass
+ * without computing.
+ */
+STATIC CpaBoolean adf_sw_pke_exec(const icp_qat_fw_pke_request_t *req)
+{
+    const adf_sw_pke_func_t *func = NULL;
+    Cpa64U in = req->pke_mid.src_data_addr;
+    Cpa64U out = req->pke_mid.dest_data_addr;
+    adf_sw_bn_t b, e, m, r;
+    Cpa32U size = 0, i = 0;
+
+    for (i = 0; i < ADF_SW_ARRAY_SIZE(adf_sw_pke_func_tbl); i++)
+    {
+        if (adf_sw_pke_func_tbl[i].func_id == req->pke_hdr.cd_pars.func_id)
+        {
+            func = &adf_sw_pke_func_tbl[i];
+            break;
+        }
+    }
+    if (NULL == func)
+        return CPA_TRUE;
+    size = ADF_SW_PKE_OPERAND_SIZE(func->bits);
+
+    switch (func->op)
+    {
+        case ADF_SW_PKE_MODEXP:
+            adf_sw_bn_from_bytes(&b, adf_sw_pke_param(in, 0), size);
+            adf_sw_bn_from_bytes(&e, adf_sw_pke_param(in, 1), size);
+            adf_sw_bn_from_bytes(&m, adf_sw_pke_param(in, 2), size);
+            if (0 == m.len)
+                return CPA_FALSE;
+            adf_sw_bn_modexp(&r, &b, &e, &m);
+            adf_sw_bn_to_bytes(&r, adf_sw_pke_param(out, 0), size);
+            return CPA_TRUE;
+        case ADF_SW_PKE_MODEXP_G2:
+            adf_sw_bn_set(&b, 2);
+            adf_sw_bn_from_bytes(&e, adf_sw_pke_param(in, 0), size);
+            adf_sw_bn_from_bytes(&m, adf_sw_pke_param(in, 1), size);
+            if (0 == m.len)
+                return CPA_FALSE;
+            adf_sw_bn_modexp(&r, &b, &e, &m);
+            adf_sw_bn_to_bytes(&r, adf_sw_pke_param(out, 0), size);
+            return CPA_TRUE;
+        case ADF_SW_PKE_RSA_KP1:
+            return adf_sw_pke_rsa_kp(req, size, CPA_FALSE);
+        case ADF_SW_PKE_RSA_KP2:
+            return adf_sw_pke_rsa_kp(req, size, CPA_TRUE);
+        case ADF_SW_PKE_RSA_DP2:
+            return adf_sw_pke_rsa_dp2(req, size);
+        case ADF_SW_PKE_GCD_PT:
+            adf_sw_bn_from_bytes(&m, adf_sw_pke_param(in, 0), size);
+            return adf_sw_pke_gcd_pt(&m);
+        case ADF_SW_PKE_FERMAT_PT:
+            /* 2 ^ (m - 1) = 1 mod m */
+            adf_sw_bn_from_bytes(&m, adf_sw_pke_param(in, 0), size);
+            if (m.len == 0 || adf_sw_bn_is_word(&m, 1))
+                return CPA_FALSE;
+            adf_sw_bn_set(&b, 2);
+            adf_sw_bn_sub_word(&e, &m, 1);
+            adf_sw_bn_modexp(&r, &b, &e, &m);
+            return adf_sw_bn_is_word(&r, 1);
+        case ADF_SW_PKE_MR_PT:
+            adf_sw_bn_from_bytes(&b, adf_sw_pke_param(in, 0), size);
+            adf_sw_bn_from_bytes(&m, adf_sw_pke_param(in, 1), size);
+            return adf_sw_pke_mr_pt(&b, &m);
+        case ADF_SW_PKE_LUCAS_PT:
+            adf_sw_bn_from_bytes(&m, adf_sw_pke_param(in, 0), size);
+            return adf_sw_pke_lucas_pt(&m);
+        default:
+            return CPA_TRUE;
+    }
+}
+
+/*
+ * adf_sw_process_msg
+ * Builds the response for one request and returns the request size.
+ */
+STATIC Cpa32U adf_sw_process_msg(adf_sw_device_t *dev,
+                                 const Cpa8U *msg,
+                                 Cpa32U *resp_buf)
+{
+    const icp_qat_fw_comn_req_hdr_t *hdr = (const icp_qat_fw_comn_req_hdr_t *)msg;
+    icp_qat_fw_comn_resp_hdr_t *resp_hdr = (icp_qat_fw_comn_resp_hdr_t *)resp_buf;
+    Cpa8U service_type = msg[ADF_SW_SERVICE_TYPE_OFFSET];
+    Cpa8U crypto_status = ICP_QAT_FW_COMN_STATUS_FLAG_ERROR;
+
+    ICP_MEMSET(resp_buf, 0, ADF_SW_RESP_SIZE);
+
+    if (ICP_QAT_FW_COMN_REQ_CPM_FW_PKE == service_type)
+    {
+        const icp_qat_fw_pke_request_t *req =
+            (const icp_qat_fw_pke_request_t *)msg;
+        const icp_qat_fw_pke_request_t *next = req;
+        icp_qat_fw_pke_resp_t *resp = (icp_qat_fw_pke_resp_t *)resp_buf;
+        CpaBoolean pass = CPA_TRUE;
+
+        /* A chain, such as the rounds of a prime test, stops at the first
+         * request that fails */
+        do
+        {
+            pass = adf_sw_pke_exec(next);
+            next = (0 != next->next_req_adr) ? ADF_SW_PTR(next->next_req_adr)
+                                             : NULL;
+        } while (pass && NULL != next);
+
+        resp->pke_resp_hdr.response_type = service_type;
+        resp->pke_resp_hdr.hdr_flags =
+            ICP_QAT_FW_COMN_HDR_FLAGS_BUILD(ICP_QAT_FW_COMN_REQ_FLAG_SET);
+        resp->pke_resp_hdr.resp_status.pke_resp_flags =
+            ICP_QAT_FW_COMN_RESP_STATUS_BUILD(
+                0,
+                pass ? ICP_QAT_FW_COMN_STATUS_FLAG_OK
+                     : ICP_QAT_FW_COMN_STATUS_FLAG_ERROR,
+                0,
+                0,
+                0,
+                0,
+                0);
+        resp->opaque_data = req->pke_mid.opaque_data;
+        resp->src_data_addr = req->pke_mid.src_data_addr;
+        resp->dest_data_addr = req->pke_mid.dest_data_addr;
+        return ADF_SW_PKE_REQ_SIZE;
+    }
+
+    resp_hdr->response_type = service_type;
+    resp_hdr->hdr_flags =
+        ICP_QAT_FW_COMN_HDR_FLAGS_BUILD(ICP_QAT_FW_COMN_REQ_FLAG_SET);
+    resp_hdr->cmd_id = hdr->service_cmd_id;
+
+    if (ICP_QAT_FW_COMN_REQ_CPM_FW_COMP == service_type)
+    {
+        const icp_qat_fw_comp_req_t *req = (const icp_qat_fw_comp_req_t *)msg;
+        icp_qat_fw_comp_resp_t *resp = (icp_qat_fw_comp_resp_t *)resp_buf;
+
+        resp->opaque_data = req->comn_mid.opaque_data;
+        adf_sw_process_dc(dev, req, resp);
+        return ADF_SW_LA_REQ_SIZE;
+    }
+
+    if (ICP_QAT_FW_COMN_REQ_CPM_FW_LA == service_type)
+    {
+        const icp_qat_fw_la_bulk_req_t *req =
+            (const icp_qat_fw_la_bulk_req_t *)msg;
+
+        ((icp_qat_fw_la_resp_t *)resp_buf)->opaque_data =
+            req->comn_mid.opaque_data;
+        crypto_status = adf_sw_process_la(dev, req);
+    }
+    else
+    {
+        /* Same layout for the opaque data of every bulk service */
+        ((icp_qat_fw_la_resp_t *)resp_buf)->opaque_data =
+            ((const icp_qat_fw_la_bulk_req_t *)msg)->comn_mid.opaque_data;
+    }
+    resp_hdr->comn_status =
+        ICP_QAT_FW_COMN_RESP_STATUS_BUILD(crypto_status, 0, 0, 0, 0, 0, 0);
+
+    return ADF_SW_LA_REQ_SIZE;
+}
+
+/*
+ * adf_sw_service_ring
+ * Drains one request ring into its response ring, as far as the response
+ * ring has room. Returns CPA_TRUE if any request was serviced.
+ */
+STATIC CpaBoolean adf_sw_service_ring(adf_sw_device_t *dev,
+                                      adf_sw_bank_t *bank,
+                                      Cpa32U ring)
+{
+    Cpa32U *csr_base_addr = bank->csr;
+    Cpa32U rx_ring = ring + ADF_SW_RX_RING_OFFSET;
+    Cpa32U resp[ADF_SW_RESP_LW];
+    Cpa32U head = bank->req_head[ring];
+    Cpa32U resp_tail = bank->resp_tail[ring];
+    Cpa32U req_mask = 0, resp_mask = 0, tail = 0, i = 0;
+    const Cpa8U *req_base = NULL;
+    Cpa8U *resp_base = NULL;
+    volatile Cpa32U *resp_msg = NULL;
+    CpaBoolean serviced = CPA_FALSE;
+
+    req_base = ADF_SW_PTR(read_base(csr_base_addr, 0, ring)
+                          << ADF_SW_RING_BASE_SHIFT);
+    resp_base = ADF_SW_PTR(read_base(csr_base_addr, 0, rx_ring)
+                           << ADF_SW_RING_BASE_SHIFT);
+    req_mask = ICP_ET_SIZE_TO_BYTES(READ_CSR_RING_CONFIG(0, ring) &
+                                    ADF_SW_RING_SIZE_MASK) -
+               1;
+    resp_mask = ICP_ET_SIZE_TO_BYTES(READ_CSR_RING_CONFIG(0, rx_ring) &
+                                     ADF_SW_RING_SIZE_MASK) -
+                1;
+    tail = READ_CSR_RING_TAIL(0, ring);
+    /* Order the request reads after the tail update */
+    __sync_synchronize();
+
+    while (head != tail)
+    {
+        resp_msg = (volatile Cpa32U *)(resp_base + resp_tail);
+        if (EMPTY_RING_SIG_WORD != resp_msg[0])
+            break;
+
+        head = (head + adf_sw_process_msg(dev, req_base + head, resp)) &
+               req_mask;
+
+        /* The first word is what the host polls on, write it last */
+        for (i = 1; i < ADF_SW_RESP_LW; i++)
+            resp_msg[i] = resp[i];
+        __sync_synchronize();
+        resp_msg[0] = resp[0];
+
+        resp_tail = (resp_tail + ADF_SW_RESP_SIZE) & resp_mask;
+        serviced = CPA_TRUE;
+    }
+
+    if (serviced)
+    {
+        bank->req_head[ring] = head;
+        bank->resp_tail[ring] = resp_tail;
+        WRITE_CSR_RING_HEAD(0, ring, head);
+    }
+
+    return serviced;
+}
+
+/*
+ * adf_sw_update_empty_stat
+ * A response ring is empty once the host has consumed the last response
+ * written to it, as responses are consumed in order.
+ */
+STATIC void adf_sw_update_empty_stat(adf_sw_bank_t *bank)
+{
+    Cpa32U *csr_base_addr = bank->csr;
+    Cpa32U e_stat = ~0U, ring = 0, rx_ring = 0, resp_mask = 0, last = 0;
+    const volatile Cpa32U *resp_msg = NULL;
+
+    for (ring = 0; ring < ADF_SW_NUM_TX_RINGS; ring++)
+    {
+        rx_ring = ring + ADF_SW_RX_RING_OFFSET;
+        if (!(bank->enabled & (1 << rx_ring)))
+            continue;
+        resp_mask = ICP_ET_SIZE_TO_BYTES(READ_CSR_RING_CONFIG(0, rx_ring) &
+                                         ADF_SW_RING_SIZE_MASK) -
+                    1;
+        last = (bank->resp_tail[ring] - ADF_SW_RESP_SIZE) & resp_mask;
+        resp_msg = (const volatile Cpa32U *)((Cpa8U *)ADF_SW_PTR(
+                                                 read_base(csr_base_addr,
+                                                           0,
+                                                           rx_ring)
+                                                 << ADF_SW_RING_BASE_SHIFT) +
+                                             last);
+        if (EMPTY_RING_SIG_WORD != resp_msg[0])
+            e_stat &= ~(1 << rx_ring);
+    }
+    ICP_ADF_CSR_WR(csr_base_addr, ICP_RING_CSR_E_STAT, e_stat);
+}
+
+STATIC CpaBoolean adf_sw_service_banks(adf_sw_device_t *dev)
+{
+    adf_sw_bank_t *bank = NULL;
+    Cpa32U bank_nr = 0, ring = 0, pair = 0;
+    CpaBoolean serviced = CPA_FALSE;
+
+    if (ICP_MUTEX_LOCK(&dev->lock))
+        return CPA_FALSE;
+
+    for (bank_nr = 0; bank_nr < ADF_SW_NUM_BANKS; bank_nr++)
+    {
+        bank = &dev->banks[bank_nr];
+        if (!bank->enabled)
+            continue;
+        for (ring = 0; ring < ADF_SW_NUM_TX_RINGS; ring++)
+        {
+            pair = (1 << ring) | (1 << (ring + ADF_SW_RX_RING_OFFSET));
+            if ((bank->enabled & pair) == pair &&
+                adf_sw_service_ring(dev, bank, ring))
+                serviced = CPA_TRUE;
+        }
+        adf_sw_update_empty_stat(bank);
+    }
+    ICP_MUTEX_UNLOCK(&dev->lock);
+
+    return serviced;
+}
+
+/*
+ * adf_sw_responder
+ * Device thread: polls the request rings, backing off when they are idle.
+ */
+STATIC void *adf_sw_responder(void *arg)
+{
+    adf_sw_device_t *dev = (adf_sw_device_t *)arg;
+    Cpa32U idle = 0;
+
+    while (dev->running)
+    {
+        if (adf_sw_service_banks(dev))
+            idle = 0;
+        else if (++idle < ADF_SW_IDLE_SPINS)
+            sched_yield();
+        else
+            usleep(ADF_SW_IDLE_SLEEP_US);
+    }
+
+    return NULL;
+}
+
+#endif /* ICP_SW_DEVICE */
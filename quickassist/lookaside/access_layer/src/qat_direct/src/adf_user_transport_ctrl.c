@@ -53,6 +53,8 @@
 #include <time.h>
 #include <sys/time.h>
 #include <sched.h>
+#include <poll.h>
+#include <errno.h>
 
 #include "cpa.h"
 #include "icp_platform.h"
@@ -331,9 +333,9 @@ CpaStatus icp_adf_transCreateHandle(icp_accel_dev_t *accel_dev,
         /* Set the polling mask for this ring handle. */
         pRingHandle->pollingMask = 1 << ring_rnum;
     }
-    else if (ICP_RESP_TYPE_IRQ == resp)
+    else if (ICP_RESP_TYPE_IRQ == resp || ICP_RESP_TYPE_HYBRID == resp)
     {
-        /* epoll rings are also polled, so we neeed to set both
+        /* epoll and hybrid rings are also polled, so we neeed to set both
          * their polling and interrupt mask
          */
         pRingHandle->pollingMask = 1 << ring_rnum;
@@ -532,6 +534,66 @@ CpaStatus icp_adf_transPutMsg(icp_comms_trans_handle trans_handle,
     return adf_user_put_msg(pRingHandle, inBuf);
 }
 
+/*
+ * Put a burst of messages on the transport handle
+ */
+CpaStatus icp_adf_transPutMsgs(icp_comms_trans_handle trans_handle,
+                               Cpa32U **inBufs,
+                               Cpa32U bufLen,
+                               Cpa32U numMsgs,
+                               Cpa32U *numSent)
+{
+    adf_dev_ring_handle_t *pRingHandle = (adf_dev_ring_handle_t *)trans_handle;
+
+    ICP_CHECK_FOR_NULL_PARAM(trans_handle);
+    ICP_CHECK_PARAM_RANGE(bufLen * ICP_ADF_BYTES_PER_WORD,
+                          pRingHandle->message_size,
+                          pRingHandle->message_size);
+    return adf_user_put_msgs(pRingHandle, inBufs, numMsgs, numSent);
+}
+
+/*
+ * Mark the transport handle as owned by a single thread. The ring
+ * mutex and the atomic in-flight and polling updates are skipped for
+ * such rings. Must not be changed while requests are in flight.
+ */
+CpaStatus icp_adf_transSetExclusiveOwner(icp_comms_trans_handle trans_handle,
+                                         CpaBoolean exclusive)
+{
+    adf_dev_ring_handle_t *pRingHandle = (adf_dev_ring_handle_t *)trans_handle;
+
+    ICP_CHECK_FOR_NULL_PARAM(trans_handle);
+    if (*pRingHandle->in_flight)
+    {
+        ADF_ERROR("Ring [%u:%u] has requests in flight\n",
+                  pRingHandle->bank_num,
+                  pRingHandle->ring_num);
+        return CPA_STATUS_RETRY;
+    }
+    pRingHandle->is_exclusive = (CPA_TRUE == exclusive) ? 1 : 0;
+#ifdef _DEBUG_
+    pRingHandle->owner_set = 0;
+#endif
+    return CPA_STATUS_SUCCESS;
+}
+
+/*
+ * Returns the requests in flight on the ring and its limit
+ */
+CpaStatus icp_adf_transGetInflight(icp_comms_trans_handle trans_handle,
+                                   Cpa32U *pNumInflight,
+                                   Cpa32U *pMaxInflight)
+{
+    adf_dev_ring_handle_t *pRingHandle = (adf_dev_ring_handle_t *)trans_handle;
+
+    ICP_CHECK_FOR_NULL_PARAM(trans_handle);
+    ICP_CHECK_FOR_NULL_PARAM(pNumInflight);
+    ICP_CHECK_FOR_NULL_PARAM(pMaxInflight);
+    *pNumInflight = *(volatile Cpa32U *)pRingHandle->in_flight;
+    *pMaxInflight = pRingHandle->max_requests_inflight;
+    return CPA_STATUS_SUCCESS;
+}
+
 /*
  * adf_user_unmap_rings
  * Device is going down - unmap all rings allocated for this device
@@ -569,6 +631,14 @@ CpaStatus adf_pollRing(icp_accel_dev_t *accel_dev,
 {
     CpaStatus status = CPA_STATUS_RETRY;
 
+    /* An exclusive ring is only polled by its owning thread */
+    if (pRingHandle->is_exclusive)
+    {
+        ADF_RING_CHECK_OWNER(pRingHandle);
+        pRingHandle->ringResponseQuota = response_quota;
+        return adf_user_notify_msgs_poll(pRingHandle);
+    }
+
     /* Check to see if this ring is already being polled by
      * another core or thread. DecAndTest returns TRUE
      * only if pRingHandle->pollingInProgress was previously
@@ -789,7 +859,7 @@ CpaStatus icp_adf_pollInstance(icp_comms_trans_handle *trans_hnd,
         return CPA_STATUS_FAIL;
     }
 
-    ICP_MUTEX_LOCK(ring_hnd_first->user_lock);
+    adf_ring_lock(ring_hnd_first);
     csr_base_addr = (Cpa8U *)ring_hnd_first->csr_addr;
 
     for (i = 0; i < num_transHandles; i++)
@@ -797,7 +867,7 @@ CpaStatus icp_adf_pollInstance(icp_comms_trans_handle *trans_hnd,
         ring_hnd = (adf_dev_ring_handle_t *)trans_hnd[i];
         if (!ring_hnd)
         {
-            ICP_MUTEX_UNLOCK(ring_hnd_first->user_lock);
+            adf_ring_unlock(ring_hnd_first);
             return CPA_STATUS_FAIL;
         }
         /* And with polling ring mask. If the
@@ -821,7 +891,7 @@ CpaStatus icp_adf_pollInstance(icp_comms_trans_handle *trans_hnd,
                                  ring_hnd->bank_data->interrupt_mask);
         }
     }
-    ICP_MUTEX_UNLOCK(ring_hnd_first->user_lock);
+    adf_ring_unlock(ring_hnd_first);
     /* If any of the rings in the instance had data and was polled
      * return SUCCESS. */
     if (stat_total)
@@ -831,6 +901,134 @@ CpaStatus icp_adf_pollInstance(icp_comms_trans_handle *trans_hnd,
     return CPA_STATUS_RETRY;
 }
 
+/*
+ * Maximum number of distinct bundles an instance can be waited on
+ */
+#define ADF_WAIT_MAX_FDS 4
+
+/*
+ * adf_ring_flush_head
+ * Writes the head CSR of a ring whose head writes may have been
+ * coalesced, so the hardware does not see already consumed responses
+ * and raise an interrupt for them. Returns 0 if another thread is
+ * polling the ring at the moment.
+ */
+STATIC int adf_ring_flush_head(adf_dev_ring_handle_t *ring)
+{
+    Cpa8U *csr_base_addr = (Cpa8U *)ring->csr_addr;
+
+    if (ring->is_exclusive)
+    {
+        WRITE_CSR_RING_HEAD(ring->bank_offset, ring->ring_num, ring->head);
+        ring->coal_write_count = ring->min_resps_per_head_write;
+        return 1;
+    }
+    if (!osalAtomicDecAndTest((OsalAtomic *)&(ring->pollingInProgress)))
+    {
+        return 0;
+    }
+    WRITE_CSR_RING_HEAD(ring->bank_offset, ring->ring_num, ring->head);
+    ring->coal_write_count = ring->min_resps_per_head_write;
+    osalAtomicSet(1, (OsalAtomic *)&(ring->pollingInProgress));
+    return 1;
+}
+
+/*
+ * This function arms the interrupts of the hybrid response rings of an
+ * instance and blocks on their bundle until an interrupt arrives or the
+ * timeout expires. The interrupt handler disarms the bundle again, so
+ * the polling that follows runs without interrupts.
+ * Returns SUCCESS if responses may be waiting, RETRY on timeout and
+ * UNSUPPORTED if the rings have no interrupt to wait on.
+ */
+CpaStatus icp_adf_waitInstance(icp_comms_trans_handle *trans_hnd,
+                               Cpa32U num_transHandles,
+                               Cpa32U timeout_ms)
+{
+    adf_dev_ring_handle_t *ring_hnd = NULL;
+    struct adf_uio_user_bundle *bundle = NULL;
+    struct pollfd fds[ADF_WAIT_MAX_FDS];
+    Cpa8U *csr_base_addr = NULL;
+    Cpa32U i = 0, j = 0, num_fds = 0, csrVal = 0, irq_count = 0;
+    int ret = 0;
+
+    ICP_CHECK_FOR_NULL_PARAM(trans_hnd);
+
+    for (i = 0; i < num_transHandles; i++)
+    {
+        ring_hnd = (adf_dev_ring_handle_t *)trans_hnd[i];
+        ICP_CHECK_FOR_NULL_PARAM(ring_hnd);
+        if (ICP_RESP_TYPE_HYBRID != ring_hnd->resp)
+        {
+            return CPA_STATUS_UNSUPPORTED;
+        }
+        bundle = (struct adf_uio_user_bundle *)ring_hnd->bank_data->bundle;
+        if (bundle->fd < 0)
+        {
+            return CPA_STATUS_UNSUPPORTED;
+        }
+        /* Rings of one instance normally share their bundle */
+        for (j = 0; j < num_fds; j++)
+        {
+            if (fds[j].fd == bundle->fd)
+                break;
+        }
+        if (j == num_fds)
+        {
+            if (ADF_WAIT_MAX_FDS == num_fds)
+            {
+                return CPA_STATUS_FAIL;
+            }
+            fds[num_fds].fd = bundle->fd;
+            fds[num_fds].events = POLLIN;
+            fds[num_fds].revents = 0;
+            num_fds++;
+        }
+
+        if (!adf_ring_flush_head(ring_hnd))
+        {
+            /* Someone else is polling, there is no point in sleeping */
+            return CPA_STATUS_SUCCESS;
+        }
+        csr_base_addr = (Cpa8U *)ring_hnd->csr_addr;
+        WRITE_CSR_INT_COL_EN(ring_hnd->bank_offset,
+                             ring_hnd->bank_data->interrupt_mask);
+    }
+
+    /* A response that landed before the interrupt was armed does not
+     * raise one, so check the rings again before going to sleep */
+    for (i = 0; i < num_transHandles; i++)
+    {
+        ring_hnd = (adf_dev_ring_handle_t *)trans_hnd[i];
+        csr_base_addr = (Cpa8U *)ring_hnd->csr_addr;
+        csrVal = ~READ_CSR_E_STAT(ring_hnd->bank_offset);
+        if (csrVal & ring_hnd->pollingMask)
+        {
+            return CPA_STATUS_SUCCESS;
+        }
+    }
+
+    ret = poll(fds, num_fds, timeout_ms);
+    if (ret < 0)
+    {
+        return (EINTR == errno) ? CPA_STATUS_RETRY : CPA_STATUS_FAIL;
+    }
+    if (0 == ret)
+    {
+        return CPA_STATUS_RETRY;
+    }
+    /* Consume the UIO event counts so the next wait blocks again */
+    for (j = 0; j < num_fds; j++)
+    {
+        if ((fds[j].revents & POLLIN) &&
+            read(fds[j].fd, &irq_count, sizeof(irq_count)) < 0)
+        {
+            ADF_DEBUG("Failed to read interrupt count\n");
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
 /*
  * Function initializes internal transport data
  */
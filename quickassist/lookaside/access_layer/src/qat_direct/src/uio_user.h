@@ -46,5 +46,8 @@ int32_t adf_init_devices(void);
 CpaStatus adf_proxy_get_devices(void);
 int32_t adf_cleanup_devices(void);
 int adf_proxy_poll_event(Cpa32U *dev_id, enum adf_event *event);
+#ifdef ICP_SW_DEVICE
+Cpa32U adf_sw_get_num_devices(void);
+#endif
 
 #endif /* end of include guard: UIO_USER_H */
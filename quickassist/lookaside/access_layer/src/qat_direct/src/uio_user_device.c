@@ -86,6 +86,10 @@ CpaStatus icp_adf_get_numDevices(Cpa32U *num_devices)
 
     ICP_CHECK_FOR_NULL_PARAM(num_devices);
 
+#ifdef ICP_SW_DEVICE
+    *num_devices = adf_sw_get_num_devices();
+    return CPA_STATUS_SUCCESS;
+#endif
     fd = open(ADF_CTL_DEVICE_NAME, O_RDWR);
     if (fd < 0)
     {
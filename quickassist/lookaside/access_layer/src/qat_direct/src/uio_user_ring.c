@@ -146,7 +146,7 @@ int32_t adf_user_put_msg(adf_dev_ring_handle_t *ring, uint32_t *inBuf)
     ICP_CHECK_FOR_NULL_PARAM(ring->accel_dev);
 
     csr_base_addr = ((uint8_t *)ring->csr_addr);
-    status = ICP_MUTEX_LOCK(ring->user_lock);
+    status = adf_ring_lock(ring);
     if (status)
     {
         ADF_ERROR("Failed to lock bank with error %d\n", status);
@@ -154,10 +154,10 @@ int32_t adf_user_put_msg(adf_dev_ring_handle_t *ring, uint32_t *inBuf)
     }
 
     /* Check if there is enough space in the ring */
-    flight = __sync_add_and_fetch(ring->in_flight, 1);
+    flight = adf_ring_inflight_add(ring, 1);
     if (flight > ring->max_requests_inflight)
     {
-        __sync_sub_and_fetch(ring->in_flight, 1);
+        adf_ring_inflight_sub(ring, 1);
         status = CPA_STATUS_RETRY;
         goto adf_user_put_msg_exit;
     }
@@ -185,7 +185,101 @@ int32_t adf_user_put_msg(adf_dev_ring_handle_t *ring, uint32_t *inBuf)
     ring->csrTailOffset = ring->tail;
 
 adf_user_put_msg_exit:
-    ICP_MUTEX_UNLOCK(ring->user_lock);
+    adf_ring_unlock(ring);
+    return status;
+}
+
+/*
+ * Puts a burst of messages on the ring. Space for as many of the messages
+ * as fit is reserved with a single update of in_flight, the messages are
+ * copied into consecutive ring slots and the tail CSR is written once.
+ * The number of messages placed on the ring is returned in numSent.
+ */
+int32_t adf_user_put_msgs(adf_dev_ring_handle_t *ring,
+                          uint32_t **inBufs,
+                          uint32_t numMsgs,
+                          uint32_t *numSent)
+{
+    int status = CPA_STATUS_SUCCESS;
+    uint32_t *targetAddr;
+    uint8_t *csr_base_addr;
+    int64_t flight;
+    uint32_t accepted;
+    uint32_t tail;
+    uint32_t i;
+    ICP_CHECK_FOR_NULL_PARAM(ring);
+    ICP_CHECK_FOR_NULL_PARAM(inBufs);
+    ICP_CHECK_FOR_NULL_PARAM(numSent);
+    ICP_CHECK_FOR_NULL_PARAM(ring->accel_dev);
+
+    *numSent = 0;
+    if (0 == numMsgs)
+    {
+        return CPA_STATUS_SUCCESS;
+    }
+    if ((ring->message_size != ADF_MSG_SIZE_64_BYTES) &&
+        (ring->message_size != ADF_MSG_SIZE_128_BYTES))
+    {
+        return CPA_STATUS_FAIL;
+    }
+
+    csr_base_addr = ((uint8_t *)ring->csr_addr);
+    status = adf_ring_lock(ring);
+    if (status)
+    {
+        ADF_ERROR("Failed to lock bank with error %d\n", status);
+        return CPA_STATUS_FAIL;
+    }
+
+    /* Reserve space for the whole burst and hand back whatever
+     * does not fit in the ring */
+    flight = adf_ring_inflight_add(ring, numMsgs);
+    if (flight > ring->max_requests_inflight)
+    {
+        uint32_t excess = flight - ring->max_requests_inflight;
+
+        if (excess > numMsgs)
+        {
+            excess = numMsgs;
+        }
+        adf_ring_inflight_sub(ring, excess);
+        accepted = numMsgs - excess;
+    }
+    else
+    {
+        accepted = numMsgs;
+    }
+
+    if (0 == accepted)
+    {
+        status = CPA_STATUS_RETRY;
+        goto adf_user_put_msgs_exit;
+    }
+
+    tail = ring->tail;
+    for (i = 0; i < accepted; i++)
+    {
+        targetAddr = (uint32_t *)(((UARCH_INT)ring->ring_virt_addr) + tail);
+        if (ring->message_size == ADF_MSG_SIZE_64_BYTES)
+        {
+            adf_memcpy64(targetAddr, inBufs[i]);
+        }
+        else
+        {
+            adf_memcpy128(targetAddr, inBufs[i]);
+        }
+        tail = modulo((tail + ring->message_size), ring->modulo);
+    }
+
+    /* Update shadow copy values and ring the doorbell once */
+    ring->tail = tail;
+    WRITE_CSR_RING_TAIL(ring->bank_offset, ring->ring_num, ring->tail);
+
+    ring->csrTailOffset = ring->tail;
+    *numSent = accepted;
+
+adf_user_put_msgs_exit:
+    adf_ring_unlock(ring);
     return status;
 }
 
@@ -223,7 +317,7 @@ int32_t adf_user_notify_msgs(adf_dev_ring_handle_t *ring)
     /* Update the head CSR if any messages were processed */
     if (msg_counter > 0)
     {
-        __sync_sub_and_fetch(ring->in_flight, msg_counter);
+        adf_ring_inflight_sub(ring, msg_counter);
         /* Coalesce head writes to reduce impact of MMIO write */
         if (msg_counter > ring->coal_write_count)
         {
@@ -279,7 +373,7 @@ int32_t adf_user_notify_msgs_poll(adf_dev_ring_handle_t *ring)
     {
         /* May need to do this earlier to prevent perf impact in multi-threaded
          * scenarios */
-        __sync_sub_and_fetch(ring->in_flight, msg_counter);
+        adf_ring_inflight_sub(ring, msg_counter);
 
         /* Coalesce head writes to reduce impact of MMIO write, except if
          * interrupt method is enabled cause otherwise it would keep triggering
@@ -47,6 +47,74 @@
 #define ADF_UIO_USER_RING_H
 
 #include <adf_dev_ring_ctl.h>
+#include <icp_platform.h>
+
+/*
+ * Rings flagged as exclusive are only ever used by one thread, so the
+ * submit and poll paths skip the ring mutex and the atomic updates of
+ * the in-flight counter. Debug builds check that this holds.
+ */
+#ifdef _DEBUG_
+static inline void adf_ring_check_owner(adf_dev_ring_handle_t *ring)
+{
+    pthread_t self = pthread_self();
+
+    if (!ring->owner_set)
+    {
+        ring->owner_thread = self;
+        ring->owner_set = 1;
+    }
+    else if (!pthread_equal(ring->owner_thread, self))
+    {
+        ADF_ERROR("Exclusive ring [%u:%u] used by more than one thread\n",
+                  ring->bank_num,
+                  ring->ring_num);
+    }
+}
+#define ADF_RING_CHECK_OWNER(ring) adf_ring_check_owner(ring)
+#else
+#define ADF_RING_CHECK_OWNER(ring)
+#endif
+
+static inline int adf_ring_lock(adf_dev_ring_handle_t *ring)
+{
+    if (ring->is_exclusive)
+    {
+        ADF_RING_CHECK_OWNER(ring);
+        return 0;
+    }
+    return ICP_MUTEX_LOCK(ring->user_lock);
+}
+
+static inline void adf_ring_unlock(adf_dev_ring_handle_t *ring)
+{
+    if (!ring->is_exclusive)
+    {
+        ICP_MUTEX_UNLOCK(ring->user_lock);
+    }
+}
+
+static inline int64_t adf_ring_inflight_add(adf_dev_ring_handle_t *ring,
+                                            uint32_t num)
+{
+    if (ring->is_exclusive)
+    {
+        *ring->in_flight += num;
+        return *ring->in_flight;
+    }
+    return __sync_add_and_fetch(ring->in_flight, num);
+}
+
+static inline void adf_ring_inflight_sub(adf_dev_ring_handle_t *ring,
+                                         uint32_t num)
+{
+    if (ring->is_exclusive)
+    {
+        *ring->in_flight -= num;
+        return;
+    }
+    __sync_sub_and_fetch(ring->in_flight, num);
+}
 
 int32_t adf_init_ring(adf_dev_ring_handle_t *ring,
                       adf_dev_bank_handle_t *bank,
@@ -60,6 +128,10 @@ void adf_cleanup_ring(adf_dev_ring_handle_t *ring);
 int32_t adf_ring_freebuf(adf_dev_ring_handle_t *ring);
 
 int32_t adf_user_put_msg(adf_dev_ring_handle_t *ring, uint32_t *inBuf);
+int32_t adf_user_put_msgs(adf_dev_ring_handle_t *ring,
+                          uint32_t **inBufs,
+                          uint32_t numMsgs,
+                          uint32_t *numSent);
 int32_t adf_user_notify_msgs(adf_dev_ring_handle_t *ring);
 int32_t adf_user_notify_msgs_poll(adf_dev_ring_handle_t *ring);
 
@@ -95,7 +95,12 @@
 #include "icp_adf_transport.h"
 #include "icp_adf_poll.h"
 #include "icp_sal.h"
+#include "icp_sal_asym_batch.h"
+#include "icp_sal_rsa_key_context.h"
+#include "icp_sal_dc_stream.h"
+#include "icp_sal_ec_curve.h"
 #include "icp_sal_poll.h"
+#include "icp_sal_drbg_impl.h"
 #include "icp_sal_iommu.h"
 #include "icp_sal_versions.h"
 #include "lac_common.h"
@@ -119,12 +124,19 @@ EXPORT_SYMBOL(cpaCySymRemoveSession);
 EXPORT_SYMBOL(cpaCySymPerformOp);
 EXPORT_SYMBOL(cpaCySymQueryStats);
 EXPORT_SYMBOL(cpaCySymQueryStats64);
+EXPORT_SYMBOL(icp_sal_CyGetHashPrecompCacheStats);
+EXPORT_SYMBOL(icp_sal_CyGetSymHostFallbackStats);
+EXPORT_SYMBOL(icp_sal_CyGetPkeResizeStats);
+EXPORT_SYMBOL(icp_sal_CyGetPkeProfile);
+EXPORT_SYMBOL(icp_sal_CyResetPkeProfile);
 EXPORT_SYMBOL(cpaCySymQueryCapabilities);
 EXPORT_SYMBOL(cpaCySymSessionCtxGetSize);
 EXPORT_SYMBOL(cpaCySymSessionCtxGetDynamicSize);
 EXPORT_SYMBOL(cpaCySymDpSessionCtxGetDynamicSize);
 EXPORT_SYMBOL(cpaCySymSessionInUse);
 EXPORT_SYMBOL(cpaCySymUpdateSession);
+EXPORT_SYMBOL(icp_sal_CySymCloneSession);
+EXPORT_SYMBOL(icp_sal_CySymInitSessions);
 
 /* Diffie Hellman */
 EXPORT_SYMBOL(cpaCyDhKeyGenPhase1);
@@ -152,6 +164,17 @@ EXPORT_SYMBOL(cpaCyPrimeTest);
 EXPORT_SYMBOL(cpaCyPrimeQueryStats);
 EXPORT_SYMBOL(cpaCyPrimeQueryStats64);
 
+/* DRBG */
+EXPORT_SYMBOL(cpaCyDrbgSessionGetSize);
+EXPORT_SYMBOL(cpaCyDrbgInitSession);
+EXPORT_SYMBOL(cpaCyDrbgGen);
+EXPORT_SYMBOL(cpaCyDrbgReseed);
+EXPORT_SYMBOL(cpaCyDrbgRemoveSession);
+EXPORT_SYMBOL(cpaCyDrbgQueryStats64);
+EXPORT_SYMBOL(icp_sal_drbgGetEntropyInputFuncRegister);
+EXPORT_SYMBOL(icp_sal_drbgGetNonceFuncRegister);
+EXPORT_SYMBOL(icp_sal_drbgIsDFReqFuncRegister);
+
 /* DSA */
 EXPORT_SYMBOL(cpaCyDsaGenPParam);
 EXPORT_SYMBOL(cpaCyDsaGenGParam);
@@ -169,11 +192,17 @@ EXPORT_SYMBOL(cpaCyRsaEncrypt);
 EXPORT_SYMBOL(cpaCyRsaDecrypt);
 EXPORT_SYMBOL(cpaCyRsaQueryStats);
 EXPORT_SYMBOL(cpaCyRsaQueryStats64);
+EXPORT_SYMBOL(icp_sal_CyRsaDecryptBatch);
+EXPORT_SYMBOL(icp_sal_CyRsaPrivateKeyContextCreate);
+EXPORT_SYMBOL(icp_sal_CyRsaPrivateKeyContextDestroy);
+EXPORT_SYMBOL(icp_sal_CyRsaDecryptKeyContext);
 
 /* EC */
 EXPORT_SYMBOL(cpaCyEcPointMultiply);
 EXPORT_SYMBOL(cpaCyEcPointVerify);
 EXPORT_SYMBOL(cpaCyEcQueryStats64);
+EXPORT_SYMBOL(icp_sal_CyEcCurveHandleGet);
+EXPORT_SYMBOL(icp_sal_CyEcPointMultiplyCurve);
 
 /* ECDH */
 EXPORT_SYMBOL(cpaCyEcdhPointMultiply);
@@ -185,6 +214,9 @@ EXPORT_SYMBOL(cpaCyEcdsaSignS);
 EXPORT_SYMBOL(cpaCyEcdsaSignRS);
 EXPORT_SYMBOL(cpaCyEcdsaVerify);
 EXPORT_SYMBOL(cpaCyEcdsaQueryStats64);
+EXPORT_SYMBOL(icp_sal_CyEcdsaSignRSCurve);
+EXPORT_SYMBOL(icp_sal_CyEcdsaVerifyCurve);
+EXPORT_SYMBOL(icp_sal_CyEcdsaSignRSBatch);
 
 /* KPT */
 EXPORT_SYMBOL(cpaCyKptRegisterKeyHandle);
@@ -221,6 +253,14 @@ EXPORT_SYMBOL(cpaDcStopInstance);
 EXPORT_SYMBOL(cpaDcBPCompressData);
 EXPORT_SYMBOL(cpaDcCompressData2);
 EXPORT_SYMBOL(cpaDcDecompressData2);
+EXPORT_SYMBOL(icp_sal_DcCompressDataBatch);
+EXPORT_SYMBOL(icp_sal_DcDecompressDataBatch);
+EXPORT_SYMBOL(icp_sal_DcStreamCreate);
+EXPORT_SYMBOL(icp_sal_DcStreamPush);
+EXPORT_SYMBOL(icp_sal_DcStreamPull);
+EXPORT_SYMBOL(icp_sal_DcStreamGetResults);
+EXPORT_SYMBOL(icp_sal_DcStreamReset);
+EXPORT_SYMBOL(icp_sal_DcStreamRemove);
 
 /* DcDp Compression */
 EXPORT_SYMBOL(cpaDcDpGetSessionSize);
@@ -247,13 +287,24 @@ EXPORT_SYMBOL(cpaCyQueryCapabilities);
 
 /* Polling symbols */
 EXPORT_SYMBOL(icp_sal_CyPollInstance);
+EXPORT_SYMBOL(icp_sal_CySetExclusiveOwner);
+EXPORT_SYMBOL(icp_sal_CyWaitInstance);
+EXPORT_SYMBOL(icp_sal_CyGetWaitStats);
 EXPORT_SYMBOL(icp_sal_CyPollDpInstance);
 #endif /*!ICP_DC_ONLY*/
 EXPORT_SYMBOL(icp_sal_DcPollInstance);
+EXPORT_SYMBOL(icp_sal_DcSetExclusiveOwner);
+EXPORT_SYMBOL(icp_sal_DcWaitInstance);
+EXPORT_SYMBOL(icp_sal_DcGetWaitStats);
 EXPORT_SYMBOL(icp_sal_DcPollDpInstance);
 EXPORT_SYMBOL(icp_sal_pollBank);
 EXPORT_SYMBOL(icp_sal_pollAllBanks);
 
+/* Buffer list registration symbols */
+EXPORT_SYMBOL(icp_sal_BufferListRegister);
+EXPORT_SYMBOL(icp_sal_BufferListInvalidate);
+EXPORT_SYMBOL(icp_sal_BufferListDeregister);
+
 /* sal iommu symbols */
 EXPORT_SYMBOL(icp_sal_iommu_get_remap_size);
 EXPORT_SYMBOL(icp_sal_iommu_map);
@@ -154,6 +154,25 @@ CpaStatus icp_adf_transGetRingNum(icp_comms_trans_handle trans_handle,
     return CPA_STATUS_SUCCESS;
 }
 
+/*
+ * icp_adf_transGetInflight
+ * get the requests in flight on a transport handle and its limit
+ */
+CpaStatus icp_adf_transGetInflight(icp_comms_trans_handle trans_handle,
+                                   UINT32 *pNumInflight,
+                                   UINT32 *pMaxInflight)
+{
+    struct adf_etr_ring_data *ring = trans_handle;
+
+    ICP_CHECK_FOR_NULL_PARAM(ring);
+    ICP_CHECK_FOR_NULL_PARAM(pNumInflight);
+    ICP_CHECK_FOR_NULL_PARAM(pMaxInflight);
+    *pNumInflight = (UINT32)atomic_read(ring->inflights);
+    *pMaxInflight = (UINT32)ring->max_inflights;
+
+    return CPA_STATUS_SUCCESS;
+}
+
 /*
  * icp_adf_transPutMsg
  * send a request to transport handle
@@ -180,6 +199,43 @@ CpaStatus icp_adf_transPutMsg(icp_comms_trans_handle trans_handle,
     return status;
 }
 
+/*
+ * icp_adf_transPutMsgs
+ * send a burst of requests to transport handle
+ * the adf driver has no vectored send, so messages are sent one at a time
+ * until the ring is full
+ */
+CpaStatus icp_adf_transPutMsgs(icp_comms_trans_handle trans_handle,
+                               UINT32 **inBufs,
+                               UINT32 bufLen,
+                               UINT32 numMsgs,
+                               UINT32 *numSent)
+{
+    struct adf_etr_ring_data *ring = trans_handle;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    UINT32 i = 0;
+    int error = 0;
+
+    ICP_CHECK_FOR_NULL_PARAM(ring);
+    ICP_CHECK_FOR_NULL_PARAM(inBufs);
+    ICP_CHECK_FOR_NULL_PARAM(numSent);
+
+    for (i = 0; i < numMsgs; i++)
+    {
+        error = adf_send_message(ring, inBufs[i]);
+        if (0 != error)
+            break;
+    }
+    *numSent = i;
+
+    if (-EAGAIN == error)
+        status = (0 == i) ? CPA_STATUS_RETRY : CPA_STATUS_SUCCESS;
+    else if (0 != error)
+        status = CPA_STATUS_FAIL;
+
+    return status;
+}
+
 /*
  * This function allows the user to poll the response ring. The
  * ring number to be polled is supplied by the user via the
@@ -410,3 +466,22 @@ CpaStatus icp_adf_transGetFdForHandle(icp_comms_trans_handle trans_hnd, int *fd)
 {
     return CPA_STATUS_UNSUPPORTED;
 }
+
+/*
+ * This icp API won't be supported in kernel space currently
+ */
+CpaStatus icp_adf_transSetExclusiveOwner(icp_comms_trans_handle trans_handle,
+                                         CpaBoolean exclusive)
+{
+    return CPA_STATUS_UNSUPPORTED;
+}
+
+/*
+ * Kernel instances are never hybrid, they are polled or use the ISR
+ */
+CpaStatus icp_adf_waitInstance(icp_comms_trans_handle *trans_hnd,
+                               Cpa32U num_transHandles,
+                               Cpa32U timeout_ms)
+{
+    return CPA_STATUS_UNSUPPORTED;
+}
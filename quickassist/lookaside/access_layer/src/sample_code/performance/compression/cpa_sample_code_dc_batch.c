@@ -0,0 +1,952 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_dc_batch.c
+ *
+ * @ingroup compressionThreads
+ *
+ * @description
+ *    This is a sample code that measures the traditional API compression
+ *    batches of icp_sal_DcCompressDataBatch and
+ *    icp_sal_DcDecompressDataBatch. The corpus is cut into chunks of
+ *    setup->bufferSize and DC_BATCH_NUM_SLOTS requests, spread over
+ *    DC_BATCH_NUM_SESSIONS stateless sessions, are submitted in batches of
+ *    setup->numRequests entries.
+ *    No polling threads are created for the test. On a polled instance the
+ *    responses are only taken when a batch gets CPA_STATUS_RETRY, so the
+ *    ring fills up and batches are submitted in part. Every decompressed
+ *    chunk is checked against the corpus.
+ *    Time stamping is started before the first batch in the direction of
+ *    the test is submitted and stopped when the responses of the last loop
+ *    have been received. The other direction is run once, untimed, to
+ *    produce the input of the test or to check its output.
+ *****************************************************************************/
+
+#include "cpa_sample_code_utils_common.h"
+#include "cpa_sample_code_dc_perf.h"
+#include "cpa_sample_code_dc_utils.h"
+#include "qat_perf_buffer_utils.h"
+#include "qat_perf_utils.h"
+#include "qat_compression_cnv_utils.h"
+
+#include "icp_sal.h"
+#include "icp_sal_poll.h"
+
+/* Requests of a loop, more than the ring of an instance configured with the
+ * default NumConcurrentRequests holds */
+#define DC_BATCH_NUM_SLOTS (1024)
+
+/* Sessions the requests of a batch are spread over */
+#define DC_BATCH_NUM_SESSIONS (4)
+
+/* Responses taken by a poll that does not drain the whole ring, fewer than
+ * the entries of a batch so that the next batch is submitted in part */
+#define DC_BATCH_POLL_QUOTA (8)
+
+/* Longest wait for the responses of a loop */
+#define DC_BATCH_TIMEOUT_MS (10000)
+
+/* Requests and buffers of one batch test thread */
+typedef struct dc_batch_s
+{
+    compression_test_params_t *setup;
+    CpaDcSessionHandle sessions[DC_BATCH_NUM_SESSIONS];
+    Cpa32U numSessions;
+    /*corpus chunks, slot i compresses chunk i % numChunks*/
+    Cpa32U numChunks;
+    CpaBufferList *srcLists;
+    CpaBufferList *cmpLists;
+    CpaBufferList *decLists;
+    CpaDcRqResults *cmpResults;
+    CpaDcRqResults *decResults;
+    icp_sal_dc_batch_op_data_t *entries;
+    CpaDcOpData cmpOpData;
+    CpaDcOpData decOpData;
+    CpaBoolean isPolled;
+    /*written by the callback*/
+    volatile Cpa32U numResponses;
+    volatile Cpa32U numErrors;
+    Cpa64U numPartialSubmits;
+    /*set when a response did not come, the buffers must then be kept*/
+    CpaBoolean lostResponse;
+} dc_batch_t;
+
+static void dcBatchCallback(void *pCallbackTag, CpaStatus status)
+{
+    dc_batch_t *pBatch = (dc_batch_t *)pCallbackTag;
+
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        pBatch->numErrors++;
+    }
+    pBatch->numResponses++;
+}
+
+/* Take responses of the instance, all of them for a quota of 0 */
+static void dcBatchPoll(dc_batch_t *pBatch, Cpa32U quota)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    if (CPA_TRUE == pBatch->isPolled)
+    {
+        status = icp_sal_DcPollInstance(pBatch->setup->dcInstanceHandle, quota);
+        if (CPA_STATUS_RETRY == status)
+        {
+            pBatch->setup->performanceStats->pollRetries++;
+        }
+        else if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("icp_sal_DcPollInstance returned status %d\n", status);
+        }
+    }
+    else
+    {
+        AVOID_SOFTLOCKUP;
+    }
+}
+
+/* Wait for the responses of the numSubmitted requests of a loop */
+static CpaStatus dcBatchWait(dc_batch_t *pBatch, Cpa32U numSubmitted)
+{
+    perf_cycles_t start = sampleCodeTimestamp();
+    /*the CPU frequency is in kHz*/
+    perf_cycles_t timeout =
+        (perf_cycles_t)sampleCodeGetCpuFreq() * DC_BATCH_TIMEOUT_MS;
+
+    while (pBatch->numResponses < numSubmitted)
+    {
+        if (sampleCodeTimestamp() - start > timeout)
+        {
+            PRINT_ERR("%u of %u responses after %u ms\n",
+                      pBatch->numResponses,
+                      numSubmitted,
+                      DC_BATCH_TIMEOUT_MS);
+            pBatch->lostResponse = CPA_TRUE;
+            return CPA_STATUS_FAIL;
+        }
+        dcBatchPoll(pBatch, 0);
+    }
+    if (0 != pBatch->numErrors)
+    {
+        PRINT_ERR("%u requests completed with an error\n", pBatch->numErrors);
+        return CPA_STATUS_FAIL;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Submit every slot in batches of setup->numRequests entries and wait for
+ * the responses. A batch that gets CPA_STATUS_RETRY is resubmitted from
+ * the first entry the ring had no room for, after taking a few responses
+ * or, every other time, all of them. */
+static CpaStatus dcBatchRun(dc_batch_t *pBatch, CpaDcSessionDir direction)
+{
+    compression_test_params_t *setup = pBatch->setup;
+    Cpa32U numDone = 0;
+    Cpa32U numEntries = 0;
+    Cpa32U numSubmitted = 0;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    for (i = 0; i < DC_BATCH_NUM_SLOTS; i++)
+    {
+        if (CPA_DC_DIR_COMPRESS == direction)
+        {
+            pBatch->entries[i].pSrcBuff = &pBatch->srcLists[i % pBatch->numChunks];
+            pBatch->entries[i].pDestBuff = &pBatch->cmpLists[i];
+            pBatch->entries[i].pOpData = &pBatch->cmpOpData;
+            pBatch->entries[i].pResults = &pBatch->cmpResults[i];
+            /*the whole buffer is available for the compressed data*/
+            pBatch->cmpLists[i].pBuffers->dataLenInBytes =
+                setup->bufferSize * EXTRA_BUFFER;
+        }
+        else
+        {
+            pBatch->entries[i].pSrcBuff = &pBatch->cmpLists[i];
+            pBatch->entries[i].pDestBuff = &pBatch->decLists[i];
+            pBatch->entries[i].pOpData = &pBatch->decOpData;
+            pBatch->entries[i].pResults = &pBatch->decResults[i];
+        }
+        pBatch->entries[i].pSessionHandle =
+            pBatch->sessions[i % pBatch->numSessions];
+        pBatch->entries[i].callbackTag = pBatch;
+    }
+
+    pBatch->numResponses = 0;
+    pBatch->numErrors = 0;
+    while (numDone < DC_BATCH_NUM_SLOTS)
+    {
+        numEntries = DC_BATCH_NUM_SLOTS - numDone;
+        if (numEntries > setup->numRequests)
+        {
+            numEntries = setup->numRequests;
+        }
+        numSubmitted = 0;
+        if (CPA_DC_DIR_COMPRESS == direction)
+        {
+            status = icp_sal_DcCompressDataBatch(setup->dcInstanceHandle,
+                                                 numEntries,
+                                                 &pBatch->entries[numDone],
+                                                 &numSubmitted);
+        }
+        else
+        {
+            status = icp_sal_DcDecompressDataBatch(setup->dcInstanceHandle,
+                                                   numEntries,
+                                                   &pBatch->entries[numDone],
+                                                   &numSubmitted);
+        }
+        numDone += numSubmitted;
+        setup->performanceStats->submissions += numSubmitted;
+        if (CPA_STATUS_RETRY == status)
+        {
+            setup->performanceStats->retries++;
+            if (0 != numSubmitted)
+            {
+                pBatch->numPartialSubmits++;
+            }
+            dcBatchPoll(pBatch,
+                        (setup->performanceStats->retries & 1)
+                            ? DC_BATCH_POLL_QUOTA
+                            : 0);
+        }
+        else if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("Batch submit returned status %d\n", status);
+            break;
+        }
+    }
+
+    /*the requests on the ring complete even if the batch failed*/
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = dcBatchWait(pBatch, numDone);
+    }
+    else
+    {
+        (void)dcBatchWait(pBatch, numDone);
+    }
+    return status;
+}
+
+/* Check the compressed chunks and size the compressed lists to the data */
+static CpaStatus dcBatchCheckCompress(dc_batch_t *pBatch,
+                                      Cpa32U *pConsumed,
+                                      Cpa32U *pProduced)
+{
+    CpaBufferList *pSrc = NULL;
+    Cpa32U i = 0;
+
+    *pConsumed = 0;
+    *pProduced = 0;
+    for (i = 0; i < DC_BATCH_NUM_SLOTS; i++)
+    {
+        pSrc = &pBatch->srcLists[i % pBatch->numChunks];
+        if (CPA_DC_OK != pBatch->cmpResults[i].status ||
+            pBatch->cmpResults[i].consumed != pSrc->pBuffers->dataLenInBytes)
+        {
+            PRINT_ERR("Compression of slot %u: status %d, consumed %u of %u\n",
+                      i,
+                      pBatch->cmpResults[i].status,
+                      pBatch->cmpResults[i].consumed,
+                      pSrc->pBuffers->dataLenInBytes);
+            return CPA_STATUS_FAIL;
+        }
+        pBatch->cmpLists[i].pBuffers->dataLenInBytes =
+            pBatch->cmpResults[i].produced;
+        *pConsumed += pBatch->cmpResults[i].consumed;
+        *pProduced += pBatch->cmpResults[i].produced;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Check the decompressed chunks against the corpus */
+static CpaStatus dcBatchCheckDecompress(dc_batch_t *pBatch)
+{
+    CpaBufferList *pSrc = NULL;
+    Cpa32U i = 0;
+
+    for (i = 0; i < DC_BATCH_NUM_SLOTS; i++)
+    {
+        pSrc = &pBatch->srcLists[i % pBatch->numChunks];
+        if (CPA_DC_OK != pBatch->decResults[i].status ||
+            pBatch->decResults[i].produced != pSrc->pBuffers->dataLenInBytes ||
+            0 != memcmp(pBatch->decLists[i].pBuffers->pData,
+                        pSrc->pBuffers->pData,
+                        pSrc->pBuffers->dataLenInBytes))
+        {
+            PRINT_ERR("Decompression of slot %u: status %d, produced %u of "
+                      "%u, or the data differs\n",
+                      i,
+                      pBatch->decResults[i].status,
+                      pBatch->decResults[i].produced,
+                      pSrc->pBuffers->dataLenInBytes);
+            return CPA_STATUS_FAIL;
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Copy the corpus into chunks of setup->bufferSize, at most one per slot */
+static CpaStatus dcBatchAllocChunks(dc_batch_t *pBatch, Cpa32U metaSize)
+{
+    compression_test_params_t *setup = pBatch->setup;
+    const corpus_file_t *pFiles = getFilesInCorpus(setup->corpus);
+    Cpa32U numFiles = getNumFilesInCorpus(setup->corpus);
+    Cpa32U *pSizes = NULL;
+    Cpa32U offset = 0;
+    Cpa32U len = 0;
+    Cpa32U i = 0;
+    Cpa32U chunk = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    for (i = 0; i < numFiles; i++)
+    {
+        pBatch->numChunks += (pFiles[i].corpusBinaryDataLen +
+                              setup->bufferSize - 1) /
+                             setup->bufferSize;
+    }
+    if (pBatch->numChunks > DC_BATCH_NUM_SLOTS)
+    {
+        pBatch->numChunks = DC_BATCH_NUM_SLOTS;
+    }
+    if (0 == pBatch->numChunks)
+    {
+        PRINT_ERR("The corpus is empty\n");
+        return CPA_STATUS_FAIL;
+    }
+
+    status = AllocArrayOfStructures(
+        (void **)&pSizes, pBatch->numChunks, sizeof(Cpa32U));
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = AllocArrayOfStructures((void **)&pBatch->srcLists,
+                                        pBatch->numChunks,
+                                        sizeof(CpaBufferList));
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        for (i = 0; i < pBatch->numChunks; i++)
+        {
+            pSizes[i] = setup->bufferSize;
+        }
+        status = AllocateBuffersInLists(pBatch->srcLists,
+                                        pBatch->numChunks,
+                                        1,
+                                        pSizes,
+                                        0,
+                                        metaSize,
+                                        setup->node,
+                                        BYTE_ALIGNMENT_64);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            FreeArrayOfStructures((void **)&pBatch->srcLists);
+        }
+    }
+    if (NULL != pSizes)
+    {
+        FreeArrayOfStructures((void **)&pSizes);
+    }
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("Unable to allocate the batch test source buffers\n");
+        return CPA_STATUS_FAIL;
+    }
+
+    for (i = 0; i < numFiles && chunk < pBatch->numChunks; i++)
+    {
+        for (offset = 0; offset < pFiles[i].corpusBinaryDataLen &&
+                         chunk < pBatch->numChunks;
+             offset += len)
+        {
+            len = pFiles[i].corpusBinaryDataLen - offset;
+            if (len > setup->bufferSize)
+            {
+                len = setup->bufferSize;
+            }
+            memcpy(pBatch->srcLists[chunk].pBuffers->pData,
+                   pFiles[i].corpusBinaryData + offset,
+                   len);
+            pBatch->srcLists[chunk].pBuffers->dataLenInBytes = len;
+            chunk++;
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Allocate one array of DC_BATCH_NUM_SLOTS buffer lists of bufferSize */
+static CpaStatus dcBatchAllocLists(dc_batch_t *pBatch,
+                                   CpaBufferList **pLists,
+                                   Cpa32U bufferSize,
+                                   Cpa32U metaSize)
+{
+    Cpa32U *pSizes = NULL;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    status = AllocArrayOfStructures(
+        (void **)&pSizes, DC_BATCH_NUM_SLOTS, sizeof(Cpa32U));
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = AllocArrayOfStructures(
+            (void **)pLists, DC_BATCH_NUM_SLOTS, sizeof(CpaBufferList));
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        for (i = 0; i < DC_BATCH_NUM_SLOTS; i++)
+        {
+            pSizes[i] = bufferSize;
+        }
+        status = AllocateBuffersInLists(*pLists,
+                                        DC_BATCH_NUM_SLOTS,
+                                        1,
+                                        pSizes,
+                                        0,
+                                        metaSize,
+                                        pBatch->setup->node,
+                                        BYTE_ALIGNMENT_64);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            FreeArrayOfStructures((void **)pLists);
+        }
+    }
+    if (NULL != pSizes)
+    {
+        FreeArrayOfStructures((void **)&pSizes);
+    }
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("Unable to allocate the batch test buffers\n");
+    }
+    return status;
+}
+
+static void dcBatchFree(dc_batch_t *pBatch)
+{
+    if (NULL != pBatch->srcLists)
+    {
+        freeBuffersInLists(pBatch->srcLists, pBatch->numChunks);
+        FreeArrayOfStructures((void **)&pBatch->srcLists);
+    }
+    if (NULL != pBatch->cmpLists)
+    {
+        freeBuffersInLists(pBatch->cmpLists, DC_BATCH_NUM_SLOTS);
+        FreeArrayOfStructures((void **)&pBatch->cmpLists);
+    }
+    if (NULL != pBatch->decLists)
+    {
+        freeBuffersInLists(pBatch->decLists, DC_BATCH_NUM_SLOTS);
+        FreeArrayOfStructures((void **)&pBatch->decLists);
+    }
+    if (NULL != pBatch->cmpResults)
+    {
+        FreeArrayOfStructures((void **)&pBatch->cmpResults);
+    }
+    if (NULL != pBatch->decResults)
+    {
+        FreeArrayOfStructures((void **)&pBatch->decResults);
+    }
+    if (NULL != pBatch->entries)
+    {
+        FreeArrayOfStructures((void **)&pBatch->entries);
+    }
+}
+
+static CpaStatus dcBatchInitSessions(dc_batch_t *pBatch)
+{
+    compression_test_params_t *setup = pBatch->setup;
+    Cpa32U sessionSize = 0;
+    Cpa32U contextSize = 0;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    status = cpaDcGetSessionSize(setup->dcInstanceHandle,
+                                 &setup->setupData,
+                                 &sessionSize,
+                                 &contextSize);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaDcGetSessionSize returned status %d\n", status);
+        return status;
+    }
+    for (i = 0; i < DC_BATCH_NUM_SESSIONS; i++)
+    {
+        pBatch->sessions[i] = (CpaDcSessionHandle)qaeMemAllocNUMA(
+            sessionSize, setup->node, BYTE_ALIGNMENT_64);
+        if (NULL == pBatch->sessions[i])
+        {
+            PRINT_ERR("Unable to allocate memory for the batch sessions\n");
+            return CPA_STATUS_FAIL;
+        }
+        status = cpaDcInitSession(setup->dcInstanceHandle,
+                                  pBatch->sessions[i],
+                                  &setup->setupData,
+                                  NULL,
+                                  dcBatchCallback);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("cpaDcInitSession returned status %d\n", status);
+            qaeMemFreeNUMA((void **)&pBatch->sessions[i]);
+            return status;
+        }
+        pBatch->numSessions++;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+static void dcBatchRemoveSessions(dc_batch_t *pBatch)
+{
+    Cpa32U i = 0;
+
+    for (i = 0; i < pBatch->numSessions; i++)
+    {
+        cpaDcRemoveSession(pBatch->setup->dcInstanceHandle,
+                           pBatch->sessions[i]);
+        qaeMemFreeNUMA((void **)&pBatch->sessions[i]);
+    }
+    pBatch->numSessions = 0;
+}
+
+static CpaStatus dcPerformBatch(compression_test_params_t *setup)
+{
+    dc_batch_t batch;
+    CpaInstanceInfo2 instanceInfo2 = {0};
+    Cpa32U metaSize = 0;
+    Cpa32U consumed = 0;
+    Cpa32U produced = 0;
+    Cpa32U loop = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    perf_data_t *perfData = setup->performanceStats;
+
+    memset(&batch, 0, sizeof(dc_batch_t));
+    batch.setup = setup;
+
+    status = cpaDcInstanceGetInfo2(setup->dcInstanceHandle, &instanceInfo2);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaDcInstanceGetInfo2 returned status %d\n", status);
+        return status;
+    }
+    batch.isPolled = instanceInfo2.isPolled;
+
+    status = cpaDcBufferListGetMetaSize(setup->dcInstanceHandle, 1, &metaSize);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaDcBufferListGetMetaSize returned status %d\n", status);
+        return status;
+    }
+    status = dcBatchAllocChunks(&batch, metaSize);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = dcBatchAllocLists(&batch,
+                                   &batch.cmpLists,
+                                   setup->bufferSize * EXTRA_BUFFER,
+                                   metaSize);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = dcBatchAllocLists(
+            &batch, &batch.decLists, setup->bufferSize, metaSize);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = AllocArrayOfStructures((void **)&batch.cmpResults,
+                                        DC_BATCH_NUM_SLOTS,
+                                        sizeof(CpaDcRqResults));
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = AllocArrayOfStructures((void **)&batch.decResults,
+                                        DC_BATCH_NUM_SLOTS,
+                                        sizeof(CpaDcRqResults));
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = AllocArrayOfStructures((void **)&batch.entries,
+                                        DC_BATCH_NUM_SLOTS,
+                                        sizeof(icp_sal_dc_batch_op_data_t));
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = dcBatchInitSessions(&batch);
+    }
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        dcBatchRemoveSessions(&batch);
+        dcBatchFree(&batch);
+        return CPA_STATUS_FAIL;
+    }
+
+    batch.cmpOpData = setup->requestOps;
+    batch.cmpOpData.flushFlag = CPA_DC_FLUSH_FINAL;
+    batch.decOpData = setup->requestOps;
+    batch.decOpData.flushFlag = CPA_DC_FLUSH_FINAL;
+    /*compress and verify does not apply to decompression*/
+    batch.decOpData.compressAndVerify = CPA_FALSE;
+
+    /*the decompression test needs compressed data to start with*/
+    if (CPA_DC_DIR_DECOMPRESS == setup->dcSessDir)
+    {
+        status = dcBatchRun(&batch, CPA_DC_DIR_COMPRESS);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = dcBatchCheckCompress(&batch, &produced, &consumed);
+        }
+    }
+
+    perfData->startCyclesTimestamp = sampleCodeTimestamp();
+    for (loop = 0; loop < setup->numLoops && CPA_STATUS_SUCCESS == status;
+         loop++)
+    {
+        status = dcBatchRun(&batch, setup->dcSessDir);
+        if (CPA_STATUS_SUCCESS == status &&
+            CPA_DC_DIR_COMPRESS == setup->dcSessDir)
+        {
+            status = dcBatchCheckCompress(&batch, &consumed, &produced);
+        }
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            perfData->responses += DC_BATCH_NUM_SLOTS;
+        }
+    }
+    perfData->endCyclesTimestamp = sampleCodeTimestamp();
+    perfData->numOperations = perfData->responses;
+    perfData->bytesConsumedPerLoop = consumed;
+    perfData->bytesProducedPerLoop = produced;
+
+    /*check the output of the last compression loop*/
+    if (CPA_STATUS_SUCCESS == status &&
+        CPA_DC_DIR_COMPRESS == setup->dcSessDir)
+    {
+        status = dcBatchRun(&batch, CPA_DC_DIR_DECOMPRESS);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = dcBatchCheckDecompress(&batch);
+    }
+
+    /* On a polled instance the ring holds fewer requests than a loop, so
+     * the ring filled up and batches were submitted in part */
+    if (CPA_STATUS_SUCCESS == status && CPA_TRUE == batch.isPolled &&
+        (0 == perfData->retries || 0 == batch.numPartialSubmits))
+    {
+        PRINT_ERR("Batch: the ring did not fill up, %u retries, %llu "
+                  "partial submits\n",
+                  perfData->retries,
+                  (unsigned long long)batch.numPartialSubmits);
+        status = CPA_STATUS_FAIL;
+    }
+    PRINT("Batch: %u retries, %llu partial submits\n",
+          perfData->retries,
+          (unsigned long long)batch.numPartialSubmits);
+
+    /*requests that got no response still use the sessions and buffers*/
+    if (CPA_TRUE != batch.lostResponse)
+    {
+        dcBatchRemoveSessions(&batch);
+        dcBatchFree(&batch);
+    }
+    return status;
+}
+
+/* print the batch size, then the statistics of the test */
+static CpaStatus dcBatchPrintStats(thread_creation_data_t *data)
+{
+    compression_test_params_t *dcSetup =
+        (compression_test_params_t *)data->setupPtr;
+
+    PRINT("Batch Size             %u\n", dcSetup->numRequests);
+    PRINT("Requests per Loop      %u\n", DC_BATCH_NUM_SLOTS);
+    return dcPrintStats(data);
+}
+
+/* this is the performance thread created by the sample code framework
+ * after registering setupDcBatchTest and calling createPerformanceThreads */
+void dcPerformanceBatch(single_thread_test_data_t *testSetup)
+{
+    compression_test_params_t dcSetup = {0};
+    compression_test_params_t *tmpSetup = NULL;
+    CpaInstanceHandle *instances = NULL;
+    CpaDcInstanceCapabilities capabilities = {0};
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa16U numInstances = 0;
+
+    tmpSetup = (compression_test_params_t *)(testSetup->setupPtr);
+    testSetup->passCriteria = tmpSetup->passCriteria;
+    dcSetup.passCriteria = tmpSetup->passCriteria;
+    dcSetup.bufferSize = tmpSetup->bufferSize;
+    dcSetup.corpus = tmpSetup->corpus;
+    dcSetup.setupData = tmpSetup->setupData;
+    dcSetup.dcSessDir = tmpSetup->dcSessDir;
+    dcSetup.syncFlag = tmpSetup->syncFlag;
+    dcSetup.numLoops = tmpSetup->numLoops;
+    dcSetup.numRequests = tmpSetup->numRequests;
+    dcSetup.requestOps = tmpSetup->requestOps;
+
+    /*give our thread a unique memory location to store performance stats*/
+    dcSetup.performanceStats = testSetup->performanceStats;
+    testSetup->performanceStats->threadReturnStatus = CPA_STATUS_SUCCESS;
+    testSetup->performanceStats->additionalStatus = CPA_STATUS_SUCCESS;
+
+    /*this barrier is to halt this thread when run in user space context, the
+     * startThreads function releases this barrier, in kernel space is does
+     * nothing, but kernel space threads do not start
+     * until we call startThreads anyway
+     */
+    startBarrier();
+
+    /*Initialise the statsPrintFunc to NULL, the dcBatchPrintStats function
+     * will be assigned if compression completes successfully
+     */
+    testSetup->statsPrintFunc = NULL;
+
+    status = cpaDcGetNumInstances(&numInstances);
+    if (CPA_STATUS_SUCCESS != status || 0 == numInstances)
+    {
+        PRINT_ERR(" DC Instances are not present\n");
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        instances = qaeMemAlloc(sizeof(CpaInstanceHandle) * numInstances);
+        if (NULL == instances)
+        {
+            PRINT_ERR("Unable to allocate Memory for Instances\n");
+            status = CPA_STATUS_FAIL;
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = cpaDcGetInstances(numInstances, instances);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR(" Unable to get DC instances\n");
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        /* give our thread a logical quick assist instance to use
+         * use % to wrap around the max number of instances*/
+        dcSetup.dcInstanceHandle =
+            instances[(testSetup->logicalQaInstance) % numInstances];
+        status = sampleCodeDcGetNode(dcSetup.dcInstanceHandle, &dcSetup.node);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("sampleCodeDcGetNode error\n");
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status =
+            cpaDcQueryCapabilities(dcSetup.dcInstanceHandle, &capabilities);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("%s::%d cpaDcQueryCapabilities failed",
+                      __func__,
+                      __LINE__);
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status &&
+        CPA_FALSE == capabilities.dynamicHuffman &&
+        CPA_DC_HT_FULL_DYNAMIC == dcSetup.setupData.huffType)
+    {
+        PRINT("Dynamic is not supported on logical instance %d\n",
+              (testSetup->logicalQaInstance) % numInstances);
+        status = CPA_STATUS_FAIL;
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        /*launch function that does all the work*/
+        status = dcPerformBatch(&dcSetup);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            dcPrintTestData(&dcSetup);
+            PRINT_ERR("Compression Batch Thread %u FAILED\n",
+                      testSetup->threadID);
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        /*set the print function that can be used to print
+         * statistics at the end of the test
+         * */
+        testSetup->performanceStats->numLoops = dcSetup.numLoops;
+        testSetup->statsPrintFunc = (stats_print_func_t)dcBatchPrintStats;
+    }
+    else
+    {
+        testSetup->performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    qaeMemFree((void **)&instances);
+
+    sampleCodeThreadComplete(testSetup->threadID);
+}
+
+CpaStatus setupDcBatchTest(CpaDcSessionDir direction,
+                           CpaDcCompLvl compLevel,
+                           CpaDcHuffType huffmanType,
+                           Cpa32U testBufferSize,
+                           Cpa32U batchSize,
+                           corpus_type_t corpusType,
+                           Cpa32U numLoops)
+{
+    compression_test_params_t *dcSetup = NULL;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    /* check that the sample code framework can register this test setup */
+    if (testTypeCount_g >= MAX_THREAD_VARIATION)
+    {
+        PRINT_ERR("Maximum Support Thread Variation has been exceeded\n");
+        PRINT_ERR("Number of Thread Variations created: %d", testTypeCount_g);
+        PRINT_ERR(" Max is %d\n", MAX_THREAD_VARIATION);
+        return CPA_STATUS_FAIL;
+    }
+    if (0 == numLoops)
+    {
+        PRINT_ERR("numLoops must be > 0\n");
+        return CPA_STATUS_FAIL;
+    }
+    if (CPA_DC_DIR_COMPRESS != direction && CPA_DC_DIR_DECOMPRESS != direction)
+    {
+        PRINT_ERR("direction must be compress or decompress\n");
+        return CPA_STATUS_FAIL;
+    }
+    /* a poll of DC_BATCH_POLL_QUOTA responses must leave a batch without
+     * room for all its entries */
+    if (batchSize <= DC_BATCH_POLL_QUOTA || batchSize > DC_BATCH_NUM_SLOTS)
+    {
+        PRINT_ERR("batchSize must be > %u and <= %u\n",
+                  DC_BATCH_POLL_QUOTA,
+                  DC_BATCH_NUM_SLOTS);
+        return CPA_STATUS_FAIL;
+    }
+
+    /* a test that did not print its statistics leaves the service started
+     * and its polling threads running, they would take the responses this
+     * test needs to fill the ring */
+    stopDcServices(NULL);
+
+    /* Populate Corpus: copy from file on disk into memory*/
+    status = populateCorpus(testBufferSize, corpusType);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("Unable to load one or more corpus files, have they been "
+                  "extracted to /lib/firmware?\n");
+        return CPA_STATUS_FAIL;
+    }
+
+    /*Start DC Services */
+    status = startDcServices(testBufferSize, TEMP_NUM_BUFFS);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("Error in Starting Dc Services\n");
+        return CPA_STATUS_FAIL;
+    }
+    /* no polling threads are created, the test polls polled instances
+     * itself so that the ring fills up between polls */
+
+    /* get memory location from sample code framework to store setup details*/
+    dcSetup = (compression_test_params_t *)&thread_setup_g[testTypeCount_g][0];
+    memset(dcSetup, 0, sizeof(compression_test_params_t));
+    INIT_OPDATA_DEFAULT(&dcSetup->requestOps);
+    if (getSetupCnVRequestFlag() != CNV_FLAG_DEFAULT)
+    {
+        setCnVFlags(getSetupCnVRequestFlag(), &dcSetup->requestOps);
+    }
+
+    testSetupData_g[testTypeCount_g].performance_function =
+        (performance_func_t)dcPerformanceBatch;
+    testSetupData_g[testTypeCount_g].packetSize = testBufferSize;
+
+    /* The batch functions only accept stateless sessions, which are used in
+     * both directions */
+    dcSetup->setupData.compLevel = compLevel;
+    dcSetup->setupData.compType = CPA_DC_DEFLATE;
+    dcSetup->setupData.sessDirection = CPA_DC_DIR_COMBINED;
+#ifdef SC_ENABLE_DYNAMIC_COMPRESSION
+    dcSetup->setupData.huffType = huffmanType;
+#else
+    dcSetup->setupData.huffType = CPA_DC_HT_STATIC;
+#endif
+    dcSetup->setupData.fileType = CPA_DC_FT_ASCII;
+    dcSetup->setupData.sessState = CPA_DC_STATELESS;
+#if (CPA_DC_API_VERSION_NUM_MAJOR == 1 && CPA_DC_API_VERSION_NUM_MINOR < 6)
+    dcSetup->setupData.deflateWindowSize = DEFAULT_COMPRESSION_WINDOW_SIZE;
+#endif
+    dcSetup->setupData.autoSelectBestHuffmanTree = gAutoSelectBestMode;
+    dcSetup->setupData.checksum = gChecksum;
+    dcSetup->corpus = corpusType;
+    dcSetup->bufferSize = testBufferSize;
+    dcSetup->dcSessDir = direction;
+    dcSetup->syncFlag = CPA_SAMPLE_ASYNCHRONOUS;
+    dcSetup->numLoops = numLoops;
+    dcSetup->numRequests = batchSize;
+    dcSetup->isDpApi = CPA_FALSE;
+    dcSetup->passCriteria = getPassCriteria();
+
+    return status;
+}
+EXPORT_SYMBOL(setupDcBatchTest);
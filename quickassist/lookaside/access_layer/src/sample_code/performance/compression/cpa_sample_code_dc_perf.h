@@ -105,6 +105,8 @@
 #define MIN_DST_BUFFER_SIZE (8192)
 #define DEFAULT_COMPRESSION_LOOPS (100)
 #define DEFAULT_COMPRESSION_WINDOW_SIZE (7)
+/* Entries of a batch of the batch test */
+#define DC_BATCH_SIZE (64)
 #define INITIAL_RESPONSE_COUNT (-1)
 #define SCALING_FACTOR_100 (100)
 #define SCALING_FACTOR_1000 (1000)
@@ -594,6 +596,90 @@ CpaStatus setupDcStatefulTest(CpaDcCompType algorithm,
                               synchronous_flag_t syncFlag,
                               Cpa32U numLoops);
 
+/**
+ * *****************************************************************************
+ *  @ingroup compressionThreads
+ *  setupDcStreamTest
+ *
+ *  @description
+ *      this API configures a test that compresses each corpus file through
+ *      the compression stream of icp_sal_dc_stream.h, to be compared with
+ *      the stateful test
+ *  @threadSafe
+ *      No
+ *
+ *  @param[out]   None
+ *
+ *  @param[in]  compLevel compression Level
+ *  @param[in]  huffmanType HuffMantype Dynamic/static
+ *  @param[in]  chunkSize input bytes per request of the stream
+ *  @parma[in]  corpusType type of corpus calgary/cantrbury corpus
+ *  @param[in]  numloops Number of loops to compress the corpus
+ ******************************************************************************/
+CpaStatus setupDcStreamTest(CpaDcCompLvl compLevel,
+                            CpaDcHuffType huffmanType,
+                            Cpa32U chunkSize,
+                            corpus_type_t corpusType,
+                            Cpa32U numLoops);
+
+/**
+ * *****************************************************************************
+ *  @ingroup compressionThreads
+ *  dcPerformanceStream
+ *
+ *  @description
+ *      performance thread of the compression stream test
+ *  @threadSafe
+ *      Yes
+ *
+ *  @param[in]  testSetup thread setup registered by setupDcStreamTest
+ ******************************************************************************/
+void dcPerformanceStream(single_thread_test_data_t *testSetup);
+
+/**
+ * *****************************************************************************
+ *  @ingroup compressionThreads
+ *  setupDcBatchTest
+ *
+ *  @description
+ *      this API configures a test that submits stateless requests through
+ *      icp_sal_DcCompressDataBatch or icp_sal_DcDecompressDataBatch until
+ *      the ring is full and checks the decompressed data against the corpus
+ *  @threadSafe
+ *      No
+ *
+ *  @param[out]   None
+ *
+ *  @param[in]  direction compress or decompress, the direction timed
+ *  @param[in]  compLevel compression Level
+ *  @param[in]  huffmanType HuffMantype Dynamic/static
+ *  @param[in]  testBufferSize input bytes per request
+ *  @param[in]  batchSize entries per batch
+ *  @parma[in]  corpusType type of corpus calgary/cantrbury corpus
+ *  @param[in]  numloops Number of loops to submit the requests
+ ******************************************************************************/
+CpaStatus setupDcBatchTest(CpaDcSessionDir direction,
+                           CpaDcCompLvl compLevel,
+                           CpaDcHuffType huffmanType,
+                           Cpa32U testBufferSize,
+                           Cpa32U batchSize,
+                           corpus_type_t corpusType,
+                           Cpa32U numLoops);
+
+/**
+ * *****************************************************************************
+ *  @ingroup compressionThreads
+ *  dcPerformanceBatch
+ *
+ *  @description
+ *      performance thread of the compression batch test
+ *  @threadSafe
+ *      Yes
+ *
+ *  @param[in]  testSetup thread setup registered by setupDcBatchTest
+ ******************************************************************************/
+void dcPerformanceBatch(single_thread_test_data_t *testSetup);
+
 /**
  * *****************************************************************************
  *  @ingroup compressionThreads
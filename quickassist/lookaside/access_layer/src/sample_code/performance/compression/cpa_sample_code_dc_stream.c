@@ -0,0 +1,758 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_dc_stream.c
+ *
+ * @ingroup compressionThreads
+ *
+ * @description
+ *    This is a sample code that measures the compression stream of
+ *    icp_sal_dc_stream.h. Each file of the calgary/canterbury corpus is
+ *    pushed through a stream as a whole and the output is pulled into a
+ *    scratch buffer, framed with the gzip/zlib header and footer of the
+ *    session. The stream cuts the file into chunks of setup->bufferSize and
+ *    keeps several of them in flight, so the results can be compared with
+ *    the stateful test run with the same buffer size.
+ *    Before the timed loops, each file is compressed once through a CRC32
+ *    (gzip) and an Adler32 (zlib) stream into a buffer holding the whole
+ *    framed output, which zlib inflates and compares with the file. The
+ *    checksum of the stream is also compared with the one zlib computes
+ *    over the file.
+ *    Time stamping is started before the first file is pushed and stopped
+ *    when the last file of the last loop has been pulled.
+ *****************************************************************************/
+
+#include "cpa_sample_code_utils_common.h"
+#include "cpa_sample_code_dc_perf.h"
+#include "cpa_sample_code_dc_utils.h"
+#include "qat_perf_buffer_utils.h"
+#include "qat_perf_utils.h"
+#include "qat_perf_cycles.h"
+
+#include "icp_sal_poll.h"
+#include "icp_sal_dc_stream.h"
+
+#ifdef USER_SPACE
+#include "zlib.h"
+#endif
+
+/* Size of the buffer the compressed data is pulled into */
+#define DC_STREAM_SCRATCH_SIZE (BUFFER_SIZE_65536)
+
+/* Room for the largest gzip or zlib header and footer */
+#define DC_STREAM_FRAMING_SIZE (32)
+
+/* Window bits asking zlib to detect a gzip or a zlib header */
+#define DC_STREAM_ZLIB_AUTO_HEADER (MAX_WBITS + 32)
+
+/* Wait for the responses of the stream when nothing can be pulled */
+static void dcStreamWait(compression_test_params_t *setup,
+                         CpaBoolean pollInline)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    if (CPA_TRUE == pollInline)
+    {
+        coo_poll_trad_dc(
+            setup->performanceStats, setup->dcInstanceHandle, &status);
+        if (CPA_STATUS_RETRY == status)
+        {
+            setup->performanceStats->pollRetries++;
+        }
+    }
+    else
+    {
+        AVOID_SOFTLOCKUP;
+    }
+}
+
+/* Compress one corpus file through the stream, including the header and
+ * footer, and return the results and the number of bytes produced. The
+ * output is pulled into pScratch, overwriting the previous pull, unless
+ * pOut is given, in which case the whole framed output is kept in pOut */
+static CpaStatus dcStreamCompressFile(compression_test_params_t *setup,
+                                      CpaDcSessionHandle pSessionHandle,
+                                      icp_sal_dc_stream_handle_t hStream,
+                                      const corpus_file_t *pFile,
+                                      Cpa8U *pScratch,
+                                      Cpa8U *pOut,
+                                      Cpa32U outSize,
+                                      CpaBoolean pollInline,
+                                      CpaDcRqResults *pResults,
+                                      Cpa32U *pProduced)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaFlatBuffer framing = {0};
+    CpaBoolean endOfStream = CPA_FALSE;
+    CpaBoolean lastData = CPA_FALSE;
+    Cpa8U *pPull = pScratch;
+    Cpa32U pullSize = DC_STREAM_SCRATCH_SIZE;
+    Cpa32U pushed = 0;
+    Cpa32U consumed = 0;
+    Cpa32U produced = 0;
+    Cpa32U headerSize = 0;
+
+    framing.pData = pScratch;
+    framing.dataLenInBytes = DC_STREAM_FRAMING_SIZE;
+    if (NULL != pOut)
+    {
+        framing.pData = pOut;
+    }
+    status = cpaDcGenerateHeader(pSessionHandle, &framing, &headerSize);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaDcGenerateHeader returned status %d\n", status);
+        return status;
+    }
+    if (NULL != pOut)
+    {
+        pPull = pOut + headerSize;
+        pullSize = outSize - headerSize;
+    }
+
+    while (CPA_FALSE == endOfStream)
+    {
+        if (CPA_FALSE == lastData)
+        {
+            status = icp_sal_DcStreamPush(hStream,
+                                          pFile->corpusBinaryData + pushed,
+                                          pFile->corpusBinaryDataLen - pushed,
+                                          CPA_TRUE,
+                                          &consumed);
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("icp_sal_DcStreamPush returned status %d\n",
+                          status);
+                return status;
+            }
+            pushed += consumed;
+            if (pushed == pFile->corpusBinaryDataLen)
+            {
+                lastData = CPA_TRUE;
+            }
+        }
+
+        if (0 == pullSize)
+        {
+            PRINT_ERR("Output of %u bytes does not fit the stream buffer\n",
+                      outSize);
+            return CPA_STATUS_FAIL;
+        }
+        status = icp_sal_DcStreamPull(
+            hStream, pPull, pullSize, &produced, &endOfStream);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("icp_sal_DcStreamPull returned status %d\n", status);
+            return status;
+        }
+        if (NULL != pOut)
+        {
+            pPull += produced;
+            pullSize -= produced;
+        }
+        if (0 == produced && CPA_FALSE == endOfStream)
+        {
+            dcStreamWait(setup, pollInline);
+        }
+    }
+
+    status = icp_sal_DcStreamGetResults(hStream, pResults);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("icp_sal_DcStreamGetResults returned status %d\n", status);
+        return status;
+    }
+    if (NULL != pOut)
+    {
+        if (pullSize < DC_STREAM_FRAMING_SIZE)
+        {
+            PRINT_ERR("Footer does not fit the stream buffer\n");
+            return CPA_STATUS_FAIL;
+        }
+        framing.pData = pPull;
+    }
+    status = cpaDcGenerateFooter(pSessionHandle, &framing, pResults);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaDcGenerateFooter returned status %d\n", status);
+        return status;
+    }
+    *pProduced = headerSize + pResults->produced;
+
+    return icp_sal_DcStreamReset(hStream);
+}
+
+#ifdef USER_SPACE
+/* Inflate the framed output of a file with zlib, which also checks the
+ * checksum and length of the footer, then compare the data with the file
+ * and the checksum of the stream with the one zlib computes */
+static CpaStatus dcStreamCheckFile(const corpus_file_t *pFile,
+                                   CpaDcChecksum checksumType,
+                                   Cpa8U *pOut,
+                                   Cpa32U outLen,
+                                   Cpa8U *pDecomp,
+                                   const CpaDcRqResults *pResults)
+{
+    z_stream stream = {0};
+    Cpa32U swChecksum = 0;
+    int ret = Z_OK;
+
+    ret = inflateInit2(&stream, DC_STREAM_ZLIB_AUTO_HEADER);
+    if (Z_OK != ret)
+    {
+        PRINT_ERR("Error in inflateInit2, ret = %d\n", ret);
+        return CPA_STATUS_FAIL;
+    }
+    stream.next_in = pOut;
+    stream.avail_in = outLen;
+    stream.next_out = pDecomp;
+    /* One byte more than the file, to catch an output that is too long */
+    stream.avail_out = pFile->corpusBinaryDataLen + 1;
+    ret = inflate(&stream, Z_FINISH);
+    if (Z_STREAM_END != ret)
+    {
+        PRINT_ERR("Error in inflate, ret = %d, msg = %s\n",
+                  ret,
+                  (NULL != stream.msg) ? stream.msg : "none");
+        inflateEnd(&stream);
+        return CPA_STATUS_FAIL;
+    }
+    inflateEnd(&stream);
+
+    if (0 != stream.avail_in ||
+        pFile->corpusBinaryDataLen != stream.total_out ||
+        pFile->corpusBinaryDataLen != pResults->consumed ||
+        0 != memcmp(pDecomp,
+                    pFile->corpusBinaryData,
+                    pFile->corpusBinaryDataLen))
+    {
+        PRINT_ERR("Inflated stream of %lu bytes does not match the file of "
+                  "%u bytes\n",
+                  stream.total_out,
+                  pFile->corpusBinaryDataLen);
+        return CPA_STATUS_FAIL;
+    }
+
+    if (CPA_DC_CRC32 == checksumType)
+    {
+        swChecksum = crc32(crc32(0L, Z_NULL, 0),
+                           pFile->corpusBinaryData,
+                           pFile->corpusBinaryDataLen);
+    }
+    else
+    {
+        swChecksum = adler32(adler32(0L, Z_NULL, 0),
+                             pFile->corpusBinaryData,
+                             pFile->corpusBinaryDataLen);
+    }
+    if (pResults->checksum != swChecksum)
+    {
+        PRINT_ERR("s/w checksum: %X    stream checksum: %X\n",
+                  swChecksum,
+                  pResults->checksum);
+        return CPA_STATUS_FAIL;
+    }
+
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Compress each file of the corpus once through a stream with the given
+ * checksum, keeping the whole output, and check it with zlib */
+static CpaStatus dcStreamVerify(compression_test_params_t *setup,
+                                CpaDcChecksum checksumType,
+                                CpaBoolean pollInline)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaDcSessionSetupData sessionData = setup->setupData;
+    CpaDcSessionHandle pSessionHandle = NULL;
+    icp_sal_dc_stream_handle_t hStream = NULL;
+    icp_sal_dc_stream_setup_data_t streamSetupData = {0};
+    CpaDcRqResults results = {0};
+    const corpus_file_t *pFiles = NULL;
+    Cpa8U *pOut = NULL;
+    Cpa8U *pDecomp = NULL;
+    Cpa32U numFiles = 0;
+    Cpa32U maxFileLen = 0;
+    Cpa32U outSize = 0;
+    Cpa32U sessionSize = 0;
+    Cpa32U contextSize = 0;
+    Cpa32U produced = 0;
+    Cpa32U i = 0;
+
+    pFiles = getFilesInCorpus(setup->corpus);
+    numFiles = getNumFilesInCorpus(setup->corpus);
+    for (i = 0; i < numFiles; i++)
+    {
+        if (pFiles[i].corpusBinaryDataLen > maxFileLen)
+        {
+            maxFileLen = pFiles[i].corpusBinaryDataLen;
+        }
+    }
+    /* Stored blocks expand the data by a few bytes per chunk, twice the
+     * file leaves ample room for the output of any chunk size */
+    outSize = 2 * maxFileLen + 2 * DC_STREAM_FRAMING_SIZE;
+
+    sessionData.checksum = checksumType;
+    status = cpaDcGetSessionSize(
+        setup->dcInstanceHandle, &sessionData, &sessionSize, &contextSize);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaDcGetSessionSize returned status %d\n", status);
+        return status;
+    }
+    pSessionHandle = (CpaDcSessionHandle)qaeMemAllocNUMA(
+        sessionSize, setup->node, BYTE_ALIGNMENT_64);
+    pOut = qaeMemAlloc(outSize);
+    pDecomp = qaeMemAlloc(maxFileLen + 1);
+    if (NULL == pSessionHandle || NULL == pOut || NULL == pDecomp)
+    {
+        PRINT_ERR("Unable to allocate memory for the stream check\n");
+        qaeMemFreeNUMA((void **)&pSessionHandle);
+        qaeMemFree((void **)&pOut);
+        qaeMemFree((void **)&pDecomp);
+        return CPA_STATUS_FAIL;
+    }
+
+    streamSetupData.chunkSizeInBytes = setup->bufferSize;
+    status = icp_sal_DcStreamCreate(setup->dcInstanceHandle,
+                                    pSessionHandle,
+                                    &sessionData,
+                                    &streamSetupData,
+                                    &hStream);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("icp_sal_DcStreamCreate returned status %d\n", status);
+        qaeMemFreeNUMA((void **)&pSessionHandle);
+        qaeMemFree((void **)&pOut);
+        qaeMemFree((void **)&pDecomp);
+        return status;
+    }
+
+    for (i = 0; i < numFiles && CPA_STATUS_SUCCESS == status; i++)
+    {
+        status = dcStreamCompressFile(setup,
+                                      pSessionHandle,
+                                      hStream,
+                                      &pFiles[i],
+                                      NULL,
+                                      pOut,
+                                      outSize,
+                                      pollInline,
+                                      &results,
+                                      &produced);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = dcStreamCheckFile(
+                &pFiles[i], checksumType, pOut, produced, pDecomp, &results);
+        }
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("Stream check failed on file %u of the corpus\n", i);
+        }
+    }
+
+    while (CPA_STATUS_RETRY == icp_sal_DcStreamRemove(hStream))
+    {
+        dcStreamWait(setup, pollInline);
+    }
+    qaeMemFreeNUMA((void **)&pSessionHandle);
+    qaeMemFree((void **)&pOut);
+    qaeMemFree((void **)&pDecomp);
+
+    return status;
+}
+#endif
+
+static CpaStatus dcPerformStream(compression_test_params_t *setup)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaInstanceInfo2 instanceInfo2 = {0};
+    CpaDcSessionHandle pSessionHandle = NULL;
+    icp_sal_dc_stream_handle_t hStream = NULL;
+    icp_sal_dc_stream_setup_data_t streamSetupData = {0};
+    CpaDcRqResults results = {0};
+    const corpus_file_t *pFiles = NULL;
+    CpaBoolean pollInline = CPA_FALSE;
+    Cpa8U *pScratch = NULL;
+    Cpa32U numFiles = 0;
+    Cpa32U sessionSize = 0;
+    Cpa32U contextSize = 0;
+    Cpa32U produced = 0;
+    Cpa32U loop = 0;
+    Cpa32U i = 0;
+    perf_data_t *perfData = setup->performanceStats;
+
+    status = cpaDcInstanceGetInfo2(setup->dcInstanceHandle, &instanceInfo2);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaDcInstanceGetInfo2 returned status %d\n", status);
+        return status;
+    }
+    if (poll_inline_g && instanceInfo2.isPolled)
+    {
+        pollInline = CPA_TRUE;
+    }
+
+#ifdef USER_SPACE
+    /* Check the gzip and zlib framed output before measuring */
+    status = dcStreamVerify(setup, CPA_DC_CRC32, pollInline);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = dcStreamVerify(setup, CPA_DC_ADLER32, pollInline);
+    }
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+#endif
+
+    status = cpaDcGetSessionSize(setup->dcInstanceHandle,
+                                 &setup->setupData,
+                                 &sessionSize,
+                                 &contextSize);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaDcGetSessionSize returned status %d\n", status);
+        return status;
+    }
+    pSessionHandle = (CpaDcSessionHandle)qaeMemAllocNUMA(
+        sessionSize, setup->node, BYTE_ALIGNMENT_64);
+    pScratch = qaeMemAllocNUMA(
+        DC_STREAM_SCRATCH_SIZE, setup->node, BYTE_ALIGNMENT_64);
+    if (NULL == pSessionHandle || NULL == pScratch)
+    {
+        PRINT_ERR("Unable to allocate memory for the stream test\n");
+        qaeMemFreeNUMA((void **)&pSessionHandle);
+        qaeMemFreeNUMA((void **)&pScratch);
+        return CPA_STATUS_FAIL;
+    }
+
+    streamSetupData.chunkSizeInBytes = setup->bufferSize;
+    status = icp_sal_DcStreamCreate(setup->dcInstanceHandle,
+                                    pSessionHandle,
+                                    &setup->setupData,
+                                    &streamSetupData,
+                                    &hStream);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("icp_sal_DcStreamCreate returned status %d\n", status);
+        qaeMemFreeNUMA((void **)&pSessionHandle);
+        qaeMemFreeNUMA((void **)&pScratch);
+        return status;
+    }
+
+    pFiles = getFilesInCorpus(setup->corpus);
+    numFiles = getNumFilesInCorpus(setup->corpus);
+
+    perfData->startCyclesTimestamp = sampleCodeTimestamp();
+    for (loop = 0; loop < setup->numLoops && CPA_STATUS_SUCCESS == status;
+         loop++)
+    {
+        for (i = 0; i < numFiles && CPA_STATUS_SUCCESS == status; i++)
+        {
+            status = dcStreamCompressFile(setup,
+                                          pSessionHandle,
+                                          hStream,
+                                          &pFiles[i],
+                                          pScratch,
+                                          NULL,
+                                          0,
+                                          pollInline,
+                                          &results,
+                                          &produced);
+            if (CPA_STATUS_SUCCESS == status)
+            {
+                perfData->responses++;
+                if (0 == loop)
+                {
+                    perfData->bytesConsumedPerLoop +=
+                        pFiles[i].corpusBinaryDataLen;
+                    perfData->bytesProducedPerLoop += produced;
+                }
+            }
+        }
+    }
+    perfData->endCyclesTimestamp = sampleCodeTimestamp();
+    perfData->numOperations = perfData->responses;
+
+    /* Requests may still be in flight if a file failed, poll until the
+     * stream can be removed */
+    while (CPA_STATUS_RETRY == icp_sal_DcStreamRemove(hStream))
+    {
+        dcStreamWait(setup, pollInline);
+    }
+    qaeMemFreeNUMA((void **)&pSessionHandle);
+    qaeMemFreeNUMA((void **)&pScratch);
+
+    return status;
+}
+
+/* this is the performance thread created by the sample code framework
+ * after registering setupDcStreamTest and calling createPerformanceThreads */
+void dcPerformanceStream(single_thread_test_data_t *testSetup)
+{
+    compression_test_params_t dcSetup = {0};
+    compression_test_params_t *tmpSetup = NULL;
+    CpaInstanceHandle *instances = NULL;
+    CpaDcInstanceCapabilities capabilities = {0};
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa16U numInstances = 0;
+
+    tmpSetup = (compression_test_params_t *)(testSetup->setupPtr);
+    testSetup->passCriteria = tmpSetup->passCriteria;
+    dcSetup.passCriteria = tmpSetup->passCriteria;
+    dcSetup.bufferSize = tmpSetup->bufferSize;
+    dcSetup.corpus = tmpSetup->corpus;
+    dcSetup.setupData = tmpSetup->setupData;
+    dcSetup.dcSessDir = tmpSetup->dcSessDir;
+    dcSetup.syncFlag = tmpSetup->syncFlag;
+    dcSetup.numLoops = tmpSetup->numLoops;
+
+    /*give our thread a unique memory location to store performance stats*/
+    dcSetup.performanceStats = testSetup->performanceStats;
+    testSetup->performanceStats->threadReturnStatus = CPA_STATUS_SUCCESS;
+    testSetup->performanceStats->additionalStatus = CPA_STATUS_SUCCESS;
+
+    /*this barrier is to halt this thread when run in user space context, the
+     * startThreads function releases this barrier, in kernel space is does
+     * nothing, but kernel space threads do not start
+     * until we call startThreads anyway
+     */
+    startBarrier();
+
+    /*Initialise the statsPrintFunc to NULL, the dcPrintStats function will
+     * be assigned if compression completes successfully
+     */
+    testSetup->statsPrintFunc = NULL;
+
+    status = cpaDcGetNumInstances(&numInstances);
+    if (CPA_STATUS_SUCCESS != status || 0 == numInstances)
+    {
+        PRINT_ERR(" DC Instances are not present\n");
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        instances = qaeMemAlloc(sizeof(CpaInstanceHandle) * numInstances);
+        if (NULL == instances)
+        {
+            PRINT_ERR("Unable to allocate Memory for Instances\n");
+            status = CPA_STATUS_FAIL;
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = cpaDcGetInstances(numInstances, instances);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR(" Unable to get DC instances\n");
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        /* give our thread a logical quick assist instance to use
+         * use % to wrap around the max number of instances*/
+        dcSetup.dcInstanceHandle =
+            instances[(testSetup->logicalQaInstance) % numInstances];
+        status = sampleCodeDcGetNode(dcSetup.dcInstanceHandle, &dcSetup.node);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("sampleCodeDcGetNode error\n");
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status =
+            cpaDcQueryCapabilities(dcSetup.dcInstanceHandle, &capabilities);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("%s::%d cpaDcQueryCapabilities failed",
+                      __func__,
+                      __LINE__);
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status &&
+        CPA_FALSE == capabilities.dynamicHuffman &&
+        CPA_DC_HT_FULL_DYNAMIC == dcSetup.setupData.huffType)
+    {
+        PRINT("Dynamic is not supported on logical instance %d\n",
+              (testSetup->logicalQaInstance) % numInstances);
+        status = CPA_STATUS_FAIL;
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        /*launch function that does all the work*/
+        status = dcPerformStream(&dcSetup);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            dcPrintTestData(&dcSetup);
+            PRINT_ERR("Compression Stream Thread %u FAILED\n",
+                      testSetup->threadID);
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        /*set the print function that can be used to print
+         * statistics at the end of the test
+         * */
+        testSetup->performanceStats->numLoops = dcSetup.numLoops;
+        testSetup->statsPrintFunc = (stats_print_func_t)dcPrintStats;
+    }
+    else
+    {
+        testSetup->performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    qaeMemFree((void **)&instances);
+
+    sampleCodeThreadComplete(testSetup->threadID);
+}
+
+CpaStatus setupDcStreamTest(CpaDcCompLvl compLevel,
+                            CpaDcHuffType huffmanType,
+                            Cpa32U chunkSize,
+                            corpus_type_t corpusType,
+                            Cpa32U numLoops)
+{
+    compression_test_params_t *dcSetup = NULL;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    /* check that the sample code framework can register this test setup */
+    if (testTypeCount_g >= MAX_THREAD_VARIATION)
+    {
+        PRINT_ERR("Maximum Support Thread Variation has been exceeded\n");
+        PRINT_ERR("Number of Thread Variations created: %d", testTypeCount_g);
+        PRINT_ERR(" Max is %d\n", MAX_THREAD_VARIATION);
+        return CPA_STATUS_FAIL;
+    }
+    if (0 == numLoops)
+    {
+        PRINT_ERR("numLoops must be > 0\n");
+        return CPA_STATUS_FAIL;
+    }
+
+    /* Populate Corpus: copy from file on disk into memory*/
+    status = populateCorpus(chunkSize, corpusType);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("Unable to load one or more corpus files, have they been "
+                  "extracted to /lib/firmware?\n");
+        return CPA_STATUS_FAIL;
+    }
+
+    /*Start DC Services */
+    status = startDcServices(chunkSize, TEMP_NUM_BUFFS);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("Error in Starting Dc Services\n");
+        return CPA_STATUS_FAIL;
+    }
+    if (!poll_inline_g)
+    {
+        /* start polling threads if polling is enabled in the configuration
+         * file */
+        if (CPA_STATUS_SUCCESS != dcCreatePollingThreadsIfPollingIsEnabled())
+        {
+            PRINT_ERR("Error creating polling threads\n");
+            return CPA_STATUS_FAIL;
+        }
+    }
+
+    /* get memory location from sample code framework to store setup details*/
+    dcSetup = (compression_test_params_t *)&thread_setup_g[testTypeCount_g][0];
+    memset(dcSetup, 0, sizeof(compression_test_params_t));
+
+    testSetupData_g[testTypeCount_g].performance_function =
+        (performance_func_t)dcPerformanceStream;
+    testSetupData_g[testTypeCount_g].packetSize = chunkSize;
+
+    /* The stream only accepts stateless compression sessions */
+    dcSetup->setupData.compLevel = compLevel;
+    dcSetup->setupData.compType = CPA_DC_DEFLATE;
+    dcSetup->setupData.sessDirection = CPA_DC_DIR_COMPRESS;
+#ifdef SC_ENABLE_DYNAMIC_COMPRESSION
+    dcSetup->setupData.huffType = huffmanType;
+#else
+    dcSetup->setupData.huffType = CPA_DC_HT_STATIC;
+#endif
+    dcSetup->setupData.fileType = CPA_DC_FT_ASCII;
+    dcSetup->setupData.sessState = CPA_DC_STATELESS;
+#if (CPA_DC_API_VERSION_NUM_MAJOR == 1 && CPA_DC_API_VERSION_NUM_MINOR < 6)
+    dcSetup->setupData.deflateWindowSize = DEFAULT_COMPRESSION_WINDOW_SIZE;
+#endif
+    dcSetup->setupData.autoSelectBestHuffmanTree = gAutoSelectBestMode;
+    dcSetup->setupData.checksum = gChecksum;
+    dcSetup->corpus = corpusType;
+    dcSetup->bufferSize = chunkSize;
+    dcSetup->dcSessDir = CPA_DC_DIR_COMPRESS;
+    dcSetup->syncFlag = CPA_SAMPLE_ASYNCHRONOUS;
+    dcSetup->numLoops = numLoops;
+    dcSetup->isDpApi = CPA_FALSE;
+    dcSetup->passCriteria = getPassCriteria();
+
+    return status;
+}
+EXPORT_SYMBOL(setupDcStreamTest);
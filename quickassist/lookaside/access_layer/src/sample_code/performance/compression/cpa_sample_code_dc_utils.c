@@ -1191,6 +1191,45 @@ CpaStatus sampleCodeDcGetNode(CpaInstanceHandle instanceHandle, Cpa32U *node)
 }
 EXPORT_SYMBOL(sampleCodeDcGetNode);
 
+#ifdef USER_SPACE
+/* Drives a hybrid instance through the adaptive wait API, returns
+ * CPA_STATUS_UNSUPPORTED if the instance is not configured as hybrid */
+static CpaStatus sampleCodeDcHybridWait(CpaInstanceHandle instanceHandle_in)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    icp_sal_wait_stats_t waitStats = {0};
+
+    while (dc_service_started_g == CPA_TRUE)
+    {
+        status = icp_sal_DcWaitInstance(
+            instanceHandle_in, 0, DEFAULT_HYBRID_WAIT_MSEC);
+        if (CPA_STATUS_UNSUPPORTED == status)
+        {
+            return status;
+        }
+        if (CPA_STATUS_SUCCESS != status && CPA_STATUS_RETRY != status)
+        {
+            PRINT_ERR("ERROR icp_sal_DcWaitInstance returned status %d\n",
+                      status);
+            error_flag_g = CPA_TRUE;
+            break;
+        }
+    }
+    if (CPA_STATUS_SUCCESS ==
+        icp_sal_DcGetWaitStats(instanceHandle_in, &waitStats))
+    {
+        PRINT("Hybrid wait: polls %llu spins %llu yields %llu sleeps %llu "
+              "wakeups %llu\n",
+              (unsigned long long)waitStats.numPolls,
+              (unsigned long long)waitStats.numSpins,
+              (unsigned long long)waitStats.numYields,
+              (unsigned long long)waitStats.numSleeps,
+              (unsigned long long)waitStats.numWakeups);
+    }
+    return CPA_STATUS_SUCCESS;
+}
+#endif
+
 /* Change to a compression callback tag with parameter for poll interval */
 void sampleCodeDcPoll(CpaInstanceHandle instanceHandle_in)
 {
@@ -1199,6 +1238,12 @@ void sampleCodeDcPoll(CpaInstanceHandle instanceHandle_in)
     struct timespec reqTime, remTime;
     reqTime.tv_sec = 0;
     reqTime.tv_nsec = DEFAULT_POLL_INTERVAL_NSEC;
+
+    if (CPA_STATUS_UNSUPPORTED != sampleCodeDcHybridWait(instanceHandle_in))
+    {
+        sampleCodeThreadExit();
+        return;
+    }
 #endif
     while (dc_service_started_g == CPA_TRUE)
     {
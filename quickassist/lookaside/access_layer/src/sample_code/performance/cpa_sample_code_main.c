@@ -86,6 +86,12 @@
 #include "qat_compression_main.h"
 #endif
 #include "cpa_sample_code_sym_perf_dp.h"
+#include "cpa_sample_code_sym_session_perf.h"
+#include "cpa_sample_code_sym_queue_stress.h"
+#include "cpa_sample_code_sym_host_fallback.h"
+#include "cpa_sample_code_ec_curve_perf.h"
+#include "cpa_sample_code_asym_batch_perf.h"
+#include "cpa_sample_code_rsa_key_context_perf.h"
 #include "icp_sal_versions.h"
 #ifdef SC_BNP_ENABLED
 #include "cpa_sample_code_dc_bnp.h"
@@ -106,6 +112,7 @@ corpus_type_t sampleCorpus;
 
 #ifdef USER_SPACE
 #include "icp_sal_user.h"
+#include "cpa_sample_code_host_perf.h"
 
 extern CpaStatus qaeMemInit(void);
 extern void qaeMemDestroy(void);
@@ -136,7 +143,8 @@ option_t optArray[MAX_NUMOPT] = {
     {"getLatency", 0},
     {"getOffloadCost", 0},
     {"compOnly", 0},
-    {"verboseOutput", 1}};
+    {"verboseOutput", 1},
+    {"pkeProfile", 0}};
 
 #define SIGN_OF_LIFE_OPT_ARRAY_POS (0)
 #define RUN_TEST_OPT_ARRAY_POS (1)
@@ -150,6 +158,7 @@ option_t optArray[MAX_NUMOPT] = {
 #define USE_STATIC_PRIME (9)
 #define GET_LATENCY_POS (10)
 #define GET_OFFLOAD_COST_POS (11)
+#define PKE_PROFILE_POS (14)
 
 #else /* #ifdef USER_SPACE */
 
@@ -635,6 +644,7 @@ EXPORT_SYMBOL(printDriverVersion);
 #define COMPRESSION_CODE (32)
 #define COMPRESSION_BNP_CODE (64)
 #define CHAINING_CODE (128)
+#define HOST_CODE (256)
 #define FIRST_INSTANCE (1)
 
 /***************************************************************************
@@ -683,6 +693,19 @@ int main(int argc, char *argv[])
 #ifdef DO_CRYPTO
     CpaCyCapabilitiesInfo cap = {0};
     Cpa32U computeLatency = 0;
+    sym_session_setup_mode_t sessionSetupMode = SYM_SESSION_SETUP_INIT;
+    CpaCySymHashAlgorithm hostFallbackHashes[] = {CPA_CY_SYM_HASH_AES_GCM,
+                                                  CPA_CY_SYM_HASH_SHA1,
+                                                  CPA_CY_SYM_HASH_SHA256};
+    ecdsa_step_t ecCurveStep = ECDSA_STEP_SIGNRS;
+    Cpa32U ecCurveBits[] = {GFP_P256_SIZE_IN_BITS, GFP_P384_SIZE_IN_BITS};
+    Cpa32U ecCurveIndex = 0;
+    CpaBoolean ecNamedCurve = CPA_FALSE;
+    asym_batch_op_t asymBatchOp = ASYM_BATCH_RSA_DECRYPT;
+    Cpa32U asymBatchSize = 0;
+    Cpa32U rsaKeyContextModSizes[] = {MODULUS_2048_BIT, MODULUS_4096_BIT};
+    Cpa32U rsaKeyContextIndex = 0;
+    CpaBoolean rsaKeyContext = CPA_FALSE;
 #else
 #ifdef USER_SPACE
     Cpa32U computeLatency = 0;
@@ -707,6 +730,7 @@ int main(int argc, char *argv[])
     runStateful = optArray[RUN_STATEFUL_ARRAY_POS].optValue;
     computeLatency = optArray[GET_LATENCY_POS].optValue;
     computeOffloadCost = optArray[GET_OFFLOAD_COST_POS].optValue;
+    pkeProfile = optArray[PKE_PROFILE_POS].optValue;
 
 #ifndef LATENCY_CODE
     /* If Latency support is not compiled in and the user asks
@@ -794,6 +818,22 @@ int main(int argc, char *argv[])
     {
         PRINT("qaeMemInit started\n");
     }
+
+    /* The host benchmarks do not use a device, so when they are the only
+     * tests requested SAL is not started */
+    if ((HOST_CODE & runTests) == HOST_CODE)
+    {
+        getCPUSpeed();
+        if (CPA_STATUS_SUCCESS != runHostPerfTests())
+        {
+            retStatus = CPA_STATUS_FAIL;
+        }
+        if (HOST_CODE == runTests)
+        {
+            qaeMemDestroy();
+            return retStatus;
+        }
+    }
     processName = "SSL";
 
     if (USE_V1_CONFIG_FILE == configFileVersion)
@@ -1407,6 +1447,112 @@ int main(int argc, char *argv[])
                 }
             }
         }
+
+        /*SESSION SETUP RATE TESTS, a few keys reused across many sessions
+         * so the precompute cache can be measured when it is enabled, run
+         * with each of the session setup APIs*/
+        for (sessionSetupMode = SYM_SESSION_SETUP_INIT;
+             sessionSetupMode <= SYM_SESSION_SETUP_BATCH;
+             sessionSetupMode++)
+        {
+            status = setupSymSessionTest(CPA_CY_SYM_HASH_SHA256,
+                                         KEY_SIZE_256_IN_BYTES,
+                                         SYM_SESSION_NUM_KEYS,
+                                         signOfLife ? SYM_SESSION_NUM_KEYS
+                                                    : SYM_SESSION_NUM_SESSIONS,
+                                         sessionSetupMode);
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("Error calling setupSymSessionTest\n");
+                return CPA_STATUS_FAIL;
+            }
+            status = createStartandWaitForCompletion(CRYPTO);
+            if (status == CPA_STATUS_FAIL)
+            {
+                retStatus = CPA_STATUS_FAIL;
+            }
+
+            status = setupSymSessionTest(CPA_CY_SYM_HASH_AES_GCM,
+                                         KEY_SIZE_128_IN_BYTES,
+                                         SYM_SESSION_NUM_KEYS,
+                                         signOfLife ? SYM_SESSION_NUM_KEYS
+                                                    : SYM_SESSION_NUM_SESSIONS,
+                                         sessionSetupMode);
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("Error calling setupSymSessionTest\n");
+                return CPA_STATUS_FAIL;
+            }
+            status = createStartandWaitForCompletion(CRYPTO);
+            if (status == CPA_STATUS_FAIL)
+            {
+                retStatus = CPA_STATUS_FAIL;
+            }
+
+            /*AES-128-CBC with HMAC-SHA1 uses the optimised content
+             * descriptor*/
+            status = setupSymSessionTest(CPA_CY_SYM_HASH_SHA1,
+                                         KEY_SIZE_128_IN_BYTES,
+                                         SYM_SESSION_NUM_KEYS,
+                                         signOfLife ? SYM_SESSION_NUM_KEYS
+                                                    : SYM_SESSION_NUM_SESSIONS,
+                                         sessionSetupMode);
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("Error calling setupSymSessionTest\n");
+                return CPA_STATUS_FAIL;
+            }
+            status = createStartandWaitForCompletion(CRYPTO);
+            if (status == CPA_STATUS_FAIL)
+            {
+                retStatus = CPA_STATUS_FAIL;
+            }
+        }
+
+        /*SESSION QUEUE STRESS TEST, full packets from several threads
+         * interleaved with partial packet streams on one session, polled
+         * by the test and then by the sending threads*/
+        for (i = 0; i < 2; i++)
+        {
+            status = setupSymQueueStressTest(
+                SYM_QUEUE_STRESS_NUM_THREADS,
+                signOfLife ? SYM_QUEUE_STRESS_SOL_NUM_REQUESTS
+                           : SYM_QUEUE_STRESS_NUM_REQUESTS,
+                (0 == i) ? CPA_FALSE : CPA_TRUE);
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("Error calling setupSymQueueStressTest\n");
+                return CPA_STATUS_FAIL;
+            }
+            status = createStartandWaitForCompletion(CRYPTO);
+            if (status == CPA_STATUS_FAIL)
+            {
+                retStatus = CPA_STATUS_FAIL;
+            }
+        }
+
+        /*SYM HOST FALLBACK, requests executed on the host when the ring is
+         * busy checked against the device, skipped unless
+         * Cy<n>SymHostFallback is set*/
+        for (i = 0;
+             i < sizeof(hostFallbackHashes) / sizeof(hostFallbackHashes[0]);
+             i++)
+        {
+            status = setupSymHostFallbackTest(
+                hostFallbackHashes[i],
+                signOfLife ? SYM_HOST_FALLBACK_SOL_NUM_BURSTS
+                           : SYM_HOST_FALLBACK_NUM_BURSTS);
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("Error calling setupSymHostFallbackTest\n");
+                return CPA_STATUS_FAIL;
+            }
+            status = createStartandWaitForCompletion(CRYPTO);
+            if (status == CPA_STATUS_FAIL)
+            {
+                retStatus = CPA_STATUS_FAIL;
+            }
+        }
     }
 #endif /* DO_CRYPTO */
 
@@ -1525,6 +1671,121 @@ int main(int argc, char *argv[])
             retStatus = CPA_STATUS_FAIL;
         }
     }
+
+    /**************************************************************************
+     * NAMED CURVE PERFORMANCE, every operation with the curve parameters in
+     * the request and then on a named curve handle
+     **************************************************************************/
+    if (((ECDSA_CODE & runTests) == ECDSA_CODE) && (computeLatency == 0))
+    {
+        for (ecCurveIndex = 0;
+             ecCurveIndex < sizeof(ecCurveBits) / sizeof(ecCurveBits[0]);
+             ecCurveIndex++)
+        {
+            for (ecCurveStep = ECDSA_STEP_SIGNRS;
+                 ecCurveStep <= ECDSA_STEP_POINT_MULTIPLY;
+                 ecCurveStep++)
+            {
+                for (ecNamedCurve = CPA_FALSE; ecNamedCurve <= CPA_TRUE;
+                     ecNamedCurve++)
+                {
+                    status = setupEcCurveTest(ecCurveBits[ecCurveIndex],
+                                              ecCurveStep,
+                                              ecNamedCurve,
+                                              cyNumBuffers,
+                                              cyAsymLoops);
+                    if (CPA_STATUS_SUCCESS != status)
+                    {
+                        PRINT_ERR("Error calling setupEcCurveTest\n");
+                        return CPA_STATUS_FAIL;
+                    }
+                    status = createStartandWaitForCompletion(CRYPTO);
+                    if (status == CPA_STATUS_FAIL)
+                    {
+                        retStatus = CPA_STATUS_FAIL;
+                    }
+                }
+            }
+        }
+    }
+
+    /**************************************************************************
+     * ASYM BATCH PERFORMANCE, RSA2048 CRT decrypt and ECDSA P256 sign
+     * submitted in batches of 1 to 64 requests
+     **************************************************************************/
+    if (computeLatency == 0)
+    {
+        for (asymBatchOp = ASYM_BATCH_RSA_DECRYPT;
+             asymBatchOp <= ASYM_BATCH_ECDSA_SIGNRS;
+             asymBatchOp++)
+        {
+            if ((ASYM_BATCH_RSA_DECRYPT == asymBatchOp) &&
+                ((RSA_CODE & runTests) != RSA_CODE))
+            {
+                continue;
+            }
+            if ((ASYM_BATCH_ECDSA_SIGNRS == asymBatchOp) &&
+                ((ECDSA_CODE & runTests) != ECDSA_CODE))
+            {
+                continue;
+            }
+            for (asymBatchSize = 1; asymBatchSize <= ASYM_BATCH_MAX_SIZE;
+                 asymBatchSize *= 2)
+            {
+                status = setupAsymBatchTest(
+                    asymBatchOp,
+                    (ASYM_BATCH_RSA_DECRYPT == asymBatchOp)
+                        ? MODULUS_2048_BIT
+                        : GFP_P256_SIZE_IN_BITS,
+                    asymBatchSize,
+                    cyNumBuffers,
+                    cyAsymLoops);
+                if (CPA_STATUS_SUCCESS != status)
+                {
+                    PRINT_ERR("Error calling setupAsymBatchTest\n");
+                    return CPA_STATUS_FAIL;
+                }
+                status = createStartandWaitForCompletion(CRYPTO);
+                if (status == CPA_STATUS_FAIL)
+                {
+                    retStatus = CPA_STATUS_FAIL;
+                }
+            }
+        }
+    }
+
+    /**************************************************************************
+     * RSA KEY CONTEXT PERFORMANCE, RSA CRT decrypt with the private key in
+     * every request and with a private key context
+     **************************************************************************/
+    if (((RSA_CODE & runTests) == RSA_CODE) && (computeLatency == 0))
+    {
+        for (rsaKeyContextIndex = 0;
+             rsaKeyContextIndex <
+             sizeof(rsaKeyContextModSizes) / sizeof(rsaKeyContextModSizes[0]);
+             rsaKeyContextIndex++)
+        {
+            for (rsaKeyContext = CPA_FALSE; rsaKeyContext <= CPA_TRUE;
+                 rsaKeyContext++)
+            {
+                status = setupRsaKeyContextTest(
+                    rsaKeyContextModSizes[rsaKeyContextIndex],
+                    rsaKeyContext,
+                    cyNumBuffers,
+                    cyAsymLoops);
+                if (CPA_STATUS_SUCCESS != status)
+                {
+                    PRINT_ERR("Error calling setupRsaKeyContextTest\n");
+                    return CPA_STATUS_FAIL;
+                }
+                status = createStartandWaitForCompletion(CRYPTO);
+                if (status == CPA_STATUS_FAIL)
+                {
+                    retStatus = CPA_STATUS_FAIL;
+                }
+            }
+        }
+    }
 #endif /*DO_CRYPTO*/
 
 #ifdef INCLUDE_COMPRESSION
@@ -1853,6 +2114,60 @@ int main(int argc, char *argv[])
                     PRINT("Stateful Compression thread(s) failed\n");
                     return status;
                 }
+
+                /*COMPRESSION STREAM TEST, pipelined stateless requests with
+                 * the same buffer size, to compare with the stateful test*/
+                status = setupDcStreamTest(SAMPLE_CODE_CPA_DC_L1,
+                                           CPA_DC_HT_FULL_DYNAMIC,
+                                           BUFFER_SIZE_8192,
+                                           sampleCorpus,
+                                           dcLoops);
+                if (CPA_STATUS_SUCCESS != status)
+                {
+                    PRINT_ERR("Compression stream setup failed\n");
+                }
+                createPerfomanceThreads(sizeof(statefulMultiThreadCoreMap) /
+                                            sizeof(Cpa32U),
+                                        statefulMultiThreadCoreMap,
+                                        numInst_g,
+                                        0);
+                status = startThreads();
+                if (CPA_STATUS_SUCCESS != status)
+                {
+                    PRINT("Error starting threads\n");
+                    return status;
+                }
+                status = waitForThreadCompletion();
+                if (CPA_STATUS_SUCCESS != status)
+                {
+                    PRINT("Compression stream thread(s) failed\n");
+                    return status;
+                }
+            }
+
+            /*BATCH COMPRESSION & DECOMPRESSION, stateless requests submitted
+             * through icp_sal_DcCompressDataBatch and
+             * icp_sal_DcDecompressDataBatch until the ring is full*/
+            for (i = 0; i < 2; i++)
+            {
+                status = setupDcBatchTest((0 == i) ? CPA_DC_DIR_COMPRESS
+                                                   : CPA_DC_DIR_DECOMPRESS,
+                                          SAMPLE_CODE_CPA_DC_L1,
+                                          CPA_DC_HT_STATIC,
+                                          dcBufferSize,
+                                          DC_BATCH_SIZE,
+                                          sampleCorpus,
+                                          dcLoops);
+                if (CPA_STATUS_SUCCESS != status)
+                {
+                    PRINT_ERR("Error calling setupDcBatchTest\n");
+                    return CPA_STATUS_FAIL;
+                }
+                status = createStartandWaitForCompletion(COMPRESSION);
+                if (status == CPA_STATUS_FAIL)
+                {
+                    retStatus = CPA_STATUS_FAIL;
+                }
             }
 
             /* Data Plane API Sample Code Test */
@@ -0,0 +1,678 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_asym_batch_perf.c
+ *
+ * @ingroup sampleAsymBatchPerf
+ *
+ * @description
+ *     Measures the ops/sec of RSA decrypt and ECDSA sign requests submitted
+ *     in batches of 1 to ASYM_BATCH_MAX_SIZE with the batch API.
+ *
+ *****************************************************************************/
+#include "cpa_sample_code_asym_batch_perf.h"
+
+/* Buffers of a batch test thread */
+typedef struct asym_batch_data_s
+{
+    /*RSA key, generated once and shared by all requests*/
+    CpaCyRsaPrivateKey *pPrivateKey[1];
+    CpaCyRsaPublicKey *pPublicKey[1];
+    /*RSA operation data and output of every request of a loop*/
+    CpaCyRsaDecryptOpData **ppDecryptOpData;
+    CpaFlatBuffer **ppDecryptOutputData;
+    icp_sal_rsa_decrypt_batch_op_data_t *pRsaBatch;
+    /*curve parameters and scalars, below n for every curve*/
+    CpaFlatBuffer q;
+    CpaFlatBuffer a;
+    CpaFlatBuffer b;
+    CpaFlatBuffer n;
+    CpaFlatBuffer xg;
+    CpaFlatBuffer yg;
+    CpaFlatBuffer k;
+    CpaFlatBuffer d;
+    CpaFlatBuffer m;
+    /*ECDSA output of every request of a loop*/
+    CpaFlatBuffer *pR;
+    CpaFlatBuffer *pS;
+    /*ECDSA operation data, shared by all requests as it is only read*/
+    CpaCyEcdsaSignRSOpData signRSOpData;
+    icp_sal_ecdsa_sign_rs_batch_op_data_t *pEcdsaBatch;
+} asym_batch_data_t;
+
+static void asymBatchRsaCallback(void *pCallbackTag,
+                                 CpaStatus status,
+                                 void *pOpData,
+                                 CpaFlatBuffer *pOut)
+{
+    perf_data_t *pPerfData = (perf_data_t *)pCallbackTag;
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("RSA Decrypt callback failed: status = %d\n", status);
+        pPerfData->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    processCallback(pCallbackTag);
+}
+
+static void asymBatchEcdsaCallback(void *pCallbackTag,
+                                   CpaStatus status,
+                                   void *pOpData,
+                                   CpaBoolean multiplyStatus,
+                                   CpaFlatBuffer *pR,
+                                   CpaFlatBuffer *pS)
+{
+    perf_data_t *pPerfData = (perf_data_t *)pCallbackTag;
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("ECDSA Sign callback failed: status = %d\n", status);
+        pPerfData->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    processCallback(pCallbackTag);
+}
+
+static void asymBatchMemFree(asym_batch_test_params_t *setup,
+                             asym_batch_data_t *pData)
+{
+    asym_test_params_t rsaSetup = {0};
+    Cpa32U i = 0;
+
+    if (NULL != pData->pPrivateKey[0])
+    {
+        rsaSetup.numBuffers = 1;
+        rsaFreeKeyMemory(&rsaSetup, pData->pPrivateKey, pData->pPublicKey);
+    }
+    if (NULL != pData->ppDecryptOpData)
+    {
+        rsaSetup.numBuffers = setup->numBuffers;
+        rsaFreeDataMemory(&rsaSetup,
+                          pData->ppDecryptOpData,
+                          pData->ppDecryptOutputData,
+                          NULL,
+                          NULL);
+        qaeMemFree((void **)&pData->ppDecryptOpData);
+        qaeMemFree((void **)&pData->ppDecryptOutputData);
+    }
+    if (NULL != pData->pRsaBatch)
+    {
+        qaeMemFree((void **)&pData->pRsaBatch);
+    }
+
+    FREE_NUMA_MEM(pData->q.pData);
+    FREE_NUMA_MEM(pData->a.pData);
+    FREE_NUMA_MEM(pData->b.pData);
+    FREE_NUMA_MEM(pData->n.pData);
+    FREE_NUMA_MEM(pData->xg.pData);
+    FREE_NUMA_MEM(pData->yg.pData);
+    FREE_NUMA_MEM(pData->k.pData);
+    FREE_NUMA_MEM(pData->d.pData);
+    FREE_NUMA_MEM(pData->m.pData);
+    for (i = 0; i < setup->numBuffers; i++)
+    {
+        if (NULL != pData->pR)
+        {
+            FREE_NUMA_MEM(pData->pR[i].pData);
+        }
+        if (NULL != pData->pS)
+        {
+            FREE_NUMA_MEM(pData->pS[i].pData);
+        }
+    }
+    if (NULL != pData->pR)
+    {
+        qaeMemFree((void **)&pData->pR);
+    }
+    if (NULL != pData->pS)
+    {
+        qaeMemFree((void **)&pData->pS);
+    }
+    if (NULL != pData->pEcdsaBatch)
+    {
+        qaeMemFree((void **)&pData->pEcdsaBatch);
+    }
+}
+
+static CpaStatus asymBatchRsaSetup(asym_batch_test_params_t *setup,
+                                   asym_batch_data_t *pData)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    asym_test_params_t rsaSetup = {0};
+    Cpa32U i = 0;
+
+    rsaSetup.performanceStats = setup->performanceStats;
+    rsaSetup.cyInstanceHandle = setup->cyInstanceHandle;
+    rsaSetup.syncMode = ASYNC;
+    rsaSetup.modulusSizeInBytes = setup->sizeInBytes;
+    rsaSetup.rsaKeyRepType = CPA_CY_RSA_PRIVATE_KEY_REP_TYPE_2;
+    rsaSetup.numLoops = setup->numLoops;
+    rsaSetup.threadID = setup->threadID;
+
+    /*one key for all the requests, as on a server*/
+    rsaSetup.numBuffers = 1;
+    status = genKeyArray(&rsaSetup, pData->pPrivateKey, pData->pPublicKey);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("genKeyArray error %d\n", status);
+        pData->pPrivateKey[0] = NULL;
+        return CPA_STATUS_FAIL;
+    }
+
+    pData->ppDecryptOpData =
+        qaeMemAlloc(sizeof(CpaCyRsaDecryptOpData *) * setup->numBuffers);
+    pData->ppDecryptOutputData =
+        qaeMemAlloc(sizeof(CpaFlatBuffer *) * setup->numBuffers);
+    pData->pRsaBatch = qaeMemAlloc(sizeof(icp_sal_rsa_decrypt_batch_op_data_t) *
+                                   setup->numBuffers);
+    if ((NULL == pData->ppDecryptOpData) ||
+        (NULL == pData->ppDecryptOutputData) || (NULL == pData->pRsaBatch))
+    {
+        PRINT_ERR("qaeMemAlloc error\n");
+        /*the operation data arrays are only freed as a pair*/
+        if (NULL != pData->ppDecryptOpData)
+        {
+            qaeMemFree((void **)&pData->ppDecryptOpData);
+        }
+        if (NULL != pData->ppDecryptOutputData)
+        {
+            qaeMemFree((void **)&pData->ppDecryptOutputData);
+        }
+        asymBatchMemFree(setup, pData);
+        return CPA_STATUS_FAIL;
+    }
+    memset(pData->ppDecryptOpData,
+           0,
+           sizeof(CpaCyRsaDecryptOpData *) * setup->numBuffers);
+    memset(pData->ppDecryptOutputData,
+           0,
+           sizeof(CpaFlatBuffer *) * setup->numBuffers);
+
+    rsaSetup.numBuffers = setup->numBuffers;
+    status = rsaDecryptDataSetup(NULL,
+                                 pData->ppDecryptOpData,
+                                 pData->ppDecryptOutputData,
+                                 &rsaSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        asymBatchMemFree(setup, pData);
+        return CPA_STATUS_FAIL;
+    }
+
+    for (i = 0; i < setup->numBuffers; i++)
+    {
+        pData->ppDecryptOpData[i]->pRecipientPrivateKey = pData->pPrivateKey[0];
+        pData->pRsaBatch[i].pDecryptOpData = pData->ppDecryptOpData[i];
+        pData->pRsaBatch[i].pOutputData = pData->ppDecryptOutputData[i];
+        pData->pRsaBatch[i].pCallbackTag = setup->performanceStats;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/* A number with a zero top byte is below n for all the NIST prime curves */
+static CpaStatus asymBatchScalarAlloc(asym_batch_test_params_t *setup,
+                                      CpaFlatBuffer *pBuf,
+                                      Cpa8U fill)
+{
+    CpaStatus status = bufferDataMemAlloc(
+        setup->cyInstanceHandle, pBuf, setup->sizeInBytes, NULL, 0);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        memset(pBuf->pData, fill, pBuf->dataLenInBytes);
+        pBuf->pData[0] = 0;
+    }
+    return status;
+}
+
+static CpaStatus asymBatchEcdsaSetup(asym_batch_test_params_t *setup,
+                                     asym_batch_data_t *pData)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    ecdsa_test_params_t curveSetup = {0};
+    ec_curves_t *pCurve = NULL;
+    Cpa32U i = 0;
+
+    curveSetup.nLenInBytes = setup->sizeInBytes;
+    curveSetup.fieldType = CPA_CY_EC_FIELD_TYPE_PRIME;
+    status = getCurveData(&curveSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+    pCurve = curveSetup.pCurve;
+
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->q,
+                         pCurve->sizeOfp,
+                         pCurve->p,
+                         pCurve->sizeOfp,
+                         asymBatchMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->a,
+                         pCurve->sizeOfa,
+                         pCurve->a,
+                         pCurve->sizeOfa,
+                         asymBatchMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->b,
+                         pCurve->sizeOfb,
+                         pCurve->b,
+                         pCurve->sizeOfb,
+                         asymBatchMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->n,
+                         pCurve->sizeOfr,
+                         pCurve->r,
+                         pCurve->sizeOfr,
+                         asymBatchMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->xg,
+                         pCurve->sizeOfxg,
+                         pCurve->xg,
+                         pCurve->sizeOfxg,
+                         asymBatchMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->yg,
+                         pCurve->sizeOfyg,
+                         pCurve->yg,
+                         pCurve->sizeOfyg,
+                         asymBatchMemFree(setup, pData));
+
+    if ((CPA_STATUS_SUCCESS != asymBatchScalarAlloc(setup, &pData->k, 0x5a)) ||
+        (CPA_STATUS_SUCCESS != asymBatchScalarAlloc(setup, &pData->d, 0x3c)) ||
+        (CPA_STATUS_SUCCESS != asymBatchScalarAlloc(setup, &pData->m, 0xa5)))
+    {
+        PRINT_ERR("Failed to allocate scalar memory\n");
+        asymBatchMemFree(setup, pData);
+        return CPA_STATUS_FAIL;
+    }
+
+    pData->pR = qaeMemAlloc(sizeof(CpaFlatBuffer) * setup->numBuffers);
+    pData->pS = qaeMemAlloc(sizeof(CpaFlatBuffer) * setup->numBuffers);
+    pData->pEcdsaBatch = qaeMemAlloc(
+        sizeof(icp_sal_ecdsa_sign_rs_batch_op_data_t) * setup->numBuffers);
+    if ((NULL == pData->pR) || (NULL == pData->pS) ||
+        (NULL == pData->pEcdsaBatch))
+    {
+        PRINT_ERR("Failed to allocate output buffer array\n");
+        asymBatchMemFree(setup, pData);
+        return CPA_STATUS_FAIL;
+    }
+    memset(pData->pR, 0, sizeof(CpaFlatBuffer) * setup->numBuffers);
+    memset(pData->pS, 0, sizeof(CpaFlatBuffer) * setup->numBuffers);
+    for (i = 0; i < setup->numBuffers; i++)
+    {
+        ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                             &pData->pR[i],
+                             setup->sizeInBytes,
+                             NULL,
+                             0,
+                             asymBatchMemFree(setup, pData));
+        ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                             &pData->pS[i],
+                             setup->sizeInBytes,
+                             NULL,
+                             0,
+                             asymBatchMemFree(setup, pData));
+    }
+
+    pData->signRSOpData.xg = pData->xg;
+    pData->signRSOpData.yg = pData->yg;
+    pData->signRSOpData.n = pData->n;
+    pData->signRSOpData.q = pData->q;
+    pData->signRSOpData.a = pData->a;
+    pData->signRSOpData.b = pData->b;
+    pData->signRSOpData.k = pData->k;
+    pData->signRSOpData.m = pData->m;
+    pData->signRSOpData.d = pData->d;
+    pData->signRSOpData.fieldType = CPA_CY_EC_FIELD_TYPE_PRIME;
+
+    for (i = 0; i < setup->numBuffers; i++)
+    {
+        pData->pEcdsaBatch[i].pOpData = &pData->signRSOpData;
+        pData->pEcdsaBatch[i].pR = &pData->pR[i];
+        pData->pEcdsaBatch[i].pS = &pData->pS[i];
+        pData->pEcdsaBatch[i].pCallbackTag = setup->performanceStats;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+static CpaStatus asymBatchSubmit(asym_batch_test_params_t *setup,
+                                 asym_batch_data_t *pData,
+                                 Cpa32U first,
+                                 Cpa32U numRequests,
+                                 Cpa32U *pNumSubmitted)
+{
+    if (ASYM_BATCH_RSA_DECRYPT == setup->op)
+    {
+        return icp_sal_CyRsaDecryptBatch(setup->cyInstanceHandle,
+                                         asymBatchRsaCallback,
+                                         numRequests,
+                                         &pData->pRsaBatch[first],
+                                         pNumSubmitted);
+    }
+    return icp_sal_CyEcdsaSignRSBatch(setup->cyInstanceHandle,
+                                      asymBatchEcdsaCallback,
+                                      numRequests,
+                                      &pData->pEcdsaBatch[first],
+                                      pNumSubmitted);
+}
+
+CpaStatus asymBatchPerform(asym_batch_test_params_t *setup)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    asym_batch_data_t data;
+    perf_data_t *pPerfData = setup->performanceStats;
+    Cpa32U numLoops = 0;
+    Cpa32U numRequests = 0;
+    Cpa32U numSubmitted = 0;
+    Cpa32U i = 0;
+
+    memset(&data, 0, sizeof(asym_batch_data_t));
+    memset(pPerfData, 0, sizeof(perf_data_t));
+
+    if (ASYM_BATCH_RSA_DECRYPT == setup->op)
+    {
+        status = asymBatchRsaSetup(setup, &data);
+    }
+    else
+    {
+        status = asymBatchEcdsaSetup(setup, &data);
+    }
+
+    /*this barrier will wait until all threads get to this point*/
+    sampleCodeBarrier();
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+
+    /*the RSA key generation completes on the same performance data and
+     * destroys its semaphore, so the counters are only set up after it*/
+    pPerfData->numOperations = (Cpa64U)setup->numBuffers * setup->numLoops;
+    pPerfData->responses = 0;
+    pPerfData->retries = 0;
+    sampleCodeSemaphoreInit(&pPerfData->comp, 0);
+
+    /*the callback measures the end time when the last response arrives*/
+    pPerfData->startCyclesTimestamp = sampleCodeTimestamp();
+    for (numLoops = 0; numLoops < setup->numLoops; numLoops++)
+    {
+        i = 0;
+        while (i < setup->numBuffers)
+        {
+            numRequests = setup->numBuffers - i;
+            if (numRequests > setup->batchSize)
+            {
+                numRequests = setup->batchSize;
+            }
+            numSubmitted = 0;
+            status = asymBatchSubmit(setup, &data, i, numRequests, &numSubmitted);
+            /*on retry the rest of the batch is submitted again*/
+            i += numSubmitted;
+            if (CPA_STATUS_RETRY == status)
+            {
+                pPerfData->retries++;
+                /*if the acceleration engine is busy pause for a
+                 * moment by making a context switch*/
+                if (RETRY_LIMIT == (pPerfData->retries % (RETRY_LIMIT + 1)))
+                {
+                    AVOID_SOFTLOCKUP;
+                }
+                status = CPA_STATUS_SUCCESS;
+            }
+            else if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("Batch request failed with status:%d\n", status);
+                break;
+            }
+        }
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            break;
+        }
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = waitForResponses(
+            pPerfData, ASYNC, setup->numBuffers, setup->numLoops);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("Thread %u timeout. ", setup->threadID);
+        }
+    }
+
+    sampleCodeSemaphoreDestroy(&pPerfData->comp);
+    asymBatchMemFree(setup, &data);
+    if (CPA_STATUS_SUCCESS != pPerfData->threadReturnStatus)
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    return status;
+}
+
+/***************************************************************************
+ * @ingroup sampleAsymBatchPerf
+ *
+ * @description
+ *      Print the performance stats of the batch test
+***************************************************************************/
+void asymBatchPrintStats(thread_creation_data_t *data)
+{
+    asym_batch_test_params_t *params =
+        (asym_batch_test_params_t *)data->setupPtr;
+
+    if (ASYM_BATCH_RSA_DECRYPT == params->op)
+    {
+        PRINT("RSA CRT DECRYPT BATCH\n");
+        PRINT("Modulus Size %17u\n", data->packetSize);
+    }
+    else
+    {
+        PRINT("ECDSA SIGNRS BATCH\n");
+        PRINT("EC Size %22u\n", data->packetSize);
+    }
+    PRINT("Batch Size %19u\n", params->batchSize);
+    printAsymStatsAndStopServices(data);
+}
+
+/***************************************************************************
+ * @ingroup sampleAsymBatchPerf
+ *
+ * @description
+ *      Batch performance thread, called by the framework
+***************************************************************************/
+void asymBatchPerformance(single_thread_test_data_t *testSetup)
+{
+    asym_batch_test_params_t batchSetup;
+    Cpa16U numInstances = 0;
+    CpaInstanceHandle *cyInstances = NULL;
+    CpaStatus status = CPA_STATUS_FAIL;
+    asym_batch_test_params_t *params =
+        (asym_batch_test_params_t *)testSetup->setupPtr;
+
+    startBarrier();
+    /*register the print function here so that an early exit still prints
+     * the statistics*/
+    testSetup->statsPrintFunc = (stats_print_func_t)asymBatchPrintStats;
+    batchSetup.performanceStats = testSetup->performanceStats;
+
+    status = cpaCyGetNumInstances(&numInstances);
+    if (CPA_STATUS_SUCCESS != status || numInstances == 0)
+    {
+        PRINT_ERR("cpaCyGetNumInstances error, status:%d, numInstances:%d\n",
+                  status,
+                  numInstances);
+        batchSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    cyInstances = qaeMemAlloc(sizeof(CpaInstanceHandle) * numInstances);
+    if (NULL == cyInstances)
+    {
+        PRINT_ERR("Error allocating memory for instance handles\n");
+        batchSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    if (cpaCyGetInstances(numInstances, cyInstances) != CPA_STATUS_SUCCESS)
+    {
+        PRINT_ERR("Failed to get instances\n");
+        batchSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        qaeMemFree((void **)&cyInstances);
+        sampleCodeThreadExit();
+    }
+    /* give our thread a logical crypto instance to use
+     * use % to wrap around the max number of instances*/
+    batchSetup.cyInstanceHandle =
+        cyInstances[(testSetup->logicalQaInstance) % numInstances];
+
+    batchSetup.threadID = testSetup->threadID;
+    batchSetup.op = params->op;
+    batchSetup.sizeInBytes = params->sizeInBytes;
+    batchSetup.batchSize = params->batchSize;
+    batchSetup.numBuffers = params->numBuffers;
+    batchSetup.numLoops = params->numLoops;
+
+    status = asymBatchPerform(&batchSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT("Asym Batch Thread %u FAILED\n", testSetup->threadID);
+        batchSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    qaeMemFree((void **)&cyInstances);
+    sampleCodeThreadComplete(testSetup->threadID);
+}
+
+/***************************************************************************
+ * @ingroup sampleAsymBatchPerf
+ *
+ * @description
+ *      This function is used to set the parameters to be used in the batch
+ *      performance thread. It is called before the createThreads function
+ *      of the framework. The framework replicates it across many cores
+***************************************************************************/
+CpaStatus setupAsymBatchTest(asym_batch_op_t op,
+                             Cpa32U sizeInBits,
+                             Cpa32U batchSize,
+                             Cpa32U numBuffers,
+                             Cpa32U numLoops)
+{
+    asym_batch_test_params_t *batchSetup = NULL;
+    Cpa8S rsaName[] = {'R', 'S', 'A', '\0'};
+    Cpa8S ecName[] = {'E', 'C', 'C', '\0'};
+
+    if (testTypeCount_g >= MAX_THREAD_VARIATION)
+    {
+        PRINT_ERR("Maximum Support Thread Variation has been exceeded\n");
+        PRINT_ERR("Number of Thread Variations created: %d", testTypeCount_g);
+        PRINT_ERR(" Max is %d\n", MAX_THREAD_VARIATION);
+        return CPA_STATUS_FAIL;
+    }
+    if ((0 == batchSize) || (batchSize > ASYM_BATCH_MAX_SIZE))
+    {
+        PRINT_ERR("Batch size %u is not between 1 and %u\n",
+                  batchSize,
+                  ASYM_BATCH_MAX_SIZE);
+        return CPA_STATUS_FAIL;
+    }
+    /*start crypto service if not already started*/
+    if (CPA_STATUS_SUCCESS != startCyServices())
+    {
+        PRINT_ERR("Error starting Crypto Services\n");
+        return CPA_STATUS_FAIL;
+    }
+    if (!poll_inline_g)
+    {
+        /* start polling threads if polling is enabled in the configuration file
+         */
+        if (CPA_STATUS_SUCCESS != cyCreatePollingThreadsIfPollingIsEnabled())
+        {
+            PRINT_ERR("Error creating polling threads\n");
+            return CPA_STATUS_FAIL;
+        }
+    }
+    if (ASYM_BATCH_RSA_DECRYPT == op)
+    {
+        memcpy(&thread_name_g[testTypeCount_g][0], rsaName, THREAD_NAME_LEN);
+    }
+    else
+    {
+        memcpy(&thread_name_g[testTypeCount_g][0], ecName, THREAD_NAME_LEN);
+    }
+
+    batchSetup =
+        (asym_batch_test_params_t *)&thread_setup_g[testTypeCount_g][0];
+    testSetupData_g[testTypeCount_g].performance_function =
+        (performance_func_t)asymBatchPerformance;
+    testSetupData_g[testTypeCount_g].packetSize = sizeInBits;
+
+    batchSetup->op = op;
+    batchSetup->sizeInBytes =
+        (sizeInBits + NUM_BITS_IN_BYTE - 1) / NUM_BITS_IN_BYTE;
+    batchSetup->batchSize = batchSize;
+    /*every call of the batch API submits a full batch*/
+    batchSetup->numBuffers =
+        ((numBuffers + batchSize - 1) / batchSize) * batchSize;
+    batchSetup->numLoops = numLoops;
+    return CPA_STATUS_SUCCESS;
+}
+EXPORT_SYMBOL(setupAsymBatchTest);
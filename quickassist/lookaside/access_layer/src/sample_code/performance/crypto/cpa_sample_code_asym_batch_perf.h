@@ -0,0 +1,178 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file cpa_sample_code_asym_batch_perf.h
+ *
+ * @defgroup sampleAsymBatchPerf
+ *
+ * @ingroup sampleCode
+ *
+ * @description
+ *     Batched RSA decrypt and ECDSA sign Sample Code functions.
+ *
+ ***************************************************************************/
+#ifndef CPA_SAMPLE_CODE_ASYM_BATCH_PERF_H
+#define CPA_SAMPLE_CODE_ASYM_BATCH_PERF_H
+#include "cpa.h"
+#include "cpa_cy_rsa.h"
+#include "cpa_cy_ecdsa.h"
+#include "icp_sal_asym_batch.h"
+#include "cpa_sample_code_crypto_utils.h"
+
+/*largest batch size the sample runs, a ring holds one request less than
+ * CyNumConcurrentAsymRequests so the default ring of 64 cannot take it in
+ * one put*/
+#define ASYM_BATCH_MAX_SIZE (64)
+
+/**
+ *****************************************************************************
+ * @ingroup sampleAsymBatchPerf
+ *      Operation of a batch test
+ ****************************************************************************/
+typedef enum asym_batch_op_e
+{
+    ASYM_BATCH_RSA_DECRYPT = 0,
+    /*RSA CRT decrypt*/
+    ASYM_BATCH_ECDSA_SIGNRS
+    /*ECDSA sign on a NIST prime curve*/
+} asym_batch_op_t;
+
+/**
+ *****************************************************************************
+ * @ingroup sampleAsymBatchPerf
+ *      Batch test data
+ * @description
+ *      This structure contains data relating to setting up a test submitting
+ *      RSA decrypt or ECDSA sign requests in batches.
+ *
+ ****************************************************************************/
+typedef struct asym_batch_test_params_s
+{
+    /*pointer to pre-allocated memory for thread to store performance data*/
+    perf_data_t *performanceStats;
+    /*crypto instance handle of service that has already been started*/
+    CpaInstanceHandle cyInstanceHandle;
+    /*operation to measure*/
+    asym_batch_op_t op;
+    /*size of the RSA modulus or of the curve*/
+    Cpa32U sizeInBytes;
+    /*number of requests per call of the batch API*/
+    Cpa32U batchSize;
+    /*number of requests per loop, a multiple of batchSize*/
+    Cpa32U numBuffers;
+    /*number of loops*/
+    Cpa32U numLoops;
+    Cpa32U threadID;
+} asym_batch_test_params_t;
+
+/*************************************************************************
+ * @ingroup sampleAsymBatchPerf
+ *
+ * @description
+ *    Sets up a thread that measures the ops/sec of RSA CRT decrypt or ECDSA
+ *    sign when the requests are submitted batchSize at a time with
+ *    icp_sal_CyRsaDecryptBatch or icp_sal_CyEcdsaSignRSBatch. One decrypt or
+ *    one sign is the private key operation of a server TLS handshake, so
+ *    the ops/sec is also the handshakes/sec the instance can serve. All the
+ *    requests use the same key. On the software device backend RSA is
+ *    computed but ECDSA is not, so the ECDSA test measures the cost of
+ *    submitting the requests.
+ *
+ *    The test submits without waiting for responses, so once the ring is
+ *    full every batch is partly sent and its tail retried, which counts in
+ *    Total Retries. A ring holds CyNumConcurrentAsymRequests - 1 requests,
+ *    so with the default of 64 a batch of 64 retries even on an empty
+ *    ring. Set CyNumConcurrentAsymRequests to at least twice the batch
+ *    size to measure the batch API rather than the wait for ring space.
+ *
+ * @param[in] op                Operation to measure
+ * @param[in] sizeInBits        RSA modulus size, or curve size 256 or 384
+ * @param[in] batchSize         Number of requests per batch
+ * @param[in] numBuffers        Number of requests per loop, rounded up to a
+ *                              multiple of batchSize
+ * @param[in] numLoops          Number of loops
+ * @context
+ *      This functions is called from the user process context
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_FAIL          Function failed.
+ *
+ *************************************************************************/
+CpaStatus setupAsymBatchTest(asym_batch_op_t op,
+                             Cpa32U sizeInBits,
+                             Cpa32U batchSize,
+                             Cpa32U numBuffers,
+                             Cpa32U numLoops);
+
+#endif
@@ -76,6 +76,7 @@
 #include "cpa_cy_common.h"
 #include "cpa_cy_prime.h"
 #include "icp_sal_poll.h"
+#include "icp_sal.h"
 
 #define POLL_AND_SLEEP 1
 
@@ -776,6 +777,104 @@ CpaStatus printAsymStatsAndStopServices(thread_creation_data_t *data)
     return CPA_STATUS_SUCCESS;
 }
 
+/* Upper bound in cycles of the histogram bucket holding the given percentile
+ * of the samples of one profile stage */
+static Cpa64U pkeProfilePercentile(icp_sal_pke_profile_stage_stats_t *pStage,
+                                   Cpa32U percent)
+{
+    Cpa64U count = 0;
+    Cpa64U target = (pStage->numSamples * percent + 99) / 100;
+    Cpa32U i = 0;
+
+    for (i = 0; i < ICP_SAL_PKE_PROFILE_NUM_BUCKETS - 1; i++)
+    {
+        count += pStage->histogram[i];
+        if (count >= target)
+        {
+            break;
+        }
+    }
+    return 2ULL << i;
+}
+
+void resetPkeProfile(void)
+{
+    Cpa32U i = 0;
+
+    if (!pkeProfile)
+    {
+        return;
+    }
+    for (i = 0; i < numInstances_g; i++)
+    {
+        icp_sal_CyResetPkeProfile(cyInstances_g[i]);
+    }
+}
+
+void printPkeProfile(void)
+{
+    static const char *stageNames[ICP_SAL_PKE_PROFILE_NUM_STAGES] = {
+        "Param check",
+        "Curve check",
+        "Resize params",
+        "Create request",
+        "Ring put",
+        "Callback",
+        "Submit total"};
+    icp_sal_pke_profile_t profile = {{{0}}};
+    icp_sal_pke_profile_t total = {{{0}}};
+    icp_sal_pke_profile_stage_stats_t *pStage = NULL;
+    CpaBoolean profileEnabled = CPA_FALSE;
+    Cpa32U i = 0, j = 0, k = 0;
+
+    if (!pkeProfile)
+    {
+        return;
+    }
+    /* The counters are read before the services are stopped and summed
+     * over all instances */
+    for (i = 0; i < numInstances_g; i++)
+    {
+        if (CPA_STATUS_SUCCESS !=
+            icp_sal_CyGetPkeProfile(cyInstances_g[i], &profile))
+        {
+            continue;
+        }
+        profileEnabled = CPA_TRUE;
+        for (j = 0; j < ICP_SAL_PKE_PROFILE_NUM_STAGES; j++)
+        {
+            total.stages[j].numSamples += profile.stages[j].numSamples;
+            total.stages[j].numCycles += profile.stages[j].numCycles;
+            for (k = 0; k < ICP_SAL_PKE_PROFILE_NUM_BUCKETS; k++)
+            {
+                total.stages[j].histogram[k] +=
+                    profile.stages[j].histogram[k];
+            }
+        }
+    }
+    if (CPA_TRUE != profileEnabled)
+    {
+        PRINT("PKE profile not available, build the driver with "
+              "ICP_PKE_PROFILE=1\n");
+        return;
+    }
+    PRINT("PKE Host Profile  Samples   Avg Cycles   P50 <   P99 <\n");
+    for (j = 0; j < ICP_SAL_PKE_PROFILE_NUM_STAGES; j++)
+    {
+        pStage = &total.stages[j];
+        if (0 == pStage->numSamples)
+        {
+            continue;
+        }
+        PRINT("%-16s %8llu %12llu %7llu %7llu\n",
+              stageNames[j],
+              (unsigned long long)pStage->numSamples,
+              (unsigned long long)(pStage->numCycles / pStage->numSamples),
+              (unsigned long long)pkeProfilePercentile(pStage, 50),
+              (unsigned long long)pkeProfilePercentile(pStage, 99));
+    }
+}
+
 /*****************************************************************************
  * * @description
  * Poll the number of crypto operations
@@ -828,9 +927,53 @@ CpaStatus setCyPollWaitFn(Cpa32U poll_type, Cpa32U sleep_time)
     return CPA_STATUS_SUCCESS;
 }
 
+#ifdef USER_SPACE
+/* Drives a hybrid instance through the adaptive wait API, returns
+ * CPA_STATUS_UNSUPPORTED if the instance is not configured as hybrid */
+static CpaStatus sampleCodeHybridWait(CpaInstanceHandle instanceHandle_in)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    icp_sal_wait_stats_t waitStats = {0};
+
+    while (cy_service_started_g == CPA_TRUE)
+    {
+        status = icp_sal_CyWaitInstance(
+            instanceHandle_in, 0, DEFAULT_HYBRID_WAIT_MSEC);
+        if (CPA_STATUS_UNSUPPORTED == status)
+        {
+            return status;
+        }
+        if (CPA_STATUS_SUCCESS != status && CPA_STATUS_RETRY != status)
+        {
+            PRINT_ERR("WARNING icp_sal_CyWaitInstance returned status %d\n",
+                      status);
+        }
+    }
+    if (CPA_STATUS_SUCCESS ==
+        icp_sal_CyGetWaitStats(instanceHandle_in, &waitStats))
+    {
+        PRINT("Hybrid wait: polls %llu spins %llu yields %llu sleeps %llu "
+              "wakeups %llu\n",
+              (unsigned long long)waitStats.numPolls,
+              (unsigned long long)waitStats.numSpins,
+              (unsigned long long)waitStats.numYields,
+              (unsigned long long)waitStats.numSleeps,
+              (unsigned long long)waitStats.numWakeups);
+    }
+    return CPA_STATUS_SUCCESS;
+}
+#endif
+
 void sampleCodePoll(CpaInstanceHandle instanceHandle_in)
 {
     CpaStatus status = CPA_STATUS_FAIL;
+#ifdef USER_SPACE
+    if (CPA_STATUS_UNSUPPORTED != sampleCodeHybridWait(instanceHandle_in))
+    {
+        sampleCodeThreadExit();
+        return;
+    }
+#endif
     while (cy_service_started_g == CPA_TRUE)
     {
         /*poll for 0 means process all packets on the ET ring */
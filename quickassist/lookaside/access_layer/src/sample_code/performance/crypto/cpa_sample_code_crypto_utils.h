@@ -277,6 +277,8 @@ typedef enum dsa_step_s { DSA_STEP_SIGNRS = 0, DSA_STEP_VERIFY } dsa_step_t;
 #define DEFAULT_SLEEP_INTERVAL_NSEC (200)
 #define DEFAULT_POLL_INTERVAL_MSEC (2)
 #define DEFAULT_POLL_INTERVAL_KERNEL (0)
+/* Longest a hybrid poll thread blocks before rechecking the stop flag */
+#define DEFAULT_HYBRID_WAIT_MSEC (100)
 
 /*
 ******************************************************************************
@@ -872,6 +874,30 @@ Cpa32U getOpsPerSecond(Cpa64U responses, perf_cycles_t cycles);
  *****************************************************************************/
 CpaStatus printAsymStatsAndStopServices(thread_creation_data_t *data);
 
+/**
+ *****************************************************************************
+ * @ingroup cryptoThreads
+ *      resetPkeProfile
+ *
+ * @description
+ *      This function clears the PKE host cycle profile of all crypto
+ *      instances when the pkeProfile option is set. Each thread calls it
+ *      before its start barrier so the setup operations are not counted.
+ *****************************************************************************/
+void resetPkeProfile(void);
+
+/**
+ *****************************************************************************
+ * @ingroup cryptoThreads
+ *      printPkeProfile
+ *
+ * @description
+ *      This function prints the PKE host cycle profile summed over all
+ *      crypto instances when the pkeProfile option is set. It must be called
+ *      before the services are stopped.
+ *****************************************************************************/
+void printPkeProfile(void);
+
 /**
  *****************************************************************************
  * @ingroup cryptoThreads
@@ -888,6 +914,17 @@ CpaStatus setupEcdsaTest(Cpa32U nLenInBits,
                          Cpa32U numBuffers,
                          Cpa32U numLoops);
 
+/**
+ *****************************************************************************
+ * @ingroup cryptoThreads
+ *      getCurveData
+ *
+ * @description
+ *      set setup->pCurve to the sample curve matching setup->nLenInBytes
+ *      and setup->fieldType
+ *****************************************************************************/
+CpaStatus getCurveData(ecdsa_test_params_t *setup);
+
 /**
  *****************************************************************************
  * @ingroup cryptoThreads
@@ -75,6 +75,8 @@
 #include "cpa_sample_code_drbg_perf.h"
 #include "icp_sal_drbg_impl.h"
 
+extern int signOfLife;
+
 /* internal data structure to be filled in personalizationString for
  * DRBG session setup
  */
@@ -207,7 +209,60 @@ static void nrbgCallback(void *pCallbackTag,
 ***************************************************************************/
 void drbgPrintStats(thread_creation_data_t *data)
 {
+    perf_data_t *pStats = NULL;
+    perf_cycles_t numOfCycles = 0;
+    perf_cycles_t minLatency = 0;
+    perf_cycles_t aveLatency = 0;
+    perf_cycles_t maxLatency = 0;
+    Cpa64U bytesGenerated = 0;
+    Cpa64U bytesPerSecond = 0;
+    Cpa64U cpuFreqKHz = sampleCodeGetCpuFreq();
+    Cpa32U numThreads = 0;
+    Cpa32U i = 0;
+
     PRINT("DRBG Size %23u\n", data->packetSize);
+    /* Bytes per second over the longest running thread and the latency of a
+     * single cpaCyDrbgGen call, gathered before the services are stopped */
+    for (i = 0; i < data->numberOfThreads; i++)
+    {
+        pStats = data->performanceStats[i];
+        if (CPA_STATUS_SUCCESS != pStats->threadReturnStatus ||
+            0 == pStats->latencyCount)
+        {
+            continue;
+        }
+        bytesGenerated += pStats->responses * data->packetSize;
+        if (pStats->endCyclesTimestamp - pStats->startCyclesTimestamp >
+            numOfCycles)
+        {
+            numOfCycles =
+                pStats->endCyclesTimestamp - pStats->startCyclesTimestamp;
+        }
+        if (0 == numThreads || pStats->minLatency < minLatency)
+        {
+            minLatency = pStats->minLatency;
+        }
+        if (pStats->maxLatency > maxLatency)
+        {
+            maxLatency = pStats->maxLatency;
+        }
+        aveLatency += pStats->aveLatency;
+        numThreads++;
+    }
+    if (!signOfLife && 0 != numThreads && 0 != numOfCycles && 0 != cpuFreqKHz)
+    {
+        bytesPerSecond = bytesGenerated * cpuFreqKHz * 1000;
+        do_div(bytesPerSecond, numOfCycles);
+        do_div(aveLatency, numThreads);
+        PRINT("DRBG Bytes per second %11llu\n",
+              (unsigned long long)bytesPerSecond);
+        PRINT("DRBG Min. Latency (ns) %10llu\n",
+              (unsigned long long)(minLatency * 1000000 / cpuFreqKHz));
+        PRINT("DRBG Ave. Latency (ns) %10llu\n",
+              (unsigned long long)(aveLatency * 1000000 / cpuFreqKHz));
+        PRINT("DRBG Max. Latency (ns) %10llu\n",
+              (unsigned long long)(maxLatency * 1000000 / cpuFreqKHz));
+    }
     printSymmetricPerfDataAndStopCyService(data);
 }
 
@@ -423,6 +478,7 @@ static CpaStatus drbgPerformOp(drbg_test_params_t *setup,
     CpaFlatBuffer *pDrbgOut;
     Cpa32U numLoops, numSessions;
     Cpa32U anyFail = 0, ses;
+    perf_cycles_t submitCycles = 0, opCycles = 0;
 
     pDrbgPerf = setup->performanceStats;
     numSessions = setup->numSessions;
@@ -495,6 +551,10 @@ static CpaStatus drbgPerformOp(drbg_test_params_t *setup,
             pDrbgPerf->numOperations = numSessions;
             for (ses = 0; ses < numSessions; ses++)
             {
+                /* The DRBG generates in the calling thread and invokes the
+                 * callback before cpaCyDrbgGen returns, so the time spent in
+                 * the call is the latency of the request */
+                submitCycles = sampleCodeTimestamp();
                 do
                 {
                     status = cpaCyDrbgGen(
@@ -521,9 +581,18 @@ static CpaStatus drbgPerformOp(drbg_test_params_t *setup,
                     PRINT_ERR("cpaCyDrbgGen failed. (status = %d)\n", status);
                     break;
                 }
-                else
+                opCycles = sampleCodeTimestamp() - submitCycles;
+                if (0 == pDrbgPerf->latencyCount ||
+                    opCycles < pDrbgPerf->minLatency)
                 {
+                    pDrbgPerf->minLatency = opCycles;
                 }
+                if (opCycles > pDrbgPerf->maxLatency)
+                {
+                    pDrbgPerf->maxLatency = opCycles;
+                }
+                pDrbgPerf->aveLatency += opCycles;
+                pDrbgPerf->latencyCount++;
             }
             if (CPA_STATUS_SUCCESS == status)
             {
@@ -538,6 +607,10 @@ static CpaStatus drbgPerformOp(drbg_test_params_t *setup,
 
         } // end of for numLoop
         sampleCodeSemaphoreDestroy(&pDrbgPerf->comp);
+        if (0 != pDrbgPerf->latencyCount)
+        {
+            do_div(pDrbgPerf->aveLatency, pDrbgPerf->latencyCount);
+        }
     }
 
     /*
@@ -0,0 +1,673 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_ec_curve_perf.c
+ *
+ * @ingroup sampleEcCurvePerf
+ *
+ * @description
+ *     Compares the ops/sec of ECDSA and point multiply requests carrying the
+ *     NIST curve parameters with the same requests on a named curve handle,
+ *     which only carry the scalars and the point.
+ *
+ *****************************************************************************/
+#include "cpa_sample_code_ec_curve_perf.h"
+
+/* Buffers of a named curve test thread */
+typedef struct ec_curve_data_s
+{
+    /*curve parameters, for the standard API*/
+    CpaFlatBuffer q;
+    CpaFlatBuffer a;
+    CpaFlatBuffer b;
+    CpaFlatBuffer n;
+    CpaFlatBuffer xg;
+    CpaFlatBuffer yg;
+    CpaFlatBuffer h;
+    /*scalars, below n for every curve*/
+    CpaFlatBuffer k;
+    CpaFlatBuffer d;
+    CpaFlatBuffer m;
+    CpaFlatBuffer r;
+    CpaFlatBuffer s;
+    /*output buffers of every request of a loop*/
+    CpaFlatBuffer *pOut1;
+    CpaFlatBuffer *pOut2;
+    /*operation data, shared by all requests as it is only read*/
+    CpaCyEcdsaSignRSOpData signRSOpData;
+    CpaCyEcdsaVerifyOpData verifyOpData;
+    CpaCyEcPointMultiplyOpData multiplyOpData;
+    icp_sal_ecdsa_sign_rs_curve_op_data_t signRSCurveOpData;
+    icp_sal_ecdsa_verify_curve_op_data_t verifyCurveOpData;
+    icp_sal_ec_point_multiply_curve_op_data_t multiplyCurveOpData;
+    /*only written in synchronous mode*/
+    CpaBoolean opStatus;
+} ec_curve_data_t;
+
+static void ecCurveCallback(void *pCallbackTag,
+                            CpaStatus status,
+                            void *pOpData,
+                            CpaBoolean multiplyStatus,
+                            CpaFlatBuffer *pOut1,
+                            CpaFlatBuffer *pOut2)
+{
+    perf_data_t *pPerfData = (perf_data_t *)pCallbackTag;
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("EC callback failed: status = %d\n", status);
+        pPerfData->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    processCallback(pCallbackTag);
+}
+
+static void ecCurveVerifyCallback(void *pCallbackTag,
+                                  CpaStatus status,
+                                  void *pOpData,
+                                  CpaBoolean verifyStatus)
+{
+    perf_data_t *pPerfData = (perf_data_t *)pCallbackTag;
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("ECDSA Verify callback failed: status = %d\n", status);
+        pPerfData->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    processCallback(pCallbackTag);
+}
+
+static CpaStatus ecCurveNameGet(Cpa32U nLenInBytes, icp_sal_ec_curve_t *pCurve)
+{
+    switch (nLenInBytes)
+    {
+        case GFP_P256_SIZE_IN_BYTES:
+            *pCurve = ICP_SAL_EC_CURVE_P256;
+            break;
+        case GFP_P384_SIZE_IN_BYTES:
+            *pCurve = ICP_SAL_EC_CURVE_P384;
+            break;
+        case GFP_P521_SIZE_IN_BYTES:
+            *pCurve = ICP_SAL_EC_CURVE_P521;
+            break;
+        default:
+            PRINT_ERR("No named curve of %u bytes\n", nLenInBytes);
+            return CPA_STATUS_FAIL;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+static void ecCurveMemFree(ec_curve_test_params_t *setup,
+                           ec_curve_data_t *pData)
+{
+    Cpa32U i = 0;
+
+    FREE_NUMA_MEM(pData->q.pData);
+    FREE_NUMA_MEM(pData->a.pData);
+    FREE_NUMA_MEM(pData->b.pData);
+    FREE_NUMA_MEM(pData->n.pData);
+    FREE_NUMA_MEM(pData->xg.pData);
+    FREE_NUMA_MEM(pData->yg.pData);
+    FREE_NUMA_MEM(pData->h.pData);
+    FREE_NUMA_MEM(pData->k.pData);
+    FREE_NUMA_MEM(pData->d.pData);
+    FREE_NUMA_MEM(pData->m.pData);
+    FREE_NUMA_MEM(pData->r.pData);
+    FREE_NUMA_MEM(pData->s.pData);
+    for (i = 0; i < setup->numBuffers; i++)
+    {
+        if (NULL != pData->pOut1)
+        {
+            FREE_NUMA_MEM(pData->pOut1[i].pData);
+        }
+        if (NULL != pData->pOut2)
+        {
+            FREE_NUMA_MEM(pData->pOut2[i].pData);
+        }
+    }
+    if (NULL != pData->pOut1)
+    {
+        qaeMemFree((void **)&pData->pOut1);
+    }
+    if (NULL != pData->pOut2)
+    {
+        qaeMemFree((void **)&pData->pOut2);
+    }
+}
+
+/* A number with a zero top byte is below n for all the NIST prime curves */
+static CpaStatus ecCurveScalarAlloc(ec_curve_test_params_t *setup,
+                                    CpaFlatBuffer *pBuf,
+                                    Cpa8U fill)
+{
+    CpaStatus status = bufferDataMemAlloc(
+        setup->cyInstanceHandle, pBuf, setup->nLenInBytes, NULL, 0);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        memset(pBuf->pData, fill, pBuf->dataLenInBytes);
+        pBuf->pData[0] = 0;
+    }
+    return status;
+}
+
+static CpaStatus ecCurveDataSetup(ec_curve_test_params_t *setup,
+                                  ec_curve_data_t *pData)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    ecdsa_test_params_t curveSetup = {0};
+    ec_curves_t *pCurve = NULL;
+    icp_sal_ec_curve_t curve = ICP_SAL_EC_CURVE_P256;
+    icp_sal_ec_curve_handle_t hCurve = NULL;
+    Cpa8U cofactor = 1;
+    Cpa32U i = 0;
+
+    status = ecCurveNameGet(setup->nLenInBytes, &curve);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+    curveSetup.nLenInBytes = setup->nLenInBytes;
+    curveSetup.fieldType = CPA_CY_EC_FIELD_TYPE_PRIME;
+    status = getCurveData(&curveSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+    pCurve = curveSetup.pCurve;
+
+    if (CPA_TRUE == setup->namedCurve)
+    {
+        status =
+            icp_sal_CyEcCurveHandleGet(setup->cyInstanceHandle, curve, &hCurve);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("icp_sal_CyEcCurveHandleGet error, status: %d\n",
+                      status);
+            return status;
+        }
+    }
+
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->q,
+                         pCurve->sizeOfp,
+                         pCurve->p,
+                         pCurve->sizeOfp,
+                         ecCurveMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->a,
+                         pCurve->sizeOfa,
+                         pCurve->a,
+                         pCurve->sizeOfa,
+                         ecCurveMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->b,
+                         pCurve->sizeOfb,
+                         pCurve->b,
+                         pCurve->sizeOfb,
+                         ecCurveMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->n,
+                         pCurve->sizeOfr,
+                         pCurve->r,
+                         pCurve->sizeOfr,
+                         ecCurveMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->xg,
+                         pCurve->sizeOfxg,
+                         pCurve->xg,
+                         pCurve->sizeOfxg,
+                         ecCurveMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->yg,
+                         pCurve->sizeOfyg,
+                         pCurve->yg,
+                         pCurve->sizeOfyg,
+                         ecCurveMemFree(setup, pData));
+    ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                         &pData->h,
+                         sizeof(cofactor),
+                         &cofactor,
+                         sizeof(cofactor),
+                         ecCurveMemFree(setup, pData));
+
+    if ((CPA_STATUS_SUCCESS != ecCurveScalarAlloc(setup, &pData->k, 0x5a)) ||
+        (CPA_STATUS_SUCCESS != ecCurveScalarAlloc(setup, &pData->d, 0x3c)) ||
+        (CPA_STATUS_SUCCESS != ecCurveScalarAlloc(setup, &pData->m, 0xa5)) ||
+        (CPA_STATUS_SUCCESS != ecCurveScalarAlloc(setup, &pData->r, 0x69)) ||
+        (CPA_STATUS_SUCCESS != ecCurveScalarAlloc(setup, &pData->s, 0x96)))
+    {
+        PRINT_ERR("Failed to allocate scalar memory\n");
+        ecCurveMemFree(setup, pData);
+        return CPA_STATUS_FAIL;
+    }
+
+    pData->pOut1 = qaeMemAlloc(sizeof(CpaFlatBuffer) * setup->numBuffers);
+    pData->pOut2 = qaeMemAlloc(sizeof(CpaFlatBuffer) * setup->numBuffers);
+    if ((NULL == pData->pOut1) || (NULL == pData->pOut2))
+    {
+        PRINT_ERR("Failed to allocate output buffer array\n");
+        ecCurveMemFree(setup, pData);
+        return CPA_STATUS_FAIL;
+    }
+    memset(pData->pOut1, 0, sizeof(CpaFlatBuffer) * setup->numBuffers);
+    memset(pData->pOut2, 0, sizeof(CpaFlatBuffer) * setup->numBuffers);
+    for (i = 0; i < setup->numBuffers; i++)
+    {
+        ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                             &pData->pOut1[i],
+                             setup->nLenInBytes,
+                             NULL,
+                             0,
+                             ecCurveMemFree(setup, pData));
+        ALLOC_FLAT_BUFF_DATA(setup->cyInstanceHandle,
+                             &pData->pOut2[i],
+                             setup->nLenInBytes,
+                             NULL,
+                             0,
+                             ecCurveMemFree(setup, pData));
+    }
+
+    pData->signRSOpData.xg = pData->xg;
+    pData->signRSOpData.yg = pData->yg;
+    pData->signRSOpData.n = pData->n;
+    pData->signRSOpData.q = pData->q;
+    pData->signRSOpData.a = pData->a;
+    pData->signRSOpData.b = pData->b;
+    pData->signRSOpData.k = pData->k;
+    pData->signRSOpData.m = pData->m;
+    pData->signRSOpData.d = pData->d;
+    pData->signRSOpData.fieldType = CPA_CY_EC_FIELD_TYPE_PRIME;
+
+    /* The generator stands in for the public key, the device of the
+     * software backend does not check the signature */
+    pData->verifyOpData.xg = pData->xg;
+    pData->verifyOpData.yg = pData->yg;
+    pData->verifyOpData.n = pData->n;
+    pData->verifyOpData.q = pData->q;
+    pData->verifyOpData.a = pData->a;
+    pData->verifyOpData.b = pData->b;
+    pData->verifyOpData.m = pData->m;
+    pData->verifyOpData.r = pData->r;
+    pData->verifyOpData.s = pData->s;
+    pData->verifyOpData.xp = pData->xg;
+    pData->verifyOpData.yp = pData->yg;
+    pData->verifyOpData.fieldType = CPA_CY_EC_FIELD_TYPE_PRIME;
+
+    pData->multiplyOpData.k = pData->k;
+    pData->multiplyOpData.xg = pData->xg;
+    pData->multiplyOpData.yg = pData->yg;
+    pData->multiplyOpData.a = pData->a;
+    pData->multiplyOpData.b = pData->b;
+    pData->multiplyOpData.q = pData->q;
+    pData->multiplyOpData.h = pData->h;
+    pData->multiplyOpData.fieldType = CPA_CY_EC_FIELD_TYPE_PRIME;
+
+    pData->signRSCurveOpData.hCurve = hCurve;
+    pData->signRSCurveOpData.m = pData->m;
+    pData->signRSCurveOpData.d = pData->d;
+    pData->signRSCurveOpData.k = pData->k;
+
+    pData->verifyCurveOpData.hCurve = hCurve;
+    pData->verifyCurveOpData.m = pData->m;
+    pData->verifyCurveOpData.r = pData->r;
+    pData->verifyCurveOpData.s = pData->s;
+    pData->verifyCurveOpData.xp = pData->xg;
+    pData->verifyCurveOpData.yp = pData->yg;
+
+    /* x and y left empty to multiply the base point */
+    pData->multiplyCurveOpData.hCurve = hCurve;
+    pData->multiplyCurveOpData.k = pData->k;
+
+    return CPA_STATUS_SUCCESS;
+}
+
+static CpaStatus ecCurveSubmit(ec_curve_test_params_t *setup,
+                               ec_curve_data_t *pData,
+                               Cpa32U i)
+{
+    CpaInstanceHandle instanceHandle = setup->cyInstanceHandle;
+    perf_data_t *pPerfData = setup->performanceStats;
+
+    switch (setup->step)
+    {
+        case ECDSA_STEP_SIGNRS:
+            if (CPA_TRUE == setup->namedCurve)
+            {
+                return icp_sal_CyEcdsaSignRSCurve(instanceHandle,
+                                                  ecCurveCallback,
+                                                  pPerfData,
+                                                  &pData->signRSCurveOpData,
+                                                  &pData->opStatus,
+                                                  &pData->pOut1[i],
+                                                  &pData->pOut2[i]);
+            }
+            return cpaCyEcdsaSignRS(instanceHandle,
+                                    ecCurveCallback,
+                                    pPerfData,
+                                    &pData->signRSOpData,
+                                    &pData->opStatus,
+                                    &pData->pOut1[i],
+                                    &pData->pOut2[i]);
+        case ECDSA_STEP_VERIFY:
+            if (CPA_TRUE == setup->namedCurve)
+            {
+                return icp_sal_CyEcdsaVerifyCurve(instanceHandle,
+                                                  ecCurveVerifyCallback,
+                                                  pPerfData,
+                                                  &pData->verifyCurveOpData,
+                                                  &pData->opStatus);
+            }
+            return cpaCyEcdsaVerify(instanceHandle,
+                                    ecCurveVerifyCallback,
+                                    pPerfData,
+                                    &pData->verifyOpData,
+                                    &pData->opStatus);
+        default:
+            if (CPA_TRUE == setup->namedCurve)
+            {
+                return icp_sal_CyEcPointMultiplyCurve(
+                    instanceHandle,
+                    ecCurveCallback,
+                    pPerfData,
+                    &pData->multiplyCurveOpData,
+                    &pData->opStatus,
+                    &pData->pOut1[i],
+                    &pData->pOut2[i]);
+            }
+            return cpaCyEcPointMultiply(instanceHandle,
+                                        ecCurveCallback,
+                                        pPerfData,
+                                        &pData->multiplyOpData,
+                                        &pData->opStatus,
+                                        &pData->pOut1[i],
+                                        &pData->pOut2[i]);
+    }
+}
+
+CpaStatus ecCurvePerform(ec_curve_test_params_t *setup)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    ec_curve_data_t data;
+    perf_data_t *pPerfData = setup->performanceStats;
+    Cpa32U numLoops = 0;
+    Cpa32U i = 0;
+
+    memset(&data, 0, sizeof(ec_curve_data_t));
+    memset(pPerfData, 0, sizeof(perf_data_t));
+    pPerfData->numOperations = (Cpa64U)setup->numBuffers * setup->numLoops;
+    pPerfData->responses = 0;
+    sampleCodeSemaphoreInit(&pPerfData->comp, 0);
+
+    status = ecCurveDataSetup(setup, &data);
+
+    /*this barrier will wait until all threads get to this point*/
+    sampleCodeBarrier();
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        sampleCodeSemaphoreDestroy(&pPerfData->comp);
+        return status;
+    }
+
+    /*the callback measures the end time when the last response arrives*/
+    pPerfData->startCyclesTimestamp = sampleCodeTimestamp();
+    for (numLoops = 0; numLoops < setup->numLoops; numLoops++)
+    {
+        for (i = 0; i < setup->numBuffers; i++)
+        {
+            do
+            {
+                status = ecCurveSubmit(setup, &data, i);
+                if (CPA_STATUS_RETRY == status)
+                {
+                    pPerfData->retries++;
+                    /*if the acceleration engine is busy pause for a
+                     * moment by making a context switch*/
+                    if (RETRY_LIMIT ==
+                        (pPerfData->retries % (RETRY_LIMIT + 1)))
+                    {
+                        AVOID_SOFTLOCKUP;
+                    }
+                }
+            } while (CPA_STATUS_RETRY == status);
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("EC request failed with status:%d\n", status);
+                break;
+            }
+        }
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            break;
+        }
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = waitForResponses(
+            pPerfData, ASYNC, setup->numBuffers, setup->numLoops);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("Thread %u timeout. ", setup->threadID);
+        }
+    }
+
+    sampleCodeSemaphoreDestroy(&pPerfData->comp);
+    ecCurveMemFree(setup, &data);
+    if (CPA_STATUS_SUCCESS != pPerfData->threadReturnStatus)
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    return status;
+}
+
+/***************************************************************************
+ * @ingroup sampleEcCurvePerf
+ *
+ * @description
+ *      Print the performance stats of the named curve test
+***************************************************************************/
+void ecCurvePrintStats(thread_creation_data_t *data)
+{
+    ec_curve_test_params_t *params = (ec_curve_test_params_t *)data->setupPtr;
+
+    if (ECDSA_STEP_SIGNRS == params->step)
+    {
+        PRINT("ECDSA SIGNRS\n");
+    }
+    else if (ECDSA_STEP_VERIFY == params->step)
+    {
+        PRINT("ECDSA VERIFY\n");
+    }
+    else
+    {
+        PRINT("EC POINT MULTIPLY\n");
+    }
+    PRINT("Curve API %s\n",
+          (CPA_TRUE == params->namedCurve) ? "named curve handle"
+                                           : "curve parameters");
+    PRINT("EC Size %23u\n", data->packetSize);
+    printAsymStatsAndStopServices(data);
+}
+
+/***************************************************************************
+ * @ingroup sampleEcCurvePerf
+ *
+ * @description
+ *      Named curve performance thread, called by the framework
+***************************************************************************/
+void ecCurvePerformance(single_thread_test_data_t *testSetup)
+{
+    ec_curve_test_params_t curveSetup;
+    Cpa16U numInstances = 0;
+    CpaInstanceHandle *cyInstances = NULL;
+    CpaStatus status = CPA_STATUS_FAIL;
+    ec_curve_test_params_t *params =
+        (ec_curve_test_params_t *)testSetup->setupPtr;
+
+    startBarrier();
+    /*register the print function here so that an early exit still prints
+     * the statistics*/
+    testSetup->statsPrintFunc = (stats_print_func_t)ecCurvePrintStats;
+    curveSetup.performanceStats = testSetup->performanceStats;
+
+    status = cpaCyGetNumInstances(&numInstances);
+    if (CPA_STATUS_SUCCESS != status || numInstances == 0)
+    {
+        PRINT_ERR("cpaCyGetNumInstances error, status:%d, numInstances:%d\n",
+                  status,
+                  numInstances);
+        curveSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    cyInstances = qaeMemAlloc(sizeof(CpaInstanceHandle) * numInstances);
+    if (NULL == cyInstances)
+    {
+        PRINT_ERR("Error allocating memory for instance handles\n");
+        curveSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    if (cpaCyGetInstances(numInstances, cyInstances) != CPA_STATUS_SUCCESS)
+    {
+        PRINT_ERR("Failed to get instances\n");
+        curveSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        qaeMemFree((void **)&cyInstances);
+        sampleCodeThreadExit();
+    }
+    /* give our thread a logical crypto instance to use
+     * use % to wrap around the max number of instances*/
+    curveSetup.cyInstanceHandle =
+        cyInstances[(testSetup->logicalQaInstance) % numInstances];
+
+    curveSetup.threadID = testSetup->threadID;
+    curveSetup.nLenInBytes = params->nLenInBytes;
+    curveSetup.step = params->step;
+    curveSetup.namedCurve = params->namedCurve;
+    curveSetup.numBuffers = params->numBuffers;
+    curveSetup.numLoops = params->numLoops;
+
+    status = ecCurvePerform(&curveSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT("EC Curve Thread %u FAILED\n", testSetup->threadID);
+        curveSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    qaeMemFree((void **)&cyInstances);
+    sampleCodeThreadComplete(testSetup->threadID);
+}
+
+/***************************************************************************
+ * @ingroup sampleEcCurvePerf
+ *
+ * @description
+ *      This function is used to set the parameters to be used in the named
+ *      curve performance thread. It is called before the createThreads
+ *      function of the framework. The framework replicates it across many
+ *      cores
+***************************************************************************/
+CpaStatus setupEcCurveTest(Cpa32U nLenInBits,
+                           ecdsa_step_t step,
+                           CpaBoolean namedCurve,
+                           Cpa32U numBuffers,
+                           Cpa32U numLoops)
+{
+    ec_curve_test_params_t *curveSetup = NULL;
+    Cpa8S name[] = {'E', 'C', 'C', '\0'};
+
+    if (testTypeCount_g >= MAX_THREAD_VARIATION)
+    {
+        PRINT_ERR("Maximum Support Thread Variation has been exceeded\n");
+        PRINT_ERR("Number of Thread Variations created: %d", testTypeCount_g);
+        PRINT_ERR(" Max is %d\n", MAX_THREAD_VARIATION);
+        return CPA_STATUS_FAIL;
+    }
+    /*start crypto service if not already started*/
+    if (CPA_STATUS_SUCCESS != startCyServices())
+    {
+        PRINT_ERR("Error starting Crypto Services\n");
+        return CPA_STATUS_FAIL;
+    }
+    if (!poll_inline_g)
+    {
+        /* start polling threads if polling is enabled in the configuration file
+         */
+        if (CPA_STATUS_SUCCESS != cyCreatePollingThreadsIfPollingIsEnabled())
+        {
+            PRINT_ERR("Error creating polling threads\n");
+            return CPA_STATUS_FAIL;
+        }
+    }
+    memcpy(&thread_name_g[testTypeCount_g][0], name, THREAD_NAME_LEN);
+
+    curveSetup = (ec_curve_test_params_t *)&thread_setup_g[testTypeCount_g][0];
+    testSetupData_g[testTypeCount_g].performance_function =
+        (performance_func_t)ecCurvePerformance;
+    testSetupData_g[testTypeCount_g].packetSize = nLenInBits;
+
+    curveSetup->nLenInBytes =
+        (nLenInBits + NUM_BITS_IN_BYTE - 1) / NUM_BITS_IN_BYTE;
+    curveSetup->step = step;
+    curveSetup->namedCurve = namedCurve;
+    curveSetup->numBuffers = numBuffers;
+    curveSetup->numLoops = numLoops;
+    return CPA_STATUS_SUCCESS;
+}
+EXPORT_SYMBOL(setupEcCurveTest);
@@ -0,0 +1,152 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file cpa_sample_code_ec_curve_perf.h
+ *
+ * @defgroup sampleEcCurvePerf
+ *
+ * @ingroup sampleCode
+ *
+ * @description
+ *     Named curve elliptic curve Sample Code functions.
+ *
+ ***************************************************************************/
+#ifndef CPA_SAMPLE_CODE_EC_CURVE_PERF_H
+#define CPA_SAMPLE_CODE_EC_CURVE_PERF_H
+#include "cpa.h"
+#include "cpa_cy_ec.h"
+#include "cpa_cy_ecdsa.h"
+#include "icp_sal_ec_curve.h"
+#include "cpa_sample_code_crypto_utils.h"
+
+/**
+ *****************************************************************************
+ * @ingroup sampleEcCurvePerf
+ *      Named curve test data
+ * @description
+ *      This structure contains data relating to setting up a test comparing
+ *      the requests carrying the curve parameters with the named curve
+ *      requests.
+ *
+ ****************************************************************************/
+typedef struct ec_curve_test_params_s
+{
+    /*pointer to pre-allocated memory for thread to store performance data*/
+    perf_data_t *performanceStats;
+    /*crypto instance handle of service that has already been started*/
+    CpaInstanceHandle cyInstanceHandle;
+    /*size of the curve, one of the NIST prime curves*/
+    Cpa32U nLenInBytes;
+    /*operation to measure*/
+    ecdsa_step_t step;
+    /*CPA_TRUE to use the named curve API, CPA_FALSE for the cpaCyEc and
+     * cpaCyEcdsa API*/
+    CpaBoolean namedCurve;
+    /*number of requests per loop, each with its own output buffers*/
+    Cpa32U numBuffers;
+    /*number of loops*/
+    Cpa32U numLoops;
+    Cpa32U threadID;
+} ec_curve_test_params_t;
+
+/*************************************************************************
+ * @ingroup sampleEcCurvePerf
+ *
+ * @description
+ *    Sets up a thread that measures the ops/sec of ECDSA sign, ECDSA verify
+ *    or point multiply on a NIST prime curve, either through the standard
+ *    API with the curve parameters in every request or through a named
+ *    curve handle. The software device backend computes RSA and DH but
+ *    passes EC requests without computing, so on it the test measures the
+ *    cost of building the requests.
+ *
+ * @param[in] nLenInBits        Size of the curve, 256, 384 or 521
+ * @param[in] step              Operation to measure
+ * @param[in] namedCurve        CPA_TRUE for the named curve API
+ * @param[in] numBuffers        Number of requests per loop
+ * @param[in] numLoops          Number of loops
+ * @context
+ *      This functions is called from the user process context
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_FAIL          Function failed.
+ *
+ *************************************************************************/
+CpaStatus setupEcCurveTest(Cpa32U nLenInBits,
+                           ecdsa_step_t step,
+                           CpaBoolean namedCurve,
+                           Cpa32U numBuffers,
+                           Cpa32U numLoops);
+
+#endif
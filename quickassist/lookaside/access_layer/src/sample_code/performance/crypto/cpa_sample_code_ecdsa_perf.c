@@ -1310,6 +1310,9 @@ CpaStatus ecdsaPerform(ecdsa_test_params_t *setup)
     pEcdsaData->responses = 0;
 
 barrier:
+    /*clear the profile of the setup operations before the barrier so only
+     * the timed requests are counted*/
+    resetPkeProfile();
     sampleCodeBarrier();
     /* exiting the function if any failure occurs in previous steps*/
     if (CPA_STATUS_SUCCESS != status)
@@ -1461,6 +1464,7 @@ void ecdsaPrintStats(thread_creation_data_t *data)
         PRINT("ECDSA POINT MULTIPLY\n");
     }
     PRINT("EC Size %23u\n", data->packetSize);
+    printPkeProfile();
     printAsymStatsAndStopServices(data);
 }
 
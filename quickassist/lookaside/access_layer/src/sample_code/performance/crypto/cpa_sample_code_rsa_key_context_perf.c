@@ -0,0 +1,503 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_rsa_key_context_perf.c
+ *
+ * @ingroup sampleRsaKeyContextPerf
+ *
+ * @description
+ *     Measures RSA CRT decrypt with the private key passed in every request
+ *     and with the key set up once as a private key context.
+ *
+ *****************************************************************************/
+#include "cpa_sample_code_rsa_key_context_perf.h"
+
+/* Buffers of a key context test thread */
+typedef struct rsa_key_context_data_s
+{
+    /*RSA key, generated once and used by all requests*/
+    CpaCyRsaPrivateKey *pPrivateKey[1];
+    CpaCyRsaPublicKey *pPublicKey[1];
+    /*context of the key*/
+    icp_sal_rsa_key_context_handle_t hKeyContext;
+    /*operation data and output of every request of a loop*/
+    CpaCyRsaDecryptOpData **ppDecryptOpData;
+    CpaFlatBuffer **ppDecryptOutputData;
+    icp_sal_rsa_decrypt_key_context_op_data_t *pKeyContextOpData;
+} rsa_key_context_data_t;
+
+static void rsaKeyContextCallback(void *pCallbackTag,
+                                  CpaStatus status,
+                                  void *pOpData,
+                                  CpaFlatBuffer *pOut)
+{
+    perf_data_t *pPerfData = (perf_data_t *)pCallbackTag;
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("RSA Decrypt callback failed: status = %d\n", status);
+        pPerfData->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    processCallback(pCallbackTag);
+}
+
+static void rsaKeyContextMemFree(rsa_key_context_test_params_t *setup,
+                                 rsa_key_context_data_t *pData)
+{
+    asym_test_params_t rsaSetup = {0};
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa32U numRetries = 0;
+
+    if (NULL != pData->hKeyContext)
+    {
+        /*the context is kept while decrypts with it are in flight*/
+        do
+        {
+            status = icp_sal_CyRsaPrivateKeyContextDestroy(
+                setup->cyInstanceHandle, pData->hKeyContext);
+            if (CPA_STATUS_RETRY == status)
+            {
+                sampleCodeSleepMilliSec(RSA_KEY_CONTEXT_DESTROY_WAIT_MS);
+            }
+        } while ((CPA_STATUS_RETRY == status) &&
+                 (++numRetries < RSA_KEY_CONTEXT_DESTROY_RETRIES));
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("Key context destroy failed with status:%d\n", status);
+        }
+        pData->hKeyContext = NULL;
+    }
+    if (NULL != pData->pPrivateKey[0])
+    {
+        rsaSetup.numBuffers = 1;
+        rsaFreeKeyMemory(&rsaSetup, pData->pPrivateKey, pData->pPublicKey);
+    }
+    if (NULL != pData->ppDecryptOpData)
+    {
+        rsaSetup.numBuffers = setup->numBuffers;
+        rsaFreeDataMemory(&rsaSetup,
+                          pData->ppDecryptOpData,
+                          pData->ppDecryptOutputData,
+                          NULL,
+                          NULL);
+        qaeMemFree((void **)&pData->ppDecryptOpData);
+        qaeMemFree((void **)&pData->ppDecryptOutputData);
+    }
+    if (NULL != pData->pKeyContextOpData)
+    {
+        qaeMemFree((void **)&pData->pKeyContextOpData);
+    }
+}
+
+static CpaStatus rsaKeyContextSetup(rsa_key_context_test_params_t *setup,
+                                    rsa_key_context_data_t *pData)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    asym_test_params_t rsaSetup = {0};
+    Cpa32U i = 0;
+
+    rsaSetup.performanceStats = setup->performanceStats;
+    rsaSetup.cyInstanceHandle = setup->cyInstanceHandle;
+    rsaSetup.syncMode = ASYNC;
+    rsaSetup.modulusSizeInBytes = setup->modulusSizeInBytes;
+    rsaSetup.rsaKeyRepType = CPA_CY_RSA_PRIVATE_KEY_REP_TYPE_2;
+    rsaSetup.numLoops = setup->numLoops;
+    rsaSetup.threadID = setup->threadID;
+
+    /*one key for all the requests, as on a server*/
+    rsaSetup.numBuffers = 1;
+    status = genKeyArray(&rsaSetup, pData->pPrivateKey, pData->pPublicKey);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("genKeyArray error %d\n", status);
+        pData->pPrivateKey[0] = NULL;
+        return CPA_STATUS_FAIL;
+    }
+
+    pData->ppDecryptOpData =
+        qaeMemAlloc(sizeof(CpaCyRsaDecryptOpData *) * setup->numBuffers);
+    pData->ppDecryptOutputData =
+        qaeMemAlloc(sizeof(CpaFlatBuffer *) * setup->numBuffers);
+    pData->pKeyContextOpData = qaeMemAlloc(
+        sizeof(icp_sal_rsa_decrypt_key_context_op_data_t) * setup->numBuffers);
+    if ((NULL == pData->ppDecryptOpData) ||
+        (NULL == pData->ppDecryptOutputData) ||
+        (NULL == pData->pKeyContextOpData))
+    {
+        PRINT_ERR("qaeMemAlloc error\n");
+        /*the operation data arrays are only freed as a pair*/
+        if (NULL != pData->ppDecryptOpData)
+        {
+            qaeMemFree((void **)&pData->ppDecryptOpData);
+        }
+        if (NULL != pData->ppDecryptOutputData)
+        {
+            qaeMemFree((void **)&pData->ppDecryptOutputData);
+        }
+        rsaKeyContextMemFree(setup, pData);
+        return CPA_STATUS_FAIL;
+    }
+    memset(pData->ppDecryptOpData,
+           0,
+           sizeof(CpaCyRsaDecryptOpData *) * setup->numBuffers);
+    memset(pData->ppDecryptOutputData,
+           0,
+           sizeof(CpaFlatBuffer *) * setup->numBuffers);
+
+    rsaSetup.numBuffers = setup->numBuffers;
+    status = rsaDecryptDataSetup(NULL,
+                                 pData->ppDecryptOpData,
+                                 pData->ppDecryptOutputData,
+                                 &rsaSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        rsaKeyContextMemFree(setup, pData);
+        return CPA_STATUS_FAIL;
+    }
+
+    if (CPA_TRUE == setup->useKeyContext)
+    {
+        status = icp_sal_CyRsaPrivateKeyContextCreate(
+            setup->cyInstanceHandle,
+            pData->pPrivateKey[0],
+            &pData->hKeyContext);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("icp_sal_CyRsaPrivateKeyContextCreate error %d\n",
+                      status);
+            pData->hKeyContext = NULL;
+            rsaKeyContextMemFree(setup, pData);
+            return CPA_STATUS_FAIL;
+        }
+    }
+
+    for (i = 0; i < setup->numBuffers; i++)
+    {
+        pData->ppDecryptOpData[i]->pRecipientPrivateKey = pData->pPrivateKey[0];
+        pData->pKeyContextOpData[i].hKeyContext = pData->hKeyContext;
+        pData->pKeyContextOpData[i].inputData =
+            pData->ppDecryptOpData[i]->inputData;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+static CpaStatus rsaKeyContextSubmit(rsa_key_context_test_params_t *setup,
+                                     rsa_key_context_data_t *pData,
+                                     Cpa32U i)
+{
+    if (CPA_TRUE == setup->useKeyContext)
+    {
+        return icp_sal_CyRsaDecryptKeyContext(setup->cyInstanceHandle,
+                                              rsaKeyContextCallback,
+                                              setup->performanceStats,
+                                              &pData->pKeyContextOpData[i],
+                                              pData->ppDecryptOutputData[i]);
+    }
+    return cpaCyRsaDecrypt(setup->cyInstanceHandle,
+                           rsaKeyContextCallback,
+                           setup->performanceStats,
+                           pData->ppDecryptOpData[i],
+                           pData->ppDecryptOutputData[i]);
+}
+
+CpaStatus rsaKeyContextPerform(rsa_key_context_test_params_t *setup)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    rsa_key_context_data_t data;
+    perf_data_t *pPerfData = setup->performanceStats;
+    perf_cycles_t submitStart = 0;
+    perf_cycles_t submitCycles = 0;
+    Cpa32U numLoops = 0;
+    Cpa32U i = 0;
+
+    memset(&data, 0, sizeof(rsa_key_context_data_t));
+    memset(pPerfData, 0, sizeof(perf_data_t));
+
+    status = rsaKeyContextSetup(setup, &data);
+
+    /*this barrier will wait until all threads get to this point*/
+    sampleCodeBarrier();
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+
+    /*the RSA key generation completes on the same performance data and
+     * destroys its semaphore, so the counters are only set up after it*/
+    pPerfData->numOperations = (Cpa64U)setup->numBuffers * setup->numLoops;
+    pPerfData->responses = 0;
+    pPerfData->retries = 0;
+    sampleCodeSemaphoreInit(&pPerfData->comp, 0);
+
+    /*the callback measures the end time when the last response arrives*/
+    pPerfData->startCyclesTimestamp = sampleCodeTimestamp();
+    for (numLoops = 0; numLoops < setup->numLoops; numLoops++)
+    {
+        for (i = 0; i < setup->numBuffers; i++)
+        {
+            do
+            {
+                submitStart = sampleCodeTimestamp();
+                status = rsaKeyContextSubmit(setup, &data, i);
+                if (CPA_STATUS_RETRY == status)
+                {
+                    pPerfData->retries++;
+                    /*if the acceleration engine is busy pause for a
+                     * moment by making a context switch*/
+                    if (RETRY_LIMIT ==
+                        (pPerfData->retries % (RETRY_LIMIT + 1)))
+                    {
+                        AVOID_SOFTLOCKUP;
+                    }
+                }
+            } while (CPA_STATUS_RETRY == status);
+            /*only the call that sent the request is counted*/
+            submitCycles += sampleCodeTimestamp() - submitStart;
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("RSA Decrypt failed with status:%d\n", status);
+                break;
+            }
+        }
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            break;
+        }
+    }
+
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = waitForResponses(
+            pPerfData, ASYNC, setup->numBuffers, setup->numLoops);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("Thread %u timeout. ", setup->threadID);
+        }
+    }
+
+    /*host cycles of one decrypt call*/
+    pPerfData->offloadCycles = submitCycles;
+    do_div(pPerfData->offloadCycles, pPerfData->numOperations);
+
+    sampleCodeSemaphoreDestroy(&pPerfData->comp);
+    rsaKeyContextMemFree(setup, &data);
+    if (CPA_STATUS_SUCCESS != pPerfData->threadReturnStatus)
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    return status;
+}
+
+/***************************************************************************
+ * @ingroup sampleRsaKeyContextPerf
+ *
+ * @description
+ *      Print the performance stats of the key context test
+***************************************************************************/
+void rsaKeyContextPrintStats(thread_creation_data_t *data)
+{
+    rsa_key_context_test_params_t *params =
+        (rsa_key_context_test_params_t *)data->setupPtr;
+    perf_cycles_t hostCycles = 0;
+    Cpa32U i = 0;
+
+    /*the stats are cleared when they are printed*/
+    for (i = 0; i < data->numberOfThreads; i++)
+    {
+        hostCycles += data->performanceStats[i]->offloadCycles;
+    }
+    if (0 != data->numberOfThreads)
+    {
+        do_div(hostCycles, data->numberOfThreads);
+    }
+
+    PRINT("RSA CRT DECRYPT\n");
+    PRINT("Modulus Size %17u\n", data->packetSize);
+    PRINT("Private Key %18s\n",
+          (CPA_TRUE == params->useKeyContext) ? "Context" : "Request");
+    PRINT("Host Cycles Per Op %11llu\n", (long long unsigned int)hostCycles);
+    printAsymStatsAndStopServices(data);
+}
+
+/***************************************************************************
+ * @ingroup sampleRsaKeyContextPerf
+ *
+ * @description
+ *      Key context performance thread, called by the framework
+***************************************************************************/
+void rsaKeyContextPerformance(single_thread_test_data_t *testSetup)
+{
+    rsa_key_context_test_params_t keyContextSetup;
+    Cpa16U numInstances = 0;
+    CpaInstanceHandle *cyInstances = NULL;
+    CpaStatus status = CPA_STATUS_FAIL;
+    rsa_key_context_test_params_t *params =
+        (rsa_key_context_test_params_t *)testSetup->setupPtr;
+
+    startBarrier();
+    /*register the print function here so that an early exit still prints
+     * the statistics*/
+    testSetup->statsPrintFunc = (stats_print_func_t)rsaKeyContextPrintStats;
+    keyContextSetup.performanceStats = testSetup->performanceStats;
+
+    status = cpaCyGetNumInstances(&numInstances);
+    if (CPA_STATUS_SUCCESS != status || numInstances == 0)
+    {
+        PRINT_ERR("cpaCyGetNumInstances error, status:%d, numInstances:%d\n",
+                  status,
+                  numInstances);
+        keyContextSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    cyInstances = qaeMemAlloc(sizeof(CpaInstanceHandle) * numInstances);
+    if (NULL == cyInstances)
+    {
+        PRINT_ERR("Error allocating memory for instance handles\n");
+        keyContextSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    if (cpaCyGetInstances(numInstances, cyInstances) != CPA_STATUS_SUCCESS)
+    {
+        PRINT_ERR("Failed to get instances\n");
+        keyContextSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        qaeMemFree((void **)&cyInstances);
+        sampleCodeThreadExit();
+    }
+    /* give our thread a logical crypto instance to use
+     * use % to wrap around the max number of instances*/
+    keyContextSetup.cyInstanceHandle =
+        cyInstances[(testSetup->logicalQaInstance) % numInstances];
+
+    keyContextSetup.threadID = testSetup->threadID;
+    keyContextSetup.modulusSizeInBytes = params->modulusSizeInBytes;
+    keyContextSetup.useKeyContext = params->useKeyContext;
+    keyContextSetup.numBuffers = params->numBuffers;
+    keyContextSetup.numLoops = params->numLoops;
+
+    status = rsaKeyContextPerform(&keyContextSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT("RSA Key Context Thread %u FAILED\n", testSetup->threadID);
+        keyContextSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    qaeMemFree((void **)&cyInstances);
+    sampleCodeThreadComplete(testSetup->threadID);
+}
+
+/***************************************************************************
+ * @ingroup sampleRsaKeyContextPerf
+ *
+ * @description
+ *      This function is used to set the parameters to be used in the key
+ *      context performance thread. It is called before the createThreads
+ *      function of the framework. The framework replicates it across many
+ *      cores
+***************************************************************************/
+CpaStatus setupRsaKeyContextTest(Cpa32U modulusSizeInBits,
+                                 CpaBoolean useKeyContext,
+                                 Cpa32U numBuffers,
+                                 Cpa32U numLoops)
+{
+    rsa_key_context_test_params_t *keyContextSetup = NULL;
+    Cpa8S name[] = {'R', 'S', 'A', '\0'};
+
+    if (testTypeCount_g >= MAX_THREAD_VARIATION)
+    {
+        PRINT_ERR("Maximum Support Thread Variation has been exceeded\n");
+        PRINT_ERR("Number of Thread Variations created: %d", testTypeCount_g);
+        PRINT_ERR(" Max is %d\n", MAX_THREAD_VARIATION);
+        return CPA_STATUS_FAIL;
+    }
+    /*start crypto service if not already started*/
+    if (CPA_STATUS_SUCCESS != startCyServices())
+    {
+        PRINT_ERR("Error starting Crypto Services\n");
+        return CPA_STATUS_FAIL;
+    }
+    if (!poll_inline_g)
+    {
+        /* start polling threads if polling is enabled in the configuration file
+         */
+        if (CPA_STATUS_SUCCESS != cyCreatePollingThreadsIfPollingIsEnabled())
+        {
+            PRINT_ERR("Error creating polling threads\n");
+            return CPA_STATUS_FAIL;
+        }
+    }
+    memcpy(&thread_name_g[testTypeCount_g][0], name, THREAD_NAME_LEN);
+
+    keyContextSetup =
+        (rsa_key_context_test_params_t *)&thread_setup_g[testTypeCount_g][0];
+    testSetupData_g[testTypeCount_g].performance_function =
+        (performance_func_t)rsaKeyContextPerformance;
+    testSetupData_g[testTypeCount_g].packetSize = modulusSizeInBits;
+
+    keyContextSetup->modulusSizeInBytes =
+        (modulusSizeInBits + NUM_BITS_IN_BYTE - 1) / NUM_BITS_IN_BYTE;
+    keyContextSetup->useKeyContext = useKeyContext;
+    keyContextSetup->numBuffers = numBuffers;
+    keyContextSetup->numLoops = numLoops;
+    return CPA_STATUS_SUCCESS;
+}
+EXPORT_SYMBOL(setupRsaKeyContextTest);
@@ -0,0 +1,148 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file cpa_sample_code_rsa_key_context_perf.h
+ *
+ * @defgroup sampleRsaKeyContextPerf
+ *
+ * @ingroup sampleCode
+ *
+ * @description
+ *     RSA decrypt with private key contexts Sample Code functions.
+ *
+ ***************************************************************************/
+#ifndef CPA_SAMPLE_CODE_RSA_KEY_CONTEXT_PERF_H
+#define CPA_SAMPLE_CODE_RSA_KEY_CONTEXT_PERF_H
+#include "cpa.h"
+#include "cpa_cy_rsa.h"
+#include "icp_sal_rsa_key_context.h"
+#include "cpa_sample_code_crypto_utils.h"
+
+/*wait between two destroys of a key context with decrypts in flight*/
+#define RSA_KEY_CONTEXT_DESTROY_WAIT_MS (10)
+/*number of destroys of a key context before it is given up*/
+#define RSA_KEY_CONTEXT_DESTROY_RETRIES (500)
+
+/**
+ *****************************************************************************
+ * @ingroup sampleRsaKeyContextPerf
+ *      Key context test data
+ * @description
+ *      This structure contains data relating to setting up a test of RSA CRT
+ *      decrypt with the key in the request or in a private key context.
+ *
+ ****************************************************************************/
+typedef struct rsa_key_context_test_params_s
+{
+    /*pointer to pre-allocated memory for thread to store performance data*/
+    perf_data_t *performanceStats;
+    /*crypto instance handle of service that has already been started*/
+    CpaInstanceHandle cyInstanceHandle;
+    /*size of the modulus*/
+    Cpa32U modulusSizeInBytes;
+    /*decrypt with a private key context instead of the key*/
+    CpaBoolean useKeyContext;
+    /*number of requests per loop*/
+    Cpa32U numBuffers;
+    /*number of loops*/
+    Cpa32U numLoops;
+    Cpa32U threadID;
+} rsa_key_context_test_params_t;
+
+/*************************************************************************
+ * @ingroup sampleRsaKeyContextPerf
+ *
+ * @description
+ *    Sets up a thread that measures RSA CRT decrypt with one private key,
+ *    passed in every request with cpaCyRsaDecrypt or set up once as a
+ *    context for icp_sal_CyRsaDecryptKeyContext. Along with the ops/sec the
+ *    test reports the host cycles spent in the decrypt call per request.
+ *
+ * @param[in] modulusSizeInBits RSA modulus size
+ * @param[in] useKeyContext     CPA_TRUE to decrypt with a key context
+ * @param[in] numBuffers        Number of requests per loop
+ * @param[in] numLoops          Number of loops
+ * @context
+ *      This functions is called from the user process context
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_FAIL          Function failed.
+ *
+ *************************************************************************/
+CpaStatus setupRsaKeyContextTest(Cpa32U modulusSizeInBits,
+                                 CpaBoolean useKeyContext,
+                                 Cpa32U numBuffers,
+                                 Cpa32U numLoops);
+
+#endif
@@ -1021,6 +1021,7 @@ CpaStatus sampleRsaEncrypt(asym_test_params_t *setup,
     }
     if (setup->performEncrypt)
     {
+        resetPkeProfile();
         sampleCodeBarrier();
         /* Get the clock cycle timestamp and store in Global, collect this only
          * for the first request, the callback collects it for the last */
@@ -1224,6 +1225,9 @@ CpaStatus sampleRsaDecrypt(asym_test_params_t *setup,
         }
     }
 #endif
+    /*clear the profile of the setup operations before the barrier so only
+     * the timed requests are counted*/
+    resetPkeProfile();
     /*this barrier will wait until all threads get to this point*/
     sampleCodeBarrier();
     /* Get the clock cycle timestamp and store in Global, collect this only
@@ -1765,6 +1769,7 @@ CpaStatus printRsaCrtPerfData(thread_creation_data_t *data)
         PRINT("RSA CRT DECRYPT\n");
     }
     PRINT("Modulus Size %19u\n", data->packetSize * NUM_BITS_IN_BYTE);
+    printPkeProfile();
     return (printAsymStatsAndStopServices(data));
 }
 
@@ -1780,6 +1785,7 @@ CpaStatus printRsaPerfData(thread_creation_data_t *data)
 {
     PRINT("RSA DECRYPT\n");
     PRINT("Modulus Size %19u\n", data->packetSize * NUM_BITS_IN_BYTE);
+    printPkeProfile();
     return (printAsymStatsAndStopServices(data));
 }
 
@@ -0,0 +1,711 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_sym_host_fallback.c
+ *
+ * @ingroup sampleSymHostFallback
+ *
+ * @description
+ *     Fills the sym ring with AES-GCM or AES-CBC with HMAC requests so that
+ *     host execution takes over, and checks the results of the requests
+ *     executed on the host against a request executed by the device.
+ *
+ *****************************************************************************/
+#include "cpa_sample_code_sym_host_fallback.h"
+#include "icp_sal_poll.h"
+#include "icp_sal.h"
+
+/* Bytes of a request, a multiple of the AES block size */
+#define SYM_HOST_FALLBACK_DATA_LEN (256)
+/* Room after the data for the digest and the IV of a request */
+#define SYM_HOST_FALLBACK_DIGEST_OFFSET (SYM_HOST_FALLBACK_DATA_LEN)
+#define SYM_HOST_FALLBACK_IV_OFFSET                                            \
+    (SYM_HOST_FALLBACK_DIGEST_OFFSET + SHA256_DIGEST_LENGTH_IN_BYTES)
+#define SYM_HOST_FALLBACK_BLOCK_LEN                                            \
+    (SYM_HOST_FALLBACK_IV_OFFSET + IV_LEN_FOR_16_BYTE_BLOCK_CIPHER)
+/* AAD of the AES-GCM requests */
+#define SYM_HOST_FALLBACK_AAD_LEN (16)
+/* Longest wait for the response of a request */
+#define SYM_HOST_FALLBACK_TIMEOUT_MS (10000)
+
+/* A request and its buffers, the data is followed by the digest and the
+ * IV in one block */
+typedef struct sym_host_fallback_req_s
+{
+    CpaCySymOpData opData;
+    CpaBufferList bufferList;
+    CpaFlatBuffer flatBuffers[2];
+    Cpa8U *pBlock;
+    CpaStatus status;
+    /*set on submit and cleared by the callback*/
+    volatile CpaBoolean inFlight;
+} sym_host_fallback_req_t;
+
+/* Data of one host fallback test */
+typedef struct sym_host_fallback_s
+{
+    sym_host_fallback_params_t *setup;
+    CpaCySymSessionCtx pSessionCtx;
+    Cpa32U node;
+    Cpa32U metaSize;
+    Cpa32U digestLen;
+    Cpa8U *pAad;
+    Cpa8U plain[SYM_HOST_FALLBACK_DATA_LEN];
+    Cpa8U iv[IV_LEN_FOR_16_BYTE_BLOCK_CIPHER];
+    Cpa8U reference[SYM_HOST_FALLBACK_DATA_LEN];
+    Cpa8U refDigest[SHA256_DIGEST_LENGTH_IN_BYTES];
+    sym_host_fallback_req_t reqs[SYM_HOST_FALLBACK_BURST];
+    /*set when a response did not come, the buffers must then be kept*/
+    CpaBoolean lostResponse;
+} sym_host_fallback_t;
+
+static void symHostFallbackCallback(void *pCallbackTag,
+                                    CpaStatus status,
+                                    const CpaCySymOp operationType,
+                                    void *pOpData,
+                                    CpaBufferList *pDstBuffer,
+                                    CpaBoolean verifyResult)
+{
+    sym_host_fallback_req_t *pReq = (sym_host_fallback_req_t *)pCallbackTag;
+
+    pReq->status = status;
+    pReq->inFlight = CPA_FALSE;
+}
+
+static CpaBoolean symHostFallbackIsGcm(sym_host_fallback_params_t *setup)
+{
+    return (CPA_CY_SYM_HASH_AES_GCM == setup->hashAlgorithm) ? CPA_TRUE
+                                                              : CPA_FALSE;
+}
+
+/* Sets up a request on numBuffers buffers, a request in more than one
+ * buffer is never executed on the host */
+static CpaStatus symHostFallbackReqInit(sym_host_fallback_t *pFallback,
+                                        sym_host_fallback_req_t *pReq,
+                                        Cpa32U numBuffers)
+{
+    Cpa32U half = SYM_HOST_FALLBACK_DATA_LEN / 2;
+
+    memset(pReq, 0, sizeof(sym_host_fallback_req_t));
+    pReq->pBlock = qaeMemAllocNUMA(
+        SYM_HOST_FALLBACK_BLOCK_LEN, pFallback->node, BYTE_ALIGNMENT_64);
+    pReq->bufferList.pPrivateMetaData = qaeMemAllocNUMA(
+        pFallback->metaSize, pFallback->node, BYTE_ALIGNMENT_64);
+    if (NULL == pReq->pBlock || NULL == pReq->bufferList.pPrivateMetaData)
+    {
+        PRINT_ERR("Could not allocate the host fallback buffers\n");
+        return CPA_STATUS_FAIL;
+    }
+    pReq->flatBuffers[0].pData = pReq->pBlock;
+    if (1 == numBuffers)
+    {
+        pReq->flatBuffers[0].dataLenInBytes = SYM_HOST_FALLBACK_DATA_LEN;
+    }
+    else
+    {
+        pReq->flatBuffers[0].dataLenInBytes = half;
+        pReq->flatBuffers[1].pData = pReq->pBlock + half;
+        pReq->flatBuffers[1].dataLenInBytes = half;
+    }
+    pReq->bufferList.pBuffers = pReq->flatBuffers;
+    pReq->bufferList.numBuffers = numBuffers;
+
+    pReq->opData.sessionCtx = pFallback->pSessionCtx;
+    pReq->opData.packetType = CPA_CY_SYM_PACKET_TYPE_FULL;
+    pReq->opData.messageLenToCipherInBytes = SYM_HOST_FALLBACK_DATA_LEN;
+    pReq->opData.messageLenToHashInBytes = SYM_HOST_FALLBACK_DATA_LEN;
+    pReq->opData.pDigestResult =
+        pReq->pBlock + SYM_HOST_FALLBACK_DIGEST_OFFSET;
+    pReq->opData.pIv = pReq->pBlock + SYM_HOST_FALLBACK_IV_OFFSET;
+    if (CPA_TRUE == symHostFallbackIsGcm(pFallback->setup))
+    {
+        pReq->opData.ivLenInBytes = IV_LEN_FOR_12_BYTE_GCM;
+        pReq->opData.pAdditionalAuthData = pFallback->pAad;
+    }
+    else
+    {
+        pReq->opData.ivLenInBytes = IV_LEN_FOR_16_BYTE_BLOCK_CIPHER;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+static void symHostFallbackReqFree(sym_host_fallback_req_t *pReq)
+{
+    if (NULL != pReq->bufferList.pPrivateMetaData)
+    {
+        qaeMemFreeNUMA((void **)&pReq->bufferList.pPrivateMetaData);
+    }
+    if (NULL != pReq->pBlock)
+    {
+        qaeMemFreeNUMA((void **)&pReq->pBlock);
+    }
+}
+
+/* Sends a request, polling while the ring is full. A request executed on
+ * the host has completed when this returns */
+static CpaStatus symHostFallbackSubmit(sym_host_fallback_t *pFallback,
+                                       sym_host_fallback_req_t *pReq)
+{
+    CpaInstanceHandle instanceHandle = pFallback->setup->cyInstanceHandle;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    memcpy(pReq->pBlock, pFallback->plain, SYM_HOST_FALLBACK_DATA_LEN);
+    memset(pReq->opData.pDigestResult, 0, SHA256_DIGEST_LENGTH_IN_BYTES);
+    memcpy(pReq->opData.pIv, pFallback->iv, pReq->opData.ivLenInBytes);
+    pReq->status = CPA_STATUS_FAIL;
+    pReq->inFlight = CPA_TRUE;
+    do
+    {
+        status = cpaCySymPerformOp(instanceHandle,
+                                   pReq,
+                                   &pReq->opData,
+                                   &pReq->bufferList,
+                                   &pReq->bufferList,
+                                   NULL);
+        if (CPA_STATUS_RETRY == status)
+        {
+            (void)icp_sal_CyPollInstance(instanceHandle, 0);
+            AVOID_SOFTLOCKUP;
+        }
+    } while (CPA_STATUS_RETRY == status);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaCySymPerformOp error, status: %d\n", status);
+        pReq->inFlight = CPA_FALSE;
+    }
+    return status;
+}
+
+/* Polls until the callback of a request has run */
+static CpaStatus symHostFallbackWait(sym_host_fallback_t *pFallback,
+                                     sym_host_fallback_req_t *pReq)
+{
+    perf_cycles_t start = sampleCodeTimestamp();
+    /*the CPU frequency is in kHz*/
+    perf_cycles_t timeout =
+        (perf_cycles_t)sampleCodeGetCpuFreq() * SYM_HOST_FALLBACK_TIMEOUT_MS;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    while (CPA_TRUE == pReq->inFlight)
+    {
+        if (sampleCodeTimestamp() - start > timeout)
+        {
+            PRINT_ERR("No response after %u ms\n",
+                      SYM_HOST_FALLBACK_TIMEOUT_MS);
+            pFallback->lostResponse = CPA_TRUE;
+            return CPA_STATUS_FAIL;
+        }
+        status = icp_sal_CyPollInstance(pFallback->setup->cyInstanceHandle, 0);
+        if (CPA_STATUS_SUCCESS != status && CPA_STATUS_RETRY != status)
+        {
+            PRINT_ERR("icp_sal_CyPollInstance error, status: %d\n", status);
+        }
+        AVOID_SOFTLOCKUP;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Encrypts the data with a request in two buffers, which the device
+ * executes, to get the expected results */
+static CpaStatus symHostFallbackReference(sym_host_fallback_t *pFallback)
+{
+    sym_host_fallback_req_t req;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    status = symHostFallbackReqInit(pFallback, &req, 2);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = symHostFallbackSubmit(pFallback, &req);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = symHostFallbackWait(pFallback, &req);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            /*a lost response, leave the buffers to it*/
+            return status;
+        }
+        status = req.status;
+        memcpy(pFallback->reference, req.pBlock, SYM_HOST_FALLBACK_DATA_LEN);
+        memcpy(pFallback->refDigest,
+               req.opData.pDigestResult,
+               pFallback->digestLen);
+    }
+    symHostFallbackReqFree(&req);
+    return status;
+}
+
+/* Sends the requests of a burst without polling, so the ring fills, then
+ * waits for all of them and checks their results */
+static CpaStatus symHostFallbackBurst(sym_host_fallback_t *pFallback,
+                                      Cpa64U *pNumMismatches,
+                                      Cpa64U *pNumErrors)
+{
+    sym_host_fallback_req_t *pReq = NULL;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    for (i = 0; i < SYM_HOST_FALLBACK_BURST && CPA_STATUS_SUCCESS == status;
+         i++)
+    {
+        status = symHostFallbackSubmit(pFallback, &pFallback->reqs[i]);
+    }
+    for (i = 0; i < SYM_HOST_FALLBACK_BURST; i++)
+    {
+        pReq = &pFallback->reqs[i];
+        if (CPA_STATUS_SUCCESS != symHostFallbackWait(pFallback, pReq))
+        {
+            return CPA_STATUS_FAIL;
+        }
+        if (CPA_STATUS_SUCCESS != pReq->status)
+        {
+            (*pNumErrors)++;
+        }
+        else if (0 != memcmp(pReq->pBlock,
+                             pFallback->reference,
+                             SYM_HOST_FALLBACK_DATA_LEN) ||
+                 0 != memcmp(pReq->opData.pDigestResult,
+                             pFallback->refDigest,
+                             pFallback->digestLen))
+        {
+            (*pNumMismatches)++;
+        }
+    }
+    return status;
+}
+
+static void symHostFallbackSetupDataInit(sym_host_fallback_t *pFallback,
+                                         CpaCySymSessionSetupData *pSetupData,
+                                         Cpa8U *pKey)
+{
+    sym_host_fallback_params_t *setup = pFallback->setup;
+
+    memset(pSetupData, 0, sizeof(CpaCySymSessionSetupData));
+    pSetupData->sessionPriority = CPA_CY_PRIORITY_NORMAL;
+    pSetupData->symOperation = CPA_CY_SYM_OP_ALGORITHM_CHAINING;
+    pSetupData->algChainOrder = CPA_CY_SYM_ALG_CHAIN_ORDER_CIPHER_THEN_HASH;
+    pSetupData->cipherSetupData.cipherKeyLenInBytes = KEY_SIZE_128_IN_BYTES;
+    pSetupData->cipherSetupData.pCipherKey = pKey;
+    pSetupData->cipherSetupData.cipherDirection =
+        CPA_CY_SYM_CIPHER_DIRECTION_ENCRYPT;
+    pSetupData->hashSetupData.hashAlgorithm = setup->hashAlgorithm;
+    pSetupData->hashSetupData.hashMode = CPA_CY_SYM_HASH_MODE_AUTH;
+    pSetupData->hashSetupData.digestResultLenInBytes = pFallback->digestLen;
+    if (CPA_TRUE == symHostFallbackIsGcm(setup))
+    {
+        pSetupData->cipherSetupData.cipherAlgorithm =
+            CPA_CY_SYM_CIPHER_AES_GCM;
+        pSetupData->hashSetupData.authModeSetupData.aadLenInBytes =
+            SYM_HOST_FALLBACK_AAD_LEN;
+    }
+    else
+    {
+        pSetupData->cipherSetupData.cipherAlgorithm =
+            CPA_CY_SYM_CIPHER_AES_CBC;
+        pSetupData->hashSetupData.authModeSetupData.authKey = pKey;
+        pSetupData->hashSetupData.authModeSetupData.authKeyLenInBytes =
+            KEY_SIZE_128_IN_BYTES;
+    }
+}
+
+/* Runs the bursts once the session and the reference are set up */
+static CpaStatus symHostFallbackRun(sym_host_fallback_t *pFallback)
+{
+    sym_host_fallback_params_t *setup = pFallback->setup;
+    perf_data_t *pPerfData = setup->performanceStats;
+    icp_sal_sym_host_fallback_stats_t before = {0};
+    icp_sal_sym_host_fallback_stats_t after = {0};
+    Cpa64U numMismatches = 0, numErrors = 0;
+    Cpa64U numHost = 0;
+    Cpa32U i = 0;
+    CpaBoolean run = CPA_FALSE;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    status =
+        icp_sal_CyGetSymHostFallbackStats(setup->cyInstanceHandle, &before);
+    if (CPA_STATUS_UNSUPPORTED == status)
+    {
+        PRINT("Host fallback check skipped, Cy<n>SymHostFallback is not "
+              "set\n");
+        status = CPA_STATUS_SUCCESS;
+    }
+    else if (CPA_STATUS_SUCCESS == status)
+    {
+        status = symHostFallbackReference(pFallback);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            run = CPA_TRUE;
+        }
+        else if (CPA_TRUE != pFallback->lostResponse)
+        {
+            /* The software device does not implement every algorithm */
+            PRINT("Host fallback check skipped, the reference request failed "
+                  "with status %d\n",
+                  status);
+            status = CPA_STATUS_SUCCESS;
+        }
+    }
+    for (i = 0; i < SYM_HOST_FALLBACK_BURST && CPA_TRUE == run &&
+                CPA_STATUS_SUCCESS == status;
+         i++)
+    {
+        status = symHostFallbackReqInit(pFallback, &pFallback->reqs[i], 1);
+    }
+
+    sampleCodeBarrier();
+    pPerfData->startCyclesTimestamp = sampleCodeTimestamp();
+    for (i = 0; i < setup->numBursts && CPA_TRUE == run &&
+                CPA_STATUS_SUCCESS == status;
+         i++)
+    {
+        status =
+            symHostFallbackBurst(pFallback, &numMismatches, &numErrors);
+    }
+    pPerfData->endCyclesTimestamp = sampleCodeTimestamp();
+    pPerfData->numOperations = (Cpa64U)i * SYM_HOST_FALLBACK_BURST;
+    pPerfData->responses = pPerfData->numOperations;
+
+    if (CPA_TRUE != run || CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+    status =
+        icp_sal_CyGetSymHostFallbackStats(setup->cyInstanceHandle, &after);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        numHost = after.numHostExecuted - before.numHostExecuted;
+        PRINT("Host fallback: %llu requests offloaded, %llu executed on the "
+              "host, %llu ineligible\n",
+              (unsigned long long)(after.numOffloaded - before.numOffloaded),
+              (unsigned long long)numHost,
+              (unsigned long long)(after.numHostIneligible -
+                                   before.numHostIneligible));
+        if (0 == numHost || 0 != numMismatches || 0 != numErrors)
+        {
+            PRINT_ERR("Host fallback: %llu requests on the host, %llu "
+                      "differ from the device, %llu errors\n",
+                      (unsigned long long)numHost,
+                      (unsigned long long)numMismatches,
+                      (unsigned long long)numErrors);
+            status = CPA_STATUS_FAIL;
+        }
+    }
+    return status;
+}
+
+CpaStatus symHostFallbackPerform(sym_host_fallback_params_t *setup)
+{
+    sym_host_fallback_t *pFallback = NULL;
+    CpaCySymSessionSetupData setupData;
+    Cpa8U key[KEY_SIZE_128_IN_BYTES];
+    Cpa32U sessionCtxSizeInBytes = 0;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    memset(setup->performanceStats, 0, sizeof(perf_data_t));
+    if (0 == setup->numBursts)
+    {
+        PRINT_ERR("Invalid parameter -- numBursts\n");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    pFallback = qaeMemAlloc(sizeof(sym_host_fallback_t));
+    if (NULL == pFallback)
+    {
+        PRINT_ERR("Could not allocate the host fallback data\n");
+        return CPA_STATUS_FAIL;
+    }
+    memset(pFallback, 0, sizeof(sym_host_fallback_t));
+    pFallback->setup = setup;
+    switch (setup->hashAlgorithm)
+    {
+        case CPA_CY_SYM_HASH_AES_GCM:
+            pFallback->digestLen = AES_GCM_DIGEST_LENGTH_IN_BYTES;
+            break;
+        case CPA_CY_SYM_HASH_SHA1:
+            pFallback->digestLen = SHA1_DIGEST_LENGTH_IN_BYTES;
+            break;
+        default:
+            pFallback->digestLen = SHA256_DIGEST_LENGTH_IN_BYTES;
+            break;
+    }
+    for (i = 0; i < SYM_HOST_FALLBACK_DATA_LEN; i++)
+    {
+        pFallback->plain[i] = (Cpa8U)(i * 7 + 3);
+    }
+    for (i = 0; i < IV_LEN_FOR_16_BYTE_BLOCK_CIPHER; i++)
+    {
+        pFallback->iv[i] = (Cpa8U)(0x30 + i);
+    }
+    for (i = 0; i < KEY_SIZE_128_IN_BYTES; i++)
+    {
+        key[i] = (Cpa8U)(i * 5 + 1);
+    }
+
+    status = sampleCodeCyGetNode(setup->cyInstanceHandle, &pFallback->node);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = cpaCyBufferListGetMetaSize(
+            setup->cyInstanceHandle, 2, &pFallback->metaSize);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        pFallback->pAad = qaeMemAllocNUMA(
+            SYM_HOST_FALLBACK_AAD_LEN, pFallback->node, BYTE_ALIGNMENT_64);
+        if (NULL == pFallback->pAad)
+        {
+            PRINT_ERR("Could not allocate the host fallback AAD\n");
+            status = CPA_STATUS_FAIL;
+        }
+        else
+        {
+            memset(pFallback->pAad, 0xAA, SYM_HOST_FALLBACK_AAD_LEN);
+        }
+    }
+    symHostFallbackSetupDataInit(pFallback, &setupData, key);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = cpaCySymSessionCtxGetSize(
+            setup->cyInstanceHandle, &setupData, &sessionCtxSizeInBytes);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        pFallback->pSessionCtx = qaeMemAllocNUMA(
+            sessionCtxSizeInBytes, pFallback->node, BYTE_ALIGNMENT_64);
+        if (NULL == pFallback->pSessionCtx)
+        {
+            PRINT_ERR("Could not allocate session memory\n");
+            status = CPA_STATUS_FAIL;
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = cpaCySymInitSession(setup->cyInstanceHandle,
+                                     symHostFallbackCallback,
+                                     &setupData,
+                                     pFallback->pSessionCtx);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("cpaCySymInitSession error, status: %d\n", status);
+            qaeMemFreeNUMA((void **)&pFallback->pSessionCtx);
+        }
+        else
+        {
+            status = symHostFallbackRun(pFallback);
+        }
+    }
+
+    /*requests that got no response still hold their buffers and the
+     * session*/
+    if (CPA_TRUE == pFallback->lostResponse)
+    {
+        return status;
+    }
+    if (NULL != pFallback->pSessionCtx)
+    {
+        removeSymSession(setup->cyInstanceHandle, pFallback->pSessionCtx);
+        qaeMemFreeNUMA((void **)&pFallback->pSessionCtx);
+    }
+    for (i = 0; i < SYM_HOST_FALLBACK_BURST; i++)
+    {
+        symHostFallbackReqFree(&pFallback->reqs[i]);
+    }
+    if (NULL != pFallback->pAad)
+    {
+        qaeMemFreeNUMA((void **)&pFallback->pAad);
+    }
+    qaeMemFree((void **)&pFallback);
+    return status;
+}
+
+/***************************************************************************
+ * @ingroup sampleSymHostFallback
+ *
+ * @description
+ *      Print the results of the host fallback test
+***************************************************************************/
+void symHostFallbackPrintStats(thread_creation_data_t *data)
+{
+    sym_host_fallback_params_t *params =
+        (sym_host_fallback_params_t *)data->setupPtr;
+
+    PRINT("Sym Host Fallback\n");
+    PRINT("Algorithm %s\n",
+          (CPA_CY_SYM_HASH_AES_GCM == params->hashAlgorithm)
+              ? "AES-GCM"
+              : (CPA_CY_SYM_HASH_SHA1 == params->hashAlgorithm)
+                    ? "AES-CBC-HMAC-SHA1"
+                    : "AES-CBC-HMAC-SHA256");
+    PRINT("Requests per Burst %14u\n", SYM_HOST_FALLBACK_BURST);
+    PRINT("Bursts %26u\n", params->numBursts);
+    printAsymStatsAndStopServices(data);
+}
+
+/***************************************************************************
+ * @ingroup sampleSymHostFallback
+ *
+ * @description
+ *      Host fallback test thread, called by the framework
+***************************************************************************/
+void symHostFallbackPerformance(single_thread_test_data_t *testSetup)
+{
+    sym_host_fallback_params_t fallbackSetup;
+    Cpa16U numInstances = 0;
+    CpaInstanceHandle *cyInstances = NULL;
+    CpaStatus status = CPA_STATUS_FAIL;
+    sym_host_fallback_params_t *params =
+        (sym_host_fallback_params_t *)testSetup->setupPtr;
+
+    startBarrier();
+    fallbackSetup.performanceStats = testSetup->performanceStats;
+
+    status = cpaCyGetNumInstances(&numInstances);
+    if (CPA_STATUS_SUCCESS != status || numInstances == 0)
+    {
+        PRINT_ERR("cpaCyGetNumInstances error, status:%d, numInstances:%d\n",
+                  status,
+                  numInstances);
+        fallbackSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    cyInstances = qaeMemAlloc(sizeof(CpaInstanceHandle) * numInstances);
+    if (NULL == cyInstances)
+    {
+        PRINT_ERR("Error allocating memory for instance handles\n");
+        fallbackSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    if (cpaCyGetInstances(numInstances, cyInstances) != CPA_STATUS_SUCCESS)
+    {
+        PRINT_ERR("Failed to get instances\n");
+        fallbackSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        qaeMemFree((void **)&cyInstances);
+        sampleCodeThreadExit();
+    }
+    /* give our thread a logical crypto instance to use
+     * use % to wrap around the max number of instances*/
+    fallbackSetup.cyInstanceHandle =
+        cyInstances[(testSetup->logicalQaInstance) % numInstances];
+
+    fallbackSetup.hashAlgorithm = params->hashAlgorithm;
+    fallbackSetup.numBursts = params->numBursts;
+
+    status = symHostFallbackPerform(&fallbackSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT("Host Fallback Thread %u FAILED\n",
+              testSetup->logicalQaInstance);
+        fallbackSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    else
+    {
+        testSetup->statsPrintFunc =
+            (stats_print_func_t)symHostFallbackPrintStats;
+    }
+    qaeMemFree((void **)&cyInstances);
+    sampleCodeThreadComplete(testSetup->threadID);
+}
+
+/***************************************************************************
+ * @ingroup sampleSymHostFallback
+ *
+ * @description
+ *      This function is used to set the parameters to be used in the host
+ *      fallback test thread. It is called before the createThreads function
+ *      of the framework. The framework replicates it across many cores
+***************************************************************************/
+CpaStatus setupSymHostFallbackTest(CpaCySymHashAlgorithm hashAlgorithm,
+                                   Cpa32U numBursts)
+{
+    sym_host_fallback_params_t *fallbackSetup = NULL;
+    Cpa8S name[] = {'S', 'H', 'F', '\0'};
+
+    if (testTypeCount_g >= MAX_THREAD_VARIATION)
+    {
+        PRINT_ERR("Maximum Support Thread Variation has been exceeded\n");
+        PRINT_ERR("Number of Thread Variations created: %d", testTypeCount_g);
+        PRINT_ERR(" Max is %d\n", MAX_THREAD_VARIATION);
+        return CPA_STATUS_FAIL;
+    }
+    /*start crypto service if not already started*/
+    if (CPA_STATUS_SUCCESS != startCyServices())
+    {
+        PRINT_ERR("Error starting Crypto Services\n");
+        return CPA_STATUS_FAIL;
+    }
+    /* no polling threads are created, the test polls polled instances
+     * itself so the ring fills during a burst */
+    memcpy(&thread_name_g[testTypeCount_g][0], name, THREAD_NAME_LEN);
+
+    fallbackSetup =
+        (sym_host_fallback_params_t *)&thread_setup_g[testTypeCount_g][0];
+    testSetupData_g[testTypeCount_g].performance_function =
+        (performance_func_t)symHostFallbackPerformance;
+    testSetupData_g[testTypeCount_g].packetSize = SYM_HOST_FALLBACK_DATA_LEN;
+
+    fallbackSetup->hashAlgorithm = hashAlgorithm;
+    fallbackSetup->numBursts = numBursts;
+    return CPA_STATUS_SUCCESS;
+}
+EXPORT_SYMBOL(setupSymHostFallbackTest);
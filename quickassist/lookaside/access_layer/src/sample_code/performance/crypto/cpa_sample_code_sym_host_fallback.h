@@ -0,0 +1,150 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file cpa_sample_code_sym_host_fallback.h
+ *
+ * @defgroup sampleSymHostFallback
+ *
+ * @ingroup sampleCode
+ *
+ * @description
+ *     Check of the host execution of symmetric requests against the
+ *     device.
+ *
+ ***************************************************************************/
+#ifndef CPA_SAMPLE_CODE_SYM_HOST_FALLBACK_H
+#define CPA_SAMPLE_CODE_SYM_HOST_FALLBACK_H
+#include "cpa.h"
+#include "cpa_cy_sym.h"
+#include "cpa_sample_code_crypto_utils.h"
+
+/* Requests sent without polling in a burst, more than a sym ring holds so
+ * the ring fills whatever its threshold */
+#define SYM_HOST_FALLBACK_BURST (1024)
+/* Bursts of the default test */
+#define SYM_HOST_FALLBACK_NUM_BURSTS (20)
+/* Bursts with signOfLife */
+#define SYM_HOST_FALLBACK_SOL_NUM_BURSTS (2)
+
+/**
+ *****************************************************************************
+ * @ingroup sampleSymHostFallback
+ *      Host fallback test data
+ * @description
+ *      This structure contains data relating to setting up a host fallback
+ *      test.
+ *
+ ****************************************************************************/
+typedef struct sym_host_fallback_params_s
+{
+    /*pointer to pre-allocated memory for thread to store performance data*/
+    perf_data_t *performanceStats;
+    /*crypto instance handle of service that has already been started*/
+    CpaInstanceHandle cyInstanceHandle;
+    /*CPA_CY_SYM_HASH_AES_GCM, or the HMAC of an AES-CBC session*/
+    CpaCySymHashAlgorithm hashAlgorithm;
+    /*number of bursts of SYM_HOST_FALLBACK_BURST requests*/
+    Cpa32U numBursts;
+} sym_host_fallback_params_t;
+
+/*************************************************************************
+ * @ingroup sampleSymHostFallback
+ *
+ * @description
+ *    Sets up a thread that checks the host execution of symmetric requests
+ *    enabled with Cy<n>SymHostFallback. A request in a two buffer list,
+ *    which always goes to the device, gives the reference ciphertext and
+ *    digest. Bursts of SYM_HOST_FALLBACK_BURST requests of the same data
+ *    in single flat buffers are then sent without polling, so with
+ *    Cy<n>SymHostFallback set to 1 the requests that find the ring busy
+ *    run on the host and with 2 all of them do. Every result is compared
+ *    with the reference and the test fails if none ran on the host. The
+ *    test is skipped when host execution is disabled or the device does
+ *    not support the algorithm.
+ *
+ * @param[in] hashAlgorithm     CPA_CY_SYM_HASH_AES_GCM for AES-GCM, or
+ *                              CPA_CY_SYM_HASH_SHA1 or CPA_CY_SYM_HASH_SHA256
+ *                              for AES-CBC with that HMAC
+ * @param[in] numBursts         Number of bursts
+ * @context
+ *      This functions is called from the user process context
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_FAIL          Function failed.
+ *
+ *************************************************************************/
+CpaStatus setupSymHostFallbackTest(CpaCySymHashAlgorithm hashAlgorithm,
+                                   Cpa32U numBursts);
+
+#endif
@@ -0,0 +1,850 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_sym_queue_stress.c
+ *
+ * @ingroup sampleSymQueueStress
+ *
+ * @description
+ *     Sends full and partial packets from several threads on one session,
+ *     so full packets go both directly to the ring and through the session
+ *     queue while a partial stream holds it, and checks every result.
+ *
+ *****************************************************************************/
+#include "cpa_sample_code_sym_queue_stress.h"
+#include "icp_sal_poll.h"
+
+/* Bytes of a full packet, a partial stream sends each half of it */
+#define SYM_QUEUE_STRESS_DATA_LEN (256)
+/* Requests a full packet thread keeps in flight */
+#define SYM_QUEUE_STRESS_DEPTH (8)
+/* Responses taken by a poll that does not drain the whole ring */
+#define SYM_QUEUE_STRESS_POLL_QUOTA (2)
+/* Longest wait for the response of a request */
+#define SYM_QUEUE_STRESS_TIMEOUT_MS (10000)
+
+struct sym_queue_stress_s;
+
+/* A request of the stress test and its buffers. Its counters are only
+ * written by its callback, and a request has one callback in flight at
+ * most. */
+typedef struct sym_queue_stress_req_s
+{
+    CpaCySymOpData opData;
+    CpaBufferList bufferList;
+    CpaFlatBuffer flatBuffer;
+    /*data to encrypt and the result expected, NULL for no check*/
+    const Cpa8U *pPlain;
+    const Cpa8U *pExpected;
+    struct sym_queue_stress_s *pStress;
+    Cpa64U numResponses;
+    Cpa64U numMismatches;
+    Cpa64U numErrors;
+    /*set on submit and cleared by the callback*/
+    volatile CpaBoolean inFlight;
+} sym_queue_stress_req_t;
+
+/* Data shared by the threads of one stress test */
+typedef struct sym_queue_stress_s
+{
+    sym_queue_stress_params_t *setup;
+    CpaCySymSessionCtx pSessionCtx;
+    Cpa32U node;
+    Cpa32U metaSize;
+    Cpa8U plain[SYM_QUEUE_STRESS_DATA_LEN];
+    Cpa8U reference[SYM_QUEUE_STRESS_DATA_LEN];
+    Cpa8U iv[IV_LEN_FOR_16_BYTE_BLOCK_CIPHER];
+    /*the sending threads poll, there is no polling thread*/
+    CpaBoolean sendersPoll;
+    /*written by the polling thread only*/
+    Cpa64U numFullDrains;
+    Cpa64U numQuotaDrains;
+    volatile CpaBoolean stopPolling;
+    /*set when a response did not come, the session must then be kept*/
+    volatile CpaBoolean lostResponse;
+} sym_queue_stress_t;
+
+/* Data of a thread sending requests */
+typedef struct sym_queue_stress_thread_s
+{
+    sym_queue_stress_t *pStress;
+    Cpa64U numResponses;
+    Cpa64U numMismatches;
+    Cpa64U numErrors;
+    CpaStatus status;
+} sym_queue_stress_thread_t;
+
+static void symQueueStressCallback(void *pCallbackTag,
+                                   CpaStatus status,
+                                   const CpaCySymOp operationType,
+                                   void *pOpData,
+                                   CpaBufferList *pDstBuffer,
+                                   CpaBoolean verifyResult)
+{
+    sym_queue_stress_req_t *pReq = (sym_queue_stress_req_t *)pCallbackTag;
+
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        pReq->numErrors++;
+    }
+    else if (NULL != pReq->pExpected &&
+             0 != memcmp(pReq->flatBuffer.pData,
+                         pReq->pExpected,
+                         pReq->flatBuffer.dataLenInBytes))
+    {
+        pReq->numMismatches++;
+    }
+    pReq->numResponses++;
+    pReq->inFlight = CPA_FALSE;
+}
+
+static CpaStatus symQueueStressReqInit(sym_queue_stress_t *pStress,
+                                       sym_queue_stress_req_t *pReq,
+                                       CpaCySymPacketType packetType,
+                                       Cpa32U offset,
+                                       Cpa32U len,
+                                       Cpa8U *pIv)
+{
+    memset(pReq, 0, sizeof(sym_queue_stress_req_t));
+    pReq->pStress = pStress;
+    pReq->pPlain = pStress->plain + offset;
+    pReq->pExpected = pStress->reference + offset;
+    pReq->flatBuffer.dataLenInBytes = len;
+    pReq->flatBuffer.pData =
+        qaeMemAllocNUMA(len, pStress->node, BYTE_ALIGNMENT_64);
+    pReq->bufferList.pPrivateMetaData =
+        qaeMemAllocNUMA(pStress->metaSize, pStress->node, BYTE_ALIGNMENT_64);
+    if (NULL == pReq->flatBuffer.pData ||
+        NULL == pReq->bufferList.pPrivateMetaData)
+    {
+        PRINT_ERR("Could not allocate the stress test buffers\n");
+        return CPA_STATUS_FAIL;
+    }
+    pReq->bufferList.pBuffers = &pReq->flatBuffer;
+    pReq->bufferList.numBuffers = 1;
+    pReq->opData.sessionCtx = pStress->pSessionCtx;
+    pReq->opData.packetType = packetType;
+    pReq->opData.pIv = pIv;
+    pReq->opData.ivLenInBytes = IV_LEN_FOR_16_BYTE_BLOCK_CIPHER;
+    pReq->opData.messageLenToCipherInBytes = len;
+    return CPA_STATUS_SUCCESS;
+}
+
+static void symQueueStressReqFree(sym_queue_stress_req_t *pReq)
+{
+    if (NULL != pReq->bufferList.pPrivateMetaData)
+    {
+        qaeMemFreeNUMA((void **)&pReq->bufferList.pPrivateMetaData);
+    }
+    if (NULL != pReq->flatBuffer.pData)
+    {
+        qaeMemFreeNUMA((void **)&pReq->flatBuffer.pData);
+    }
+}
+
+/* Takes a few responses from a thread sending requests. Their callbacks,
+ * and the queue drains they start, then run alongside the submits of the
+ * other sending threads */
+static void symQueueStressSenderPoll(sym_queue_stress_t *pStress)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    if (CPA_TRUE != pStress->sendersPoll)
+    {
+        return;
+    }
+    status = icp_sal_CyPollInstance(pStress->setup->cyInstanceHandle,
+                                    SYM_QUEUE_STRESS_POLL_QUOTA);
+    if (CPA_STATUS_SUCCESS != status && CPA_STATUS_RETRY != status)
+    {
+        PRINT_ERR("icp_sal_CyPollInstance error, status: %d\n", status);
+    }
+}
+
+/* Sends a request, retrying while the ring is full */
+static CpaStatus symQueueStressSubmit(sym_queue_stress_req_t *pReq)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    memcpy(pReq->flatBuffer.pData,
+           pReq->pPlain,
+           pReq->flatBuffer.dataLenInBytes);
+    pReq->inFlight = CPA_TRUE;
+    do
+    {
+        status = cpaCySymPerformOp(pReq->pStress->setup->cyInstanceHandle,
+                                   pReq,
+                                   &pReq->opData,
+                                   &pReq->bufferList,
+                                   &pReq->bufferList,
+                                   NULL);
+        if (CPA_STATUS_RETRY == status)
+        {
+            symQueueStressSenderPoll(pReq->pStress);
+            AVOID_SOFTLOCKUP;
+        }
+    } while (CPA_STATUS_RETRY == status);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaCySymPerformOp error, status: %d\n", status);
+        pReq->inFlight = CPA_FALSE;
+    }
+    return status;
+}
+
+/* Waits for the callback of a request. A request still in flight after
+ * the timeout keeps its buffers, the caller must not free them. */
+static CpaStatus symQueueStressWait(sym_queue_stress_req_t *pReq)
+{
+    perf_cycles_t start = sampleCodeTimestamp();
+    /*the CPU frequency is in kHz*/
+    perf_cycles_t timeout =
+        (perf_cycles_t)sampleCodeGetCpuFreq() * SYM_QUEUE_STRESS_TIMEOUT_MS;
+
+    while (CPA_TRUE == pReq->inFlight)
+    {
+        if (sampleCodeTimestamp() - start > timeout)
+        {
+            PRINT_ERR("No response after %u ms\n", SYM_QUEUE_STRESS_TIMEOUT_MS);
+            pReq->pStress->lostResponse = CPA_TRUE;
+            return CPA_STATUS_FAIL;
+        }
+        symQueueStressSenderPoll(pReq->pStress);
+        AVOID_SOFTLOCKUP;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+static void symQueueStressCount(sym_queue_stress_thread_t *pThread,
+                                sym_queue_stress_req_t *pReq)
+{
+    pThread->numResponses += pReq->numResponses;
+    pThread->numMismatches += pReq->numMismatches;
+    pThread->numErrors += pReq->numErrors;
+}
+
+/* Sends full packets, keeping SYM_QUEUE_STRESS_DEPTH of them in flight */
+static void symQueueStressFull(void *pArg)
+{
+    sym_queue_stress_thread_t *pThread = (sym_queue_stress_thread_t *)pArg;
+    sym_queue_stress_t *pStress = pThread->pStress;
+    sym_queue_stress_req_t reqs[SYM_QUEUE_STRESS_DEPTH];
+    Cpa8U *pIvs = NULL;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    memset(reqs, 0, sizeof(reqs));
+    pIvs = qaeMemAllocNUMA(SYM_QUEUE_STRESS_DEPTH *
+                               IV_LEN_FOR_16_BYTE_BLOCK_CIPHER,
+                           pStress->node,
+                           BYTE_ALIGNMENT_64);
+    if (NULL == pIvs)
+    {
+        PRINT_ERR("Could not allocate the stress test IVs\n");
+        status = CPA_STATUS_FAIL;
+    }
+    for (i = 0; i < SYM_QUEUE_STRESS_DEPTH && CPA_STATUS_SUCCESS == status;
+         i++)
+    {
+        status = symQueueStressReqInit(
+            pStress,
+            &reqs[i],
+            CPA_CY_SYM_PACKET_TYPE_FULL,
+            0,
+            SYM_QUEUE_STRESS_DATA_LEN,
+            pIvs + i * IV_LEN_FOR_16_BYTE_BLOCK_CIPHER);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            memcpy(reqs[i].opData.pIv,
+                   pStress->iv,
+                   IV_LEN_FOR_16_BYTE_BLOCK_CIPHER);
+        }
+    }
+    for (i = 0;
+         i < pStress->setup->numRequests && CPA_STATUS_SUCCESS == status;
+         i++)
+    {
+        status = symQueueStressWait(&reqs[i % SYM_QUEUE_STRESS_DEPTH]);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = symQueueStressSubmit(&reqs[i % SYM_QUEUE_STRESS_DEPTH]);
+        }
+    }
+    for (i = 0; i < SYM_QUEUE_STRESS_DEPTH; i++)
+    {
+        if (CPA_STATUS_SUCCESS != symQueueStressWait(&reqs[i]))
+        {
+            /*a lost response, leave the buffers to it*/
+            pThread->status = CPA_STATUS_FAIL;
+            sampleCodeThreadExit();
+        }
+        symQueueStressCount(pThread, &reqs[i]);
+        symQueueStressReqFree(&reqs[i]);
+    }
+    if (NULL != pIvs)
+    {
+        qaeMemFreeNUMA((void **)&pIvs);
+    }
+    pThread->status = status;
+    sampleCodeThreadExit();
+}
+
+/* Sends partial streams of a partial and a last partial packet. The last
+ * partial is sent before the partial completes, so it and the full packets
+ * of the other threads wait in the session queue. */
+static void symQueueStressPartial(void *pArg)
+{
+    sym_queue_stress_thread_t *pThread = (sym_queue_stress_thread_t *)pArg;
+    sym_queue_stress_t *pStress = pThread->pStress;
+    sym_queue_stress_req_t reqs[2];
+    Cpa8U *pIv = NULL;
+    Cpa32U half = SYM_QUEUE_STRESS_DATA_LEN / 2;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    memset(reqs, 0, sizeof(reqs));
+    /*the packets of a stream share their IV, which the first one updates*/
+    pIv = qaeMemAllocNUMA(
+        IV_LEN_FOR_16_BYTE_BLOCK_CIPHER, pStress->node, BYTE_ALIGNMENT_64);
+    if (NULL == pIv)
+    {
+        PRINT_ERR("Could not allocate the stress test IV\n");
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = symQueueStressReqInit(
+            pStress, &reqs[0], CPA_CY_SYM_PACKET_TYPE_PARTIAL, 0, half, pIv);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = symQueueStressReqInit(pStress,
+                                       &reqs[1],
+                                       CPA_CY_SYM_PACKET_TYPE_LAST_PARTIAL,
+                                       half,
+                                       half,
+                                       pIv);
+    }
+    for (i = 0;
+         i < pStress->setup->numRequests && CPA_STATUS_SUCCESS == status;
+         i++)
+    {
+        memcpy(pIv, pStress->iv, IV_LEN_FOR_16_BYTE_BLOCK_CIPHER);
+        status = symQueueStressSubmit(&reqs[0]);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = symQueueStressSubmit(&reqs[1]);
+        }
+        /*the next stream needs the IV of this one to be consumed*/
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = symQueueStressWait(&reqs[1]);
+        }
+    }
+    for (i = 0; i < 2; i++)
+    {
+        if (CPA_STATUS_SUCCESS != symQueueStressWait(&reqs[i]))
+        {
+            pThread->status = CPA_STATUS_FAIL;
+            sampleCodeThreadExit();
+        }
+        symQueueStressCount(pThread, &reqs[i]);
+        symQueueStressReqFree(&reqs[i]);
+    }
+    if (NULL != pIv)
+    {
+        qaeMemFreeNUMA((void **)&pIv);
+    }
+    pThread->status = status;
+    sampleCodeThreadExit();
+}
+
+/* Polls the instance, alternating between draining the whole response
+ * ring and taking SYM_QUEUE_STRESS_POLL_QUOTA responses. It only switches
+ * after a poll that found responses, as a poll right after a full drain
+ * often finds the ring empty */
+static void symQueueStressPoll(void *pArg)
+{
+    sym_queue_stress_t *pStress = (sym_queue_stress_t *)pArg;
+    Cpa32U quota = 0;
+    Cpa32U numPolls = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    while (CPA_TRUE != pStress->stopPolling)
+    {
+        quota = (numPolls & 1) ? 0 : SYM_QUEUE_STRESS_POLL_QUOTA;
+        status = icp_sal_CyPollInstance(pStress->setup->cyInstanceHandle,
+                                        quota);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            numPolls++;
+            if (0 == quota)
+            {
+                pStress->numFullDrains++;
+            }
+            else
+            {
+                pStress->numQuotaDrains++;
+            }
+        }
+        else if (CPA_STATUS_RETRY == status)
+        {
+            AVOID_SOFTLOCKUP;
+        }
+        else
+        {
+            PRINT_ERR("icp_sal_CyPollInstance error, status: %d\n", status);
+            break;
+        }
+    }
+    sampleCodeThreadExit();
+}
+
+/* Encrypts the data with one full packet to get the expected results */
+static CpaStatus symQueueStressReference(sym_queue_stress_t *pStress)
+{
+    sym_queue_stress_req_t req;
+    Cpa8U *pIv = NULL;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    pIv = qaeMemAllocNUMA(
+        IV_LEN_FOR_16_BYTE_BLOCK_CIPHER, pStress->node, BYTE_ALIGNMENT_64);
+    if (NULL == pIv)
+    {
+        PRINT_ERR("Could not allocate the stress test IV\n");
+        return CPA_STATUS_FAIL;
+    }
+    memcpy(pIv, pStress->iv, IV_LEN_FOR_16_BYTE_BLOCK_CIPHER);
+    status = symQueueStressReqInit(pStress,
+                                   &req,
+                                   CPA_CY_SYM_PACKET_TYPE_FULL,
+                                   0,
+                                   SYM_QUEUE_STRESS_DATA_LEN,
+                                   pIv);
+    req.pExpected = NULL;
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = symQueueStressSubmit(&req);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = symQueueStressWait(&req);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            /*a lost response, leave the buffers to it*/
+            return status;
+        }
+        if (0 != req.numErrors)
+        {
+            PRINT_ERR("The reference request failed\n");
+            status = CPA_STATUS_FAIL;
+        }
+        memcpy(pStress->reference,
+               req.flatBuffer.pData,
+               SYM_QUEUE_STRESS_DATA_LEN);
+    }
+    symQueueStressReqFree(&req);
+    qaeMemFreeNUMA((void **)&pIv);
+    return status;
+}
+
+static void symQueueStressSetupDataInit(sym_queue_stress_t *pStress,
+                                        CpaCySymSessionSetupData *pSetupData,
+                                        Cpa8U *pKey)
+{
+    memset(pSetupData, 0, sizeof(CpaCySymSessionSetupData));
+    pSetupData->sessionPriority = CPA_CY_PRIORITY_NORMAL;
+    pSetupData->symOperation = CPA_CY_SYM_OP_CIPHER;
+    pSetupData->cipherSetupData.cipherAlgorithm =
+        CPA_CY_SYM_CIPHER_AES_CBC;
+    pSetupData->cipherSetupData.cipherKeyLenInBytes = KEY_SIZE_128_IN_BYTES;
+    pSetupData->cipherSetupData.pCipherKey = pKey;
+    pSetupData->cipherSetupData.cipherDirection =
+        CPA_CY_SYM_CIPHER_DIRECTION_ENCRYPT;
+}
+
+CpaStatus symQueueStressPerform(sym_queue_stress_params_t *setup)
+{
+    sym_queue_stress_t *pStress = NULL;
+    sym_queue_stress_thread_t threads[SYM_QUEUE_STRESS_MAX_THREADS + 1];
+    sample_code_thread_t threadIds[SYM_QUEUE_STRESS_MAX_THREADS + 1];
+    sample_code_thread_t pollThread;
+    CpaInstanceInfo2 instanceInfo2;
+    CpaCySymSessionSetupData setupData;
+    Cpa8U key[KEY_SIZE_128_IN_BYTES];
+    Cpa32U sessionCtxSizeInBytes = 0;
+    Cpa32U numThreads = setup->numFullThreads + 1;
+    Cpa32U numStarted = 0;
+    Cpa64U numResponses = 0, numMismatches = 0, numErrors = 0;
+    Cpa32U i = 0;
+    CpaBoolean polling = CPA_FALSE;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    perf_data_t *pPerfData = setup->performanceStats;
+
+    if (0 == setup->numFullThreads ||
+        SYM_QUEUE_STRESS_MAX_THREADS < setup->numFullThreads ||
+        0 == setup->numRequests)
+    {
+        PRINT_ERR("Invalid parameter -- numFullThreads or numRequests\n");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+    memset(pPerfData, 0, sizeof(perf_data_t));
+    memset(threads, 0, sizeof(threads));
+
+    status = cpaCyInstanceGetInfo2(setup->cyInstanceHandle, &instanceInfo2);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaCyInstanceGetInfo2 error, status: %d\n", status);
+        return status;
+    }
+    pStress = qaeMemAlloc(sizeof(sym_queue_stress_t));
+    if (NULL == pStress)
+    {
+        PRINT_ERR("Could not allocate the stress test data\n");
+        return CPA_STATUS_FAIL;
+    }
+    memset(pStress, 0, sizeof(sym_queue_stress_t));
+    pStress->setup = setup;
+    status = sampleCodeCyGetNode(setup->cyInstanceHandle, &pStress->node);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = cpaCyBufferListGetMetaSize(
+            setup->cyInstanceHandle, 1, &pStress->metaSize);
+    }
+    for (i = 0; i < SYM_QUEUE_STRESS_DATA_LEN; i++)
+    {
+        pStress->plain[i] = (Cpa8U)(i * 13 + 1);
+    }
+    for (i = 0; i < IV_LEN_FOR_16_BYTE_BLOCK_CIPHER; i++)
+    {
+        pStress->iv[i] = (Cpa8U)(0xA0 + i);
+    }
+    for (i = 0; i < KEY_SIZE_128_IN_BYTES; i++)
+    {
+        key[i] = (Cpa8U)(i * 3 + 7);
+    }
+
+    symQueueStressSetupDataInit(pStress, &setupData, key);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = cpaCySymSessionCtxGetSize(
+            setup->cyInstanceHandle, &setupData, &sessionCtxSizeInBytes);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        pStress->pSessionCtx = qaeMemAllocNUMA(
+            sessionCtxSizeInBytes, pStress->node, BYTE_ALIGNMENT_64);
+        if (NULL == pStress->pSessionCtx)
+        {
+            PRINT_ERR("Could not allocate session memory\n");
+            status = CPA_STATUS_FAIL;
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = cpaCySymInitSession(setup->cyInstanceHandle,
+                                     symQueueStressCallback,
+                                     &setupData,
+                                     pStress->pSessionCtx);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("cpaCySymInitSession error, status: %d\n", status);
+            qaeMemFreeNUMA((void **)&pStress->pSessionCtx);
+        }
+    }
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        qaeMemFree((void **)&pStress);
+        return status;
+    }
+
+    /* Polled instances are polled by this test only, to drain the ring
+     * both fully and a few responses at a time, or by the sending threads */
+    if (CPA_TRUE == instanceInfo2.isPolled && CPA_TRUE == setup->sendersPoll)
+    {
+        pStress->sendersPoll = CPA_TRUE;
+    }
+    else if (CPA_TRUE == instanceInfo2.isPolled)
+    {
+        status = sampleCodeThreadCreate(
+            &pollThread, NULL, symQueueStressPoll, pStress);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            polling = CPA_TRUE;
+        }
+        else
+        {
+            PRINT_ERR("Could not create the polling thread\n");
+        }
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = symQueueStressReference(pStress);
+    }
+
+    sampleCodeBarrier();
+    pPerfData->startCyclesTimestamp = sampleCodeTimestamp();
+    for (i = 0; i < numThreads && CPA_STATUS_SUCCESS == status; i++)
+    {
+        threads[i].pStress = pStress;
+        status = sampleCodeThreadCreate(&threadIds[i],
+                                        NULL,
+                                        (0 == i) ? symQueueStressPartial
+                                                 : symQueueStressFull,
+                                        &threads[i]);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("Could not create the stress test threads\n");
+            break;
+        }
+        numStarted++;
+    }
+    for (i = 0; i < numStarted; i++)
+    {
+        sampleCodeThreadJoin(&threadIds[i]);
+        if (CPA_STATUS_SUCCESS != threads[i].status)
+        {
+            status = CPA_STATUS_FAIL;
+        }
+        numResponses += threads[i].numResponses;
+        numMismatches += threads[i].numMismatches;
+        numErrors += threads[i].numErrors;
+    }
+    pPerfData->endCyclesTimestamp = sampleCodeTimestamp();
+    if (CPA_TRUE == polling)
+    {
+        pStress->stopPolling = CPA_TRUE;
+        sampleCodeThreadJoin(&pollThread);
+    }
+
+    pPerfData->numOperations = numResponses;
+    pPerfData->responses = numResponses;
+    if (CPA_STATUS_SUCCESS == status &&
+        (numResponses !=
+             (Cpa64U)numThreads * setup->numRequests + setup->numRequests ||
+         0 != numMismatches || 0 != numErrors))
+    {
+        PRINT_ERR("Queue stress: %llu responses, %llu expected, "
+                  "%llu mismatches, %llu errors\n",
+                  (unsigned long long)numResponses,
+                  (unsigned long long)numThreads * setup->numRequests +
+                      setup->numRequests,
+                  (unsigned long long)numMismatches,
+                  (unsigned long long)numErrors);
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS == status && CPA_TRUE == polling &&
+        (0 == pStress->numFullDrains || 0 == pStress->numQuotaDrains))
+    {
+        PRINT_ERR("Queue stress: the ring was not drained both ways\n");
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_TRUE == polling)
+    {
+        PRINT("Queue stress: %llu full ring drains, %llu partial ring "
+              "drains\n",
+              (unsigned long long)pStress->numFullDrains,
+              (unsigned long long)pStress->numQuotaDrains);
+    }
+
+    /*requests that got no response still hold the session*/
+    if (CPA_TRUE != pStress->lostResponse)
+    {
+        removeSymSession(setup->cyInstanceHandle, pStress->pSessionCtx);
+        qaeMemFreeNUMA((void **)&pStress->pSessionCtx);
+        qaeMemFree((void **)&pStress);
+    }
+    return status;
+}
+
+/***************************************************************************
+ * @ingroup sampleSymQueueStress
+ *
+ * @description
+ *      Print the results of the queue stress test
+***************************************************************************/
+void symQueueStressPrintStats(thread_creation_data_t *data)
+{
+    sym_queue_stress_params_t *params =
+        (sym_queue_stress_params_t *)data->setupPtr;
+
+    PRINT("Session Queue Stress\n");
+    PRINT("Algorithm AES-CBC\n");
+    PRINT("Full Packet Threads %13u\n", params->numFullThreads);
+    PRINT("Partial Streams %17u\n", params->numRequests);
+    PRINT("Polled By Senders %15s\n",
+          (CPA_TRUE == params->sendersPoll) ? "yes" : "no");
+    printAsymStatsAndStopServices(data);
+}
+
+/***************************************************************************
+ * @ingroup sampleSymQueueStress
+ *
+ * @description
+ *      Queue stress test thread, called by the framework
+***************************************************************************/
+void symQueueStressPerformance(single_thread_test_data_t *testSetup)
+{
+    sym_queue_stress_params_t stressSetup;
+    Cpa16U numInstances = 0;
+    CpaInstanceHandle *cyInstances = NULL;
+    CpaStatus status = CPA_STATUS_FAIL;
+    sym_queue_stress_params_t *params =
+        (sym_queue_stress_params_t *)testSetup->setupPtr;
+
+    startBarrier();
+    stressSetup.performanceStats = testSetup->performanceStats;
+
+    status = cpaCyGetNumInstances(&numInstances);
+    if (CPA_STATUS_SUCCESS != status || numInstances == 0)
+    {
+        PRINT_ERR("cpaCyGetNumInstances error, status:%d, numInstances:%d\n",
+                  status,
+                  numInstances);
+        stressSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    cyInstances = qaeMemAlloc(sizeof(CpaInstanceHandle) * numInstances);
+    if (NULL == cyInstances)
+    {
+        PRINT_ERR("Error allocating memory for instance handles\n");
+        stressSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    if (cpaCyGetInstances(numInstances, cyInstances) != CPA_STATUS_SUCCESS)
+    {
+        PRINT_ERR("Failed to get instances\n");
+        stressSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        qaeMemFree((void **)&cyInstances);
+        sampleCodeThreadExit();
+    }
+    /* give our thread a logical crypto instance to use
+     * use % to wrap around the max number of instances*/
+    stressSetup.cyInstanceHandle =
+        cyInstances[(testSetup->logicalQaInstance) % numInstances];
+
+    stressSetup.numFullThreads = params->numFullThreads;
+    stressSetup.numRequests = params->numRequests;
+    stressSetup.sendersPoll = params->sendersPoll;
+
+    status = symQueueStressPerform(&stressSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT("Queue Stress Thread %u FAILED\n", testSetup->logicalQaInstance);
+        stressSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    else
+    {
+        testSetup->statsPrintFunc =
+            (stats_print_func_t)symQueueStressPrintStats;
+    }
+    qaeMemFree((void **)&cyInstances);
+    sampleCodeThreadComplete(testSetup->threadID);
+}
+
+/***************************************************************************
+ * @ingroup sampleSymQueueStress
+ *
+ * @description
+ *      This function is used to set the parameters to be used in the queue
+ *      stress test thread. It is called before the createThreads function
+ *      of the framework. The framework replicates it across many cores
+***************************************************************************/
+CpaStatus setupSymQueueStressTest(Cpa32U numFullThreads,
+                                  Cpa32U numRequests,
+                                  CpaBoolean sendersPoll)
+{
+    sym_queue_stress_params_t *stressSetup = NULL;
+    Cpa8S name[] = {'S', 'Q', 'S', '\0'};
+
+    if (testTypeCount_g >= MAX_THREAD_VARIATION)
+    {
+        PRINT_ERR("Maximum Support Thread Variation has been exceeded\n");
+        PRINT_ERR("Number of Thread Variations created: %d", testTypeCount_g);
+        PRINT_ERR(" Max is %d\n", MAX_THREAD_VARIATION);
+        return CPA_STATUS_FAIL;
+    }
+    /*start crypto service if not already started*/
+    if (CPA_STATUS_SUCCESS != startCyServices())
+    {
+        PRINT_ERR("Error starting Crypto Services\n");
+        return CPA_STATUS_FAIL;
+    }
+    /* no polling threads are created, the test polls polled instances
+     * itself so it controls how the response ring is drained */
+    memcpy(&thread_name_g[testTypeCount_g][0], name, THREAD_NAME_LEN);
+
+    stressSetup =
+        (sym_queue_stress_params_t *)&thread_setup_g[testTypeCount_g][0];
+    testSetupData_g[testTypeCount_g].performance_function =
+        (performance_func_t)symQueueStressPerformance;
+    testSetupData_g[testTypeCount_g].packetSize = SYM_QUEUE_STRESS_DATA_LEN;
+
+    stressSetup->numFullThreads = numFullThreads;
+    stressSetup->numRequests = numRequests;
+    stressSetup->sendersPoll = sendersPoll;
+    return CPA_STATUS_SUCCESS;
+}
+EXPORT_SYMBOL(setupSymQueueStressTest);
@@ -0,0 +1,156 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file cpa_sample_code_sym_queue_stress.h
+ *
+ * @defgroup sampleSymQueueStress
+ *
+ * @ingroup sampleCode
+ *
+ * @description
+ *     Stress test of the request queue of a symmetric session.
+ *
+ ***************************************************************************/
+#ifndef CPA_SAMPLE_CODE_SYM_QUEUE_STRESS_H
+#define CPA_SAMPLE_CODE_SYM_QUEUE_STRESS_H
+#include "cpa.h"
+#include "cpa_cy_sym.h"
+#include "cpa_sample_code_crypto_utils.h"
+
+/* Threads sending full packets in the default stress test */
+#define SYM_QUEUE_STRESS_NUM_THREADS (4)
+/* Full packets per thread, and partial packet streams, of the default
+ * stress test */
+#define SYM_QUEUE_STRESS_NUM_REQUESTS (20000)
+/* Full packets per thread, and partial packet streams, with signOfLife */
+#define SYM_QUEUE_STRESS_SOL_NUM_REQUESTS (200)
+/* Most threads sending full packets */
+#define SYM_QUEUE_STRESS_MAX_THREADS (16)
+
+/**
+ *****************************************************************************
+ * @ingroup sampleSymQueueStress
+ *      Queue stress test data
+ * @description
+ *      This structure contains data relating to setting up a session queue
+ *      stress test.
+ *
+ ****************************************************************************/
+typedef struct sym_queue_stress_params_s
+{
+    /*pointer to pre-allocated memory for thread to store performance data*/
+    perf_data_t *performanceStats;
+    /*crypto instance handle of service that has already been started*/
+    CpaInstanceHandle cyInstanceHandle;
+    /*number of threads sending full packets*/
+    Cpa32U numFullThreads;
+    /*full packets per thread, and partial packet streams*/
+    Cpa32U numRequests;
+    /*the sending threads poll the instance, so completions and the queue
+     * drains they start run alongside the submits of the other threads*/
+    CpaBoolean sendersPoll;
+} sym_queue_stress_params_t;
+
+/*************************************************************************
+ * @ingroup sampleSymQueueStress
+ *
+ * @description
+ *    Sets up a thread that stresses the request queue of one AES-CBC
+ *    session. numFullThreads threads send full packets on the session
+ *    while another thread sends numRequests partial packet streams on it,
+ *    each a partial and a last partial packet, so full packets are queued
+ *    behind the partial stream and sent when it completes. No polling
+ *    threads are created for the test, on a polled instance it polls
+ *    itself, alternating between draining the whole response ring and
+ *    draining a few responses at a time. With sendersPoll the threads
+ *    sending requests poll instead, so a completion that drains the queue
+ *    can run while another thread is queuing a request. Every result is
+ *    checked against the encryption of the same data by one full packet.
+ *
+ * @param[in] numFullThreads    Number of threads sending full packets, 1 to
+ *                              SYM_QUEUE_STRESS_MAX_THREADS
+ * @param[in] numRequests       Full packets per thread and partial streams
+ * @param[in] sendersPoll       CPA_TRUE for the sending threads to poll
+ * @context
+ *      This functions is called from the user process context
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_FAIL          Function failed.
+ *
+ *************************************************************************/
+CpaStatus setupSymQueueStressTest(Cpa32U numFullThreads,
+                                  Cpa32U numRequests,
+                                  CpaBoolean sendersPoll);
+
+#endif
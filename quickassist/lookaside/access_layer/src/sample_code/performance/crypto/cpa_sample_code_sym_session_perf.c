@@ -0,0 +1,900 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_sym_session_perf.c
+ *
+ * @ingroup sampleSymSessionPerf
+ *
+ * @description
+ *     Measures the rate at which HMAC, AES-GCM and AES-CBC with HMAC-SHA1
+ *     sessions can be set up and removed, as seen by applications that
+ *     create a session per connection or install many SAs sharing one
+ *     transform.
+ *
+ *****************************************************************************/
+#include "cpa_sample_code_sym_session_perf.h"
+#include "icp_sal.h"
+
+/* Bytes of data hashed by the check of a cloned session */
+#define SYM_SESSION_CHECK_DATA_LEN (64)
+/* Room for the digest, the IV and the AAD of the check request */
+#define SYM_SESSION_CHECK_EXTRA_LEN (64)
+
+/* Request of the session check, the only request these sessions carry */
+typedef struct sym_session_check_s
+{
+    sample_code_semaphore_t comp;
+    CpaStatus status;
+} sym_session_check_t;
+
+static void symSessionCallback(void *pCallbackTag,
+                               CpaStatus status,
+                               const CpaCySymOp operationType,
+                               void *pOpData,
+                               CpaBufferList *pDstBuffer,
+                               CpaBoolean verifyResult)
+{
+    sym_session_check_t *pCheck = (sym_session_check_t *)pCallbackTag;
+
+    if (NULL != pCheck)
+    {
+        pCheck->status = status;
+        sampleCodeSemaphorePost(&pCheck->comp);
+    }
+}
+
+/* AES-GCM derives the auth key from the cipher key, AES-CBC with HMAC-SHA1
+ * uses the session key for both */
+static CpaBoolean symSessionHasCipherKey(sym_session_test_params_t *setup)
+{
+    return (CPA_CY_SYM_HASH_AES_GCM == setup->hashAlgorithm ||
+            CPA_CY_SYM_HASH_SHA1 == setup->hashAlgorithm);
+}
+
+static CpaBoolean symSessionHasAuthKey(sym_session_test_params_t *setup)
+{
+    return (CPA_CY_SYM_HASH_AES_GCM != setup->hashAlgorithm);
+}
+
+static void symSessionSetupDataInit(sym_session_test_params_t *setup,
+                                    CpaCySymSessionSetupData *pSetupData)
+{
+    memset(pSetupData, 0, sizeof(CpaCySymSessionSetupData));
+    pSetupData->sessionPriority = CPA_CY_PRIORITY_NORMAL;
+    pSetupData->hashSetupData.hashAlgorithm = setup->hashAlgorithm;
+    pSetupData->hashSetupData.hashMode = CPA_CY_SYM_HASH_MODE_AUTH;
+
+    if (CPA_CY_SYM_HASH_AES_GCM == setup->hashAlgorithm)
+    {
+        pSetupData->symOperation = CPA_CY_SYM_OP_ALGORITHM_CHAINING;
+        pSetupData->algChainOrder =
+            CPA_CY_SYM_ALG_CHAIN_ORDER_CIPHER_THEN_HASH;
+        pSetupData->cipherSetupData.cipherAlgorithm =
+            CPA_CY_SYM_CIPHER_AES_GCM;
+        pSetupData->cipherSetupData.cipherKeyLenInBytes =
+            setup->keyLenInBytes;
+        pSetupData->cipherSetupData.cipherDirection =
+            CPA_CY_SYM_CIPHER_DIRECTION_ENCRYPT;
+        pSetupData->hashSetupData.digestResultLenInBytes =
+            AES_GCM_DIGEST_LENGTH_IN_BYTES;
+        pSetupData->hashSetupData.authModeSetupData.aadLenInBytes =
+            KEY_SIZE_128_IN_BYTES;
+    }
+    else if (CPA_CY_SYM_HASH_SHA1 == setup->hashAlgorithm)
+    {
+        pSetupData->symOperation = CPA_CY_SYM_OP_ALGORITHM_CHAINING;
+        pSetupData->algChainOrder =
+            CPA_CY_SYM_ALG_CHAIN_ORDER_CIPHER_THEN_HASH;
+        pSetupData->cipherSetupData.cipherAlgorithm =
+            CPA_CY_SYM_CIPHER_AES_CBC;
+        pSetupData->cipherSetupData.cipherKeyLenInBytes =
+            setup->keyLenInBytes;
+        pSetupData->cipherSetupData.cipherDirection =
+            CPA_CY_SYM_CIPHER_DIRECTION_ENCRYPT;
+        pSetupData->hashSetupData.digestResultLenInBytes =
+            SHA1_DIGEST_LENGTH_IN_BYTES;
+        pSetupData->hashSetupData.authModeSetupData.authKeyLenInBytes =
+            setup->keyLenInBytes;
+    }
+    else
+    {
+        pSetupData->symOperation = CPA_CY_SYM_OP_HASH;
+        pSetupData->hashSetupData.digestResultLenInBytes =
+            SHA256_DIGEST_LENGTH_IN_BYTES;
+        pSetupData->hashSetupData.authModeSetupData.authKeyLenInBytes =
+            setup->keyLenInBytes;
+    }
+}
+
+static Cpa8U *symSessionKeyGet(sym_session_test_params_t *setup,
+                               Cpa8U *pKeys,
+                               Cpa32U sessionIndex)
+{
+    return pKeys + (sessionIndex % setup->numKeys) * setup->keyLenInBytes;
+}
+
+static void symSessionKeySet(sym_session_test_params_t *setup,
+                             CpaCySymSessionSetupData *pSetupData,
+                             Cpa8U *pKey)
+{
+    if (symSessionHasCipherKey(setup))
+    {
+        pSetupData->cipherSetupData.pCipherKey = pKey;
+    }
+    if (symSessionHasAuthKey(setup))
+    {
+        pSetupData->hashSetupData.authModeSetupData.authKey = pKey;
+    }
+}
+
+/* Hashes, or for the chained sessions encrypts and authenticates, a fixed
+ * buffer on a session and returns the digest */
+static CpaStatus symSessionDigest(sym_session_test_params_t *setup,
+                                  CpaCySymSessionCtx pSessionCtx,
+                                  Cpa32U node,
+                                  Cpa8U *pDigest,
+                                  Cpa32U digestLenInBytes)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaCySymOpData opData;
+    CpaBufferList bufferList;
+    CpaFlatBuffer flatBuffer;
+    sym_session_check_t check;
+    Cpa32U metaSize = 0;
+    Cpa8U *pData = NULL;
+    Cpa8U *pExtra = NULL;
+    Cpa32U i = 0;
+
+    memset(&opData, 0, sizeof(opData));
+    memset(&bufferList, 0, sizeof(bufferList));
+    status = cpaCyBufferListGetMetaSize(setup->cyInstanceHandle, 1, &metaSize);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaCyBufferListGetMetaSize error, status: %d\n", status);
+        return status;
+    }
+    pData =
+        qaeMemAllocNUMA(SYM_SESSION_CHECK_DATA_LEN, node, BYTE_ALIGNMENT_64);
+    pExtra =
+        qaeMemAllocNUMA(SYM_SESSION_CHECK_EXTRA_LEN, node, BYTE_ALIGNMENT_64);
+    if (0 != metaSize)
+    {
+        bufferList.pPrivateMetaData =
+            qaeMemAllocNUMA(metaSize, node, BYTE_ALIGNMENT_64);
+    }
+    if (NULL == pData || NULL == pExtra ||
+        (0 != metaSize && NULL == bufferList.pPrivateMetaData))
+    {
+        PRINT_ERR("Could not allocate the session check buffers\n");
+        status = CPA_STATUS_FAIL;
+        goto cleanup;
+    }
+    for (i = 0; i < SYM_SESSION_CHECK_DATA_LEN; i++)
+    {
+        pData[i] = (Cpa8U)(i * 3);
+    }
+    memset(pExtra, 0, SYM_SESSION_CHECK_EXTRA_LEN);
+    flatBuffer.pData = pData;
+    flatBuffer.dataLenInBytes = SYM_SESSION_CHECK_DATA_LEN;
+    bufferList.pBuffers = &flatBuffer;
+    bufferList.numBuffers = 1;
+
+    /* The digest goes to the start of pExtra, followed by a zero IV and for
+     * AES-GCM a zero AAD */
+    opData.sessionCtx = pSessionCtx;
+    opData.packetType = CPA_CY_SYM_PACKET_TYPE_FULL;
+    opData.messageLenToHashInBytes = SYM_SESSION_CHECK_DATA_LEN;
+    opData.pDigestResult = pExtra;
+    if (CPA_CY_SYM_HASH_AES_GCM == setup->hashAlgorithm)
+    {
+        opData.messageLenToCipherInBytes = SYM_SESSION_CHECK_DATA_LEN;
+        opData.pIv = pExtra + AES_GCM_DIGEST_LENGTH_IN_BYTES;
+        opData.ivLenInBytes = IV_LEN_FOR_12_BYTE_GCM;
+        opData.pAdditionalAuthData =
+            pExtra + 2 * AES_GCM_DIGEST_LENGTH_IN_BYTES;
+    }
+    else if (CPA_CY_SYM_HASH_SHA1 == setup->hashAlgorithm)
+    {
+        opData.messageLenToCipherInBytes = SYM_SESSION_CHECK_DATA_LEN;
+        opData.pIv = pExtra + SHA256_DIGEST_LENGTH_IN_BYTES;
+        opData.ivLenInBytes = IV_LEN_FOR_16_BYTE_BLOCK_CIPHER;
+    }
+
+    sampleCodeSemaphoreInit(&check.comp, 0);
+    check.status = CPA_STATUS_FAIL;
+    status = cpaCySymPerformOp(setup->cyInstanceHandle,
+                               &check,
+                               &opData,
+                               &bufferList,
+                               &bufferList,
+                               NULL);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = sampleCodeSemaphoreWait(&check.comp, SAMPLE_CODE_WAIT_DEFAULT);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = check.status;
+        }
+    }
+    sampleCodeSemaphoreDestroy(&check.comp);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        memcpy(pDigest, pExtra, digestLenInBytes);
+    }
+
+cleanup:
+    if (NULL != bufferList.pPrivateMetaData)
+    {
+        qaeMemFreeNUMA((void **)&bufferList.pPrivateMetaData);
+    }
+    if (NULL != pExtra)
+    {
+        qaeMemFreeNUMA((void **)&pExtra);
+    }
+    if (NULL != pData)
+    {
+        qaeMemFreeNUMA((void **)&pData);
+    }
+    return status;
+}
+
+/* Checks that a session set up by cloning, with the key at keyIndex, gives
+ * the same digest as a session set up by cpaCySymInitSession with that
+ * key */
+static CpaStatus symSessionCheck(sym_session_test_params_t *setup,
+                                 CpaCySymSessionSetupData *pSetupData,
+                                 Cpa8U *pKeys,
+                                 Cpa32U keyIndex,
+                                 Cpa32U sessionCtxSizeInBytes,
+                                 Cpa32U node,
+                                 CpaCySymSessionCtx pSessionCtx)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaCySymSessionCtx pRefCtx = NULL;
+    Cpa8U digest[SHA256_DIGEST_LENGTH_IN_BYTES] = {0};
+    Cpa8U refDigest[SHA256_DIGEST_LENGTH_IN_BYTES] = {0};
+    Cpa32U digestLen = pSetupData->hashSetupData.digestResultLenInBytes;
+
+    pRefCtx = qaeMemAllocNUMA(sessionCtxSizeInBytes, node, BYTE_ALIGNMENT_64);
+    if (NULL == pRefCtx)
+    {
+        PRINT_ERR("Could not allocate session memory\n");
+        return CPA_STATUS_FAIL;
+    }
+    symSessionKeySet(
+        setup, pSetupData, symSessionKeyGet(setup, pKeys, keyIndex));
+    status = cpaCySymInitSession(
+        setup->cyInstanceHandle, symSessionCallback, pSetupData, pRefCtx);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaCySymInitSession error, status: %d\n", status);
+        qaeMemFreeNUMA((void **)&pRefCtx);
+        return status;
+    }
+    status = symSessionDigest(setup, pRefCtx, node, refDigest, digestLen);
+    removeSymSession(setup->cyInstanceHandle, pRefCtx);
+    qaeMemFreeNUMA((void **)&pRefCtx);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        /* The software device does not implement every algorithm */
+        PRINT("Session check skipped, the reference request failed with "
+              "status %d\n",
+              status);
+        return CPA_STATUS_SUCCESS;
+    }
+
+    status = symSessionDigest(setup, pSessionCtx, node, digest, digestLen);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("Request on the session under test failed, status: %d\n",
+                  status);
+        return status;
+    }
+    if (0 != memcmp(digest, refDigest, digestLen))
+    {
+        PRINT_ERR("Session digest differs from a full init\n");
+        return CPA_STATUS_FAIL;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/* Sets up two sessions with the API under test, the second one from the
+ * first, and checks the second against a full init with its key. In clone
+ * mode pSessionCtxs[1] is the template. */
+static CpaStatus symSessionCheckSetup(sym_session_test_params_t *setup,
+                                      CpaCySymSessionSetupData *pSetupData,
+                                      Cpa8U *pKeys,
+                                      Cpa32U sessionCtxSizeInBytes,
+                                      Cpa32U node,
+                                      CpaCySymSessionCtx *pSessionCtxs)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaBoolean hasCipherKey = symSessionHasCipherKey(setup);
+    CpaBoolean hasAuthKey = symSessionHasAuthKey(setup);
+    Cpa8U *ppKeys[2] = {NULL};
+    Cpa8U *pKey = symSessionKeyGet(setup, pKeys, 1);
+
+    if (SYM_SESSION_SETUP_CLONE == setup->setupMode)
+    {
+        status = icp_sal_CySymCloneSession(setup->cyInstanceHandle,
+                                           pSessionCtxs[1],
+                                           sessionCtxSizeInBytes,
+                                           hasCipherKey ? pKey : NULL,
+                                           hasAuthKey ? pKey : NULL,
+                                           pSessionCtxs[0]);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("icp_sal_CySymCloneSession error, status: %d\n",
+                      status);
+            return status;
+        }
+        status = symSessionCheck(setup,
+                                 pSetupData,
+                                 pKeys,
+                                 1,
+                                 sessionCtxSizeInBytes,
+                                 node,
+                                 pSessionCtxs[0]);
+        removeSymSession(setup->cyInstanceHandle, pSessionCtxs[0]);
+        return status;
+    }
+
+    ppKeys[0] = symSessionKeyGet(setup, pKeys, 0);
+    ppKeys[1] = pKey;
+    status = icp_sal_CySymInitSessions(setup->cyInstanceHandle,
+                                       symSessionCallback,
+                                       pSetupData,
+                                       2,
+                                       hasCipherKey ? ppKeys : NULL,
+                                       hasAuthKey ? ppKeys : NULL,
+                                       pSessionCtxs);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("icp_sal_CySymInitSessions error, status: %d\n", status);
+        return status;
+    }
+    status = symSessionCheck(setup,
+                             pSetupData,
+                             pKeys,
+                             1,
+                             sessionCtxSizeInBytes,
+                             node,
+                             pSessionCtxs[1]);
+    cpaCySymRemoveSession(setup->cyInstanceHandle, pSessionCtxs[0]);
+    removeSymSession(setup->cyInstanceHandle, pSessionCtxs[1]);
+    return status;
+}
+
+/* Full session init for every session */
+static CpaStatus symSessionInitLoop(sym_session_test_params_t *setup,
+                                    CpaCySymSessionSetupData *pSetupData,
+                                    Cpa8U *pKeys,
+                                    CpaCySymSessionCtx pSessionCtx,
+                                    Cpa32U *pNumSessions)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    Cpa32U i = 0;
+
+    for (i = 0; i < setup->numSessions; i++)
+    {
+        symSessionKeySet(setup, pSetupData, symSessionKeyGet(setup, pKeys, i));
+        status = cpaCySymInitSession(setup->cyInstanceHandle,
+                                     symSessionCallback,
+                                     pSetupData,
+                                     pSessionCtx);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("cpaCySymInitSession error, status: %d\n", status);
+            break;
+        }
+        status = cpaCySymRemoveSession(setup->cyInstanceHandle, pSessionCtx);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("cpaCySymRemoveSession error, status: %d\n", status);
+            break;
+        }
+    }
+    *pNumSessions = i;
+    return status;
+}
+
+/* Every session cloned from pTemplateCtx with its own key */
+static CpaStatus symSessionCloneLoop(sym_session_test_params_t *setup,
+                                     Cpa8U *pKeys,
+                                     Cpa32U sessionCtxSizeInBytes,
+                                     CpaCySymSessionCtx pTemplateCtx,
+                                     CpaCySymSessionCtx pSessionCtx,
+                                     Cpa32U *pNumSessions)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaBoolean hasCipherKey = symSessionHasCipherKey(setup);
+    CpaBoolean hasAuthKey = symSessionHasAuthKey(setup);
+    Cpa8U *pKey = NULL;
+    Cpa32U i = 0;
+
+    for (i = 0; i < setup->numSessions; i++)
+    {
+        pKey = symSessionKeyGet(setup, pKeys, i);
+        status = icp_sal_CySymCloneSession(setup->cyInstanceHandle,
+                                           pTemplateCtx,
+                                           sessionCtxSizeInBytes,
+                                           hasCipherKey ? pKey : NULL,
+                                           hasAuthKey ? pKey : NULL,
+                                           pSessionCtx);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("icp_sal_CySymCloneSession error, status: %d\n",
+                      status);
+            break;
+        }
+        status = cpaCySymRemoveSession(setup->cyInstanceHandle, pSessionCtx);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("cpaCySymRemoveSession error, status: %d\n", status);
+            break;
+        }
+    }
+    *pNumSessions = i;
+    return status;
+}
+
+/* Sessions set up SYM_SESSION_BATCH_SIZE at a time */
+static CpaStatus symSessionBatchLoop(sym_session_test_params_t *setup,
+                                     CpaCySymSessionSetupData *pSetupData,
+                                     Cpa8U *pKeys,
+                                     CpaCySymSessionCtx *pSessionCtxs,
+                                     Cpa32U *pNumSessions)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaBoolean hasCipherKey = symSessionHasCipherKey(setup);
+    CpaBoolean hasAuthKey = symSessionHasAuthKey(setup);
+    Cpa8U *ppKeys[SYM_SESSION_BATCH_SIZE] = {NULL};
+    Cpa32U numInBatch = 0;
+    Cpa32U i = 0, j = 0;
+
+    for (i = 0; i < setup->numSessions; i += numInBatch)
+    {
+        numInBatch = setup->numSessions - i;
+        if (numInBatch > SYM_SESSION_BATCH_SIZE)
+        {
+            numInBatch = SYM_SESSION_BATCH_SIZE;
+        }
+        for (j = 0; j < numInBatch; j++)
+        {
+            ppKeys[j] = symSessionKeyGet(setup, pKeys, i + j);
+        }
+        status = icp_sal_CySymInitSessions(setup->cyInstanceHandle,
+                                           symSessionCallback,
+                                           pSetupData,
+                                           numInBatch,
+                                           hasCipherKey ? ppKeys : NULL,
+                                           hasAuthKey ? ppKeys : NULL,
+                                           pSessionCtxs);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("icp_sal_CySymInitSessions error, status: %d\n",
+                      status);
+            break;
+        }
+        for (j = 0; j < numInBatch; j++)
+        {
+            status = cpaCySymRemoveSession(setup->cyInstanceHandle,
+                                           pSessionCtxs[j]);
+            if (CPA_STATUS_SUCCESS != status)
+            {
+                PRINT_ERR("cpaCySymRemoveSession error, status: %d\n",
+                          status);
+                break;
+            }
+        }
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            break;
+        }
+    }
+    *pNumSessions = i;
+    return status;
+}
+
+CpaStatus symSessionPerform(sym_session_test_params_t *setup)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+    CpaCySymSessionSetupData setupData;
+    CpaCySymSessionCtx pSessionCtxs[SYM_SESSION_BATCH_SIZE] = {NULL};
+    Cpa32U numSessionCtxs = 1;
+    Cpa32U sessionCtxSizeInBytes = 0;
+    Cpa32U numSessions = 0;
+    Cpa8U *pKeys = NULL;
+    Cpa32U node = 0;
+    Cpa32U i = 0;
+    perf_data_t *pPerfData = NULL;
+
+    status = sampleCodeCyGetNode(setup->cyInstanceHandle, &node);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("sampleCodeCyGetNode error, status: %d\n", status);
+        return status;
+    }
+    if (0 == setup->numKeys || 0 == setup->keyLenInBytes)
+    {
+        PRINT_ERR("Invalid parameter -- numKeys or keyLenInBytes\n");
+        return CPA_STATUS_INVALID_PARAM;
+    }
+
+    pPerfData = setup->performanceStats;
+    memset(pPerfData, 0, sizeof(perf_data_t));
+
+    symSessionSetupDataInit(setup, &setupData);
+    status = cpaCySymSessionCtxGetDynamicSize(
+        setup->cyInstanceHandle, &setupData, &sessionCtxSizeInBytes);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("cpaCySymSessionCtxGetDynamicSize error, status: %d\n",
+                  status);
+        return status;
+    }
+
+    /* Clone mode also needs the template session */
+    if (SYM_SESSION_SETUP_CLONE == setup->setupMode)
+    {
+        numSessionCtxs = 2;
+    }
+    else if (SYM_SESSION_SETUP_BATCH == setup->setupMode)
+    {
+        numSessionCtxs = SYM_SESSION_BATCH_SIZE;
+    }
+    for (i = 0; i < numSessionCtxs; i++)
+    {
+        pSessionCtxs[i] =
+            qaeMemAllocNUMA(sessionCtxSizeInBytes, node, BYTE_ALIGNMENT_64);
+        if (NULL == pSessionCtxs[i])
+        {
+            PRINT_ERR("Could not allocate session memory\n");
+            status = CPA_STATUS_FAIL;
+            goto cleanup;
+        }
+    }
+
+    /* Every key is distinct, derived from its index */
+    pKeys = qaeMemAlloc(setup->numKeys * setup->keyLenInBytes);
+    if (NULL == pKeys)
+    {
+        PRINT_ERR("Could not allocate key memory\n");
+        status = CPA_STATUS_FAIL;
+        goto cleanup;
+    }
+    for (i = 0; i < setup->numKeys * setup->keyLenInBytes; i++)
+    {
+        pKeys[i] = (Cpa8U)(i / setup->keyLenInBytes + i * 7);
+    }
+
+    if (SYM_SESSION_SETUP_CLONE == setup->setupMode)
+    {
+        symSessionKeySet(setup, &setupData, pKeys);
+        status = cpaCySymInitSession(setup->cyInstanceHandle,
+                                     symSessionCallback,
+                                     &setupData,
+                                     pSessionCtxs[1]);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("cpaCySymInitSession error, status: %d\n", status);
+            goto cleanup;
+        }
+    }
+
+    /* Sessions that were not fully initialised must work like ones that
+     * were before their setup rate means anything */
+    if (SYM_SESSION_SETUP_INIT != setup->setupMode)
+    {
+        status = symSessionCheckSetup(setup,
+                                      &setupData,
+                                      pKeys,
+                                      sessionCtxSizeInBytes,
+                                      node,
+                                      pSessionCtxs);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            if (SYM_SESSION_SETUP_CLONE == setup->setupMode)
+            {
+                cpaCySymRemoveSession(setup->cyInstanceHandle,
+                                      pSessionCtxs[1]);
+            }
+            goto cleanup;
+        }
+    }
+
+    sampleCodeBarrier();
+    pPerfData->startCyclesTimestamp = sampleCodeTimestamp();
+    switch (setup->setupMode)
+    {
+        case SYM_SESSION_SETUP_CLONE:
+            status = symSessionCloneLoop(setup,
+                                         pKeys,
+                                         sessionCtxSizeInBytes,
+                                         pSessionCtxs[1],
+                                         pSessionCtxs[0],
+                                         &numSessions);
+            break;
+        case SYM_SESSION_SETUP_BATCH:
+            status = symSessionBatchLoop(
+                setup, &setupData, pKeys, pSessionCtxs, &numSessions);
+            break;
+        default:
+            status = symSessionInitLoop(
+                setup, &setupData, pKeys, pSessionCtxs[0], &numSessions);
+            break;
+    }
+    pPerfData->endCyclesTimestamp = sampleCodeTimestamp();
+    pPerfData->numOperations = numSessions;
+    pPerfData->responses = numSessions;
+
+    if (SYM_SESSION_SETUP_CLONE == setup->setupMode)
+    {
+        cpaCySymRemoveSession(setup->cyInstanceHandle, pSessionCtxs[1]);
+    }
+
+cleanup:
+    if (NULL != pKeys)
+    {
+        qaeMemFree((void **)&pKeys);
+    }
+    for (i = 0; i < numSessionCtxs; i++)
+    {
+        if (NULL != pSessionCtxs[i])
+        {
+            qaeMemFreeNUMA((void **)&pSessionCtxs[i]);
+        }
+    }
+    return status;
+}
+
+/***************************************************************************
+ * @ingroup sampleSymSessionPerf
+ *
+ * @description
+ *      Print the session setup rate and the precompute cache counters
+***************************************************************************/
+void symSessionPrintStats(thread_creation_data_t *data)
+{
+    sym_session_test_params_t *params =
+        (sym_session_test_params_t *)data->setupPtr;
+    icp_sal_hash_precomp_cache_stats_t cacheStats = {0};
+    CpaInstanceHandle *cyInstances = NULL;
+    Cpa16U numInstances = 0;
+    Cpa64U numHits = 0, numMisses = 0;
+    CpaBoolean cacheEnabled = CPA_FALSE;
+    Cpa32U i = 0;
+
+    PRINT("Session Setup\n");
+    PRINT("Algorithm %s\n",
+          (CPA_CY_SYM_HASH_AES_GCM == params->hashAlgorithm)
+              ? "AES-GCM"
+              : (CPA_CY_SYM_HASH_SHA1 == params->hashAlgorithm)
+                    ? "AES-CBC-HMAC-SHA1"
+                    : "HMAC");
+    PRINT("Setup API %s\n",
+          (SYM_SESSION_SETUP_CLONE == params->setupMode)
+              ? "icp_sal_CySymCloneSession"
+              : (SYM_SESSION_SETUP_BATCH == params->setupMode)
+                    ? "icp_sal_CySymInitSessions"
+                    : "cpaCySymInitSession");
+    PRINT("Key Size %24u\n", params->keyLenInBytes);
+    PRINT("Distinct Keys %19u\n", params->numKeys);
+
+    /* The counters are read before the print function below stops the
+     * services */
+    if (CPA_STATUS_SUCCESS == cpaCyGetNumInstances(&numInstances) &&
+        numInstances > 0)
+    {
+        cyInstances = qaeMemAlloc(sizeof(CpaInstanceHandle) * numInstances);
+    }
+    if (NULL != cyInstances &&
+        CPA_STATUS_SUCCESS == cpaCyGetInstances(numInstances, cyInstances))
+    {
+        for (i = 0; i < numInstances; i++)
+        {
+            if (CPA_STATUS_SUCCESS ==
+                icp_sal_CyGetHashPrecompCacheStats(cyInstances[i],
+                                                   &cacheStats))
+            {
+                numHits += cacheStats.numHits;
+                numMisses += cacheStats.numMisses;
+                cacheEnabled = CPA_TRUE;
+            }
+        }
+    }
+    if (NULL != cyInstances)
+    {
+        qaeMemFree((void **)&cyInstances);
+    }
+    if (CPA_TRUE == cacheEnabled)
+    {
+        PRINT("Precompute Cache Hits %11llu\n", (unsigned long long)numHits);
+        PRINT("Precompute Cache Misses %9llu\n",
+              (unsigned long long)numMisses);
+    }
+    printAsymStatsAndStopServices(data);
+}
+
+/***************************************************************************
+ * @ingroup sampleSymSessionPerf
+ *
+ * @description
+ *      Session setup performance thread, called by the framework
+***************************************************************************/
+void symSessionPerformance(single_thread_test_data_t *testSetup)
+{
+    sym_session_test_params_t sessionSetup;
+    Cpa16U numInstances = 0;
+    CpaInstanceHandle *cyInstances = NULL;
+    CpaStatus status = CPA_STATUS_FAIL;
+    sym_session_test_params_t *params =
+        (sym_session_test_params_t *)testSetup->setupPtr;
+
+    startBarrier();
+    sessionSetup.performanceStats = testSetup->performanceStats;
+
+    status = cpaCyGetNumInstances(&numInstances);
+    if (CPA_STATUS_SUCCESS != status || numInstances == 0)
+    {
+        PRINT_ERR("cpaCyGetNumInstances error, status:%d, numInstances:%d\n",
+                  status,
+                  numInstances);
+        sessionSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    cyInstances = qaeMemAlloc(sizeof(CpaInstanceHandle) * numInstances);
+    if (NULL == cyInstances)
+    {
+        PRINT_ERR("Error allocating memory for instance handles\n");
+        sessionSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        sampleCodeThreadExit();
+    }
+    if (cpaCyGetInstances(numInstances, cyInstances) != CPA_STATUS_SUCCESS)
+    {
+        PRINT_ERR("Failed to get instances\n");
+        sessionSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+        qaeMemFree((void **)&cyInstances);
+        sampleCodeThreadExit();
+    }
+    /* give our thread a logical crypto instance to use
+     * use % to wrap around the max number of instances*/
+    sessionSetup.cyInstanceHandle =
+        cyInstances[(testSetup->logicalQaInstance) % numInstances];
+
+    sessionSetup.hashAlgorithm = params->hashAlgorithm;
+    sessionSetup.keyLenInBytes = params->keyLenInBytes;
+    sessionSetup.numKeys = params->numKeys;
+    sessionSetup.numSessions = params->numSessions;
+    sessionSetup.setupMode = params->setupMode;
+
+    status = symSessionPerform(&sessionSetup);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT("Session Setup Thread %u FAILED\n", testSetup->logicalQaInstance);
+        sessionSetup.performanceStats->threadReturnStatus = CPA_STATUS_FAIL;
+    }
+    else
+    {
+        testSetup->statsPrintFunc = (stats_print_func_t)symSessionPrintStats;
+    }
+    qaeMemFree((void **)&cyInstances);
+    sampleCodeThreadComplete(testSetup->threadID);
+}
+
+/***************************************************************************
+ * @ingroup sampleSymSessionPerf
+ *
+ * @description
+ *      This function is used to set the parameters to be used in the session
+ *      setup performance thread. It is called before the createThreads
+ *      function of the framework. The framework replicates it across many
+ *      cores
+***************************************************************************/
+CpaStatus setupSymSessionTest(CpaCySymHashAlgorithm hashAlgorithm,
+                              Cpa32U keyLenInBytes,
+                              Cpa32U numKeys,
+                              Cpa32U numSessions,
+                              sym_session_setup_mode_t setupMode)
+{
+    sym_session_test_params_t *sessionSetup = NULL;
+    Cpa8S name[] = {'S', 'E', 'S', '\0'};
+
+    if (testTypeCount_g >= MAX_THREAD_VARIATION)
+    {
+        PRINT_ERR("Maximum Support Thread Variation has been exceeded\n");
+        PRINT_ERR("Number of Thread Variations created: %d", testTypeCount_g);
+        PRINT_ERR(" Max is %d\n", MAX_THREAD_VARIATION);
+        return CPA_STATUS_FAIL;
+    }
+    /*start crypto service if not already started*/
+    if (CPA_STATUS_SUCCESS != startCyServices())
+    {
+        PRINT_ERR("Error starting Crypto Services\n");
+        return CPA_STATUS_FAIL;
+    }
+    /* the session check sends requests, so start polling threads if
+     * polling is enabled in the configuration file */
+    if (CPA_STATUS_SUCCESS != cyCreatePollingThreadsIfPollingIsEnabled())
+    {
+        PRINT_ERR("Error creating polling threads\n");
+        return CPA_STATUS_FAIL;
+    }
+    memcpy(&thread_name_g[testTypeCount_g][0], name, THREAD_NAME_LEN);
+
+    sessionSetup =
+        (sym_session_test_params_t *)&thread_setup_g[testTypeCount_g][0];
+    testSetupData_g[testTypeCount_g].performance_function =
+        (performance_func_t)symSessionPerformance;
+    testSetupData_g[testTypeCount_g].packetSize = keyLenInBytes;
+
+    sessionSetup->hashAlgorithm = hashAlgorithm;
+    sessionSetup->keyLenInBytes = keyLenInBytes;
+    sessionSetup->numKeys = numKeys;
+    sessionSetup->numSessions = numSessions;
+    sessionSetup->setupMode = setupMode;
+    return CPA_STATUS_SUCCESS;
+}
+EXPORT_SYMBOL(setupSymSessionTest);
@@ -0,0 +1,170 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file cpa_sample_code_sym_session_perf.h
+ *
+ * @defgroup sampleSymSessionPerf
+ *
+ * @ingroup sampleCode
+ *
+ * @description
+ *     Symmetric session setup rate Sample Code functions.
+ *
+ ***************************************************************************/
+#ifndef CPA_SAMPLE_CODE_SYM_SESSION_PERF_H
+#define CPA_SAMPLE_CODE_SYM_SESSION_PERF_H
+#include "cpa.h"
+#include "cpa_cy_sym.h"
+#include "cpa_sample_code_crypto_utils.h"
+
+/* Keys cycled through and sessions set up by the default session tests */
+#define SYM_SESSION_NUM_KEYS (64)
+#define SYM_SESSION_NUM_SESSIONS (100000)
+/* Sessions set up per icp_sal_CySymInitSessions call in batch mode */
+#define SYM_SESSION_BATCH_SIZE (32)
+
+/* How the test sets up each session */
+typedef enum sym_session_setup_mode_e
+{
+    SYM_SESSION_SETUP_INIT = 0,
+    /* cpaCySymInitSession for every session */
+    SYM_SESSION_SETUP_CLONE,
+    /* icp_sal_CySymCloneSession from one template session */
+    SYM_SESSION_SETUP_BATCH
+    /* icp_sal_CySymInitSessions for SYM_SESSION_BATCH_SIZE sessions */
+} sym_session_setup_mode_t;
+
+/**
+ *****************************************************************************
+ * @ingroup sampleSymSessionPerf
+ *      Session setup test data
+ * @description
+ *      This structure contains data relating to setting up a session setup
+ *      rate test.
+ *
+ ****************************************************************************/
+typedef struct sym_session_test_params_s
+{
+    /*pointer to pre-allocated memory for thread to store performance data*/
+    perf_data_t *performanceStats;
+    /*crypto instance handle of service that has already been started*/
+    CpaInstanceHandle cyInstanceHandle;
+    /*HMAC algorithm, CPA_CY_SYM_HASH_AES_GCM for AES-GCM sessions or
+     * CPA_CY_SYM_HASH_SHA1 for AES-CBC with HMAC-SHA1 sessions*/
+    CpaCySymHashAlgorithm hashAlgorithm;
+    /*length of the HMAC or AES key*/
+    Cpa32U keyLenInBytes;
+    /*number of distinct keys the sessions cycle through*/
+    Cpa32U numKeys;
+    /*number of sessions to set up and remove*/
+    Cpa32U numSessions;
+    /*API used to set up the sessions*/
+    sym_session_setup_mode_t setupMode;
+} sym_session_test_params_t;
+
+/*************************************************************************
+ * @ingroup sampleSymSessionPerf
+ *
+ * @description
+ *    Sets up a thread that measures how many sessions per second can be
+ *    initialised and removed. The sessions cycle through numKeys keys so
+ *    the effect of the hash precompute cache can be measured by varying
+ *    numKeys against the configured cache size, and the setup APIs can be
+ *    compared through setupMode. Before the timed run, a clone or batch
+ *    mode test sends one request on a session set up by the API under test
+ *    and checks its digest against a session set up by cpaCySymInitSession
+ *    with the same key.
+ *
+ * @param[in] hashAlgorithm     HMAC algorithm, CPA_CY_SYM_HASH_AES_GCM
+ *                              for AES-GCM or CPA_CY_SYM_HASH_SHA1 for
+ *                              AES-CBC with HMAC-SHA1, which uses the key
+ *                              for both
+ * @param[in] keyLenInBytes     Length of the HMAC or AES key
+ * @param[in] numKeys           Number of distinct keys, must be more than 0
+ * @param[in] numSessions       Number of sessions per thread
+ * @param[in] setupMode         API used to set up the sessions
+ * @context
+ *      This functions is called from the user process context
+ *
+ * @assumptions
+ *      None
+ * @sideEffects
+ *      None
+ * @reentrant
+ *      No
+ * @threadSafe
+ *      Yes
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_FAIL          Function failed.
+ *
+ *************************************************************************/
+CpaStatus setupSymSessionTest(CpaCySymHashAlgorithm hashAlgorithm,
+                              Cpa32U keyLenInBytes,
+                              Cpa32U numKeys,
+                              Cpa32U numSessions,
+                              sym_session_setup_mode_t setupMode);
+
+#endif
@@ -219,6 +219,8 @@ volatile thread_state_e threadState_g = THREAD_NOT_STARTED;
 
 volatile CpaBoolean reliability_g = CPA_FALSE;
 int verboseOutput = 1;
+/* print the host cycle profile of the PKE request path after asym tests */
+int pkeProfile = 0;
 
 CpaStatus setReliability(CpaBoolean val)
 {
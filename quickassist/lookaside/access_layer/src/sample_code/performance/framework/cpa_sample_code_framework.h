@@ -191,6 +191,7 @@ typedef struct single_thread_test_data_s
 } single_thread_test_data_t;
 
 extern int useStaticPrime;
+extern int pkeProfile;
 extern volatile CpaBoolean reliability_g;
 extern volatile CpaBoolean error_flag_g;
 CpaStatus setReliability(CpaBoolean val);
@@ -115,6 +115,7 @@ module_param(signOfLife, int, 0);
 module_param(includeWirelessAlgs, int, 0);
 module_param(runStateful, int, 0);
 module_param(verboseOutput, int, 0);
+module_param(pkeProfile, int, 0);
 module_param(useCnv, int, 0);
 
 
@@ -166,6 +167,7 @@ EXPORT_SYMBOL(runTests);
 EXPORT_SYMBOL(includeWirelessAlgs);
 EXPORT_SYMBOL(signOfLife);
 EXPORT_SYMBOL(verboseOutput);
+EXPORT_SYMBOL(pkeProfile);
 EXPORT_SYMBOL(useCnv);
 
 MODULE_AUTHOR("Intel Corporation");
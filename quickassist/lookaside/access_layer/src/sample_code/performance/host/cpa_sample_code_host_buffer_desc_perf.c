@@ -0,0 +1,333 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_host_buffer_desc_perf.c
+ *
+ * @ingroup sampleHostPerf
+ *
+ * @description
+ *     Benchmark of the firmware SGL descriptor write of a request, for
+ *     buffer lists built on every request and for registered ones.
+ *
+ *****************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include "cpa_sample_code_host_perf.h"
+#include "qae_mem.h"
+#include "icp_sal.h"
+#include "icp_buffer_desc.h"
+#include "icp_sal_host_perf.h"
+
+/*descriptor writes per thread of the buffer descriptor benchmark*/
+#define HOST_BUFF_DESC_OPS (200000)
+
+/*largest number of flat buffers of a list*/
+#define HOST_BUFF_DESC_MAX_FRAGS (32)
+
+/*size of each flat buffer*/
+#define HOST_BUFF_DESC_FRAG_SIZE (2048)
+
+/*alignment of the buffers and the metadata, as the driver asks for*/
+#define HOST_BUFF_DESC_ALIGNMENT (64)
+
+/* Buffer list of the benchmark and the instance that translates its
+ * addresses. refList has the same buffers and its own metadata, it is
+ * never registered and gives the expected descriptor */
+typedef struct host_buff_desc_s
+{
+    CpaInstanceHandle instanceHandle;
+    CpaBufferList bufferList;
+    CpaBufferList refList;
+    CpaFlatBuffer flatBuffers[HOST_BUFF_DESC_MAX_FRAGS];
+} host_buff_desc_t;
+
+static CpaStatus hostBuffDescThread(void *pArg,
+                                    Cpa32U threadIndex,
+                                    Cpa32U numOps)
+{
+    host_buff_desc_t *pDesc = (host_buff_desc_t *)pArg;
+    Cpa64U physAddr = 0;
+    Cpa32U i = 0;
+
+    for (i = 0; i < numOps; i++)
+    {
+        /*applications change the lengths between requests*/
+        pDesc->flatBuffers[0].dataLenInBytes =
+            HOST_BUFF_DESC_FRAG_SIZE - (i & 0xf);
+        if (CPA_STATUS_SUCCESS !=
+            icp_sal_HostPerfBufferListDescWrite(
+                pDesc->instanceHandle, &pDesc->bufferList, &physAddr))
+        {
+            return CPA_STATUS_FAIL;
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/*returns the descriptor in the metadata of a list*/
+static icp_buffer_list_desc_t *hostBuffDescGet(CpaBufferList *pList)
+{
+    return (icp_buffer_list_desc_t *)(
+        ((uintptr_t)pList->pPrivateMetaData +
+         ICP_DESCRIPTOR_ALIGNMENT_BYTES - 1) &
+        ~((uintptr_t)ICP_DESCRIPTOR_ALIGNMENT_BYTES - 1));
+}
+
+/*writes the descriptor of the registered list and checks that the firmware
+ * gets what a list built on every request gives*/
+static CpaStatus hostBuffDescCompare(host_buff_desc_t *pDesc)
+{
+    icp_buffer_list_desc_t *pListDesc = hostBuffDescGet(&pDesc->bufferList);
+    icp_buffer_list_desc_t *pRefDesc = hostBuffDescGet(&pDesc->refList);
+    Cpa64U physAddr = 0;
+    Cpa64U refPhysAddr = 0;
+
+    if (CPA_STATUS_SUCCESS !=
+            icp_sal_HostPerfBufferListDescWrite(
+                pDesc->instanceHandle, &pDesc->bufferList, &physAddr) ||
+        CPA_STATUS_SUCCESS !=
+            icp_sal_HostPerfBufferListDescWrite(
+                pDesc->instanceHandle, &pDesc->refList, &refPhysAddr))
+    {
+        PRINT_ERR("Could not write the buffer list descriptors\n");
+        return CPA_STATUS_FAIL;
+    }
+    if (physAddr != qaeVirtToPhysNUMA(pListDesc) ||
+        pListDesc->numBuffers != pRefDesc->numBuffers ||
+        0 != memcmp(pListDesc->phyBuffers,
+                    pRefDesc->phyBuffers,
+                    pDesc->bufferList.numBuffers *
+                        sizeof(icp_flat_buffer_desc_t)))
+    {
+        PRINT_ERR("Registered descriptor of %u buffers differs from a "
+                  "rebuilt one\n",
+                  pDesc->bufferList.numBuffers);
+        return CPA_STATUS_FAIL;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/*checks a registered list right after the registration, on a later request
+ * with new buffer lengths, after the application moves a buffer and back
+ * again, which the list must notice by itself, and after a move followed by
+ * an invalidation*/
+static CpaStatus hostBuffDescCheck(host_buff_desc_t *pDesc)
+{
+    CpaFlatBuffer *pLast =
+        &pDesc->flatBuffers[pDesc->bufferList.numBuffers - 1];
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    status =
+        icp_sal_BufferListRegister(pDesc->instanceHandle, &pDesc->bufferList);
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        PRINT_ERR("Could not register the buffer list\n");
+        return status;
+    }
+    status = hostBuffDescCompare(pDesc);
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        pLast->dataLenInBytes = HOST_BUFF_DESC_FRAG_SIZE / 2;
+        status = hostBuffDescCompare(pDesc);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        pLast->pData += HOST_BUFF_DESC_FRAG_SIZE / 2;
+        status = hostBuffDescCompare(pDesc);
+        pLast->pData -= HOST_BUFF_DESC_FRAG_SIZE / 2;
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        status = hostBuffDescCompare(pDesc);
+    }
+    if (CPA_STATUS_SUCCESS == status)
+    {
+        pLast->pData += HOST_BUFF_DESC_FRAG_SIZE / 2;
+        status = icp_sal_BufferListInvalidate(&pDesc->bufferList);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = hostBuffDescCompare(pDesc);
+        }
+        pLast->pData -= HOST_BUFF_DESC_FRAG_SIZE / 2;
+    }
+    pLast->dataLenInBytes = HOST_BUFF_DESC_FRAG_SIZE;
+    icp_sal_BufferListDeregister(&pDesc->bufferList);
+    return status;
+}
+
+CpaStatus hostBufferDescPerf(void)
+{
+    const Cpa32U numFrags[] = {1, 4, 16, HOST_BUFF_DESC_MAX_FRAGS};
+    host_buff_desc_t *pDesc = NULL;
+    Cpa32U metaSize = sizeof(icp_buffer_list_desc_t) +
+                      sizeof(icp_flat_buffer_desc_t) *
+                          HOST_BUFF_DESC_MAX_FRAGS +
+                      ICP_DESCRIPTOR_ALIGNMENT_BYTES;
+    char name[HOST_PERF_NAME_LEN];
+    Cpa64U opsPerSec = 0;
+    Cpa64U regOpsPerSec = 0;
+    Cpa64U cpuFreq = sampleCodeGetCpuFreq();
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    pDesc = hostPerfZalloc(sizeof(host_buff_desc_t), "buffer list");
+    if (NULL == pDesc)
+    {
+        return CPA_STATUS_FAIL;
+    }
+    pDesc->instanceHandle = icp_sal_HostPerfInstanceGet();
+    pDesc->bufferList.pBuffers = pDesc->flatBuffers;
+    pDesc->refList.pBuffers = pDesc->flatBuffers;
+    pDesc->bufferList.pPrivateMetaData =
+        qaeMemAllocNUMA(metaSize, 0, HOST_BUFF_DESC_ALIGNMENT);
+    pDesc->refList.pPrivateMetaData =
+        qaeMemAllocNUMA(metaSize, 0, HOST_BUFF_DESC_ALIGNMENT);
+    if (NULL == pDesc->bufferList.pPrivateMetaData ||
+        NULL == pDesc->refList.pPrivateMetaData)
+    {
+        PRINT_ERR("Could not allocate the buffer list metadata\n");
+        status = CPA_STATUS_FAIL;
+    }
+    for (i = 0; i < HOST_BUFF_DESC_MAX_FRAGS && CPA_STATUS_SUCCESS == status;
+         i++)
+    {
+        pDesc->flatBuffers[i].dataLenInBytes = HOST_BUFF_DESC_FRAG_SIZE;
+        pDesc->flatBuffers[i].pData = qaeMemAllocNUMA(
+            HOST_BUFF_DESC_FRAG_SIZE, 0, HOST_BUFF_DESC_ALIGNMENT);
+        if (NULL == pDesc->flatBuffers[i].pData)
+        {
+            PRINT_ERR("Could not allocate the flat buffers\n");
+            status = CPA_STATUS_FAIL;
+        }
+    }
+
+    for (i = 0; i < sizeof(numFrags) / sizeof(numFrags[0]) &&
+                CPA_STATUS_SUCCESS == status;
+         i++)
+    {
+        pDesc->bufferList.numBuffers = numFrags[i];
+        pDesc->refList.numBuffers = numFrags[i];
+        status = hostBuffDescCheck(pDesc);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            break;
+        }
+
+        snprintf(name, sizeof(name), "Buffer desc %u frags", numFrags[i]);
+        status = hostPerfRunThreads(name,
+                                    1,
+                                    HOST_BUFF_DESC_OPS,
+                                    hostBuffDescThread,
+                                    pDesc,
+                                    &opsPerSec);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            break;
+        }
+        snprintf(
+            name, sizeof(name), "Buffer desc %u frags reg", numFrags[i]);
+        status = icp_sal_BufferListRegister(pDesc->instanceHandle,
+                                            &pDesc->bufferList);
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = hostPerfRunThreads(name,
+                                        1,
+                                        HOST_BUFF_DESC_OPS,
+                                        hostBuffDescThread,
+                                        pDesc,
+                                        &regOpsPerSec);
+            icp_sal_BufferListDeregister(&pDesc->bufferList);
+        }
+        if (CPA_STATUS_SUCCESS != status || 0 == opsPerSec ||
+            0 == regOpsPerSec)
+        {
+            break;
+        }
+        /*the CPU frequency is in kHz*/
+        PRINT("Buffer desc %u frags: registration saves %lld cycles per "
+              "request\n",
+              numFrags[i],
+              (long long)(cpuFreq * 1000 / opsPerSec) -
+                  (long long)(cpuFreq * 1000 / regOpsPerSec));
+    }
+
+    for (i = 0; i < HOST_BUFF_DESC_MAX_FRAGS; i++)
+    {
+        if (NULL != pDesc->flatBuffers[i].pData)
+        {
+            qaeMemFreeNUMA((void **)&pDesc->flatBuffers[i].pData);
+        }
+    }
+    if (NULL != pDesc->refList.pPrivateMetaData)
+    {
+        qaeMemFreeNUMA((void **)&pDesc->refList.pPrivateMetaData);
+    }
+    if (NULL != pDesc->bufferList.pPrivateMetaData)
+    {
+        qaeMemFreeNUMA((void **)&pDesc->bufferList.pPrivateMetaData);
+    }
+    qaeMemFree((void **)&pDesc);
+    return status;
+}
@@ -0,0 +1,455 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_host_perf.c
+ *
+ * @ingroup sampleHostPerf
+ *
+ * @description
+ *     Thread runners and fixture helpers of the host side benchmarks, and
+ *     the memory pool alloc/free benchmark.
+ *
+ *****************************************************************************/
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "cpa_sample_code_host_perf.h"
+#include "icp_sal_host_perf.h"
+#include "qae_mem.h"
+
+/*default CyNumConcurrentSymRequests, CyNumConcurrentAsymRequests and
+ * NumConcurrentRequests of the config files*/
+#define HOST_PERF_SYM_CONCURRENT_REQ (512)
+#define HOST_PERF_ASYM_CONCURRENT_REQ (64)
+#define HOST_PERF_DC_CONCURRENT_REQ (512)
+
+/*operations per thread of the pool benchmark, each is an alloc and a free*/
+#define HOST_PERF_POOL_OPS (200000)
+
+/*number of entries a pool benchmark thread holds at once*/
+#define HOST_PERF_POOL_DEPTH (4)
+
+/*longest printed number of cache misses per operation*/
+#define HOST_PERF_MISSES_LEN (24)
+
+/* Data of a thread started by hostPerfRunThreads */
+typedef struct host_perf_thread_s
+{
+    host_perf_func_t func;
+    void *pArg;
+    Cpa32U threadIndex;
+    Cpa32U numOps;
+    volatile Cpa32U *pGo;
+    perf_cycles_t startCycles;
+    perf_cycles_t endCycles;
+    /*last level cache misses of the thread, valid if hasCacheMisses*/
+    Cpa64U cacheMisses;
+    CpaBoolean hasCacheMisses;
+    CpaStatus status;
+} host_perf_thread_t;
+
+/*opens a counter of the last level cache misses of the calling thread in
+ * user space, returns -1 where the kernel or the CPU does not expose it*/
+static int hostPerfCacheMissOpen(void)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void hostPerfThread(void *pArg)
+{
+    host_perf_thread_t *pThread = (host_perf_thread_t *)pArg;
+    int missFd = -1;
+
+    /*wait for all threads to be created so that they run together*/
+    while (0 == *pThread->pGo)
+    {
+        sched_yield();
+    }
+    missFd = hostPerfCacheMissOpen();
+    pThread->startCycles = sampleCodeTimestamp();
+    pThread->status =
+        pThread->func(pThread->pArg, pThread->threadIndex, pThread->numOps);
+    pThread->endCycles = sampleCodeTimestamp();
+    if (0 <= missFd)
+    {
+        if (sizeof(pThread->cacheMisses) == read(missFd,
+                                                 &pThread->cacheMisses,
+                                                 sizeof(pThread->cacheMisses)))
+        {
+            pThread->hasCacheMisses = CPA_TRUE;
+        }
+        close(missFd);
+    }
+    sampleCodeThreadExit();
+}
+
+CpaStatus hostPerfRunThreads(const char *pName,
+                             Cpa32U numThreads,
+                             Cpa32U numOps,
+                             host_perf_func_t func,
+                             void *pArg,
+                             Cpa64U *pOpsPerSec)
+{
+    sample_code_thread_t threads[HOST_PERF_MAX_THREADS];
+    host_perf_thread_t data[HOST_PERF_MAX_THREADS];
+    volatile Cpa32U go = 0;
+    perf_cycles_t start = 0;
+    perf_cycles_t end = 0;
+    Cpa64U opsPerSec = 0;
+    Cpa64U cacheMisses = 0;
+    CpaBoolean hasCacheMisses = CPA_TRUE;
+    char missesPerOp[HOST_PERF_MISSES_LEN] = "n/a";
+    Cpa32U numCreated = 0;
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    if (0 == numThreads || HOST_PERF_MAX_THREADS < numThreads)
+    {
+        PRINT_ERR("numThreads %u is not in the range 1 to %u\n",
+                  numThreads,
+                  HOST_PERF_MAX_THREADS);
+        return CPA_STATUS_FAIL;
+    }
+    for (i = 0; i < numThreads; i++)
+    {
+        data[i].func = func;
+        data[i].pArg = pArg;
+        data[i].threadIndex = i;
+        data[i].numOps = numOps;
+        data[i].pGo = &go;
+        data[i].cacheMisses = 0;
+        data[i].hasCacheMisses = CPA_FALSE;
+        data[i].status = CPA_STATUS_FAIL;
+        if (CPA_STATUS_SUCCESS !=
+            sampleCodeThreadCreate(&threads[i], NULL, hostPerfThread, &data[i]))
+        {
+            PRINT_ERR("Could not create thread %u\n", i);
+            status = CPA_STATUS_FAIL;
+            break;
+        }
+        numCreated++;
+    }
+    go = 1;
+    for (i = 0; i < numCreated; i++)
+    {
+        sampleCodeThreadJoin(&threads[i]);
+    }
+    if (CPA_STATUS_SUCCESS != status)
+    {
+        return status;
+    }
+
+    /*the run lasts from the first start to the last end of any thread*/
+    start = data[0].startCycles;
+    end = data[0].endCycles;
+    for (i = 0; i < numThreads; i++)
+    {
+        if (CPA_STATUS_SUCCESS != data[i].status)
+        {
+            PRINT_ERR("%s thread %u failed\n", pName, i);
+            status = CPA_STATUS_FAIL;
+        }
+        if (data[i].startCycles < start)
+        {
+            start = data[i].startCycles;
+        }
+        if (data[i].endCycles > end)
+        {
+            end = data[i].endCycles;
+        }
+        cacheMisses += data[i].cacheMisses;
+        if (CPA_TRUE != data[i].hasCacheMisses)
+        {
+            hasCacheMisses = CPA_FALSE;
+        }
+    }
+    if (end > start)
+    {
+        /*the CPU frequency is in kHz*/
+        opsPerSec = ((Cpa64U)numThreads * numOps * sampleCodeGetCpuFreq() *
+                     1000) /
+                    (end - start);
+    }
+    if (CPA_TRUE == hasCacheMisses)
+    {
+        /*misses per operation with two decimals*/
+        cacheMisses = (cacheMisses * 100) / ((Cpa64U)numThreads * numOps);
+        snprintf(missesPerOp,
+                 sizeof(missesPerOp),
+                 "%llu.%02llu",
+                 (unsigned long long)(cacheMisses / 100),
+                 (unsigned long long)(cacheMisses % 100));
+    }
+    PRINT("%-28s threads %2u ops/sec %12llu cycles/op %8llu misses/op %s\n",
+          pName,
+          numThreads,
+          (unsigned long long)opsPerSec,
+          (unsigned long long)((end - start) / numOps),
+          missesPerOp);
+    if (NULL != pOpsPerSec)
+    {
+        *pOpsPerSec = opsPerSec;
+    }
+    return status;
+}
+
+CpaStatus hostPerfRunScaling(const host_perf_run_t *pRun)
+{
+    Cpa32U t = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    for (t = 1; t <= pRun->maxThreads && CPA_STATUS_SUCCESS == status;
+         t *= pRun->threadsMul)
+    {
+        if (NULL != pRun->setUp)
+        {
+            status = pRun->setUp(pRun->pArg, t);
+        }
+        if (CPA_STATUS_SUCCESS == status)
+        {
+            status = hostPerfRunThreads(
+                pRun->pName, t, pRun->numOps, pRun->func, pRun->pArg, NULL);
+        }
+        if (CPA_STATUS_SUCCESS == status && NULL != pRun->check)
+        {
+            status = pRun->check(pRun->pArg, t);
+        }
+    }
+    return status;
+}
+
+void *hostPerfZalloc(Cpa32U size, const char *pWhat)
+{
+    void *pMem = qaeMemAlloc(size);
+
+    if (NULL == pMem)
+    {
+        PRINT_ERR("Could not allocate the %s\n", pWhat);
+        return NULL;
+    }
+    memset(pMem, 0, size);
+    return pMem;
+}
+
+/* Pool of the pool benchmark */
+typedef struct host_mem_pool_s
+{
+    const char *pName;
+    void *pPool;
+    Cpa32U numEntries;
+} host_mem_pool_t;
+
+static CpaStatus hostMemPoolThread(void *pArg,
+                                   Cpa32U threadIndex,
+                                   Cpa32U numOps)
+{
+    void *pPool = ((host_mem_pool_t *)pArg)->pPool;
+    void *pEntries[HOST_PERF_POOL_DEPTH] = {NULL};
+    Cpa32U i = 0;
+    Cpa32U j = 0;
+    Cpa32U retries = 0;
+
+    /*keep a few entries in flight as a service thread with requests on the
+     * ring does, so that allocs and frees interleave*/
+    for (i = 0; i < numOps; i++)
+    {
+        j = i % HOST_PERF_POOL_DEPTH;
+        if (NULL != pEntries[j])
+        {
+            icp_sal_HostPerfPoolFree(pEntries[j]);
+        }
+        while (NULL == (pEntries[j] = icp_sal_HostPerfPoolAlloc(pPool)))
+        {
+            /*other threads hold every entry, they free them in a moment*/
+            if (++retries > numOps)
+            {
+                PRINT_ERR("Pool stayed empty for thread %u\n", threadIndex);
+                return CPA_STATUS_FAIL;
+            }
+            sched_yield();
+        }
+    }
+    for (j = 0; j < HOST_PERF_POOL_DEPTH; j++)
+    {
+        if (NULL != pEntries[j])
+        {
+            icp_sal_HostPerfPoolFree(pEntries[j]);
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/*the threads flushed their magazines on exit, every entry must be back*/
+static CpaStatus hostMemPoolCheck(void *pArg, Cpa32U numThreads)
+{
+    host_mem_pool_t *pPool = (host_mem_pool_t *)pArg;
+    Cpa32U available = icp_sal_HostPerfPoolAvailable(pPool->pPool);
+
+    if (available != pPool->numEntries)
+    {
+        PRINT_ERR("%s lost entries with %u threads: %u of %u available\n",
+                  pPool->pName,
+                  numThreads,
+                  available,
+                  pPool->numEntries);
+        return CPA_STATUS_FAIL;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus hostMemPoolPerf(void)
+{
+    struct
+    {
+        const char *pName;
+        icp_sal_host_perf_pool_t type;
+        Cpa32U numConcurrentReq;
+    } pools[] = {{"Mem pool sym cookie",
+                  ICP_SAL_HOST_PERF_POOL_SYM_COOKIE,
+                  HOST_PERF_SYM_CONCURRENT_REQ},
+                 {"Mem pool asym request",
+                  ICP_SAL_HOST_PERF_POOL_ASYM_REQUEST,
+                  HOST_PERF_ASYM_CONCURRENT_REQ},
+                 {"Mem pool dc cookie",
+                  ICP_SAL_HOST_PERF_POOL_DC_COOKIE,
+                  HOST_PERF_DC_CONCURRENT_REQ}};
+    host_mem_pool_t pool = {0};
+    host_perf_run_t run = {0};
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    run.maxThreads = HOST_PERF_MAX_THREADS;
+    run.threadsMul = 2;
+    run.numOps = HOST_PERF_POOL_OPS;
+    run.func = hostMemPoolThread;
+    run.check = hostMemPoolCheck;
+    run.pArg = &pool;
+    for (i = 0; i < sizeof(pools) / sizeof(pools[0]); i++)
+    {
+        status = icp_sal_HostPerfPoolCreate(pools[i].type,
+                                            pools[i].numConcurrentReq,
+                                            &pool.pPool,
+                                            &pool.numEntries);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            PRINT_ERR("Could not create the %s pool\n", pools[i].pName);
+            return status;
+        }
+        pool.pName = pools[i].pName;
+        run.pName = pools[i].pName;
+        status = hostPerfRunScaling(&run);
+        icp_sal_HostPerfPoolDestroy(pool.pPool);
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            return status;
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus runHostPerfTests(void)
+{
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    if (CPA_STATUS_SUCCESS != hostMemPoolPerf())
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS != hostUsdmAllocPerf())
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS != hostUsdmTracePerf())
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS != hostUsdmV2PPerf())
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS != hostStatsPerf())
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS != hostSessionPerf())
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS != hostBufferDescPerf())
+    {
+        status = CPA_STATUS_FAIL;
+    }
+    return status;
+}
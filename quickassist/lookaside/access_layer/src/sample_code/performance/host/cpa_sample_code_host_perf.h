@@ -0,0 +1,312 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ ***************************************************************************
+ * @file cpa_sample_code_host_perf.h
+ *
+ * @defgroup sampleHostPerf
+ *
+ * @ingroup sampleCode
+ *
+ * @description
+ *     Host side benchmarks of the driver. They call USDM and, through the
+ *     test only entry points of icp_sal_host_perf.h, the memory pool,
+ *     statistics, session and buffer list code of the access layer from 1
+ *     to HOST_PERF_MAX_THREADS threads. They do not need an acceleration
+ *     device or a started SAL.
+ *
+ ***************************************************************************/
+#ifndef CPA_SAMPLE_CODE_HOST_PERF_H
+#define CPA_SAMPLE_CODE_HOST_PERF_H
+#include "cpa.h"
+#include "cpa_sample_code_utils_common.h"
+
+/*largest number of threads a host benchmark runs*/
+#define HOST_PERF_MAX_THREADS (64)
+
+/*longest name of a benchmark*/
+#define HOST_PERF_NAME_LEN (48)
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      Body of a benchmark thread
+ * @description
+ *      Runs numOps operations of the benchmark in the calling thread.
+ *      threadIndex is in the range 0 to the number of threads - 1.
+ *
+ ****************************************************************************/
+typedef CpaStatus (*host_perf_func_t)(void *pArg,
+                                      Cpa32U threadIndex,
+                                      Cpa32U numOps);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostPerfRunThreads
+ *
+ * @description
+ *      Runs func in numThreads threads, each doing numOps operations, from a
+ *      common start, and prints the total ops/sec, the cycles per
+ *      operation of one thread and the last level cache misses per
+ *      operation. The misses are printed as n/a where the kernel does not
+ *      give access to the CPU counters.
+ *
+ * @param[in]  pName        name of the benchmark, printed with the result
+ * @param[in]  numThreads   number of threads, 1 to HOST_PERF_MAX_THREADS
+ * @param[in]  numOps       number of operations per thread
+ * @param[in]  func         body of the threads
+ * @param[in]  pArg         argument passed to func
+ * @param[out] pOpsPerSec   total ops/sec of all threads, may be NULL
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_FAIL          A thread failed or could not be created.
+ *
+ *************************************************************************/
+CpaStatus hostPerfRunThreads(const char *pName,
+                             Cpa32U numThreads,
+                             Cpa32U numOps,
+                             host_perf_func_t func,
+                             void *pArg,
+                             Cpa64U *pOpsPerSec);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      Step of a scaling run
+ * @description
+ *      Called with the argument of the run and the number of threads
+ *      before or after each hostPerfRunThreads of hostPerfRunScaling.
+ *
+ ****************************************************************************/
+typedef CpaStatus (*host_perf_step_t)(void *pArg, Cpa32U numThreads);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      Benchmark run at a growing number of threads
+ * @description
+ *      The benchmark runs with 1 thread, then with threadsMul times as many
+ *      threads as the run before, up to maxThreads.
+ *
+ ****************************************************************************/
+typedef struct host_perf_run_s
+{
+    /*name printed with the results*/
+    const char *pName;
+    /*largest number of threads, up to HOST_PERF_MAX_THREADS*/
+    Cpa32U maxThreads;
+    /*factor of the number of threads between two runs, 2 or more*/
+    Cpa32U threadsMul;
+    /*number of operations per thread*/
+    Cpa32U numOps;
+    /*body of the threads*/
+    host_perf_func_t func;
+    /*called before each run to reset the state, may be NULL*/
+    host_perf_step_t setUp;
+    /*called after each run to check the state, may be NULL*/
+    host_perf_step_t check;
+    /*argument passed to func, setUp and check*/
+    void *pArg;
+} host_perf_run_t;
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostPerfRunScaling
+ *
+ * @description
+ *      Runs a benchmark with hostPerfRunThreads at each number of threads
+ *      of pRun and stops at the first failed run, setUp or check.
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_FAIL          A run, setUp or check failed.
+ *
+ *************************************************************************/
+CpaStatus hostPerfRunScaling(const host_perf_run_t *pRun);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostPerfZalloc
+ *
+ * @description
+ *      Allocates size bytes of zeroed memory for the state of a benchmark
+ *      and prints an error naming pWhat if it cannot. Free the memory with
+ *      qaeMemFree.
+ *
+ *************************************************************************/
+void *hostPerfZalloc(Cpa32U size, const char *pWhat);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostMemPoolPerf
+ *
+ * @description
+ *      Measures the alloc/free rate of pools shaped like the sym, asym and
+ *      dc cookie pools of an instance.
+ *
+ *************************************************************************/
+CpaStatus hostMemPoolPerf(void);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostUsdmAllocPerf
+ *
+ * @description
+ *      Measures the qaeMemAllocNUMA/qaeMemFreeNUMA rate of sizes used for
+ *      request descriptors and data buffers.
+ *
+ *************************************************************************/
+CpaStatus hostUsdmAllocPerf(void);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostUsdmV2PPerf
+ *
+ * @description
+ *      Measures the qaeVirtToPhysNUMA and qaeVirtToPhysNUMABatch rate over
+ *      buffers that fit the translation cache and over a larger set. The
+ *      slabs are 4KB pages unless usdm_drv is loaded with huge pages.
+ *
+ *************************************************************************/
+CpaStatus hostUsdmV2PPerf(void);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostUsdmTracePerf
+ *
+ * @description
+ *      Replays a mixed-size alloc/free trace against USDM and reports the
+ *      ops/sec and the growth of the mapped memory. Build libusdm_drv with
+ *      ICP_USDM_NO_SIZE_CLASSES to replay it against the bitmap allocator.
+ *
+ *************************************************************************/
+CpaStatus hostUsdmTracePerf(void);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostStatsPerf
+ *
+ * @description
+ *      Measures the ops/sec of a submission loop from 1 to 32 threads with
+ *      no statistics, as with DISABLE_STATS, with one shared array of
+ *      atomics and with the sharded LacStats counters. Checks that the
+ *      sharded counters sum to the number of operations.
+ *
+ *************************************************************************/
+CpaStatus hostStatsPerf(void);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostSessionPerf
+ *
+ * @description
+ *      Prints the cache lines of the sym session descriptor touched by the
+ *      submit and by the completion of a full packet request, and how many
+ *      lines one side writes and the other touches. Then measures the
+ *      ops/sec and cache misses of those accesses with submit and
+ *      completion threads sharing one session.
+ *
+ *************************************************************************/
+CpaStatus hostSessionPerf(void);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      hostBufferDescPerf
+ *
+ * @description
+ *      Measures the SGL descriptor write of a request for lists of 1 to 32
+ *      buffers, built on every request and registered with
+ *      icp_sal_BufferListRegister, and prints the cycles the registration
+ *      saves. Checks first that a registered list gives the firmware the
+ *      same descriptor as a rebuilt one, also after its buffer lengths
+ *      change and after a buffer moves and the list is invalidated.
+ *
+ *************************************************************************/
+CpaStatus hostBufferDescPerf(void);
+
+/**
+ *****************************************************************************
+ * @ingroup sampleHostPerf
+ *      runHostPerfTests
+ *
+ * @description
+ *      Runs all host side benchmarks. Requires qaeMemInit to have been
+ *      called.
+ *
+ * @retval CPA_STATUS_SUCCESS       Function executed successfully.
+ * @retval CPA_STATUS_FAIL          A benchmark failed.
+ *
+ *************************************************************************/
+CpaStatus runHostPerfTests(void);
+
+#endif
@@ -0,0 +1,139 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_host_session_perf.c
+ *
+ * @ingroup sampleHostPerf
+ *
+ * @description
+ *     Benchmark of the accesses the traditional sym API makes to a session
+ *     descriptor on submit and on completion.
+ *
+ *****************************************************************************/
+#include "cpa_sample_code_host_perf.h"
+#include "icp_sal_host_perf.h"
+
+/*operations per thread of the session benchmark*/
+#define HOST_SESSION_OPS (1000000)
+
+/*largest number of threads of the session benchmark*/
+#define HOST_SESSION_MAX_THREADS (16)
+
+static CpaStatus hostSessionThread(void *pArg,
+                                   Cpa32U threadIndex,
+                                   Cpa32U numOps)
+{
+    Cpa32U i = 0;
+
+    /*even threads submit and odd threads complete, as the perform and the
+     * polling threads of an application sharing one session*/
+    for (i = 0; i < numOps; i++)
+    {
+        if (0 == threadIndex % 2)
+        {
+            icp_sal_HostPerfSessionSubmit(pArg);
+        }
+        else
+        {
+            icp_sal_HostPerfSessionComplete(pArg);
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus hostSessionPerf(void)
+{
+    icp_sal_host_perf_session_lines_t lines;
+    host_perf_run_t run = {0};
+    void *pSession = NULL;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    if (CPA_STATUS_SUCCESS != icp_sal_HostPerfSessionCreate(&pSession))
+    {
+        PRINT_ERR("Could not create the session descriptor\n");
+        return CPA_STATUS_FAIL;
+    }
+
+    /*the lines written by one side and touched by the other move between
+     * the cores of the submit and the completion threads*/
+    icp_sal_HostPerfSessionLinesGet(&lines);
+    PRINT("Session desc lines: submit %u (%u written), completion %u (%u "
+          "written), written by one and touched by the other %u\n",
+          lines.numSubmit,
+          lines.numSubmitWritten,
+          lines.numComplete,
+          lines.numCompleteWritten,
+          lines.numShared);
+
+    run.pName = "Session submit/complete";
+    run.maxThreads = HOST_SESSION_MAX_THREADS;
+    run.threadsMul = 2;
+    run.numOps = HOST_SESSION_OPS;
+    run.func = hostSessionThread;
+    run.pArg = pSession;
+    status = hostPerfRunScaling(&run);
+    icp_sal_HostPerfSessionDestroy(pSession);
+    return status;
+}
@@ -0,0 +1,231 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_host_stats_perf.c
+ *
+ * @ingroup sampleHostPerf
+ *
+ * @description
+ *     Contention benchmark of the service statistics counters.
+ *
+ *****************************************************************************/
+#include <string.h>
+#include "cpa_sample_code_host_perf.h"
+#include "cpa_cy_sym.h"
+#include "Osal.h"
+#include "icp_sal_host_perf.h"
+
+/*operations per thread of the stats benchmark*/
+#define HOST_STATS_OPS (1000000)
+
+/*largest number of threads of the stats benchmark*/
+#define HOST_STATS_MAX_THREADS (32)
+
+/*size of a request message, copied from a template for every operation*/
+#define HOST_STATS_MSG_SIZE (128)
+
+/*number of counters of the sym service*/
+#define HOST_STATS_NUM_STATS (sizeof(CpaCySymStats64) / sizeof(Cpa64U))
+
+/*counters bumped by every operation, one on submit and one on completion*/
+#define HOST_STATS_REQ_INDEX                                                   \
+    (offsetof(CpaCySymStats64, numSymOpRequests) / sizeof(Cpa64U))
+#define HOST_STATS_RESP_INDEX                                                  \
+    (offsetof(CpaCySymStats64, numSymOpCompleted) / sizeof(Cpa64U))
+
+/* How the operations of the benchmark are counted */
+typedef enum host_stats_mode_e
+{
+    /*as with DISABLE_STATS, the counting macros are empty*/
+    HOST_STATS_NONE = 0,
+    /*one array of atomics per instance, as before the stats were sharded*/
+    HOST_STATS_SHARED,
+    /*the sharded counters used by the services*/
+    HOST_STATS_SHARDED
+} host_stats_mode_t;
+
+/* Data shared by the stats benchmark threads */
+typedef struct host_stats_s
+{
+    host_stats_mode_t mode;
+    void *pSharded;
+    OsalAtomic shared[HOST_STATS_NUM_STATS];
+    Cpa8U msgTemplate[HOST_STATS_MSG_SIZE];
+} host_stats_t;
+
+static CpaStatus hostStatsThread(void *pArg,
+                                 Cpa32U threadIndex,
+                                 Cpa32U numOps)
+{
+    host_stats_t *pStats = (host_stats_t *)pArg;
+    Cpa8U msg[HOST_STATS_MSG_SIZE];
+    Cpa32U i = 0;
+
+    for (i = 0; i < numOps; i++)
+    {
+        /*stands in for the build of the request, so that the cost of the
+         * counters is seen against the rest of a submission*/
+        memcpy(msg, pStats->msgTemplate, sizeof(msg));
+        msg[0] = (Cpa8U)i;
+        /*keep the compiler from dropping the copy*/
+        __asm__ __volatile__("" : : "r"(msg) : "memory");
+        switch (pStats->mode)
+        {
+            case HOST_STATS_SHARED:
+                osalAtomicInc(&pStats->shared[HOST_STATS_REQ_INDEX]);
+                osalAtomicInc(&pStats->shared[HOST_STATS_RESP_INDEX]);
+                break;
+            case HOST_STATS_SHARDED:
+                icp_sal_HostPerfStatsInc(pStats->pSharded,
+                                         HOST_STATS_REQ_INDEX);
+                icp_sal_HostPerfStatsInc(pStats->pSharded,
+                                         HOST_STATS_RESP_INDEX);
+                break;
+            default:
+                break;
+        }
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+static CpaStatus hostStatsSetUp(void *pArg, Cpa32U numThreads)
+{
+    host_stats_t *pStats = (host_stats_t *)pArg;
+    Cpa32U i = 0;
+
+    icp_sal_HostPerfStatsReset(pStats->pSharded);
+    for (i = 0; i < HOST_STATS_NUM_STATS; i++)
+    {
+        osalAtomicSet(0, &pStats->shared[i]);
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+/*the counters must sum to the number of operations of all threads*/
+static CpaStatus hostStatsCheck(void *pArg, Cpa32U numThreads)
+{
+    host_stats_t *pStats = (host_stats_t *)pArg;
+    Cpa64U expected = (Cpa64U)numThreads * HOST_STATS_OPS;
+
+    if (HOST_STATS_SHARDED == pStats->mode &&
+        (expected !=
+             icp_sal_HostPerfStatsGet(pStats->pSharded, HOST_STATS_REQ_INDEX) ||
+         expected !=
+             icp_sal_HostPerfStatsGet(pStats->pSharded, HOST_STATS_RESP_INDEX)))
+    {
+        PRINT_ERR("Sharded stats do not sum to %llu\n",
+                  (unsigned long long)expected);
+        return CPA_STATUS_FAIL;
+    }
+    if (HOST_STATS_SHARED == pStats->mode &&
+        expected != osalAtomicGet(&pStats->shared[HOST_STATS_REQ_INDEX]))
+    {
+        PRINT_ERR("Shared stats do not sum to %llu\n",
+                  (unsigned long long)expected);
+        return CPA_STATUS_FAIL;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus hostStatsPerf(void)
+{
+    const char *names[] = {
+        "Stats disabled", "Stats shared atomics", "Stats sharded"};
+    host_stats_t *pStats = NULL;
+    host_perf_run_t run = {0};
+    Cpa32U mode = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    pStats = hostPerfZalloc(sizeof(host_stats_t), "stats");
+    if (NULL == pStats)
+    {
+        return CPA_STATUS_FAIL;
+    }
+    if (CPA_STATUS_SUCCESS !=
+        icp_sal_HostPerfStatsCreate(HOST_STATS_NUM_STATS, &pStats->pSharded))
+    {
+        PRINT_ERR("Could not allocate the sharded stats\n");
+        qaeMemFree((void **)&pStats);
+        return CPA_STATUS_FAIL;
+    }
+    run.maxThreads = HOST_STATS_MAX_THREADS;
+    run.threadsMul = 2;
+    run.numOps = HOST_STATS_OPS;
+    run.func = hostStatsThread;
+    run.setUp = hostStatsSetUp;
+    run.check = hostStatsCheck;
+    run.pArg = pStats;
+    for (mode = HOST_STATS_NONE;
+         mode <= HOST_STATS_SHARDED && CPA_STATUS_SUCCESS == status;
+         mode++)
+    {
+        pStats->mode = (host_stats_mode_t)mode;
+        run.pName = names[mode];
+        status = hostPerfRunScaling(&run);
+    }
+    icp_sal_HostPerfStatsDestroy(pStats->pSharded);
+    qaeMemFree((void **)&pStats);
+    return status;
+}
@@ -0,0 +1,456 @@
+/***************************************************************************
+ *
+ * This file is provided under a dual BSD/GPLv2 license.  When using or
+ *   redistributing this file, you may do so under either license.
+ * 
+ *   GPL LICENSE SUMMARY
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ * 
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of version 2 of the GNU General Public License as
+ *   published by the Free Software Foundation.
+ * 
+ *   This program is distributed in the hope that it will be useful, but
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   General Public License for more details.
+ * 
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+ *   The full GNU General Public License is included in this distribution
+ *   in the file called LICENSE.GPL.
+ * 
+ *   Contact Information:
+ *   Intel Corporation
+ * 
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ *
+ ***************************************************************************/
+
+/**
+ *****************************************************************************
+ * @file cpa_sample_code_host_usdm_perf.c
+ *
+ * @ingroup sampleHostPerf
+ *
+ * @description
+ *     Benchmarks of the user space DMA memory allocator.
+ *
+ *****************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "cpa_sample_code_host_perf.h"
+#include "qae_mem.h"
+
+extern CpaStatus qaeMemInit(void);
+extern void qaeMemDestroy(void);
+
+/*operations per thread of the alloc/free benchmark*/
+#define HOST_USDM_ALLOC_OPS (100000)
+
+/*number of blocks an alloc/free thread holds at once*/
+#define HOST_USDM_ALLOC_DEPTH (4)
+
+/*alignment requested by the driver for descriptors and buffers*/
+#define HOST_USDM_ALIGNMENT (64)
+
+/*node the benchmarks allocate on*/
+#define HOST_USDM_NODE (0)
+
+/*operations per thread of the trace replay, an alloc or a free each*/
+#define HOST_USDM_TRACE_OPS (100000)
+
+/*largest number of blocks a trace replay thread holds at once*/
+#define HOST_USDM_TRACE_LIVE (256)
+
+/*seed of the trace of the first thread, the others follow it*/
+#define HOST_USDM_TRACE_SEED (0x51ed270bU)
+
+/*translations per thread of the virt2phys benchmark*/
+#define HOST_USDM_V2P_OPS (1000000)
+
+/*addresses converted by one batch call, as a buffer list write does*/
+#define HOST_USDM_V2P_BATCH (16)
+
+/*buffers of the large working set, well beyond the translation cache*/
+#define HOST_USDM_V2P_MAX_BUFFERS (1024)
+
+/*USDM uses hugepage slabs when the module is loaded with huge pages*/
+#define HOST_USDM_HUGEPAGE_PARAM "/sys/module/usdm_drv/parameters/max_huge_pages"
+
+/* Data shared by the virt2phys benchmark threads */
+typedef struct host_usdm_v2p_s
+{
+    void *pVirt[HOST_USDM_V2P_MAX_BUFFERS];
+    Cpa32U numBuffers;
+    CpaBoolean batch;
+} host_usdm_v2p_t;
+
+/* Block held by a trace replay thread */
+typedef struct host_usdm_trace_blk_s
+{
+    Cpa8U *pData;
+    Cpa32U size;
+} host_usdm_trace_blk_t;
+
+static CpaStatus hostUsdmAllocThread(void *pArg,
+                                     Cpa32U threadIndex,
+                                     Cpa32U numOps)
+{
+    Cpa32U size = *(Cpa32U *)pArg;
+    void *pBlocks[HOST_USDM_ALLOC_DEPTH] = {NULL};
+    Cpa32U i = 0;
+    Cpa32U j = 0;
+
+    for (i = 0; i < numOps; i++)
+    {
+        j = i % HOST_USDM_ALLOC_DEPTH;
+        if (NULL != pBlocks[j])
+        {
+            qaeMemFreeNUMA(&pBlocks[j]);
+        }
+        pBlocks[j] = qaeMemAllocNUMA(size, HOST_USDM_NODE, HOST_USDM_ALIGNMENT);
+        if (NULL == pBlocks[j])
+        {
+            PRINT_ERR("Thread %u could not allocate %u bytes\n",
+                      threadIndex,
+                      size);
+            break;
+        }
+    }
+    for (j = 0; j < HOST_USDM_ALLOC_DEPTH; j++)
+    {
+        if (NULL != pBlocks[j])
+        {
+            qaeMemFreeNUMA(&pBlocks[j]);
+        }
+    }
+    return (i == numOps) ? CPA_STATUS_SUCCESS : CPA_STATUS_FAIL;
+}
+
+/* Next value of the trace generator, a fixed LCG so that every run and
+ * both allocators replay the same trace */
+static inline Cpa32U hostUsdmTraceRand(Cpa32U *pState)
+{
+    *pState = *pState * 1664525U + 1013904223U;
+    return *pState >> 8;
+}
+
+/* Size of the next allocation of the trace: mostly descriptors and small
+ * buffers with a tail of large data buffers */
+static Cpa32U hostUsdmTraceSize(Cpa32U *pState)
+{
+    Cpa32U r = hostUsdmTraceRand(pState) % 100;
+    Cpa32U v = hostUsdmTraceRand(pState);
+
+    if (r < 40)
+    {
+        return 64 + v % 960;
+    }
+    if (r < 65)
+    {
+        return 1024 + v % 3072;
+    }
+    if (r < 85)
+    {
+        return 4096 + v % 12288;
+    }
+    if (r < 95)
+    {
+        return 16384 + v % 49152;
+    }
+    return 65536 + v % 196608;
+}
+
+static CpaStatus hostUsdmTraceThread(void *pArg,
+                                     Cpa32U threadIndex,
+                                     Cpa32U numOps)
+{
+    host_usdm_trace_blk_t blks[HOST_USDM_TRACE_LIVE] = {{0}};
+    Cpa32U state = HOST_USDM_TRACE_SEED + threadIndex;
+    Cpa32U numLive = 0;
+    Cpa32U i = 0;
+    Cpa32U j = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    for (i = 0; i < numOps && CPA_STATUS_SUCCESS == status; i++)
+    {
+        /*grow to half the window, then alloc and free at random*/
+        if (numLive < HOST_USDM_TRACE_LIVE / 2 ||
+            (numLive < HOST_USDM_TRACE_LIVE &&
+             (hostUsdmTraceRand(&state) & 1)))
+        {
+            blks[numLive].size = hostUsdmTraceSize(&state);
+            blks[numLive].pData = qaeMemAllocNUMA(
+                blks[numLive].size, HOST_USDM_NODE, HOST_USDM_ALIGNMENT);
+            if (NULL == blks[numLive].pData)
+            {
+                PRINT_ERR("Thread %u could not allocate %u bytes\n",
+                          threadIndex,
+                          blks[numLive].size);
+                status = CPA_STATUS_FAIL;
+                break;
+            }
+            /*tag both ends to catch blocks handed out twice*/
+            blks[numLive].pData[0] = (Cpa8U)numLive;
+            blks[numLive].pData[blks[numLive].size - 1] = (Cpa8U)i;
+            blks[numLive].size |= (i & 0xFF) << 24;
+            numLive++;
+            continue;
+        }
+        j = hostUsdmTraceRand(&state) % numLive;
+        if (blks[j].pData[0] != (Cpa8U)j ||
+            blks[j].pData[(blks[j].size & 0xFFFFFF) - 1] !=
+                (Cpa8U)(blks[j].size >> 24))
+        {
+            PRINT_ERR("Thread %u block %p was overwritten\n",
+                      threadIndex,
+                      blks[j].pData);
+            status = CPA_STATUS_FAIL;
+        }
+        qaeMemFreeNUMA((void **)&blks[j].pData);
+        /*keep the live blocks packed, retagging the one that moves*/
+        numLive--;
+        if (j != numLive)
+        {
+            blks[j] = blks[numLive];
+            blks[j].pData[0] = (Cpa8U)j;
+        }
+    }
+    for (j = 0; j < numLive; j++)
+    {
+        qaeMemFreeNUMA((void **)&blks[j].pData);
+    }
+    return status;
+}
+
+/* Returns the virtual memory size of the process in pages */
+static Cpa64U hostUsdmVmPages(void)
+{
+    unsigned long long pages = 0;
+    FILE *pFile = fopen("/proc/self/statm", "r");
+
+    if (NULL != pFile)
+    {
+        if (1 != fscanf(pFile, "%llu", &pages))
+        {
+            pages = 0;
+        }
+        fclose(pFile);
+    }
+    return pages;
+}
+
+/*start from no slabs so that the growth is the peak of the run*/
+static CpaStatus hostUsdmTraceSetUp(void *pArg, Cpa32U numThreads)
+{
+    qaeMemDestroy();
+    if (CPA_STATUS_SUCCESS != qaeMemInit())
+    {
+        PRINT_ERR("Could not restart qae mem\n");
+        return CPA_STATUS_FAIL;
+    }
+    *(Cpa64U *)pArg = hostUsdmVmPages();
+    return CPA_STATUS_SUCCESS;
+}
+
+/*freed slabs stay mapped in the slab cache*/
+static CpaStatus hostUsdmTraceCheck(void *pArg, Cpa32U numThreads)
+{
+    PRINT("USDM mixed size trace        threads %2u mapped growth %llu "
+          "KB\n",
+          numThreads,
+          (unsigned long long)(hostUsdmVmPages() - *(Cpa64U *)pArg) *
+              (getpagesize() / 1024));
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus hostUsdmTracePerf(void)
+{
+    Cpa64U vmStart = 0;
+    host_perf_run_t run = {0};
+
+    run.pName = "USDM mixed size trace";
+    run.maxThreads = HOST_PERF_MAX_THREADS;
+    run.threadsMul = 4;
+    run.numOps = HOST_USDM_TRACE_OPS;
+    run.func = hostUsdmTraceThread;
+    run.setUp = hostUsdmTraceSetUp;
+    run.check = hostUsdmTraceCheck;
+    run.pArg = &vmStart;
+    return hostPerfRunScaling(&run);
+}
+
+static CpaStatus hostUsdmV2PThread(void *pArg,
+                                   Cpa32U threadIndex,
+                                   Cpa32U numOps)
+{
+    host_usdm_v2p_t *pV2P = (host_usdm_v2p_t *)pArg;
+    uint64_t phys[HOST_USDM_V2P_BATCH] = {0};
+    Cpa32U i = 0;
+    Cpa32U j = 0;
+
+    /*threads start at different buffers so that they do not run in step*/
+    j = (threadIndex * HOST_USDM_V2P_BATCH) % pV2P->numBuffers;
+    if (CPA_TRUE == pV2P->batch)
+    {
+        for (i = 0; i < numOps; i += HOST_USDM_V2P_BATCH)
+        {
+            if (0 != qaeVirtToPhysNUMABatch(
+                         &pV2P->pVirt[j], phys, HOST_USDM_V2P_BATCH))
+            {
+                PRINT_ERR("Thread %u could not convert a batch\n",
+                          threadIndex);
+                return CPA_STATUS_FAIL;
+            }
+            j = (j + HOST_USDM_V2P_BATCH) % pV2P->numBuffers;
+        }
+        return CPA_STATUS_SUCCESS;
+    }
+    for (i = 0; i < numOps; i++)
+    {
+        if (0 == qaeVirtToPhysNUMA(pV2P->pVirt[j]))
+        {
+            PRINT_ERR("Thread %u could not convert %p\n",
+                      threadIndex,
+                      pV2P->pVirt[j]);
+            return CPA_STATUS_FAIL;
+        }
+        j = (j + 1) % pV2P->numBuffers;
+    }
+    return CPA_STATUS_SUCCESS;
+}
+
+CpaStatus hostUsdmV2PPerf(void)
+{
+    /*within the translation cache, then spread over many pages*/
+    Cpa32U numBuffers[] = {HOST_USDM_V2P_BATCH, HOST_USDM_V2P_MAX_BUFFERS};
+    host_usdm_v2p_t *pV2P = NULL;
+    const char *pSlabs = "4KB";
+    char name[HOST_PERF_NAME_LEN] = {0};
+    FILE *pFile = NULL;
+    int hugePages = 0;
+    host_perf_run_t run = {0};
+    Cpa32U i = 0;
+    Cpa32U b = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    pFile = fopen(HOST_USDM_HUGEPAGE_PARAM, "r");
+    if (NULL != pFile)
+    {
+        if (1 == fscanf(pFile, "%d", &hugePages) && hugePages > 0)
+        {
+            pSlabs = "hugepage";
+        }
+        fclose(pFile);
+    }
+    pV2P = hostPerfZalloc(sizeof(host_usdm_v2p_t), "buffer list");
+    if (NULL == pV2P)
+    {
+        return CPA_STATUS_FAIL;
+    }
+    /*one page per buffer so that every buffer needs its own translation*/
+    for (i = 0; i < HOST_USDM_V2P_MAX_BUFFERS; i++)
+    {
+        pV2P->pVirt[i] =
+            qaeMemAllocNUMA(getpagesize(), HOST_USDM_NODE, getpagesize());
+        if (NULL == pV2P->pVirt[i])
+        {
+            PRINT_ERR("Could not allocate buffer %u\n", i);
+            status = CPA_STATUS_FAIL;
+            break;
+        }
+    }
+    run.pName = name;
+    run.maxThreads = HOST_PERF_MAX_THREADS;
+    run.threadsMul = 4;
+    run.numOps = HOST_USDM_V2P_OPS;
+    run.func = hostUsdmV2PThread;
+    run.pArg = pV2P;
+    /*each set is converted one address per call, then in batches*/
+    for (b = 0; b < 2 * sizeof(numBuffers) / sizeof(numBuffers[0]); b++)
+    {
+        if (CPA_STATUS_SUCCESS != status)
+        {
+            break;
+        }
+        pV2P->numBuffers = numBuffers[b >> 1];
+        pV2P->batch = (b & 1) ? CPA_TRUE : CPA_FALSE;
+        snprintf(name,
+                 sizeof(name),
+                 "V2P %s %s %u bufs",
+                 pSlabs,
+                 (CPA_TRUE == pV2P->batch) ? "batch" : "single",
+                 pV2P->numBuffers);
+        status = hostPerfRunScaling(&run);
+    }
+    for (i = 0; i < HOST_USDM_V2P_MAX_BUFFERS; i++)
+    {
+        if (NULL != pV2P->pVirt[i])
+        {
+            qaeMemFreeNUMA(&pV2P->pVirt[i]);
+        }
+    }
+    qaeMemFree((void **)&pV2P);
+    return status;
+}
+
+CpaStatus hostUsdmAllocPerf(void)
+{
+    /*descriptors, flat buffers and large data buffers*/
+    Cpa32U sizes[] = {64, 512, 2048, 8192, 65536};
+    char name[HOST_PERF_NAME_LEN] = {0};
+    host_perf_run_t run = {0};
+    Cpa32U i = 0;
+    CpaStatus status = CPA_STATUS_SUCCESS;
+
+    run.pName = name;
+    run.maxThreads = HOST_PERF_MAX_THREADS;
+    run.threadsMul = 2;
+    run.numOps = HOST_USDM_ALLOC_OPS;
+    run.func = hostUsdmAllocThread;
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]) &&
+                CPA_STATUS_SUCCESS == status;
+         i++)
+    {
+        snprintf(name, sizeof(name), "USDM alloc/free %u bytes", sizes[i]);
+        run.pArg = &sizes[i];
+        status = hostPerfRunScaling(&run);
+    }
+    return status;
+}
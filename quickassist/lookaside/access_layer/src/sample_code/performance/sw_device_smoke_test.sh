@@ -0,0 +1,133 @@
+#!/bin/bash
+
+###############################################################################
+#
+#   BSD LICENSE
+#
+#   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+#   All rights reserved.
+#
+#   Redistribution and use in source and binary forms, with or without
+#   modification, are permitted provided that the following conditions
+#   are met:
+#
+#     * Redistributions of source code must retain the above copyright
+#       notice, this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#       notice, this list of conditions and the following disclaimer in
+#       the documentation and/or other materials provided with the
+#       distribution.
+#     * Neither the name of Intel Corporation nor the names of its
+#       contributors may be used to endorse or promote products derived
+#       from this software without specific prior written permission.
+#
+#   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+#   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+#   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+#   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+#   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+#   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+#   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+#   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+#   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+#   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+#   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#  version: QAT1.7.L.4.5.0-00034
+#
+###############################################################################
+
+# Runs the compression, symmetric and asymmetric sample suites against the
+# software device (library and sample built with ICP_SW_DEVICE=y) and fails
+# on a crash, a non zero exit or any error reported by the sample or the
+# access layer.
+#
+# Usage: sw_device_smoke_test.sh [sample binary] [library directory]
+
+SAMPLE_BIN="${1:-build/linux_2.6/user_space/cpa_sample_code}"
+LIB_DIR="${2:-$ICP_BUILD_OUTPUT}"
+TIMEOUT_SECS="${TIMEOUT_SECS:-1200}"
+LOG_DIR=$(mktemp -d)
+
+# runTests masks: 32 compression, 1 symmetric, 2 RSA, 4 DSA, 8 ECDSA, 16 DH.
+# The symmetric suite runs again with host execution of requests on a busy
+# ring and on every request, set through the environment of the software
+# device, so its host fallback check compares host and device results
+suites=("32" "1" "1" "1" "2" "4" "8" "16")
+suite_names=("dc" "sym" "sym_host_busy" "sym_host_always" "rsa" "dsa" "ecdsa"
+             "dh")
+suite_env=("" ""
+           "ADF_SW_Cy0SymHostFallback=1 ADF_SW_Cy0SymHostFallbackThreshold=8"
+           "ADF_SW_Cy0SymHostFallback=2" "" "" "" "")
+
+# The software device rejects these algorithms. The sample prints the test
+# header once the test is done, so errors are matched with the next header
+# and the sample output is left unbuffered to keep it in order with them
+UNSUPPORTED_SYM="KASUMI|SNOW3G|ZUC|DES|ARC4|XCBC|CMAC|GCM|CCM"
+
+ERROR_PATTERN="\[error\]|fail|FAIL|Segmentation|Aborted|core dumped"
+
+CheckLog()
+{
+    log="$1"
+    allow="$2"
+
+    awk -v err="$ERROR_PATTERN" -v allow="$allow" '
+        /^(Algorithm|Cipher|Hash)/ {
+            if (n > 0 && (allow == "" || $0 !~ allow))
+            {
+                print n " error line(s) in: " $0
+                bad = 1
+            }
+            n = 0
+            next
+        }
+        $0 ~ err { n++ }
+        END {
+            if (n > 0)
+            {
+                print n " error line(s) after the last test"
+                bad = 1
+            }
+            exit bad
+        }' "$log"
+}
+
+if [ ! -x "$SAMPLE_BIN" ]; then
+    echo "ERROR: $SAMPLE_BIN not found, build the sample with ICP_SW_DEVICE=y"
+    exit 1
+fi
+
+result=0
+for i in "${!suites[@]}"; do
+    name="${suite_names[$i]}"
+    log="$LOG_DIR/$name.log"
+
+    env ${suite_env[$i]} LD_LIBRARY_PATH="$LIB_DIR:$LD_LIBRARY_PATH" \
+        timeout "$TIMEOUT_SECS" stdbuf -o0 "$SAMPLE_BIN" \
+        runTests="${suites[$i]}" signOfLife=1 > "$log" 2>&1
+    rc=$?
+
+    allow=""
+    if [[ "$name" == sym* ]]; then
+        allow="$UNSUPPORTED_SYM"
+    fi
+
+    if [ "$rc" != "0" ]; then
+        echo "$name: FAILED, exit status $rc, log in $log"
+        result=1
+    elif ! CheckLog "$log" "$allow"; then
+        echo "$name: FAILED, log in $log"
+        result=1
+    elif [[ "$name" == sym_host* ]] && ! grep -q "^Host fallback:" "$log"; then
+        echo "$name: FAILED, no request ran on the host, log in $log"
+        result=1
+    else
+        echo "$name: PASSED"
+    fi
+done
+
+if [ "$result" == "0" ]; then
+    rm -rf "$LOG_DIR"
+fi
+exit $result
@@ -206,6 +206,19 @@ with 512 pages of 4k page and 1k units this value is 32
 
 #define BLOCK_SIZES (BITMAP_LEN * QWORD_WIDTH)
 
+/*
+Blocks of 1, 2, 4 ... 64 units are size classes, freed blocks of a class
+are kept on a per slab free list and stay set in the bitmap.
+ICP_USDM_NO_SIZE_CLASSES serves every block from the bitmap, to compare
+the two allocators
+*/
+#define NUM_SIZE_CLASSES 7
+#ifdef ICP_USDM_NO_SIZE_CLASSES
+#define SIZE_CLASS_MAX_UNITS 0
+#else
+#define SIZE_CLASS_MAX_UNITS (1 << (NUM_SIZE_CLASSES - 1))
+#endif
+
 /*block control structure */
 typedef struct block_ctrl_s
 {
@@ -213,6 +226,9 @@ typedef struct block_ctrl_s
     /* adding an extra element at the end to make a barrier */
     uint64_t bitmap[BITMAP_LEN + 1]; /* bitmap each bit represents a 1k block */
     uint16_t sizes[BLOCK_SIZES]; /* Holds the size of each allocated block */
+    uint32_t node_index; /* Node slab list the slab is kept on */
+    /* First unit of the free list of each size class, 0 if empty */
+    uint16_t free_list[NUM_SIZE_CLASSES];
 } block_ctrl_t;
 
 /**
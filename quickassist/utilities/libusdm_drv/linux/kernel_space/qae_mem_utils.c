@@ -275,3 +275,25 @@ uint64_t qaeVirtToPhysNUMA(void* ptr)
     }
     return (uint64_t)(uintptr_t)virt_to_phys(ptr);
 }
+
+int32_t qaeVirtToPhysNUMABatch(void* pVirtAddr[],
+                               uint64_t pPhysAddr[],
+                               size_t numAddr)
+{
+    int32_t status = 0;
+    size_t i = 0;
+
+    if (!pVirtAddr || !pPhysAddr)
+    {
+        mm_err("%s:%d Input parameter cannot be NULL \n",
+               __func__,__LINE__);
+        return -EINVAL;
+    }
+    for (i = 0; i < numAddr; i++)
+    {
+        pPhysAddr[i] = qaeVirtToPhysNUMA(pVirtAddr[i]);
+        if (!pPhysAddr[i])
+            status = -EFAULT;
+    }
+    return status;
+}
@@ -100,7 +100,15 @@ STATIC int fd = -1;
                                    macro
 **************************************************************************/
 
+#ifndef ICP_SW_DEVICE
 #define QAE_MEM "/dev/usdm_drv"
+#else
+/* The software device has no usdm_drv module behind it, the handle only
+ * tracks that the process has been initialised. */
+#define QAE_MEM "/dev/null"
+/* Largest physical alignment qaeMemAllocNUMA accepts. */
+#define QAE_SW_MAX_ALIGN 0x400000UL
+#endif
 
 /**************************************************************************
     static variable
@@ -125,17 +133,96 @@ static slab_list_t g_slab_list[PAGE_SIZE] = {{0}};
 
 static int g_strict_node = 1;
 
+/* Number of node slab lists, higher nodes share a list */
+#define USDM_MAX_NODES 8
+
+/* Slabs with free blocks for one NUMA node */
+typedef struct
+{
 #ifndef ICP_WITHOUT_THREAD
+    pthread_mutex_t lock;
+#endif
+    dev_mem_info_t *head;
+    dev_mem_info_t *tail;
+} node_slab_list_t;
+
+#ifndef ICP_WITHOUT_THREAD
+/* The global mutex only protects slab creation and release, the slab cache,
+ * the large slab list and the file handle. Blocks in existing slabs are
+ * allocated and freed under the lock of the slab's node list, and the
+ * slab hash is read under g_hash_lock. */
 static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_rwlock_t g_hash_lock = PTHREAD_RWLOCK_INITIALIZER;
+static node_slab_list_t g_node_slabs[USDM_MAX_NODES] = {
+    [0 ... USDM_MAX_NODES - 1] = {PTHREAD_MUTEX_INITIALIZER, NULL, NULL}};
+#else
+static node_slab_list_t g_node_slabs[USDM_MAX_NODES] = {{0}};
 #endif
 
 static dev_mem_info_t *pUserCacheHead = NULL;
 static dev_mem_info_t *pUserCacheTail = NULL;
-static dev_mem_info_t *pUserMemListHead = NULL;
-static dev_mem_info_t *pUserMemListTail = NULL;
 static dev_mem_info_t *pUserLargeMemListHead = NULL;
 static dev_mem_info_t *pUserLargeMemListTail = NULL;
 
+/* Number of translations cached per thread, direct mapped by virtual page */
+#define USDM_V2P_CACHE_SIZE 64
+
+typedef struct
+{
+    uintptr_t page;
+    uint64_t phys;
+    uint64_t generation;
+} v2p_entry_t;
+
+/* Bumped whenever a slab is released, older cached translations are stale.
+ * Starts at 1 so that zeroed entries never match. */
+static volatile uint64_t g_v2p_generation = 1;
+/* Shift of the page size the translations are cached for */
+static uint32_t g_v2p_page_shift = PAGE_SHIFT;
+
+#ifdef ICP_WITHOUT_THREAD
+static v2p_entry_t g_v2p_cache[USDM_V2P_CACHE_SIZE] = {{0}};
+#else
+/* Per thread cache of freed blocks. Bin n holds blocks of 2^n up to
+ * 2^(n+1)-1 units, so any block of bin n can serve a request of 2^n units.
+ * Cached blocks stay allocated in their slab. */
+#define USDM_TC_NUM_BINS 11
+/* Maximum number of blocks cached per bin */
+#define USDM_TC_MAX_BLOCKS 16
+/* Maximum number of bytes cached per thread */
+#define USDM_TC_MAX_SIZE (512 * 1024)
+
+/* Header kept at the start of a cached block. The size slot of a cached
+ * block is cleared in its slab, so that a second free of the block is
+ * rejected, and is restored when the block leaves the cache. */
+typedef struct tc_blk_s
+{
+    struct tc_blk_s *next;
+    block_ctrl_t *slab;
+    int64_t node;
+    size_t units;
+} tc_blk_t;
+
+typedef struct
+{
+    tc_blk_t *bins[USDM_TC_NUM_BINS];
+    uint32_t counts[USDM_TC_NUM_BINS];
+    size_t size;
+    uint64_t generation;
+    v2p_entry_t v2p[USDM_V2P_CACHE_SIZE];
+} thread_cache_t;
+
+static pthread_key_t g_tc_key;
+/* Fast access to the cache of the thread, the key only frees it on exit */
+static __thread thread_cache_t *t_tc = NULL;
+static pthread_once_t g_tc_once = PTHREAD_ONCE_INIT;
+static int g_tc_key_valid = 0;
+/* Bumped when all slabs are released, stale thread caches are dropped */
+static volatile uint64_t g_tc_generation = 0;
+/* Set in a forked child until qaeOpenFd has reset the control structures */
+static volatile int g_fork_pending = 0;
+#endif
+
 
 static free_page_table_fptr_t free_page_table_fptr = free_page_table;
 static load_addr_fptr_t load_addr_fptr = load_addr;
@@ -168,35 +255,105 @@ static inline size_t div_round_up(const size_t n, const size_t d)
     return (n + d - 1) / d;
 }
 
+static inline int global_lock(void)
+{
+    int ret = mem_mutex_lock(&mutex);
+
+    if (unlikely(ret))
+    {
+        CMD_ERROR("%s:%d Error on thread mutex lock %s\n",
+                  __func__,
+                  __LINE__,
+                  strerror(ret));
+    }
+    return ret;
+}
+
+static inline void global_unlock(void)
+{
+    int ret = mem_mutex_unlock(&mutex);
+
+    if (unlikely(ret))
+    {
+        CMD_ERROR("%s:%d Error on thread mutex unlock %s\n",
+                  __func__,
+                  __LINE__,
+                  strerror(ret));
+    }
+}
+
+static inline void node_list_lock(node_slab_list_t *list)
+{
+#ifndef ICP_WITHOUT_THREAD
+    pthread_mutex_lock(&list->lock);
+#else
+    (void)list;
+#endif
+}
+
+static inline void node_list_unlock(node_slab_list_t *list)
+{
+#ifndef ICP_WITHOUT_THREAD
+    pthread_mutex_unlock(&list->lock);
+#else
+    (void)list;
+#endif
+}
+
+static inline uint32_t node_list_index(const int node)
+{
+    return (node < 0) ? 0 : (uint32_t)node % USDM_MAX_NODES;
+}
+
 static inline void add_slab_to_hash(dev_mem_info_t *slab)
 {
     const size_t key = get_key(slab->phy_addr);
 
+#ifndef ICP_WITHOUT_THREAD
+    pthread_rwlock_wrlock(&g_hash_lock);
+#endif
     ADD_ELEMENT_TO_HEAD_LIST(
         slab, g_slab_list[key].head, g_slab_list[key].tail, _user_hash);
+#ifndef ICP_WITHOUT_THREAD
+    pthread_rwlock_unlock(&g_hash_lock);
+#endif
 }
 static inline void del_slab_from_hash(dev_mem_info_t *slab)
 {
     const size_t key = get_key(slab->phy_addr);
 
+#ifndef ICP_WITHOUT_THREAD
+    pthread_rwlock_wrlock(&g_hash_lock);
+#endif
     REMOVE_ELEMENT_FROM_LIST(
         slab, g_slab_list[key].head, g_slab_list[key].tail, _user_hash);
+#ifndef ICP_WITHOUT_THREAD
+    pthread_rwlock_unlock(&g_hash_lock);
+#endif
 }
 
+/* A slab found here stays valid while the caller owns a block in it */
 static inline dev_mem_info_t *find_slab_in_hash(void *virt_addr)
 {
     const size_t key = load_key_fptr(&g_page_table, virt_addr);
-    dev_mem_info_t *slab = g_slab_list[key].head;
+    dev_mem_info_t *slab = NULL;
 
+#ifndef ICP_WITHOUT_THREAD
+    pthread_rwlock_rdlock(&g_hash_lock);
+#endif
+    slab = g_slab_list[key].head;
     while (slab)
     {
         uintptr_t offs = (uintptr_t)virt_addr - (uintptr_t)slab->virt_addr;
         if (offs < slab->size)
-            return slab;
+            break;
         slab = slab->pNext_user_hash;
     }
+#ifndef ICP_WITHOUT_THREAD
+    pthread_rwlock_unlock(&g_hash_lock);
+#endif
 
-    return NULL;
+    return slab;
 }
 
 /* mem_ctzll function
@@ -217,6 +374,16 @@ static inline int32_t mem_ctzll(uint64_t bitmap_window)
     return QWORD_WIDTH;
 }
 
+static inline uint32_t floor_log2(const size_t n)
+{
+    return QWORD_WIDTH - 1 - __builtin_clzll(n);
+}
+
+static inline uint32_t ceil_log2(const size_t n)
+{
+    return (n <= 1) ? 0 : QWORD_WIDTH - __builtin_clzll(n - 1);
+}
+
 /* bitmap_read function
  * reads a 64-bit window from a BITMAP_LENx64-bit bitmap
  * starting from window_pos (0 <-> BITMAP_LENx64 -1)
@@ -359,43 +526,90 @@ static inline void set_bitmap(uint64_t *bitmap, const size_t index, size_t len)
     bitmap[qword] |= __bitmask[len];
 }
 
-/* mem_alloc function
- * mem_alloc allocates memory with min. size = UNIT_SIZE
- * block_ctrl points to a block_ctrl_t structure with virtual address
- * size is the requested number of bytes
- * minimum allocation size is UNIT_SIZE
- * returns a pointer to the newly allocated block
+/* free_list_pop function
+ * takes the first free block of a size class, the next link kept at the
+ * start of the block is cleared before the block is handed out
+ */
+static inline void *free_list_pop(block_ctrl_t *block_ctrl,
+                                  const uint32_t size_class)
+{
+    const uint16_t first_block = block_ctrl->free_list[size_class];
+    uint16_t *block = NULL;
+
+    if (0 == first_block)
+        return NULL;
+
+    block = (uint16_t *)((uint8_t *)block_ctrl + first_block * UNIT_SIZE);
+    block_ctrl->free_list[size_class] = *block;
+    *block = 0;
+    block_ctrl->sizes[first_block] = (uint16_t)(1 << size_class);
+    return block;
+}
+
+/* free_list_push function
+ * keeps a freed block of a size class for reuse, its bits stay set in the
+ * bitmap and its size is cleared so that a second free is ignored
+ */
+static inline void free_list_push(block_ctrl_t *block_ctrl,
+                                  const size_t first_block,
+                                  const uint32_t size_class)
+{
+    uint16_t *block =
+        (uint16_t *)((uint8_t *)block_ctrl + first_block * UNIT_SIZE);
+
+    *block = block_ctrl->free_list[size_class];
+    block_ctrl->free_list[size_class] = (uint16_t)first_block;
+    block_ctrl->sizes[first_block] = 0;
+}
+
+/* free_list_flush function
+ * returns all blocks on the free lists of a slab to the bitmap
+ * output: 1 if any block was returned, 0 otherwise
+ */
+static int free_list_flush(block_ctrl_t *block_ctrl)
+{
+    uint32_t size_class = 0;
+    int flushed = 0;
+
+    for (size_class = 0; size_class < NUM_SIZE_CLASSES; size_class++)
+    {
+        uint16_t first_block = block_ctrl->free_list[size_class];
+
+        while (first_block)
+        {
+            uint16_t *block =
+                (uint16_t *)((uint8_t *)block_ctrl + first_block * UNIT_SIZE);
+
+            clear_bitmap(block_ctrl->bitmap, first_block, 1 << size_class);
+            first_block = *block;
+            *block = 0;
+            flushed = 1;
+        }
+        block_ctrl->free_list[size_class] = 0;
+    }
+    return flushed;
+}
+
+/* bitmap_alloc function
+ * searches the bitmap for blocks_required contiguous free units
  * input: block_ctrl - pointer to the memory control block
- *        size - size requested in bytes
+ *        blocks_required - number of units requested
+ *        align - alignment of the first unit in units
  * output: pointer to the allocated area
  */
-static void *mem_alloc(block_ctrl_t *block_ctrl, size_t size, size_t align)
+static void *bitmap_alloc(block_ctrl_t *block_ctrl,
+                          const size_t blocks_required,
+                          const size_t align)
 {
-    uint64_t *bitmap = NULL;
+    uint64_t *bitmap = block_ctrl->bitmap;
     size_t window_pos = 0;
     void *retval = NULL;
     size_t blocks_found = 0;
     uint64_t bitmap_window = 0ULL;
-    size_t blocks_required = 0ULL;
     size_t first_block = 0;
     size_t width = 0;
     size_t width_ones = 0;
 
-    if (NULL == block_ctrl || 0 == size)
-    {
-        CMD_ERROR(" %s:%d invalid control block or size provided "
-                  "block_ctrl = %p and size = %d \n",
-                  __func__,
-                  __LINE__,
-                  block_ctrl,
-                  size);
-        return retval;
-    }
-
-    bitmap = block_ctrl->bitmap;
-
-    blocks_required = div_round_up(size, UNIT_SIZE);
-
     window_pos = 0;
     first_block = window_pos;
 
@@ -466,12 +680,64 @@ static void *mem_alloc(block_ctrl_t *block_ctrl, size_t size, size_t align)
     } while (window_pos < BITMAP_LEN * QWORD_WIDTH);
     return retval;
 }
+
+/* mem_alloc function
+ * mem_alloc allocates memory with min. size = UNIT_SIZE
+ * block_ctrl points to a block_ctrl_t structure with virtual address
+ * size is the requested number of bytes
+ * minimum allocation size is UNIT_SIZE
+ * sizes up to SIZE_CLASS_MAX_UNITS units without alignment are rounded up
+ * to a size class and reuse freed blocks of the class, other requests and
+ * empty free lists go to the bitmap
+ * returns a pointer to the newly allocated block
+ * input: block_ctrl - pointer to the memory control block
+ *        size - size requested in bytes
+ * output: pointer to the allocated area
+ */
+static void *mem_alloc(block_ctrl_t *block_ctrl, size_t size, size_t align)
+{
+    void *retval = NULL;
+    size_t blocks_required = 0ULL;
+    uint32_t size_class = 0;
+
+    if (NULL == block_ctrl || 0 == size)
+    {
+        CMD_ERROR(" %s:%d invalid control block or size provided "
+                  "block_ctrl = %p and size = %d \n",
+                  __func__,
+                  __LINE__,
+                  block_ctrl,
+                  size);
+        return retval;
+    }
+
+    blocks_required = div_round_up(size, UNIT_SIZE);
+
+    if (align <= 1 && blocks_required <= SIZE_CLASS_MAX_UNITS)
+    {
+        size_class = ceil_log2(blocks_required);
+        blocks_required = 1 << size_class;
+
+        retval = free_list_pop(block_ctrl, size_class);
+        if (NULL != retval)
+            return retval;
+    }
+
+    retval = bitmap_alloc(block_ctrl, blocks_required, align);
+    /* Free blocks of other classes may fill the gap that is needed */
+    if (NULL == retval && free_list_flush(block_ctrl))
+        retval = bitmap_alloc(block_ctrl, blocks_required, align);
+
+    return retval;
+}
 /*
  * deallocates previously allocated blocks
  * block_ctrl is a pointer to block_ctrl_t structure
  * block is a result from a previous mem_alloc call
+ * returns 0 if the block was allocated and is now free, -EINVAL if it is
+ * not an allocated block, e.g. on a second free of the same block
  */
-static void mem_free(block_ctrl_t *block_ctrl, void *block)
+static int mem_free(block_ctrl_t *block_ctrl, void *block)
 {
     size_t first_block = 0;
     uint32_t length = 0;
@@ -486,7 +752,7 @@ static void mem_free(block_ctrl_t *block_ctrl, void *block)
                   __LINE__,
                   block_ctrl,
                   block);
-        return;
+        return -EINVAL;
     }
 
     if ((uintptr_t)block % UNIT_SIZE)
@@ -496,7 +762,7 @@ static void mem_free(block_ctrl_t *block_ctrl, void *block)
                   __LINE__,
                   block,
                   UNIT_SIZE);
-        return;
+        return -EINVAL;
     }
 
     bitmap = block_ctrl->bitmap;
@@ -510,6 +776,14 @@ static void mem_free(block_ctrl_t *block_ctrl, void *block)
 
     length = block_ctrl->sizes[first_block];
 
+    /* Blocks on a free list and blocks freed already have no size */
+    if (0 == length)
+    {
+        CMD_ERROR(
+            "%s:%d Block %p is not allocated\n", __func__, __LINE__, block);
+        return -EINVAL;
+    }
+
     if (length + first_block > BITMAP_LEN * QWORD_WIDTH)
     {
         CMD_ERROR("%s:%d Invalid block address provided - "
@@ -519,17 +793,26 @@ static void mem_free(block_ctrl_t *block_ctrl, void *block)
                   __LINE__,
                   first_block,
                   length);
-        return;
+        return -EINVAL;
     }
-    /* clear bitmap from bitmap position (0<->BITMAP_LEN*64 - 1) for length*/
-    clear_bitmap(bitmap, first_block, length);
-
 #ifndef ICP_DISABLE_SECURE_MEM_FREE
     memset(block, 0, length * UNIT_SIZE);
 #endif
+
+    if (length <= SIZE_CLASS_MAX_UNITS && !(length & (length - 1)))
+    {
+        free_list_push(block_ctrl, first_block, floor_log2(length));
+        return 0;
+    }
+    /* clear bitmap from bitmap position (0<->BITMAP_LEN*64 - 1) for length*/
+    clear_bitmap(bitmap, first_block, length);
+    block_ctrl->sizes[first_block] = 0;
+    return 0;
 }
 
-static dev_mem_info_t *userMemLookupBySize(size_t size,
+/* Must be called with the lock of the node list held */
+static dev_mem_info_t *userMemLookupBySize(node_slab_list_t *list,
+                                           size_t size,
                                            int node,
                                            void **block,
                                            const size_t align)
@@ -537,7 +820,7 @@ static dev_mem_info_t *userMemLookupBySize(size_t size,
     dev_mem_info_t *pCurr = NULL;
     size_t link_num = 0;
 
-    for (pCurr = pUserMemListHead; pCurr != NULL; pCurr = pCurr->pNext_user)
+    for (pCurr = list->head; pCurr != NULL; pCurr = pCurr->pNext_user)
     {
         if (g_strict_node && (pCurr->nodeId != node))
         {
@@ -562,15 +845,20 @@ static dev_mem_info_t *userMemLookupBySize(size_t size,
     return NULL;
 }
 
+/* The slab is not on any list yet so no lock is needed, the caller adds it
+ * to the node list selected here once the first block is allocated. */
 static inline void *init_slab_and_alloc(block_ctrl_t *slab,
                                         const size_t size,
+                                        const int node,
                                         const size_t phys_align_unit)
 {
     const size_t last = slab->mem_info.size / CHUNK_SIZE;
-    dev_mem_info_t *p_ctrl_blk = &slab->mem_info;
     const size_t reserved = div_round_up(sizeof(block_ctrl_t), UNIT_SIZE);
     void *virt_addr = NULL;
 
+    /* a slab taken from the cache may still have blocks on free lists */
+    memset(slab->bitmap, 0, sizeof(slab->bitmap));
+    memset(slab->free_list, 0, sizeof(slab->free_list));
     /* initialise the bitmap to 1 for reserved blocks */
     slab->bitmap[0] = (1ULL << reserved) - 1;
     /* make a barrier to stop search at the end of the bitmap */
@@ -579,8 +867,8 @@ static inline void *init_slab_and_alloc(block_ctrl_t *slab,
     virt_addr = mem_alloc(slab, size, phys_align_unit);
     if (NULL != virt_addr)
     {
-        ADD_ELEMENT_TO_HEAD_LIST(
-            p_ctrl_blk, pUserMemListHead, pUserMemListTail, _user);
+        slab->node_index = node_list_index(node);
+        slab->mem_info.allocations = 1;
     }
     return virt_addr;
 }
@@ -619,6 +907,7 @@ static inline void free_slab(const int fd, dev_mem_info_t *slab)
     int ret = 0;
 
     del_slab_from_hash(slab);
+    g_v2p_generation++;
 
     memcpy(&memInfo, slab, sizeof(dev_mem_info_t));
     /* Need to disconnect from orignal chain */
@@ -641,6 +930,9 @@ static inline void free_slab(const int fd, dev_mem_info_t *slab)
     {
         hugepage_free_slab(&memInfo);
     }
+#ifdef ICP_SW_DEVICE
+    (void)fd;
+#else
     else
     {
         ret = mem_ioctl(fd, DEV_MEM_IOC_MEMFREE, &memInfo);
@@ -652,38 +944,194 @@ static inline void free_slab(const int fd, dev_mem_info_t *slab)
                       ret);
         }
     }
+#endif
 }
 
-static inline dev_mem_info_t *find_slab(const int fd,
-                                        const size_t size,
-                                        const int node,
-                                        void **addr,
-                                        const size_t align)
+/* Returns a block of a small slab, the slab goes back to the slab cache
+ * once its last block is freed. */
+static void free_block(block_ctrl_t *slab, void *block)
 {
-    dev_mem_info_t *slab = userMemLookupBySize(size, node, addr, align);
+    node_slab_list_t *list = &g_node_slabs[slab->node_index];
+    dev_mem_info_t *p_ctrl_blk = &slab->mem_info;
 
-    if (NULL == slab)
+    node_list_lock(list);
+    /* A block that was not allocated must not release the slab */
+    if (mem_free(slab, block))
     {
-        slab = pop_slab(node);
-        if (NULL != slab)
+        node_list_unlock(list);
+        return;
+    }
+    p_ctrl_blk->allocations -= 1;
+    if (p_ctrl_blk->allocations)
+    {
+        node_list_unlock(list);
+        return;
+    }
+    REMOVE_ELEMENT_FROM_LIST(p_ctrl_blk, list->head, list->tail, _user);
+    node_list_unlock(list);
+
+    if (global_lock())
+        return;
+    if (0 != push_slab(p_ctrl_blk))
+        free_slab(fd, p_ctrl_blk);
+    global_unlock();
+}
+
+#ifndef ICP_WITHOUT_THREAD
+/* Gives a block leaving the thread cache its size back in its slab and
+ * clears the header */
+static inline void tc_blk_size_restore(tc_blk_t *blk)
+{
+    block_ctrl_t *slab = blk->slab;
+    const size_t first =
+        (uintptr_t)((uint8_t *)blk - (uint8_t *)slab) / UNIT_SIZE;
+
+    slab->sizes[first] = (uint16_t)blk->units;
+    memset(blk, 0, sizeof(*blk));
+}
+
+static void tc_destroy(void *arg)
+{
+    thread_cache_t *tc = arg;
+    block_ctrl_t *slab = NULL;
+    tc_blk_t *blk = NULL;
+    uint32_t i = 0;
+
+    /* Blocks of a previous generation belong to slabs that are gone */
+    if (tc->generation == g_tc_generation)
+    {
+        for (i = 0; i < USDM_TC_NUM_BINS; i++)
         {
-            *addr = init_slab_and_alloc((block_ctrl_t *)slab, size, align);
-            if (NULL == *addr)
+            while (NULL != (blk = tc->bins[i]))
             {
-                CMD_ERROR("%s:%d Memory allocation failed Virtual address: %p "
-                          " Size: %x \n",
-                          __func__,
-                          __LINE__,
-                          slab,
-                          size);
-                free_slab(fd, slab);
-                return NULL;
+                tc->bins[i] = blk->next;
+                slab = blk->slab;
+                tc_blk_size_restore(blk);
+                free_block(slab, blk);
             }
         }
     }
-    return slab;
+    t_tc = NULL;
+    free(tc);
+}
+
+/* Only the forking thread survives in the child, so locks held by other
+ * threads are reinitialised and the next call resets the allocator. */
+static void usdm_atfork_child(void)
+{
+    uint32_t i = 0;
+
+    for (i = 0; i < USDM_MAX_NODES; i++)
+        pthread_mutex_init(&g_node_slabs[i].lock, NULL);
+    pthread_rwlock_init(&g_hash_lock, NULL);
+    g_tc_generation++;
+    g_fork_pending = 1;
+}
+
+static void tc_init_once(void)
+{
+    if (0 == pthread_key_create(&g_tc_key, tc_destroy))
+        g_tc_key_valid = 1;
+    if (pthread_atfork(NULL, NULL, usdm_atfork_child))
+    {
+        CMD_ERROR("%s:%d Unable to register fork handler\n", __func__, __LINE__);
+    }
+}
+
+static inline thread_cache_t *tc_get(void)
+{
+    thread_cache_t *tc = t_tc;
+
+    if (NULL != tc && tc->generation == g_tc_generation)
+        return tc;
+    if (!g_tc_key_valid)
+        return NULL;
+
+    tc = pthread_getspecific(g_tc_key);
+    if (NULL == tc)
+    {
+        tc = calloc(1, sizeof(thread_cache_t));
+        if (NULL == tc)
+            return NULL;
+        if (pthread_setspecific(g_tc_key, tc))
+        {
+            free(tc);
+            return NULL;
+        }
+        tc->generation = g_tc_generation;
+    }
+    else if (tc->generation != g_tc_generation)
+    {
+        memset(tc, 0, sizeof(thread_cache_t));
+        tc->generation = g_tc_generation;
+    }
+    t_tc = tc;
+    return tc;
+}
+
+/* Takes a block of at least size bytes from the thread cache */
+static inline void *tc_alloc(const size_t size, const int node)
+{
+    const size_t units = div_round_up(size, UNIT_SIZE);
+    const uint32_t bin = ceil_log2(units);
+    thread_cache_t *tc = NULL;
+    tc_blk_t *blk = NULL;
+
+    if (bin >= USDM_TC_NUM_BINS || NULL == (tc = tc_get()))
+        return NULL;
+
+    blk = tc->bins[bin];
+    if (NULL == blk || (g_strict_node && blk->node != node))
+        return NULL;
+
+    tc->bins[bin] = blk->next;
+    tc->counts[bin]--;
+    tc->size -= blk->units * UNIT_SIZE;
+    tc_blk_size_restore(blk);
+    return blk;
 }
 
+/* Keeps a freed block in the thread cache, returns 0 if it does not fit */
+static inline int tc_free(block_ctrl_t *slab, void *block)
+{
+    const size_t first =
+        (uintptr_t)((uint8_t *)block - (uint8_t *)slab) / UNIT_SIZE;
+    thread_cache_t *tc = NULL;
+    tc_blk_t *blk = block;
+    size_t units = 0;
+    uint32_t bin = 0;
+
+    if (g_fork_pending || (uintptr_t)block % UNIT_SIZE ||
+        first >= BLOCK_SIZES)
+        return 0;
+
+    units = slab->sizes[first];
+    if (0 == units)
+        return 0;
+    bin = floor_log2(units);
+    if (bin >= USDM_TC_NUM_BINS)
+        return 0;
+
+    tc = tc_get();
+    if (NULL == tc || tc->counts[bin] >= USDM_TC_MAX_BLOCKS ||
+        tc->size + units * UNIT_SIZE > USDM_TC_MAX_SIZE)
+        return 0;
+
+#ifndef ICP_DISABLE_SECURE_MEM_FREE
+    memset(block, 0, units * UNIT_SIZE);
+#endif
+    slab->sizes[first] = 0;
+    blk->slab = slab;
+    blk->node = slab->mem_info.nodeId;
+    blk->units = units;
+    blk->next = tc->bins[bin];
+    tc->bins[bin] = blk;
+    tc->counts[bin]++;
+    tc->size += units * UNIT_SIZE;
+    return 1;
+}
+#endif
+
 /**************************************
  * Memory functions
  *************************************/
@@ -718,10 +1166,16 @@ static inline int check_pid(void)
     return 0;
 }
 
+/* Must be called with the global mutex held */
 static inline int qaeOpenFd(void)
 {
     /* Check if it is a new process or child. */
     const int is_new_pid = check_pid();
+    uint32_t i = 0;
+
+#ifndef ICP_WITHOUT_THREAD
+    pthread_once(&g_tc_once, tc_init_once);
+#endif
 
     if (fd < 0 || is_new_pid)
     {
@@ -730,13 +1184,21 @@ static inline int qaeOpenFd(void)
         memset(&g_page_table, 0, sizeof(g_page_table));
         memset(&g_slab_list, 0, sizeof(g_slab_list));
         g_cache_size = 0;
+        g_v2p_generation++;
 
         pUserCacheHead = NULL;
         pUserCacheTail = NULL;
-        pUserMemListHead = NULL;
-        pUserMemListTail = NULL;
+        for (i = 0; i < USDM_MAX_NODES; i++)
+        {
+            g_node_slabs[i].head = NULL;
+            g_node_slabs[i].tail = NULL;
+        }
         pUserLargeMemListHead = NULL;
         pUserLargeMemListTail = NULL;
+#ifndef ICP_WITHOUT_THREAD
+        g_tc_generation++;
+        g_fork_pending = 0;
+#endif
 
         CMD_DEBUG("%s:%d Memory file handle is not initialized. "
                   "Initializing it now \n",
@@ -755,12 +1217,32 @@ static inline int qaeOpenFd(void)
             return -ENOENT;
         }
 
+#ifndef ICP_SW_DEVICE
         if (init_hugepages(fd))
             return -EIO;
+#endif
+        g_v2p_page_shift = hugepage_enabled() ? HUGEPAGE_SHIFT : PAGE_SHIFT;
     }
     return 0;
 }
 
+/* Opens the file handle unless it is already usable, so that the block
+ * allocation paths do not need the global mutex. */
+static inline int usdm_open_fd(void)
+{
+    int status = 0;
+
+#ifndef ICP_WITHOUT_THREAD
+    if (fd >= 0 && !g_fork_pending)
+        return 0;
+#endif
+    if (global_lock())
+        return -EIO;
+    status = qaeOpenFd();
+    global_unlock();
+    return status;
+}
+
 int32_t qaeMemInit()
 {
     int32_t fd_status = 0;
@@ -816,6 +1298,7 @@ static inline void reset_cache(const int fd)
 void qaeMemDestroy(void)
 {
     int ret = 0;
+    uint32_t i = 0;
 
     /* Free all of the chains */
     ret = mem_mutex_lock(&mutex);
@@ -828,20 +1311,31 @@ void qaeMemDestroy(void)
 
     /* release all control buffers */
     free_page_table_fptr(&g_page_table);
+    g_v2p_generation++;
     reset_cache(fd);
-    destroyList(fd, pUserMemListHead);
+    for (i = 0; i < USDM_MAX_NODES; i++)
+    {
+        node_list_lock(&g_node_slabs[i]);
+        destroyList(fd, g_node_slabs[i].head);
+        g_node_slabs[i].head = NULL;
+        g_node_slabs[i].tail = NULL;
+        node_list_unlock(&g_node_slabs[i]);
+    }
     destroyList(fd, pUserLargeMemListHead);
 
     pUserCacheHead = NULL;
     pUserCacheTail = NULL;
-    pUserMemListHead = NULL;
-    pUserMemListTail = NULL;
     pUserLargeMemListHead = NULL;
     pUserLargeMemListTail = NULL;
+#ifndef ICP_WITHOUT_THREAD
+    /* Blocks still held in thread caches are gone with their slabs */
+    g_tc_generation++;
+#endif
 
     /* Send ioctl to kernel space to remove block for this pid */
     if (fd > 0)
     {
+#ifndef ICP_SW_DEVICE
         ret = mem_ioctl(fd, DEV_MEM_IOC_RELEASE, NULL);
         if (ret)
         {
@@ -850,6 +1344,7 @@ void qaeMemDestroy(void)
                       __LINE__,
                       ret);
         }
+#endif
         close(fd);
         fd = -1;
     }
@@ -972,6 +1467,83 @@ static inline dev_mem_info_t *ioctl_alloc_slab(const int fd,
     return slab;
 }
 
+#ifdef ICP_SW_DEVICE
+/* Maps anonymous memory aligned on the next power of two of len, as the
+ * kernel driver would hand out physically aligned pages. */
+static void *sw_mmap_aligned(const size_t len)
+{
+    size_t align = QAE_PAGE_SIZE;
+    uintptr_t start = 0;
+    uintptr_t aligned = 0;
+    uint8_t *addr = NULL;
+
+    while (align < len && align < QAE_SW_MAX_ALIGN)
+        align <<= 1;
+
+    addr = qae_mmap(NULL,
+                    len + align,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE,
+                    -1,
+                    0);
+    if (MAP_FAILED == addr)
+        return NULL;
+
+    start = (uintptr_t)addr;
+    aligned = (start + align - 1) & ~(uintptr_t)(align - 1);
+    if (aligned > start)
+        munmap(addr, aligned - start);
+    munmap((void *)(aligned + len), start + align - aligned);
+
+    return mem_protect((void *)aligned, len);
+}
+
+/* Software device slabs: anonymous memory whose "physical" address is its
+ * virtual address, which is what the emulated rings dereference. Large
+ * slabs keep their header in a separate page as with the kernel driver. */
+static dev_mem_info_t *sw_alloc_slab(const size_t size,
+                                     const int node,
+                                     enum slabType type)
+{
+    dev_mem_info_t *slab = NULL;
+    void *data = NULL;
+
+    data = sw_mmap_aligned(size);
+    if (NULL == data)
+    {
+        CMD_ERROR("%s:%d mmap failed for software device slab\n",
+                  __func__,
+                  __LINE__);
+        return NULL;
+    }
+
+    if (SMALL == type)
+    {
+        slab = data;
+    }
+    else
+    {
+        slab = sw_mmap_aligned(getpagesize());
+        if (NULL == slab)
+        {
+            CMD_ERROR("%s:%d mmap failed for large slab header\n",
+                      __func__,
+                      __LINE__);
+            munmap(data, size);
+            return NULL;
+        }
+    }
+
+    slab->nodeId = node;
+    slab->size = size;
+    slab->type = type;
+    slab->virt_addr = data;
+    slab->phy_addr = (uintptr_t)data;
+
+    return slab;
+}
+#endif
+
 static inline dev_mem_info_t *alloc_slab(const int fd,
                                          const size_t size,
                                          const int node,
@@ -982,7 +1554,14 @@ static inline dev_mem_info_t *alloc_slab(const int fd,
     if (HUGE_PAGE == type)
         slab = hugepage_alloc_slab(size, node, type);
     else
+#ifdef ICP_SW_DEVICE
+    {
+        (void)fd;
+        slab = sw_alloc_slab(size, node, type);
+    }
+#else
         slab = ioctl_alloc_slab(fd, size, node, type);
+#endif
 
     /* Store a slab into the hash table for a fast lookup. */
     if (slab)
@@ -991,27 +1570,98 @@ static inline dev_mem_info_t *alloc_slab(const int fd,
     return slab;
 }
 
+/* Allocates from a slab taken from the slab cache or from a new slab */
+static void *alloc_from_new_slab(const size_t size,
+                                 const int node,
+                                 const size_t phys_align_unit)
+{
+    const size_t allocate_pages =
+        QAE_NUM_PAGES_PER_ALLOC * QAE_PAGE_SIZE / UNIT_SIZE;
+    const enum slabType mem_type = hugepage_enabled() ? HUGE_PAGE : SMALL;
+    dev_mem_info_t *p_ctrl_blk = NULL;
+    node_slab_list_t *list = NULL;
+    void *pVirtAddress = NULL;
+
+    if (global_lock())
+        return NULL;
+
+    p_ctrl_blk = pop_slab(node);
+    if (NULL == p_ctrl_blk)
+    {
+        /* Try to allocate memory as much as possible */
+        p_ctrl_blk = alloc_slab(fd, allocate_pages * UNIT_SIZE, node, mem_type);
+        if (NULL != p_ctrl_blk)
+        {
+            store_mmap_range(&g_page_table,
+                             p_ctrl_blk->virt_addr,
+                             p_ctrl_blk->phy_addr,
+                             p_ctrl_blk->size,
+                             hugepage_enabled());
+
+            if ((uintptr_t)p_ctrl_blk->virt_addr % QAE_PAGE_SIZE)
+            {
+                CMD_ERROR("%s:%d Bad virtual address alignment %lux %x %lux\n",
+                          __func__,
+                          __LINE__,
+                          (uintptr_t)p_ctrl_blk->virt_addr,
+                          QAE_NUM_PAGES_PER_ALLOC,
+                          QAE_PAGE_SIZE);
+                free_slab(fd, p_ctrl_blk);
+                p_ctrl_blk = NULL;
+            }
+        }
+    }
+    global_unlock();
+
+    if (NULL == p_ctrl_blk)
+        return NULL;
+
+    pVirtAddress = init_slab_and_alloc(
+        (block_ctrl_t *)p_ctrl_blk, size, node, phys_align_unit);
+    if (NULL == pVirtAddress)
+    {
+        CMD_ERROR("%s:%d Memory allocation failed Virtual address: %p "
+                  " Size: %x \n",
+                  __func__,
+                  __LINE__,
+                  p_ctrl_blk,
+                  size);
+        if (0 == global_lock())
+        {
+            free_slab(fd, p_ctrl_blk);
+            global_unlock();
+        }
+        return NULL;
+    }
+
+    list = &g_node_slabs[((block_ctrl_t *)p_ctrl_blk)->node_index];
+    node_list_lock(list);
+    ADD_ELEMENT_TO_HEAD_LIST(p_ctrl_blk, list->head, list->tail, _user);
+    node_list_unlock(list);
+
+    return pVirtAddress;
+}
+
 static inline void *alloc_addr(size_t size,
                                const int node,
                                const size_t phys_alignment_byte)
 {
     dev_mem_info_t *p_ctrl_blk = NULL;
+    node_slab_list_t *list = NULL;
     void *pVirtAddress = NULL;
     size_t allocate_pages = 0;
-    enum slabType mem_type = SMALL;
 
     const size_t phys_align_unit = phys_alignment_byte / UNIT_SIZE;
     const size_t reserved = div_round_up(sizeof(block_ctrl_t), UNIT_SIZE);
     /* calculate units needed */
     const size_t requested_pages = div_round_up(size, UNIT_SIZE) + reserved;
 
-    if (0 != qaeOpenFd())
+    if (0 != usdm_open_fd())
         return NULL;
 
     if (requested_pages > QAE_NUM_PAGES_PER_ALLOC * QAE_PAGE_SIZE / UNIT_SIZE ||
         phys_alignment_byte >= QAE_NUM_PAGES_PER_ALLOC * QAE_PAGE_SIZE)
     {
-        mem_type = LARGE;
         /* Huge page and Large memory are mutually exclusive
          * Since Large slabs are NOT 2 MB aligned, but huge
          * pages are always 2 MB aligned.
@@ -1021,80 +1671,60 @@ static inline void *alloc_addr(size_t size,
 
         size = MAX(size, phys_alignment_byte);
         allocate_pages = div_round_up(size, UNIT_SIZE);
-    }
-    else
-    {
-        allocate_pages = QAE_NUM_PAGES_PER_ALLOC * QAE_PAGE_SIZE / UNIT_SIZE;
-        if (hugepage_enabled())
-            mem_type = HUGE_PAGE;
 
-        p_ctrl_blk = find_slab(fd, size, node, &pVirtAddress, phys_align_unit);
+        if (global_lock())
+            return NULL;
 
-        if (p_ctrl_blk)
+        p_ctrl_blk = alloc_slab(fd, allocate_pages * UNIT_SIZE, node, LARGE);
+        if (NULL != p_ctrl_blk)
         {
-            p_ctrl_blk->allocations += 1;
-            return pVirtAddress;
-        }
-    }
+            store_mmap_range(&g_page_table,
+                             p_ctrl_blk->virt_addr,
+                             p_ctrl_blk->phy_addr,
+                             p_ctrl_blk->size,
+                             hugepage_enabled());
 
-    /* Try to allocate memory as much as possible */
-    p_ctrl_blk = alloc_slab(fd, allocate_pages * UNIT_SIZE, node, mem_type);
-    if (NULL == p_ctrl_blk)
-        return NULL;
-
-    store_mmap_range(&g_page_table,
-                     p_ctrl_blk->virt_addr,
-                     p_ctrl_blk->phy_addr,
-                     p_ctrl_blk->size,
-                     hugepage_enabled());
+            p_ctrl_blk->allocations = 1;
 
-    if (LARGE == mem_type)
-    {
-        p_ctrl_blk->allocations = 1;
+            ADD_ELEMENT_TO_HEAD_LIST(p_ctrl_blk,
+                                     pUserLargeMemListHead,
+                                     pUserLargeMemListTail,
+                                     _user);
 
-        ADD_ELEMENT_TO_HEAD_LIST(
-            p_ctrl_blk, pUserLargeMemListHead, pUserLargeMemListTail, _user);
+            pVirtAddress = p_ctrl_blk->virt_addr;
+        }
+        global_unlock();
 
-        pVirtAddress = p_ctrl_blk->virt_addr;
+        return pVirtAddress;
     }
-    else
+
+#ifndef ICP_WITHOUT_THREAD
+    /* Every block is aligned on a unit */
+    if (phys_alignment_byte <= UNIT_SIZE)
     {
-        p_ctrl_blk->allocations = 1;
+        pVirtAddress = tc_alloc(size, node);
+        if (NULL != pVirtAddress)
+            return pVirtAddress;
+    }
+#endif
 
-        if ((uintptr_t)p_ctrl_blk->virt_addr % QAE_PAGE_SIZE)
-        {
-            CMD_ERROR("%s:%d Bad virtual address alignment %lux %x %lux\n",
-                      __func__,
-                      __LINE__,
-                      (uintptr_t)p_ctrl_blk->virt_addr,
-                      QAE_NUM_PAGES_PER_ALLOC,
-                      QAE_PAGE_SIZE);
-            free_slab(fd, p_ctrl_blk);
+    list = &g_node_slabs[node_list_index(node)];
+    node_list_lock(list);
+    p_ctrl_blk =
+        userMemLookupBySize(list, size, node, &pVirtAddress, phys_align_unit);
+    if (p_ctrl_blk)
+        p_ctrl_blk->allocations += 1;
+    node_list_unlock(list);
 
-            return NULL;
-        }
-        pVirtAddress = init_slab_and_alloc(
-            (block_ctrl_t *)p_ctrl_blk, size, phys_align_unit);
-        if (NULL == pVirtAddress)
-        {
-            CMD_ERROR("%s:%d Memory allocation failed Virtual address: %p "
-                      " Size: %x \n",
-                      __func__,
-                      __LINE__,
-                      p_ctrl_blk,
-                      size);
-            free_slab(fd, p_ctrl_blk);
+    if (p_ctrl_blk)
+        return pVirtAddress;
 
-            return NULL;
-        }
-    }
-    return pVirtAddress;
+    return alloc_from_new_slab(size, node, phys_align_unit);
 }
 
 void *qaeMemAllocNUMA(size_t size, int node, size_t phys_alignment_byte)
 {
     void *pVirtAddress = NULL;
-    int ret = 0;
     /* Maximum supported alignment is 4M. */
     const size_t MAX_PHYS_ALIGN = 0x400000;
 
@@ -1116,27 +1746,8 @@ void *qaeMemAllocNUMA(size_t size, int node, size_t phys_alignment_byte)
         return NULL;
     }
 
-    ret = mem_mutex_lock(&mutex);
-    if (unlikely(ret))
-    {
-        CMD_ERROR("%s:%d Error on thread mutex lock %s\n",
-                  __func__,
-                  __LINE__,
-                  strerror(ret));
-        return NULL;
-    }
-
     pVirtAddress = alloc_addr(size, node, phys_alignment_byte);
 
-    ret = mem_mutex_unlock(&mutex);
-    if (unlikely(ret))
-    {
-        CMD_ERROR("%s:%d Error on thread mutex unlock %s\n",
-                  __func__,
-                  __LINE__,
-                  strerror(ret));
-        return NULL;
-    }
     return pVirtAddress;
 }
 
@@ -1144,7 +1755,7 @@ static inline void free_addr(void **p_va)
 {
     dev_mem_info_t *p_ctrl_blk = NULL;
 
-    if (0 != qaeOpenFd())
+    if (0 != usdm_open_fd())
         return;
 
     if ((p_ctrl_blk = find_slab_in_hash(*p_va)) == NULL)
@@ -1158,34 +1769,32 @@ static inline void free_addr(void **p_va)
     }
     if (SMALL == p_ctrl_blk->type || HUGE_PAGE == p_ctrl_blk->type)
     {
-        mem_free((block_ctrl_t *)p_ctrl_blk, *p_va);
-
-        p_ctrl_blk->allocations -= 1;
-
-        if (p_ctrl_blk->allocations)
+#ifndef ICP_WITHOUT_THREAD
+        if (tc_free((block_ctrl_t *)p_ctrl_blk, *p_va))
         {
             *p_va = NULL;
             return;
         }
-
-        REMOVE_ELEMENT_FROM_LIST(
-            p_ctrl_blk, pUserMemListHead, pUserMemListTail, _user);
-        if (0 != push_slab(p_ctrl_blk))
-            free_slab(fd, p_ctrl_blk);
+#endif
+        free_block((block_ctrl_t *)p_ctrl_blk, *p_va);
     }
     else
     {
+        if (global_lock())
+        {
+            *p_va = NULL;
+            return;
+        }
         REMOVE_ELEMENT_FROM_LIST(
             p_ctrl_blk, pUserLargeMemListHead, pUserLargeMemListTail, _user);
         free_slab(fd, p_ctrl_blk);
+        global_unlock();
     }
     *p_va = NULL;
 }
 
 void qaeMemFreeNUMA(void **ptr)
 {
-    int ret = 0;
-
     if (NULL == ptr)
     {
         CMD_ERROR(
@@ -1198,34 +1807,79 @@ void qaeMemFreeNUMA(void **ptr)
             "%s:%d Address to be freed cannot be NULL \n", __func__, __LINE__);
         return;
     }
-    ret = mem_mutex_lock(&mutex);
-    if (ret)
-    {
-        CMD_ERROR("%s:%d Error on thread mutex lock %s\n",
-                  __func__,
-                  __LINE__,
-                  strerror(ret));
-        *ptr = NULL;
-        return;
-    }
 
     free_addr(ptr);
+}
 
-    ret = mem_mutex_unlock(&mutex);
-    if (ret)
+static inline v2p_entry_t *v2p_cache_get(void)
+{
+#ifndef ICP_WITHOUT_THREAD
+    thread_cache_t *tc = tc_get();
+
+    return (NULL != tc) ? tc->v2p : NULL;
+#else
+    return g_v2p_cache;
+#endif
+}
+
+/* Looks the page of the address up in the translation cache before
+ * walking the page table */
+static inline uint64_t v2p_lookup(v2p_entry_t *cache, void *pVirtAddress)
+{
+    const uint32_t shift = g_v2p_page_shift;
+    const uintptr_t offset_mask = ((uintptr_t)1 << shift) - 1;
+    const uintptr_t page = (uintptr_t)pVirtAddress >> shift;
+    const uint64_t generation = g_v2p_generation;
+    v2p_entry_t *entry = NULL;
+    uint64_t phys = 0;
+
+    if (NULL == cache)
+        return load_addr_fptr(&g_page_table, pVirtAddress);
+
+    entry = &cache[page % USDM_V2P_CACHE_SIZE];
+    if (entry->page == page && entry->generation == generation)
+        return entry->phys | ((uintptr_t)pVirtAddress & offset_mask);
+
+    phys = load_addr_fptr(&g_page_table, pVirtAddress);
+    if (phys)
     {
-        CMD_ERROR("%s:%d Error on thread mutex unlock %s\n",
-                  __func__,
-                  __LINE__,
-                  strerror(ret));
+        entry->page = page;
+        entry->phys = phys & ~(uint64_t)offset_mask;
+        entry->generation = generation;
     }
-    return;
+    return phys;
 }
 
 /*translate a virtual address to a physical address */
 uint64_t qaeVirtToPhysNUMA(void *pVirtAddress)
 {
-    return load_addr_fptr(&g_page_table, pVirtAddress);
+    return v2p_lookup(v2p_cache_get(), pVirtAddress);
+}
+
+int32_t qaeVirtToPhysNUMABatch(void *pVirtAddr[],
+                               uint64_t pPhysAddr[],
+                               size_t numAddr)
+{
+    v2p_entry_t *cache = NULL;
+    int32_t status = 0;
+    size_t i = 0;
+
+    if (NULL == pVirtAddr || NULL == pPhysAddr)
+    {
+        CMD_ERROR(
+            "%s:%d Input parameter cannot be NULL \n", __func__, __LINE__);
+        return -EINVAL;
+    }
+
+    /* The thread cache is looked up once for the whole batch */
+    cache = v2p_cache_get();
+    for (i = 0; i < numAddr; i++)
+    {
+        pPhysAddr[i] = v2p_lookup(cache, pVirtAddr[i]);
+        if (0 == pPhysAddr[i])
+            status = -EFAULT;
+    }
+    return status;
 }
 
 static int32_t memoryRemap(dev_mem_info_t *head)
@@ -1246,6 +1900,7 @@ void qaeAtFork()
     int32_t status0 = 0;
     int32_t status1 = 0;
     int32_t status2 = 0;
+    uint32_t i = 0;
 
     ret = mem_mutex_lock(&mutex);
     if (unlikely(ret))
@@ -1256,7 +1911,8 @@ void qaeAtFork()
     }
 
     status0 = memoryRemap(pUserCacheHead);
-    status1 = memoryRemap(pUserMemListHead);
+    for (i = 0; i < USDM_MAX_NODES && 0 == status1; i++)
+        status1 = memoryRemap(g_node_slabs[i].head);
     status2 = memoryRemap(pUserLargeMemListHead);
 
     ret = mem_mutex_unlock(&mutex);
@@ -195,6 +195,34 @@ void qaeMemFreeNUMA(void **ptr);
  ****************************************************************************/
 uint64_t qaeVirtToPhysNUMA(void *pVirtAddr);
 
+/**
+ *****************************************************************************
+ * @ingroup CommonMemoryDriver
+ *      qaeVirtToPhysNUMABatch
+ *
+ * @brief
+ *      Converts an array of virtual addresses provided by qaeMemAllocNUMA
+ *      to physical ones. Applicable for both user and kernel spaces.
+ *
+ * @param[in] pVirtAddr - array of virtual addresses
+ * @param[out] pPhysAddr - array receiving the physical addresses, an entry
+ *                         is set to 0 if its address cannot be converted
+ * @param[in] numAddr - number of addresses to convert
+ *
+ * @retval 0 if all addresses were converted, -EINVAL if an array is NULL
+ *         or -EFAULT if any of the addresses could not be converted
+ *
+ * @pre
+ *      pVirtAddr entries point to memory previously allocated by
+ *      qaeMemAllocNUMA
+ * @post
+ *      Appropriate physical addresses are provided
+ *
+ ****************************************************************************/
+int32_t qaeVirtToPhysNUMABatch(void *pVirtAddr[],
+                               uint64_t pPhysAddr[],
+                               size_t numAddr);
+
 #ifdef __FreeBSD__
 /**
  *****************************************************************************
@@ -396,6 +396,45 @@ OSAL_PUBLIC INT64 osalAtomicDec(OsalAtomic *pAtomicVar);
  */
 OSAL_PUBLIC OSAL_STATUS osalAtomicDecAndTest(OsalAtomic *pAtomicVar);
 
+/**
+ * @ingroup Osal
+ *
+ * @brief Atomically exchange the value of a pointer variable
+ *
+ * @param  ppVar (IN/OUT)   - pointer variable
+ * @param  pNewVal (IN)     - value to store in the variable
+ *
+ * Atomically stores pNewVal in *ppVar and returns the value it replaced.
+ * The exchange is a full memory barrier.
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return previous value of *ppVar
+ */
+OSAL_PUBLIC void *osalAtomicPtrXchg(void *volatile *ppVar, void *pNewVal);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief Atomically compare and exchange the value of a pointer variable
+ *
+ * @param  ppVar (IN/OUT)   - pointer variable
+ * @param  pOldVal (IN)     - expected value of the variable
+ * @param  pNewVal (IN)     - value to store in the variable
+ *
+ * Atomically stores pNewVal in *ppVar if it is equal to pOldVal.
+ * The operation is a full memory barrier.
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return OSAL_SUCCESS if the value was exchanged or OSAL_FAIL otherwise
+ */
+OSAL_PUBLIC OSAL_STATUS osalAtomicPtrCmpXchg(void *volatile *ppVar,
+                                             void *pOldVal,
+                                             void *pNewVal);
+
 /**
  * @ingroup Osal
  *
@@ -1693,6 +1732,228 @@ osalHashSHA512Full(UINT8 *in, UINT8 *out, UINT32 len);
 OSAL_STATUS
 osalAESEncrypt(UINT8 *key, UINT32 keyLenInBytes, UINT8 *in, UINT8 *out);
 
+/**
+ * @ingroup Osal
+ *
+ * @brief  AES counter mode keystream
+ *
+ * @param  key - pointer to symetric key.
+ *         keyLenInBytes - key lenght
+ *         counter - 16 byte big endian counter block. It is incremented
+ *         before each block is encrypted and holds the last value encrypted
+ *         on return, as required by the NIST SP 800-90A CTR_DRBG.
+ *         out - pointer to output buffer for the keystream, at least
+ *         numBlocks AES blocks long
+ *         numBlocks - number of AES blocks to produce
+ *
+ * The key schedule is set up once for the whole call. In the kernel each
+ * CPU has its own cipher, used with bottom halves disabled, so callers on
+ * different CPUs do not serialise.
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  no
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalAESCtrKeystream(UINT8 *key,
+                    UINT32 keyLenInBytes,
+                    UINT8 *counter,
+                    UINT8 *out,
+                    UINT32 numBlocks);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief  AES CBC mode encrypt
+ *
+ * @param  key - pointer to symetric key.
+ *         keyLenInBytes - key lenght
+ *         iv - 16 byte initialisation vector. Holds the last ciphertext
+ *         block on return, so that a following call chains from it.
+ *         in - pointer to the plaintext, numBlocks AES blocks long
+ *         out - pointer to output buffer for the ciphertext, may be in
+ *         numBlocks - number of AES blocks to encrypt
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalAESCbcEncrypt(UINT8 *key,
+                  UINT32 keyLenInBytes,
+                  UINT8 *iv,
+                  UINT8 *in,
+                  UINT8 *out,
+                  UINT32 numBlocks);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief  AES CBC mode decrypt
+ *
+ * @param  key - pointer to symetric key, the encryption key as given to
+ *         osalAESCbcEncrypt
+ *         keyLenInBytes - key lenght
+ *         iv - 16 byte initialisation vector. Holds the last ciphertext
+ *         block on return.
+ *         in - pointer to the ciphertext, numBlocks AES blocks long
+ *         out - pointer to output buffer for the plaintext, may be in
+ *         numBlocks - number of AES blocks to decrypt
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalAESCbcDecrypt(UINT8 *key,
+                  UINT32 keyLenInBytes,
+                  UINT8 *iv,
+                  UINT8 *in,
+                  UINT8 *out,
+                  UINT32 numBlocks);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief  GHASH as used by AES-GCM (NIST SP 800-38D)
+ *
+ * @param  hashKey - 16 byte hash subkey H
+ *         state - 16 byte GHASH accumulator, updated in place
+ *         in - pointer to the data, numBlocks 16 byte blocks long
+ *         numBlocks - number of blocks to absorb
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalGhash(UINT8 *hashKey, UINT8 *state, UINT8 *in, UINT32 numBlocks);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief  Completes a SHA1 hash from a one block state
+ *
+ * @param  state - big endian hash state after exactly one block, as held
+ *         in a content descriptor for the HMAC inner or outer hash
+ *         in - pointer to the data following that block
+ *         len - length of the data
+ *         out - output buffer for the digest (20 bytes), in the standard
+ *         byte order
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalHashSHA1Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief  Completes a SHA224 hash from a one block state
+ *
+ * @param  state - big endian hash state (32 bytes) after exactly one block
+ *         in - pointer to the data following that block
+ *         len - length of the data
+ *         out - output buffer for the digest (28 bytes)
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalHashSHA224Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief  Completes a SHA256 hash from a one block state
+ *
+ * @param  state - big endian hash state (32 bytes) after exactly one block
+ *         in - pointer to the data following that block
+ *         len - length of the data
+ *         out - output buffer for the digest (32 bytes)
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalHashSHA256Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief  Completes a SHA384 hash from a one block state
+ *
+ * @param  state - big endian hash state (64 bytes) after exactly one block
+ *         in - pointer to the data following that block
+ *         len - length of the data
+ *         out - output buffer for the digest (48 bytes)
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalHashSHA384Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief  Completes a SHA512 hash from a one block state
+ *
+ * @param  state - big endian hash state (64 bytes) after exactly one block
+ *         in - pointer to the data following that block
+ *         len - length of the data
+ *         out - output buffer for the digest (64 bytes)
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  yes
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalHashSHA512Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out);
+
+/**
+ * @ingroup Osal
+ *
+ * @brief  Random bytes from the operating system
+ *
+ * @param  out - pointer to output buffer
+ *         len - number of random bytes to write
+ *
+ * Reads the operating system cryptographically secure random number
+ * generator.
+ *
+ * @li Reentrant: yes
+ * @li IRQ safe:  no
+ *
+ * @return - OSAL_SUCCESS/OSAL_FAIL
+ *
+ */
+OSAL_STATUS
+osalGetRandomBytes(UINT8 *out, UINT32 len);
+
 /**
  * @ingroup Osal
  *
@@ -185,3 +185,15 @@ osalAtomicDecAndTest(OsalAtomic *pAtomicVar)
 
 #endif
 
+OSAL_PUBLIC OSAL_INLINE void *
+osalAtomicPtrXchg(void *volatile *ppVar, void *pNewVal)
+{
+    return xchg((void **)ppVar, pNewVal);
+}
+
+OSAL_PUBLIC OSAL_INLINE OSAL_STATUS
+osalAtomicPtrCmpXchg(void *volatile *ppVar, void *pOldVal, void *pNewVal)
+{
+    return (pOldVal == cmpxchg((void **)ppVar, pOldVal, pNewVal)) ?
+        OSAL_SUCCESS : OSAL_FAIL;
+}
@@ -67,6 +67,10 @@
 #include "Osal.h"
 #include <linux/crypto.h>
 #include <linux/cryptohash.h>
+#include <linux/interrupt.h>
+#include <linux/percpu.h>
+#include <linux/random.h>
+#include <linux/smp.h>
 #include <linux/version.h>
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,29))
 #include <crypto/internal/hash.h>
@@ -80,10 +84,15 @@ static struct crypto_shash *sha512_tfm = NULL;
 #endif
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,19)
 static struct crypto_cipher *cipher_tfm = NULL;
+/* One AES cipher per CPU for the CTR keystream, so that DRBG sessions on
+ * different CPUs do not serialise on encLock or rekey each other's tfm */
+static DEFINE_PER_CPU(struct crypto_cipher *, ctr_cipher_tfm);
 #endif
 
 static OsalLock encLock;
 
+#define OSAL_AES_BLOCK_BYTES 16
+
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,32))
 #include <crypto/md5.h>
 static struct crypto_shash *md5_tfm = NULL;
@@ -600,6 +609,55 @@ osalAESEncrypt(UINT8 *key, UINT32 keyLenInBytes, UINT8 *in, UINT8 *out)
     }
     return OSAL_SUCCESS;
 }
+
+/* Adds one to a 16 byte big endian counter block */
+static void osalAESCtrIncrement(UINT8 *counter)
+{
+    INT32 i;
+
+    for (i = OSAL_AES_BLOCK_BYTES - 1; i >= 0; i--)
+    {
+        if (0 != ++counter[i])
+        {
+            break;
+        }
+    }
+}
+
+OSAL_STATUS
+osalAESCtrKeystream(UINT8 *key,
+                    UINT32 keyLenInBytes,
+                    UINT8 *counter,
+                    UINT8 *out,
+                    UINT32 numBlocks)
+{
+    struct crypto_cipher *tfm = NULL;
+    UINT32 i;
+
+    /* The tfm of this CPU is only used with bottom halves disabled, which
+     * keeps the thread on the CPU and any softirq caller off the tfm */
+    local_bh_disable();
+    tfm = per_cpu(ctr_cipher_tfm, smp_processor_id());
+    if (NULL == tfm)
+    {
+        local_bh_enable();
+        printk("aes tfm not initialized\n");
+        return OSAL_FAIL;
+    }
+    if (crypto_cipher_setkey(tfm, key, keyLenInBytes))
+    {
+        local_bh_enable();
+        return OSAL_FAIL;
+    }
+    for (i = 0; i < numBlocks; i++)
+    {
+        osalAESCtrIncrement(counter);
+        crypto_cipher_encrypt_one(
+            tfm, out + i * OSAL_AES_BLOCK_BYTES, counter);
+    }
+    local_bh_enable();
+    return OSAL_SUCCESS;
+}
 #else
 OSAL_STATUS
 osalAESEncrypt(UINT8 *key, UINT32 keyLenInBytes, UINT8 *in, UINT8 *out)
@@ -607,13 +665,98 @@ osalAESEncrypt(UINT8 *key, UINT32 keyLenInBytes, UINT8 *in, UINT8 *out)
     printk("Software precomputes using AES not supported with this kernel\n");
     return OSAL_FAIL;
 }
+
+OSAL_STATUS
+osalAESCtrKeystream(UINT8 *key,
+                    UINT32 keyLenInBytes,
+                    UINT8 *counter,
+                    UINT8 *out,
+                    UINT32 numBlocks)
+{
+    printk("AES counter mode not supported with this kernel\n");
+    return OSAL_FAIL;
+}
 #endif
 
+/*
+ * The bulk primitives below back the user space host fallback of the
+ * symmetric service only. Kernel instances always offload, so they are
+ * not provided here.
+ */
+OSAL_STATUS
+osalAESCbcEncrypt(UINT8 *key,
+                  UINT32 keyLenInBytes,
+                  UINT8 *iv,
+                  UINT8 *in,
+                  UINT8 *out,
+                  UINT32 numBlocks)
+{
+    return OSAL_FAIL;
+}
+
+OSAL_STATUS
+osalAESCbcDecrypt(UINT8 *key,
+                  UINT32 keyLenInBytes,
+                  UINT8 *iv,
+                  UINT8 *in,
+                  UINT8 *out,
+                  UINT32 numBlocks)
+{
+    return OSAL_FAIL;
+}
+
+OSAL_STATUS
+osalGhash(UINT8 *hashKey, UINT8 *state, UINT8 *in, UINT32 numBlocks)
+{
+    return OSAL_FAIL;
+}
+
+OSAL_STATUS
+osalHashSHA1Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    return OSAL_FAIL;
+}
+
+OSAL_STATUS
+osalHashSHA224Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    return OSAL_FAIL;
+}
+
+OSAL_STATUS
+osalHashSHA256Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    return OSAL_FAIL;
+}
+
+OSAL_STATUS
+osalHashSHA384Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    return OSAL_FAIL;
+}
+
+OSAL_STATUS
+osalHashSHA512Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    return OSAL_FAIL;
+}
+
+OSAL_STATUS
+osalGetRandomBytes(UINT8 *out, UINT32 len)
+{
+    get_random_bytes(out, len);
+    return OSAL_SUCCESS;
+}
+
 
 OSAL_STATUS
 osalCryptoInterfaceInit(void)
 {
     OSAL_STATUS ret=OSAL_SUCCESS;
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,19))
+    struct crypto_cipher *tfm = NULL;
+    INT32 cpu;
+#endif
 
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,32))
     md5_tfm = crypto_alloc_shash("md5", 0, 0);
@@ -666,6 +809,16 @@ osalCryptoInterfaceInit(void)
         printk("crypto_alloc_cipher aes failed\n");
         return OSAL_FAIL;
     }
+    for_each_possible_cpu(cpu)
+    {
+        tfm = crypto_alloc_cipher("aes", 0, 0);
+        if(IS_ERR(tfm))
+        {
+            printk("crypto_alloc_cipher aes failed\n");
+            return OSAL_FAIL;
+        }
+        per_cpu(ctr_cipher_tfm, cpu) = tfm;
+    }
 #endif
     ret = osalLockInit(&encLock, TYPE_IGNORE);
     if (OSAL_FAIL == ret)
@@ -680,6 +833,10 @@ osalCryptoInterfaceInit(void)
 void
 osalCryptoInterfaceExit(void)
 {
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,19))
+    INT32 cpu;
+#endif
+
     osalLockDestroy(&encLock);
 
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,32))
@@ -715,5 +872,13 @@ osalCryptoInterfaceExit(void)
     {
         crypto_free_cipher(cipher_tfm);
     }
+    for_each_possible_cpu(cpu)
+    {
+        if (NULL != per_cpu(ctr_cipher_tfm, cpu))
+        {
+            crypto_free_cipher(per_cpu(ctr_cipher_tfm, cpu));
+            per_cpu(ctr_cipher_tfm, cpu) = NULL;
+        }
+    }
 #endif
 }
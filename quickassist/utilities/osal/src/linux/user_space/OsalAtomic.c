@@ -43,7 +43,9 @@
 
 OSAL_PUBLIC OSAL_INLINE INT64 osalAtomicGet(OsalAtomic *atomicVar)
 {
-    return __sync_fetch_and_and(atomicVar, (INT64)0xFFFFFFFFFFFFFFFFULL);
+    /* A plain aligned load is atomic; avoid a locked read-modify-write
+     * on a variable polled from hot paths */
+    return __atomic_load_n(atomicVar, __ATOMIC_SEQ_CST);
 }
 
 OSAL_PUBLIC OSAL_INLINE void osalAtomicSet(INT64 inValue, OsalAtomic *atomicVar)
@@ -77,3 +79,18 @@ OSAL_PUBLIC OSAL_INLINE OSAL_STATUS osalAtomicDecAndTest(OsalAtomic *atomicVar)
 {
     return (OSAL_STATUS)(__sync_sub_and_fetch(atomicVar, 1) == 0);
 }
+
+OSAL_PUBLIC OSAL_INLINE void *osalAtomicPtrXchg(void *volatile *ppVar,
+                                                void *pNewVal)
+{
+    return __atomic_exchange_n(ppVar, pNewVal, __ATOMIC_SEQ_CST);
+}
+
+OSAL_PUBLIC OSAL_INLINE OSAL_STATUS osalAtomicPtrCmpXchg(void *volatile *ppVar,
+                                                         void *pOldVal,
+                                                         void *pNewVal)
+{
+    return (pOldVal == __sync_val_compare_and_swap(ppVar, pOldVal, pNewVal))
+               ? OSAL_SUCCESS
+               : OSAL_FAIL;
+}
@@ -0,0 +1,1047 @@
+/**
+ * @file OsalCryptoAccel.c (linux user space)
+ *
+ * @brief SHA-NI, AES-NI and PCLMULQDQ functions used by the OSAL crypto
+ * interface.
+ *
+ * @par
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ */
+
+#include "OsalCryptoAccel.h"
+
+#if defined(__x86_64__) && !defined(USE_OPENSSL)
+
+#include <cpuid.h>
+#include <immintrin.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "openssl/sha.h"
+#include "openssl/aes.h"
+
+/*
+ * The library is built for the baseline x86_64 ISA, so the functions using
+ * the crypto extensions are compiled for them individually and are only
+ * called once CPUID has reported the instructions as present.
+ */
+#define OSAL_ACCEL_SHA_FN __attribute__((target("sha,sse4.1,ssse3")))
+#define OSAL_ACCEL_AES_FN __attribute__((target("aes,sse4.1,ssse3")))
+#define OSAL_ACCEL_CLMUL_FN __attribute__((target("pclmul,sse4.1,ssse3")))
+
+#define OSAL_CPUID_1_ECX_PCLMUL (1U << 1)
+#define OSAL_CPUID_1_ECX_SSSE3 (1U << 9)
+#define OSAL_CPUID_1_ECX_SSE41 (1U << 19)
+#define OSAL_CPUID_1_ECX_AES (1U << 25)
+#define OSAL_CPUID_7_EBX_SHA (1U << 29)
+
+#define OSAL_CRYPTO_ACCEL_ENV "QAT_OSAL_CRYPTO_ACCEL"
+
+#define OSAL_SHA_BLOCK_BYTES 64
+#define OSAL_AES_BLOCK_BYTES 16
+#define OSAL_AES_128_KEY_BYTES 16
+#define OSAL_AES_192_KEY_BYTES 24
+#define OSAL_AES_256_KEY_BYTES 32
+#define OSAL_AES_192_ROUNDS 12
+#define OSAL_AES_MAX_ROUND_KEYS 15
+#define OSAL_AES_CTR_TEST_BLOCKS 5
+#define OSAL_GHASH_TEST_BLOCKS 2
+
+static pthread_once_t osalCryptoAccelOnce = PTHREAD_ONCE_INIT;
+static int osalCryptoAccelSha = 0;
+static int osalCryptoAccelAes = 0;
+static int osalCryptoAccelClmul = 0;
+
+/* NIST GCM test case 2: H = E(0^128, 0^128) and the GHASH of its single
+ * ciphertext block with the length block, AAD empty */
+static const UINT8 osalGhashTestKey[OSAL_AES_BLOCK_BYTES] = {
+    0x66, 0xe9, 0x4b, 0xd4, 0xef, 0x8a, 0x2c, 0x3b,
+    0x88, 0x4c, 0xfa, 0x59, 0xca, 0x34, 0x2b, 0x2e};
+static const UINT8
+    osalGhashTestIn[OSAL_GHASH_TEST_BLOCKS * OSAL_AES_BLOCK_BYTES] = {
+        0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2,
+        0xb9, 0x71, 0xb2, 0xfe, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80};
+static const UINT8 osalGhashTestOut[OSAL_AES_BLOCK_BYTES] = {
+    0xf3, 0x8c, 0xbb, 0x1a, 0xd6, 0x92, 0x23, 0xdc,
+    0xc3, 0x45, 0x7a, 0xe5, 0xb6, 0xb0, 0xf8, 0x85};
+
+/* FIPS 180-4 example message of 448 bits, which pads to two blocks, and
+ * its SHA-1 and SHA-256 digests as state words */
+static const char osalShaTestMsg[] =
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+static const UINT32 osalSha1TestOut[5] = {
+    0x84983e44, 0x1c3bd26e, 0xbaae4aa1, 0xf95129e5, 0xe54670f1};
+static const UINT32 osalSha256TestOut[8] = {0x248d6a61, 0xd20638b8,
+                                            0xe5c02693, 0x0c3e6039,
+                                            0xa33ce459, 0x64ff2167,
+                                            0xf6ecedd4, 0x19db06c1};
+
+/* FIPS 197 appendix C: the key is the bytes 0x00, 0x01, ... of the key
+ * length, the plaintext is the same for the three key sizes */
+static const UINT8 osalAesTestIn[OSAL_AES_BLOCK_BYTES] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+static const UINT8 osalAesTestOut[3][OSAL_AES_BLOCK_BYTES] = {
+    {0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+     0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a},
+    {0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+     0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91},
+    {0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+     0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89}};
+
+static const UINT32 osalSha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+/*
+ * Four SHA-1 rounds. Group i uses schedule word W[i] from a ring of four
+ * vectors; the round function selector f has to be an immediate.
+ */
+#define OSAL_SHA1_ROUNDS_4(i, f)                                               \
+    do                                                                         \
+    {                                                                          \
+        msg[(i)&3] = _mm_sha1msg2_epu32(                                       \
+            _mm_xor_si128(                                                     \
+                _mm_sha1msg1_epu32(msg[(i)&3], msg[((i) + 1) & 3]),            \
+                msg[((i) + 2) & 3]),                                           \
+            msg[((i) + 3) & 3]);                                               \
+        e = _mm_sha1nexte_epu32(abcdPrev, msg[(i)&3]);                         \
+        abcdPrev = abcd;                                                       \
+        abcd = _mm_sha1rnds4_epu32(abcd, e, f);                                \
+    } while (0)
+
+/*
+ * SHA-1 compression of one 64 byte block. pState holds h0..h4 in host order
+ * exactly as in SHA_CTX.
+ */
+OSAL_ACCEL_SHA_FN static void osalSha1BlockNi(UINT32 *pState,
+                                              const UINT8 *pBlock)
+{
+    const __m128i mask =
+        _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+    __m128i msg[4];
+    __m128i abcd, abcdPrev, abcdSave, e, eSave;
+    int i;
+
+    abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)pState), 0x1B);
+    eSave = _mm_set_epi32((int)pState[4], 0, 0, 0);
+    abcdSave = abcd;
+
+    for (i = 0; i < 4; i++)
+    {
+        msg[i] = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i *)(pBlock + (i << 4))), mask);
+    }
+
+    /* Rounds 0-15 use the message words directly */
+    e = _mm_add_epi32(eSave, msg[0]);
+    abcdPrev = abcd;
+    abcd = _mm_sha1rnds4_epu32(abcd, e, 0);
+    for (i = 1; i < 4; i++)
+    {
+        e = _mm_sha1nexte_epu32(abcdPrev, msg[i]);
+        abcdPrev = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e, 0);
+    }
+
+    OSAL_SHA1_ROUNDS_4(4, 0);
+    for (i = 5; i < 10; i++)
+    {
+        OSAL_SHA1_ROUNDS_4(i, 1);
+    }
+    for (; i < 15; i++)
+    {
+        OSAL_SHA1_ROUNDS_4(i, 2);
+    }
+    for (; i < 20; i++)
+    {
+        OSAL_SHA1_ROUNDS_4(i, 3);
+    }
+
+    e = _mm_sha1nexte_epu32(abcdPrev, eSave);
+    abcd = _mm_add_epi32(abcd, abcdSave);
+
+    _mm_storeu_si128((__m128i *)pState, _mm_shuffle_epi32(abcd, 0x1B));
+    pState[4] = (UINT32)_mm_extract_epi32(e, 3);
+}
+
+/*
+ * SHA-256 compression of one 64 byte block. pState holds h[0..7] in host
+ * order exactly as in SHA256_CTX. The instructions work on the state split
+ * as ABEF/CDGH, so it is rearranged on the way in and out.
+ */
+OSAL_ACCEL_SHA_FN static void osalSha256BlockNi(UINT32 *pState,
+                                                const UINT8 *pBlock)
+{
+    const __m128i mask =
+        _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i msg[4];
+    __m128i state0, state1, save0, save1, tmp, wk;
+    int i;
+
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)pState), 0xB1);
+    state1 =
+        _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(pState + 4)), 0x1B);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+    save0 = state0;
+    save1 = state1;
+
+    for (i = 0; i < 4; i++)
+    {
+        msg[i] = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i *)(pBlock + (i << 4))), mask);
+    }
+
+    for (i = 0; i < 16; i++)
+    {
+        if (i >= 4)
+        {
+            msg[i & 3] = _mm_sha256msg2_epu32(
+                _mm_add_epi32(
+                    _mm_sha256msg1_epu32(msg[i & 3], msg[(i + 1) & 3]),
+                    _mm_alignr_epi8(msg[(i + 3) & 3], msg[(i + 2) & 3], 4)),
+                msg[(i + 3) & 3]);
+        }
+        wk = _mm_add_epi32(
+            msg[i & 3],
+            _mm_loadu_si128((const __m128i *)(osalSha256K + (i << 2))));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+        wk = _mm_shuffle_epi32(wk, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, wk);
+    }
+
+    state0 = _mm_add_epi32(state0, save0);
+    state1 = _mm_add_epi32(state1, save1);
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+
+    _mm_storeu_si128((__m128i *)pState, state0);
+    _mm_storeu_si128((__m128i *)(pState + 4), state1);
+}
+
+/* One step of the AES key schedule, gen already broadcast by the caller */
+OSAL_ACCEL_AES_FN static inline __m128i osalAesExpandStep(__m128i key,
+                                                          __m128i gen)
+{
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, gen);
+}
+
+/* aeskeygenassist takes the round constant as an immediate */
+#define OSAL_AES_128_EXPAND(rk, i, rcon)                                      \
+    rk[i] = osalAesExpandStep(                                                 \
+        rk[(i)-1],                                                             \
+        _mm_shuffle_epi32(_mm_aeskeygenassist_si128(rk[(i)-1], rcon), 0xFF))
+
+#define OSAL_AES_256_EXPAND(rk, i, rcon)                                      \
+    rk[i] = osalAesExpandStep(                                                 \
+        rk[(i)-2],                                                             \
+        _mm_shuffle_epi32(_mm_aeskeygenassist_si128(rk[(i)-1], rcon), 0xFF))
+
+#define OSAL_AES_256_EXPAND_ODD(rk, i)                                        \
+    rk[i] = osalAesExpandStep(                                                 \
+        rk[(i)-2],                                                             \
+        _mm_shuffle_epi32(_mm_aeskeygenassist_si128(rk[(i)-1], 0), 0xAA))
+
+/*
+ * Builds the AES-NI encryption round keys and returns the number of rounds,
+ * or 0 for an unsupported key length. AES-192 is rare for the precomputes,
+ * so its schedule comes from the scalar code with the words byte swapped
+ * into the order the instructions expect.
+ */
+OSAL_ACCEL_AES_FN static UINT32 osalAesExpandKeyNi(const UINT8 *pKey,
+                                                   UINT32 keyLenInBytes,
+                                                   __m128i *rk)
+{
+    AES_KEY scalarKey;
+    UINT32 words[4];
+    int i, j;
+
+    switch (keyLenInBytes)
+    {
+        case OSAL_AES_128_KEY_BYTES:
+            rk[0] = _mm_loadu_si128((const __m128i *)pKey);
+            OSAL_AES_128_EXPAND(rk, 1, 0x01);
+            OSAL_AES_128_EXPAND(rk, 2, 0x02);
+            OSAL_AES_128_EXPAND(rk, 3, 0x04);
+            OSAL_AES_128_EXPAND(rk, 4, 0x08);
+            OSAL_AES_128_EXPAND(rk, 5, 0x10);
+            OSAL_AES_128_EXPAND(rk, 6, 0x20);
+            OSAL_AES_128_EXPAND(rk, 7, 0x40);
+            OSAL_AES_128_EXPAND(rk, 8, 0x80);
+            OSAL_AES_128_EXPAND(rk, 9, 0x1B);
+            OSAL_AES_128_EXPAND(rk, 10, 0x36);
+            return 10;
+        case OSAL_AES_256_KEY_BYTES:
+            rk[0] = _mm_loadu_si128((const __m128i *)pKey);
+            rk[1] = _mm_loadu_si128((const __m128i *)(pKey + 16));
+            OSAL_AES_256_EXPAND(rk, 2, 0x01);
+            OSAL_AES_256_EXPAND_ODD(rk, 3);
+            OSAL_AES_256_EXPAND(rk, 4, 0x02);
+            OSAL_AES_256_EXPAND_ODD(rk, 5);
+            OSAL_AES_256_EXPAND(rk, 6, 0x04);
+            OSAL_AES_256_EXPAND_ODD(rk, 7);
+            OSAL_AES_256_EXPAND(rk, 8, 0x08);
+            OSAL_AES_256_EXPAND_ODD(rk, 9);
+            OSAL_AES_256_EXPAND(rk, 10, 0x10);
+            OSAL_AES_256_EXPAND_ODD(rk, 11);
+            OSAL_AES_256_EXPAND(rk, 12, 0x20);
+            OSAL_AES_256_EXPAND_ODD(rk, 13);
+            OSAL_AES_256_EXPAND(rk, 14, 0x40);
+            return 14;
+        case OSAL_AES_192_KEY_BYTES:
+            if (ossl_AES_set_encrypt_key(
+                    pKey, OSAL_AES_192_KEY_BYTES << 3, &scalarKey) < 0)
+            {
+                return 0;
+            }
+            for (i = 0; i <= OSAL_AES_192_ROUNDS; i++)
+            {
+                for (j = 0; j < 4; j++)
+                {
+                    words[j] =
+                        __builtin_bswap32((UINT32)scalarKey.rd_key[(i << 2) + j]);
+                }
+                rk[i] = _mm_loadu_si128((const __m128i *)words);
+            }
+            return OSAL_AES_192_ROUNDS;
+        default:
+            return 0;
+    }
+}
+
+OSAL_ACCEL_AES_FN static OSAL_STATUS osalAesEncryptNi(const UINT8 *pKey,
+                                                      UINT32 keyLenInBytes,
+                                                      const UINT8 *pIn,
+                                                      UINT8 *pOut)
+{
+    __m128i rk[OSAL_AES_MAX_ROUND_KEYS];
+    __m128i block;
+    UINT32 rounds, r;
+
+    rounds = osalAesExpandKeyNi(pKey, keyLenInBytes, rk);
+    if (0 == rounds)
+    {
+        return OSAL_FAIL;
+    }
+
+    block = _mm_xor_si128(_mm_loadu_si128((const __m128i *)pIn), rk[0]);
+    for (r = 1; r < rounds; r++)
+    {
+        block = _mm_aesenc_si128(block, rk[r]);
+    }
+    block = _mm_aesenclast_si128(block, rk[rounds]);
+    _mm_storeu_si128((__m128i *)pOut, block);
+    return OSAL_SUCCESS;
+}
+
+/*
+ * CTR keystream with the counter incremented before each block. Four
+ * blocks are kept in flight so that the aesenc latency is hidden; the
+ * counter is carried as two host order halves and byte swapped into the
+ * blocks.
+ */
+OSAL_ACCEL_AES_FN static OSAL_STATUS osalAesCtrNi(const UINT8 *pKey,
+                                                  UINT32 keyLenInBytes,
+                                                  UINT8 *pCounter,
+                                                  UINT8 *pOut,
+                                                  UINT32 numBlocks)
+{
+    __m128i rk[OSAL_AES_MAX_ROUND_KEYS];
+    __m128i b0, b1, b2, b3;
+    UINT64 hi, lo;
+    UINT32 rounds, r, i = 0;
+
+    rounds = osalAesExpandKeyNi(pKey, keyLenInBytes, rk);
+    if (0 == rounds)
+    {
+        return OSAL_FAIL;
+    }
+
+    memcpy(&hi, pCounter, sizeof(hi));
+    memcpy(&lo, pCounter + sizeof(hi), sizeof(lo));
+    hi = __builtin_bswap64(hi);
+    lo = __builtin_bswap64(lo);
+
+#define OSAL_AES_CTR_NEXT(blk)                                                 \
+    do                                                                         \
+    {                                                                          \
+        if (0 == ++lo)                                                         \
+        {                                                                      \
+            hi++;                                                              \
+        }                                                                      \
+        blk = _mm_xor_si128(_mm_set_epi64x((long long)__builtin_bswap64(lo),  \
+                                           (long long)__builtin_bswap64(hi)),  \
+                            rk[0]);                                            \
+    } while (0)
+
+    for (; i + 4 <= numBlocks; i += 4)
+    {
+        OSAL_AES_CTR_NEXT(b0);
+        OSAL_AES_CTR_NEXT(b1);
+        OSAL_AES_CTR_NEXT(b2);
+        OSAL_AES_CTR_NEXT(b3);
+        for (r = 1; r < rounds; r++)
+        {
+            b0 = _mm_aesenc_si128(b0, rk[r]);
+            b1 = _mm_aesenc_si128(b1, rk[r]);
+            b2 = _mm_aesenc_si128(b2, rk[r]);
+            b3 = _mm_aesenc_si128(b3, rk[r]);
+        }
+        _mm_storeu_si128((__m128i *)(pOut + (i + 0) * OSAL_AES_BLOCK_BYTES),
+                         _mm_aesenclast_si128(b0, rk[rounds]));
+        _mm_storeu_si128((__m128i *)(pOut + (i + 1) * OSAL_AES_BLOCK_BYTES),
+                         _mm_aesenclast_si128(b1, rk[rounds]));
+        _mm_storeu_si128((__m128i *)(pOut + (i + 2) * OSAL_AES_BLOCK_BYTES),
+                         _mm_aesenclast_si128(b2, rk[rounds]));
+        _mm_storeu_si128((__m128i *)(pOut + (i + 3) * OSAL_AES_BLOCK_BYTES),
+                         _mm_aesenclast_si128(b3, rk[rounds]));
+    }
+    for (; i < numBlocks; i++)
+    {
+        OSAL_AES_CTR_NEXT(b0);
+        for (r = 1; r < rounds; r++)
+        {
+            b0 = _mm_aesenc_si128(b0, rk[r]);
+        }
+        _mm_storeu_si128((__m128i *)(pOut + i * OSAL_AES_BLOCK_BYTES),
+                         _mm_aesenclast_si128(b0, rk[rounds]));
+    }
+#undef OSAL_AES_CTR_NEXT
+
+    hi = __builtin_bswap64(hi);
+    lo = __builtin_bswap64(lo);
+    memcpy(pCounter, &hi, sizeof(hi));
+    memcpy(pCounter + sizeof(hi), &lo, sizeof(lo));
+    memset(rk, 0, sizeof(rk));
+    return OSAL_SUCCESS;
+}
+
+/*
+ * CBC encryption is serial, so each block goes through the rounds on its
+ * own. The caller's IV is updated to the last ciphertext block.
+ */
+OSAL_ACCEL_AES_FN static OSAL_STATUS osalAesCbcEncryptNi(const UINT8 *pKey,
+                                                         UINT32 keyLenInBytes,
+                                                         UINT8 *pIv,
+                                                         const UINT8 *pIn,
+                                                         UINT8 *pOut,
+                                                         UINT32 numBlocks)
+{
+    __m128i rk[OSAL_AES_MAX_ROUND_KEYS];
+    __m128i block;
+    UINT32 rounds, r, i;
+
+    rounds = osalAesExpandKeyNi(pKey, keyLenInBytes, rk);
+    if (0 == rounds)
+    {
+        return OSAL_FAIL;
+    }
+
+    block = _mm_loadu_si128((const __m128i *)pIv);
+    for (i = 0; i < numBlocks; i++)
+    {
+        block = _mm_xor_si128(
+            block,
+            _mm_loadu_si128((const __m128i *)(pIn + i * OSAL_AES_BLOCK_BYTES)));
+        block = _mm_xor_si128(block, rk[0]);
+        for (r = 1; r < rounds; r++)
+        {
+            block = _mm_aesenc_si128(block, rk[r]);
+        }
+        block = _mm_aesenclast_si128(block, rk[rounds]);
+        _mm_storeu_si128((__m128i *)(pOut + i * OSAL_AES_BLOCK_BYTES), block);
+    }
+    _mm_storeu_si128((__m128i *)pIv, block);
+    memset(rk, 0, sizeof(rk));
+    return OSAL_SUCCESS;
+}
+
+/*
+ * CBC decryption with the equivalent inverse cipher. The blocks are
+ * independent, so four are kept in flight as for CTR. The ciphertext is
+ * loaded before the plaintext is stored, which allows pIn == pOut.
+ */
+OSAL_ACCEL_AES_FN static OSAL_STATUS osalAesCbcDecryptNi(const UINT8 *pKey,
+                                                         UINT32 keyLenInBytes,
+                                                         UINT8 *pIv,
+                                                         const UINT8 *pIn,
+                                                         UINT8 *pOut,
+                                                         UINT32 numBlocks)
+{
+    __m128i rk[OSAL_AES_MAX_ROUND_KEYS];
+    __m128i dk[OSAL_AES_MAX_ROUND_KEYS];
+    __m128i prev, c0, c1, c2, c3, b0, b1, b2, b3;
+    UINT32 rounds, r, i = 0;
+
+    rounds = osalAesExpandKeyNi(pKey, keyLenInBytes, rk);
+    if (0 == rounds)
+    {
+        return OSAL_FAIL;
+    }
+    dk[0] = rk[rounds];
+    for (r = 1; r < rounds; r++)
+    {
+        dk[r] = _mm_aesimc_si128(rk[rounds - r]);
+    }
+    dk[rounds] = rk[0];
+
+#define OSAL_AES_CBC_LOAD(n) \
+    _mm_loadu_si128((const __m128i *)(pIn + (i + (n)) * OSAL_AES_BLOCK_BYTES))
+#define OSAL_AES_CBC_STORE(n, blk) \
+    _mm_storeu_si128((__m128i *)(pOut + (i + (n)) * OSAL_AES_BLOCK_BYTES), blk)
+
+    prev = _mm_loadu_si128((const __m128i *)pIv);
+    for (; i + 4 <= numBlocks; i += 4)
+    {
+        c0 = OSAL_AES_CBC_LOAD(0);
+        c1 = OSAL_AES_CBC_LOAD(1);
+        c2 = OSAL_AES_CBC_LOAD(2);
+        c3 = OSAL_AES_CBC_LOAD(3);
+        b0 = _mm_xor_si128(c0, dk[0]);
+        b1 = _mm_xor_si128(c1, dk[0]);
+        b2 = _mm_xor_si128(c2, dk[0]);
+        b3 = _mm_xor_si128(c3, dk[0]);
+        for (r = 1; r < rounds; r++)
+        {
+            b0 = _mm_aesdec_si128(b0, dk[r]);
+            b1 = _mm_aesdec_si128(b1, dk[r]);
+            b2 = _mm_aesdec_si128(b2, dk[r]);
+            b3 = _mm_aesdec_si128(b3, dk[r]);
+        }
+        OSAL_AES_CBC_STORE(
+            0, _mm_xor_si128(_mm_aesdeclast_si128(b0, dk[rounds]), prev));
+        OSAL_AES_CBC_STORE(
+            1, _mm_xor_si128(_mm_aesdeclast_si128(b1, dk[rounds]), c0));
+        OSAL_AES_CBC_STORE(
+            2, _mm_xor_si128(_mm_aesdeclast_si128(b2, dk[rounds]), c1));
+        OSAL_AES_CBC_STORE(
+            3, _mm_xor_si128(_mm_aesdeclast_si128(b3, dk[rounds]), c2));
+        prev = c3;
+    }
+    for (; i < numBlocks; i++)
+    {
+        c0 = OSAL_AES_CBC_LOAD(0);
+        b0 = _mm_xor_si128(c0, dk[0]);
+        for (r = 1; r < rounds; r++)
+        {
+            b0 = _mm_aesdec_si128(b0, dk[r]);
+        }
+        OSAL_AES_CBC_STORE(
+            0, _mm_xor_si128(_mm_aesdeclast_si128(b0, dk[rounds]), prev));
+        prev = c0;
+    }
+#undef OSAL_AES_CBC_LOAD
+#undef OSAL_AES_CBC_STORE
+
+    _mm_storeu_si128((__m128i *)pIv, prev);
+    memset(rk, 0, sizeof(rk));
+    memset(dk, 0, sizeof(dk));
+    return OSAL_SUCCESS;
+}
+
+/*
+ * Carry-less multiplication in GF(2^128) of two byte reflected operands,
+ * with the product shifted left by one bit to undo the reflection and then
+ * reduced modulo x^128 + x^7 + x^2 + x + 1. This is the method of the Intel
+ * white paper on PCLMULQDQ and GCM.
+ */
+OSAL_ACCEL_CLMUL_FN static inline __m128i osalGfMulClmul(__m128i a, __m128i b)
+{
+    __m128i lo, hi, mid, t0, t1, t2;
+
+    lo = _mm_clmulepi64_si128(a, b, 0x00);
+    hi = _mm_clmulepi64_si128(a, b, 0x11);
+    mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10),
+                        _mm_clmulepi64_si128(a, b, 0x01));
+    lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+    hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+    /* Shift the 256 bit product left by one */
+    t0 = _mm_srli_epi32(lo, 31);
+    t1 = _mm_srli_epi32(hi, 31);
+    lo = _mm_slli_epi32(lo, 1);
+    hi = _mm_slli_epi32(hi, 1);
+    t2 = _mm_srli_si128(t0, 12);
+    t1 = _mm_slli_si128(t1, 4);
+    t0 = _mm_slli_si128(t0, 4);
+    lo = _mm_or_si128(lo, t0);
+    hi = _mm_or_si128(hi, t1);
+    hi = _mm_or_si128(hi, t2);
+
+    /* Reduce */
+    t0 = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31),
+                                     _mm_slli_epi32(lo, 30)),
+                       _mm_slli_epi32(lo, 25));
+    t1 = _mm_srli_si128(t0, 4);
+    t0 = _mm_slli_si128(t0, 12);
+    lo = _mm_xor_si128(lo, t0);
+    t2 = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1),
+                                     _mm_srli_epi32(lo, 2)),
+                       _mm_srli_epi32(lo, 7));
+    t2 = _mm_xor_si128(t2, t1);
+    lo = _mm_xor_si128(lo, t2);
+    return _mm_xor_si128(hi, lo);
+}
+
+OSAL_ACCEL_CLMUL_FN static void osalGhashClmul(const UINT8 *pHashKey,
+                                               UINT8 *pState,
+                                               const UINT8 *pIn,
+                                               UINT32 numBlocks)
+{
+    const __m128i mask =
+        _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+    __m128i h, x;
+    UINT32 i;
+
+    h = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)pHashKey), mask);
+    x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)pState), mask);
+    for (i = 0; i < numBlocks; i++)
+    {
+        x = _mm_xor_si128(
+            x,
+            _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(
+                                 pIn + i * OSAL_AES_BLOCK_BYTES)),
+                             mask));
+        x = osalGfMulClmul(x, h);
+    }
+    _mm_storeu_si128((__m128i *)pState, _mm_shuffle_epi8(x, mask));
+}
+
+static void osalCryptoAccelFillPattern(UINT8 *pBuf, UINT32 len, UINT8 seed)
+{
+    UINT32 i;
+
+    for (i = 0; i < len; i++)
+    {
+        pBuf[i] = (UINT8)(seed + i * 37);
+    }
+}
+
+/*
+ * Checks the accelerated code against the FIPS 180-4 digests of a two
+ * block message, then against the bundled scalar implementation on two
+ * chained blocks of a fixed pattern. Both cover the round logic and the
+ * handling of a non-initial state.
+ */
+static int osalCryptoAccelShaSelfTest(void)
+{
+    UINT8 block[2][OSAL_SHA_BLOCK_BYTES];
+    SHA_CTX sha1Ref, sha1Accel;
+    SHA256_CTX sha256Ref, sha256Accel;
+    int i;
+
+    /* Pad the message: a one bit, zeros and the 64 bit length in bits */
+    memset(block, 0, sizeof(block));
+    memcpy(block[0], osalShaTestMsg, sizeof(osalShaTestMsg) - 1);
+    block[0][sizeof(osalShaTestMsg) - 1] = 0x80;
+    block[1][OSAL_SHA_BLOCK_BYTES - 2] =
+        (UINT8)(((sizeof(osalShaTestMsg) - 1) << 3) >> 8);
+    block[1][OSAL_SHA_BLOCK_BYTES - 1] =
+        (UINT8)((sizeof(osalShaTestMsg) - 1) << 3);
+
+    ossl_SHA1_Init(&sha1Accel);
+    ossl_SHA256_Init(&sha256Accel);
+    for (i = 0; i < 2; i++)
+    {
+        osalSha1BlockNi((UINT32 *)&sha1Accel, block[i]);
+        osalSha256BlockNi(sha256Accel.h, block[i]);
+    }
+    if (memcmp(&sha1Accel, osalSha1TestOut, SHA_DIGEST_LENGTH) ||
+        memcmp(sha256Accel.h, osalSha256TestOut, SHA256_DIGEST_LENGTH))
+    {
+        return 0;
+    }
+
+    osalCryptoAccelFillPattern(block[0], OSAL_SHA_BLOCK_BYTES, 0x36);
+    osalCryptoAccelFillPattern(block[1], OSAL_SHA_BLOCK_BYTES, 0x5c);
+
+    ossl_SHA1_Init(&sha1Ref);
+    ossl_SHA1_Init(&sha1Accel);
+    ossl_SHA256_Init(&sha256Ref);
+    ossl_SHA256_Init(&sha256Accel);
+    for (i = 0; i < 2; i++)
+    {
+        ossl_SHA1_Transform(&sha1Ref, block[i]);
+        osalSha1BlockNi((UINT32 *)&sha1Accel, block[i]);
+        ossl_SHA256_Transform(&sha256Ref, block[i]);
+        osalSha256BlockNi(sha256Accel.h, block[i]);
+    }
+
+    if (memcmp(&sha1Ref, &sha1Accel, SHA_DIGEST_LENGTH) ||
+        memcmp(sha256Ref.h, sha256Accel.h, SHA256_DIGEST_LENGTH))
+    {
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * Checks the AES-NI block encryption against the FIPS 197 appendix C
+ * vectors for the three key sizes, then the CTR and CBC paths against the
+ * bundled scalar implementation.
+ */
+static int osalCryptoAccelAesSelfTest(void)
+{
+    static const UINT32 keyLens[] = {OSAL_AES_128_KEY_BYTES,
+                                     OSAL_AES_192_KEY_BYTES,
+                                     OSAL_AES_256_KEY_BYTES};
+    UINT8 key[OSAL_AES_256_KEY_BYTES];
+    UINT8 in[OSAL_AES_BLOCK_BYTES];
+    UINT8 outRef[OSAL_AES_BLOCK_BYTES];
+    UINT8 outAccel[OSAL_AES_BLOCK_BYTES];
+    UINT8 ctrRef[OSAL_AES_BLOCK_BYTES];
+    UINT8 ctrAccel[OSAL_AES_BLOCK_BYTES];
+    UINT8 ctrOutRef[OSAL_AES_CTR_TEST_BLOCKS * OSAL_AES_BLOCK_BYTES];
+    UINT8 ctrOutAccel[OSAL_AES_CTR_TEST_BLOCKS * OSAL_AES_BLOCK_BYTES];
+    UINT8 cbcIn[OSAL_AES_CTR_TEST_BLOCKS * OSAL_AES_BLOCK_BYTES];
+    AES_KEY scalarKey;
+    UINT32 i, j;
+    int k;
+
+    for (i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (UINT8)i;
+    }
+    for (i = 0; i < sizeof(keyLens) / sizeof(keyLens[0]); i++)
+    {
+        if (OSAL_SUCCESS !=
+                osalAesEncryptNi(key, keyLens[i], osalAesTestIn, outAccel) ||
+            memcmp(osalAesTestOut[i], outAccel, OSAL_AES_BLOCK_BYTES))
+        {
+            return 0;
+        }
+    }
+
+    /* The CTR and CBC paths are checked against the scalar code */
+    osalCryptoAccelFillPattern(key, sizeof(key), 0x00);
+    osalCryptoAccelFillPattern(in, sizeof(in), 0x11);
+
+    for (i = 0; i < sizeof(keyLens) / sizeof(keyLens[0]); i++)
+    {
+        if (ossl_AES_set_encrypt_key(key, keyLens[i] << 3, &scalarKey) < 0)
+        {
+            return 0;
+        }
+        ossl_AES_encrypt(in, outRef, &scalarKey);
+        if (OSAL_SUCCESS != osalAesEncryptNi(key, keyLens[i], in, outAccel) ||
+            memcmp(outRef, outAccel, OSAL_AES_BLOCK_BYTES))
+        {
+            return 0;
+        }
+
+        /* Five CTR blocks, with the low counter half about to carry, cover
+         * both the four block and the single block loops */
+        memset(ctrRef, 0xFF, sizeof(ctrRef));
+        ctrRef[0] = 0x7E;
+        ctrRef[OSAL_AES_BLOCK_BYTES - 1] = 0xFD;
+        memcpy(ctrAccel, ctrRef, sizeof(ctrRef));
+        for (j = 0; j < OSAL_AES_CTR_TEST_BLOCKS; j++)
+        {
+            for (k = OSAL_AES_BLOCK_BYTES - 1; k >= 0; k--)
+            {
+                if (0 != ++ctrRef[k])
+                {
+                    break;
+                }
+            }
+            ossl_AES_encrypt(ctrRef,
+                             ctrOutRef + j * OSAL_AES_BLOCK_BYTES,
+                             &scalarKey);
+        }
+        if (OSAL_SUCCESS != osalAesCtrNi(key,
+                                         keyLens[i],
+                                         ctrAccel,
+                                         ctrOutAccel,
+                                         OSAL_AES_CTR_TEST_BLOCKS) ||
+            memcmp(ctrOutRef, ctrOutAccel, sizeof(ctrOutRef)) ||
+            memcmp(ctrRef, ctrAccel, sizeof(ctrRef)))
+        {
+            return 0;
+        }
+
+        /* CBC round trip over the same five blocks, the decryption in
+         * place, against the scalar chaining */
+        memcpy(ctrRef, in, sizeof(in));
+        memcpy(ctrAccel, in, sizeof(in));
+        for (j = 0; j < OSAL_AES_CTR_TEST_BLOCKS; j++)
+        {
+            for (k = 0; k < OSAL_AES_BLOCK_BYTES; k++)
+            {
+                ctrRef[k] ^= ctrOutAccel[j * OSAL_AES_BLOCK_BYTES + k];
+            }
+            ossl_AES_encrypt(ctrRef, ctrRef, &scalarKey);
+            memcpy(ctrOutRef + j * OSAL_AES_BLOCK_BYTES,
+                   ctrRef,
+                   OSAL_AES_BLOCK_BYTES);
+        }
+        memcpy(cbcIn, ctrOutAccel, sizeof(cbcIn));
+        if (OSAL_SUCCESS != osalAesCbcEncryptNi(key,
+                                                keyLens[i],
+                                                ctrAccel,
+                                                cbcIn,
+                                                ctrOutAccel,
+                                                OSAL_AES_CTR_TEST_BLOCKS) ||
+            memcmp(ctrOutRef, ctrOutAccel, sizeof(ctrOutRef)) ||
+            memcmp(ctrRef, ctrAccel, sizeof(ctrRef)))
+        {
+            return 0;
+        }
+        memcpy(ctrAccel, in, sizeof(in));
+        if (OSAL_SUCCESS != osalAesCbcDecryptNi(key,
+                                                keyLens[i],
+                                                ctrAccel,
+                                                ctrOutAccel,
+                                                ctrOutAccel,
+                                                OSAL_AES_CTR_TEST_BLOCKS) ||
+            memcmp(cbcIn, ctrOutAccel, sizeof(cbcIn)) ||
+            memcmp(ctrRef, ctrAccel, sizeof(ctrRef)))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int osalCryptoAccelGhashSelfTest(void)
+{
+    UINT8 state[OSAL_AES_BLOCK_BYTES] = {0};
+
+    osalGhashClmul(
+        osalGhashTestKey, state, osalGhashTestIn, OSAL_GHASH_TEST_BLOCKS);
+    return (0 == memcmp(state, osalGhashTestOut, sizeof(state))) ? 1 : 0;
+}
+
+static void osalCryptoAccelInit(void)
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    const char *pEnv = getenv(OSAL_CRYPTO_ACCEL_ENV);
+
+    if (NULL != pEnv && 0 == strcmp(pEnv, "0"))
+    {
+        return;
+    }
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        return;
+    }
+    if ((ecx & (OSAL_CPUID_1_ECX_SSSE3 | OSAL_CPUID_1_ECX_SSE41)) !=
+        (OSAL_CPUID_1_ECX_SSSE3 | OSAL_CPUID_1_ECX_SSE41))
+    {
+        return;
+    }
+
+    if (ecx & OSAL_CPUID_1_ECX_AES)
+    {
+        osalCryptoAccelAes = osalCryptoAccelAesSelfTest();
+        if (!osalCryptoAccelAes)
+        {
+            osalLog(OSAL_LOG_LVL_ERROR,
+                    OSAL_LOG_DEV_STDOUT,
+                    "osalCryptoAccelInit: AES-NI self test failed, "
+                    "using the scalar AES code\n",
+                    0,
+                    0,
+                    0,
+                    0,
+                    0,
+                    0,
+                    0,
+                    0);
+        }
+    }
+
+    if (ecx & OSAL_CPUID_1_ECX_PCLMUL)
+    {
+        osalCryptoAccelClmul = osalCryptoAccelGhashSelfTest();
+        if (!osalCryptoAccelClmul)
+        {
+            osalLog(OSAL_LOG_LVL_ERROR,
+                    OSAL_LOG_DEV_STDOUT,
+                    "osalCryptoAccelInit: PCLMULQDQ self test failed, "
+                    "using the scalar GHASH code\n",
+                    0,
+                    0,
+                    0,
+                    0,
+                    0,
+                    0,
+                    0,
+                    0);
+        }
+    }
+
+    if (__get_cpuid_max(0, NULL) >= 7)
+    {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        if (ebx & OSAL_CPUID_7_EBX_SHA)
+        {
+            osalCryptoAccelSha = osalCryptoAccelShaSelfTest();
+            if (!osalCryptoAccelSha)
+            {
+                osalLog(OSAL_LOG_LVL_ERROR,
+                        OSAL_LOG_DEV_STDOUT,
+                        "osalCryptoAccelInit: SHA-NI self test failed, "
+                        "using the scalar SHA code\n",
+                        0,
+                        0,
+                        0,
+                        0,
+                        0,
+                        0,
+                        0,
+                        0);
+            }
+        }
+    }
+}
+
+OSAL_STATUS
+osalCryptoAccelSha1Block(UINT32 *pState, const UINT8 *pBlock)
+{
+    pthread_once(&osalCryptoAccelOnce, osalCryptoAccelInit);
+    if (!osalCryptoAccelSha)
+    {
+        return OSAL_FAIL;
+    }
+    osalSha1BlockNi(pState, pBlock);
+    return OSAL_SUCCESS;
+}
+
+OSAL_STATUS
+osalCryptoAccelSha256Block(UINT32 *pState, const UINT8 *pBlock)
+{
+    pthread_once(&osalCryptoAccelOnce, osalCryptoAccelInit);
+    if (!osalCryptoAccelSha)
+    {
+        return OSAL_FAIL;
+    }
+    osalSha256BlockNi(pState, pBlock);
+    return OSAL_SUCCESS;
+}
+
+OSAL_STATUS
+osalCryptoAccelAesEncrypt(const UINT8 *pKey,
+                          UINT32 keyLenInBytes,
+                          const UINT8 *pIn,
+                          UINT8 *pOut)
+{
+    pthread_once(&osalCryptoAccelOnce, osalCryptoAccelInit);
+    if (!osalCryptoAccelAes)
+    {
+        return OSAL_FAIL;
+    }
+    return osalAesEncryptNi(pKey, keyLenInBytes, pIn, pOut);
+}
+
+OSAL_STATUS
+osalCryptoAccelAesCtr(const UINT8 *pKey,
+                      UINT32 keyLenInBytes,
+                      UINT8 *pCounter,
+                      UINT8 *pOut,
+                      UINT32 numBlocks)
+{
+    pthread_once(&osalCryptoAccelOnce, osalCryptoAccelInit);
+    if (!osalCryptoAccelAes)
+    {
+        return OSAL_FAIL;
+    }
+    return osalAesCtrNi(pKey, keyLenInBytes, pCounter, pOut, numBlocks);
+}
+
+OSAL_STATUS
+osalCryptoAccelAesCbcEncrypt(const UINT8 *pKey,
+                             UINT32 keyLenInBytes,
+                             UINT8 *pIv,
+                             const UINT8 *pIn,
+                             UINT8 *pOut,
+                             UINT32 numBlocks)
+{
+    pthread_once(&osalCryptoAccelOnce, osalCryptoAccelInit);
+    if (!osalCryptoAccelAes)
+    {
+        return OSAL_FAIL;
+    }
+    return osalAesCbcEncryptNi(pKey, keyLenInBytes, pIv, pIn, pOut, numBlocks);
+}
+
+OSAL_STATUS
+osalCryptoAccelAesCbcDecrypt(const UINT8 *pKey,
+                             UINT32 keyLenInBytes,
+                             UINT8 *pIv,
+                             const UINT8 *pIn,
+                             UINT8 *pOut,
+                             UINT32 numBlocks)
+{
+    pthread_once(&osalCryptoAccelOnce, osalCryptoAccelInit);
+    if (!osalCryptoAccelAes)
+    {
+        return OSAL_FAIL;
+    }
+    return osalAesCbcDecryptNi(pKey, keyLenInBytes, pIv, pIn, pOut, numBlocks);
+}
+
+OSAL_STATUS
+osalCryptoAccelGhash(const UINT8 *pHashKey,
+                     UINT8 *pState,
+                     const UINT8 *pIn,
+                     UINT32 numBlocks)
+{
+    pthread_once(&osalCryptoAccelOnce, osalCryptoAccelInit);
+    if (!osalCryptoAccelClmul)
+    {
+        return OSAL_FAIL;
+    }
+    osalGhashClmul(pHashKey, pState, pIn, numBlocks);
+    return OSAL_SUCCESS;
+}
+
+#endif
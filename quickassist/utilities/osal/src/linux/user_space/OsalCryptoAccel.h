@@ -0,0 +1,118 @@
+/**
+ * @file OsalCryptoAccel.h
+ *
+ * @brief Instruction set accelerated block functions for the software
+ *        crypto used by the OSAL hash and AES helpers
+ *
+ *
+ * @par
+ *   BSD LICENSE
+ * 
+ *   Copyright(c) 2007-2018 Intel Corporation. All rights reserved.
+ *   All rights reserved.
+ * 
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ * 
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *     * Neither the name of Intel Corporation nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ * 
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  version: QAT1.7.L.4.5.0-00034
+ */
+
+#ifndef OSAL_CRYPTO_ACCEL_H
+#define OSAL_CRYPTO_ACCEL_H
+
+#include "Osal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Each function returns OSAL_SUCCESS when the block was processed with the
+ * CPU crypto extensions (SHA-NI, AES-NI, PCLMULQDQ) and OSAL_FAIL when they
+ * are unavailable or disabled, in which case the caller runs the scalar code.
+ * Availability is detected once, on first use, and the fast paths are
+ * checked against the scalar implementation before they are enabled.
+ * Setting QAT_OSAL_CRYPTO_ACCEL=0 in the environment forces the scalar
+ * code, which allows the two to be compared with the same binary.
+ */
+#if defined(__x86_64__) && !defined(USE_OPENSSL)
+
+OSAL_STATUS osalCryptoAccelSha1Block(UINT32 *pState, const UINT8 *pBlock);
+
+OSAL_STATUS osalCryptoAccelSha256Block(UINT32 *pState, const UINT8 *pBlock);
+
+OSAL_STATUS osalCryptoAccelAesEncrypt(const UINT8 *pKey,
+                                      UINT32 keyLenInBytes,
+                                      const UINT8 *pIn,
+                                      UINT8 *pOut);
+
+OSAL_STATUS osalCryptoAccelAesCtr(const UINT8 *pKey,
+                                  UINT32 keyLenInBytes,
+                                  UINT8 *pCounter,
+                                  UINT8 *pOut,
+                                  UINT32 numBlocks);
+
+OSAL_STATUS osalCryptoAccelAesCbcEncrypt(const UINT8 *pKey,
+                                         UINT32 keyLenInBytes,
+                                         UINT8 *pIv,
+                                         const UINT8 *pIn,
+                                         UINT8 *pOut,
+                                         UINT32 numBlocks);
+
+OSAL_STATUS osalCryptoAccelAesCbcDecrypt(const UINT8 *pKey,
+                                         UINT32 keyLenInBytes,
+                                         UINT8 *pIv,
+                                         const UINT8 *pIn,
+                                         UINT8 *pOut,
+                                         UINT32 numBlocks);
+
+OSAL_STATUS osalCryptoAccelGhash(const UINT8 *pHashKey,
+                                 UINT8 *pState,
+                                 const UINT8 *pIn,
+                                 UINT32 numBlocks);
+
+#else
+
+#define osalCryptoAccelSha1Block(pState, pBlock) OSAL_FAIL
+#define osalCryptoAccelSha256Block(pState, pBlock) OSAL_FAIL
+#define osalCryptoAccelAesEncrypt(pKey, keyLenInBytes, pIn, pOut) OSAL_FAIL
+#define osalCryptoAccelAesCtr(pKey, keyLenInBytes, pCounter, pOut, numBlocks)  \
+    OSAL_FAIL
+#define osalCryptoAccelAesCbcEncrypt(                                          \
+    pKey, keyLenInBytes, pIv, pIn, pOut, numBlocks)                            \
+    OSAL_FAIL
+#define osalCryptoAccelAesCbcDecrypt(                                          \
+    pKey, keyLenInBytes, pIv, pIn, pOut, numBlocks)                            \
+    OSAL_FAIL
+#define osalCryptoAccelGhash(pHashKey, pState, pIn, numBlocks) OSAL_FAIL
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OSAL_CRYPTO_ACCEL_H */
@@ -38,7 +38,13 @@
  *  version: QAT1.7.L.4.5.0-00034
  */
 
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
 #include "Osal.h"
+#include "OsalCryptoAccel.h"
 #ifdef USE_OPENSSL
 #include <openssl/md5.h>
 #include <openssl/sha.h>
@@ -55,17 +61,27 @@
 #define UPDATE(TYPE) TYPE##_Update
 #define FINAL(TYPE) TYPE##_Final
 #define OSAL_AES_SET_ENCRYPT AES_set_encrypt_key
+#define OSAL_AES_SET_DECRYPT AES_set_decrypt_key
 #define OSAL_AES_ENCRYPT AES_encrypt
+#define OSAL_AES_DECRYPT AES_decrypt
 #else
 #define INIT(TYPE) ossl_##TYPE##_Init
 #define TRANSFORM(TYPE) ossl_##TYPE##_Transform
 #define UPDATE(TYPE) ossl_##TYPE##_Update
 #define FINAL(TYPE) ossl_##TYPE##_Final
 #define OSAL_AES_SET_ENCRYPT ossl_AES_set_encrypt_key
+#define OSAL_AES_SET_DECRYPT ossl_AES_set_decrypt_key
 #define OSAL_AES_ENCRYPT ossl_AES_encrypt
+#define OSAL_AES_DECRYPT ossl_AES_decrypt
 #endif
 
 #define BYTE_TO_BITS_SHIFT 3
+#define OSAL_AES_BLOCK_BYTES 16
+#define OSAL_SHA_BLOCK_BYTES 64
+#define OSAL_SHA512_BLOCK_BYTES 128
+#define OSAL_GHASH_TABLE_SIZE 16
+#define OSAL_GHASH_R 0xE100000000000000ULL
+#define OSAL_URANDOM_PATH "/dev/urandom"
 
 OSAL_STATUS
 osalHashMD5(UINT8 *in, UINT8 *out)
@@ -102,7 +118,10 @@ osalHashSHA1(UINT8 *in, UINT8 *out)
     {
         return OSAL_FAIL;
     }
-    TRANSFORM(SHA1)(&ctx, in);
+    if (OSAL_SUCCESS != osalCryptoAccelSha1Block((UINT32 *)&ctx, in))
+    {
+        TRANSFORM(SHA1)(&ctx, in);
+    }
     memcpy(out, &ctx, SHA_DIGEST_LENGTH);
     return OSAL_SUCCESS;
 }
@@ -135,7 +154,10 @@ osalHashSHA224(UINT8 *in, UINT8 *out)
     {
         return OSAL_FAIL;
     }
-    TRANSFORM(SHA256)(&ctx, in);
+    if (OSAL_SUCCESS != osalCryptoAccelSha256Block((UINT32 *)&ctx, in))
+    {
+        TRANSFORM(SHA256)(&ctx, in);
+    }
     memcpy(out, &ctx, SHA256_DIGEST_LENGTH);
     return OSAL_SUCCESS;
 }
@@ -148,7 +170,10 @@ osalHashSHA256(UINT8 *in, UINT8 *out)
     {
         return OSAL_FAIL;
     }
-    TRANSFORM(SHA256)(&ctx, in);
+    if (OSAL_SUCCESS != osalCryptoAccelSha256Block((UINT32 *)&ctx, in))
+    {
+        TRANSFORM(SHA256)(&ctx, in);
+    }
     memcpy(out, &ctx, SHA256_DIGEST_LENGTH);
     return OSAL_SUCCESS;
 }
@@ -247,7 +272,13 @@ OSAL_STATUS
 osalAESEncrypt(UINT8 *key, UINT32 keyLenInBytes, UINT8 *in, UINT8 *out)
 {
     AES_KEY enc_key;
-    INT32 status = OSAL_AES_SET_ENCRYPT(
+    INT32 status = 0;
+
+    if (OSAL_SUCCESS == osalCryptoAccelAesEncrypt(key, keyLenInBytes, in, out))
+    {
+        return OSAL_SUCCESS;
+    }
+    status = OSAL_AES_SET_ENCRYPT(
         key, keyLenInBytes << BYTE_TO_BITS_SHIFT, &enc_key);
     if (status < 0)
     {
@@ -256,3 +287,419 @@ osalAESEncrypt(UINT8 *key, UINT32 keyLenInBytes, UINT8 *in, UINT8 *out)
     OSAL_AES_ENCRYPT(in, out, &enc_key);
     return OSAL_SUCCESS;
 }
+
+/* Adds one to a 16 byte big endian counter block */
+static void osalAESCtrIncrement(UINT8 *counter)
+{
+    INT32 i;
+
+    for (i = OSAL_AES_BLOCK_BYTES - 1; i >= 0; i--)
+    {
+        if (0 != ++counter[i])
+        {
+            break;
+        }
+    }
+}
+
+OSAL_STATUS
+osalAESCtrKeystream(UINT8 *key,
+                    UINT32 keyLenInBytes,
+                    UINT8 *counter,
+                    UINT8 *out,
+                    UINT32 numBlocks)
+{
+    AES_KEY enc_key;
+    INT32 status = 0;
+    UINT32 i;
+
+    if (OSAL_SUCCESS ==
+        osalCryptoAccelAesCtr(key, keyLenInBytes, counter, out, numBlocks))
+    {
+        return OSAL_SUCCESS;
+    }
+    status = OSAL_AES_SET_ENCRYPT(
+        key, keyLenInBytes << BYTE_TO_BITS_SHIFT, &enc_key);
+    if (status < 0)
+    {
+        return OSAL_FAIL;
+    }
+    for (i = 0; i < numBlocks; i++)
+    {
+        osalAESCtrIncrement(counter);
+        OSAL_AES_ENCRYPT(counter, out + i * OSAL_AES_BLOCK_BYTES, &enc_key);
+    }
+    memset(&enc_key, 0, sizeof(enc_key));
+    return OSAL_SUCCESS;
+}
+
+OSAL_STATUS
+osalAESCbcEncrypt(UINT8 *key,
+                  UINT32 keyLenInBytes,
+                  UINT8 *iv,
+                  UINT8 *in,
+                  UINT8 *out,
+                  UINT32 numBlocks)
+{
+    AES_KEY enc_key;
+    INT32 status = 0;
+    UINT32 i, j;
+
+    if (OSAL_SUCCESS == osalCryptoAccelAesCbcEncrypt(
+                            key, keyLenInBytes, iv, in, out, numBlocks))
+    {
+        return OSAL_SUCCESS;
+    }
+    status = OSAL_AES_SET_ENCRYPT(
+        key, keyLenInBytes << BYTE_TO_BITS_SHIFT, &enc_key);
+    if (status < 0)
+    {
+        return OSAL_FAIL;
+    }
+    for (i = 0; i < numBlocks; i++)
+    {
+        for (j = 0; j < OSAL_AES_BLOCK_BYTES; j++)
+        {
+            iv[j] ^= in[i * OSAL_AES_BLOCK_BYTES + j];
+        }
+        OSAL_AES_ENCRYPT(iv, iv, &enc_key);
+        memcpy(out + i * OSAL_AES_BLOCK_BYTES, iv, OSAL_AES_BLOCK_BYTES);
+    }
+    memset(&enc_key, 0, sizeof(enc_key));
+    return OSAL_SUCCESS;
+}
+
+OSAL_STATUS
+osalAESCbcDecrypt(UINT8 *key,
+                  UINT32 keyLenInBytes,
+                  UINT8 *iv,
+                  UINT8 *in,
+                  UINT8 *out,
+                  UINT32 numBlocks)
+{
+    AES_KEY dec_key;
+    UINT8 block[OSAL_AES_BLOCK_BYTES];
+    INT32 status = 0;
+    UINT32 i, j;
+
+    if (OSAL_SUCCESS == osalCryptoAccelAesCbcDecrypt(
+                            key, keyLenInBytes, iv, in, out, numBlocks))
+    {
+        return OSAL_SUCCESS;
+    }
+    status = OSAL_AES_SET_DECRYPT(
+        key, keyLenInBytes << BYTE_TO_BITS_SHIFT, &dec_key);
+    if (status < 0)
+    {
+        return OSAL_FAIL;
+    }
+    for (i = 0; i < numBlocks; i++)
+    {
+        /* Keep the ciphertext, out may be in */
+        memcpy(block, in + i * OSAL_AES_BLOCK_BYTES, OSAL_AES_BLOCK_BYTES);
+        OSAL_AES_DECRYPT(block, out + i * OSAL_AES_BLOCK_BYTES, &dec_key);
+        for (j = 0; j < OSAL_AES_BLOCK_BYTES; j++)
+        {
+            out[i * OSAL_AES_BLOCK_BYTES + j] ^= iv[j];
+        }
+        memcpy(iv, block, OSAL_AES_BLOCK_BYTES);
+    }
+    memset(&dec_key, 0, sizeof(dec_key));
+    return OSAL_SUCCESS;
+}
+
+static inline UINT64 osalLoadBe64(const UINT8 *p)
+{
+    UINT64 v = 0;
+    UINT32 i;
+
+    for (i = 0; i < sizeof(v); i++)
+    {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+static inline UINT32 osalLoadBe32(const UINT8 *p)
+{
+    return ((UINT32)p[0] << 24) | ((UINT32)p[1] << 16) | ((UINT32)p[2] << 8) |
+           (UINT32)p[3];
+}
+
+static inline void osalStoreBe64(UINT8 *p, UINT64 v)
+{
+    INT32 i;
+
+    for (i = sizeof(v) - 1; i >= 0; i--)
+    {
+        p[i] = (UINT8)v;
+        v >>= 8;
+    }
+}
+
+/* Reduction of the four bits shifted out of Z, in the top 16 bits */
+static const UINT64 osalGhashRem4[OSAL_GHASH_TABLE_SIZE] = {
+    0x0000ULL << 48, 0x1C20ULL << 48, 0x3840ULL << 48, 0x2460ULL << 48,
+    0x7080ULL << 48, 0x6CA0ULL << 48, 0x48C0ULL << 48, 0x54E0ULL << 48,
+    0xE100ULL << 48, 0xFD20ULL << 48, 0xD940ULL << 48, 0xC560ULL << 48,
+    0x9180ULL << 48, 0x8DA0ULL << 48, 0xA9C0ULL << 48, 0xB5E0ULL << 48};
+
+/*
+ * Scalar GHASH with Shoup's 4 bit tables: the multiples of H by every
+ * nibble value are built once per call and each block then costs 32 table
+ * lookups. Values are kept as big endian hi/lo halves.
+ */
+OSAL_STATUS
+osalGhash(UINT8 *hashKey, UINT8 *state, UINT8 *in, UINT32 numBlocks)
+{
+    UINT64 tableHi[OSAL_GHASH_TABLE_SIZE];
+    UINT64 tableLo[OSAL_GHASH_TABLE_SIZE];
+    UINT8 x[OSAL_AES_BLOCK_BYTES];
+    UINT64 zHi, zLo, vHi, vLo, rem;
+    UINT32 i, j, nib;
+    INT32 k;
+
+    if (OSAL_SUCCESS == osalCryptoAccelGhash(hashKey, state, in, numBlocks))
+    {
+        return OSAL_SUCCESS;
+    }
+
+    vHi = osalLoadBe64(hashKey);
+    vLo = osalLoadBe64(hashKey + sizeof(UINT64));
+    tableHi[0] = 0;
+    tableLo[0] = 0;
+    for (i = OSAL_GHASH_TABLE_SIZE >> 1; i > 0; i >>= 1)
+    {
+        tableHi[i] = vHi;
+        tableLo[i] = vLo;
+        /* Multiply by x */
+        rem = (vLo & 1) ? OSAL_GHASH_R : 0;
+        vLo = (vHi << 63) | (vLo >> 1);
+        vHi = (vHi >> 1) ^ rem;
+    }
+    for (i = 2; i < OSAL_GHASH_TABLE_SIZE; i <<= 1)
+    {
+        for (j = 1; j < i; j++)
+        {
+            tableHi[i + j] = tableHi[i] ^ tableHi[j];
+            tableLo[i + j] = tableLo[i] ^ tableLo[j];
+        }
+    }
+
+    memcpy(x, state, sizeof(x));
+    for (i = 0; i < numBlocks; i++)
+    {
+        for (j = 0; j < OSAL_AES_BLOCK_BYTES; j++)
+        {
+            x[j] ^= in[i * OSAL_AES_BLOCK_BYTES + j];
+        }
+        zHi = 0;
+        zLo = 0;
+        /* Horner's rule from the last nibble of the block */
+        for (k = OSAL_AES_BLOCK_BYTES * 2 - 1; k >= 0; k--)
+        {
+            nib = (k & 1) ? (x[k >> 1] & 0xF) : (x[k >> 1] >> 4);
+            if (k != OSAL_AES_BLOCK_BYTES * 2 - 1)
+            {
+                rem = zLo & 0xF;
+                zLo = (zHi << 60) | (zLo >> 4);
+                zHi = (zHi >> 4) ^ osalGhashRem4[rem];
+            }
+            zHi ^= tableHi[nib];
+            zLo ^= tableLo[nib];
+        }
+        osalStoreBe64(x, zHi);
+        osalStoreBe64(x + sizeof(UINT64), zLo);
+    }
+    memcpy(state, x, sizeof(x));
+    memset(tableHi, 0, sizeof(tableHi));
+    memset(tableLo, 0, sizeof(tableLo));
+    return OSAL_SUCCESS;
+}
+
+/*
+ * The resume functions load a one block state into the context and set the
+ * byte count accordingly. Whole blocks go through SHA-NI when it is present
+ * and the rest, with the padding, through the scalar update and final.
+ */
+static void osalHashBitCountSet(UINT64 bytes, UINT32 *pLo, UINT32 *pHi)
+{
+    *pLo = (UINT32)(bytes << BYTE_TO_BITS_SHIFT);
+    *pHi = (UINT32)(bytes >> (32 - BYTE_TO_BITS_SHIFT));
+}
+
+OSAL_STATUS
+osalHashSHA1Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    SHA_CTX ctx;
+    UINT32 done = 0;
+
+    if (!INIT(SHA1)(&ctx))
+    {
+        return OSAL_FAIL;
+    }
+    ctx.h0 = osalLoadBe32(state);
+    ctx.h1 = osalLoadBe32(state + 4);
+    ctx.h2 = osalLoadBe32(state + 8);
+    ctx.h3 = osalLoadBe32(state + 12);
+    ctx.h4 = osalLoadBe32(state + 16);
+    while ((len - done >= OSAL_SHA_BLOCK_BYTES) &&
+           (OSAL_SUCCESS ==
+            osalCryptoAccelSha1Block((UINT32 *)&ctx, in + done)))
+    {
+        done += OSAL_SHA_BLOCK_BYTES;
+    }
+    osalHashBitCountSet(
+        (UINT64)OSAL_SHA_BLOCK_BYTES + done, &ctx.Nl, &ctx.Nh);
+    UPDATE(SHA1)(&ctx, in + done, len - done);
+    FINAL(SHA1)(out, &ctx);
+    memset(&ctx, 0, sizeof(ctx));
+    return OSAL_SUCCESS;
+}
+
+/* SHA224 and SHA256 share the context, the digest length set by the init
+ * function tells them apart */
+static OSAL_STATUS osalHashSHA256StateResume(SHA256_CTX *pCtx,
+                                             UINT8 *state,
+                                             UINT8 *in,
+                                             UINT32 len,
+                                             UINT8 *out)
+{
+    UINT32 done = 0;
+    UINT32 i;
+
+    for (i = 0; i < sizeof(pCtx->h) / sizeof(pCtx->h[0]); i++)
+    {
+        pCtx->h[i] = osalLoadBe32(state + i * sizeof(UINT32));
+    }
+    while ((len - done >= OSAL_SHA_BLOCK_BYTES) &&
+           (OSAL_SUCCESS == osalCryptoAccelSha256Block(pCtx->h, in + done)))
+    {
+        done += OSAL_SHA_BLOCK_BYTES;
+    }
+    osalHashBitCountSet(
+        (UINT64)OSAL_SHA_BLOCK_BYTES + done, &pCtx->Nl, &pCtx->Nh);
+    UPDATE(SHA256)(pCtx, in + done, len - done);
+    FINAL(SHA256)(out, pCtx);
+    memset(pCtx, 0, sizeof(*pCtx));
+    return OSAL_SUCCESS;
+}
+
+OSAL_STATUS
+osalHashSHA224Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    SHA256_CTX ctx;
+
+    if (!INIT(SHA224)(&ctx))
+    {
+        return OSAL_FAIL;
+    }
+    return osalHashSHA256StateResume(&ctx, state, in, len, out);
+}
+
+OSAL_STATUS
+osalHashSHA256Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    SHA256_CTX ctx;
+
+    if (!INIT(SHA256)(&ctx))
+    {
+        return OSAL_FAIL;
+    }
+    return osalHashSHA256StateResume(&ctx, state, in, len, out);
+}
+
+/* Likewise for SHA384 and SHA512 */
+static OSAL_STATUS osalHashSHA512StateResume(SHA512_CTX *pCtx,
+                                             UINT8 *state,
+                                             UINT8 *in,
+                                             UINT32 len,
+                                             UINT8 *out)
+{
+    UINT32 i;
+
+    for (i = 0; i < sizeof(pCtx->h) / sizeof(pCtx->h[0]); i++)
+    {
+        pCtx->h[i] = osalLoadBe64(state + i * sizeof(UINT64));
+    }
+    pCtx->Nl = OSAL_SHA512_BLOCK_BYTES << BYTE_TO_BITS_SHIFT;
+    pCtx->Nh = 0;
+    UPDATE(SHA512)(pCtx, in, len);
+    FINAL(SHA512)(out, pCtx);
+    memset(pCtx, 0, sizeof(*pCtx));
+    return OSAL_SUCCESS;
+}
+
+OSAL_STATUS
+osalHashSHA384Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    SHA512_CTX ctx;
+
+    if (!INIT(SHA384)(&ctx))
+    {
+        return OSAL_FAIL;
+    }
+    return osalHashSHA512StateResume(&ctx, state, in, len, out);
+}
+
+OSAL_STATUS
+osalHashSHA512Resume(UINT8 *state, UINT8 *in, UINT32 len, UINT8 *out)
+{
+    SHA512_CTX ctx;
+
+    if (!INIT(SHA512)(&ctx))
+    {
+        return OSAL_FAIL;
+    }
+    return osalHashSHA512StateResume(&ctx, state, in, len, out);
+}
+
+OSAL_STATUS
+osalGetRandomBytes(UINT8 *out, UINT32 len)
+{
+    UINT32 done = 0;
+    ssize_t ret = 0;
+    int fd = -1;
+
+#ifdef SYS_getrandom
+    while (done < len)
+    {
+        ret = syscall(SYS_getrandom, out + done, len - done, 0);
+        if (ret < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            break;
+        }
+        done += (UINT32)ret;
+    }
+    if (done == len)
+    {
+        return OSAL_SUCCESS;
+    }
+#endif
+
+    /* Kernels without getrandom(2) */
+    fd = open(OSAL_URANDOM_PATH, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return OSAL_FAIL;
+    }
+    while (done < len)
+    {
+        ret = read(fd, out + done, len - done);
+        if (ret <= 0)
+        {
+            if (ret < 0 && EINTR == errno)
+            {
+                continue;
+            }
+            break;
+        }
+        done += (UINT32)ret;
+    }
+    close(fd);
+    return (done == len) ? OSAL_SUCCESS : OSAL_FAIL;
+}